@@ -146,6 +146,18 @@ transfer_single_new_db(migratorContext *ctx, pageCnvCtx *pageConverter,
 
 			while (numFiles--)
 			{
+				/*
+				 * Visibility maps before 9.1 have one bit per heap page, not
+				 * two, so they can't be used as is.  Leave them behind; the
+				 * next VACUUM rebuilds the map.
+				 */
+				if (GET_MAJOR_VERSION(ctx->old.major_version) <= 900 &&
+					strcmp(strchr(namelist[numFiles]->d_name, '_'), "_vm") == 0)
+				{
+					pg_free(namelist[numFiles]);
+					continue;
+				}
+
 				snprintf(old_file, sizeof(old_file), "%s/%s", maps[mapnum].old_file,
 						 namelist[numFiles]->d_name);
 				snprintf(new_file, sizeof(new_file), "%s/%u%s", maps[mapnum].new_file,
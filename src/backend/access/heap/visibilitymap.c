@@ -11,85 +11,74 @@
  *	  $PostgreSQL: pgsql/src/backend/access/heap/visibilitymap.c,v 1.11 2010/08/13 20:10:50 rhaas Exp $
  *
  * INTERFACE ROUTINES
- *		visibilitymap_clear - clear a bit in the visibility map
- *		visibilitymap_pin	- pin a map page for setting a bit
- *		visibilitymap_set	- set a bit in a previously pinned page
- *		visibilitymap_test	- test if a bit is set
+ *		visibilitymap_clear - clear bits in the visibility map
+ *		visibilitymap_pin	- pin a map page for setting or clearing a bit
+ *		visibilitymap_pin_ok - check whether correct map page is already pinned
+ *		visibilitymap_set	- set bits in a previously pinned page
+ *		visibilitymap_test	- test if the all-visible bit is set
+ *		visibilitymap_get_status - get the bits of a heap page
  *
  * NOTES
  *
- * The visibility map is a bitmap with one bit per heap page. A set bit means
- * that all tuples on the page are known visible to all transactions, and
- * therefore the page doesn't need to be vacuumed. The map is conservative in
- * the sense that we make sure that whenever a bit is set, we know the
- * condition is true, but if a bit is not set, it might or might not be true.
+ * The visibility map is a bitmap with two bits per heap page. The
+ * all-visible bit means that all tuples on the page are known visible to all
+ * transactions, and therefore the page doesn't need to be vacuumed. The
+ * all-frozen bit means that, in addition, all tuples on the page have been
+ * frozen, so that not even an anti-wraparound vacuum needs to look at the
+ * page.  The all-frozen bit is never set without the all-visible bit.
+ * Modifying the page clears both bits; locking a tuple stores the locker's
+ * xid in it without affecting visibility, so that clears only the
+ * all-frozen bit.  The map is conservative in the sense that
+ * we make sure that whenever a bit is set, we know the condition is true,
+ * but if a bit is not set, it might or might not be true.
  *
- * There's no explicit WAL logging in the functions in this file. The callers
- * must make sure that whenever a bit is cleared, the bit is cleared on WAL
- * replay of the updating operation as well. Setting bits during recovery
- * isn't necessary for correctness.
+ * Setting a bit is WAL-logged by visibilitymap_set, with a record whose
+ * replay also sets the PD_ALL_VISIBLE flag on the heap page, and the map
+ * page's LSN is advanced so that the map page can't reach disk before the
+ * record does.  Clearing a bit is not logged here: the heap operation that
+ * clears PD_ALL_VISIBLE records that fact in its own WAL record, and replay
+ * of that record clears the bits again.  If the map page is written out with
+ * a bit cleared but the heap record is lost in a crash, the bit is merely
+ * cleared unnecessarily, which is always safe.
  *
- * Currently, the visibility map is only used as a hint, to speed up VACUUM.
- * A corrupted visibility map won't cause data corruption, although it can
- * make VACUUM skip pages that need vacuuming, until the next anti-wraparound
- * vacuum. The visibility map is not used for anti-wraparound vacuums, because
- * an anti-wraparound vacuum needs to freeze tuples and observe the latest xid
- * present in the table, even on pages that don't have any dead tuples.
+ * The visibility map is used by VACUUM to skip pages that need no vacuuming,
+ * and by index-only scans to skip visiting heap pages whose tuples are all
+ * visible.  The latter means a wrongly set bit can produce wrong query
+ * results.  An anti-wraparound vacuum needs to freeze tuples and observe the
+ * latest xid present in the table, even on pages that don't have any dead
+ * tuples, so it can only skip pages marked all-frozen.
  *
- * Although the visibility map is just a hint at the moment, the PD_ALL_VISIBLE
- * flag on heap pages *must* be correct, because it is used to skip visibility
- * checking.
+ * The PD_ALL_VISIBLE flag on heap pages *must* be correct, because it is
+ * used to skip visibility checking.
  *
  * LOCKING
  *
  * In heapam.c, whenever a page is modified so that not all tuples on the
- * page are visible to everyone anymore, the corresponding bit in the
- * visibility map is cleared. The bit in the visibility map is cleared
- * after releasing the lock on the heap page, to avoid holding the lock
- * over possible I/O to read in the visibility map page.
+ * page are visible to everyone anymore, the corresponding bits in the
+ * visibility map are cleared.  That happens in the same critical section
+ * that clears PD_ALL_VISIBLE, while the heap page is still exclusively
+ * locked, so nobody can see the modified page with the bit still set.  To
+ * avoid holding the heap page lock over possible I/O to read in the map
+ * page, the caller pins the map page with visibilitymap_pin before locking
+ * the heap page, and rechecks PD_ALL_VISIBLE once it has the lock.
  *
  * To set a bit, you need to hold a lock on the heap page. That prevents
  * the race condition where VACUUM sees that all tuples on the page are
  * visible to everyone, but another backend modifies the page before VACUUM
  * sets the bit in the visibility map.
  *
- * When a bit is set, the LSN of the visibility map page is updated to make
- * sure that the visibility map update doesn't get written to disk before the
- * WAL record of the changes that made it possible to set the bit is flushed.
- * But when a bit is cleared, we don't have to do that because it's always
- * safe to clear a bit in the map from correctness point of view.
- *
- * TODO
- *
- * It would be nice to use the visibility map to skip visibility checks in
- * index scans.
- *
- * Currently, the visibility map is not 100% correct all the time.
- * During updates, the bit in the visibility map is cleared after releasing
- * the lock on the heap page. During the window between releasing the lock
- * and clearing the bit in the visibility map, the bit in the visibility map
- * is set, but the new insertion or deletion is not yet visible to other
- * backends.
- *
- * That might actually be OK for the index scans, though. The newly inserted
- * tuple wouldn't have an index pointer yet, so all tuples reachable from an
- * index would still be visible to all other backends, and deletions wouldn't
- * be visible to other backends yet.  (But HOT breaks that argument, no?)
- *
- * There's another hole in the way the PD_ALL_VISIBLE flag is set. When
- * vacuum observes that all tuples are visible to all, it sets the flag on
- * the heap page, and also sets the bit in the visibility map. If we then
- * crash, and only the visibility map page was flushed to disk, we'll have
- * a bit set in the visibility map, but the corresponding flag on the heap
- * page is not set. If the heap page is then updated, the updater won't
- * know to clear the bit in the visibility map.  (Isn't that prevented by
- * the LSN interlock?)
+ * When a bit is set, the LSN of the visibility map page is advanced to that
+ * of the WAL record, so that the map page can't be written to disk before
+ * the record is.  When a bit is cleared, we don't have to do that because
+ * it's always safe to clear a bit in the map from correctness point of view.
  *
  *-------------------------------------------------------------------------
  */
 #include "postgres.h"
 
+#include "access/heapam.h"
 #include "access/visibilitymap.h"
+#include "miscadmin.h"
 #include "storage/bufmgr.h"
 #include "storage/bufpage.h"
 #include "storage/lmgr.h"
@@ -106,10 +95,10 @@
 #define MAPSIZE (BLCKSZ - MAXALIGN(SizeOfPageHeaderData))
 
 /* Number of bits allocated for each heap block. */
-#define BITS_PER_HEAPBLOCK 1
+#define BITS_PER_HEAPBLOCK 2
 
 /* Number of heap blocks we can represent in one byte. */
-#define HEAPBLOCKS_PER_BYTE 8
+#define HEAPBLOCKS_PER_BYTE 4
 
 /* Number of heap blocks we can represent in one visibility map page. */
 #define HEAPBLOCKS_PER_PAGE (MAPSIZE * HEAPBLOCKS_PER_BYTE)
@@ -117,7 +106,7 @@
 /* Mapping from heap block number to the right bit in the visibility map */
 #define HEAPBLK_TO_MAPBLOCK(x) ((x) / HEAPBLOCKS_PER_PAGE)
 #define HEAPBLK_TO_MAPBYTE(x) (((x) % HEAPBLOCKS_PER_PAGE) / HEAPBLOCKS_PER_BYTE)
-#define HEAPBLK_TO_MAPBIT(x) ((x) % HEAPBLOCKS_PER_BYTE)
+#define HEAPBLK_TO_MAPBIT(x) (((x) % HEAPBLOCKS_PER_BYTE) * BITS_PER_HEAPBLOCK)
 
 /* prototypes for internal routines */
 static Buffer vm_readbuf(Relation rel, BlockNumber blkno, bool extend);
@@ -125,50 +114,64 @@ static void vm_extend(Relation rel, BlockNumber nvmblocks);
 
 
 /*
- *	visibilitymap_clear - clear a bit in visibility map
+ *	visibilitymap_clear - clear bits of a heap page in visibility map
  *
- * Clear a bit in the visibility map, marking that not all tuples are
- * visible to all transactions anymore.
+ * flags is VISIBILITYMAP_VALID_BITS to clear both bits, marking that not all
+ * tuples are visible to all transactions, or frozen, anymore, or
+ * VISIBILITYMAP_ALL_FROZEN to clear just the all-frozen bit.  Returns true
+ * if any of the bits were set.
+ *
+ * buf must be the map page for heapBlk, already pinned with
+ * visibilitymap_pin.  This function doesn't do any I/O, so it can be called
+ * inside a critical section while holding the lock on the heap page.
  */
-void
-visibilitymap_clear(Relation rel, BlockNumber heapBlk)
+bool
+visibilitymap_clear(Relation rel, BlockNumber heapBlk, Buffer buf, uint8 flags)
 {
 	BlockNumber mapBlock = HEAPBLK_TO_MAPBLOCK(heapBlk);
 	int			mapByte = HEAPBLK_TO_MAPBYTE(heapBlk);
 	int			mapBit = HEAPBLK_TO_MAPBIT(heapBlk);
-	uint8		mask = 1 << mapBit;
-	Buffer		mapBuffer;
+	uint8		mask = flags << mapBit;
 	char	   *map;
+	bool		cleared = false;
 
 #ifdef TRACE_VISIBILITYMAP
-	elog(DEBUG1, "vm_clear %s %d", RelationGetRelationName(rel), heapBlk);
+	elog(DEBUG1, "vm_clear %s %d %u", RelationGetRelationName(rel), heapBlk,
+		 flags);
 #endif
 
-	mapBuffer = vm_readbuf(rel, mapBlock, false);
-	if (!BufferIsValid(mapBuffer))
-		return;					/* nothing to do */
+	/* the all-frozen bit can't be left set without the all-visible bit */
+	Assert(flags == VISIBILITYMAP_VALID_BITS ||
+		   flags == VISIBILITYMAP_ALL_FROZEN);
+
+	if (!BufferIsValid(buf) || BufferGetBlockNumber(buf) != mapBlock)
+		elog(ERROR, "wrong buffer passed to visibilitymap_clear");
 
-	LockBuffer(mapBuffer, BUFFER_LOCK_EXCLUSIVE);
-	map = PageGetContents(BufferGetPage(mapBuffer));
+	LockBuffer(buf, BUFFER_LOCK_EXCLUSIVE);
+	map = PageGetContents(BufferGetPage(buf));
 
 	if (map[mapByte] & mask)
 	{
 		map[mapByte] &= ~mask;
 
-		MarkBufferDirty(mapBuffer);
+		MarkBufferDirty(buf);
+		cleared = true;
 	}
 
-	UnlockReleaseBuffer(mapBuffer);
+	LockBuffer(buf, BUFFER_LOCK_UNLOCK);
+
+	return cleared;
 }
 
 /*
- *	visibilitymap_pin - pin a map page for setting a bit
+ *	visibilitymap_pin - pin a map page for setting or clearing a bit
  *
  * Setting a bit in the visibility map is a two-phase operation. First, call
  * visibilitymap_pin, to pin the visibility map page containing the bit for
  * the heap page. Because that can require I/O to read the map page, you
  * shouldn't hold a lock on the heap page while doing that. Then, call
- * visibilitymap_set to actually set the bit.
+ * visibilitymap_set to actually set the bit.  Clearing a bit works the same
+ * way, with visibilitymap_clear.
  *
  * On entry, *buf should be InvalidBuffer or a valid buffer returned by
  * an earlier call to visibilitymap_pin or visibilitymap_test on the same
@@ -194,19 +197,42 @@ visibilitymap_pin(Relation rel, BlockNumber heapBlk, Buffer *buf)
 }
 
 /*
- *	visibilitymap_set - set a bit on a previously pinned page
+ *	visibilitymap_pin_ok - do we already have the correct page pinned?
+ *
+ * On entry, buf should be InvalidBuffer or a valid buffer returned by
+ * an earlier call to visibilitymap_pin or visibilitymap_test on the same
+ * relation.  The return value indicates whether the buffer covers the
+ * given heapBlk.
+ */
+bool
+visibilitymap_pin_ok(BlockNumber heapBlk, Buffer buf)
+{
+	BlockNumber mapBlock = HEAPBLK_TO_MAPBLOCK(heapBlk);
+
+	return BufferIsValid(buf) && BufferGetBlockNumber(buf) == mapBlock;
+}
+
+/*
+ *	visibilitymap_set - set bits on a previously pinned page
  *
- * recptr is the LSN of the heap page. The LSN of the visibility map page is
- * advanced to that, to make sure that the visibility map doesn't get flushed
- * to disk before the update to the heap page that made all tuples visible.
+ * flags is VISIBILITYMAP_ALL_VISIBLE, optionally ORed with
+ * VISIBILITYMAP_ALL_FROZEN if all tuples on the heap page are frozen.  Bits
+ * that are already set stay set.
+ *
+ * The caller must already have set PD_ALL_VISIBLE on the heap page.  Unless
+ * the relation is temporary, setting the bits is WAL-logged, with cutoff_xid
+ * (the newest xmin on the heap page, or InvalidTransactionId if none) for
+ * hot standby conflict resolution.  During WAL replay, recptr is the LSN of
+ * the record being replayed, and nothing is logged; otherwise pass
+ * InvalidXLogRecPtr.
  *
  * This is an opportunistic function. It does nothing, unless *buf
- * contains the bit for heapBlk. Call visibilitymap_pin first to pin
+ * contains the bits for heapBlk. Call visibilitymap_pin first to pin
  * the right map page. This function doesn't do any I/O.
  */
 void
 visibilitymap_set(Relation rel, BlockNumber heapBlk, XLogRecPtr recptr,
-				  Buffer *buf)
+				  Buffer *buf, TransactionId cutoff_xid, uint8 flags)
 {
 	BlockNumber mapBlock = HEAPBLK_TO_MAPBLOCK(heapBlk);
 	uint32		mapByte = HEAPBLK_TO_MAPBYTE(heapBlk);
@@ -215,9 +241,13 @@ visibilitymap_set(Relation rel, BlockNumber heapBlk, XLogRecPtr recptr,
 	char	   *map;
 
 #ifdef TRACE_VISIBILITYMAP
-	elog(DEBUG1, "vm_set %s %d", RelationGetRelationName(rel), heapBlk);
+	elog(DEBUG1, "vm_set %s %d %u", RelationGetRelationName(rel), heapBlk,
+		 flags);
 #endif
 
+	Assert(flags & VISIBILITYMAP_ALL_VISIBLE);
+	Assert((flags & ~VISIBILITYMAP_VALID_BITS) == 0);
+
 	/* Check that we have the right page pinned */
 	if (!BufferIsValid(*buf) || BufferGetBlockNumber(*buf) != mapBlock)
 		return;
@@ -226,41 +256,64 @@ visibilitymap_set(Relation rel, BlockNumber heapBlk, XLogRecPtr recptr,
 	map = PageGetContents(page);
 	LockBuffer(*buf, BUFFER_LOCK_EXCLUSIVE);
 
-	if (!(map[mapByte] & (1 << mapBit)))
+	if (((map[mapByte] >> mapBit) & flags) != flags)
 	{
-		map[mapByte] |= (1 << mapBit);
+		START_CRIT_SECTION();
 
-		if (XLByteLT(PageGetLSN(page), recptr))
-			PageSetLSN(page, recptr);
-		PageSetTLI(page, ThisTimeLineID);
+		map[mapByte] |= (flags << mapBit);
 		MarkBufferDirty(*buf);
+
+		if (!rel->rd_istemp)
+		{
+			if (XLogRecPtrIsInvalid(recptr))
+				recptr = log_heap_visible(rel->rd_node, heapBlk, *buf,
+										  cutoff_xid, flags);
+			PageSetLSN(page, recptr);
+			PageSetTLI(page, ThisTimeLineID);
+		}
+
+		END_CRIT_SECTION();
 	}
 
 	LockBuffer(*buf, BUFFER_LOCK_UNLOCK);
 }
 
 /*
- *	visibilitymap_test - test if a bit is set
+ *	visibilitymap_test - test if the all-visible bit is set
  *
  * Are all tuples on heapBlk visible to all, according to the visibility map?
  *
  * On entry, *buf should be InvalidBuffer or a valid buffer returned by an
- * earlier call to visibilitymap_pin or visibilitymap_test on the same
- * relation. On return, *buf is a valid buffer with the map page containing
- * the bit for heapBlk, or InvalidBuffer. The caller is responsible for
- * releasing *buf after it's done testing and setting bits.
+ * earlier call to visibilitymap_pin, visibilitymap_test or
+ * visibilitymap_get_status on the same relation. On return, *buf is a valid
+ * buffer with the map page containing the bits for heapBlk, or
+ * InvalidBuffer. The caller is responsible for releasing *buf after it's
+ * done testing and setting bits.
  */
 bool
 visibilitymap_test(Relation rel, BlockNumber heapBlk, Buffer *buf)
+{
+	return (visibilitymap_get_status(rel, heapBlk, buf) &
+			VISIBILITYMAP_ALL_VISIBLE) != 0;
+}
+
+/*
+ *	visibilitymap_get_status - get the bits of a heap page
+ *
+ * Returns the VISIBILITYMAP_* bits that are set for heapBlk.  *buf is
+ * handled as in visibilitymap_test.
+ */
+uint8
+visibilitymap_get_status(Relation rel, BlockNumber heapBlk, Buffer *buf)
 {
 	BlockNumber mapBlock = HEAPBLK_TO_MAPBLOCK(heapBlk);
 	uint32		mapByte = HEAPBLK_TO_MAPBYTE(heapBlk);
 	uint8		mapBit = HEAPBLK_TO_MAPBIT(heapBlk);
-	bool		result;
+	uint8		result;
 	char	   *map;
 
 #ifdef TRACE_VISIBILITYMAP
-	elog(DEBUG1, "vm_test %s %d", RelationGetRelationName(rel), heapBlk);
+	elog(DEBUG1, "vm_get_status %s %d", RelationGetRelationName(rel), heapBlk);
 #endif
 
 	/* Reuse the old pinned buffer if possible */
@@ -277,15 +330,16 @@ visibilitymap_test(Relation rel, BlockNumber heapBlk, Buffer *buf)
 	{
 		*buf = vm_readbuf(rel, mapBlock, false);
 		if (!BufferIsValid(*buf))
-			return false;
+			return 0;
 	}
 
 	map = PageGetContents(BufferGetPage(*buf));
 
 	/*
-	 * We don't need to lock the page, as we're only looking at a single bit.
+	 * We don't need to lock the page, as we're only looking at the bits of
+	 * a single heap page, which are read in one go.
 	 */
-	result = (map[mapByte] & (1 << mapBit)) ? true : false;
+	result = (map[mapByte] >> mapBit) & VISIBILITYMAP_VALID_BITS;
 
 	return result;
 }
@@ -353,10 +407,12 @@ visibilitymap_truncate(Relation rel, BlockNumber nheapblocks)
 		MemSet(&map[truncByte + 1], 0, MAPSIZE - (truncByte + 1));
 
 		/*
-		 * Mask out the unwanted bits of the last remaining byte.
+		 * Mask out the unwanted bits of the last remaining byte.  truncBit
+		 * is the position of the first bit of the first truncated heap
+		 * block, so this keeps the bits of the heap blocks before it.
 		 *
-		 * ((1 << 0) - 1) = 00000000 ((1 << 1) - 1) = 00000001 ... ((1 << 6) -
-		 * 1) = 00111111 ((1 << 7) - 1) = 01111111
+		 * ((1 << 0) - 1) = 00000000 ((1 << 2) - 1) = 00000011 ... ((1 << 6) -
+		 * 1) = 00111111
 		 */
 		map[truncByte] &= (1 << truncBit) - 1;
 
@@ -105,9 +105,13 @@ RelationGetIndexScan(Relation indexRelation,
 	scan->kill_prior_tuple = false;
 	scan->xactStartedInRecovery = TransactionStartedDuringRecovery();
 	scan->ignore_killed_tuples = !scan->xactStartedInRecovery;
+	scan->xs_want_itup = false;	/* caller must initialize this */
+	scan->xs_prefetch_pages = 0;	/* likewise */
 
 	scan->opaque = NULL;
 
+	scan->xs_itup = NULL;
+
 	ItemPointerSetInvalid(&scan->xs_ctup.t_self);
 	scan->xs_ctup.t_data = NULL;
 	scan->xs_cbuf = InvalidBuffer;
@@ -280,7 +280,18 @@ btgettuple(PG_FUNCTION_ARGS)
 		res = _bt_next(scan, dir);
 	}
 	else
+	{
+		/*
+		 * If the caller wants index tuples, allocate the workspaces to copy
+		 * them into before the first page is read.
+		 */
+		if (scan->xs_want_itup && so->currTuples == NULL)
+		{
+			so->currTuples = (char *) palloc(BLCKSZ * 2);
+			so->markTuples = so->currTuples + BLCKSZ;
+		}
 		res = _bt_first(scan, dir);
+	}
 
 	PG_RETURN_BOOL(res);
 }
@@ -369,6 +380,9 @@ btrescan(PG_FUNCTION_ARGS)
 			so->keyData = NULL;
 		so->killedItems = NULL; /* until needed */
 		so->numKilled = 0;
+		so->currTuples = so->markTuples = NULL;	/* until needed */
+		/* prefetch distance deliberately survives rescans, see _bt_prefetch */
+		so->prefetchDistance = 0;
 		scan->opaque = so;
 	}
 
@@ -430,6 +444,9 @@ btendscan(PG_FUNCTION_ARGS)
 
 	if (so->killedItems != NULL)
 		pfree(so->killedItems);
+	if (so->currTuples != NULL)
+		pfree(so->currTuples);
+	/* so->markTuples should not be pfree'd, see btgettuple */
 	if (so->keyData != NULL)
 		pfree(so->keyData);
 	pfree(so);
@@ -504,6 +521,9 @@ btrestrpos(PG_FUNCTION_ARGS)
 			memcpy(&so->currPos, &so->markPos,
 				   offsetof(BTScanPosData, items[1]) +
 				   so->markPos.lastItem * sizeof(BTScanPosItem));
+			if (so->currTuples)
+				memcpy(so->currTuples, so->markTuples,
+					   so->markPos.nextTupleOffset);
 		}
 	}
 
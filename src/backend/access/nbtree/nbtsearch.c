@@ -27,7 +27,10 @@
 
 static bool _bt_readpage(IndexScanDesc scan, ScanDirection dir,
 			 OffsetNumber offnum);
+static void _bt_saveitem(BTScanOpaque so, int itemIndex,
+			 OffsetNumber offnum, IndexTuple itup);
 static bool _bt_steppage(IndexScanDesc scan, ScanDirection dir);
+static void _bt_prefetch(IndexScanDesc scan, ScanDirection dir);
 static Buffer _bt_walk_left(Relation rel, Buffer buf);
 static bool _bt_endpoint(IndexScanDesc scan, ScanDirection dir);
 
@@ -456,6 +459,7 @@ _bt_first(IndexScanDesc scan, ScanDirection dir)
 	int			keysCount = 0;
 	int			i;
 	StrategyNumber strat_total;
+	BTScanPosItem *currItem;
 
 	pgstat_count_index_scan(rel);
 
@@ -903,7 +907,13 @@ _bt_first(IndexScanDesc scan, ScanDirection dir)
 	LockBuffer(so->currPos.buf, BUFFER_LOCK_UNLOCK);
 
 	/* OK, itemIndex says what to return */
-	scan->xs_ctup.t_self = so->currPos.items[so->currPos.itemIndex].heapTid;
+	currItem = &so->currPos.items[so->currPos.itemIndex];
+	scan->xs_ctup.t_self = currItem->heapTid;
+	if (scan->xs_want_itup)
+		scan->xs_itup = (IndexTuple) (so->currTuples + currItem->tupleOffset);
+
+	/* Start reading the heap pages of the next few items */
+	_bt_prefetch(scan, dir);
 
 	return true;
 }
@@ -916,7 +926,8 @@ _bt_first(IndexScanDesc scan, ScanDirection dir)
  *		previously returned.
  *
  *		On successful exit, scan->xs_ctup.t_self is set to the TID of the
- *		next heap tuple, and so->currPos is updated as needed.
+ *		next heap tuple, and if requested, scan->xs_itup points to a copy of
+ *		the index tuple.  so->currPos is updated as needed.
  *
  *		On failure exit (no more tuples), we release pin and set
  *		so->currPos.buf to InvalidBuffer.
@@ -925,6 +936,7 @@ bool
 _bt_next(IndexScanDesc scan, ScanDirection dir)
 {
 	BTScanOpaque so = (BTScanOpaque) scan->opaque;
+	BTScanPosItem *currItem;
 
 	/*
 	 * Advance to next tuple on current page; or if there's no more, try to
@@ -958,7 +970,13 @@ _bt_next(IndexScanDesc scan, ScanDirection dir)
 	}
 
 	/* OK, itemIndex says what to return */
-	scan->xs_ctup.t_self = so->currPos.items[so->currPos.itemIndex].heapTid;
+	currItem = &so->currPos.items[so->currPos.itemIndex];
+	scan->xs_ctup.t_self = currItem->heapTid;
+	if (scan->xs_want_itup)
+		scan->xs_itup = (IndexTuple) (so->currTuples + currItem->tupleOffset);
+
+	/* Start reading the heap pages of the next few items */
+	_bt_prefetch(scan, dir);
 
 	return true;
 }
@@ -987,6 +1005,7 @@ _bt_readpage(IndexScanDesc scan, ScanDirection dir, OffsetNumber offnum)
 	OffsetNumber minoff;
 	OffsetNumber maxoff;
 	int			itemIndex;
+	IndexTuple	itup;
 	bool		continuescan;
 
 	/* we must have the buffer pinned and locked */
@@ -1004,6 +1023,12 @@ _bt_readpage(IndexScanDesc scan, ScanDirection dir, OffsetNumber offnum)
 	 */
 	so->currPos.nextPage = opaque->btpo_next;
 
+	/* initialize tuple workspace to empty */
+	so->currPos.nextTupleOffset = 0;
+
+	/* nothing on this page has been prefetched yet */
+	so->prefetchBlock = InvalidBlockNumber;
+
 	if (ScanDirectionIsForward(dir))
 	{
 		/* load items[] in ascending order */
@@ -1013,12 +1038,11 @@ _bt_readpage(IndexScanDesc scan, ScanDirection dir, OffsetNumber offnum)
 
 		while (offnum <= maxoff)
 		{
-			if (_bt_checkkeys(scan, page, offnum, dir, &continuescan))
+			itup = _bt_checkkeys(scan, page, offnum, dir, &continuescan);
+			if (itup != NULL)
 			{
 				/* tuple passes all scan key conditions, so remember it */
-				/* _bt_checkkeys put the heap ptr into scan->xs_ctup.t_self */
-				so->currPos.items[itemIndex].heapTid = scan->xs_ctup.t_self;
-				so->currPos.items[itemIndex].indexOffset = offnum;
+				_bt_saveitem(so, itemIndex, offnum, itup);
 				itemIndex++;
 			}
 			if (!continuescan)
@@ -1035,6 +1059,7 @@ _bt_readpage(IndexScanDesc scan, ScanDirection dir, OffsetNumber offnum)
 		so->currPos.firstItem = 0;
 		so->currPos.lastItem = itemIndex - 1;
 		so->currPos.itemIndex = 0;
+		so->prefetchItem = 0;
 	}
 	else
 	{
@@ -1045,13 +1070,12 @@ _bt_readpage(IndexScanDesc scan, ScanDirection dir, OffsetNumber offnum)
 
 		while (offnum >= minoff)
 		{
-			if (_bt_checkkeys(scan, page, offnum, dir, &continuescan))
+			itup = _bt_checkkeys(scan, page, offnum, dir, &continuescan);
+			if (itup != NULL)
 			{
 				/* tuple passes all scan key conditions, so remember it */
-				/* _bt_checkkeys put the heap ptr into scan->xs_ctup.t_self */
 				itemIndex--;
-				so->currPos.items[itemIndex].heapTid = scan->xs_ctup.t_self;
-				so->currPos.items[itemIndex].indexOffset = offnum;
+				_bt_saveitem(so, itemIndex, offnum, itup);
 			}
 			if (!continuescan)
 			{
@@ -1067,11 +1091,118 @@ _bt_readpage(IndexScanDesc scan, ScanDirection dir, OffsetNumber offnum)
 		so->currPos.firstItem = itemIndex;
 		so->currPos.lastItem = MaxIndexTuplesPerPage - 1;
 		so->currPos.itemIndex = MaxIndexTuplesPerPage - 1;
+		so->prefetchItem = MaxIndexTuplesPerPage - 1;
 	}
 
 	return (so->currPos.firstItem <= so->currPos.lastItem);
 }
 
+/* Save an index item into so->currPos.items[itemIndex] */
+static void
+_bt_saveitem(BTScanOpaque so, int itemIndex,
+			 OffsetNumber offnum, IndexTuple itup)
+{
+	BTScanPosItem *currItem = &so->currPos.items[itemIndex];
+
+	currItem->heapTid = itup->t_tid;
+	currItem->indexOffset = offnum;
+	if (so->currTuples)
+	{
+		Size		itupsz = IndexTupleSize(itup);
+
+		currItem->tupleOffset = so->currPos.nextTupleOffset;
+		memcpy(so->currTuples + so->currPos.nextTupleOffset, itup, itupsz);
+		so->currPos.nextTupleOffset += MAXALIGN(itupsz);
+	}
+}
+
+/*
+ *	_bt_prefetch() -- Prefetch heap pages for the items after the current one
+ *
+ * If the caller set scan->xs_prefetch_pages, issue prefetch requests for the
+ * heap pages that the next few items of currPos point to, in the direction
+ * of the scan, so that the I/O for them can proceed while the caller is busy
+ * with the current tuple.  We look at most prefetchDistance items ahead.
+ * Like the bitmap heap scan, we start with a small distance and ramp it up
+ * as items are consumed, so that a scan that stops early because of a LIMIT
+ * doesn't read a lot of pages for nothing.  The distance is not reset on
+ * rescan: the inner side of a nestloop that keeps returning several rows
+ * per outer row deserves prefetching from the start of each rescan.
+ *
+ * Consecutive items often point to the same heap page, so we skip repeats
+ * of the page most recently prefetched and of the current item's page.
+ * Prefetching never crosses to the next index page; the items of that page
+ * are prefetched once it's been read.
+ */
+static void
+_bt_prefetch(IndexScanDesc scan, ScanDirection dir)
+{
+#ifdef USE_PREFETCH
+	BTScanOpaque so = (BTScanOpaque) scan->opaque;
+	int			target = scan->xs_prefetch_pages;
+	BTScanPosItem *item;
+	BlockNumber currBlock;
+	int			limit;
+
+	if (target <= 0 || scan->heapRelation == NULL)
+		return;
+
+	/* Increase the distance if it's not yet at the max */
+	if (so->prefetchDistance >= target)
+		 /* don't increase any further */ ;
+	else if (so->prefetchDistance >= target / 2)
+		so->prefetchDistance = target;
+	else if (so->prefetchDistance > 0)
+		so->prefetchDistance *= 2;
+	else
+		so->prefetchDistance++;
+
+	currBlock = ItemPointerGetBlockNumber(&scan->xs_ctup.t_self);
+
+	if (ScanDirectionIsForward(dir))
+	{
+		limit = Min(so->currPos.itemIndex + so->prefetchDistance,
+					so->currPos.lastItem);
+		/* after a change of direction or a restore, catch up */
+		if (so->prefetchItem < so->currPos.itemIndex)
+			so->prefetchItem = so->currPos.itemIndex;
+		while (so->prefetchItem < limit)
+		{
+			BlockNumber blkno;
+
+			so->prefetchItem++;
+			item = &so->currPos.items[so->prefetchItem];
+			blkno = ItemPointerGetBlockNumber(&item->heapTid);
+			if (blkno != so->prefetchBlock && blkno != currBlock)
+			{
+				PrefetchBuffer(scan->heapRelation, MAIN_FORKNUM, blkno);
+				so->prefetchBlock = blkno;
+			}
+		}
+	}
+	else
+	{
+		limit = Max(so->currPos.itemIndex - so->prefetchDistance,
+					so->currPos.firstItem);
+		if (so->prefetchItem > so->currPos.itemIndex)
+			so->prefetchItem = so->currPos.itemIndex;
+		while (so->prefetchItem > limit)
+		{
+			BlockNumber blkno;
+
+			so->prefetchItem--;
+			item = &so->currPos.items[so->prefetchItem];
+			blkno = ItemPointerGetBlockNumber(&item->heapTid);
+			if (blkno != so->prefetchBlock && blkno != currBlock)
+			{
+				PrefetchBuffer(scan->heapRelation, MAIN_FORKNUM, blkno);
+				so->prefetchBlock = blkno;
+			}
+		}
+	}
+#endif   /* USE_PREFETCH */
+}
+
 /*
  *	_bt_steppage() -- Step to next page containing valid data for scan
  *
@@ -1110,6 +1241,9 @@ _bt_steppage(IndexScanDesc scan, ScanDirection dir)
 		memcpy(&so->markPos, &so->currPos,
 			   offsetof(BTScanPosData, items[1]) +
 			   so->currPos.lastItem * sizeof(BTScanPosItem));
+		if (so->markTuples)
+			memcpy(so->markTuples, so->currTuples,
+				   so->currPos.nextTupleOffset);
 		so->markPos.itemIndex = so->markItemIndex;
 		so->markItemIndex = -1;
 	}
@@ -1420,6 +1554,7 @@ _bt_endpoint(IndexScanDesc scan, ScanDirection dir)
 	Page		page;
 	BTPageOpaque opaque;
 	OffsetNumber start;
+	BTScanPosItem *currItem;
 
 	/*
 	 * Scan down to the leftmost or rightmost leaf page.  This is a simplified
@@ -1492,7 +1627,13 @@ _bt_endpoint(IndexScanDesc scan, ScanDirection dir)
 	LockBuffer(so->currPos.buf, BUFFER_LOCK_UNLOCK);
 
 	/* OK, itemIndex says what to return */
-	scan->xs_ctup.t_self = so->currPos.items[so->currPos.itemIndex].heapTid;
+	currItem = &so->currPos.items[so->currPos.itemIndex];
+	scan->xs_ctup.t_self = currItem->heapTid;
+	if (scan->xs_want_itup)
+		scan->xs_itup = (IndexTuple) (so->currTuples + currItem->tupleOffset);
+
+	/* Start reading the heap pages of the next few items */
+	_bt_prefetch(scan, dir);
 
 	return true;
 }
@@ -164,6 +164,14 @@ _bt_spoolinit(Relation index, bool isunique, bool isdead)
 	btspool->sortstate = tuplesort_begin_index_btree(index, isunique,
 													 btKbytes, false);
 
+	/*
+	 * Let the main sort use parallel workers if it turns out to be a big
+	 * one.  This doesn't change what the sort returns to _bt_load.
+	 */
+	if (!isdead)
+		tuplesort_set_parallel(btspool->sortstate,
+							   max_parallel_maintenance_workers);
+
 	return btspool;
 }
 
@@ -816,8 +816,9 @@ _bt_mark_scankey_required(ScanKey skey)
 /*
  * Test whether an indextuple satisfies all the scankey conditions.
  *
- * If so, copy its TID into scan->xs_ctup.t_self, and return TRUE.
- * If not, return FALSE (xs_ctup is not changed).
+ * If so, copy its TID into scan->xs_ctup.t_self, and return a pointer to
+ * the tuple (which is only valid while the caller holds the page locked).
+ * If not, return NULL (xs_ctup is not changed).
  *
  * If the tuple fails to pass the qual, we also determine whether there's
  * any need to continue the scan beyond this tuple, and set *continuescan
@@ -830,7 +831,7 @@ _bt_mark_scankey_required(ScanKey skey)
  * dir: direction we are scanning in
  * continuescan: output parameter (will be set correctly in all cases)
  */
-bool
+IndexTuple
 _bt_checkkeys(IndexScanDesc scan,
 			  Page page, OffsetNumber offnum,
 			  ScanDirection dir, bool *continuescan)
@@ -860,18 +861,18 @@ _bt_checkkeys(IndexScanDesc scan,
 		if (ScanDirectionIsForward(dir))
 		{
 			if (offnum < PageGetMaxOffsetNumber(page))
-				return false;
+				return NULL;
 		}
 		else
 		{
 			BTPageOpaque opaque = (BTPageOpaque) PageGetSpecialPointer(page);
 
 			if (offnum > P_FIRSTDATAKEY(opaque))
-				return false;
+				return NULL;
 		}
 
 		/*
-		 * OK, we want to check the keys, but we'll return FALSE even if the
+		 * OK, we want to check the keys, but we'll return NULL even if the
 		 * tuple passes the key tests.
 		 */
 		tuple_valid = false;
@@ -896,7 +897,7 @@ _bt_checkkeys(IndexScanDesc scan,
 		{
 			if (_bt_check_rowcompare(key, tuple, tupdesc, dir, continuescan))
 				continue;
-			return false;
+			return NULL;
 		}
 
 		datum = index_getattr(tuple,
@@ -934,7 +935,7 @@ _bt_checkkeys(IndexScanDesc scan,
 			/*
 			 * In any case, this indextuple doesn't match the qual.
 			 */
-			return false;
+			return NULL;
 		}
 
 		if (isNull)
@@ -969,7 +970,7 @@ _bt_checkkeys(IndexScanDesc scan,
 			/*
 			 * In any case, this indextuple doesn't match the qual.
 			 */
-			return false;
+			return NULL;
 		}
 
 		test = FunctionCall2(&key->sk_func, datum, key->sk_argument);
@@ -996,15 +997,17 @@ _bt_checkkeys(IndexScanDesc scan,
 			/*
 			 * In any case, this indextuple doesn't match the qual.
 			 */
-			return false;
+			return NULL;
 		}
 	}
 
 	/* If we get here, the tuple passes all index quals. */
-	if (tuple_valid)
-		scan->xs_ctup.t_self = tuple->t_tid;
+	if (!tuple_valid)
+		return NULL;
+
+	scan->xs_ctup.t_self = tuple->t_tid;
 
-	return tuple_valid;
+	return tuple;
 }
 
 /*
@@ -48,6 +48,7 @@
 #include "storage/ipc.h"
 #include "storage/latch.h"
 #include "storage/pmsignal.h"
+#include "storage/proc.h"
 #include "storage/procarray.h"
 #include "storage/smgr.h"
 #include "storage/spin.h"
@@ -75,6 +76,8 @@ char	   *XLogArchiveCommand = NULL;
 bool		EnableHotStandby = false;
 bool		fullPageWrites = true;
 bool		log_checkpoints = false;
+int			CommitDelay = 0;	/* max group commit delay in microseconds */
+int			CommitSiblings = 5; /* group size needed to delay */
 int			sync_method = DEFAULT_SYNC_METHOD;
 int			wal_level = WAL_LEVEL_MINIMAL;
 
@@ -124,7 +127,7 @@ const struct config_enum_entry sync_method_options[] = {
 
 /*
  * Statistics for current checkpoint are collected in this global struct.
- * Because only the background writer or a stand-alone backend can perform
+ * Because only the checkpointer or a stand-alone backend can perform
  * checkpoints, this will be unused in normal backends.
  */
 CheckpointStatsData CheckpointStats;
@@ -267,11 +270,10 @@ static XLogRecPtr RedoStartLSN = {0, 0};
  * slightly different functions.
  *
  * We do a lot of pushups to minimize the amount of access to lockable
- * shared memory values.  There are actually three shared-memory copies of
+ * shared memory values.  There are actually two shared-memory copies of
  * LogwrtResult, plus one unshared copy in each backend.  Here's how it works:
  *		XLogCtl->LogwrtResult is protected by info_lck
  *		XLogCtl->Write.LogwrtResult is protected by WALWriteLock
- *		XLogCtl->Insert.LogwrtResult is protected by WALInsertLock
  * One must hold the associated lock to read or write any of these, but
  * of course no lock is needed to read/write the unshared LogwrtResult.
  *
@@ -281,10 +283,6 @@ static XLogRecPtr RedoStartLSN = {0, 0};
  * is that it can be examined/modified by code that already holds WALWriteLock
  * without needing to grab info_lck as well.
  *
- * XLogCtl->Insert.LogwrtResult may lag behind the reality of the other two,
- * but is updated when convenient.	Again, it exists for the convenience of
- * code that is already holding WALInsertLock but not the other locks.
- *
  * The unshared LogwrtResult may lag behind any or all of these, and again
  * is updated when convenient.
  *
@@ -299,7 +297,10 @@ static XLogRecPtr RedoStartLSN = {0, 0};
  * so it's a plain spinlock.  The other locks are held longer (potentially
  * over I/O operations), so we use LWLocks for them.  These locks are:
  *
- * WALInsertLock: must be held to insert a record into the WAL buffers.
+ * WALBufMappingLock: must be held to replace a page in the WAL buffer cache.
+ * It is only held while initializing and changing the mapping.  If the
+ * contents of the buffer being replaced haven't been written yet, the mapping
+ * lock is released while the write is done, and reacquired afterwards.
  *
  * WALWriteLock: must be held to write WAL buffers to disk (XLogWrite or
  * XLogFlush).
@@ -309,7 +310,7 @@ static XLogRecPtr RedoStartLSN = {0, 0};
  *
  * CheckpointLock: must be held to do a checkpoint or restartpoint (ensures
  * only one checkpointer at a time; currently, with all checkpoints done by
- * the bgwriter, this is just pro forma).
+ * the checkpointer, this is just pro forma).
  *
  *----------
  */
@@ -326,18 +327,108 @@ typedef struct XLogwrtResult
 	XLogRecPtr	Flush;			/* last byte + 1 flushed */
 } XLogwrtResult;
 
+/*----------
+ * Inserting a record into the WAL buffers is done in three steps:
+ *
+ * 1. Reserve the right amount of space from the WAL.  The current head of
+ *	  reserved space is kept in Insert->CurrPos, and is protected by
+ *	  insertpos_lck.
+ *
+ * 2. Copy the record to the reserved WAL space.  This involves finding the
+ *	  correct WAL buffer containing the reserved space, and copying the
+ *	  record in place.  This can be done concurrently in multiple processes.
+ *
+ * 3. Once the record is copied, release the insertion slot held while
+ *	  copying.
+ *
+ * To keep track of which insertions are still in-progress, each concurrent
+ * inserter holds a WAL insertion slot.  There is a small fixed number of
+ * slots, NUM_XLOGINSERT_SLOTS; a backend acquires one of them before
+ * reserving space, and releases it once the record has been copied.  Each
+ * slot advertises the position up to which its holder has finished copying,
+ * xlogInsertingAt.  That is normally left invalid, meaning "don't know",
+ * which makes anyone interested in the progress of insertions wait for the
+ * slot to be released.  But an inserter that has to wait for a WAL buffer
+ * page to become available first advertises the position it has reached, so
+ * that it doesn't end up waiting for the very backends that are waiting for
+ * it.  Before a WAL page can be written out, WaitXLogInsertionsToFinish
+ * waits for all insertions into it to finish, by looking at the slots.
+ *
+ * Holding one slot also gives the right to read RedoRecPtr and
+ * forcePageWrites; changing those requires holding all the slots.  A
+ * checkpointer, or a backend doing an xlog switch, therefore acquires all of
+ * them, which also stops any other backend from inserting meanwhile.
+ *
+ * Deadlock analysis
+ * -----------------
+ *
+ * Waiting for insertions to finish while holding WALWriteLock or
+ * WALBufMappingLock could deadlock, because an inserter may need either of
+ * those locks to get a WAL page to copy its record into.  So the waiting is
+ * always done before acquiring them.  An inserter never waits for an
+ * insertion slot while it holds one, except when acquiring all of them,
+ * which is done in order.
+ *----------
+ */
+
+/*
+ * Number of WAL insertion slots.  More slots allow more inserters to copy
+ * their records in parallel, but make WaitXLogInsertionsToFinish, and the
+ * operations that need all the slots, more expensive.
+ */
+#define NUM_XLOGINSERT_SLOTS	8
+
+typedef struct
+{
+	slock_t		mutex;			/* protects the below fields */
+	bool		held;			/* is somebody holding the slot? */
+	XLogRecPtr	xlogInsertingAt;	/* insert has completed up to this point */
+	PGPROC	   *head;			/* head of list of waiting PGPROCs */
+	PGPROC	   *tail;			/* tail of list of waiting PGPROCs */
+	/* tail is undefined when head is NULL */
+} XLogInsertSlot;
+
+/*
+ * All the slots are allocated as an array in shared memory.  We pad them to
+ * a cache line each, so that backends working on different slots don't
+ * fight over the same cache line.
+ */
+#define XLOG_INSERT_SLOT_PADDED_SIZE	64
+
+typedef union XLogInsertSlotPadded
+{
+	XLogInsertSlot slot;
+	char		pad[XLOG_INSERT_SLOT_PADDED_SIZE];
+} XLogInsertSlotPadded;
+
 /*
  * Shared state data for XLogInsert.
  */
 typedef struct XLogCtlInsert
 {
-	XLogwrtResult LogwrtResult; /* a recent value of LogwrtResult */
-	XLogRecPtr	PrevRecord;		/* start of previously-inserted record */
-	int			curridx;		/* current block index in cache */
-	XLogPageHeader currpage;	/* points to header of block in cache */
-	char	   *currpos;		/* current insertion point in cache */
+	slock_t		insertpos_lck;	/* protects CurrPos and PrevRecord */
+
+	/*
+	 * CurrPos is the end of reserved WAL.  The next record will be inserted
+	 * at that position, or on the next page if its header won't fit on this
+	 * one.  PrevRecord is the start position of the previously inserted (or
+	 * rather, reserved) record - it is copied to the prev-link of the next
+	 * record.  These are stored as XLogRecPtrs, in the same format that the
+	 * WAL itself uses.
+	 */
+	XLogRecPtr	CurrPos;
+	XLogRecPtr	PrevRecord;
+
+	/*
+	 * Reading these fields requires holding one insertion slot; changing
+	 * them requires holding all of them.  RedoRecPtr is also protected by
+	 * info_lck, so that it can be read without a slot.
+	 */
 	XLogRecPtr	RedoRecPtr;		/* current redo point for insertions */
 	bool		forcePageWrites;	/* forcing full-page writes for PITR? */
+
+	/* insertion slots, see above for details */
+	XLogInsertSlotPadded *insertSlots;
 } XLogCtlInsert;
 
 /*
@@ -346,7 +437,6 @@ typedef struct XLogCtlInsert
 typedef struct XLogCtlWrite
 {
 	XLogwrtResult LogwrtResult; /* current value of LogwrtResult */
-	int			curridx;		/* cache index of next block to write */
 	pg_time_t	lastSegSwitchTime;		/* time of last xlog segment switch */
 } XLogCtlWrite;
 
@@ -355,7 +445,7 @@ typedef struct XLogCtlWrite
  */
 typedef struct XLogCtlData
 {
-	/* Protected by WALInsertLock: */
+	/* Protected by insertpos_lck and the insertion slots: */
 	XLogCtlInsert Insert;
 
 	/* Protected by info_lck: */
@@ -370,10 +460,37 @@ typedef struct XLogCtlData
 	/* Protected by WALWriteLock: */
 	XLogCtlWrite Write;
 
+	/*
+	 * Group flush queue, protected by flushqueue_lck.  A backend that needs
+	 * WAL flushed while another backend is acting as flush leader adds
+	 * itself to the queue and sleeps until the leader has flushed for it.
+	 * See XLogFlush.
+	 */
+	slock_t		flushqueue_lck;
+	bool		flushLeaderActive;	/* is some backend the flush leader? */
+	PGPROC	   *flushQueueHead;		/* backends waiting for the leader */
+	PGPROC	   *flushQueueTail;
+	int			flushQueueLen;
+	PGPROC	   *flushDelayProc;		/* leader, while delaying for followers */
+	int			flushGroupTarget;	/* ... and queue length to wake it at */
+	int			avgFlushGroupSize;	/* moving average, x FLUSH_GROUP_SCALE */
+
+	/*
+	 * Latest initialized page in the cache (last byte position + 1).
+	 *
+	 * To change the identity of a buffer (and InitializedUpTo), you need to
+	 * hold WALBufMappingLock.  To change the identity of a buffer that's
+	 * still dirty, the old page needs to be written out first, and for that
+	 * you need WALWriteLock, and you need to ensure that there are no
+	 * in-progress insertions to the page by calling
+	 * WaitXLogInsertionsToFinish().
+	 */
+	XLogRecPtr	InitializedUpTo;
+
 	/*
 	 * These values do not change after startup, although the pointed-to pages
-	 * and xlblocks values certainly do.  Permission to read/write the pages
-	 * and xlblocks values depends on WALInsertLock and WALWriteLock.
+	 * and xlblocks values certainly do.  xlblock values are protected by
+	 * WALBufMappingLock.
 	 */
 	char	   *pages;			/* buffers for unwritten XLOG pages */
 	XLogRecPtr *xlblocks;		/* 1st byte ptr-s + XLOG_BLCKSZ */
@@ -383,7 +500,7 @@ typedef struct XLogCtlData
 
 	/*
 	 * archiveCleanupCommand is read from recovery.conf but needs to be in
-	 * shared memory so that the bgwriter process can access it.
+	 * shared memory so that the checkpointer process can access it.
 	 */
 	char		archiveCleanupCommand[MAXPGPATH];
 
@@ -402,7 +519,7 @@ typedef struct XLogCtlData
 
 	/*
 	 * During recovery, we keep a copy of the latest checkpoint record here.
-	 * Used by the background writer when it wants to create a restartpoint.
+	 * Used by the checkpointer when it wants to create a restartpoint.
 	 *
 	 * Protected by info_lck.
 	 */
@@ -421,41 +538,55 @@ typedef struct XLogCtlData
 
 static XLogCtlData *XLogCtl = NULL;
 
+/*
+ * Scale factor for avgFlushGroupSize, so that we can keep a moving average
+ * of small integers in an int without losing too much precision.
+ */
+#define FLUSH_GROUP_SCALE	16
+
 /*
  * We maintain an image of pg_control in shared memory.
  */
 static ControlFileData *ControlFile = NULL;
 
 /*
- * Macros for managing XLogInsert state.  In most cases, the calling routine
- * has local copies of XLogCtl->Insert and/or XLogCtl->Insert->curridx,
- * so these are passed as parameters instead of being fetched via XLogCtl.
+ * Macros for locating WAL buffer pages.  Each page of WAL has a fixed home
+ * in the buffer cache: its page number (counting from the very beginning of
+ * WAL) modulo the number of buffers.  Note that an end-of-page pointer maps
+ * to the page that follows it.
  */
+#define XLogRecPtrToPageNo(recptr) \
+	((uint64) (recptr).xlogid * (XLogFileSize / XLOG_BLCKSZ) + \
+	 (recptr).xrecoff / XLOG_BLCKSZ)
 
-/* Free space remaining in the current xlog page buffer */
-#define INSERT_FREESPACE(Insert)  \
-	(XLOG_BLCKSZ - ((Insert)->currpos - (char *) (Insert)->currpage))
-
-/* Construct XLogRecPtr value for current insertion point */
-#define INSERT_RECPTR(recptr,Insert,curridx)  \
-	( \
-	  (recptr).xlogid = XLogCtl->xlblocks[curridx].xlogid, \
-	  (recptr).xrecoff = \
-		XLogCtl->xlblocks[curridx].xrecoff - INSERT_FREESPACE(Insert) \
-	)
-
-#define PrevBufIdx(idx)		\
-		(((idx) == 0) ? XLogCtl->XLogCacheBlck : ((idx) - 1))
+#define XLogRecPtrToBufIdx(recptr) \
+	((int) (XLogRecPtrToPageNo(recptr) % (XLogCtl->XLogCacheBlck + 1)))
 
 #define NextBufIdx(idx)		\
 		(((idx) == XLogCtl->XLogCacheBlck) ? 0 : ((idx) + 1))
 
+/* Size of the page header of the page beginning at recptr */
+#define XLogPageHeaderSizeAt(recptr) \
+	(((recptr).xrecoff % XLogSegSize == 0) ? \
+	 SizeOfXLogLongPHD : SizeOfXLogShortPHD)
+
 /*
  * Private, possibly out-of-date copy of shared LogwrtResult.
  * See discussion above.
  */
 static XLogwrtResult LogwrtResult = {{0, 0}, {0, 0}};
 
+static const XLogRecPtr InvalidXLogRecPtr = {0, 0};
+
+/*
+ * The WAL insertion slot we hold while inserting a record (the last one, if
+ * we're holding all of them), and the slot to try first for our next
+ * insertion.  See WALInsertSlotAcquire.
+ */
+static int	MyInsertSlotNo = -1;
+static int	insertSlotToTry = -1;
+static bool holdingAllSlots = false;
+
 /*
  * Codes indicating where we got a WAL file from during recovery, or where
  * to attempt to get one.  These are chosen so that they can be OR'd together
@@ -525,8 +656,8 @@ static bool reachedMinRecoveryPoint = false;
 
 static bool InRedo = false;
 
-/* Have we launched bgwriter during recovery? */
-static bool bgwriterLaunched = false;
+/* Have we launched checkpointer during recovery? */
+static bool checkpointerLaunched = false;
 
 /*
  * Information logged when we detect a change in one of the parameters
@@ -571,9 +702,9 @@ static void CheckPointGuts(XLogRecPtr checkPointRedo, int flags);
 
 static bool XLogCheckBuffer(XLogRecData *rdata, bool doPageWrites,
 				XLogRecPtr *lsn, BkpBlock *bkpb);
-static bool AdvanceXLInsertBuffer(bool new_segment);
+static void AdvanceXLInsertBuffer(XLogRecPtr upto, bool opportunistic);
 static bool XLogCheckpointNeeded(uint32 logid, uint32 logseg);
-static void XLogWrite(XLogwrtRqst WriteRqst, bool flexible, bool xlog_switch);
+static void XLogWrite(XLogwrtRqst WriteRqst, bool flexible);
 static bool InstallXLogFileSegment(uint32 *log, uint32 *seg, char *tmppath,
 					   bool find_free, int *max_advance,
 					   bool use_lock);
@@ -618,6 +749,28 @@ static bool read_backup_label(XLogRecPtr *checkPointLoc);
 static void rm_redo_error_callback(void *arg);
 static int	get_sync_bit(int method);
 
+static XLogRecPtr XLogNextPageStart(XLogRecPtr ptr);
+static XLogRecPtr XLogRecordStartPos(XLogRecPtr ptr);
+static XLogRecPtr XLogInsertPosAdvance(XLogRecPtr ptr, uint32 len);
+static void ReserveXLogInsertLocation(uint32 size, XLogRecPtr *StartPos,
+						  XLogRecPtr *EndPos, XLogRecPtr *PrevPtr);
+static bool ReserveXLogSwitch(XLogRecPtr *StartPos, XLogRecPtr *EndPos,
+				  XLogRecPtr *PrevPtr);
+static void CopyXLogRecordToWAL(uint32 write_len, bool isLogSwitch,
+					XLogRecData *rdata,
+					XLogRecPtr StartPos, XLogRecPtr EndPos);
+static char *GetXLogBuffer(XLogRecPtr ptr);
+static XLogRecPtr WaitXLogInsertionsToFinish(XLogRecPtr upto);
+static bool XLogFlushJoinGroup(XLogRecPtr rqst);
+static void XLogFlushAsLeader(XLogRecPtr rqst);
+static void XLogFlushDelay(int target);
+static void WALInsertSlotAcquire(bool exclusive);
+static bool WALInsertSlotAcquireOne(int slotno);
+static void WALInsertSlotRelease(void);
+static void WALInsertSlotReleaseOne(int slotno);
+static void WALInsertSlotUpdateInsertingAt(int slotno, XLogRecPtr insertingAt);
+static XLogRecPtr WaitOnSlot(volatile XLogInsertSlot *slot, XLogRecPtr waitptr);
+
 
 /*
  * Insert an XLOG record having the specified RMID and info bytes,
@@ -639,11 +792,9 @@ XLogInsert(RmgrId rmid, uint8 info, XLogRecData *rdata)
 {
 	XLogCtlInsert *Insert = &XLogCtl->Insert;
 	XLogRecord *record;
-	XLogContRecord *contrecord;
-	XLogRecPtr	RecPtr;
-	XLogRecPtr	WriteRqst;
-	uint32		freespace;
-	int			curridx;
+	XLogRecPtr	StartPos;
+	XLogRecPtr	EndPos;
+	XLogRecPtr	PrevPtr;
 	XLogRecData *rdt;
 	Buffer		dtbuf[XLR_MAX_BKP_BLOCKS];
 	bool		dtbuf_bkp[XLR_MAX_BKP_BLOCKS];
@@ -656,7 +807,7 @@ XLogInsert(RmgrId rmid, uint8 info, XLogRecData *rdata)
 	uint32		len,
 				write_len;
 	unsigned	i;
-	bool		updrqst;
+	bool		inserted;
 	bool		doPageWrites;
 	bool		isLogSwitch = (rmid == RM_XLOG_ID && info == XLOG_SWITCH);
 
@@ -676,9 +827,9 @@ XLogInsert(RmgrId rmid, uint8 info, XLogRecData *rdata)
 	 */
 	if (IsBootstrapProcessingMode() && rmid != RM_XLOG_ID)
 	{
-		RecPtr.xlogid = 0;
-		RecPtr.xrecoff = SizeOfXLogLongPHD;		/* start of 1st chkpt record */
-		return RecPtr;
+		EndPos.xlogid = 0;
+		EndPos.xrecoff = SizeOfXLogLongPHD;		/* start of 1st chkpt record */
+		return EndPos;
 	}
 
 	/*
@@ -690,9 +841,9 @@ XLogInsert(RmgrId rmid, uint8 info, XLogRecData *rdata)
 	 * header".
 	 *
 	 * We may have to loop back to here if a race condition is detected below.
-	 * We could prevent the race by doing all this work while holding the
-	 * insert lock, but it seems better to avoid doing CRC calculations while
-	 * holding the lock.  This means we have to be careful about modifying the
+	 * We could prevent the race by doing all this work while holding an
+	 * insertion slot, but it seems better to avoid doing CRC calculations
+	 * while holding it.  This means we have to be careful about modifying the
 	 * rdata chain until we know we aren't going to loop back again.  The only
 	 * change we allow ourselves to make earlier is to set rdt->data = NULL in
 	 * chain items we have decided we will have to back up the whole buffer
@@ -710,8 +861,8 @@ begin:;
 	/*
 	 * Decide if we need to do full-page writes in this XLOG record: true if
 	 * full_page_writes is on or we have a PITR request for it.  Since we
-	 * don't yet have the insert lock, forcePageWrites could change under us,
-	 * but we'll recheck it once we have the lock.
+	 * don't yet have an insertion slot, forcePageWrites could change under
+	 * us, but we'll recheck it once we have one.
 	 */
 	doPageWrites = fullPageWrites || Insert->forcePageWrites;
 
@@ -815,8 +966,12 @@ begin:;
 
 	START_CRIT_SECTION();
 
-	/* Now wait to get insert lock */
-	LWLockAcquire(WALInsertLock, LW_EXCLUSIVE);
+	/*
+	 * Now wait to get an insertion slot.  An xlog switch needs all of them,
+	 * so that nobody else can insert into the part of the segment that the
+	 * switch skips.
+	 */
+	WALInsertSlotAcquire(isLogSwitch);
 
 	/*
 	 * Check to see if my RedoRecPtr is out of date.  If so, may have to go
@@ -845,7 +1000,7 @@ begin:;
 					 * Oops, this buffer now needs to be backed up, but we
 					 * didn't think so above.  Start over.
 					 */
-					LWLockRelease(WALInsertLock);
+					WALInsertSlotRelease();
 					END_CRIT_SECTION();
 					goto begin;
 				}
@@ -862,7 +1017,7 @@ begin:;
 	if (Insert->forcePageWrites && !doPageWrites)
 	{
 		/* Oops, must redo it with full-page data */
-		LWLockRelease(WALInsertLock);
+		WALInsertSlotRelease();
 		END_CRIT_SECTION();
 		goto begin;
 	}
@@ -939,261 +1094,830 @@ begin:;
 		info |= XLR_BKP_REMOVABLE;
 
 	/*
-	 * If there isn't enough space on the current XLOG page for a record
-	 * header, advance to the next page (leaving the unused space as zeroes).
+	 * Reserve space for the record in the WAL.  This is the only part of the
+	 * insertion that is serialized across backends.  An xlog switch also
+	 * reserves the rest of the current segment; if we are exactly at the
+	 * start of a segment already, it need not be inserted at all (and we'd
+	 * like consecutive switch requests to be no-ops), in which case EndPos
+	 * is set to the end of the prior segment.
+	 */
+	if (isLogSwitch)
+		inserted = ReserveXLogSwitch(&StartPos, &EndPos, &PrevPtr);
+	else
+	{
+		ReserveXLogInsertLocation(SizeOfXLogRecord + write_len,
+								  &StartPos, &EndPos, &PrevPtr);
+		inserted = true;
+	}
+
+	if (inserted)
+	{
+		/*
+		 * Fill in the record header directly in the WAL buffer.  It always
+		 * fits on the page it begins on.  Now that we know the prev-link, we
+		 * can finish computing the record's CRC.
+		 */
+		record = (XLogRecord *) GetXLogBuffer(StartPos);
+		record->xl_prev = PrevPtr;
+		record->xl_xid = GetCurrentTransactionIdIfAny();
+		record->xl_tot_len = SizeOfXLogRecord + write_len;
+		record->xl_len = len;	/* doesn't include backup blocks */
+		record->xl_info = info;
+		record->xl_rmid = rmid;
+
+		COMP_CRC32(rdata_crc, (char *) record + sizeof(pg_crc32),
+				   SizeOfXLogRecord - sizeof(pg_crc32));
+		FIN_CRC32(rdata_crc);
+		record->xl_crc = rdata_crc;
+
+#ifdef WAL_DEBUG
+		if (XLOG_DEBUG)
+		{
+			StringInfoData buf;
+
+			initStringInfo(&buf);
+			appendStringInfo(&buf, "INSERT @ %X/%X: ",
+							 StartPos.xlogid, StartPos.xrecoff);
+			xlog_outrec(&buf, record);
+			if (rdata->data != NULL)
+			{
+				appendStringInfo(&buf, " - ");
+				RmgrTable[record->xl_rmid].rm_desc(&buf, record->xl_info, rdata->data);
+			}
+			elog(LOG, "%s", buf.data);
+			pfree(buf.data);
+		}
+#endif
+
+		/* Append the data, including backup blocks if any */
+		CopyXLogRecordToWAL(write_len, isLogSwitch, rdata, StartPos, EndPos);
+	}
+
+	/*
+	 * Done!  Let others know that we're finished.
+	 */
+	WALInsertSlotRelease();
+
+	/*
+	 * Need to update shared LogwrtRqst if some block was filled up, so that
+	 * the walwriter knows to write it out.
+	 */
+	if (inserted &&
+		XLogRecPtrToPageNo(StartPos) != XLogRecPtrToPageNo(EndPos))
+	{
+		/* use volatile pointer to prevent code rearrangement */
+		volatile XLogCtlData *xlogctl = XLogCtl;
+
+		SpinLockAcquire(&xlogctl->info_lck);
+		/* advance global request to include new block(s) */
+		if (XLByteLT(xlogctl->LogwrtRqst.Write, EndPos))
+			xlogctl->LogwrtRqst.Write = EndPos;
+		/* update local result copy while I have the chance */
+		LogwrtResult = xlogctl->LogwrtResult;
+		SpinLockRelease(&xlogctl->info_lck);
+	}
+
+	/*
+	 * If the record is an XLOG_SWITCH, we must now write and flush all the
+	 * existing data, including the zeroed space that fills up the rest of
+	 * the segment.  XLogWrite will perform the end-of-segment actions (eg,
+	 * notifying archiver) when it writes out the last page.
 	 */
-	updrqst = false;
-	freespace = INSERT_FREESPACE(Insert);
-	if (freespace < SizeOfXLogRecord)
+	if (isLogSwitch)
+	{
+		TRACE_POSTGRESQL_XLOG_SWITCH();
+		XLogFlush(EndPos);
+
+		/*
+		 * Even though we reserved the rest of the segment for us, which is
+		 * reflected in EndPos, we return a pointer to just the end of the
+		 * xlog-switch record.
+		 */
+		if (inserted)
+			EndPos = XLogInsertPosAdvance(StartPos, SizeOfXLogRecord);
+	}
+
+	if (inserted)
 	{
-		updrqst = AdvanceXLInsertBuffer(false);
-		freespace = INSERT_FREESPACE(Insert);
+		ProcLastRecPtr = StartPos;
+		XactLastRecEnd = EndPos;
 	}
 
-	/* Compute record's XLOG location */
-	curridx = Insert->curridx;
-	INSERT_RECPTR(RecPtr, Insert, curridx);
+	END_CRIT_SECTION();
 
 	/*
-	 * If the record is an XLOG_SWITCH, and we are exactly at the start of a
-	 * segment, we need not insert it (and don't want to because we'd like
-	 * consecutive switch requests to be no-ops).  Instead, make sure
-	 * everything is written and flushed through the end of the prior segment,
-	 * and return the prior segment's end address.
+	 * The recptr I return is the beginning of the *next* record. This will be
+	 * stored as LSN for changed data pages...
 	 */
-	if (isLogSwitch &&
-		(RecPtr.xrecoff % XLogSegSize) == SizeOfXLogLongPHD)
+	return EndPos;
+}
+
+/*
+ * Return the beginning of the WAL page that follows the given position,
+ * or the position itself if it is at a page boundary already.  End-of-page
+ * pointers at the end of a logical log file are normally represented as
+ * {xlogid, XLogFileSize}; the page that follows begins in the next logid.
+ */
+static XLogRecPtr
+XLogNextPageStart(XLogRecPtr ptr)
+{
+	if (ptr.xrecoff % XLOG_BLCKSZ != 0)
+		ptr.xrecoff += XLOG_BLCKSZ - ptr.xrecoff % XLOG_BLCKSZ;
+	if (ptr.xrecoff >= XLogFileSize)
+	{
+		/* crossing a logid boundary */
+		ptr.xlogid += 1;
+		ptr.xrecoff = 0;
+	}
+	return ptr;
+}
+
+/*
+ * Given the current insert position, return where the next record will
+ * actually begin.  A record header is never split across pages, so if
+ * there isn't enough space left on the current page for one, the record
+ * goes to the next page, just after its page header (leaving the unused
+ * space as zeroes).
+ */
+static XLogRecPtr
+XLogRecordStartPos(XLogRecPtr ptr)
+{
+	uint32		offset = ptr.xrecoff % XLOG_BLCKSZ;
+
+	if (offset == 0 || XLOG_BLCKSZ - offset < SizeOfXLogRecord)
+	{
+		ptr = XLogNextPageStart(ptr);
+		ptr.xrecoff += XLogPageHeaderSizeAt(ptr);
+	}
+	return ptr;
+}
+
+/*
+ * Return the end+1 of a record of len bytes (including the header) that
+ * begins at ptr, aligned to the start of the next record.  Every page the
+ * record continues on begins with a page header and a continuation record
+ * header, which are included in the result.
+ */
+static XLogRecPtr
+XLogInsertPosAdvance(XLogRecPtr ptr, uint32 len)
+{
+	uint32		freespace = XLOG_BLCKSZ - ptr.xrecoff % XLOG_BLCKSZ;
+
+	while (len > freespace)
+	{
+		len -= freespace;
+		ptr.xrecoff += freespace;
+		ptr = XLogNextPageStart(ptr);
+		ptr.xrecoff += XLogPageHeaderSizeAt(ptr) + SizeOfXLogContRecord;
+		freespace = XLOG_BLCKSZ - ptr.xrecoff % XLOG_BLCKSZ;
+	}
+	ptr.xrecoff += len;
+
+	/* Ensure next record will be properly aligned */
+	ptr.xrecoff = MAXALIGN(ptr.xrecoff);
+
+	return ptr;
+}
+
+/*
+ * Reserve the right amount of space for a record of given size from the WAL.
+ * *StartPos is set to the beginning of the reserved section, *EndPos to
+ * its end+1, and *PrevPtr to the beginning of the previous record, to set
+ * to the prev-link of the record header.
+ *
+ * This is the performance critical part of XLogInsert that must be
+ * serialized across backends.  The rest can happen mostly in parallel.
+ * The arithmetic below loops once per page boundary the record crosses,
+ * which is only a few times even for a record carrying full-page images.
+ *
+ * The caller must hold an insertion slot.
+ */
+static void
+ReserveXLogInsertLocation(uint32 size, XLogRecPtr *StartPos,
+						  XLogRecPtr *EndPos, XLogRecPtr *PrevPtr)
+{
+	/* use volatile pointer to prevent code rearrangement */
+	volatile XLogCtlInsert *Insert = &XLogCtl->Insert;
+	XLogRecPtr	startptr;
+	XLogRecPtr	endptr;
+	XLogRecPtr	prevptr;
+
+	SpinLockAcquire(&Insert->insertpos_lck);
+
+	startptr = XLogRecordStartPos(Insert->CurrPos);
+	endptr = XLogInsertPosAdvance(startptr, size);
+	prevptr = Insert->PrevRecord;
+
+	Insert->CurrPos = endptr;
+	Insert->PrevRecord = startptr;
+
+	SpinLockRelease(&Insert->insertpos_lck);
+
+	*StartPos = startptr;
+	*EndPos = endptr;
+	*PrevPtr = prevptr;
+}
+
+/*
+ * Like ReserveXLogInsertLocation, but for an xlog-switch record.
+ *
+ * An xlog-switch record consumes all the remaining space on the WAL segment.
+ * We need to reserve that space, too.  If we are exactly at the beginning
+ * of a segment already, no record is needed; we return FALSE and set
+ * *StartPos and *EndPos to the end of the previous segment.
+ *
+ * The caller must hold all the insertion slots, so nobody else can be
+ * reserving space meanwhile.
+ */
+static bool
+ReserveXLogSwitch(XLogRecPtr *StartPos, XLogRecPtr *EndPos,
+				  XLogRecPtr *PrevPtr)
+{
+	/* use volatile pointer to prevent code rearrangement */
+	volatile XLogCtlInsert *Insert = &XLogCtl->Insert;
+	XLogRecPtr	startptr;
+	XLogRecPtr	endptr;
+
+	SpinLockAcquire(&Insert->insertpos_lck);
+
+	startptr = XLogRecordStartPos(Insert->CurrPos);
+	if (startptr.xrecoff % XLogSegSize == SizeOfXLogLongPHD)
 	{
-		/* We can release insert lock immediately */
-		LWLockRelease(WALInsertLock);
+		SpinLockRelease(&Insert->insertpos_lck);
 
-		RecPtr.xrecoff -= SizeOfXLogLongPHD;
-		if (RecPtr.xrecoff == 0)
+		endptr = startptr;
+		endptr.xrecoff -= SizeOfXLogLongPHD;
+		if (endptr.xrecoff == 0)
 		{
 			/* crossing a logid boundary */
-			RecPtr.xlogid -= 1;
-			RecPtr.xrecoff = XLogFileSize;
+			endptr.xlogid -= 1;
+			endptr.xrecoff = XLogFileSize;
 		}
+		*StartPos = *EndPos = endptr;
+		return false;
+	}
 
-		LWLockAcquire(WALWriteLock, LW_EXCLUSIVE);
-		LogwrtResult = XLogCtl->Write.LogwrtResult;
-		if (!XLByteLE(RecPtr, LogwrtResult.Flush))
-		{
-			XLogwrtRqst FlushRqst;
+	endptr = XLogInsertPosAdvance(startptr, SizeOfXLogRecord);
+	if (endptr.xrecoff % XLogSegSize != 0)
+		endptr.xrecoff += XLogSegSize - endptr.xrecoff % XLogSegSize;
 
-			FlushRqst.Write = RecPtr;
-			FlushRqst.Flush = RecPtr;
-			XLogWrite(FlushRqst, false, false);
-		}
-		LWLockRelease(WALWriteLock);
+	*PrevPtr = Insert->PrevRecord;
+	Insert->CurrPos = endptr;
+	Insert->PrevRecord = startptr;
 
-		END_CRIT_SECTION();
+	SpinLockRelease(&Insert->insertpos_lck);
 
-		return RecPtr;
-	}
+	*StartPos = startptr;
+	*EndPos = endptr;
+	return true;
+}
 
-	/* Insert record header */
+/*
+ * Subroutine of XLogInsert.  Copies the data of a WAL record, whose header
+ * has already been filled in at StartPos, to the WAL buffers.  If the record
+ * crosses page boundaries, continuation record headers are written as
+ * needed.
+ */
+static void
+CopyXLogRecordToWAL(uint32 write_len, bool isLogSwitch, XLogRecData *rdata,
+					XLogRecPtr StartPos, XLogRecPtr EndPos)
+{
+	char	   *currpos;
+	uint32		freespace;
+	XLogRecPtr	CurrPos;
+	XLogPageHeader pagehdr;
 
-	record = (XLogRecord *) Insert->currpos;
-	record->xl_prev = Insert->PrevRecord;
-	record->xl_xid = GetCurrentTransactionIdIfAny();
-	record->xl_tot_len = SizeOfXLogRecord + write_len;
-	record->xl_len = len;		/* doesn't include backup blocks */
-	record->xl_info = info;
-	record->xl_rmid = rmid;
+	/* The record header always fits on the first page */
+	CurrPos = StartPos;
+	currpos = GetXLogBuffer(CurrPos);
+	freespace = XLOG_BLCKSZ - CurrPos.xrecoff % XLOG_BLCKSZ;
+	Assert(freespace >= SizeOfXLogRecord);
 
-	/* Now we can finish computing the record's CRC */
-	COMP_CRC32(rdata_crc, (char *) record + sizeof(pg_crc32),
-			   SizeOfXLogRecord - sizeof(pg_crc32));
-	FIN_CRC32(rdata_crc);
-	record->xl_crc = rdata_crc;
+	CurrPos.xrecoff += SizeOfXLogRecord;
+	currpos += SizeOfXLogRecord;
+	freespace -= SizeOfXLogRecord;
 
-#ifdef WAL_DEBUG
-	if (XLOG_DEBUG)
+	for (; rdata != NULL; rdata = rdata->next)
 	{
-		StringInfoData buf;
+		char	   *rdata_data = rdata->data;
+		uint32		rdata_len = rdata->len;
+
+		/* skip the data of buffers that are backed up in full */
+		if (rdata_data == NULL)
+			continue;
 
-		initStringInfo(&buf);
-		appendStringInfo(&buf, "INSERT @ %X/%X: ",
-						 RecPtr.xlogid, RecPtr.xrecoff);
-		xlog_outrec(&buf, record);
-		if (rdata->data != NULL)
+		while (rdata_len > freespace)
 		{
-			appendStringInfo(&buf, " - ");
-			RmgrTable[record->xl_rmid].rm_desc(&buf, record->xl_info, rdata->data);
+			/*
+			 * Write what fits on this page, and continue on the next page.
+			 */
+			memcpy(currpos, rdata_data, freespace);
+			rdata_data += freespace;
+			rdata_len -= freespace;
+			write_len -= freespace;
+			CurrPos.xrecoff += freespace;
+
+			/*
+			 * Get pointer to beginning of next page, and set the
+			 * XLP_FIRST_IS_CONTRECORD flag in the page header.  Then insert
+			 * the cont-record header.
+			 */
+			CurrPos = XLogNextPageStart(CurrPos);
+			pagehdr = (XLogPageHeader) GetXLogBuffer(CurrPos);
+			pagehdr->xlp_info |= XLP_FIRST_IS_CONTRECORD;
+			CurrPos.xrecoff += XLogPageHeaderSize(pagehdr);
+			currpos = (char *) pagehdr + XLogPageHeaderSize(pagehdr);
+
+			((XLogContRecord *) currpos)->xl_rem_len = write_len;
+			CurrPos.xrecoff += SizeOfXLogContRecord;
+			currpos += SizeOfXLogContRecord;
+
+			freespace = XLOG_BLCKSZ - CurrPos.xrecoff % XLOG_BLCKSZ;
 		}
-		elog(LOG, "%s", buf.data);
-		pfree(buf.data);
+
+		memcpy(currpos, rdata_data, rdata_len);
+		currpos += rdata_len;
+		CurrPos.xrecoff += rdata_len;
+		freespace -= rdata_len;
+		write_len -= rdata_len;
 	}
-#endif
+	Assert(write_len == 0);
 
-	/* Record begin of record in appropriate places */
-	ProcLastRecPtr = RecPtr;
-	Insert->PrevRecord = RecPtr;
+	/* Ensure next record will be properly aligned */
+	CurrPos.xrecoff = MAXALIGN(CurrPos.xrecoff);
 
-	Insert->currpos += SizeOfXLogRecord;
-	freespace -= SizeOfXLogRecord;
+	/*
+	 * An xlog-switch record doesn't contain any data besides the header, but
+	 * we have reserved the rest of the segment for it.  Initialize the
+	 * remaining pages, so that they are written out as zeroes.
+	 */
+	if (isLogSwitch && !XLByteEQ(CurrPos, EndPos))
+	{
+		CurrPos = XLogNextPageStart(CurrPos);
+		while (XLByteLT(CurrPos, EndPos))
+		{
+			(void) GetXLogBuffer(CurrPos);
+			CurrPos.xrecoff += XLOG_BLCKSZ;
+		}
+	}
+
+	if (!XLByteEQ(CurrPos, EndPos))
+		elog(PANIC, "space reserved for WAL record does not match what was written");
+}
+
+/*
+ * Get a pointer to the right location in the WAL buffer containing the
+ * given XLogRecPtr.
+ *
+ * If the page is not initialized yet, it is initialized.  That might require
+ * evicting an old dirty buffer from the buffer cache, which means I/O.
+ *
+ * The caller must ensure that the page containing the requested location
+ * isn't evicted yet, and won't be evicted.  The way to ensure that is to
+ * hold an insertion slot and advertise a position no later than ptr in it,
+ * which is what we do before waiting for the page.
+ */
+static char *
+GetXLogBuffer(XLogRecPtr ptr)
+{
+	static uint64 cachedPage = 0;
+	static char *cachedPos = NULL;
+	uint64		pageno;
+	int			idx;
+	XLogRecPtr	expectedEndPtr;
+	XLogRecPtr	endptr;
+	volatile XLogRecPtr *xlblock;
 
 	/*
-	 * Append the data, including backup blocks if any
+	 * Fast path for the common case that we need to access again the same
+	 * page as last time.  Whoever initialized it is done with it, and it
+	 * can't have been recycled while we hold our slot.
+	 */
+	pageno = XLogRecPtrToPageNo(ptr);
+	if (pageno == cachedPage && cachedPos != NULL)
+		return cachedPos + ptr.xrecoff % XLOG_BLCKSZ;
+
+	/*
+	 * The XLog buffer cache is organized so that a page is always loaded to a
+	 * particular buffer.  That way we can easily calculate the buffer a given
+	 * page must be loaded into, from the XLogRecPtr alone.
+	 */
+	idx = XLogRecPtrToBufIdx(ptr);
+	expectedEndPtr.xlogid = ptr.xlogid;
+	expectedEndPtr.xrecoff = ptr.xrecoff - ptr.xrecoff % XLOG_BLCKSZ + XLOG_BLCKSZ;
+
+	/*
+	 * See what page is loaded in the buffer at the moment.  It could be the
+	 * page we're looking for, or something older.  It can't be anything newer
+	 * - that would imply the page we're looking for has already been written
+	 * out to disk and evicted, and the caller is responsible for making sure
+	 * that doesn't happen.
+	 *
+	 * We read xlblocks without holding WALBufMappingLock.  A torn read just
+	 * makes us take the slow path; AdvanceXLInsertBuffer sets xlblocks only
+	 * after the page has been initialized.
 	 */
-	while (write_len)
+	xlblock = &XLogCtl->xlblocks[idx];
+	endptr.xlogid = xlblock->xlogid;
+	endptr.xrecoff = xlblock->xrecoff;
+
+	if (!XLByteEQ(expectedEndPtr, endptr))
 	{
-		while (rdata->data == NULL)
-			rdata = rdata->next;
+		XLogRecPtr	initializedUpto;
 
-		if (freespace > 0)
+		/*
+		 * The page isn't initialized yet, and we might have to wait for
+		 * somebody else's insertions to finish before its buffer can be
+		 * reused.  Before we do that, let others know how far we've
+		 * gotten, so that they don't wait for us in turn.  If we are just
+		 * past the page header, we haven't copied anything to this page
+		 * yet, so we're done up to the end of the previous page.
+		 */
+		initializedUpto = ptr;
+		initializedUpto.xrecoff -= ptr.xrecoff % XLOG_BLCKSZ;
+		if (ptr.xrecoff % XLOG_BLCKSZ > XLogPageHeaderSizeAt(initializedUpto))
+			initializedUpto = ptr;
+		else if (initializedUpto.xrecoff == 0)
 		{
-			if (rdata->len > freespace)
-			{
-				memcpy(Insert->currpos, rdata->data, freespace);
-				rdata->data += freespace;
-				rdata->len -= freespace;
-				write_len -= freespace;
-			}
-			else
-			{
-				memcpy(Insert->currpos, rdata->data, rdata->len);
-				freespace -= rdata->len;
-				write_len -= rdata->len;
-				Insert->currpos += rdata->len;
-				rdata = rdata->next;
-				continue;
-			}
+			/* previous page ended a logid */
+			initializedUpto.xlogid -= 1;
+			initializedUpto.xrecoff = XLogFileSize;
 		}
+		WALInsertSlotUpdateInsertingAt(MyInsertSlotNo, initializedUpto);
+
+		AdvanceXLInsertBuffer(ptr, false);
 
-		/* Use next buffer */
-		updrqst = AdvanceXLInsertBuffer(false);
-		curridx = Insert->curridx;
-		/* Insert cont-record header */
-		Insert->currpage->xlp_info |= XLP_FIRST_IS_CONTRECORD;
-		contrecord = (XLogContRecord *) Insert->currpos;
-		contrecord->xl_rem_len = write_len;
-		Insert->currpos += SizeOfXLogContRecord;
-		freespace = INSERT_FREESPACE(Insert);
+		endptr.xlogid = xlblock->xlogid;
+		endptr.xrecoff = xlblock->xrecoff;
+		if (!XLByteEQ(expectedEndPtr, endptr))
+			elog(PANIC, "could not find WAL buffer for %X/%X",
+				 ptr.xlogid, ptr.xrecoff);
 	}
 
-	/* Ensure next record will be properly aligned */
-	Insert->currpos = (char *) Insert->currpage +
-		MAXALIGN(Insert->currpos - (char *) Insert->currpage);
-	freespace = INSERT_FREESPACE(Insert);
+	/*
+	 * Found the buffer holding this page.  Return a pointer to the right
+	 * offset within the page.
+	 */
+	cachedPage = pageno;
+	cachedPos = XLogCtl->pages + idx * (Size) XLOG_BLCKSZ;
+
+	return cachedPos + ptr.xrecoff % XLOG_BLCKSZ;
+}
+
+/*
+ * Wait for any WAL insertions < upto to finish.
+ *
+ * Returns the location of the oldest insertion that is still in-progress.
+ * Any WAL prior to that point has been fully copied into WAL buffers, and
+ * can be flushed out to disk.  Because this waits for any insertions older
+ * than 'upto' to finish, the return value is always >= 'upto'.
+ *
+ * Note: When you are about to write out WAL, you must call this function
+ * *before* acquiring WALWriteLock, to avoid deadlocks.  This function might
+ * need to wait for an insertion to finish (or at least advance to next
+ * uninitialized page), and the inserter might need to evict an old WAL buffer
+ * to make room for a new one, which in turn requires WALWriteLock.
+ */
+static XLogRecPtr
+WaitXLogInsertionsToFinish(XLogRecPtr upto)
+{
+	/* use volatile pointer to prevent code rearrangement */
+	volatile XLogCtlInsert *Insert = &XLogCtl->Insert;
+	XLogRecPtr	reservedUpto;
+	XLogRecPtr	finishedUpto;
+	int			i;
+
+	/* Read the current insert position */
+	SpinLockAcquire(&Insert->insertpos_lck);
+	reservedUpto = Insert->CurrPos;
+	SpinLockRelease(&Insert->insertpos_lck);
 
 	/*
-	 * The recptr I return is the beginning of the *next* record. This will be
-	 * stored as LSN for changed data pages...
+	 * No-one should request to flush a piece of WAL that hasn't even been
+	 * reserved yet.  However, it can happen if there is a block with a bogus
+	 * LSN on disk, for example.  XLogFlush checks for that situation and
+	 * complains, but only after the flush.  Here we just assume that to mean
+	 * that all WAL that has been reserved needs to be finished.  In this
+	 * corner-case, the return value can be smaller than 'upto' argument.
 	 */
-	INSERT_RECPTR(RecPtr, Insert, curridx);
+	if (XLByteLT(reservedUpto, upto))
+	{
+		elog(LOG, "request to flush past end of generated WAL; request %X/%X, currpos %X/%X",
+			 upto.xlogid, upto.xrecoff,
+			 reservedUpto.xlogid, reservedUpto.xrecoff);
+		upto = reservedUpto;
+	}
 
 	/*
-	 * If the record is an XLOG_SWITCH, we must now write and flush all the
-	 * existing data, and then forcibly advance to the start of the next
-	 * segment.  It's not good to do this I/O while holding the insert lock,
-	 * but there seems too much risk of confusion if we try to release the
-	 * lock sooner.  Fortunately xlog switch needn't be a high-performance
-	 * operation anyway...
+	 * Finish up to the reserved position, unless some insertion below that
+	 * is still in progress.
 	 */
-	if (isLogSwitch)
+	finishedUpto = reservedUpto;
+	for (i = 0; i < NUM_XLOGINSERT_SLOTS; i++)
 	{
-		XLogCtlWrite *Write = &XLogCtl->Write;
-		XLogwrtRqst FlushRqst;
-		XLogRecPtr	OldSegEnd;
+		XLogRecPtr	insertingat;
 
-		TRACE_POSTGRESQL_XLOG_SWITCH();
+		insertingat = WaitOnSlot(&Insert->insertSlots[i].slot, upto);
+		if (XLByteEQ(insertingat, InvalidXLogRecPtr))
+			continue;			/* slot is free */
+		if (XLByteLT(insertingat, finishedUpto))
+			finishedUpto = insertingat;
+	}
+	return finishedUpto;
+}
+
+/*
+ * Wait until the insertion holding the given slot, if any, has either
+ * finished or progressed to waitptr.  Returns the position the holder has
+ * advertised, or an invalid pointer if the slot is free.
+ */
+static XLogRecPtr
+WaitOnSlot(volatile XLogInsertSlot *slot, XLogRecPtr waitptr)
+{
+	PGPROC	   *proc = MyProc;
+	XLogRecPtr	insertingat;
+	int			extraWaits = 0;
 
-		LWLockAcquire(WALWriteLock, LW_EXCLUSIVE);
+	for (;;)
+	{
+		SpinLockAcquire(&slot->mutex);
+
+		if (!slot->held)
+		{
+			SpinLockRelease(&slot->mutex);
+			insertingat = InvalidXLogRecPtr;
+			break;
+		}
 
 		/*
-		 * Flush through the end of the page containing XLOG_SWITCH, and
-		 * perform end-of-segment actions (eg, notifying archiver).
+		 * An invalid xlogInsertingAt compares lower than any real position,
+		 * so we wait for the holder in that case too.
 		 */
-		WriteRqst = XLogCtl->xlblocks[curridx];
-		FlushRqst.Write = WriteRqst;
-		FlushRqst.Flush = WriteRqst;
-		XLogWrite(FlushRqst, false, true);
-
-		/* Set up the next buffer as first page of next segment */
-		/* Note: AdvanceXLInsertBuffer cannot need to do I/O here */
-		(void) AdvanceXLInsertBuffer(true);
-
-		/* There should be no unwritten data */
-		curridx = Insert->curridx;
-		Assert(curridx == Write->curridx);
-
-		/* Compute end address of old segment */
-		OldSegEnd = XLogCtl->xlblocks[curridx];
-		OldSegEnd.xrecoff -= XLOG_BLCKSZ;
-		if (OldSegEnd.xrecoff == 0)
+		insertingat = slot->xlogInsertingAt;
+		if (!XLByteLT(insertingat, waitptr))
 		{
-			/* crossing a logid boundary */
-			OldSegEnd.xlogid -= 1;
-			OldSegEnd.xrecoff = XLogFileSize;
+			SpinLockRelease(&slot->mutex);
+			break;
 		}
 
-		/* Make it look like we've written and synced all of old segment */
-		LogwrtResult.Write = OldSegEnd;
-		LogwrtResult.Flush = OldSegEnd;
+		/*
+		 * Add myself to wait queue, and wait until the holder releases the
+		 * slot or advertises a new position.  See WALInsertSlotAcquireOne
+		 * about absorbing extra wakeups.
+		 */
+		if (proc == NULL)
+			elog(PANIC, "cannot wait without a PGPROC structure");
+
+		proc->lwWaiting = true;
+		proc->lwExclusive = false;
+		proc->lwWaitLink = NULL;
+		if (slot->head == NULL)
+			slot->head = proc;
+		else
+			slot->tail->lwWaitLink = proc;
+		slot->tail = proc;
+
+		SpinLockRelease(&slot->mutex);
+
+		for (;;)
+		{
+			/* "false" means cannot accept cancel/die interrupt here. */
+			PGSemaphoreLock(&proc->sem, false);
+			if (!proc->lwWaiting)
+				break;
+			extraWaits++;
+		}
+	}
+
+	/*
+	 * Fix the process wait semaphore's count for any absorbed wakeups.
+	 */
+	while (extraWaits-- > 0)
+		PGSemaphoreUnlock(&proc->sem);
+
+	return insertingat;
+}
+
+/*
+ * Acquire a WAL insertion slot, or all of them if 'exclusive' is true.
+ *
+ * To spread the load, each backend remembers which slot to try first; if it
+ * had to wait for it, it moves on to the next one for its next insertion.
+ */
+static void
+WALInsertSlotAcquire(bool exclusive)
+{
+	if (exclusive)
+	{
+		XLogRecPtr	maxptr;
+		int			i;
 
 		/*
-		 * Update shared-memory status --- this code should match XLogWrite
+		 * Acquire the slots in order, to avoid deadlocking against another
+		 * process doing the same.  Once we have a slot, advertise it as
+		 * finished, so that nobody waits on it while we wait for the others.
+		 * We keep the last one as our own; it is the one whose position is
+		 * advertised if we have to wait for a WAL buffer page.
 		 */
+		maxptr.xlogid = 0xFFFFFFFF;
+		maxptr.xrecoff = 0xFFFFFFFF;
+		for (i = 0; i < NUM_XLOGINSERT_SLOTS; i++)
 		{
-			/* use volatile pointer to prevent code rearrangement */
-			volatile XLogCtlData *xlogctl = XLogCtl;
+			(void) WALInsertSlotAcquireOne(i);
+			if (i < NUM_XLOGINSERT_SLOTS - 1)
+				WALInsertSlotUpdateInsertingAt(i, maxptr);
+		}
+		holdingAllSlots = true;
+		MyInsertSlotNo = NUM_XLOGINSERT_SLOTS - 1;
+	}
+	else
+	{
+		if (insertSlotToTry == -1)
+			insertSlotToTry = MyProcPid % NUM_XLOGINSERT_SLOTS;
 
-			SpinLockAcquire(&xlogctl->info_lck);
-			xlogctl->LogwrtResult = LogwrtResult;
-			if (XLByteLT(xlogctl->LogwrtRqst.Write, LogwrtResult.Write))
-				xlogctl->LogwrtRqst.Write = LogwrtResult.Write;
-			if (XLByteLT(xlogctl->LogwrtRqst.Flush, LogwrtResult.Flush))
-				xlogctl->LogwrtRqst.Flush = LogwrtResult.Flush;
-			SpinLockRelease(&xlogctl->info_lck);
+		MyInsertSlotNo = insertSlotToTry;
+		if (!WALInsertSlotAcquireOne(MyInsertSlotNo))
+			insertSlotToTry = (insertSlotToTry + 1) % NUM_XLOGINSERT_SLOTS;
+	}
+}
+
+/*
+ * Acquire one WAL insertion slot, waiting if it's busy.  Returns true if
+ * we got it without waiting.
+ *
+ * The wait queue works the same way as an LWLock's: the releaser removes
+ * the waiters from the queue and signals their semaphores.  The semaphore
+ * might also be signaled for other reasons, eg. by LWLockRelease, which
+ * we must absorb and re-signal afterwards.
+ */
+static bool
+WALInsertSlotAcquireOne(int slotno)
+{
+	volatile XLogInsertSlot *slot = &XLogCtl->Insert.insertSlots[slotno].slot;
+	PGPROC	   *proc = MyProc;
+	bool		retry = false;
+	int			extraWaits = 0;
+
+	/*
+	 * Lock out cancel/die interrupts until we release the slot, like
+	 * LWLockAcquire does.
+	 */
+	HOLD_INTERRUPTS();
+
+	for (;;)
+	{
+		SpinLockAcquire(&slot->mutex);
+
+		if (!slot->held)
+		{
+			slot->held = true;
+			slot->xlogInsertingAt = InvalidXLogRecPtr;
+			SpinLockRelease(&slot->mutex);
+			break;
 		}
 
-		Write->LogwrtResult = LogwrtResult;
+		if (proc == NULL)
+			elog(PANIC, "cannot wait without a PGPROC structure");
+
+		proc->lwWaiting = true;
+		proc->lwExclusive = true;
+		proc->lwWaitLink = NULL;
+		if (slot->head == NULL)
+			slot->head = proc;
+		else
+			slot->tail->lwWaitLink = proc;
+		slot->tail = proc;
+
+		SpinLockRelease(&slot->mutex);
+
+		for (;;)
+		{
+			/* "false" means cannot accept cancel/die interrupt here. */
+			PGSemaphoreLock(&proc->sem, false);
+			if (!proc->lwWaiting)
+				break;
+			extraWaits++;
+		}
+
+		/* Now loop back and try to acquire the slot again. */
+		retry = true;
+	}
+
+	/*
+	 * Fix the process wait semaphore's count for any absorbed wakeups.
+	 */
+	while (extraWaits-- > 0)
+		PGSemaphoreUnlock(&proc->sem);
+
+	return !retry;
+}
+
+/*
+ * Release our insertion slot, or all of them if we're holding all of them.
+ */
+static void
+WALInsertSlotRelease(void)
+{
+	int			i;
+
+	if (holdingAllSlots)
+	{
+		for (i = 0; i < NUM_XLOGINSERT_SLOTS; i++)
+			WALInsertSlotReleaseOne(i);
+		holdingAllSlots = false;
+	}
+	else
+		WALInsertSlotReleaseOne(MyInsertSlotNo);
+
+	MyInsertSlotNo = -1;
+}
+
+static void
+WALInsertSlotReleaseOne(int slotno)
+{
+	volatile XLogInsertSlot *slot = &XLogCtl->Insert.insertSlots[slotno].slot;
+	PGPROC	   *head;
+	PGPROC	   *proc;
+
+	SpinLockAcquire(&slot->mutex);
+
+	Assert(slot->held);
+	slot->held = false;
+
+	/* Wake up everybody, whether waiting for the slot or for progress */
+	head = slot->head;
+	slot->head = NULL;
+
+	SpinLockRelease(&slot->mutex);
+
+	while (head != NULL)
+	{
+		proc = head;
+		head = proc->lwWaitLink;
+		proc->lwWaitLink = NULL;
+		proc->lwWaiting = false;
+		PGSemaphoreUnlock(&proc->sem);
+	}
+
+	/*
+	 * Now okay to allow cancel/die interrupts.
+	 */
+	RESUME_INTERRUPTS();
+}
+
+/*
+ * Advertise that the holder of the given slot, which must be us, has
+ * finished all its insertions before insertingAt, and wake up anyone
+ * waiting for it to get that far.  Processes waiting to acquire the slot
+ * are left alone.
+ */
+static void
+WALInsertSlotUpdateInsertingAt(int slotno, XLogRecPtr insertingAt)
+{
+	volatile XLogInsertSlot *slot = &XLogCtl->Insert.insertSlots[slotno].slot;
+	PGPROC	   *head;
+	PGPROC	   *proc;
+	PGPROC	   *next;
+	PGPROC	   *prev;
+
+	SpinLockAcquire(&slot->mutex);
 
-		LWLockRelease(WALWriteLock);
+	Assert(slot->held);
+	slot->xlogInsertingAt = insertingAt;
 
-		updrqst = false;		/* done already */
-	}
-	else
+	/* Unlink the waiters that are not trying to acquire the slot */
+	head = NULL;
+	prev = NULL;
+	proc = slot->head;
+	while (proc != NULL)
 	{
-		/* normal case, ie not xlog switch */
-
-		/* Need to update shared LogwrtRqst if some block was filled up */
-		if (freespace < SizeOfXLogRecord)
+		next = proc->lwWaitLink;
+		if (!proc->lwExclusive)
 		{
-			/* curridx is filled and available for writing out */
-			updrqst = true;
+			if (prev == NULL)
+				slot->head = next;
+			else
+				prev->lwWaitLink = next;
+			if (next == NULL && prev != NULL)
+				slot->tail = prev;
+			proc->lwWaitLink = head;
+			head = proc;
 		}
 		else
-		{
-			/* if updrqst already set, write through end of previous buf */
-			curridx = PrevBufIdx(curridx);
-		}
-		WriteRqst = XLogCtl->xlblocks[curridx];
+			prev = proc;
+		proc = next;
 	}
 
-	LWLockRelease(WALInsertLock);
+	SpinLockRelease(&slot->mutex);
 
-	if (updrqst)
+	while (head != NULL)
 	{
-		/* use volatile pointer to prevent code rearrangement */
-		volatile XLogCtlData *xlogctl = XLogCtl;
-
-		SpinLockAcquire(&xlogctl->info_lck);
-		/* advance global request to include new block(s) */
-		if (XLByteLT(xlogctl->LogwrtRqst.Write, WriteRqst))
-			xlogctl->LogwrtRqst.Write = WriteRqst;
-		/* update local result copy while I have the chance */
-		LogwrtResult = xlogctl->LogwrtResult;
-		SpinLockRelease(&xlogctl->info_lck);
+		proc = head;
+		head = proc->lwWaitLink;
+		proc->lwWaitLink = NULL;
+		proc->lwWaiting = false;
+		PGSemaphoreUnlock(&proc->sem);
 	}
-
-	XactLastRecEnd = RecPtr;
-
-	END_CRIT_SECTION();
-
-	return RecPtr;
 }
 
 /*
@@ -1420,158 +2144,149 @@ XLogArchiveCleanup(const char *xlog)
 }
 
 /*
- * Advance the Insert state to the next buffer page, writing out the next
- * buffer if it still contains unwritten data.
- *
- * If new_segment is TRUE then we set up the next buffer page as the first
- * page of the next xlog segment file, possibly but not usually the next
- * consecutive file page.
- *
- * The global LogwrtRqst.Write pointer needs to be advanced to include the
- * just-filled page.  If we can do this for free (without an extra lock),
- * we do so here.  Otherwise the caller must do it.  We return TRUE if the
- * request update still needs to be done, FALSE if we did it internally.
- *
- * Must be called with WALInsertLock held.
+ * Initialize XLOG buffers, writing out old buffers if they still contain
+ * unwritten data, upto the page containing 'upto'.  Or if 'opportunistic' is
+ * true, initialize as many pages as we can without having to write out
+ * unwritten data.  Any new pages are initialized to zeros, with page headers
+ * initialized properly.
  */
-static bool
-AdvanceXLInsertBuffer(bool new_segment)
+static void
+AdvanceXLInsertBuffer(XLogRecPtr upto, bool opportunistic)
 {
-	XLogCtlInsert *Insert = &XLogCtl->Insert;
-	XLogCtlWrite *Write = &XLogCtl->Write;
-	int			nextidx = NextBufIdx(Insert->curridx);
-	bool		update_needed = true;
+	/* use volatile pointer to prevent code rearrangement */
+	volatile XLogCtlData *xlogctl = XLogCtl;
+	int			nextidx;
 	XLogRecPtr	OldPageRqstPtr;
 	XLogwrtRqst WriteRqst;
+	XLogRecPtr	NewPageBeginPtr;
 	XLogRecPtr	NewPageEndPtr;
 	XLogPageHeader NewPage;
 
-	/* Use Insert->LogwrtResult copy if it's more fresh */
-	if (XLByteLT(LogwrtResult.Write, Insert->LogwrtResult.Write))
-		LogwrtResult = Insert->LogwrtResult;
+	LWLockAcquire(WALBufMappingLock, LW_EXCLUSIVE);
 
 	/*
-	 * Get ending-offset of the buffer page we need to replace (this may be
-	 * zero if the buffer hasn't been used yet).  Fall through if it's already
-	 * written out.
+	 * Now that we have the lock, check if someone initialized the page
+	 * already.
 	 */
-	OldPageRqstPtr = XLogCtl->xlblocks[nextidx];
-	if (!XLByteLE(OldPageRqstPtr, LogwrtResult.Write))
+	while (XLByteLE(XLogCtl->InitializedUpTo, upto) || opportunistic)
 	{
-		/* nope, got work to do... */
-		XLogRecPtr	FinishedPageRqstPtr;
-
-		FinishedPageRqstPtr = XLogCtl->xlblocks[Insert->curridx];
+		NewPageBeginPtr = XLogNextPageStart(XLogCtl->InitializedUpTo);
+		nextidx = XLogRecPtrToBufIdx(NewPageBeginPtr);
 
-		/* Before waiting, get info_lck and update LogwrtResult */
+		/*
+		 * Get ending-offset of the buffer page we need to replace (this may
+		 * be zero if the buffer hasn't been used yet).  Fall through if it's
+		 * already written out.
+		 */
+		OldPageRqstPtr = XLogCtl->xlblocks[nextidx];
+		if (!XLByteLE(OldPageRqstPtr, LogwrtResult.Write))
 		{
-			/* use volatile pointer to prevent code rearrangement */
-			volatile XLogCtlData *xlogctl = XLogCtl;
+			/*
+			 * Nope, got work to do.  If we just want to pre-initialize as
+			 * much as we can without flushing, give up now.
+			 */
+			if (opportunistic)
+				break;
 
+			/* Before waiting, get info_lck and update LogwrtResult */
 			SpinLockAcquire(&xlogctl->info_lck);
-			if (XLByteLT(xlogctl->LogwrtRqst.Write, FinishedPageRqstPtr))
-				xlogctl->LogwrtRqst.Write = FinishedPageRqstPtr;
+			if (XLByteLT(xlogctl->LogwrtRqst.Write, OldPageRqstPtr))
+				xlogctl->LogwrtRqst.Write = OldPageRqstPtr;
 			LogwrtResult = xlogctl->LogwrtResult;
 			SpinLockRelease(&xlogctl->info_lck);
-		}
 
-		update_needed = false;	/* Did the shared-request update */
-
-		if (XLByteLE(OldPageRqstPtr, LogwrtResult.Write))
-		{
-			/* OK, someone wrote it already */
-			Insert->LogwrtResult = LogwrtResult;
-		}
-		else
-		{
-			/* Must acquire write lock */
-			LWLockAcquire(WALWriteLock, LW_EXCLUSIVE);
-			LogwrtResult = Write->LogwrtResult;
-			if (XLByteLE(OldPageRqstPtr, LogwrtResult.Write))
-			{
-				/* OK, someone wrote it already */
-				LWLockRelease(WALWriteLock);
-				Insert->LogwrtResult = LogwrtResult;
-			}
-			else
+			/*
+			 * Now that we have an up-to-date LogwrtResult value, see if we
+			 * still need to write it or if someone else already did.
+			 */
+			if (!XLByteLE(OldPageRqstPtr, LogwrtResult.Write))
 			{
 				/*
-				 * Have to write buffers while holding insert lock. This is
-				 * not good, so only write as much as we absolutely must.
+				 * Must acquire write lock.  Release WALBufMappingLock first,
+				 * to make sure that all insertions that we need to wait for
+				 * can finish (up to this same position).  Otherwise we risk
+				 * deadlock.
 				 */
-				TRACE_POSTGRESQL_WAL_BUFFER_WRITE_DIRTY_START();
-				WriteRqst.Write = OldPageRqstPtr;
-				WriteRqst.Flush.xlogid = 0;
-				WriteRqst.Flush.xrecoff = 0;
-				XLogWrite(WriteRqst, false, false);
-				LWLockRelease(WALWriteLock);
-				Insert->LogwrtResult = LogwrtResult;
-				TRACE_POSTGRESQL_WAL_BUFFER_WRITE_DIRTY_DONE();
-			}
-		}
-	}
+				LWLockRelease(WALBufMappingLock);
 
-	/*
-	 * Now the next buffer slot is free and we can set it up to be the next
-	 * output page.
-	 */
-	NewPageEndPtr = XLogCtl->xlblocks[Insert->curridx];
+				WaitXLogInsertionsToFinish(OldPageRqstPtr);
 
-	if (new_segment)
-	{
-		/* force it to a segment start point */
-		NewPageEndPtr.xrecoff += XLogSegSize - 1;
-		NewPageEndPtr.xrecoff -= NewPageEndPtr.xrecoff % XLogSegSize;
-	}
+				LWLockAcquire(WALWriteLock, LW_EXCLUSIVE);
 
-	if (NewPageEndPtr.xrecoff >= XLogFileSize)
-	{
-		/* crossing a logid boundary */
-		NewPageEndPtr.xlogid += 1;
-		NewPageEndPtr.xrecoff = XLOG_BLCKSZ;
-	}
-	else
+				LogwrtResult = XLogCtl->Write.LogwrtResult;
+				if (XLByteLE(OldPageRqstPtr, LogwrtResult.Write))
+				{
+					/* OK, someone wrote it already */
+					LWLockRelease(WALWriteLock);
+				}
+				else
+				{
+					/* Have to write it ourselves */
+					TRACE_POSTGRESQL_WAL_BUFFER_WRITE_DIRTY_START();
+					WriteRqst.Write = OldPageRqstPtr;
+					WriteRqst.Flush.xlogid = 0;
+					WriteRqst.Flush.xrecoff = 0;
+					XLogWrite(WriteRqst, false);
+					LWLockRelease(WALWriteLock);
+					TRACE_POSTGRESQL_WAL_BUFFER_WRITE_DIRTY_DONE();
+				}
+				/* Re-acquire WALBufMappingLock and retry */
+				LWLockAcquire(WALBufMappingLock, LW_EXCLUSIVE);
+				continue;
+			}
+		}
+
+		/*
+		 * Now the next buffer slot is free and we can set it up to be the
+		 * next output page.
+		 */
+		NewPageEndPtr = NewPageBeginPtr;
 		NewPageEndPtr.xrecoff += XLOG_BLCKSZ;
-	XLogCtl->xlblocks[nextidx] = NewPageEndPtr;
-	NewPage = (XLogPageHeader) (XLogCtl->pages + nextidx * (Size) XLOG_BLCKSZ);
 
-	Insert->curridx = nextidx;
-	Insert->currpage = NewPage;
+		NewPage = (XLogPageHeader) (XLogCtl->pages + nextidx * (Size) XLOG_BLCKSZ);
+
+		/*
+		 * Be sure to re-zero the buffer so that bytes beyond what we've
+		 * written will look like zeroes and not valid XLOG records...
+		 */
+		MemSet((char *) NewPage, 0, XLOG_BLCKSZ);
 
-	Insert->currpos = ((char *) NewPage) +SizeOfXLogShortPHD;
+		/*
+		 * Fill the new page's header
+		 */
+		NewPage   ->xlp_magic = XLOG_PAGE_MAGIC;
 
-	/*
-	 * Be sure to re-zero the buffer so that bytes beyond what we've written
-	 * will look like zeroes and not valid XLOG records...
-	 */
-	MemSet((char *) NewPage, 0, XLOG_BLCKSZ);
+		/* NewPage->xlp_info = 0; */	/* done by memset */
+		NewPage   ->xlp_tli = ThisTimeLineID;
+		NewPage   ->xlp_pageaddr = NewPageBeginPtr;
 
-	/*
-	 * Fill the new page's header
-	 */
-	NewPage   ->xlp_magic = XLOG_PAGE_MAGIC;
+		/*
+		 * If first page of an XLOG segment file, make it a long header.
+		 */
+		if ((NewPage->xlp_pageaddr.xrecoff % XLogSegSize) == 0)
+		{
+			XLogLongPageHeader NewLongPage = (XLogLongPageHeader) NewPage;
 
-	/* NewPage->xlp_info = 0; */	/* done by memset */
-	NewPage   ->xlp_tli = ThisTimeLineID;
-	NewPage   ->xlp_pageaddr.xlogid = NewPageEndPtr.xlogid;
-	NewPage   ->xlp_pageaddr.xrecoff = NewPageEndPtr.xrecoff - XLOG_BLCKSZ;
+			NewLongPage->xlp_sysid = ControlFile->system_identifier;
+			NewLongPage->xlp_seg_size = XLogSegSize;
+			NewLongPage->xlp_xlog_blcksz = XLOG_BLCKSZ;
+			NewPage   ->xlp_info |= XLP_LONG_HEADER;
+		}
 
-	/*
-	 * If first page of an XLOG segment file, make it a long header.
-	 */
-	if ((NewPage->xlp_pageaddr.xrecoff % XLogSegSize) == 0)
-	{
-		XLogLongPageHeader NewLongPage = (XLogLongPageHeader) NewPage;
+		/*
+		 * Make sure the initialization of the page is visible to others
+		 * before the xlblocks update, because GetXLogBuffer() reads xlblocks
+		 * without holding a lock.  Taking and releasing info_lck serves as
+		 * a memory barrier.
+		 */
+		SpinLockAcquire(&xlogctl->info_lck);
+		SpinLockRelease(&xlogctl->info_lck);
 
-		NewLongPage->xlp_sysid = ControlFile->system_identifier;
-		NewLongPage->xlp_seg_size = XLogSegSize;
-		NewLongPage->xlp_xlog_blcksz = XLOG_BLCKSZ;
-		NewPage   ->xlp_info |= XLP_LONG_HEADER;
+		*((volatile XLogRecPtr *) &XLogCtl->xlblocks[nextidx]) = NewPageEndPtr;
 
-		Insert->currpos = ((char *) NewPage) +SizeOfXLogLongPHD;
+		XLogCtl->InitializedUpTo = NewPageEndPtr;
 	}
-
-	return update_needed;
+	LWLockRelease(WALBufMappingLock);
 }
 
 /*
@@ -1616,16 +2331,12 @@ XLogCheckpointNeeded(uint32 logid, uint32 logseg)
  * This option allows us to avoid uselessly issuing multiple writes when a
  * single one would do.
  *
- * If xlog_switch == TRUE, we are intending an xlog segment switch, so
- * perform end-of-segment actions after writing the last page, even if
- * it's not physically the end of its segment.  (NB: this will work properly
- * only if caller specifies WriteRqst == page-end and flexible == false,
- * and there is some data to write.)
- *
- * Must be called with WALWriteLock held.
+ * Must be called with WALWriteLock held.  WaitXLogInsertionsToFinish(WriteRqst)
+ * must be called before grabbing the lock, to make sure the data is ready to
+ * write.
  */
 static void
-XLogWrite(XLogwrtRqst WriteRqst, bool flexible, bool xlog_switch)
+XLogWrite(XLogwrtRqst WriteRqst, bool flexible)
 {
 	XLogCtlWrite *Write = &XLogCtl->Write;
 	bool		ispartialpage;
@@ -1660,12 +2371,10 @@ XLogWrite(XLogwrtRqst WriteRqst, bool flexible, bool xlog_switch)
 
 	/*
 	 * Within the loop, curridx is the cache block index of the page to
-	 * consider writing.  We advance Write->curridx only after successfully
-	 * writing pages.  (Right now, this refinement is useless since we are
-	 * going to PANIC if any error occurs anyway; but someday it may come in
-	 * useful.)
+	 * consider writing.  Begin at the buffer containing the next unwritten
+	 * page, or last partially written page.
 	 */
-	curridx = Write->curridx;
+	curridx = XLogRecPtrToBufIdx(LogwrtResult.Write);
 
 	while (XLByteLT(LogwrtResult.Write, WriteRqst.Write))
 	{
@@ -1768,7 +2477,6 @@ XLogWrite(XLogwrtRqst WriteRqst, bool flexible, bool xlog_switch)
 
 			/* Update state for write */
 			openLogOff += nbytes;
-			Write->curridx = ispartialpage ? curridx : NextBufIdx(curridx);
 			npages = 0;
 
 			/*
@@ -1778,16 +2486,13 @@ XLogWrite(XLogwrtRqst WriteRqst, bool flexible, bool xlog_switch)
 			 * later. Doing it here ensures that one and only one backend will
 			 * perform this fsync.
 			 *
-			 * We also do this if this is the last page written for an xlog
-			 * switch.
-			 *
 			 * This is also the right place to notify the Archiver that the
 			 * segment is ready to copy to archival storage, and to update the
 			 * timer for archive_timeout, and to signal for a checkpoint if
 			 * too many logfile segments have been used since the last
 			 * checkpoint.
 			 */
-			if (finishing_seg || (xlog_switch && last_iteration))
+			if (finishing_seg)
 			{
 				issue_xlog_fsync(openLogFile, openLogId, openLogSeg);
 				LogwrtResult.Flush = LogwrtResult.Write;		/* end of page */
@@ -1798,11 +2503,11 @@ XLogWrite(XLogwrtRqst WriteRqst, bool flexible, bool xlog_switch)
 				Write->lastSegSwitchTime = (pg_time_t) time(NULL);
 
 				/*
-				 * Signal bgwriter to start a checkpoint if we've consumed too
-				 * much xlog since the last one.  For speed, we first check
-				 * using the local copy of RedoRecPtr, which might be out of
-				 * date; if it looks like a checkpoint is needed, forcibly
-				 * update RedoRecPtr and recheck.
+				 * Signal checkpointer to start a checkpoint if we've consumed
+				 * too much xlog since the last one.  For speed, we first
+				 * check using the local copy of RedoRecPtr, which might be
+				 * out of date; if it looks like a checkpoint is needed,
+				 * forcibly update RedoRecPtr and recheck.
 				 */
 				if (IsUnderPostmaster &&
 					XLogCheckpointNeeded(openLogId, openLogSeg))
@@ -1828,7 +2533,6 @@ XLogWrite(XLogwrtRqst WriteRqst, bool flexible, bool xlog_switch)
 	}
 
 	Assert(npages == 0);
-	Assert(curridx == Write->curridx);
 
 	/*
 	 * If asked to flush, do so
@@ -1969,24 +2673,273 @@ UpdateMinRecoveryPoint(XLogRecPtr lsn, bool force)
 	LWLockRelease(ControlFileLock);
 }
 
+/*
+ * Join the group of backends waiting for WAL to be flushed, asking for a
+ * flush up to at least rqst.
+ *
+ * If there is no flush leader, we become the leader, and return true at
+ * once.  Otherwise we sleep until the leader has flushed for us, and return
+ * false, or until it has handed the leadership to us, and return true.
+ *
+ * This must be called in a critical section, so that a leader can't error
+ * out and leave its followers sleeping forever.
+ */
+static bool
+XLogFlushJoinGroup(XLogRecPtr rqst)
+{
+	/* use volatile pointers to prevent code rearrangement */
+	volatile XLogCtlData *xlogctl = XLogCtl;
+	volatile PGPROC *proc = MyProc;
+	PGPROC	   *leader = NULL;
+	bool		isLeader;
+
+	Assert(CritSectionCount > 0);
+
+	SpinLockAcquire(&xlogctl->flushqueue_lck);
+	if (!xlogctl->flushLeaderActive)
+	{
+		xlogctl->flushLeaderActive = true;
+		SpinLockRelease(&xlogctl->flushqueue_lck);
+		return true;
+	}
+
+	/* Somebody else is the leader; add ourselves to the end of the queue */
+	proc->flushWaiting = true;
+	proc->flushLeader = false;
+	proc->flushRqst = rqst;
+	proc->flushWaitLink = NULL;
+	if (xlogctl->flushQueueHead == NULL)
+		xlogctl->flushQueueHead = MyProc;
+	else
+		xlogctl->flushQueueTail->flushWaitLink = MyProc;
+	xlogctl->flushQueueTail = MyProc;
+	xlogctl->flushQueueLen++;
+
+	/* If the leader is waiting for the group to fill up, and it has, wake it */
+	if (xlogctl->flushDelayProc != NULL &&
+		xlogctl->flushQueueLen >= xlogctl->flushGroupTarget)
+	{
+		leader = xlogctl->flushDelayProc;
+		xlogctl->flushDelayProc = NULL;
+	}
+	SpinLockRelease(&xlogctl->flushqueue_lck);
+
+	if (leader != NULL)
+		SetLatch(&leader->procLatch);
+
+	/*
+	 * Wait for the leader to let us go.  The latch can be set for other
+	 * reasons too, so loop until it really has.
+	 */
+	for (;;)
+	{
+		ResetLatch(&MyProc->procLatch);
+		if (!proc->flushWaiting)
+			break;
+		WaitLatch(&MyProc->procLatch, -1L);
+	}
+
+	isLeader = proc->flushLeader;
+	proc->flushLeader = false;
+
+	return isLeader;
+}
+
+/*
+ * Flush WAL as the flush leader, far enough to satisfy both rqst and the
+ * requests of all backends queued behind us, and release them.  Then pass
+ * the leadership on to the next backend in the queue, if any.
+ */
+static void
+XLogFlushAsLeader(XLogRecPtr rqst)
+{
+	/* use volatile pointers to prevent code rearrangement */
+	volatile XLogCtlData *xlogctl = XLogCtl;
+	volatile PGPROC *group;
+	volatile PGPROC *proc;
+	PGPROC	   *nextLeader;
+	int			groupSize;
+	int			groupTarget;
+	XLogRecPtr	insertpos;
+	XLogwrtRqst WriteRqst;
+
+	/*
+	 * A leader that was handed the leadership may find that its predecessor
+	 * has already flushed far enough for it.  Don't delay in that case; the
+	 * followers it would be waiting for probably don't need a flush either.
+	 */
+	SpinLockAcquire(&xlogctl->info_lck);
+	LogwrtResult = xlogctl->LogwrtResult;
+	SpinLockRelease(&xlogctl->info_lck);
+
+	/*
+	 * Delay to let more backends join the group, if that has paid off
+	 * recently.  We don't bother to lock to read the average; it's only a
+	 * heuristic.
+	 */
+	groupTarget = (xlogctl->avgFlushGroupSize + FLUSH_GROUP_SCALE / 2) /
+		FLUSH_GROUP_SCALE;
+	if (CommitDelay > 0 && enableFsync && IsUnderPostmaster &&
+		groupTarget >= CommitSiblings &&
+		!XLByteLE(rqst, LogwrtResult.Flush))
+		XLogFlushDelay(groupTarget);
+
+	/* Take over everyone who's queued up so far */
+	SpinLockAcquire(&xlogctl->flushqueue_lck);
+	group = xlogctl->flushQueueHead;
+	groupSize = xlogctl->flushQueueLen;
+	xlogctl->flushQueueHead = NULL;
+	xlogctl->flushQueueTail = NULL;
+	xlogctl->flushQueueLen = 0;
+	SpinLockRelease(&xlogctl->flushqueue_lck);
+
+	for (proc = group; proc != NULL; proc = proc->flushWaitLink)
+	{
+		if (XLByteLT(rqst, proc->flushRqst))
+			rqst = proc->flushRqst;
+	}
+
+	/*
+	 * Before actually performing the write, wait for all in-flight
+	 * insertions to the pages we're about to write to finish.  We also learn
+	 * how far the completed insertions extend, which tells us how much more
+	 * we can write and flush along with the requested records.
+	 */
+	insertpos = WaitXLogInsertionsToFinish(rqst);
+
+	/* now wait for the write lock */
+	LWLockAcquire(WALWriteLock, LW_EXCLUSIVE);
+	LogwrtResult = XLogCtl->Write.LogwrtResult;
+	if (!XLByteLE(rqst, LogwrtResult.Flush))
+	{
+		/* try to write/flush later additions to XLOG as well */
+		WriteRqst.Write = insertpos;
+		WriteRqst.Flush = insertpos;
+		XLogWrite(WriteRqst, false);
+	}
+	LWLockRelease(WALWriteLock);
+
+	/*
+	 * Wake up the group.  A follower that isn't satisfied, because it asked
+	 * for a flush beyond the end of WAL, will come back to try again.
+	 *
+	 * As soon as flushWaiting is cleared, the follower may return and queue
+	 * up again, overwriting its flushWaitLink.  So we must fetch the link
+	 * before releasing it; the volatile pointer keeps the compiler from
+	 * moving the fetch past the store.
+	 */
+	while (group != NULL)
+	{
+		proc = group;
+		group = proc->flushWaitLink;
+		proc->flushWaitLink = NULL;
+		proc->flushWaiting = false;
+		SetLatch(&proc->procLatch);
+	}
+
+	/*
+	 * Update the average group size, and hand the leadership over to the
+	 * first backend that queued up while we were busy.
+	 */
+	SpinLockAcquire(&xlogctl->flushqueue_lck);
+	xlogctl->avgFlushGroupSize +=
+		(groupSize * FLUSH_GROUP_SCALE - xlogctl->avgFlushGroupSize) / 8;
+	nextLeader = xlogctl->flushQueueHead;
+	if (nextLeader != NULL)
+	{
+		xlogctl->flushQueueHead = nextLeader->flushWaitLink;
+		if (xlogctl->flushQueueHead == NULL)
+			xlogctl->flushQueueTail = NULL;
+		xlogctl->flushQueueLen--;
+		nextLeader->flushWaitLink = NULL;
+		nextLeader->flushLeader = true;
+		nextLeader->flushWaiting = false;
+	}
+	else
+		xlogctl->flushLeaderActive = false;
+	SpinLockRelease(&xlogctl->flushqueue_lck);
+
+	if (nextLeader != NULL)
+		SetLatch(&nextLeader->procLatch);
+}
+
+/*
+ * Sleep for up to CommitDelay microseconds, or until at least target
+ * backends have queued up behind us as flush leader, whichever comes first.
+ */
+static void
+XLogFlushDelay(int target)
+{
+	/* use volatile pointer to prevent code rearrangement */
+	volatile XLogCtlData *xlogctl = XLogCtl;
+	TimestampTz start = GetCurrentTimestamp();
+
+	for (;;)
+	{
+		bool		enough;
+		long		secs;
+		int			usecs;
+		long		remaining;
+
+		ResetLatch(&MyProc->procLatch);
+
+		SpinLockAcquire(&xlogctl->flushqueue_lck);
+		enough = (xlogctl->flushQueueLen >= target);
+		if (!enough)
+		{
+			xlogctl->flushDelayProc = MyProc;
+			xlogctl->flushGroupTarget = target;
+		}
+		SpinLockRelease(&xlogctl->flushqueue_lck);
+
+		if (enough)
+			break;
+
+		TimestampDifference(start, GetCurrentTimestamp(), &secs, &usecs);
+		remaining = CommitDelay - (secs * 1000000L + usecs);
+		if (remaining <= 0)
+			break;
+
+		WaitLatch(&MyProc->procLatch, remaining);
+	}
+
+	SpinLockAcquire(&xlogctl->flushqueue_lck);
+	xlogctl->flushDelayProc = NULL;
+	SpinLockRelease(&xlogctl->flushqueue_lck);
+}
+
 /*
  * Ensure that all XLOG data through the given position is flushed to disk.
  *
  * NOTE: this differs from XLogWrite mainly in that the WALWriteLock is not
  * already held, and we try to avoid acquiring it if possible.
+ *
+ * When many backends need a flush at the same time, as when many small
+ * transactions commit at once, we don't want each of them to take
+ * WALWriteLock in turn and issue an fsync of its own.  Instead, one backend
+ * acts as flush leader, and the others queue up behind it and sleep.  When
+ * the leader is ready to write, it takes over all the backends queued so far
+ * and flushes far enough to satisfy all of them, with a single fsync.  It
+ * then wakes them, and hands the leadership over to the first backend that
+ * queued up while it was busy, if any.  Thus, while one group is being
+ * flushed, the next one is collecting.
+ *
+ * If recent flushes have been shared by at least CommitSiblings backends,
+ * the leader also waits for up to CommitDelay microseconds for more backends
+ * to join its group before flushing, but only until as many have joined as
+ * recently did on average.
  */
 void
 XLogFlush(XLogRecPtr record)
 {
 	XLogRecPtr	WriteRqstPtr;
-	XLogwrtRqst WriteRqst;
 
 	/*
 	 * During REDO, we are reading not writing WAL.  Therefore, instead of
 	 * trying to flush the WAL, we should update minRecoveryPoint instead. We
 	 * test XLogInsertAllowed(), not InRecovery, because we need the bgwriter
-	 * to act this way too, and because when the bgwriter tries to write the
-	 * end-of-recovery checkpoint, it should indeed flush.
+	 * and checkpointer to act this way too, and because when the checkpointer
+	 * tries to write the end-of-recovery checkpoint, it should indeed flush.
 	 */
 	if (!XLogInsertAllowed())
 	{
@@ -2006,64 +2959,52 @@ XLogFlush(XLogRecPtr record)
 			 LogwrtResult.Flush.xlogid, LogwrtResult.Flush.xrecoff);
 #endif
 
-	START_CRIT_SECTION();
-
 	/*
-	 * Since fsync is usually a horribly expensive operation, we try to
-	 * piggyback as much data as we can on each fsync: if we see any more data
-	 * entered into the xlog buffer, we'll write and fsync that too, so that
-	 * the final value of LogwrtResult.Flush is as large as possible. This
-	 * gives us some chance of avoiding another fsync immediately after.
+	 * The flush leader must not error out while others are waiting for it,
+	 * so we do all this in a critical section.
 	 */
+	START_CRIT_SECTION();
 
-	/* initialize to given target; may increase below */
-	WriteRqstPtr = record;
-
-	/* read LogwrtResult and update local state */
+	for (;;)
 	{
-		/* use volatile pointer to prevent code rearrangement */
-		volatile XLogCtlData *xlogctl = XLogCtl;
+		/*
+		 * Since fsync is usually a horribly expensive operation, we try to
+		 * piggyback as much data as we can on each fsync: if we see any more
+		 * data entered into the xlog buffer, we'll write and fsync that too,
+		 * so that the final value of LogwrtResult.Flush is as large as
+		 * possible. This gives us some chance of avoiding another fsync
+		 * immediately after.
+		 */
 
-		SpinLockAcquire(&xlogctl->info_lck);
-		if (XLByteLT(WriteRqstPtr, xlogctl->LogwrtRqst.Write))
-			WriteRqstPtr = xlogctl->LogwrtRqst.Write;
-		LogwrtResult = xlogctl->LogwrtResult;
-		SpinLockRelease(&xlogctl->info_lck);
-	}
+		/* initialize to given target; may increase below */
+		WriteRqstPtr = record;
 
-	/* done already? */
-	if (!XLByteLE(record, LogwrtResult.Flush))
-	{
-		/* now wait for the write lock */
-		LWLockAcquire(WALWriteLock, LW_EXCLUSIVE);
-		LogwrtResult = XLogCtl->Write.LogwrtResult;
-		if (!XLByteLE(record, LogwrtResult.Flush))
+		/* read LogwrtResult and update local state */
 		{
-			/* try to write/flush later additions to XLOG as well */
-			if (LWLockConditionalAcquire(WALInsertLock, LW_EXCLUSIVE))
-			{
-				XLogCtlInsert *Insert = &XLogCtl->Insert;
-				uint32		freespace = INSERT_FREESPACE(Insert);
+			/* use volatile pointer to prevent code rearrangement */
+			volatile XLogCtlData *xlogctl = XLogCtl;
 
-				if (freespace < SizeOfXLogRecord)		/* buffer is full */
-					WriteRqstPtr = XLogCtl->xlblocks[Insert->curridx];
-				else
-				{
-					WriteRqstPtr = XLogCtl->xlblocks[Insert->curridx];
-					WriteRqstPtr.xrecoff -= freespace;
-				}
-				LWLockRelease(WALInsertLock);
-				WriteRqst.Write = WriteRqstPtr;
-				WriteRqst.Flush = WriteRqstPtr;
-			}
-			else
-			{
-				WriteRqst.Write = WriteRqstPtr;
-				WriteRqst.Flush = record;
-			}
-			XLogWrite(WriteRqst, false, false);
+			SpinLockAcquire(&xlogctl->info_lck);
+			if (XLByteLT(WriteRqstPtr, xlogctl->LogwrtRqst.Write))
+				WriteRqstPtr = xlogctl->LogwrtRqst.Write;
+			LogwrtResult = xlogctl->LogwrtResult;
+			SpinLockRelease(&xlogctl->info_lck);
+		}
+
+		/* done already? */
+		if (XLByteLE(record, LogwrtResult.Flush))
+			break;
+
+		/*
+		 * Join the current flush group, or lead it if there isn't one.  If we
+		 * were only a follower, the leader has most likely flushed far enough
+		 * for us, but we have to loop back to check.
+		 */
+		if (XLogFlushJoinGroup(WriteRqstPtr))
+		{
+			XLogFlushAsLeader(WriteRqstPtr);
+			break;
 		}
-		LWLockRelease(WALWriteLock);
 	}
 
 	END_CRIT_SECTION();
@@ -2174,7 +3115,8 @@ XLogBackgroundFlush(void)
 
 	START_CRIT_SECTION();
 
-	/* now wait for the write lock */
+	/* now wait for any in-progress insertions to finish and get write lock */
+	WaitXLogInsertionsToFinish(WriteRqstPtr);
 	LWLockAcquire(WALWriteLock, LW_EXCLUSIVE);
 	LogwrtResult = XLogCtl->Write.LogwrtResult;
 	if (!XLByteLE(WriteRqstPtr, LogwrtResult.Flush))
@@ -2183,11 +3125,18 @@ XLogBackgroundFlush(void)
 
 		WriteRqst.Write = WriteRqstPtr;
 		WriteRqst.Flush = WriteRqstPtr;
-		XLogWrite(WriteRqst, flexible, false);
+		XLogWrite(WriteRqst, flexible);
 	}
 	LWLockRelease(WALWriteLock);
 
 	END_CRIT_SECTION();
+
+	/*
+	 * Great, done.  To take some work off the critical path, try to
+	 * initialize as many of the no-longer-needed WAL buffers for future use
+	 * as we can.
+	 */
+	AdvanceXLInsertBuffer(InvalidXLogRecPtr, true);
 }
 
 /*
@@ -4786,6 +5735,9 @@ XLOGShmemSize(void)
 
 	/* XLogCtl */
 	size = sizeof(XLogCtlData);
+	/* xlog insertion slots, plus alignment */
+	size = add_size(size, mul_size(sizeof(XLogInsertSlotPadded),
+								   NUM_XLOGINSERT_SLOTS + 1));
 	/* xlblocks array */
 	size = add_size(size, mul_size(sizeof(XLogRecPtr), XLOGbuffers));
 	/* extra alignment padding for XLOG I/O buffers */
@@ -4808,6 +5760,7 @@ XLOGShmemInit(void)
 	bool		foundCFile,
 				foundXLog;
 	char	   *allocptr;
+	int			i;
 
 	ControlFile = (ControlFileData *)
 		ShmemInitStruct("Control File", sizeof(ControlFileData), &foundCFile);
@@ -4824,11 +5777,26 @@ XLOGShmemInit(void)
 	memset(XLogCtl, 0, sizeof(XLogCtlData));
 
 	/*
-	 * Since XLogCtlData contains XLogRecPtr fields, its sizeof should be a
-	 * multiple of the alignment for same, so no extra alignment padding is
-	 * needed here.
+	 * The insertion slots come first, aligned to a cache line each.  The
+	 * size of the slot array is a multiple of the alignment for XLogRecPtr,
+	 * so no extra alignment padding is needed for xlblocks after it.
 	 */
 	allocptr = ((char *) XLogCtl) + sizeof(XLogCtlData);
+	allocptr = (char *) TYPEALIGN(XLOG_INSERT_SLOT_PADDED_SIZE, allocptr);
+	XLogCtl->Insert.insertSlots = (XLogInsertSlotPadded *) allocptr;
+	allocptr += sizeof(XLogInsertSlotPadded) * NUM_XLOGINSERT_SLOTS;
+
+	for (i = 0; i < NUM_XLOGINSERT_SLOTS; i++)
+	{
+		XLogInsertSlot *slot = &XLogCtl->Insert.insertSlots[i].slot;
+
+		SpinLockInit(&slot->mutex);
+		slot->held = false;
+		slot->xlogInsertingAt = InvalidXLogRecPtr;
+		slot->head = NULL;
+		slot->tail = NULL;
+	}
+
 	XLogCtl->xlblocks = (XLogRecPtr *) allocptr;
 	memset(XLogCtl->xlblocks, 0, sizeof(XLogRecPtr) * XLOGbuffers);
 	allocptr += sizeof(XLogRecPtr) * XLOGbuffers;
@@ -4846,8 +5814,9 @@ XLOGShmemInit(void)
 	 */
 	XLogCtl->XLogCacheBlck = XLOGbuffers - 1;
 	XLogCtl->SharedRecoveryInProgress = true;
-	XLogCtl->Insert.currpage = (XLogPageHeader) (XLogCtl->pages);
+	SpinLockInit(&XLogCtl->Insert.insertpos_lck);
 	SpinLockInit(&XLogCtl->info_lck);
+	SpinLockInit(&XLogCtl->flushqueue_lck);
 	InitSharedLatch(&XLogCtl->recoveryWakeupLatch);
 
 	/*
@@ -5568,7 +6537,7 @@ recoveryStopsHere(XLogRecord *record, bool *includeThis)
  *
  * We keep this in XLogCtl, not a simple static variable, so that it can be
  * seen by processes other than the startup process.  Note in particular
- * that CreateRestartPoint is executed in the bgwriter.
+ * that CreateRestartPoint is executed in the checkpointer.
  */
 static void
 SetLatestXTime(TimestampTz xtime)
@@ -5689,6 +6658,11 @@ void
 StartupXLOG(void)
 {
 	XLogCtlInsert *Insert;
+	XLogRecPtr	pageBeginPtr;
+	XLogRecPtr	pageEndPtr;
+	int			firstIdx;
+	char	   *page;
+	uint32		offset;
 	CheckPoint	checkPoint;
 	bool		wasShutdown;
 	bool		reachedStopPoint = false;
@@ -5699,7 +6673,6 @@ StartupXLOG(void)
 	uint32		endLogId;
 	uint32		endLogSeg;
 	XLogRecord *record;
-	uint32		freespace;
 	TransactionId oldestActiveXID;
 
 	/*
@@ -6119,20 +7092,20 @@ StartupXLOG(void)
 
 		/*
 		 * Let postmaster know we've started redo now, so that it can launch
-		 * bgwriter to perform restartpoints.  We don't bother during crash
+		 * checkpointer to perform restartpoints.  We don't bother during crash
 		 * recovery as restartpoints can only be performed during archive
 		 * recovery.  And we'd like to keep crash recovery simple, to avoid
 		 * introducing bugs that could affect you when recovering after crash.
 		 *
 		 * After this point, we can no longer assume that we're the only
 		 * process in addition to postmaster!  Also, fsync requests are
-		 * subsequently to be handled by the bgwriter, not locally.
+		 * subsequently to be handled by the checkpointer, not locally.
 		 */
 		if (InArchiveRecovery && IsUnderPostmaster)
 		{
 			SetForwardFsyncRequests();
 			SendPostmasterSignal(PMSIGNAL_RECOVERY_STARTED);
-			bgwriterLaunched = true;
+			checkpointerLaunched = true;
 		}
 
 		/*
@@ -6377,49 +7350,38 @@ StartupXLOG(void)
 	openLogOff = 0;
 	Insert = &XLogCtl->Insert;
 	Insert->PrevRecord = LastRec;
-	XLogCtl->xlblocks[0].xlogid = openLogId;
-	XLogCtl->xlblocks[0].xrecoff =
-		((EndOfLog.xrecoff - 1) / XLOG_BLCKSZ + 1) * XLOG_BLCKSZ;
+	Insert->CurrPos = EndOfLog;
 
 	/*
 	 * Tricky point here: readBuf contains the *last* block that the LastRec
 	 * record spans, not the one it starts in.	The last block is indeed the
 	 * one we want to use.
 	 */
-	Assert(readOff == (XLogCtl->xlblocks[0].xrecoff - XLOG_BLCKSZ) % XLogSegSize);
-	memcpy((char *) Insert->currpage, readBuf, XLOG_BLCKSZ);
-	Insert->currpos = (char *) Insert->currpage +
-		(EndOfLog.xrecoff + XLOG_BLCKSZ - XLogCtl->xlblocks[0].xrecoff);
+	pageEndPtr.xlogid = EndOfLog.xlogid;
+	pageEndPtr.xrecoff = ((EndOfLog.xrecoff - 1) / XLOG_BLCKSZ + 1) * XLOG_BLCKSZ;
+	pageBeginPtr = pageEndPtr;
+	pageBeginPtr.xrecoff -= XLOG_BLCKSZ;
+	Assert(readOff == pageBeginPtr.xrecoff % XLogSegSize);
+
+	firstIdx = XLogRecPtrToBufIdx(pageBeginPtr);
+	page = XLogCtl->pages + firstIdx * (Size) XLOG_BLCKSZ;
+	memcpy(page, readBuf, XLOG_BLCKSZ);
+
+	/* Make sure rest of page is zero */
+	offset = EndOfLog.xrecoff - pageBeginPtr.xrecoff;
+	MemSet(page + offset, 0, XLOG_BLCKSZ - offset);
+
+	XLogCtl->xlblocks[firstIdx] = pageEndPtr;
+	XLogCtl->InitializedUpTo = pageEndPtr;
 
 	LogwrtResult.Write = LogwrtResult.Flush = EndOfLog;
 
 	XLogCtl->Write.LogwrtResult = LogwrtResult;
-	Insert->LogwrtResult = LogwrtResult;
 	XLogCtl->LogwrtResult = LogwrtResult;
 
 	XLogCtl->LogwrtRqst.Write = EndOfLog;
 	XLogCtl->LogwrtRqst.Flush = EndOfLog;
 
-	freespace = INSERT_FREESPACE(Insert);
-	if (freespace > 0)
-	{
-		/* Make sure rest of page is zero */
-		MemSet(Insert->currpos, 0, freespace);
-		XLogCtl->Write.curridx = 0;
-	}
-	else
-	{
-		/*
-		 * Whenever Write.LogwrtResult points to exactly the end of a page,
-		 * Write.curridx must point to the *next* page (see XLogWrite()).
-		 *
-		 * Note: it might seem we should do AdvanceXLInsertBuffer() here, but
-		 * this is sufficient.	The first actual attempt to insert a log
-		 * record will advance the insert state.
-		 */
-		XLogCtl->Write.curridx = NextBufIdx(0);
-	}
-
 	/* Pre-scan prepared transactions to find out the range of XIDs present */
 	oldestActiveXID = PrescanPreparedTransactions(NULL, NULL);
 
@@ -6461,7 +7423,7 @@ StartupXLOG(void)
 		 * the rule that TLI only changes in shutdown checkpoints, which
 		 * allows some extra error checking in xlog_redo.
 		 */
-		if (bgwriterLaunched)
+		if (checkpointerLaunched)
 			RequestCheckpoint(CHECKPOINT_END_OF_RECOVERY |
 							  CHECKPOINT_IMMEDIATE |
 							  CHECKPOINT_WAIT);
@@ -6831,7 +7793,7 @@ InitXLOGAccess(void)
 
 /*
  * Once spawned, a backend may update its local RedoRecPtr from
- * XLogCtl->Insert.RedoRecPtr; it must hold the insert lock or info_lck
+ * XLogCtl->Insert.RedoRecPtr; it must hold an insertion slot or info_lck
  * to do so.  This is done in XLogInsert() or GetRedoRecPtr().
  */
 XLogRecPtr
@@ -6853,9 +7815,9 @@ GetRedoRecPtr(void)
  *
  * NOTE: The value *actually* returned is the position of the last full
  * xlog page. It lags behind the real insert position by at most 1 page.
- * For that, we don't need to acquire WALInsertLock which can be quite
- * heavily contended, and an approximation is enough for the current
- * usage of this function.
+ * That way, we don't need to take insertpos_lck, which is heavily
+ * contended, and an approximation is enough for the current usage of
+ * this function.
  */
 XLogRecPtr
 GetInsertRecPtr(void)
@@ -7087,7 +8049,7 @@ CreateCheckPoint(int flags)
 	XLogRecPtr	recptr;
 	XLogCtlInsert *Insert = &XLogCtl->Insert;
 	XLogRecData rdata;
-	uint32		freespace;
+	XLogRecPtr	curInsert;
 	uint32		_logId;
 	uint32		_logSeg;
 	TransactionId *inCommitXids;
@@ -7150,10 +8112,13 @@ CreateCheckPoint(int flags)
 	checkPoint.time = (pg_time_t) time(NULL);
 
 	/*
-	 * We must hold WALInsertLock while examining insert state to determine
-	 * the checkpoint REDO pointer.
+	 * We must block concurrent insertions while examining insert state to
+	 * determine the checkpoint REDO pointer.
 	 */
-	LWLockAcquire(WALInsertLock, LW_EXCLUSIVE);
+	WALInsertSlotAcquire(true);
+	SpinLockAcquire(&Insert->insertpos_lck);
+	curInsert = Insert->CurrPos;
+	SpinLockRelease(&Insert->insertpos_lck);
 
 	/*
 	 * If this isn't a shutdown or forced checkpoint, and we have not inserted
@@ -7173,9 +8138,6 @@ CreateCheckPoint(int flags)
 	if ((flags & (CHECKPOINT_IS_SHUTDOWN | CHECKPOINT_END_OF_RECOVERY |
 				  CHECKPOINT_FORCE)) == 0)
 	{
-		XLogRecPtr	curInsert;
-
-		INSERT_RECPTR(curInsert, Insert, Insert->curridx);
 		if (curInsert.xlogid == ControlFile->checkPoint.xlogid &&
 			curInsert.xrecoff == ControlFile->checkPoint.xrecoff +
 			MAXALIGN(SizeOfXLogRecord + sizeof(CheckPoint)) &&
@@ -7184,7 +8146,7 @@ CreateCheckPoint(int flags)
 			ControlFile->checkPoint.xrecoff ==
 			ControlFile->checkPointCopy.redo.xrecoff)
 		{
-			LWLockRelease(WALInsertLock);
+			WALInsertSlotRelease();
 			LWLockRelease(CheckpointLock);
 			END_CRIT_SECTION();
 			return;
@@ -7210,18 +8172,11 @@ CreateCheckPoint(int flags)
 	 * the buffer flush work.  Those XLOG records are logically after the
 	 * checkpoint, even though physically before it.  Got that?
 	 */
-	freespace = INSERT_FREESPACE(Insert);
-	if (freespace < SizeOfXLogRecord)
-	{
-		(void) AdvanceXLInsertBuffer(false);
-		/* OK to ignore update return flag, since we will do flush anyway */
-		freespace = INSERT_FREESPACE(Insert);
-	}
-	INSERT_RECPTR(checkPoint.redo, Insert, Insert->curridx);
+	checkPoint.redo = XLogRecordStartPos(curInsert);
 
 	/*
 	 * Here we update the shared RedoRecPtr for future XLogInsert calls; this
-	 * must be done while holding the insert lock AND the info_lck.
+	 * must be done while holding all the insertion slots AND the info_lck.
 	 *
 	 * Note: if we fail to complete the checkpoint, RedoRecPtr will be left
 	 * pointing past where it really needs to point.  This is okay; the only
@@ -7240,10 +8195,10 @@ CreateCheckPoint(int flags)
 	}
 
 	/*
-	 * Now we can release WAL insert lock, allowing other xacts to proceed
-	 * while we are flushing disk buffers.
+	 * Now we can release the WAL insertion slots, allowing other xacts to
+	 * proceed while we are flushing disk buffers.
 	 */
-	LWLockRelease(WALInsertLock);
+	WALInsertSlotRelease();
 
 	/*
 	 * If enabled, log checkpoint start.  We postpone this until now so as not
@@ -7263,10 +8218,11 @@ CreateCheckPoint(int flags)
 	 * we wait till he's out of his commit critical section before proceeding.
 	 * See notes in RecordTransactionCommit().
 	 *
-	 * Because we've already released WALInsertLock, this test is a bit fuzzy:
-	 * it is possible that we will wait for xacts we didn't really need to
-	 * wait for.  But the delay should be short and it seems better to make
-	 * checkpoint take a bit longer than to hold locks longer than necessary.
+	 * Because we've already released the insertion slots, this test is a
+	 * bit fuzzy: it is possible that we will wait for xacts we didn't really
+	 * need to wait for.  But the delay should be short and it seems better to
+	 * make checkpoint take a bit longer than to hold locks longer than
+	 * necessary.
 	 * (In fact, the whole reason we have this issue is that xact.c does
 	 * commit record XLOG insertion and clog update as two separate steps
 	 * protected by different locks, but again that seems best on grounds of
@@ -7527,7 +8483,7 @@ CheckPointGuts(XLogRecPtr checkPointRedo, int flags)
  * It must determine whether the checkpoint represents a safe restartpoint or
  * not.  If so, the checkpoint record is stashed in shared memory so that
  * CreateRestartPoint can consult it.  (Note that the latter function is
- * executed by the bgwriter, while this one will be executed by the startup
+ * executed by the checkpointer, while this one will be executed by the startup
  * process.)
  */
 static void
@@ -7558,8 +8514,8 @@ RecoveryRestartPoint(const CheckPoint *checkPoint)
 	}
 
 	/*
-	 * Copy the checkpoint record to shared memory, so that bgwriter can use
-	 * it the next time it wants to perform a restartpoint.
+	 * Copy the checkpoint record to shared memory, so that checkpointer can
+	 * use it the next time it wants to perform a restartpoint.
 	 */
 	SpinLockAcquire(&xlogctl->info_lck);
 	XLogCtl->lastCheckPointRecPtr = ReadRecPtr;
@@ -7655,15 +8611,15 @@ CreateRestartPoint(int flags)
 	 * the number of segments replayed since last restartpoint, and request a
 	 * restartpoint if it exceeds checkpoint_segments.
 	 *
-	 * You need to hold WALInsertLock and info_lck to update it, although
-	 * during recovery acquiring WALInsertLock is just pro forma, because
-	 * there is no other processes updating Insert.RedoRecPtr.
+	 * You need to hold all the WAL insertion slots and info_lck to update
+	 * it, although during recovery acquiring the slots is just pro forma,
+	 * because there is no other processes updating Insert.RedoRecPtr.
 	 */
-	LWLockAcquire(WALInsertLock, LW_EXCLUSIVE);
+	WALInsertSlotAcquire(true);
 	SpinLockAcquire(&xlogctl->info_lck);
 	xlogctl->Insert.RedoRecPtr = lastCheckPoint.redo;
 	SpinLockRelease(&xlogctl->info_lck);
-	LWLockRelease(WALInsertLock);
+	WALInsertSlotRelease();
 
 	if (log_checkpoints)
 	{
@@ -8374,20 +9330,20 @@ pg_start_backup(PG_FUNCTION_ARGS)
 	 * since we expect that any pages not modified during the backup interval
 	 * must have been correctly captured by the backup.)
 	 *
-	 * We must hold WALInsertLock to change the value of forcePageWrites, to
-	 * ensure adequate interlocking against XLogInsert().
+	 * We must hold all the insertion slots to change the value of
+	 * forcePageWrites, to ensure adequate interlocking against XLogInsert().
 	 */
-	LWLockAcquire(WALInsertLock, LW_EXCLUSIVE);
+	WALInsertSlotAcquire(true);
 	if (XLogCtl->Insert.forcePageWrites)
 	{
-		LWLockRelease(WALInsertLock);
+		WALInsertSlotRelease();
 		ereport(ERROR,
 				(errcode(ERRCODE_OBJECT_NOT_IN_PREREQUISITE_STATE),
 				 errmsg("a backup is already in progress"),
 				 errhint("Run pg_stop_backup() and try again.")));
 	}
 	XLogCtl->Insert.forcePageWrites = true;
-	LWLockRelease(WALInsertLock);
+	WALInsertSlotRelease();
 
 	/*
 	 * Force an XLOG file switch before the checkpoint, to ensure that the WAL
@@ -8492,9 +9448,9 @@ static void
 pg_start_backup_callback(int code, Datum arg)
 {
 	/* Turn off forcePageWrites on failure */
-	LWLockAcquire(WALInsertLock, LW_EXCLUSIVE);
+	WALInsertSlotAcquire(true);
 	XLogCtl->Insert.forcePageWrites = false;
-	LWLockRelease(WALInsertLock);
+	WALInsertSlotRelease();
 }
 
 /*
@@ -8553,9 +9509,9 @@ pg_stop_backup(PG_FUNCTION_ARGS)
 	/*
 	 * OK to clear forcePageWrites
 	 */
-	LWLockAcquire(WALInsertLock, LW_EXCLUSIVE);
+	WALInsertSlotAcquire(true);
 	XLogCtl->Insert.forcePageWrites = false;
-	LWLockRelease(WALInsertLock);
+	WALInsertSlotRelease();
 
 	/*
 	 * Open the existing label file
@@ -8798,7 +9754,8 @@ pg_current_xlog_location(PG_FUNCTION_ARGS)
 Datum
 pg_current_xlog_insert_location(PG_FUNCTION_ARGS)
 {
-	XLogCtlInsert *Insert = &XLogCtl->Insert;
+	/* use volatile pointer to prevent code rearrangement */
+	volatile XLogCtlInsert *Insert = &XLogCtl->Insert;
 	XLogRecPtr	current_recptr;
 	char		location[MAXFNAMELEN];
 
@@ -8809,11 +9766,11 @@ pg_current_xlog_insert_location(PG_FUNCTION_ARGS)
 				 errhint("WAL control functions cannot be executed during recovery.")));
 
 	/*
-	 * Get the current end-of-WAL position ... shared lock is sufficient
+	 * Get the current end-of-WAL position
 	 */
-	LWLockAcquire(WALInsertLock, LW_SHARED);
-	INSERT_RECPTR(current_recptr, Insert, Insert->curridx);
-	LWLockRelease(WALInsertLock);
+	SpinLockAcquire(&Insert->insertpos_lck);
+	current_recptr = Insert->CurrPos;
+	SpinLockRelease(&Insert->insertpos_lck);
 
 	snprintf(location, sizeof(location), "%X/%X",
 			 current_recptr.xlogid, current_recptr.xrecoff);
@@ -9318,10 +10275,10 @@ XLogPageRead(XLogRecPtr *RecPtr, int emode, bool fetching_ckpt,
 	if (readFile >= 0 && !XLByteInSeg(*RecPtr, readId, readSeg))
 	{
 		/*
-		 * Signal bgwriter to start a restartpoint if we've replayed too much
-		 * xlog since the last one.
+		 * Signal checkpointer to start a restartpoint if we've replayed too
+		 * much xlog since the last one.
 		 */
-		if (StandbyMode && bgwriterLaunched)
+		if (StandbyMode && checkpointerLaunched)
 		{
 			if (XLogCheckpointNeeded(readId, readSeg))
 			{
@@ -0,0 +1,752 @@
+/* Generated by pyflex from bootscanner.l; do not edit. */
+#define FLEX_SCANNER
+#define YY_FLEX_MAJOR_VERSION 2
+#define YY_FLEX_MINOR_VERSION 5
+#define YY_FLEX_SUBMINOR_VERSION 35
+#define yy_create_buffer boot_yy_create_buffer
+#define yy_delete_buffer boot_yy_delete_buffer
+#define yy_scan_buffer boot_yy_scan_buffer
+#define yy_scan_string boot_yy_scan_string
+#define yy_scan_bytes boot_yy_scan_bytes
+#define yy_switch_to_buffer boot_yy_switch_to_buffer
+#define yylex boot_yylex
+#define yyalloc boot_yyalloc
+#define yyrealloc boot_yyrealloc
+#define yyfree boot_yyfree
+#define yyrestart boot_yyrestart
+#define yytext boot_yytext
+#define yyleng boot_yyleng
+#define yyin boot_yyin
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+typedef size_t yy_size_t;
+#ifndef YY_TYPEDEF_YY_BUFFER_STATE
+#define YY_TYPEDEF_YY_BUFFER_STATE
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+#endif
+#define YY_END_OF_BUFFER_CHAR 0
+#define YY_BUF_SIZE 16384
+#define YY_NULL 0
+#define YY_EXIT_FAILURE 2
+#define INITIAL 0
+extern char *yytext;
+extern int yyleng;
+
+/*-------------------------------------------------------------------------
+ *
+ * bootscanner.l
+ *	  a lexical scanner for the bootstrap parser
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL: pgsql/src/backend/bootstrap/bootscanner.l,v 1.50 2009/09/27 01:32:11 tgl Exp $
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/attnum.h"
+#include "access/htup.h"
+#include "access/itup.h"
+#include "access/skey.h"
+#include "access/tupdesc.h"
+#include "bootstrap/bootstrap.h"
+#include "catalog/pg_am.h"
+#include "catalog/pg_attribute.h"
+#include "catalog/pg_class.h"
+#include "nodes/nodes.h"
+#include "nodes/parsenodes.h"
+#include "nodes/pg_list.h"
+#include "nodes/primnodes.h"
+#include "parser/scansup.h"
+#include "rewrite/prs2lock.h"
+#include "storage/block.h"
+#include "storage/fd.h"
+#include "storage/itemptr.h"
+#include "storage/off.h"
+#include "utils/rel.h"
+
+/* Not needed now that this file is compiled as part of bootparse. */
+/* #include "bootparse.h" */
+
+
+/* Avoid exit() on fatal scanner errors (a bit ugly -- see yy_fatal_error) */
+#undef fprintf
+#define fprintf(file, fmt, msg)  ereport(ERROR, (errmsg_internal("%s", msg)))
+
+
+static int	yyline = 1;			/* line number for error reporting */
+
+
+#ifndef YY_EXTRA_TYPE
+#define YY_EXTRA_TYPE void *
+#endif
+struct yy_buffer_state
+{
+	char *base;
+	char *end;
+	char *pos;
+	int at_bol;
+	int owns;
+};
+struct yyguts_t
+{
+	YY_EXTRA_TYPE yyextra_r;
+	YY_BUFFER_STATE cur;
+	char *c_buf_p;
+	char hold_char;
+	int at_bol;
+	int yy_start;
+	char *yytext_r;
+	int yyleng_r;
+};
+char *yytext;
+int yyleng;
+FILE *yyin;
+static struct yyguts_t yy_guts_static;
+#define yyg (&yy_guts_static)
+#define BEGIN (yyg->yy_start) =
+#define YY_START (yyg->yy_start)
+#define YYSTATE YY_START
+#define YY_CURRENT_BUFFER (yyg->cur)
+#define yyterminate() return YY_NULL
+#define YY_FATAL_ERROR(msg) yy_fatal_error(msg)
+#define yyless(n) do { int yyless_n = (n); *yyg->c_buf_p = yyg->hold_char; yyg->c_buf_p = yytext + yyless_n; yyleng = yyless_n; yyg->hold_char = *yyg->c_buf_p; *yyg->c_buf_p = 0; } while (0)
+#ifndef ECHO
+#define ECHO do { if (fwrite(yytext, yyleng, 1, stdout)) {} } while (0)
+#endif
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+#define YY_BREAK break;
+#define YY_RULE_SETUP if (yyleng > 0) yyg->at_bol = (yytext[yyleng - 1] == '\n'); YY_USER_ACTION
+void *yyalloc(yy_size_t);
+void *yyrealloc(void *, yy_size_t);
+void yyfree(void *);
+YY_BUFFER_STATE yy_create_buffer(FILE *file, int size);
+void yy_delete_buffer(YY_BUFFER_STATE b);
+void yy_switch_to_buffer(YY_BUFFER_STATE b);
+YY_BUFFER_STATE yy_scan_buffer(char *base, yy_size_t size);
+YY_BUFFER_STATE yy_scan_bytes(const char *bytes, int len);
+YY_BUFFER_STATE yy_scan_string(const char *str);
+void yyrestart(FILE *file);
+int yylex(void);
+static void yy_fatal_error(const char *msg);
+static const unsigned char yy_ec[256] = {0,0,0,0,0,0,0,0,0,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,4,5,0,0,0,0,6,7,0,8,9,10,11,0,12,12,12,12,12,12,12,12,12,12,0,0,0,13,0,0,0,14,14,14,15,16,14,14,14,17,14,14,14,14,14,18,14,14,14,14,14,14,14,14,14,14,14,19,20,21,0,22,0,23,24,25,26,27,14,28,29,30,14,14,31,14,32,33,34,35,36,37,38,39,14,40,41,42,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+#define YY_NCLASSES 43
+static const short yy_nxt[7009] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,28,25,24,26,23,28,21,22,28,18,20,27,5,19,6,6,6,
+6,7,28,17,28,4,6,8,9,10,6,6,6,11,6,6,3,6,6,12,13,14,15,16,6,6,28,25,24,26,
+23,29,21,22,28,18,20,27,5,19,6,6,6,6,7,28,17,28,4,6,8,9,10,6,6,6,11,6,6,3,
+6,6,12,13,14,15,16,6,6,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,
+0,31,31,31,31,31,31,31,31,31,31,32,31,30,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,
+0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,36,31,31,31,31,31,
+31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,39,37,0,31,31,38,31,31,33,34,0,31,31,31,
+31,31,38,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,
+31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,40,31,33,34,0,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,
+31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,41,31,31,31,31,31,42,31,31,31,0,0,0,
+0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,43,31,
+31,31,31,44,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,
+34,0,31,31,31,31,31,45,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,
+0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,46,31,31,31,31,
+31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,
+31,31,31,31,31,31,31,31,31,47,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,
+0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,48,31,31,31,31,31,31,31,31,31,31,31,
+31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,
+31,31,31,31,31,49,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,
+31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,50,31,31,31,31,51,31,31,31,31,31,0,0,
+0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,52,31,
+31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+35,55,54,0,56,56,56,56,56,0,34,0,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,
+56,56,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,
+57,57,57,58,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,
+57,57,57,57,57,57,57,57,57,57,57,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,60,0,60,60,60,60,60,60,60,60,60,60,
+60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,61,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,
+31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,
+0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,0,
+63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,56,0,56,56,56,56,56,0,34,0,56,56,56,
+56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,0,0,0,0,0,0,0,0,0,0,35,0,
+31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,64,31,31,
+31,0,0,0,0,0,0,0,0,0,0,35,39,37,0,31,31,38,31,31,33,34,0,31,31,31,31,31,38,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,67,0,66,0,65,0,31,31,
+31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,
+0,0,0,0,0,0,0,0,0,68,0,0,0,69,0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,70,31,31,31,33,
+34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,
+0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,71,31,31,31,
+31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,
+31,31,31,31,31,31,72,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,
+0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,73,31,31,31,31,31,31,31,
+31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,74,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,
+31,31,31,31,33,34,0,31,31,31,75,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,
+0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,76,31,31,31,31,31,
+31,31,31,31,31,77,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,
+33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,78,31,31,0,0,0,0,0,0,
+0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,79,31,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,
+80,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,
+35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,81,31,31,31,31,31,31,31,31,31,
+31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,
+31,31,31,82,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,
+31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,83,31,31,31,31,0,
+0,0,0,0,0,0,0,0,0,0,0,84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,39,54,0,56,56,85,56,
+56,0,34,0,56,56,56,56,56,85,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,0,0,0,0,0,
+0,0,0,0,0,0,0,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,56,0,56,56,56,56,56,0,34,0,
+56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,57,57,57,57,58,57,57,57,57,
+57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,
+57,57,57,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,59,
+0,0,0,86,0,0,0,0,0,0,0,0,0,0,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+60,60,0,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+60,60,60,60,60,60,60,60,60,60,60,60,60,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,
+31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,87,31,31,31,31,31,31,31,31,31,31,0,0,0,0,
+0,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,88,31,31,31,31,31,31,
+31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,65,0,31,31,31,31,31,33,34,0,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,
+89,0,56,56,56,56,56,0,34,0,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,
+56,0,0,0,0,0,0,0,0,0,0,0,0,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,0,
+91,0,0,0,0,0,0,0,0,0,0,91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,92,0,92,0,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,
+34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,
+0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,94,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,
+31,31,31,31,31,31,31,95,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,
+0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,96,31,31,31,
+31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,97,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,
+31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,98,31,31,31,31,31,31,31,31,31,31,31,0,0,
+0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,99,31,31,100,31,
+31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,
+33,34,0,31,31,31,31,31,101,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,
+0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,31,102,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,103,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,
+35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,104,31,31,
+31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,
+31,31,31,31,31,31,31,31,105,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,
+31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,106,31,31,31,31,31,31,31,31,31,31,0,
+0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,107,31,
+31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,0,0,108,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,67,0,66,0,89,0,56,56,56,56,56,0,34,0,56,56,56,56,56,56,56,56,56,56,56,56,56,
+56,56,56,56,56,56,56,56,0,0,0,0,0,0,0,0,109,0,109,0,110,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,
+31,31,31,31,31,111,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,89,
+0,56,56,56,56,56,0,34,0,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,
+0,0,0,0,0,0,0,0,0,0,0,0,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,0,112,0,113,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,93,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,114,
+31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,
+31,115,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,
+31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,116,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,31,117,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,
+31,31,31,33,34,0,31,118,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,
+0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,119,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,
+34,0,31,31,31,120,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,
+0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,121,
+31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,122,0,0,0,0,0,0,0,0,0,0,35,
+0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,123,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,124,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,
+31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,125,31,31,31,0,0,
+0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,126,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,
+33,34,0,31,31,31,31,31,31,31,31,31,31,31,127,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,
+0,0,0,0,35,0,56,0,56,56,56,56,56,0,34,0,56,56,56,56,56,56,56,56,56,56,56,56,56,56,
+56,56,56,56,56,56,56,0,0,0,0,0,0,0,0,0,0,0,0,110,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,128,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,0,0,113,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,
+31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,129,31,31,31,31,0,0,0,0,0,
+0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,
+0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,130,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,131,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,
+0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,132,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,
+31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,133,31,31,31,31,0,0,0,0,
+0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,
+134,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,
+0,31,31,31,31,135,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,
+0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,
+31,31,136,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,
+31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,137,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,
+31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,
+0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,138,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,
+34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,
+0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,139,31,31,31,31,31,31,31,31,31,
+31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,140,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,
+0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,141,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,
+31,31,31,31,33,34,0,142,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,
+0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,
+33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,143,31,31,31,31,0,0,0,0,0,0,
+0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,144,31,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,
+35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,145,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,
+31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,146,31,31,31,31,31,31,0,
+0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,147,31,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,
+31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,148,31,31,31,31,31,31,31,31,0,0,0,0,0,
+0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,149,31,
+31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,
+31,31,31,31,31,150,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,
+0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,151,31,31,31,31,31,
+31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,
+0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,152,31,31,31,31,31,31,31,31,31,31,31,31,
+0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,
+31,153,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,
+31,31,33,34,0,31,31,31,31,31,31,31,31,154,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,
+0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,155,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,
+0,31,156,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,
+0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,157,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,
+31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,158,31,31,31,
+31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,159,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,
+31,31,31,33,34,0,31,31,31,31,31,31,31,31,160,31,31,31,31,31,31,31,31,31,31,31,31,0,0,0,
+0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,
+34,0,31,31,31,31,31,31,31,31,31,31,31,161,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,
+0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,31,31,31,31,31,31,31,31,162,31,31,31,31,
+31,31,31,31,31,31,0,0,0,0,0,0,0,0,0,0,35,0,31,0,31,31,31,31,31,33,34,0,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+};
+static const short yy_acc[163] = {0,0,0,28,28,28,28,28,28,28,28,28,28,28,28,28,28,33,11,12,28,13,14,33,15,16,17,33,33,18,28,28,24,0,0,28,28,28,28,30,28,28,28,28,28,28,28,28,28,28,28,28,28,0,28,0,28,0,29,31,18,28,0,27,28,28,28,0,30,0,4,28,28,28,28,28,28,28,28,28,28,28,28,28,0,28,0,1,28,28,32,0,0,30,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,0,31,28,0,30,28,20,2,28,28,23,28,28,28,28,26,28,25,28,9,28,3,28,28,10,28,28,22,28,28,19,21,28,28,28,28,28,28,28,5,28,28,28,28,28,28,8,28,28,28,7,28,28,6};
+static const short yy_starts[2] = {1,2};
+int yylex(void)
+{
+	char *yy_cp, *yy_bp, *yy_end, *yy_last;
+	int yy_state, yy_rule;
+	if (yyg->cur == NULL)
+		yy_switch_to_buffer(yy_create_buffer(yyin ? yyin : stdin, YY_BUF_SIZE));
+	for (;;)
+	{
+		*yyg->c_buf_p = yyg->hold_char;
+		yy_cp = yy_bp = yyg->c_buf_p;
+		yy_end = yyg->cur->end;
+		if (yy_cp >= yy_end)
+		{
+			yytext = yy_cp;
+			yyleng = 0;
+			switch (YY_START)
+			{
+				default:
+					yyterminate();
+			}
+			continue;
+		}
+		yy_state = yy_starts[YY_START * 2 + (yyg->at_bol ? 1 : 0)];
+		yy_rule = 0;
+		yy_last = yy_cp;
+		while (yy_cp < yy_end)
+		{
+			yy_state = yy_nxt[yy_state * YY_NCLASSES + yy_ec[(unsigned char) *yy_cp]];
+			if (yy_state == 0)
+				break;
+			yy_cp++;
+			if (yy_acc[yy_state])
+			{
+				yy_rule = yy_acc[yy_state];
+				yy_last = yy_cp;
+			}
+		}
+		if (yy_rule == 0)
+			YY_FATAL_ERROR("flex scanner jammed");
+		yy_cp = yy_last;
+		yytext = yy_bp;
+		yyleng = (int) (yy_cp - yy_bp);
+		yyg->hold_char = *yy_cp;
+		*yy_cp = 0;
+		yyg->c_buf_p = yy_cp;
+		switch (yy_rule)
+		{
+case 1:
+YY_RULE_SETUP
+{
+{ return(OPEN); }
+}
+	YY_BREAK
+case 2:
+YY_RULE_SETUP
+{
+{ return(XCLOSE); }
+}
+	YY_BREAK
+case 3:
+YY_RULE_SETUP
+{
+{ return(XCREATE); }
+}
+	YY_BREAK
+case 4:
+YY_RULE_SETUP
+{
+{ return(OBJ_ID); }
+}
+	YY_BREAK
+case 5:
+YY_RULE_SETUP
+{
+{ return(XBOOTSTRAP); }
+}
+	YY_BREAK
+case 6:
+YY_RULE_SETUP
+{
+{ return(XSHARED_RELATION); }
+}
+	YY_BREAK
+case 7:
+YY_RULE_SETUP
+{
+{ return(XWITHOUT_OIDS); }
+}
+	YY_BREAK
+case 8:
+YY_RULE_SETUP
+{
+{ return(XROWTYPE_OID); }
+}
+	YY_BREAK
+case 9:
+YY_RULE_SETUP
+{
+{ return(NULLVAL); }
+}
+	YY_BREAK
+case 10:
+YY_RULE_SETUP
+{
+{ return(INSERT_TUPLE); }
+}
+	YY_BREAK
+case 11:
+YY_RULE_SETUP
+{
+{ return(COMMA); }
+}
+	YY_BREAK
+case 12:
+YY_RULE_SETUP
+{
+{ return(EQUALS); }
+}
+	YY_BREAK
+case 13:
+YY_RULE_SETUP
+{
+{ return(LPAREN); }
+}
+	YY_BREAK
+case 14:
+YY_RULE_SETUP
+{
+{ return(RPAREN); }
+}
+	YY_BREAK
+case 15:
+YY_RULE_SETUP
+{
+{ yyline++; }
+}
+	YY_BREAK
+case 16:
+YY_RULE_SETUP
+{
+;
+}
+	YY_BREAK
+case 17:
+YY_RULE_SETUP
+{
+;
+}
+	YY_BREAK
+case 18:
+YY_RULE_SETUP
+{
+; /* drop everything after "#" for comments */
+}
+	YY_BREAK
+case 19:
+YY_RULE_SETUP
+{
+{ return(XDECLARE); }
+}
+	YY_BREAK
+case 20:
+YY_RULE_SETUP
+{
+{ return(XBUILD); }
+}
+	YY_BREAK
+case 21:
+YY_RULE_SETUP
+{
+{ return(INDICES); }
+}
+	YY_BREAK
+case 22:
+YY_RULE_SETUP
+{
+{ return(UNIQUE); }
+}
+	YY_BREAK
+case 23:
+YY_RULE_SETUP
+{
+{ return(INDEX); }
+}
+	YY_BREAK
+case 24:
+YY_RULE_SETUP
+{
+{ return(ON); }
+}
+	YY_BREAK
+case 25:
+YY_RULE_SETUP
+{
+{ return(USING); }
+}
+	YY_BREAK
+case 26:
+YY_RULE_SETUP
+{
+{ return(XTOAST); }
+}
+	YY_BREAK
+case 27:
+YY_RULE_SETUP
+{
+{
+					yylval.str = pstrdup(MapArrayTypeName(yytext));
+					return(ID);
+				}
+}
+	YY_BREAK
+case 28:
+YY_RULE_SETUP
+{
+{
+					yylval.str = scanstr(yytext);
+					return(ID);
+				}
+}
+	YY_BREAK
+case 29:
+YY_RULE_SETUP
+{
+{
+					yytext[strlen(yytext)-1] = '\0'; /* strip off quotes */
+					yylval.str = scanstr(yytext+1);
+					yytext[strlen(yytext)] = '"'; /* restore quotes */
+					return(ID);
+				}
+}
+	YY_BREAK
+case 30:
+case 31:
+case 32:
+YY_RULE_SETUP
+{
+{
+							yylval.str = pstrdup(yytext);
+							return(CONST_P);
+						}
+}
+	YY_BREAK
+case 33:
+YY_RULE_SETUP
+{
+{
+					elog(ERROR, "syntax error at line %d: unexpected character \"%s\"", yyline, yytext);
+				}
+}
+	YY_BREAK
+			default:
+				YY_FATAL_ERROR("bad rule");
+		}
+	}
+}
+static void yy_fatal_error(const char *msg)
+{
+	(void) fprintf(stderr, "%s\n", msg);
+	exit(YY_EXIT_FAILURE);
+}
+static void yy_save_state(struct yyguts_t *g)
+{
+	if (g->cur)
+	{
+		*g->c_buf_p = g->hold_char;
+		g->cur->pos = g->c_buf_p;
+		g->cur->at_bol = g->at_bol;
+	}
+}
+void yy_switch_to_buffer(YY_BUFFER_STATE b)
+{
+	yy_save_state(yyg);
+	yyg->cur = b;
+	if (b)
+	{
+		yyg->c_buf_p = b->pos;
+		yyg->hold_char = *b->pos;
+		yyg->at_bol = b->at_bol;
+	}
+}
+static YY_BUFFER_STATE yy_new_buffer(char *base, yy_size_t len, int owns)
+{
+	YY_BUFFER_STATE b = (YY_BUFFER_STATE) yyalloc(sizeof(struct yy_buffer_state));
+	if (!b)
+		YY_FATAL_ERROR("out of dynamic memory");
+	b->base = base;
+	b->end = base + len;
+	b->pos = base;
+	b->at_bol = 1;
+	b->owns = owns;
+	return b;
+}
+YY_BUFFER_STATE yy_scan_buffer(char *base, yy_size_t size)
+{
+	YY_BUFFER_STATE b;
+	if (size < 2 || base[size - 2] != YY_END_OF_BUFFER_CHAR || base[size - 1] != YY_END_OF_BUFFER_CHAR)
+		return NULL;
+	b = yy_new_buffer(base, size - 2, 0);
+	yy_switch_to_buffer(b);
+	return b;
+}
+YY_BUFFER_STATE yy_scan_bytes(const char *bytes, int len)
+{
+	char *buf = (char *) yyalloc(len + 2);
+	YY_BUFFER_STATE b;
+	if (!buf)
+		YY_FATAL_ERROR("out of dynamic memory");
+	memcpy(buf, bytes, len);
+	buf[len] = buf[len + 1] = YY_END_OF_BUFFER_CHAR;
+	b = yy_scan_buffer(buf, len + 2);
+	b->owns = 1;
+	return b;
+}
+YY_BUFFER_STATE yy_scan_string(const char *str)
+{
+	return yy_scan_bytes(str, (int) strlen(str));
+}
+YY_BUFFER_STATE yy_create_buffer(FILE *file, int size)
+{
+	yy_size_t cap = 8192, len = 0, n;
+	char *buf = (char *) yyalloc(cap);
+	(void) size;
+	if (!buf)
+		YY_FATAL_ERROR("out of dynamic memory");
+	while ((n = fread(buf + len, 1, cap - len - 2, file)) > 0)
+	{
+		len += n;
+		if (cap - len - 2 == 0)
+		{
+			cap *= 2;
+			buf = (char *) yyrealloc(buf, cap);
+			if (!buf)
+				YY_FATAL_ERROR("out of dynamic memory");
+		}
+	}
+	buf[len] = buf[len + 1] = YY_END_OF_BUFFER_CHAR;
+	return yy_new_buffer(buf, len, 1);
+}
+void yyrestart(FILE *file)
+{
+	yy_switch_to_buffer(yy_create_buffer(file, YY_BUF_SIZE));
+}
+void yy_delete_buffer(YY_BUFFER_STATE b)
+{
+	if (!b)
+		return;
+	if (b == yyg->cur)
+		yyg->cur = NULL;
+	if (b->owns)
+		yyfree(b->base);
+	yyfree(b);
+}
+void *yyalloc(yy_size_t n)
+{
+	return malloc(n);
+}
+void *yyrealloc(void *p, yy_size_t n)
+{
+	return realloc(p, n);
+}
+void yyfree(void *p)
+{
+	free(p);
+}
+
+
+void
+yyerror(const char *message)
+{
+	elog(ERROR, "%s at line %d", message, yyline);
+}
+
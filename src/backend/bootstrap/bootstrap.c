@@ -64,6 +64,8 @@ static void cleanup(void);
  * ----------------
  */
 
+AuxProcType MyAuxProcType = NotAnAuxProcess;	/* declared in bootstrap.h */
+
 Relation	boot_reldesc;		/* current relation descriptor */
 
 Form_pg_attribute attrtypes[MAXATTR];	/* points to attribute info */
@@ -178,7 +180,8 @@ static IndexList *ILHead = NULL;
  *	 AuxiliaryProcessMain
  *
  *	 The main entry point for auxiliary processes, such as the bgwriter,
- *	 walwriter, walreceiver, bootstrapper and the shared memory checker code.
+ *	 checkpointer, walwriter, walreceiver, bootstrapper and the shared memory
+ *	 checker code.
  *
  *	 This code is here just because of historical reasons.
  */
@@ -301,6 +304,9 @@ AuxiliaryProcessMain(int argc, char *argv[])
 		proc_exit(1);
 	}
 
+	/* Remember what we are, for the benefit of AmCheckpointerProcess() etc */
+	MyAuxProcType = auxType;
+
 	/*
 	 * Identify myself via ps
 	 */
@@ -316,6 +322,9 @@ AuxiliaryProcessMain(int argc, char *argv[])
 			case BgWriterProcess:
 				statmsg = "writer process";
 				break;
+			case CheckpointerProcess:
+				statmsg = "checkpointer process";
+				break;
 			case WalWriterProcess:
 				statmsg = "wal writer process";
 				break;
@@ -420,6 +429,11 @@ AuxiliaryProcessMain(int argc, char *argv[])
 			BackgroundWriterMain();
 			proc_exit(1);		/* should never return */
 
+		case CheckpointerProcess:
+			/* don't set signals, checkpointer has its own agenda */
+			CheckpointerMain();
+			proc_exit(1);		/* should never return */
+
 		case WalWriterProcess:
 			/* don't set signals, walwriter has its own agenda */
 			InitXLOGAccess();
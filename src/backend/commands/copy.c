@@ -20,8 +20,19 @@
 #include <netinet/in.h>
 #include <arpa/inet.h>
 
+/*
+ * SSE2 is part of the x86-64 base instruction set, and gets used on 32-bit
+ * x86 too if the compiler has been told it may use it.
+ */
+#if defined(__SSE2__) || defined(_M_X64) || \
+	(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USE_SSE2_COPY_SCAN
+#include <emmintrin.h>
+#endif
+
 #include "access/heapam.h"
 #include "access/sysattr.h"
+#include "access/transam.h"
 #include "access/xact.h"
 #include "catalog/namespace.h"
 #include "catalog/pg_type.h"
@@ -33,13 +44,18 @@
 #include "libpq/pqformat.h"
 #include "mb/pg_wchar.h"
 #include "miscadmin.h"
+#include "optimizer/clauses.h"
 #include "optimizer/planner.h"
 #include "parser/parse_relation.h"
+#include "postmaster/parallelworker.h"
 #include "rewrite/rewriteHandler.h"
 #include "storage/fd.h"
+#include "storage/lmgr.h"
+#include "storage/shm_mq.h"
 #include "tcop/tcopprot.h"
 #include "utils/acl.h"
 #include "utils/builtins.h"
+#include "utils/guc.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
 #include "utils/snapmgr.h"
@@ -70,6 +86,21 @@ typedef enum EolType
 	EOL_CRNL
 } EolType;
 
+/*
+ * The set of bytes that a COPY FROM parsing loop must look at individually,
+ * for use with CopyScanSpecial.  All other bytes can be skipped over or
+ * copied in bulk.
+ */
+#define COPY_MAX_SPECIAL	5
+
+typedef struct CopySpecialChars
+{
+	int			nchars;			/* # of entries in chars[], at least 1 */
+	char		chars[COPY_MAX_SPECIAL];
+	bool		highbit;		/* are bytes with high bit set special? */
+	bool		is_special[256];	/* the same, as a lookup table */
+} CopySpecialChars;
+
 /*
  * This struct contains all the state variables used throughout a COPY
  * operation. For simplicity, we use the same struct for all variants of COPY,
@@ -118,6 +149,7 @@ typedef struct CopyStateData
 	char	   *escape;			/* CSV escape char (must be 1 byte) */
 	bool	   *force_quote_flags;		/* per-column CSV FQ flags */
 	bool	   *force_notnull_flags;	/* per-column CSV FNN flags */
+	int			nworkers;		/* # of parallel workers to parse input */
 
 	/* these are just for error messages, see copy_in_error_callback */
 	const char *cur_relname;	/* table name for error messages */
@@ -131,6 +163,20 @@ typedef struct CopyStateData
 	FmgrInfo   *out_functions;	/* lookup info for output functions */
 	MemoryContext rowcontext;	/* per-row evaluation context */
 
+	/*
+	 * Working state for COPY FROM
+	 */
+	FmgrInfo   *in_functions;	/* lookup info for input functions */
+	Oid		   *typioparams;	/* element types to pass to them */
+	bool		file_has_oids;	/* does each input line start with an OID? */
+	int			nfields;		/* # of fields expected per input line */
+	char	  **field_strings;	/* workspace for CopyReadAttributes */
+
+	/* special characters for CopyReadLineText and CopyReadAttributes */
+	CopySpecialChars line_specials;
+	CopySpecialChars field_specials;	/* unquoted field */
+	CopySpecialChars quoted_specials;	/* quoted CSV field */
+
 	/*
 	 * These variables are used to reduce overhead in textual COPY FROM.
 	 *
@@ -150,6 +196,7 @@ typedef struct CopyStateData
 	 */
 	StringInfoData line_buf;
 	bool		line_buf_converted;		/* converted to server encoding? */
+	bool		line_buf_valid;	/* contains the row being processed? */
 
 	/*
 	 * Finally, raw_buf holds raw data read from the data source (file or
@@ -173,6 +220,101 @@ typedef struct
 	CopyState	cstate;			/* CopyStateData for the command */
 } DR_copy;
 
+/*
+ * Parallel COPY FROM.
+ *
+ * The leader reads the input, splits it into lines and converts it to the
+ * server encoding exactly as in a serial COPY, but instead of parsing each
+ * line itself it packs runs of lines into chunks and hands them out to
+ * parallel workers through per-worker input queues.  The workers split the
+ * lines into fields, run the input functions and send back the finished
+ * tuples, which the leader inserts along with everything else a serial
+ * COPY does: defaults, triggers, constraints and index entries.  The
+ * workers run in their own transactions, so they couldn't insert into the
+ * table on our behalf anyway.  Rows end up in the table in no particular
+ * order.
+ *
+ * A chunk is an int giving the line number of its first line, followed by
+ * each line as an int32 length and that many bytes, without terminating
+ * newline or null.  A tuple sent back is the line number, padded to a
+ * MAXALIGN boundary, followed by the tuple header and data.
+ *
+ * The argument area starts with a ParallelCopyHeader; the attribute
+ * numbers, FORCE NOT NULL flags and strings follow at the given offsets,
+ * and the input queues take up the rest of the area.
+ */
+typedef struct ParallelCopyHeader
+{
+	Oid			relid;			/* table being loaded */
+	bool		csv_mode;
+	bool		oids;
+	char		delim[2];		/* each a single character and a null */
+	char		quote[2];
+	char		escape[2];
+	int			natts;			/* # of attnums to copy */
+	int			nphysatts;		/* # of FORCE NOT NULL flags */
+	Size		attnums_offset;
+	Size		force_notnull_offset;
+	Size		null_print_offset;
+	Size		gucs_offset;	/* GUC values, each a null-terminated string */
+	Size		queue_offset;
+	Size		queue_size;		/* size of each input queue */
+} ParallelCopyHeader;
+
+/*
+ * Settings that affect the input functions, and that the workers must
+ * therefore copy from the leader.
+ */
+static const char *const ParallelCopyGUCs[] = {
+	"DateStyle",
+	"IntervalStyle",
+	"TimeZone",
+	"search_path",
+	"lc_monetary",
+	"lc_numeric"
+};
+
+#define NUM_PARALLEL_COPY_GUCS \
+	((int) (sizeof(ParallelCopyGUCs) / sizeof(ParallelCopyGUCs[0])))
+
+/* Don't bother with workers unless each input queue gets at least this */
+#define PARALLEL_COPY_MIN_QUEUE_SIZE	4096
+
+/* Leader-side state for a parallel COPY FROM */
+typedef struct CopyParallelState
+{
+	ParallelContext *pcxt;
+	MemoryContext mcxt;			/* context for the fields below */
+	int			nworkers;
+	shm_mq	  **inqueue;		/* chunk queue of each worker */
+	bool	   *sending;		/* still handing out chunks to this worker? */
+	int			nextworker;		/* next worker to try to give a chunk */
+
+	/* tuple queues of the workers that haven't finished yet */
+	int			nreaders;
+	int			nextreader;
+	int		   *reader_worker;	/* worker number of each reader */
+	shm_mq_handle **reader;
+
+	/* the chunk being filled, and the line that didn't fit into it */
+	StringInfoData chunk;
+	int			chunk_lines;
+	bool		chunk_full;
+	Size		max_chunk;		/* maximum chunk size */
+	StringInfoData pending_line;
+	bool		have_pending_line;
+
+	/* chunks we must parse ourselves */
+	List	   *local_chunks;
+	char	   *local_pos;		/* next line in the first of them */
+	char	   *local_end;		/* end of the first of them */
+	int			local_lineno;	/* line number at local_pos */
+
+	int			lineno;			/* # of lines read so far */
+	bool		input_done;		/* hit EOF? */
+	bool		queues_detached;	/* told workers there's no more input? */
+} CopyParallelState;
+
 
 /*
  * These macros centralize code used to process line_buf and raw_buf buffers.
@@ -248,6 +390,25 @@ static void CopyTo(CopyState cstate);
 static void CopyOneRowTo(CopyState cstate, Oid tupleOid,
 			 Datum *values, bool *nulls);
 static void CopyFrom(CopyState cstate);
+static void CopyFromInsertBatch(CopyState cstate, EState *estate,
+					CommandId mycid, int hi_options,
+					ResultRelInfo *resultRelInfo, TupleTableSlot *myslot,
+					BulkInsertState bistate,
+					int nBufferedTuples, HeapTuple *bufferedTuples,
+					int *bufferedLineNos);
+static void CopyFromSetupInput(CopyState cstate);
+static void CopyInitSpecialChars(CopySpecialChars *sp, bool highbit,
+					 char c1, char c2, char c3, char c4, char c5);
+static void CopySetupScanning(CopyState cstate);
+static void CopyFromParseLine(CopyState cstate, Datum *values, bool *nulls,
+				  Oid *loaded_oid);
+static HeapTuple CopyFromParseToTuple(CopyState cstate, TupleDesc tupDesc,
+					 Datum *values, bool *nulls);
+static char *CopyLoadChunkLine(CopyState cstate, char *pos);
+static CopyParallelState *CopyFromParallelBegin(CopyState cstate);
+static HeapTuple CopyFromParallelNext(CopyState cstate,
+					 CopyParallelState *pstate, Datum *values, bool *nulls);
+static void CopyFromParallelEnd(CopyParallelState *pstate);
 static bool CopyReadLine(CopyState cstate);
 static bool CopyReadLineText(CopyState cstate);
 static int CopyReadAttributesText(CopyState cstate, int maxfields,
@@ -726,6 +887,7 @@ DoCopy(const CopyStmt *stmt, const char *queryString)
 	List	   *force_notnull = NIL;
 	bool		force_quote_all = false;
 	bool		format_specified = false;
+	bool		parallel_specified = false;
 	AclMode		required_access = (is_from ? ACL_INSERT : ACL_SELECT);
 	ListCell   *option;
 	TupleDesc	tupDesc;
@@ -838,6 +1000,23 @@ DoCopy(const CopyStmt *stmt, const char *queryString)
 						 errmsg("argument to option \"%s\" must be a list of column names",
 								defel->defname)));
 		}
+		else if (strcmp(defel->defname, "parallel") == 0)
+		{
+			int64		nworkers;
+
+			if (parallel_specified)
+				ereport(ERROR,
+						(errcode(ERRCODE_SYNTAX_ERROR),
+						 errmsg("conflicting or redundant options")));
+			parallel_specified = true;
+			nworkers = defGetInt64(defel);
+			if (nworkers < 0 || nworkers > INT_MAX)
+				ereport(ERROR,
+						(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+						 errmsg("argument to option \"%s\" must be a non-negative integer",
+								defel->defname)));
+			cstate->nworkers = (int) nworkers;
+		}
 		else
 			ereport(ERROR,
 					(errcode(ERRCODE_SYNTAX_ERROR),
@@ -964,6 +1143,16 @@ DoCopy(const CopyStmt *stmt, const char *queryString)
 				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
 			  errmsg("COPY force not null only available using COPY FROM")));
 
+	/* Check parallel */
+	if (parallel_specified && !is_from)
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("COPY parallel only available using COPY FROM")));
+	if (parallel_specified && cstate->binary)
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("cannot specify PARALLEL in BINARY mode")));
+
 	/* Don't allow the delimiter to appear in the null string. */
 	if (strchr(cstate->null_print, cstate->delim[0]) != NULL)
 		ereport(ERROR,
@@ -1161,6 +1350,7 @@ DoCopy(const CopyStmt *stmt, const char *queryString)
 	initStringInfo(&cstate->attribute_buf);
 	initStringInfo(&cstate->line_buf);
 	cstate->line_buf_converted = false;
+	cstate->line_buf_valid = false;
 	cstate->raw_buf = (char *) palloc(RAW_BUF_SIZE + 1);
 	cstate->raw_buf_index = cstate->raw_buf_len = 0;
 	cstate->processed = 0;
@@ -1177,6 +1367,9 @@ DoCopy(const CopyStmt *stmt, const char *queryString)
 	/* See Multibyte encoding comment above */
 	cstate->encoding_embeds_ascii = PG_ENCODING_IS_CLIENT_ONLY(cstate->client_encoding);
 
+	if (is_from && !cstate->binary)
+		CopySetupScanning(cstate);
+
 	cstate->copy_dest = COPY_FILE;		/* default */
 	cstate->filename = stmt->filename;
 
@@ -1596,7 +1789,8 @@ copy_in_error_callback(void *arg)
 		else
 		{
 			/* error is relevant to a particular line */
-			if (cstate->line_buf_converted || !cstate->need_transcoding)
+			if (cstate->line_buf_valid &&
+				(cstate->line_buf_converted || !cstate->need_transcoding))
 			{
 				char	   *lineval;
 
@@ -1670,23 +1864,19 @@ CopyFrom(CopyState cstate)
 	AttrNumber	num_phys_attrs,
 				attr_count,
 				num_defaults;
-	FmgrInfo   *in_functions;
 	FmgrInfo	oid_in_function;
-	Oid		   *typioparams;
 	Oid			oid_typioparam;
 	int			attnum;
 	int			i;
 	Oid			in_func_oid;
 	Datum	   *values;
 	bool	   *nulls;
-	int			nfields;
-	char	  **field_strings;
 	bool		done = false;
 	bool		isnull;
 	ResultRelInfo *resultRelInfo;
 	EState	   *estate = CreateExecutorState(); /* for ExecConstraints() */
 	TupleTableSlot *slot;
-	bool		file_has_oids;
+	CopyParallelState *pstate = NULL;
 	int		   *defmap;
 	ExprState **defexprs;		/* array of default att expressions */
 	ExprContext *econtext;		/* used for ExecEvalExpr for default atts */
@@ -1695,6 +1885,14 @@ CopyFrom(CopyState cstate)
 	CommandId	mycid = GetCurrentCommandId(true);
 	int			hi_options = 0; /* start with default heap_insert options */
 	BulkInsertState bistate;
+	bool		volatile_defexprs = false;
+	bool		useHeapMultiInsert;
+	int			nBufferedTuples = 0;
+	Size		bufferedTuplesSize = 0;
+	HeapTuple  *bufferedTuples = NULL;
+	int		   *bufferedLineNos = NULL;
+
+#define MAX_BUFFERED_TUPLES 1000
 
 	Assert(cstate->rel);
 
@@ -1815,13 +2013,9 @@ CopyFrom(CopyState cstate)
 	econtext = GetPerTupleExprContext(estate);
 
 	/*
-	 * Pick up the required catalog information for each attribute in the
-	 * relation, including the input function, the element type (to pass to
-	 * the input function), and info about defaults and constraints. (Which
-	 * input function we use depends on text/binary format choice.)
+	 * Pick up the defaults for the attributes that aren't in the input.  The
+	 * input functions are looked up by CopyFromSetupInput, below.
 	 */
-	in_functions = (FmgrInfo *) palloc(num_phys_attrs * sizeof(FmgrInfo));
-	typioparams = (Oid *) palloc(num_phys_attrs * sizeof(Oid));
 	defmap = (int *) palloc(num_phys_attrs * sizeof(int));
 	defexprs = (ExprState **) palloc(num_phys_attrs * sizeof(ExprState *));
 
@@ -1831,15 +2025,6 @@ CopyFrom(CopyState cstate)
 		if (attr[attnum - 1]->attisdropped)
 			continue;
 
-		/* Fetch the input function and typioparam info */
-		if (cstate->binary)
-			getTypeBinaryInputInfo(attr[attnum - 1]->atttypid,
-								   &in_func_oid, &typioparams[attnum - 1]);
-		else
-			getTypeInputInfo(attr[attnum - 1]->atttypid,
-							 &in_func_oid, &typioparams[attnum - 1]);
-		fmgr_info(in_func_oid, &in_functions[attnum - 1]);
-
 		/* Get default info if needed */
 		if (!list_member_int(cstate->attnumlist, attnum))
 		{
@@ -1853,10 +2038,33 @@ CopyFrom(CopyState cstate)
 														 estate);
 				defmap[num_defaults] = attnum - 1;
 				num_defaults++;
+
+				if (!volatile_defexprs)
+					volatile_defexprs = contain_volatile_functions(defexpr);
 			}
 		}
 	}
 
+	/*
+	 * It's more efficient to prepare a bunch of tuples for insertion, and
+	 * insert them in one heap_multi_insert() call, than call heap_insert()
+	 * separately for every tuple.  However, we can't do that if there are
+	 * BEFORE ROW INSERT triggers, or we need to evaluate volatile default
+	 * expressions.  Such triggers or expressions might query the table we're
+	 * inserting to, and act differently if the tuples that have already been
+	 * processed and prepared for insertion are not there.
+	 */
+	if ((resultRelInfo->ri_TrigDesc != NULL &&
+		 resultRelInfo->ri_TrigDesc->n_before_row[TRIGGER_EVENT_INSERT] > 0) ||
+		volatile_defexprs)
+		useHeapMultiInsert = false;
+	else
+	{
+		useHeapMultiInsert = true;
+		bufferedTuples = palloc(MAX_BUFFERED_TUPLES * sizeof(HeapTuple));
+		bufferedLineNos = palloc(MAX_BUFFERED_TUPLES * sizeof(int));
+	}
+
 	/* Prepare to catch AFTER triggers. */
 	AfterTriggerBeginQuery();
 
@@ -1869,7 +2077,7 @@ CopyFrom(CopyState cstate)
 	ExecBSInsertTriggers(estate, resultRelInfo);
 
 	if (!cstate->binary)
-		file_has_oids = cstate->oids;	/* must rely on user to tell us... */
+		cstate->file_has_oids = cstate->oids;	/* must rely on user to tell us... */
 	else
 	{
 		/* Read and verify binary header */
@@ -1887,7 +2095,7 @@ CopyFrom(CopyState cstate)
 			ereport(ERROR,
 					(errcode(ERRCODE_BAD_COPY_FILE_FORMAT),
 					 errmsg("invalid COPY file header (missing flags)")));
-		file_has_oids = (tmp & (1 << 16)) != 0;
+		cstate->file_has_oids = (tmp & (1 << 16)) != 0;
 		tmp &= ~(1 << 16);
 		if ((tmp >> 16) != 0)
 			ereport(ERROR,
@@ -1909,20 +2117,18 @@ CopyFrom(CopyState cstate)
 		}
 	}
 
-	if (file_has_oids && cstate->binary)
+	if (cstate->file_has_oids && cstate->binary)
 	{
 		getTypeBinaryInputInfo(OIDOID,
 							   &in_func_oid, &oid_typioparam);
 		fmgr_info(in_func_oid, &oid_in_function);
 	}
 
+	CopyFromSetupInput(cstate);
+
 	values = (Datum *) palloc(num_phys_attrs * sizeof(Datum));
 	nulls = (bool *) palloc(num_phys_attrs * sizeof(bool));
 
-	/* create workspace for CopyReadAttributes results */
-	nfields = file_has_oids ? (attr_count + 1) : attr_count;
-	field_strings = (char **) palloc(nfields * sizeof(char *));
-
 	/* Initialize state variables */
 	cstate->fe_eof = false;
 	cstate->eol_type = EOL_UNKNOWN;
@@ -1946,6 +2152,10 @@ CopyFrom(CopyState cstate)
 		done = CopyReadLine(cstate);
 	}
 
+	/* Hand the parsing of the remaining lines to workers, if asked to */
+	if (cstate->nworkers > 0 && !done)
+		pstate = CopyFromParallelBegin(cstate);
+
 	while (!done)
 	{
 		bool		skip_tuple;
@@ -1953,24 +2163,37 @@ CopyFrom(CopyState cstate)
 
 		CHECK_FOR_INTERRUPTS();
 
-		cstate->cur_lineno++;
-
-		/* Reset the per-tuple exprcontext */
-		ResetPerTupleExprContext(estate);
+		/*
+		 * Reset the per-tuple exprcontext.  We can only do this if the tuple
+		 * buffer is empty, since the buffered tuples live in it too.
+		 */
+		if (nBufferedTuples == 0)
+			ResetPerTupleExprContext(estate);
 
 		/* Switch into its memory context */
 		MemoryContextSwitchTo(GetPerTupleMemoryContext(estate));
 
-		/* Initialize all values for row to NULL */
-		MemSet(values, 0, num_phys_attrs * sizeof(Datum));
-		MemSet(nulls, true, num_phys_attrs * sizeof(bool));
+		if (pstate != NULL)
+		{
+			/* Get the next tuple parsed by a worker, or by ourselves */
+			tuple = CopyFromParallelNext(cstate, pstate, values, nulls);
+			if (tuple == NULL)
+			{
+				done = true;
+				break;
+			}
 
-		if (!cstate->binary)
+			/* Take the tuple apart again if we have defaults to fill in */
+			if (num_defaults > 0)
+			{
+				if (cstate->oids && cstate->file_has_oids)
+					loaded_oid = HeapTupleGetOid(tuple);
+				heap_deform_tuple(tuple, tupDesc, values, nulls);
+			}
+		}
+		else if (!cstate->binary)
 		{
-			ListCell   *cur;
-			int			fldct;
-			int			fieldno;
-			char	   *string;
+			cstate->cur_lineno++;
 
 			/* Actually read the line into memory here */
 			done = CopyReadLine(cstate);
@@ -1983,74 +2206,11 @@ CopyFrom(CopyState cstate)
 			if (done && cstate->line_buf.len == 0)
 				break;
 
-			/* Parse the line into de-escaped field values */
-			if (cstate->csv_mode)
-				fldct = CopyReadAttributesCSV(cstate, nfields, field_strings);
-			else
-				fldct = CopyReadAttributesText(cstate, nfields, field_strings);
-			fieldno = 0;
-
-			/* Read the OID field if present */
-			if (file_has_oids)
-			{
-				if (fieldno >= fldct)
-					ereport(ERROR,
-							(errcode(ERRCODE_BAD_COPY_FILE_FORMAT),
-							 errmsg("missing data for OID column")));
-				string = field_strings[fieldno++];
-
-				if (string == NULL)
-					ereport(ERROR,
-							(errcode(ERRCODE_BAD_COPY_FILE_FORMAT),
-							 errmsg("null OID in COPY data")));
-				else
-				{
-					cstate->cur_attname = "oid";
-					cstate->cur_attval = string;
-					loaded_oid = DatumGetObjectId(DirectFunctionCall1(oidin,
-												   CStringGetDatum(string)));
-					if (loaded_oid == InvalidOid)
-						ereport(ERROR,
-								(errcode(ERRCODE_BAD_COPY_FILE_FORMAT),
-								 errmsg("invalid OID in COPY data")));
-					cstate->cur_attname = NULL;
-					cstate->cur_attval = NULL;
-				}
-			}
-
-			/* Loop to read the user attributes on the line. */
-			foreach(cur, cstate->attnumlist)
-			{
-				int			attnum = lfirst_int(cur);
-				int			m = attnum - 1;
-
-				if (fieldno >= fldct)
-					ereport(ERROR,
-							(errcode(ERRCODE_BAD_COPY_FILE_FORMAT),
-							 errmsg("missing data for column \"%s\"",
-									NameStr(attr[m]->attname))));
-				string = field_strings[fieldno++];
-
-				if (cstate->csv_mode && string == NULL &&
-					cstate->force_notnull_flags[m])
-				{
-					/* Go ahead and read the NULL string */
-					string = cstate->null_print;
-				}
-
-				cstate->cur_attname = NameStr(attr[m]->attname);
-				cstate->cur_attval = string;
-				values[m] = InputFunctionCall(&in_functions[m],
-											  string,
-											  typioparams[m],
-											  attr[m]->atttypmod);
-				if (string != NULL)
-					nulls[m] = false;
-				cstate->cur_attname = NULL;
-				cstate->cur_attval = NULL;
-			}
+			/* Initialize all values for row to NULL */
+			MemSet(values, 0, num_phys_attrs * sizeof(Datum));
+			MemSet(nulls, true, num_phys_attrs * sizeof(bool));
 
-			Assert(fieldno == nfields);
+			CopyFromParseLine(cstate, values, nulls, &loaded_oid);
 		}
 		else
 		{
@@ -2058,6 +2218,12 @@ CopyFrom(CopyState cstate)
 			int16		fld_count;
 			ListCell   *cur;
 
+			cstate->cur_lineno++;
+
+			/* Initialize all values for row to NULL */
+			MemSet(values, 0, num_phys_attrs * sizeof(Datum));
+			MemSet(nulls, true, num_phys_attrs * sizeof(bool));
+
 			if (!CopyGetInt16(cstate, &fld_count))
 			{
 				/* EOF detected (end of file, or protocol-level EOF) */
@@ -2096,7 +2262,7 @@ CopyFrom(CopyState cstate)
 						 errmsg("row field count is %d, expected %d",
 								(int) fld_count, attr_count)));
 
-			if (file_has_oids)
+			if (cstate->file_has_oids)
 			{
 				cstate->cur_attname = "oid";
 				loaded_oid =
@@ -2123,30 +2289,33 @@ CopyFrom(CopyState cstate)
 				i++;
 				values[m] = CopyReadBinaryAttribute(cstate,
 													i,
-													&in_functions[m],
-													typioparams[m],
+													&cstate->in_functions[m],
+													cstate->typioparams[m],
 													attr[m]->atttypmod,
 													&nulls[m]);
 				cstate->cur_attname = NULL;
 			}
 		}
 
-		/*
-		 * Now compute and insert any defaults available for the columns not
-		 * provided by the input data.	Anything not processed here or above
-		 * will remain NULL.
-		 */
-		for (i = 0; i < num_defaults; i++)
+		if (pstate == NULL || num_defaults > 0)
 		{
-			values[defmap[i]] = ExecEvalExpr(defexprs[i], econtext,
-											 &nulls[defmap[i]], NULL);
-		}
+			/*
+			 * Now compute and insert any defaults available for the columns
+			 * not provided by the input data.	Anything not processed here or
+			 * above will remain NULL.
+			 */
+			for (i = 0; i < num_defaults; i++)
+			{
+				values[defmap[i]] = ExecEvalExpr(defexprs[i], econtext,
+												 &nulls[defmap[i]], NULL);
+			}
 
-		/* And now we can form the input tuple. */
-		tuple = heap_form_tuple(tupDesc, values, nulls);
+			/* And now we can form the input tuple. */
+			tuple = heap_form_tuple(tupDesc, values, nulls);
 
-		if (cstate->oids && file_has_oids)
-			HeapTupleSetOid(tuple, loaded_oid);
+			if (cstate->oids && cstate->file_has_oids)
+				HeapTupleSetOid(tuple, loaded_oid);
+		}
 
 		/* Triggers and stuff need to be invoked in query context. */
 		MemoryContextSwitchTo(oldcontext);
@@ -2181,18 +2350,46 @@ CopyFrom(CopyState cstate)
 			if (cstate->rel->rd_att->constr)
 				ExecConstraints(resultRelInfo, slot, estate);
 
-			/* OK, store the tuple and create index entries for it */
-			heap_insert(cstate->rel, tuple, mycid, hi_options, bistate);
+			if (useHeapMultiInsert)
+			{
+				/* Add this tuple to the tuple buffer */
+				bufferedLineNos[nBufferedTuples] = cstate->cur_lineno;
+				bufferedTuples[nBufferedTuples++] = tuple;
+				bufferedTuplesSize += tuple->t_len;
+
+				/*
+				 * If the buffer filled up, flush it.  Also flush if the total
+				 * size of all the tuples in the buffer becomes large, to
+				 * avoid using large amounts of memory for the buffers when
+				 * the tuples are exceptionally wide.
+				 */
+				if (nBufferedTuples == MAX_BUFFERED_TUPLES ||
+					bufferedTuplesSize > 65535)
+				{
+					CopyFromInsertBatch(cstate, estate, mycid, hi_options,
+										resultRelInfo, slot, bistate,
+										nBufferedTuples, bufferedTuples,
+										bufferedLineNos);
+					nBufferedTuples = 0;
+					bufferedTuplesSize = 0;
+				}
+			}
+			else
+			{
+				/* OK, store the tuple and create index entries for it */
+				heap_insert(cstate->rel, tuple, mycid, hi_options, bistate);
 
-			if (resultRelInfo->ri_NumIndices > 0)
-				recheckIndexes = ExecInsertIndexTuples(slot, &(tuple->t_self),
-													   estate);
+				if (resultRelInfo->ri_NumIndices > 0)
+					recheckIndexes = ExecInsertIndexTuples(slot,
+														   &(tuple->t_self),
+														   estate);
 
-			/* AFTER ROW INSERT Triggers */
-			ExecARInsertTriggers(estate, resultRelInfo, tuple,
-								 recheckIndexes);
+				/* AFTER ROW INSERT Triggers */
+				ExecARInsertTriggers(estate, resultRelInfo, tuple,
+									 recheckIndexes);
 
-			list_free(recheckIndexes);
+				list_free(recheckIndexes);
+			}
 
 			/*
 			 * We count only tuples not suppressed by a BEFORE INSERT trigger;
@@ -2203,6 +2400,17 @@ CopyFrom(CopyState cstate)
 		}
 	}
 
+	/* All input has been parsed, so the workers can go */
+	if (pstate != NULL)
+		CopyFromParallelEnd(pstate);
+
+	/* Flush any remaining buffered tuples */
+	if (nBufferedTuples > 0)
+		CopyFromInsertBatch(cstate, estate, mycid, hi_options,
+							resultRelInfo, slot, bistate,
+							nBufferedTuples, bufferedTuples,
+							bufferedLineNos);
+
 	/* Done, clean up */
 	error_context_stack = errcontext.previous;
 
@@ -2218,10 +2426,15 @@ CopyFrom(CopyState cstate)
 
 	pfree(values);
 	pfree(nulls);
-	pfree(field_strings);
+	pfree(cstate->field_strings);
+	if (bufferedTuples)
+	{
+		pfree(bufferedTuples);
+		pfree(bufferedLineNos);
+	}
 
-	pfree(in_functions);
-	pfree(typioparams);
+	pfree(cstate->in_functions);
+	pfree(cstate->typioparams);
 	pfree(defmap);
 	pfree(defexprs);
 
@@ -2248,135 +2461,1167 @@ CopyFrom(CopyState cstate)
 		heap_sync(cstate->rel);
 }
 
-
 /*
- * Read the next input line and stash it in line_buf, with conversion to
- * server encoding.
- *
- * Result is true if read was terminated by EOF, false if terminated
- * by newline.	The terminating newline or EOF marker is not included
- * in the final value of line_buf.
+ * A subroutine of CopyFrom, to write the current batch of buffered heap
+ * tuples to the heap.  Also updates indexes and runs AFTER ROW INSERT
+ * triggers.
  */
-static bool
-CopyReadLine(CopyState cstate)
+static void
+CopyFromInsertBatch(CopyState cstate, EState *estate, CommandId mycid,
+					int hi_options, ResultRelInfo *resultRelInfo,
+					TupleTableSlot *myslot, BulkInsertState bistate,
+					int nBufferedTuples, HeapTuple *bufferedTuples,
+					int *bufferedLineNos)
 {
-	bool		result;
-
-	resetStringInfo(&cstate->line_buf);
+	MemoryContext oldcontext;
+	int			i;
+	int			save_cur_lineno;
 
-	/* Mark that encoding conversion hasn't occurred yet */
-	cstate->line_buf_converted = false;
+	/*
+	 * Print error context information correctly, if one of the operations
+	 * below fail.
+	 */
+	cstate->line_buf_valid = false;
+	save_cur_lineno = cstate->cur_lineno;
 
-	/* Parse data and transfer into line_buf */
-	result = CopyReadLineText(cstate);
+	/*
+	 * heap_multi_insert leaks memory, so switch to short-lived memory context
+	 * before calling it.
+	 */
+	oldcontext = MemoryContextSwitchTo(GetPerTupleMemoryContext(estate));
+	heap_multi_insert(cstate->rel,
+					  bufferedTuples,
+					  nBufferedTuples,
+					  mycid,
+					  hi_options,
+					  bistate);
+	MemoryContextSwitchTo(oldcontext);
 
-	if (result)
-	{
-		/*
-		 * Reached EOF.  In protocol version 3, we should ignore anything
-		 * after \. up to the protocol end of copy data.  (XXX maybe better
-		 * not to treat \. as special?)
-		 */
-		if (cstate->copy_dest == COPY_NEW_FE)
-		{
-			do
-			{
-				cstate->raw_buf_index = cstate->raw_buf_len;
-			} while (CopyLoadRawBuf(cstate));
-		}
-	}
-	else
+	/*
+	 * If there are any indexes, update them for all the inserted tuples, and
+	 * run AFTER ROW INSERT triggers.
+	 */
+	if (resultRelInfo->ri_NumIndices > 0)
 	{
-		/*
-		 * If we didn't hit EOF, then we must have transferred the EOL marker
-		 * to line_buf along with the data.  Get rid of it.
-		 */
-		switch (cstate->eol_type)
+		for (i = 0; i < nBufferedTuples; i++)
 		{
-			case EOL_NL:
-				Assert(cstate->line_buf.len >= 1);
-				Assert(cstate->line_buf.data[cstate->line_buf.len - 1] == '\n');
-				cstate->line_buf.len--;
-				cstate->line_buf.data[cstate->line_buf.len] = '\0';
-				break;
-			case EOL_CR:
-				Assert(cstate->line_buf.len >= 1);
-				Assert(cstate->line_buf.data[cstate->line_buf.len - 1] == '\r');
-				cstate->line_buf.len--;
-				cstate->line_buf.data[cstate->line_buf.len] = '\0';
-				break;
-			case EOL_CRNL:
-				Assert(cstate->line_buf.len >= 2);
-				Assert(cstate->line_buf.data[cstate->line_buf.len - 2] == '\r');
-				Assert(cstate->line_buf.data[cstate->line_buf.len - 1] == '\n');
-				cstate->line_buf.len -= 2;
-				cstate->line_buf.data[cstate->line_buf.len] = '\0';
-				break;
-			case EOL_UNKNOWN:
-				/* shouldn't get here */
-				Assert(false);
-				break;
+			List	   *recheckIndexes;
+
+			cstate->cur_lineno = bufferedLineNos[i];
+			ExecStoreTuple(bufferedTuples[i], myslot, InvalidBuffer, false);
+			recheckIndexes =
+				ExecInsertIndexTuples(myslot, &(bufferedTuples[i]->t_self),
+									  estate);
+			ExecARInsertTriggers(estate, resultRelInfo,
+								 bufferedTuples[i],
+								 recheckIndexes);
+			list_free(recheckIndexes);
 		}
 	}
 
-	/* Done reading the line.  Convert it to server encoding. */
-	if (cstate->need_transcoding)
+	/*
+	 * There's no indexes, but see if we need to run AFTER ROW INSERT triggers
+	 * anyway.
+	 */
+	else if (resultRelInfo->ri_TrigDesc != NULL &&
+			 resultRelInfo->ri_TrigDesc->n_after_row[TRIGGER_EVENT_INSERT] > 0)
 	{
-		char	   *cvt;
-
-		cvt = pg_client_to_server(cstate->line_buf.data,
-								  cstate->line_buf.len);
-		if (cvt != cstate->line_buf.data)
+		for (i = 0; i < nBufferedTuples; i++)
 		{
-			/* transfer converted data back to line_buf */
-			resetStringInfo(&cstate->line_buf);
-			appendBinaryStringInfo(&cstate->line_buf, cvt, strlen(cvt));
-			pfree(cvt);
+			cstate->cur_lineno = bufferedLineNos[i];
+			ExecARInsertTriggers(estate, resultRelInfo,
+								 bufferedTuples[i],
+								 NIL);
 		}
 	}
 
-	/* Now it's safe to use the buffer in error messages */
-	cstate->line_buf_converted = true;
-
-	return result;
+	/* reset cur_lineno to where we were */
+	cstate->cur_lineno = save_cur_lineno;
 }
 
 /*
- * CopyReadLineText - inner loop of CopyReadLine for text mode
+ * Look up the input function and typioparam of each attribute, and create
+ * the workspace for CopyReadAttributes.  cstate->file_has_oids must be set.
+ * (Which input function we use depends on text/binary format choice.)
  */
-static bool
-CopyReadLineText(CopyState cstate)
+static void
+CopyFromSetupInput(CopyState cstate)
 {
-	char	   *copy_raw_buf;
-	int			raw_buf_ptr;
-	int			copy_buf_len;
-	bool		need_data = false;
-	bool		hit_eof = false;
-	bool		result = false;
-	char		mblen_str[2];
+	TupleDesc	tupDesc = RelationGetDescr(cstate->rel);
+	Form_pg_attribute *attr = tupDesc->attrs;
+	int			num_phys_attrs = tupDesc->natts;
+	int			attnum;
+	Oid			in_func_oid;
 
-	/* CSV variables */
-	bool		first_char_in_line = true;
-	bool		in_quote = false,
-				last_was_esc = false;
-	char		quotec = '\0';
-	char		escapec = '\0';
+	cstate->in_functions = (FmgrInfo *) palloc(num_phys_attrs * sizeof(FmgrInfo));
+	cstate->typioparams = (Oid *) palloc(num_phys_attrs * sizeof(Oid));
 
-	if (cstate->csv_mode)
+	for (attnum = 1; attnum <= num_phys_attrs; attnum++)
 	{
-		quotec = cstate->quote[0];
-		escapec = cstate->escape[0];
-		/* ignore special escape processing if it's the same as quotec */
-		if (quotec == escapec)
-			escapec = '\0';
+		/* We don't need info for dropped attributes */
+		if (attr[attnum - 1]->attisdropped)
+			continue;
+
+		if (cstate->binary)
+			getTypeBinaryInputInfo(attr[attnum - 1]->atttypid,
+								   &in_func_oid,
+								   &cstate->typioparams[attnum - 1]);
+		else
+			getTypeInputInfo(attr[attnum - 1]->atttypid,
+							 &in_func_oid,
+							 &cstate->typioparams[attnum - 1]);
+		fmgr_info(in_func_oid, &cstate->in_functions[attnum - 1]);
 	}
 
-	mblen_str[1] = '\0';
+	/* create workspace for CopyReadAttributes results */
+	cstate->nfields = list_length(cstate->attnumlist);
+	if (cstate->file_has_oids)
+		cstate->nfields++;
+	cstate->field_strings = (char **) palloc(cstate->nfields * sizeof(char *));
+}
 
-	/*
-	 * The objective of this loop is to transfer the entire next input line
-	 * into line_buf.  Hence, we only care for detecting newlines (\r and/or
-	 * \n) and the end-of-copy marker (\.).
+/*
+ * Split the text or CSV line in line_buf into fields, and run the input
+ * functions on them.  values and nulls must have been initialized to all
+ * NULLs; attributes not in the input are left alone.  The OID, if the input
+ * has one, is returned in *loaded_oid.
+ */
+static void
+CopyFromParseLine(CopyState cstate, Datum *values, bool *nulls,
+				  Oid *loaded_oid)
+{
+	Form_pg_attribute *attr = RelationGetDescr(cstate->rel)->attrs;
+	ListCell   *cur;
+	int			fldct;
+	int			fieldno;
+	char	   *string;
+
+	/* Parse the line into de-escaped field values */
+	if (cstate->csv_mode)
+		fldct = CopyReadAttributesCSV(cstate, cstate->nfields,
+									  cstate->field_strings);
+	else
+		fldct = CopyReadAttributesText(cstate, cstate->nfields,
+									   cstate->field_strings);
+	fieldno = 0;
+
+	/* Read the OID field if present */
+	if (cstate->file_has_oids)
+	{
+		if (fieldno >= fldct)
+			ereport(ERROR,
+					(errcode(ERRCODE_BAD_COPY_FILE_FORMAT),
+					 errmsg("missing data for OID column")));
+		string = cstate->field_strings[fieldno++];
+
+		if (string == NULL)
+			ereport(ERROR,
+					(errcode(ERRCODE_BAD_COPY_FILE_FORMAT),
+					 errmsg("null OID in COPY data")));
+		else
+		{
+			cstate->cur_attname = "oid";
+			cstate->cur_attval = string;
+			*loaded_oid = DatumGetObjectId(DirectFunctionCall1(oidin,
+												   CStringGetDatum(string)));
+			if (*loaded_oid == InvalidOid)
+				ereport(ERROR,
+						(errcode(ERRCODE_BAD_COPY_FILE_FORMAT),
+						 errmsg("invalid OID in COPY data")));
+			cstate->cur_attname = NULL;
+			cstate->cur_attval = NULL;
+		}
+	}
+
+	/* Loop to read the user attributes on the line. */
+	foreach(cur, cstate->attnumlist)
+	{
+		int			attnum = lfirst_int(cur);
+		int			m = attnum - 1;
+
+		if (fieldno >= fldct)
+			ereport(ERROR,
+					(errcode(ERRCODE_BAD_COPY_FILE_FORMAT),
+					 errmsg("missing data for column \"%s\"",
+							NameStr(attr[m]->attname))));
+		string = cstate->field_strings[fieldno++];
+
+		if (cstate->csv_mode && string == NULL &&
+			cstate->force_notnull_flags[m])
+		{
+			/* Go ahead and read the NULL string */
+			string = cstate->null_print;
+		}
+
+		cstate->cur_attname = NameStr(attr[m]->attname);
+		cstate->cur_attval = string;
+		values[m] = InputFunctionCall(&cstate->in_functions[m],
+									  string,
+									  cstate->typioparams[m],
+									  attr[m]->atttypmod);
+		if (string != NULL)
+			nulls[m] = false;
+		cstate->cur_attname = NULL;
+		cstate->cur_attval = NULL;
+	}
+
+	Assert(fieldno == cstate->nfields);
+}
+
+/*
+ * Parse the line in line_buf and form a tuple from it, leaving any columns
+ * not in the input NULL.  values and nulls are workspace.
+ */
+static HeapTuple
+CopyFromParseToTuple(CopyState cstate, TupleDesc tupDesc,
+					 Datum *values, bool *nulls)
+{
+	HeapTuple	tuple;
+	Oid			loaded_oid = InvalidOid;
+
+	MemSet(values, 0, tupDesc->natts * sizeof(Datum));
+	MemSet(nulls, true, tupDesc->natts * sizeof(bool));
+
+	CopyFromParseLine(cstate, values, nulls, &loaded_oid);
+
+	tuple = heap_form_tuple(tupDesc, values, nulls);
+
+	if (cstate->oids && cstate->file_has_oids)
+		HeapTupleSetOid(tuple, loaded_oid);
+
+	return tuple;
+}
+
+/*
+ * Copy the line at pos in a chunk of lines to line_buf, and return the
+ * position of the next one.  The lines in a chunk are already in the
+ * server encoding.
+ */
+static char *
+CopyLoadChunkLine(CopyState cstate, char *pos)
+{
+	int32		len;
+
+	memcpy(&len, pos, sizeof(int32));
+	pos += sizeof(int32);
+
+	resetStringInfo(&cstate->line_buf);
+	appendBinaryStringInfo(&cstate->line_buf, pos, len);
+	cstate->line_buf_converted = true;
+	cstate->line_buf_valid = true;
+
+	return pos + len;
+}
+
+/*
+ * Start parallel workers to parse the rest of the input.
+ *
+ * Returns NULL if we should do it all by ourselves: if we're inside a
+ * transaction that has already made changes, which the workers wouldn't
+ * see, or if no workers are available.
+ */
+static CopyParallelState *
+CopyFromParallelBegin(CopyState cstate)
+{
+	TupleDesc	tupDesc = RelationGetDescr(cstate->rel);
+	ParallelContext *pcxt;
+	ParallelCopyHeader *header;
+	CopyParallelState *pstate;
+	char	   *gucvals[NUM_PARALLEL_COPY_GUCS];
+	char	   *args;
+	char	   *gucpos;
+	int		   *attnums;
+	ListCell   *cur;
+	Size		argsize;
+	Size		size;
+	int			i;
+
+	if (!IsUnderPostmaster ||
+		TransactionIdIsValid(GetTopTransactionIdIfAny()))
+		return NULL;
+
+	pcxt = CreateParallelContext(PARALLEL_ENTRY_COPY, cstate->nworkers);
+	args = ParallelContextArgumentSpace(pcxt, &argsize);
+	if (args == NULL)
+	{
+		DestroyParallelContext(pcxt);
+		return NULL;
+	}
+
+	/* Lay out the argument area, giving up if there's no room for queues */
+	header = (ParallelCopyHeader *) args;
+	size = MAXALIGN(sizeof(ParallelCopyHeader));
+	header->attnums_offset = size;
+	size += MAXALIGN(list_length(cstate->attnumlist) * sizeof(int));
+	header->force_notnull_offset = size;
+	size += MAXALIGN(tupDesc->natts * sizeof(bool));
+	header->null_print_offset = size;
+	size += cstate->null_print_len + 1;
+	header->gucs_offset = size;
+	for (i = 0; i < NUM_PARALLEL_COPY_GUCS; i++)
+	{
+		gucvals[i] = pstrdup(GetConfigOption(ParallelCopyGUCs[i], false));
+		size += strlen(gucvals[i]) + 1;
+	}
+	header->queue_offset = MAXALIGN(size);
+
+	if (header->queue_offset >= argsize ||
+		(argsize - header->queue_offset) / pcxt->nworkers <
+		PARALLEL_COPY_MIN_QUEUE_SIZE)
+	{
+		DestroyParallelContext(pcxt);
+		return NULL;
+	}
+	header->queue_size = (argsize - header->queue_offset) / pcxt->nworkers;
+	header->queue_size -= header->queue_size % MAXIMUM_ALIGNOF;
+
+	/* Fill it in */
+	header->relid = RelationGetRelid(cstate->rel);
+	header->csv_mode = cstate->csv_mode;
+	header->oids = cstate->oids;
+	header->delim[0] = cstate->delim[0];
+	header->delim[1] = '\0';
+	header->quote[0] = cstate->csv_mode ? cstate->quote[0] : '\0';
+	header->quote[1] = '\0';
+	header->escape[0] = cstate->csv_mode ? cstate->escape[0] : '\0';
+	header->escape[1] = '\0';
+	header->natts = list_length(cstate->attnumlist);
+	header->nphysatts = tupDesc->natts;
+
+	attnums = (int *) (args + header->attnums_offset);
+	foreach(cur, cstate->attnumlist)
+		*attnums++ = lfirst_int(cur);
+	memcpy(args + header->force_notnull_offset, cstate->force_notnull_flags,
+		   tupDesc->natts * sizeof(bool));
+	strcpy(args + header->null_print_offset, cstate->null_print);
+	gucpos = args + header->gucs_offset;
+	for (i = 0; i < NUM_PARALLEL_COPY_GUCS; i++)
+	{
+		strcpy(gucpos, gucvals[i]);
+		gucpos += strlen(gucvals[i]) + 1;
+		pfree(gucvals[i]);
+	}
+
+	/* Set up our state, and the queues to hand out chunks through */
+	pstate = (CopyParallelState *) palloc0(sizeof(CopyParallelState));
+	pstate->pcxt = pcxt;
+	pstate->mcxt = CurrentMemoryContext;
+	pstate->nworkers = pcxt->nworkers;
+	pstate->inqueue = (shm_mq **) palloc(pstate->nworkers * sizeof(shm_mq *));
+	pstate->sending = (bool *) palloc(pstate->nworkers * sizeof(bool));
+	for (i = 0; i < pstate->nworkers; i++)
+	{
+		pstate->inqueue[i] = shm_mq_create(args + header->queue_offset +
+										   i * header->queue_size,
+										   header->queue_size);
+		shm_mq_set_sender(pstate->inqueue[i], MyProc);
+		pstate->sending[i] = true;
+	}
+
+	/*
+	 * A chunk can take up half of a queue, so that a worker can work on one
+	 * chunk while the next one is waiting for it.
+	 */
+	pstate->max_chunk = header->queue_size / 2;
+	initStringInfo(&pstate->chunk);
+	initStringInfo(&pstate->pending_line);
+	pstate->lineno = cstate->cur_lineno;
+
+	LaunchParallelWorkers(pcxt);
+
+	pstate->nreaders = pstate->nworkers;
+	pstate->reader_worker = (int *) palloc(pstate->nreaders * sizeof(int));
+	pstate->reader = (shm_mq_handle **)
+		palloc(pstate->nreaders * sizeof(shm_mq_handle *));
+	for (i = 0; i < pstate->nreaders; i++)
+	{
+		pstate->reader_worker[i] = i;
+		pstate->reader[i] = shm_mq_attach(ParallelWorkerQueue(pcxt, i));
+	}
+
+	return pstate;
+}
+
+/*
+ * Append a line to the chunk being filled.
+ */
+static void
+CopyFromParallelAddLine(CopyParallelState *pstate, const char *line,
+						int32 len, int lineno)
+{
+	if (pstate->chunk_lines == 0)
+	{
+		resetStringInfo(&pstate->chunk);
+		appendBinaryStringInfo(&pstate->chunk, (char *) &lineno, sizeof(int));
+	}
+	appendBinaryStringInfo(&pstate->chunk, (char *) &len, sizeof(int32));
+	appendBinaryStringInfo(&pstate->chunk, line, len);
+	pstate->chunk_lines++;
+}
+
+/*
+ * Read input lines into the chunk until it's full or we hit EOF.
+ *
+ * A line that is too long to ever fit into a chunk is left in line_buf, and
+ * we return true; the caller must parse it.
+ */
+static bool
+CopyFromParallelReadChunk(CopyState cstate, CopyParallelState *pstate)
+{
+	if (pstate->have_pending_line)
+	{
+		CopyFromParallelAddLine(pstate, pstate->pending_line.data,
+								pstate->pending_line.len, pstate->lineno);
+		pstate->have_pending_line = false;
+	}
+
+	while (!pstate->input_done)
+	{
+		Size		linesize;
+
+		if (CopyReadLine(cstate))
+		{
+			pstate->input_done = true;
+			if (cstate->line_buf.len == 0)
+				break;
+		}
+		pstate->lineno++;
+
+		linesize = sizeof(int32) + cstate->line_buf.len;
+		if (sizeof(int) + linesize > pstate->max_chunk)
+		{
+			if (pstate->input_done && pstate->chunk_lines > 0)
+				pstate->chunk_full = true;
+			cstate->cur_lineno = pstate->lineno;
+			return true;
+		}
+
+		/* If the line doesn't fit, keep it for the next chunk */
+		if (pstate->chunk_lines > 0 &&
+			pstate->chunk.len + linesize > pstate->max_chunk)
+		{
+			resetStringInfo(&pstate->pending_line);
+			appendBinaryStringInfo(&pstate->pending_line,
+								   cstate->line_buf.data,
+								   cstate->line_buf.len);
+			pstate->have_pending_line = true;
+			pstate->chunk_full = true;
+			return false;
+		}
+
+		CopyFromParallelAddLine(pstate, cstate->line_buf.data,
+								cstate->line_buf.len, pstate->lineno);
+	}
+
+	if (pstate->chunk_lines > 0)
+		pstate->chunk_full = true;
+	return false;
+}
+
+/*
+ * Queue a chunk of lines to be parsed by ourselves.
+ */
+static void
+CopyFromParallelKeepChunk(CopyParallelState *pstate, const char *data,
+						  Size len)
+{
+	MemoryContext oldcontext = MemoryContextSwitchTo(pstate->mcxt);
+	StringInfo	chunk = makeStringInfo();
+
+	appendBinaryStringInfo(chunk, data, len);
+	pstate->local_chunks = lappend(pstate->local_chunks, chunk);
+	MemoryContextSwitchTo(oldcontext);
+}
+
+/*
+ * Give the full chunk to the next worker that has room for it.  If no
+ * worker is left to take it, we keep it for ourselves.  Returns false if
+ * all the workers' queues are full.
+ */
+static bool
+CopyFromParallelSendChunk(CopyParallelState *pstate)
+{
+	bool		any_sending = false;
+	int			i;
+
+	for (i = 0; i < pstate->nworkers; i++)
+	{
+		int			w = (pstate->nextworker + i) % pstate->nworkers;
+
+		if (!pstate->sending[w])
+			continue;
+		any_sending = true;
+
+		if (shm_mq_try_send(pstate->inqueue[w], pstate->chunk.len,
+							pstate->chunk.data) == SHM_MQ_SUCCESS)
+		{
+			pstate->nextworker = (w + 1) % pstate->nworkers;
+			pstate->chunk_lines = 0;
+			pstate->chunk_full = false;
+			return true;
+		}
+	}
+
+	if (!any_sending)
+	{
+		CopyFromParallelKeepChunk(pstate, pstate->chunk.data,
+								  pstate->chunk.len);
+		pstate->chunk_lines = 0;
+		pstate->chunk_full = false;
+		return true;
+	}
+
+	return false;
+}
+
+/*
+ * Take over the input queue of a worker that exited without ever reading
+ * it, because it failed to start or didn't get the lock on the table, and
+ * keep whatever chunks we've already sent it for ourselves.
+ */
+static void
+CopyFromParallelAdoptQueue(CopyParallelState *pstate, int worker)
+{
+	shm_mq	   *mq = pstate->inqueue[worker];
+	shm_mq_handle *mqh;
+	Size		nbytes;
+	void	   *data;
+
+	pstate->sending[worker] = false;
+
+	/* We're the only sender, so everything we sent is there to be read */
+	shm_mq_set_receiver(mq, MyProc);
+	mqh = shm_mq_attach(mq);
+	while (shm_mq_receive(mqh, &nbytes, &data, true) == SHM_MQ_SUCCESS)
+		CopyFromParallelKeepChunk(pstate, data, nbytes);
+	shm_mq_handle_free(mqh);
+	shm_mq_detach(mq);
+}
+
+/*
+ * Rethrow the error of any worker that has failed.
+ */
+static void
+CopyFromParallelCheck(CopyParallelState *pstate)
+{
+	ErrorContextCallback *save_context = error_context_stack;
+
+	/*
+	 * The worker's error already says which line it was parsing, so don't
+	 * let copy_in_error_callback add whichever line we happen to be on.
+	 */
+	Assert(save_context->callback == copy_in_error_callback);
+	error_context_stack = save_context->previous;
+	CheckParallelWorkers(pstate->pcxt);
+	error_context_stack = save_context;
+}
+
+/*
+ * Poll each worker's tuple queue once, starting where we left off last time.
+ * Returns NULL if no tuple is waiting.  Workers that have finished are
+ * dropped from the set of readers.
+ */
+static HeapTuple
+CopyFromParallelReceive(CopyState cstate, CopyParallelState *pstate)
+{
+	int			nvisited = 0;
+
+	while (nvisited < pstate->nreaders)
+	{
+		shm_mq_result res;
+		Size		nbytes;
+		void	   *data;
+
+		res = shm_mq_receive(pstate->reader[pstate->nextreader],
+							 &nbytes, &data, true);
+		if (res == SHM_MQ_SUCCESS)
+		{
+			HeapTuple	tuple;
+			Size		len = nbytes - MAXALIGN(sizeof(int));
+			int			lineno;
+
+			/* Move on, so that one busy worker doesn't starve the rest */
+			pstate->nextreader = (pstate->nextreader + 1) % pstate->nreaders;
+
+			memcpy(&lineno, data, sizeof(int));
+			tuple = (HeapTuple) palloc(HEAPTUPLESIZE + len);
+			tuple->t_len = len;
+			ItemPointerSetInvalid(&(tuple->t_self));
+			tuple->t_tableOid = InvalidOid;
+			tuple->t_data = (HeapTupleHeader) ((char *) tuple + HEAPTUPLESIZE);
+			memcpy(tuple->t_data, (char *) data + MAXALIGN(sizeof(int)), len);
+
+			/* We don't have the line, only its number */
+			cstate->cur_lineno = lineno;
+			cstate->line_buf_valid = false;
+
+			return tuple;
+		}
+
+		if (res == SHM_MQ_DETACHED)
+		{
+			int			worker = pstate->reader_worker[pstate->nextreader];
+
+			/* A worker that failed must not look like one that finished */
+			CopyFromParallelCheck(pstate);
+
+			if (pstate->sending[worker] &&
+				shm_mq_get_receiver(pstate->inqueue[worker]) == NULL)
+				CopyFromParallelAdoptQueue(pstate, worker);
+
+			shm_mq_handle_free(pstate->reader[pstate->nextreader]);
+			--pstate->nreaders;
+			memmove(&pstate->reader[pstate->nextreader],
+					&pstate->reader[pstate->nextreader + 1],
+					sizeof(shm_mq_handle *) *
+					(pstate->nreaders - pstate->nextreader));
+			memmove(&pstate->reader_worker[pstate->nextreader],
+					&pstate->reader_worker[pstate->nextreader + 1],
+					sizeof(int) * (pstate->nreaders - pstate->nextreader));
+			if (pstate->nextreader >= pstate->nreaders)
+				pstate->nextreader = 0;
+			continue;
+		}
+
+		pstate->nextreader = (pstate->nextreader + 1) % pstate->nreaders;
+		nvisited++;
+	}
+
+	return NULL;
+}
+
+/*
+ * Load the next line of the chunks we must parse ourselves into line_buf.
+ * Returns false if there is none.
+ */
+static bool
+CopyFromParallelLocalLine(CopyState cstate, CopyParallelState *pstate)
+{
+	StringInfo	chunk;
+
+	if (pstate->local_chunks == NIL)
+		return false;
+
+	chunk = (StringInfo) linitial(pstate->local_chunks);
+	if (pstate->local_pos == NULL)
+	{
+		memcpy(&pstate->local_lineno, chunk->data, sizeof(int));
+		pstate->local_pos = chunk->data + sizeof(int);
+		pstate->local_end = chunk->data + chunk->len;
+	}
+
+	cstate->cur_lineno = pstate->local_lineno++;
+	pstate->local_pos = CopyLoadChunkLine(cstate, pstate->local_pos);
+
+	if (pstate->local_pos >= pstate->local_end)
+	{
+		pstate->local_chunks = list_delete_first(pstate->local_chunks);
+		pfree(chunk->data);
+		pfree(chunk);
+		pstate->local_pos = NULL;
+	}
+
+	return true;
+}
+
+/*
+ * Return the next tuple of a parallel COPY FROM, formed in the current
+ * memory context, or NULL if all the input has been processed.
+ * cstate->cur_lineno is set to its line number.  values and nulls are
+ * workspace.
+ */
+static HeapTuple
+CopyFromParallelNext(CopyState cstate, CopyParallelState *pstate,
+					 Datum *values, bool *nulls)
+{
+	TupleDesc	tupDesc = RelationGetDescr(cstate->rel);
+	HeapTuple	tuple;
+	int			i;
+
+	for (;;)
+	{
+		/* Tuples the workers have finished come first, to make room */
+		tuple = CopyFromParallelReceive(cstate, pstate);
+		if (tuple != NULL)
+			return tuple;
+
+		/* Then any lines that were left to us */
+		if (CopyFromParallelLocalLine(cstate, pstate))
+			return CopyFromParseToTuple(cstate, tupDesc, values, nulls);
+
+		if (pstate->chunk_full)
+		{
+			/* Hand out the chunk we've filled, if anybody has room for it */
+			if (CopyFromParallelSendChunk(pstate))
+				continue;
+		}
+		else if (!pstate->input_done || pstate->have_pending_line)
+		{
+			/* Read another chunk, parsing any overlong line ourselves */
+			if (CopyFromParallelReadChunk(cstate, pstate))
+				return CopyFromParseToTuple(cstate, tupDesc, values, nulls);
+			continue;
+		}
+		else if (!pstate->queues_detached)
+		{
+			/* Let the workers know there's no more input */
+			for (i = 0; i < pstate->nworkers; i++)
+			{
+				if (pstate->sending[i])
+					shm_mq_detach(pstate->inqueue[i]);
+			}
+			pstate->queues_detached = true;
+			continue;
+		}
+		else if (pstate->nreaders == 0)
+			return NULL;
+
+		/* Nothing to do but wait for the workers */
+		WaitLatch(&MyProc->procLatch, -1L);
+		ResetLatch(&MyProc->procLatch);
+		CHECK_FOR_INTERRUPTS();
+		CopyFromParallelCheck(pstate);
+	}
+}
+
+/*
+ * Wait for the workers of a parallel COPY FROM to exit, and clean up.
+ */
+static void
+CopyFromParallelEnd(CopyParallelState *pstate)
+{
+	Assert(pstate->nreaders == 0 && pstate->local_chunks == NIL);
+
+	WaitForParallelWorkersToFinish(pstate->pcxt);
+	DestroyParallelContext(pstate->pcxt);
+
+	pfree(pstate->inqueue);
+	pfree(pstate->sending);
+	pfree(pstate->reader_worker);
+	pfree(pstate->reader);
+	pfree(pstate->chunk.data);
+	pfree(pstate->pending_line.data);
+	pfree(pstate);
+}
+
+/*
+ * ParallelCopyMain
+ *		Entry point for a parallel worker of a COPY FROM.
+ *
+ * We parse the chunks of lines the leader hands us until it detaches from
+ * our input queue, and send back the resulting tuples.  If we can't safely
+ * do anything useful, we return without ever reading our input queue; the
+ * leader then parses whatever it has sent us itself.
+ */
+void
+ParallelCopyMain(char *args, Size size)
+{
+	ParallelCopyHeader *header = (ParallelCopyHeader *) args;
+	shm_mq	   *inqueue;
+	shm_mq_handle *inqh;
+	shm_mq	   *outqueue = GetParallelWorkerQueue();
+	CopyState	cstate;
+	TupleDesc	tupDesc;
+	Datum	   *values;
+	bool	   *nulls;
+	int		   *attnums;
+	char	   *gucval;
+	MemoryContext tuplecontext;
+	ErrorContextCallback errcontext;
+	bool		leader_gone = false;
+	int			i;
+
+	/*
+	 * The leader holds RowExclusiveLock on the table.  Don't wait for a lock
+	 * of our own behind somebody queued for a conflicting one; see
+	 * ParallelQueryMain.
+	 */
+	if (!ConditionalLockRelationOid(header->relid, AccessShareLock))
+		return;
+
+	inqueue = (shm_mq *) (args + header->queue_offset +
+						  ParallelWorkerNumber * header->queue_size);
+	shm_mq_set_receiver(inqueue, MyProc);
+	inqh = shm_mq_attach(inqueue);
+
+	/* The input functions must behave exactly as in the leader */
+	gucval = args + header->gucs_offset;
+	for (i = 0; i < NUM_PARALLEL_COPY_GUCS; i++)
+	{
+		SetConfigOption(ParallelCopyGUCs[i], gucval,
+						PGC_USERSET, PGC_S_SESSION);
+		gucval += strlen(gucval) + 1;
+	}
+
+	PushActiveSnapshot(GetTransactionSnapshot());
+
+	/* Set up just enough of a CopyState to parse lines */
+	cstate = (CopyStateData *) palloc0(sizeof(CopyStateData));
+	cstate->rel = heap_open(header->relid, NoLock);
+	tupDesc = RelationGetDescr(cstate->rel);
+	Assert(header->nphysatts == tupDesc->natts);
+
+	attnums = (int *) (args + header->attnums_offset);
+	for (i = 0; i < header->natts; i++)
+		cstate->attnumlist = lappend_int(cstate->attnumlist, attnums[i]);
+	cstate->oids = header->oids;
+	cstate->file_has_oids = header->oids;
+	cstate->csv_mode = header->csv_mode;
+	cstate->delim = pstrdup(header->delim);
+	if (cstate->csv_mode)
+	{
+		cstate->quote = pstrdup(header->quote);
+		cstate->escape = pstrdup(header->escape);
+	}
+	cstate->null_print = pstrdup(args + header->null_print_offset);
+	cstate->null_print_len = strlen(cstate->null_print);
+	cstate->force_notnull_flags = (bool *)
+		palloc(tupDesc->natts * sizeof(bool));
+	memcpy(cstate->force_notnull_flags, args + header->force_notnull_offset,
+		   tupDesc->natts * sizeof(bool));
+	cstate->cur_relname = RelationGetRelationName(cstate->rel);
+	initStringInfo(&cstate->attribute_buf);
+	initStringInfo(&cstate->line_buf);
+
+	CopySetupScanning(cstate);
+	CopyFromSetupInput(cstate);
+
+	values = (Datum *) palloc(tupDesc->natts * sizeof(Datum));
+	nulls = (bool *) palloc(tupDesc->natts * sizeof(bool));
+
+	tuplecontext = AllocSetContextCreate(CurrentMemoryContext,
+										 "COPY worker",
+										 ALLOCSET_DEFAULT_MINSIZE,
+										 ALLOCSET_DEFAULT_INITSIZE,
+										 ALLOCSET_DEFAULT_MAXSIZE);
+
+	/* Set up callback to identify error line number */
+	errcontext.callback = copy_in_error_callback;
+	errcontext.arg = (void *) cstate;
+	errcontext.previous = error_context_stack;
+	error_context_stack = &errcontext;
+
+	while (!leader_gone)
+	{
+		Size		nbytes;
+		void	   *data;
+		char	   *pos;
+		char	   *end;
+		int			lineno;
+
+		if (shm_mq_receive(inqh, &nbytes, &data, false) != SHM_MQ_SUCCESS)
+			break;
+
+		memcpy(&lineno, data, sizeof(int));
+		pos = (char *) data + sizeof(int);
+		end = (char *) data + nbytes;
+
+		while (pos < end)
+		{
+			MemoryContext oldcontext;
+			HeapTuple	tuple;
+			char	   *msg;
+			Size		msglen;
+
+			CHECK_FOR_INTERRUPTS();
+
+			MemoryContextReset(tuplecontext);
+			oldcontext = MemoryContextSwitchTo(tuplecontext);
+
+			cstate->cur_lineno = lineno++;
+			pos = CopyLoadChunkLine(cstate, pos);
+			tuple = CopyFromParseToTuple(cstate, tupDesc, values, nulls);
+
+			msglen = MAXALIGN(sizeof(int)) + tuple->t_len;
+			msg = (char *) palloc(msglen);
+			memcpy(msg, &cstate->cur_lineno, sizeof(int));
+			memcpy(msg + MAXALIGN(sizeof(int)), tuple->t_data, tuple->t_len);
+
+			MemoryContextSwitchTo(oldcontext);
+
+			if (shm_mq_send(outqueue, msglen, msg) != SHM_MQ_SUCCESS)
+			{
+				leader_gone = true;
+				break;
+			}
+		}
+	}
+
+	error_context_stack = errcontext.previous;
+
+	MemoryContextDelete(tuplecontext);
+	shm_mq_handle_free(inqh);
+	heap_close(cstate->rel, NoLock);
+
+	PopActiveSnapshot();
+}
+
+
+/*
+ * Set up a set of special characters.  Zero bytes in the arguments are
+ * ignored, so that unused slots can be passed as '\0'.
+ */
+static void
+CopyInitSpecialChars(CopySpecialChars *sp, bool highbit,
+					 char c1, char c2, char c3, char c4, char c5)
+{
+	char		chars[COPY_MAX_SPECIAL];
+	int			i;
+
+	chars[0] = c1;
+	chars[1] = c2;
+	chars[2] = c3;
+	chars[3] = c4;
+	chars[4] = c5;
+
+	MemSet(sp->is_special, false, sizeof(sp->is_special));
+	sp->nchars = 0;
+	for (i = 0; i < COPY_MAX_SPECIAL; i++)
+	{
+		unsigned char c = (unsigned char) chars[i];
+
+		if (c == '\0' || sp->is_special[c])
+			continue;
+		sp->is_special[c] = true;
+		sp->chars[sp->nchars++] = (char) c;
+	}
+	Assert(sp->nchars > 0);
+
+	sp->highbit = highbit;
+	if (highbit)
+	{
+		for (i = 0x80; i < 256; i++)
+			sp->is_special[i] = true;
+	}
+}
+
+/*
+ * Set up the special characters of each parsing loop, once options and
+ * encodings are known.
+ *
+ * In raw input, we must stop at bytes with the high bit set if the client
+ * encoding can have ASCII bytes inside multibyte characters, so that
+ * CopyReadLineText can skip over whole characters.  line_buf is always in
+ * the server encoding, where that can't happen.
+ */
+static void
+CopySetupScanning(CopyState cstate)
+{
+	char		delimc = cstate->delim[0];
+
+	if (cstate->csv_mode)
+	{
+		char		quotec = cstate->quote[0];
+		char		escapec = cstate->escape[0];
+
+		CopyInitSpecialChars(&cstate->line_specials,
+							 cstate->encoding_embeds_ascii,
+							 '\n', '\r', '\\', quotec, escapec);
+		CopyInitSpecialChars(&cstate->field_specials, false,
+							 delimc, quotec, '\0', '\0', '\0');
+		CopyInitSpecialChars(&cstate->quoted_specials, false,
+							 quotec, escapec, '\0', '\0', '\0');
+	}
+	else
+	{
+		CopyInitSpecialChars(&cstate->line_specials,
+							 cstate->encoding_embeds_ascii,
+							 '\n', '\r', '\\', '\0', '\0');
+		CopyInitSpecialChars(&cstate->field_specials, false,
+							 delimc, '\\', '\0', '\0', '\0');
+	}
+}
+
+/*
+ * Return the offset of the first special character in buf[0..len), or len
+ * if there is none.
+ *
+ * This is where COPY FROM spends much of its time on wide rows, so where
+ * SSE2 is available we compare 16 bytes at a time against each special
+ * character and find the first hit from the resulting bitmask.  Whatever is
+ * left over is checked a byte at a time.
+ */
+static inline int
+CopyScanSpecial(const CopySpecialChars *sp, const char *buf, int len)
+{
+	int			i = 0;
+
+#ifdef USE_SSE2_COPY_SCAN
+	if (len >= 16)
+	{
+		__m128i		vchars[COPY_MAX_SPECIAL];
+		int			nchars = sp->nchars;
+		int			j;
+
+		for (j = 0; j < nchars; j++)
+			vchars[j] = _mm_set1_epi8(sp->chars[j]);
+
+		for (; i <= len - 16; i += 16)
+		{
+			__m128i		chunk = _mm_loadu_si128((const __m128i *) (buf + i));
+			__m128i		hits = _mm_cmpeq_epi8(chunk, vchars[0]);
+			unsigned int mask;
+
+			for (j = 1; j < nchars; j++)
+				hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, vchars[j]));
+			mask = _mm_movemask_epi8(hits);
+			if (sp->highbit)
+				mask |= _mm_movemask_epi8(chunk);
+
+			if (mask != 0)
+			{
+#ifdef __GNUC__
+				return i + __builtin_ctz(mask);
+#else
+				while ((mask & 1) == 0)
+				{
+					mask >>= 1;
+					i++;
+				}
+				return i;
+#endif
+			}
+		}
+	}
+#endif   /* USE_SSE2_COPY_SCAN */
+
+	for (; i < len; i++)
+	{
+		if (sp->is_special[(unsigned char) buf[i]])
+			break;
+	}
+	return i;
+}
+
+/*
+ * Read the next input line and stash it in line_buf, with conversion to
+ * server encoding.
+ *
+ * Result is true if read was terminated by EOF, false if terminated
+ * by newline.	The terminating newline or EOF marker is not included
+ * in the final value of line_buf.
+ */
+static bool
+CopyReadLine(CopyState cstate)
+{
+	bool		result;
+
+	resetStringInfo(&cstate->line_buf);
+	cstate->line_buf_valid = true;
+
+	/* Mark that encoding conversion hasn't occurred yet */
+	cstate->line_buf_converted = false;
+
+	/* Parse data and transfer into line_buf */
+	result = CopyReadLineText(cstate);
+
+	if (result)
+	{
+		/*
+		 * Reached EOF.  In protocol version 3, we should ignore anything
+		 * after \. up to the protocol end of copy data.  (XXX maybe better
+		 * not to treat \. as special?)
+		 */
+		if (cstate->copy_dest == COPY_NEW_FE)
+		{
+			do
+			{
+				cstate->raw_buf_index = cstate->raw_buf_len;
+			} while (CopyLoadRawBuf(cstate));
+		}
+	}
+	else
+	{
+		/*
+		 * If we didn't hit EOF, then we must have transferred the EOL marker
+		 * to line_buf along with the data.  Get rid of it.
+		 */
+		switch (cstate->eol_type)
+		{
+			case EOL_NL:
+				Assert(cstate->line_buf.len >= 1);
+				Assert(cstate->line_buf.data[cstate->line_buf.len - 1] == '\n');
+				cstate->line_buf.len--;
+				cstate->line_buf.data[cstate->line_buf.len] = '\0';
+				break;
+			case EOL_CR:
+				Assert(cstate->line_buf.len >= 1);
+				Assert(cstate->line_buf.data[cstate->line_buf.len - 1] == '\r');
+				cstate->line_buf.len--;
+				cstate->line_buf.data[cstate->line_buf.len] = '\0';
+				break;
+			case EOL_CRNL:
+				Assert(cstate->line_buf.len >= 2);
+				Assert(cstate->line_buf.data[cstate->line_buf.len - 2] == '\r');
+				Assert(cstate->line_buf.data[cstate->line_buf.len - 1] == '\n');
+				cstate->line_buf.len -= 2;
+				cstate->line_buf.data[cstate->line_buf.len] = '\0';
+				break;
+			case EOL_UNKNOWN:
+				/* shouldn't get here */
+				Assert(false);
+				break;
+		}
+	}
+
+	/* Done reading the line.  Convert it to server encoding. */
+	if (cstate->need_transcoding)
+	{
+		char	   *cvt;
+
+		cvt = pg_client_to_server(cstate->line_buf.data,
+								  cstate->line_buf.len);
+		if (cvt != cstate->line_buf.data)
+		{
+			/* transfer converted data back to line_buf */
+			resetStringInfo(&cstate->line_buf);
+			appendBinaryStringInfo(&cstate->line_buf, cvt, strlen(cvt));
+			pfree(cvt);
+		}
+	}
+
+	/* Now it's safe to use the buffer in error messages */
+	cstate->line_buf_converted = true;
+
+	return result;
+}
+
+/*
+ * CopyReadLineText - inner loop of CopyReadLine for text mode
+ */
+static bool
+CopyReadLineText(CopyState cstate)
+{
+	char	   *copy_raw_buf;
+	int			raw_buf_ptr;
+	int			copy_buf_len;
+	bool		need_data = false;
+	bool		hit_eof = false;
+	bool		result = false;
+	char		mblen_str[2];
+
+	/* CSV variables */
+	bool		first_char_in_line = true;
+	bool		in_quote = false,
+				last_was_esc = false;
+	char		quotec = '\0';
+	char		escapec = '\0';
+
+	if (cstate->csv_mode)
+	{
+		quotec = cstate->quote[0];
+		escapec = cstate->escape[0];
+		/* ignore special escape processing if it's the same as quotec */
+		if (quotec == escapec)
+			escapec = '\0';
+	}
+
+	mblen_str[1] = '\0';
+
+	/*
+	 * The objective of this loop is to transfer the entire next input line
+	 * into line_buf.  Hence, we only care for detecting newlines (\r and/or
+	 * \n) and the end-of-copy marker (\.).
 	 *
 	 * In CSV mode, \r and \n inside a quoted field are just part of the data
 	 * value and are put in line_buf.  We keep just enough state to know if we
@@ -2401,6 +3646,7 @@ CopyReadLineText(CopyState cstate)
 	for (;;)
 	{
 		int			prev_raw_ptr;
+		int			skip;
 		char		c;
 
 		/*
@@ -2438,6 +3684,22 @@ CopyReadLineText(CopyState cstate)
 			need_data = false;
 		}
 
+		/*
+		 * Skip over any run of characters that need no further thought.  In
+		 * CSV mode, they also end any escape sequence.
+		 */
+		skip = CopyScanSpecial(&cstate->line_specials,
+							   copy_raw_buf + raw_buf_ptr,
+							   copy_buf_len - raw_buf_ptr);
+		if (skip > 0)
+		{
+			raw_buf_ptr += skip;
+			first_char_in_line = false;
+			last_was_esc = false;
+			if (raw_buf_ptr >= copy_buf_len)
+				continue;
+		}
+
 		/* OK to fetch a character */
 		prev_raw_ptr = raw_buf_ptr;
 		c = copy_raw_buf[raw_buf_ptr++];
@@ -2793,6 +4055,14 @@ CopyReadAttributesText(CopyState cstate, int maxfields, char **fieldvals)
 		for (;;)
 		{
 			char		c;
+			int			n;
+
+			/* Copy any run of ordinary characters in one go */
+			n = CopyScanSpecial(&cstate->field_specials, cur_ptr,
+								line_end_ptr - cur_ptr);
+			memcpy(output_ptr, cur_ptr, n);
+			output_ptr += n;
+			cur_ptr += n;
 
 			end_ptr = cur_ptr;
 			if (cur_ptr >= line_end_ptr)
@@ -3014,10 +4284,18 @@ CopyReadAttributesCSV(CopyState cstate, int maxfields, char **fieldvals)
 		for (;;)
 		{
 			char		c;
+			int			n;
 
 			/* Not in quote */
 			for (;;)
 			{
+				/* Copy any run of ordinary characters in one go */
+				n = CopyScanSpecial(&cstate->field_specials, cur_ptr,
+									line_end_ptr - cur_ptr);
+				memcpy(output_ptr, cur_ptr, n);
+				output_ptr += n;
+				cur_ptr += n;
+
 				end_ptr = cur_ptr;
 				if (cur_ptr >= line_end_ptr)
 					goto endfield;
@@ -3041,6 +4319,12 @@ CopyReadAttributesCSV(CopyState cstate, int maxfields, char **fieldvals)
 			/* In quote */
 			for (;;)
 			{
+				n = CopyScanSpecial(&cstate->quoted_specials, cur_ptr,
+									line_end_ptr - cur_ptr);
+				memcpy(output_ptr, cur_ptr, n);
+				output_ptr += n;
+				cur_ptr += n;
+
 				end_ptr = cur_ptr;
 				if (cur_ptr >= line_end_ptr)
 					ereport(ERROR,
@@ -75,6 +75,8 @@ static void show_sort_keys(SortState *sortstate, List *ancestors,
 						   ExplainState *es);
 static void show_sort_info(SortState *sortstate, ExplainState *es);
 static void show_hash_info(HashState *hashstate, ExplainState *es);
+static void show_join_filter_info(ScanState *scanstate, List *ancestors,
+					  ExplainState *es);
 static const char *explain_get_index_name(Oid indexId);
 static void ExplainScanTarget(Scan *plan, ExplainState *es);
 static void ExplainMemberNodes(List *plans, PlanState **planstates,
@@ -671,7 +673,10 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			pname = sname = "Seq Scan";
 			break;
 		case T_IndexScan:
-			pname = sname = "Index Scan";
+			if (((IndexScan *) plan)->indexonly)
+				pname = sname = "Index Only Scan";
+			else
+				pname = sname = "Index Scan";
 			break;
 		case T_BitmapIndexScan:
 			pname = sname = "Bitmap Index Scan";
@@ -758,6 +763,9 @@ ExplainNode(PlanState *planstate, List *ancestors,
 		case T_Limit:
 			pname = sname = "Limit";
 			break;
+		case T_Gather:
+			pname = sname = "Gather";
+			break;
 		case T_Hash:
 			pname = sname = "Hash";
 			break;
@@ -1025,6 +1033,7 @@ ExplainNode(PlanState *planstate, List *ancestors,
 		case T_WorkTableScan:
 		case T_SubqueryScan:
 			show_scan_qual(plan->qual, "Filter", planstate, ancestors, es);
+			show_join_filter_info((ScanState *) planstate, ancestors, es);
 			break;
 		case T_FunctionScan:
 			if (es->verbose)
@@ -1082,6 +1091,10 @@ ExplainNode(PlanState *planstate, List *ancestors,
 		case T_Hash:
 			show_hash_info((HashState *) planstate, es);
 			break;
+		case T_Gather:
+			ExplainPropertyInteger("Workers Planned",
+								   ((Gather *) plan)->num_workers, es);
+			break;
 		default:
 			break;
 	}
@@ -1478,6 +1491,30 @@ show_hash_info(HashState *hashstate, ExplainState *es)
 	}
 }
 
+/*
+ * Show the Bloom filter that a hash join has pushed down to a scan, if any,
+ * and how many rows it removed
+ */
+static void
+show_join_filter_info(ScanState *scanstate, List *ancestors, ExplainState *es)
+{
+	HashJoinFilter filter = scanstate->ss_JoinFilter;
+	List	   *keys = NIL;
+	ListCell   *lc;
+
+	if (filter == NULL)
+		return;
+
+	foreach(lc, filter->keys)
+		keys = lappend(keys, ((ExprState *) lfirst(lc))->expr);
+	show_expression((Node *) keys, "Bloom Filter", (PlanState *) scanstate,
+					ancestors, es->verbose, es);
+
+	if (es->analyze && scanstate->ps.instrument)
+		ExplainPropertyFloat("Rows Removed by Bloom Filter",
+							 filter->ntotalrejected, 0, es);
+}
+
 /*
  * Fetch the name of an index in an EXPLAIN
  *
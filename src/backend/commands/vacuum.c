@@ -57,11 +57,15 @@ int			vacuum_freeze_table_age;
 static MemoryContext vac_context = NULL;
 static BufferAccessStrategy vac_strategy;
 
+/* Shared cost-based delay state of the parallel vacuum we're attached to */
+static VacuumSharedCostState *VacuumSharedCost = NULL;
+
 
 /* non-export function prototypes */
 static List *get_rel_oids(Oid relid, const RangeVar *vacrel,
 			 const char *stmttype);
 static void vac_truncate_clog(TransactionId frozenXID);
+static int	vacuum_shared_cost_nactive(void);
 static void vacuum_rel(Oid relid, VacuumStmt *vacstmt, bool do_toast,
 		   bool for_wraparound, bool *scanned_all);
 
@@ -104,6 +108,11 @@ vacuum(VacuumStmt *vacstmt, Oid relid, bool do_toast,
 		   !(vacstmt->options & (VACOPT_FULL | VACOPT_FREEZE)));
 	Assert((vacstmt->options & VACOPT_ANALYZE) || vacstmt->va_cols == NIL);
 
+	if ((vacstmt->options & VACOPT_FULL) && vacstmt->parallel_workers > 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("VACUUM option PARALLEL cannot be used with FULL")));
+
 	stmttype = (vacstmt->options & VACOPT_VACUUM) ? "VACUUM" : "ANALYZE";
 
 	/*
@@ -255,8 +264,12 @@ vacuum(VacuumStmt *vacstmt, Oid relid, bool do_toast,
 	}
 	PG_CATCH();
 	{
-		/* Make sure cost accounting is turned off after error */
+		/*
+		 * Make sure cost accounting is turned off after error, and forget
+		 * any parallel vacuum's shared state, which is going away too.
+		 */
 		VacuumCostActive = false;
+		VacuumSharedCost = NULL;
 		PG_RE_THROW();
 	}
 	PG_END_TRY();
@@ -817,13 +830,13 @@ vacuum_rel(Oid relid, VacuumStmt *vacstmt, bool do_toast, bool for_wraparound,
 		 *
 		 * Note: these flags remain set until CommitTransaction or
 		 * AbortTransaction.  We don't want to clear them until we reset
-		 * MyProc->xid/xmin, else OldestXmin might appear to go backwards,
+		 * MyPgXact->xid/xmin, else OldestXmin might appear to go backwards,
 		 * which is probably Not Good.
 		 */
 		LWLockAcquire(ProcArrayLock, LW_EXCLUSIVE);
-		MyProc->vacuumFlags |= PROC_IN_VACUUM;
+		MyPgXact->vacuumFlags |= PROC_IN_VACUUM;
 		if (for_wraparound)
-			MyProc->vacuumFlags |= PROC_VACUUM_FOR_WRAPAROUND;
+			MyPgXact->vacuumFlags |= PROC_VACUUM_FOR_WRAPAROUND;
 		LWLockRelease(ProcArrayLock);
 	}
 
@@ -1065,16 +1078,26 @@ vac_close_indexes(int nindexes, Relation *Irel, LOCKMODE lockmode)
 void
 vacuum_delay_point(void)
 {
+	int			limit = VacuumCostLimit;
+
 	/* Always check for interrupts */
 	CHECK_FOR_INTERRUPTS();
 
+	/*
+	 * In a parallel vacuum, the participants working at the moment split the
+	 * limit between them, so that together they do no more I/O than a single
+	 * vacuum would.
+	 */
+	if (VacuumCostActive && VacuumSharedCost != NULL)
+		limit = Max(limit / vacuum_shared_cost_nactive(), 1);
+
 	/* Nap if appropriate */
 	if (VacuumCostActive && !InterruptPending &&
-		VacuumCostBalance >= VacuumCostLimit)
+		VacuumCostBalance >= limit)
 	{
 		int			msec;
 
-		msec = VacuumCostDelay * VacuumCostBalance / VacuumCostLimit;
+		msec = VacuumCostDelay * VacuumCostBalance / limit;
 		if (msec > VacuumCostDelay * 4)
 			msec = VacuumCostDelay * 4;
 
@@ -1089,3 +1112,67 @@ vacuum_delay_point(void)
 		CHECK_FOR_INTERRUPTS();
 	}
 }
+
+/*
+ * vacuum_shared_cost_nactive --- # of participants of our parallel vacuum
+ *		that are attached at the moment, including us.
+ */
+static int
+vacuum_shared_cost_nactive(void)
+{
+	volatile VacuumSharedCostState *shared = VacuumSharedCost;
+	int			nactive;
+
+	SpinLockAcquire(&shared->mutex);
+	nactive = shared->nactive;
+	SpinLockRelease(&shared->mutex);
+
+	return Max(nactive, 1);
+}
+
+/*
+ * vacuum_shared_cost_init --- set up the shared state for a parallel vacuum.
+ */
+void
+vacuum_shared_cost_init(VacuumSharedCostState *shared)
+{
+	SpinLockInit(&shared->mutex);
+	shared->nactive = 0;
+}
+
+/*
+ * vacuum_shared_cost_attach --- start sharing the cost limit.
+ *
+ * Until vacuum_shared_cost_detach, vacuum_delay_point gives us only our
+ * share of the cost limit, among all participants attached at the time.
+ */
+void
+vacuum_shared_cost_attach(VacuumSharedCostState *shared)
+{
+	volatile VacuumSharedCostState *vshared = shared;
+
+	Assert(VacuumSharedCost == NULL);
+
+	SpinLockAcquire(&vshared->mutex);
+	vshared->nactive++;
+	SpinLockRelease(&vshared->mutex);
+
+	VacuumSharedCost = shared;
+}
+
+/*
+ * vacuum_shared_cost_detach --- stop sharing the cost limit.
+ */
+void
+vacuum_shared_cost_detach(void)
+{
+	volatile VacuumSharedCostState *shared = VacuumSharedCost;
+
+	Assert(shared != NULL);
+
+	SpinLockAcquire(&shared->mutex);
+	shared->nactive--;
+	SpinLockRelease(&shared->mutex);
+
+	VacuumSharedCost = NULL;
+}
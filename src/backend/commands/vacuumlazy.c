@@ -4,24 +4,37 @@
  *	  Concurrent ("lazy") vacuuming.
  *
  *
- * The major space usage for LAZY VACUUM is storage for the array of dead
- * tuple TIDs, with the next biggest need being storage for per-disk-page
- * free space info.  We want to ensure we can vacuum even the very largest
+ * The major space usage for LAZY VACUUM is storage for the TIDs of dead
+ * tuples, with the next biggest need being storage for per-disk-page free
+ * space info.  We want to ensure we can vacuum even the very largest
  * relations with finite memory space usage.  To do that, we set upper bounds
  * on the number of tuples and pages we will keep track of at once.
  *
  * We are willing to use at most maintenance_work_mem memory space to keep
- * track of dead tuples.  We initially allocate an array of TIDs of that size,
- * with an upper limit that depends on table size (this limit ensures we don't
- * allocate a huge area uselessly for vacuuming small tables).	If the array
- * threatens to overflow, we suspend the heap scan phase and perform a pass of
- * index cleanup and page compaction, then resume the heap scan with an empty
- * TID array.
+ * track of dead tuples.  The TIDs are kept per heap page: each page with dead
+ * tuples gets a small fixed-size entry, and its dead offsets are stored as
+ * either a sorted list or a bitmap over the page's line pointers, whichever
+ * is smaller.  A page full of dead tuples thus costs a few dozen bytes rather
+ * than six bytes per tuple, so a single pass of index cleanup normally covers
+ * the whole relation.  The storage is grown as needed, up to the memory
+ * limit.  If it threatens to overflow, we suspend the heap scan phase and
+ * perform a pass of index cleanup and page compaction, then resume the heap
+ * scan with an empty store.
  *
  * If we're processing a table with no indexes, we can just vacuum each page
  * as we go; there's no need to save up multiple tuples to minimize the number
  * of index scans performed.  So we don't use maintenance_work_mem memory for
- * the TID array, just enough to hold as many heap tuples as fit on one page.
+ * the TID store at all.
+ *
+ * With the PARALLEL option, the indexes are divided up between us and some
+ * parallel workers.  Each index stays with the same process for the whole
+ * VACUUM of the table, because ambulkdelete may pass private state on to the
+ * following ambulkdelete and amvacuumcleanup calls in the result struct.  The
+ * workers are started when the first index pass is due, and then wait for
+ * commands from us through an input queue: for each index pass we send them
+ * a copy of the dead tuple store, and at the end we tell them to do the
+ * cleanup pass and exit.  They report back the statistics of each index they
+ * processed.
  *
  *
  * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
@@ -47,12 +60,15 @@
 #include "miscadmin.h"
 #include "pgstat.h"
 #include "postmaster/autovacuum.h"
+#include "postmaster/parallelworker.h"
 #include "storage/bufmgr.h"
 #include "storage/freespace.h"
 #include "storage/lmgr.h"
+#include "storage/proc.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
 #include "utils/pg_rusage.h"
+#include "utils/snapmgr.h"
 #include "utils/tqual.h"
 
 
@@ -67,11 +83,15 @@
 #define REL_TRUNCATE_FRACTION	16
 
 /*
- * Guesstimation of number of dead tuples per page.  This is used to
- * provide an upper limit to memory allocated when vacuuming small
- * tables.
+ * Size of the data of one page in the dead tuple store, in uint16 words,
+ * when the page has as many dead tuples as can possibly fit on it.  That's
+ * the size of the bitmap, since a list of offsets is only used when it is
+ * the shorter of the two.
  */
-#define LAZY_ALLOC_TUPLES		MaxHeapTuplesPerPage
+#define DEAD_PAGE_MAX_WORDS		(MaxHeapTuplesPerPage / 16 + 1)
+
+/* Initial number of page entries to allocate in the dead tuple store */
+#define DEAD_PAGES_INITIAL		1024
 
 /*
  * Before we consider skipping a page that's marked as clean in
@@ -79,11 +99,129 @@
  */
 #define SKIP_PAGES_THRESHOLD	32
 
+/*
+ * The dead tuples of one heap page.  The page's dead offset numbers are kept
+ * in LVDeadTuples.words, starting at words[start].  They are stored either as
+ * a sorted list of nitems offset numbers, or as a bitmap in which bit
+ * (off % 16) of word (off / 16) is set for each dead offset off; the bitmap
+ * is used when it needs fewer words than the list.
+ */
+typedef struct LVDeadPage
+{
+	BlockNumber blkno;			/* heap page number */
+	uint32		start;			/* index of the page's first word in words[] */
+	uint16		nitems;			/* number of dead tuples on the page */
+	uint16		nwords;			/* number of words used in words[] */
+} LVDeadPage;
+
+#define LVDeadPageIsBitmap(dp)	((dp)->nwords < (dp)->nitems)
+
+/*
+ * Store of dead tuple TIDs.  Page entries are appended in block number order
+ * as the heap is scanned.  To look up a TID, lookup[] maps the block number,
+ * by linear interpolation between the first and last page in the store, to
+ * a short range of pages[] in which to search for it; see lazy_tid_reaped.
+ * lookup[] is allocated along with pages[], but only filled in before the
+ * first lookup after pages have been added.
+ */
+typedef struct LVDeadTuples
+{
+	LVDeadPage *pages;			/* array of page entries */
+	int		   *lookup;			/* page lookup table, maxpages + 1 entries */
+	uint16	   *words;			/* offset lists and bitmaps of the pages */
+	int			npages;			/* current # of page entries */
+	int			maxpages;		/* # of page entries allocated */
+	uint32		nwords;			/* current # of words used */
+	uint32		maxwords;		/* # of words allocated */
+	int			maxpages_limit; /* hard limits for maxpages and maxwords */
+	uint32		maxwords_limit;
+	Size		mem_limit;		/* memory we may use for all the arrays */
+	bool		lookup_valid;	/* is lookup[] up to date? */
+} LVDeadTuples;
+
+/*
+ * Layout of the argument area of a parallel index vacuum.  The header is
+ * followed by the OIDs of the indexes, in the order of the leader's Irel
+ * array, and by one input queue for each worker.  The leader's cost-based
+ * delay settings are passed on, and the participants working on indexes at
+ * any moment split the cost limit between them, so that together they are
+ * throttled like a single vacuum.
+ */
+typedef struct LVParallelHeader
+{
+	int			nindexes;
+	int			elevel;
+	int			cost_delay;
+	int			cost_limit;
+	int			cost_page_hit;
+	int			cost_page_miss;
+	int			cost_page_dirty;
+	VacuumSharedCostState cost;
+	Size		indexes_offset;
+	Size		queue_offset;
+	Size		queue_size;		/* size of each input queue */
+} LVParallelHeader;
+
+/*
+ * A command sent to the workers.  owner[] tells which worker is to process
+ * each index; -1 means the leader.  An LV_PARALLEL_BULKDELETE command is
+ * followed by the npages page entries and then the nwords words of the dead
+ * tuple store, split into messages of manageable size.
+ */
+typedef enum LVParallelCommandType
+{
+	LV_PARALLEL_BULKDELETE,		/* run ambulkdelete on our indexes */
+	LV_PARALLEL_CLEANUP			/* run amvacuumcleanup, then exit */
+} LVParallelCommandType;
+
+typedef struct LVParallelCommand
+{
+	LVParallelCommandType type;
+	bool		scanned_all;	/* copied from LVRelStats */
+	double		old_rel_tuples;
+	double		rel_tuples;
+	double		num_dead_tuples;
+	int			npages;			/* size of the dead tuple store */
+	uint32		nwords;
+	int			owner[1];		/* VARIABLE LENGTH ARRAY */
+} LVParallelCommand;
+
+/*
+ * A worker's report on one index it has processed.  Only the common part of
+ * the AM's result struct is sent; the worker keeps the whole thing for its
+ * next call on the index.  A "ready" message, sent once the worker has
+ * opened the indexes, has indexno -1.
+ */
+typedef struct LVParallelResult
+{
+	int			indexno;
+	bool		isnull;			/* amvacuumcleanup returned NULL */
+	IndexBulkDeleteResult stats;
+} LVParallelResult;
+
+/* Leader-side state of a parallel index vacuum */
+typedef struct LVParallelState
+{
+	ParallelContext *pcxt;
+	int			nworkers;		/* # of workers reserved */
+	int			nactive;		/* # of them taking part */
+	int		   *owner;			/* worker number of each index, or -1 */
+	int		   *nowned;			/* # of indexes of each worker */
+	shm_mq	  **inqueue;		/* command queue of each worker */
+	shm_mq_handle **reader;		/* result queue of each worker */
+	Size		max_message;	/* max size of a message on an input queue */
+	VacuumSharedCostState *cost;	/* shared cost-based delay state */
+} LVParallelState;
+
+/* Don't bother with workers unless each input queue gets at least this */
+#define PARALLEL_VACUUM_MIN_QUEUE_SIZE	4096
+
 typedef struct LVRelStats
 {
 	/* hasindex = true means two-pass strategy; false means one-pass */
 	bool		hasindex;
 	bool		scanned_all;	/* have we scanned all pages (this far)? */
+	bool		frozen_all;		/* ... or skipped only all-frozen ones? */
 	/* Overall statistics about rel */
 	BlockNumber rel_pages;
 	double		old_rel_tuples; /* previous value of pg_class.reltuples */
@@ -91,13 +229,14 @@ typedef struct LVRelStats
 	BlockNumber pages_removed;
 	double		tuples_deleted;
 	BlockNumber nonempty_pages; /* actually, last nonempty page + 1 */
-	/* List of TIDs of tuples we intend to delete */
-	/* NB: this list is ordered by TID address */
-	int			num_dead_tuples;	/* current # of entries */
-	int			max_dead_tuples;	/* # slots allocated in array */
-	ItemPointer dead_tuples;	/* array of ItemPointerData */
+	/* TIDs of tuples we intend to delete, and how many there are */
+	LVDeadTuples *dead_tuples;
+	double		num_dead_tuples;
 	int			num_index_scans;
 	TransactionId latestRemovedXid;
+	/* Parallel index vacuuming, started at the first index pass */
+	int			parallel_workers;	/* # of workers still to be requested */
+	LVParallelState *parallel;
 } LVRelStats;
 
 
@@ -109,27 +248,54 @@ static TransactionId FreezeLimit;
 
 static BufferAccessStrategy vac_strategy;
 
+static const XLogRecPtr InvalidXLogRecPtr = {0, 0};
+
 
 /* non-export function prototypes */
 static void lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 			   Relation *Irel, int nindexes, bool scan_all);
 static void lazy_vacuum_heap(Relation onerel, LVRelStats *vacrelstats);
+static bool lazy_tuple_is_frozen(HeapTupleHeader tuple);
+static void lazy_vacuum_all_indexes(Relation *Irel, int nindexes,
+						IndexBulkDeleteResult **indstats,
+						LVRelStats *vacrelstats);
+static void lazy_cleanup_all_indexes(Relation *Irel, int nindexes,
+						 IndexBulkDeleteResult **indstats,
+						 LVRelStats *vacrelstats);
 static void lazy_vacuum_index(Relation indrel,
 				  IndexBulkDeleteResult **stats,
 				  LVRelStats *vacrelstats);
-static void lazy_cleanup_index(Relation indrel,
+static IndexBulkDeleteResult *lazy_cleanup_index(Relation indrel,
 				   IndexBulkDeleteResult *stats,
 				   LVRelStats *vacrelstats);
-static int lazy_vacuum_page(Relation onerel, BlockNumber blkno, Buffer buffer,
-				 int tupindex, LVRelStats *vacrelstats);
+static void lazy_report_index_cleanup(Relation indrel,
+						  IndexBulkDeleteResult *stats, PGRUsage *ru0);
+static LVParallelState *lazy_begin_parallel(Relation *Irel, int nindexes,
+					int nworkers);
+static void lazy_end_parallel(LVParallelState *lps);
+static void lazy_parallel_send(LVParallelState *lps, int worker,
+				   const void *data, Size nbytes);
+static void lazy_parallel_send_command(LVParallelState *lps,
+						   LVParallelCommandType type, int nindexes,
+						   LVRelStats *vacrelstats);
+static LVParallelResult *lazy_parallel_receive(LVParallelState *lps,
+					  int worker);
+static void lazy_receive_data(shm_mq_handle *mqh, char *dest, Size nbytes);
+static void lazy_vacuum_page(Relation onerel, BlockNumber blkno, Buffer buffer,
+				 OffsetNumber *deadoffsets, int ndead,
+				 LVRelStats *vacrelstats);
 static void lazy_truncate_heap(Relation onerel, LVRelStats *vacrelstats);
 static BlockNumber count_nondeletable_pages(Relation onerel,
 						 LVRelStats *vacrelstats);
 static void lazy_space_alloc(LVRelStats *vacrelstats, BlockNumber relblocks);
-static void lazy_record_dead_tuple(LVRelStats *vacrelstats,
-					   ItemPointer itemptr);
+static void lazy_reset_dead_tuples(LVRelStats *vacrelstats);
+static bool lazy_dead_tuples_reserve(LVDeadTuples *dead);
+static void lazy_record_dead_page(LVRelStats *vacrelstats, BlockNumber blkno,
+					  OffsetNumber *deadoffsets, int ndead);
+static int lazy_dead_page_offsets(LVDeadTuples *dead, LVDeadPage *dp,
+					   OffsetNumber *deadoffsets);
+static void lazy_build_dead_lookup(LVDeadTuples *dead);
 static bool lazy_tid_reaped(ItemPointer itemptr, void *state);
-static int	vac_cmp_itemptr(const void *left, const void *right);
 
 
 /*
@@ -176,6 +342,7 @@ lazy_vacuum_rel(Relation onerel, VacuumStmt *vacstmt,
 	vacrelstats = (LVRelStats *) palloc0(sizeof(LVRelStats));
 
 	vacrelstats->scanned_all = true;	/* will be cleared if we skip a page */
+	vacrelstats->frozen_all = true;
 	vacrelstats->old_rel_tuples = onerel->rd_rel->reltuples;
 	vacrelstats->num_index_scans = 0;
 
@@ -183,6 +350,16 @@ lazy_vacuum_rel(Relation onerel, VacuumStmt *vacstmt,
 	vac_open_indexes(onerel, RowExclusiveLock, &nindexes, &Irel);
 	vacrelstats->hasindex = (nindexes > 0);
 
+	/*
+	 * Each index is vacuumed by one process, and we take our share, so
+	 * there's no use for more workers than indexes less one.
+	 */
+	vacrelstats->parallel_workers = Min(vacstmt->parallel_workers,
+										max_parallel_maintenance_workers);
+	vacrelstats->parallel_workers = Min(vacrelstats->parallel_workers,
+										nindexes - 1);
+	vacrelstats->parallel = NULL;
+
 	/* Do the vacuuming */
 	lazy_scan_heap(onerel, vacrelstats, Irel, nindexes, scan_all);
 
@@ -217,6 +394,18 @@ lazy_vacuum_rel(Relation onerel, VacuumStmt *vacstmt,
 							vacrelstats->rel_pages, vacrelstats->rel_tuples,
 							vacrelstats->hasindex,
 							FreezeLimit);
+	else if (vacrelstats->frozen_all)
+	{
+		/*
+		 * The pages we skipped have no unfrozen XIDs on them, so we can still
+		 * advance relfrozenxid; but leave relpages and reltuples alone.
+		 */
+		vac_update_relstats(onerel,
+							onerel->rd_rel->relpages,
+							onerel->rd_rel->reltuples,
+							vacrelstats->hasindex,
+							FreezeLimit);
+	}
 
 	/* report results to the stats collector, too */
 	pgstat_report_vacuum(RelationGetRelid(onerel),
@@ -308,10 +497,9 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 				nkeep,
 				nunused;
 	IndexBulkDeleteResult **indstats;
-	int			i;
 	PGRUsage	ru0;
 	Buffer		vmbuffer = InvalidBuffer;
-	BlockNumber all_visible_streak;
+	BlockNumber skippable_streak;
 
 	pg_rusage_init(&ru0);
 
@@ -334,7 +522,7 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 
 	lazy_space_alloc(vacrelstats, nblocks);
 
-	all_visible_streak = 0;
+	skippable_streak = 0;
 	for (blkno = 0; blkno < nblocks; blkno++)
 	{
 		Buffer		buf;
@@ -343,60 +531,65 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 					maxoff;
 		bool		tupgone,
 					hastup;
-		int			prev_dead_count;
+		OffsetNumber deadoffsets[MaxHeapTuplesPerPage];
+		int			ndead;
 		OffsetNumber frozen[MaxOffsetNumber];
 		int			nfrozen;
 		Size		freespace;
-		bool		all_visible_according_to_vm = false;
+		uint8		vmstatus;
+		bool		all_visible_according_to_vm;
+		bool		all_frozen_according_to_vm;
 		bool		all_visible;
+		bool		all_frozen;
+		TransactionId visibility_cutoff_xid;
 
 		/*
 		 * Skip pages that don't require vacuuming according to the visibility
-		 * map. But only if we've seen a streak of at least
-		 * SKIP_PAGES_THRESHOLD pages marked as clean. Since we're reading
-		 * sequentially, the OS should be doing readahead for us and there's
-		 * no gain in skipping a page now and then. You need a longer run of
-		 * consecutive skipped pages before it's worthwhile. Also, skipping
-		 * even a single page means that we can't update relfrozenxid or
-		 * reltuples, so we only want to do it if there's a good chance to
-		 * skip a goodly number of pages.
+		 * map: pages marked all-visible, or if we must scan_all, pages marked
+		 * all-frozen. But only if we've seen a streak of at least
+		 * SKIP_PAGES_THRESHOLD such pages. Since we're reading sequentially,
+		 * the OS should be doing readahead for us and there's no gain in
+		 * skipping a page now and then. You need a longer run of consecutive
+		 * skipped pages before it's worthwhile. Also, skipping even a single
+		 * page means that we can't update reltuples, nor relfrozenxid unless
+		 * the page is all-frozen, so we only want to do it if there's a good
+		 * chance to skip a goodly number of pages.
 		 */
-		if (!scan_all)
+		vmstatus = visibilitymap_get_status(onerel, blkno, &vmbuffer);
+		all_visible_according_to_vm =
+			(vmstatus & VISIBILITYMAP_ALL_VISIBLE) != 0;
+		all_frozen_according_to_vm =
+			(vmstatus & VISIBILITYMAP_ALL_FROZEN) != 0;
+		if (scan_all ? all_frozen_according_to_vm : all_visible_according_to_vm)
 		{
-			all_visible_according_to_vm =
-				visibilitymap_test(onerel, blkno, &vmbuffer);
-			if (all_visible_according_to_vm)
+			skippable_streak++;
+			if (skippable_streak >= SKIP_PAGES_THRESHOLD)
 			{
-				all_visible_streak++;
-				if (all_visible_streak >= SKIP_PAGES_THRESHOLD)
-				{
-					vacrelstats->scanned_all = false;
-					continue;
-				}
+				vacrelstats->scanned_all = false;
+				if (!all_frozen_according_to_vm)
+					vacrelstats->frozen_all = false;
+				continue;
 			}
-			else
-				all_visible_streak = 0;
 		}
+		else
+			skippable_streak = 0;
 
 		vacuum_delay_point();
 
 		scanned_pages++;
 
 		/*
-		 * If we are close to overrunning the available space for dead-tuple
-		 * TIDs, pause and do a cycle of vacuuming before we tackle this page.
+		 * If there might not be room for the dead-tuple TIDs of this page,
+		 * pause and do a cycle of vacuuming before we tackle it.
 		 */
-		if ((vacrelstats->max_dead_tuples - vacrelstats->num_dead_tuples) < MaxHeapTuplesPerPage &&
-			vacrelstats->num_dead_tuples > 0)
+		if (vacrelstats->hasindex &&
+			!lazy_dead_tuples_reserve(vacrelstats->dead_tuples))
 		{
 			/* Log cleanup info before we touch indexes */
 			vacuum_log_cleanup_info(onerel, vacrelstats);
 
 			/* Remove index entries */
-			for (i = 0; i < nindexes; i++)
-				lazy_vacuum_index(Irel[i],
-								  &indstats[i],
-								  vacrelstats);
+			lazy_vacuum_all_indexes(Irel, nindexes, indstats, vacrelstats);
 			/* Remove tuples from heap */
 			lazy_vacuum_heap(onerel, vacrelstats);
 
@@ -405,8 +598,12 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 			 * not to reset latestRemovedXid since we want that value to be
 			 * valid.
 			 */
-			vacrelstats->num_dead_tuples = 0;
+			lazy_reset_dead_tuples(vacrelstats);
 			vacrelstats->num_index_scans++;
+
+			/* An empty store always has room for one page */
+			if (!lazy_dead_tuples_reserve(vacrelstats->dead_tuples))
+				elog(ERROR, "could not reserve space for dead tuples");
 		}
 
 		buf = ReadBufferExtended(onerel, MAIN_FORKNUM, blkno,
@@ -472,13 +669,16 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 
 			LockBuffer(buf, BUFFER_LOCK_UNLOCK);
 
-			/* Update the visibility map */
-			if (!all_visible_according_to_vm)
+			/* Update the visibility map; an empty page is all-frozen, too */
+			if (!all_frozen_according_to_vm)
 			{
 				visibilitymap_pin(onerel, blkno, &vmbuffer);
 				LockBuffer(buf, BUFFER_LOCK_SHARE);
 				if (PageIsAllVisible(page))
-					visibilitymap_set(onerel, blkno, PageGetLSN(page), &vmbuffer);
+					visibilitymap_set(onerel, blkno, InvalidXLogRecPtr,
+									  &vmbuffer, InvalidTransactionId,
+									  VISIBILITYMAP_ALL_VISIBLE |
+									  VISIBILITYMAP_ALL_FROZEN);
 				LockBuffer(buf, BUFFER_LOCK_UNLOCK);
 			}
 
@@ -500,9 +700,11 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 		 * requiring freezing.
 		 */
 		all_visible = true;
+		all_frozen = true;
+		visibility_cutoff_xid = InvalidTransactionId;
 		nfrozen = 0;
 		hastup = false;
-		prev_dead_count = vacrelstats->num_dead_tuples;
+		ndead = 0;
 		maxoff = PageGetMaxOffsetNumber(page);
 		for (offnum = FirstOffsetNumber;
 			 offnum <= maxoff;
@@ -536,7 +738,7 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 			 */
 			if (ItemIdIsDead(itemid))
 			{
-				lazy_record_dead_tuple(vacrelstats, &(tuple.t_self));
+				deadoffsets[ndead++] = offnum;
 				all_visible = false;
 				continue;
 			}
@@ -610,6 +812,10 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 							all_visible = false;
 							break;
 						}
+
+						/* Track newest xmin on page, for WAL-logging */
+						if (TransactionIdFollows(xmin, visibility_cutoff_xid))
+							visibility_cutoff_xid = xmin;
 					}
 					break;
 				case HEAPTUPLE_RECENTLY_DEAD:
@@ -636,7 +842,7 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 
 			if (tupgone)
 			{
-				lazy_record_dead_tuple(vacrelstats, &(tuple.t_self));
+				deadoffsets[ndead++] = offnum;
 				HeapTupleHeaderAdvanceLatestRemovedXid(tuple.t_data,
 											 &vacrelstats->latestRemovedXid);
 				tups_vacuumed += 1;
@@ -653,6 +859,10 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 				if (heap_freeze_tuple(tuple.t_data, FreezeLimit,
 									  InvalidBuffer))
 					frozen[nfrozen++] = offnum;
+
+				/* Has it been frozen for good, now or earlier? */
+				if (all_frozen && !lazy_tuple_is_frozen(tuple.t_data))
+					all_frozen = false;
 			}
 		}						/* scan along page */
 
@@ -678,22 +888,18 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 
 		/*
 		 * If there are no indexes then we can vacuum the page right now
-		 * instead of doing a second scan.
+		 * instead of doing a second scan.  Otherwise remember the dead
+		 * tuples until the indexes have been cleaned of them.
 		 */
-		if (nindexes == 0 &&
-			vacrelstats->num_dead_tuples > 0)
+		if (nindexes == 0 && ndead > 0)
 		{
 			/* Remove tuples from heap */
-			lazy_vacuum_page(onerel, blkno, buf, 0, vacrelstats);
-
-			/*
-			 * Forget the now-vacuumed tuples, and press on, but be careful
-			 * not to reset latestRemovedXid since we want that value to be
-			 * valid.
-			 */
-			vacrelstats->num_dead_tuples = 0;
+			lazy_vacuum_page(onerel, blkno, buf, deadoffsets, ndead,
+							 vacrelstats);
 			vacuumed_pages++;
 		}
+		else if (ndead > 0)
+			lazy_record_dead_page(vacrelstats, blkno, deadoffsets, ndead);
 
 		freespace = PageGetHeapFreeSpace(page);
 
@@ -711,22 +917,36 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 			SetBufferCommitInfoNeedsSave(buf);
 
 			/*
-			 * Normally, we would drop the lock on the heap page before
-			 * updating the visibility map, but since this case shouldn't
-			 * happen anyway, don't worry about that.
+			 * Normally, we would pin the visibility map page before locking
+			 * the heap page, but since this case shouldn't happen anyway,
+			 * don't worry about doing the I/O while holding the lock.
 			 */
-			visibilitymap_clear(onerel, blkno);
+			visibilitymap_pin(onerel, blkno, &vmbuffer);
+			visibilitymap_clear(onerel, blkno, vmbuffer,
+								VISIBILITYMAP_VALID_BITS);
 		}
 
 		LockBuffer(buf, BUFFER_LOCK_UNLOCK);
 
-		/* Update the visibility map */
-		if (!all_visible_according_to_vm && all_visible)
+		/*
+		 * Update the visibility map.  If all tuples are frozen, set the
+		 * all-frozen bit as well, so that scan_all vacuums can skip the page
+		 * until it's modified again.
+		 */
+		if (all_visible &&
+			(!all_visible_according_to_vm ||
+			 (all_frozen && !all_frozen_according_to_vm)))
 		{
+			uint8		flags = VISIBILITYMAP_ALL_VISIBLE;
+
+			if (all_frozen)
+				flags |= VISIBILITYMAP_ALL_FROZEN;
+
 			visibilitymap_pin(onerel, blkno, &vmbuffer);
 			LockBuffer(buf, BUFFER_LOCK_SHARE);
 			if (PageIsAllVisible(page))
-				visibilitymap_set(onerel, blkno, PageGetLSN(page), &vmbuffer);
+				visibilitymap_set(onerel, blkno, InvalidXLogRecPtr, &vmbuffer,
+								  visibility_cutoff_xid, flags);
 			LockBuffer(buf, BUFFER_LOCK_UNLOCK);
 		}
 
@@ -743,7 +963,7 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 		 * page, so remember its free space as-is.	(This path will always be
 		 * taken if there are no indexes.)
 		 */
-		if (vacrelstats->num_dead_tuples == prev_dead_count)
+		if (nindexes == 0 || ndead == 0)
 			RecordPageWithFreeSpace(onerel, blkno, freespace);
 	}
 
@@ -759,10 +979,7 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 		vacuum_log_cleanup_info(onerel, vacrelstats);
 
 		/* Remove index entries */
-		for (i = 0; i < nindexes; i++)
-			lazy_vacuum_index(Irel[i],
-							  &indstats[i],
-							  vacrelstats);
+		lazy_vacuum_all_indexes(Irel, nindexes, indstats, vacrelstats);
 		/* Remove tuples from heap */
 		lazy_vacuum_heap(onerel, vacrelstats);
 		vacrelstats->num_index_scans++;
@@ -776,8 +993,7 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 	}
 
 	/* Do post-vacuum cleanup and statistics update for each index */
-	for (i = 0; i < nindexes; i++)
-		lazy_cleanup_index(Irel[i], indstats[i], vacrelstats);
+	lazy_cleanup_all_indexes(Irel, nindexes, indstats, vacrelstats);
 
 	/* If no indexes, make log report that lazy_vacuum_heap would've made */
 	if (vacuumed_pages)
@@ -801,6 +1017,33 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 }
 
 
+/*
+ *	lazy_tuple_is_frozen() -- does a tuple carry no normal XIDs any more?
+ *
+ *		Such a tuple needs no attention from future anti-wraparound vacuums,
+ *		so a page full of them can be marked all-frozen.  Hint bits don't
+ *		count, because they aren't WAL-logged: an XID that has been marked
+ *		invalid by a hint bit must still go before we consider the tuple
+ *		frozen.  MultiXactIds are never cleared by heap_freeze_tuple(), so a
+ *		tuple with one in xmax isn't frozen either.
+ */
+static bool
+lazy_tuple_is_frozen(HeapTupleHeader tuple)
+{
+	if (TransactionIdIsNormal(HeapTupleHeaderGetXmin(tuple)))
+		return false;
+
+	if ((tuple->t_infomask & HEAP_XMAX_IS_MULTI) ||
+		TransactionIdIsNormal(HeapTupleHeaderGetXmax(tuple)))
+		return false;
+
+	if ((tuple->t_infomask & HEAP_MOVED) &&
+		TransactionIdIsNormal(HeapTupleHeaderGetXvac(tuple)))
+		return false;
+
+	return true;
+}
+
 /*
  *	lazy_vacuum_heap() -- second pass over the heap
  *
@@ -815,42 +1058,46 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 static void
 lazy_vacuum_heap(Relation onerel, LVRelStats *vacrelstats)
 {
-	int			tupindex;
-	int			npages;
+	LVDeadTuples *dead = vacrelstats->dead_tuples;
+	int			pageindex;
+	double		ntuples;
 	PGRUsage	ru0;
 
 	pg_rusage_init(&ru0);
-	npages = 0;
+	ntuples = 0;
 
-	tupindex = 0;
-	while (tupindex < vacrelstats->num_dead_tuples)
+	for (pageindex = 0; pageindex < dead->npages; pageindex++)
 	{
-		BlockNumber tblk;
+		LVDeadPage *dp = &dead->pages[pageindex];
+		OffsetNumber deadoffsets[MaxHeapTuplesPerPage];
+		int			ndead;
 		Buffer		buf;
 		Page		page;
 		Size		freespace;
 
 		vacuum_delay_point();
 
-		tblk = ItemPointerGetBlockNumber(&vacrelstats->dead_tuples[tupindex]);
-		buf = ReadBufferExtended(onerel, MAIN_FORKNUM, tblk, RBM_NORMAL,
+		ndead = lazy_dead_page_offsets(dead, dp, deadoffsets);
+
+		buf = ReadBufferExtended(onerel, MAIN_FORKNUM, dp->blkno, RBM_NORMAL,
 								 vac_strategy);
 		LockBufferForCleanup(buf);
-		tupindex = lazy_vacuum_page(onerel, tblk, buf, tupindex, vacrelstats);
+		lazy_vacuum_page(onerel, dp->blkno, buf, deadoffsets, ndead,
+						 vacrelstats);
+		ntuples += ndead;
 
 		/* Now that we've compacted the page, record its available space */
 		page = BufferGetPage(buf);
 		freespace = PageGetHeapFreeSpace(page);
 
 		UnlockReleaseBuffer(buf);
-		RecordPageWithFreeSpace(onerel, tblk, freespace);
-		npages++;
+		RecordPageWithFreeSpace(onerel, dp->blkno, freespace);
 	}
 
 	ereport(elevel,
-			(errmsg("\"%s\": removed %d row versions in %d pages",
+			(errmsg("\"%s\": removed %.0f row versions in %d pages",
 					RelationGetRelationName(onerel),
-					tupindex, npages),
+					ntuples, dead->npages),
 			 errdetail("%s.",
 					   pg_rusage_show(&ru0))));
 }
@@ -861,33 +1108,25 @@ lazy_vacuum_heap(Relation onerel, LVRelStats *vacrelstats)
  *
  * Caller must hold pin and buffer cleanup lock on the buffer.
  *
- * tupindex is the index in vacrelstats->dead_tuples of the first dead
- * tuple for this page.  We assume the rest follow sequentially.
- * The return value is the first tupindex after the tuples of this page.
+ * deadoffsets is an array of the ndead offset numbers of the page's dead
+ * tuples.
  */
-static int
+static void
 lazy_vacuum_page(Relation onerel, BlockNumber blkno, Buffer buffer,
-				 int tupindex, LVRelStats *vacrelstats)
+				 OffsetNumber *deadoffsets, int ndead,
+				 LVRelStats *vacrelstats)
 {
 	Page		page = BufferGetPage(buffer);
-	OffsetNumber unused[MaxOffsetNumber];
-	int			uncnt = 0;
+	int			i;
 
 	START_CRIT_SECTION();
 
-	for (; tupindex < vacrelstats->num_dead_tuples; tupindex++)
+	for (i = 0; i < ndead; i++)
 	{
-		BlockNumber tblk;
-		OffsetNumber toff;
 		ItemId		itemid;
 
-		tblk = ItemPointerGetBlockNumber(&vacrelstats->dead_tuples[tupindex]);
-		if (tblk != blkno)
-			break;				/* past end of tuples for this block */
-		toff = ItemPointerGetOffsetNumber(&vacrelstats->dead_tuples[tupindex]);
-		itemid = PageGetItemId(page, toff);
+		itemid = PageGetItemId(page, deadoffsets[i]);
 		ItemIdSetUnused(itemid);
-		unused[uncnt++] = toff;
 	}
 
 	PageRepairFragmentation(page);
@@ -901,21 +1140,149 @@ lazy_vacuum_page(Relation onerel, BlockNumber blkno, Buffer buffer,
 
 		recptr = log_heap_clean(onerel, buffer,
 								NULL, 0, NULL, 0,
-								unused, uncnt,
+								deadoffsets, ndead,
 								vacrelstats->latestRemovedXid);
 		PageSetLSN(page, recptr);
 		PageSetTLI(page, ThisTimeLineID);
 	}
 
 	END_CRIT_SECTION();
+}
+
+/*
+ *	lazy_vacuum_all_indexes() -- remove the recorded dead tuples from all
+ *		the indexes of the relation.
+ *
+ *		If parallel workers were asked for, they are started now, unless
+ *		we already have them from an earlier pass.
+ */
+static void
+lazy_vacuum_all_indexes(Relation *Irel, int nindexes,
+						IndexBulkDeleteResult **indstats,
+						LVRelStats *vacrelstats)
+{
+	LVParallelState *lps;
+	PGRUsage	ru0;
+	int			i;
+
+	if (vacrelstats->parallel_workers > 0)
+	{
+		vacrelstats->parallel = lazy_begin_parallel(Irel, nindexes,
+											vacrelstats->parallel_workers);
+		vacrelstats->parallel_workers = 0;
+	}
+	lps = vacrelstats->parallel;
+
+	if (lps == NULL)
+	{
+		for (i = 0; i < nindexes; i++)
+			lazy_vacuum_index(Irel[i], &indstats[i], vacrelstats);
+		return;
+	}
+
+	/* Get the workers going, then do our own share */
+	pg_rusage_init(&ru0);
+	lazy_parallel_send_command(lps, LV_PARALLEL_BULKDELETE, nindexes,
+							   vacrelstats);
+	vacuum_shared_cost_attach(lps->cost);
+	for (i = 0; i < nindexes; i++)
+	{
+		if (lps->owner[i] < 0)
+			lazy_vacuum_index(Irel[i], &indstats[i], vacrelstats);
+	}
+	vacuum_shared_cost_detach();
+
+	/* Wait for the workers to report on their indexes */
+	for (i = 0; i < lps->nworkers; i++)
+	{
+		int			j;
+
+		for (j = 0; j < lps->nowned[i]; j++)
+		{
+			LVParallelResult *result = lazy_parallel_receive(lps, i);
+
+			ereport(elevel,
+					(errmsg("scanned index \"%s\" to remove %.0f row versions",
+							RelationGetRelationName(Irel[result->indexno]),
+							vacrelstats->num_dead_tuples),
+					 errdetail("%s.", pg_rusage_show(&ru0))));
+		}
+	}
+}
+
+/*
+ *	lazy_cleanup_all_indexes() -- do post-vacuum cleanup for all the indexes
+ *		of the relation, and shut down the parallel workers if any.
+ */
+static void
+lazy_cleanup_all_indexes(Relation *Irel, int nindexes,
+						 IndexBulkDeleteResult **indstats,
+						 LVRelStats *vacrelstats)
+{
+	LVParallelState *lps;
+	PGRUsage	ru0;
+	int			i;
+
+	/* If there was no index pass, the workers haven't been started yet */
+	if (vacrelstats->parallel_workers > 0)
+	{
+		vacrelstats->parallel = lazy_begin_parallel(Irel, nindexes,
+											vacrelstats->parallel_workers);
+		vacrelstats->parallel_workers = 0;
+	}
+	lps = vacrelstats->parallel;
+
+	pg_rusage_init(&ru0);
+	if (lps != NULL)
+	{
+		lazy_parallel_send_command(lps, LV_PARALLEL_CLEANUP, nindexes,
+								   vacrelstats);
+		vacuum_shared_cost_attach(lps->cost);
+	}
+
+	for (i = 0; i < nindexes; i++)
+	{
+		IndexBulkDeleteResult *stats;
+
+		if (lps != NULL && lps->owner[i] >= 0)
+			continue;
+
+		if (lps == NULL)
+			pg_rusage_init(&ru0);
+		stats = lazy_cleanup_index(Irel[i], indstats[i], vacrelstats);
+		if (stats != NULL)
+		{
+			lazy_report_index_cleanup(Irel[i], stats, &ru0);
+			pfree(stats);
+		}
+	}
+
+	if (lps == NULL)
+		return;
+	vacuum_shared_cost_detach();
+
+	for (i = 0; i < lps->nworkers; i++)
+	{
+		int			j;
 
-	return tupindex;
+		for (j = 0; j < lps->nowned[i]; j++)
+		{
+			LVParallelResult *result = lazy_parallel_receive(lps, i);
+
+			if (!result->isnull)
+				lazy_report_index_cleanup(Irel[result->indexno],
+										  &result->stats, &ru0);
+		}
+	}
+
+	lazy_end_parallel(lps);
+	vacrelstats->parallel = NULL;
 }
 
 /*
  *	lazy_vacuum_index() -- vacuum one index relation.
  *
- *		Delete all the index entries pointing to tuples listed in
+ *		Delete all the index entries pointing to tuples recorded in
  *		vacrelstats->dead_tuples, and update running statistics.
  */
 static void
@@ -940,7 +1307,7 @@ lazy_vacuum_index(Relation indrel,
 							   lazy_tid_reaped, (void *) vacrelstats);
 
 	ereport(elevel,
-			(errmsg("scanned index \"%s\" to remove %d row versions",
+			(errmsg("scanned index \"%s\" to remove %.0f row versions",
 					RelationGetRelationName(indrel),
 					vacrelstats->num_dead_tuples),
 			 errdetail("%s.", pg_rusage_show(&ru0))));
@@ -948,16 +1315,16 @@ lazy_vacuum_index(Relation indrel,
 
 /*
  *	lazy_cleanup_index() -- do post-vacuum cleanup for one index relation.
+ *
+ *		Returns the final statistics of the index, or NULL if the index AM
+ *		has none to offer.
  */
-static void
+static IndexBulkDeleteResult *
 lazy_cleanup_index(Relation indrel,
 				   IndexBulkDeleteResult *stats,
 				   LVRelStats *vacrelstats)
 {
 	IndexVacuumInfo ivinfo;
-	PGRUsage	ru0;
-
-	pg_rusage_init(&ru0);
 
 	ivinfo.index = indrel;
 	ivinfo.analyze_only = false;
@@ -967,11 +1334,17 @@ lazy_cleanup_index(Relation indrel,
 	ivinfo.num_heap_tuples = vacrelstats->scanned_all ? vacrelstats->rel_tuples : vacrelstats->old_rel_tuples;
 	ivinfo.strategy = vac_strategy;
 
-	stats = index_vacuum_cleanup(&ivinfo, stats);
-
-	if (!stats)
-		return;
+	return index_vacuum_cleanup(&ivinfo, stats);
+}
 
+/*
+ *	lazy_report_index_cleanup() -- update and report the statistics of an
+ *		index after its cleanup.
+ */
+static void
+lazy_report_index_cleanup(Relation indrel, IndexBulkDeleteResult *stats,
+						  PGRUsage *ru0)
+{
 	/*
 	 * Now update statistics in pg_class, but only if the index says the count
 	 * is accurate.
@@ -991,9 +1364,7 @@ lazy_cleanup_index(Relation indrel,
 					   "%s.",
 					   stats->tuples_removed,
 					   stats->pages_deleted, stats->pages_free,
-					   pg_rusage_show(&ru0))));
-
-	pfree(stats);
+					   pg_rusage_show(ru0))));
 }
 
 /*
@@ -1162,49 +1533,249 @@ count_nondeletable_pages(Relation onerel, LVRelStats *vacrelstats)
 static void
 lazy_space_alloc(LVRelStats *vacrelstats, BlockNumber relblocks)
 {
-	long		maxtuples;
+	LVDeadTuples *dead;
+	long		maxpages;
+	long		maxwords;
+
+	vacrelstats->dead_tuples = NULL;
+	vacrelstats->num_dead_tuples = 0;
+
+	/* With no indexes, each page is vacuumed as soon as it's scanned */
+	if (!vacrelstats->hasindex)
+		return;
+
+	dead = (LVDeadTuples *) palloc0(sizeof(LVDeadTuples));
+
+	/*
+	 * Stay sane if small maintenance_work_mem: we must always be able to
+	 * hold at least one page with the largest possible number of dead
+	 * tuples.
+	 */
+	dead->mem_limit = Max((Size) maintenance_work_mem * 1024L,
+						  sizeof(LVDeadPage) + 2 * sizeof(int) +
+						  DEAD_PAGE_MAX_WORDS * sizeof(uint16));
+
+	/*
+	 * No single array may exceed MaxAllocSize, and there's no point in
+	 * allowing for more pages than the relation has.  (The lookup table has
+	 * one more entry than pages[].)
+	 */
+	maxpages = MaxAllocSize / sizeof(LVDeadPage);
+	maxpages = Min(maxpages, INT_MAX - 1);
+	maxpages = Min(maxpages, (long) relblocks);
+	maxpages = Max(maxpages, 1);
+	dead->maxpages_limit = (int) maxpages;
+
+	maxwords = MaxAllocSize / sizeof(uint16);
+	/* curious coding here to ensure the multiplication can't overflow */
+	if ((BlockNumber) (maxwords / DEAD_PAGE_MAX_WORDS) > relblocks)
+		maxwords = relblocks * DEAD_PAGE_MAX_WORDS;
+	maxwords = Max(maxwords, DEAD_PAGE_MAX_WORDS);
+	dead->maxwords_limit = (uint32) maxwords;
+
+	/* Start out small; lazy_dead_tuples_reserve enlarges the arrays */
+	dead->maxpages = Min(dead->maxpages_limit, DEAD_PAGES_INITIAL);
+	dead->maxwords = Min(dead->maxwords_limit,
+						 (uint32) dead->maxpages * DEAD_PAGE_MAX_WORDS);
+	dead->pages = (LVDeadPage *) palloc(dead->maxpages * sizeof(LVDeadPage));
+	dead->lookup = (int *) palloc((dead->maxpages + 1) * sizeof(int));
+	dead->words = (uint16 *) palloc(dead->maxwords * sizeof(uint16));
+
+	vacrelstats->dead_tuples = dead;
+	lazy_reset_dead_tuples(vacrelstats);
+}
+
+/*
+ * lazy_reset_dead_tuples - forget all the recorded dead tuples
+ *
+ * The arrays are kept, so the next cycle needn't grow them all over again.
+ */
+static void
+lazy_reset_dead_tuples(LVRelStats *vacrelstats)
+{
+	LVDeadTuples *dead = vacrelstats->dead_tuples;
+
+	dead->npages = 0;
+	dead->nwords = 0;
+	dead->lookup_valid = false;
+	vacrelstats->num_dead_tuples = 0;
+}
+
+/*
+ * lazy_dead_tuples_reserve - make room for the dead tuples of one more page
+ *
+ * Ensures that one more page with the largest possible number of dead
+ * tuples can be added to the store, enlarging the arrays if that can be done
+ * within the memory limit.  Returns false if there isn't room.
+ */
+static bool
+lazy_dead_tuples_reserve(LVDeadTuples *dead)
+{
+	Size		pagesize = sizeof(LVDeadPage) + sizeof(int);
+	Size		pagesmem = dead->maxpages * pagesize + sizeof(int);
+	Size		wordsmem = dead->maxwords * sizeof(uint16);
+
+	if (dead->npages >= dead->maxpages)
+	{
+		Size		newmax;
+
+		/* Double the page arrays, but stay within the limits */
+		newmax = (Size) dead->maxpages * 2;
+		newmax = Min(newmax, (Size) dead->maxpages_limit);
+		if (dead->mem_limit < wordsmem + sizeof(int))
+			return false;
+		newmax = Min(newmax,
+					 (dead->mem_limit - wordsmem - sizeof(int)) / pagesize);
+		if (newmax <= (Size) dead->npages)
+			return false;
+
+		dead->maxpages = (int) newmax;
+		dead->pages = (LVDeadPage *)
+			repalloc(dead->pages, dead->maxpages * sizeof(LVDeadPage));
+		dead->lookup = (int *)
+			repalloc(dead->lookup, (dead->maxpages + 1) * sizeof(int));
+		pagesmem = dead->maxpages * pagesize + sizeof(int);
+	}
+
+	if (dead->maxwords - dead->nwords < DEAD_PAGE_MAX_WORDS)
+	{
+		Size		newmax;
+
+		/* Likewise for the word array */
+		newmax = (Size) dead->maxwords * 2;
+		newmax = Min(newmax, (Size) dead->maxwords_limit);
+		if (dead->mem_limit < pagesmem)
+			return false;
+		newmax = Min(newmax,
+					 (dead->mem_limit - pagesmem) / sizeof(uint16));
+		if (newmax < (Size) dead->nwords + DEAD_PAGE_MAX_WORDS)
+			return false;
+
+		dead->maxwords = (uint32) newmax;
+		dead->words = (uint16 *)
+			repalloc(dead->words, dead->maxwords * sizeof(uint16));
+	}
+
+	return true;
+}
+
+/*
+ * lazy_record_dead_page - remember the deletable tuples of one page
+ *
+ * deadoffsets must be in ascending order, and pages must be recorded in
+ * ascending block number order.  The caller must have made room for the
+ * page with lazy_dead_tuples_reserve.
+ */
+static void
+lazy_record_dead_page(LVRelStats *vacrelstats, BlockNumber blkno,
+					  OffsetNumber *deadoffsets, int ndead)
+{
+	LVDeadTuples *dead = vacrelstats->dead_tuples;
+	LVDeadPage *dp;
+	uint16	   *words;
+	int			bitmapwords;
+	int			i;
+
+	Assert(ndead > 0 && ndead <= MaxHeapTuplesPerPage);
+	Assert(dead->npages < dead->maxpages);
+	Assert(dead->npages == 0 || dead->pages[dead->npages - 1].blkno < blkno);
+
+	/* Use a bitmap if it is smaller than the list of offsets */
+	bitmapwords = deadoffsets[ndead - 1] / 16 + 1;
 
-	if (vacrelstats->hasindex)
+	dp = &dead->pages[dead->npages];
+	dp->blkno = blkno;
+	dp->start = dead->nwords;
+	dp->nitems = (uint16) ndead;
+	dp->nwords = (uint16) Min(bitmapwords, ndead);
+	Assert(dead->maxwords - dead->nwords >= dp->nwords);
+
+	words = &dead->words[dp->start];
+	if (LVDeadPageIsBitmap(dp))
+	{
+		memset(words, 0, dp->nwords * sizeof(uint16));
+		for (i = 0; i < ndead; i++)
+			words[deadoffsets[i] / 16] |= (uint16) 1 << (deadoffsets[i] % 16);
+	}
+	else
 	{
-		maxtuples = (maintenance_work_mem * 1024L) / sizeof(ItemPointerData);
-		maxtuples = Min(maxtuples, INT_MAX);
-		maxtuples = Min(maxtuples, MaxAllocSize / sizeof(ItemPointerData));
+		for (i = 0; i < ndead; i++)
+			words[i] = deadoffsets[i];
+	}
+
+	dead->nwords += dp->nwords;
+	dead->npages++;
+	dead->lookup_valid = false;
+	vacrelstats->num_dead_tuples += ndead;
+}
 
-		/* curious coding here to ensure the multiplication can't overflow */
-		if ((BlockNumber) (maxtuples / LAZY_ALLOC_TUPLES) > relblocks)
-			maxtuples = relblocks * LAZY_ALLOC_TUPLES;
+/*
+ * lazy_dead_page_offsets - extract the dead offsets of a page in the store
+ *
+ * The offsets are stored into deadoffsets[] in ascending order; the number
+ * of them is returned.
+ */
+static int
+lazy_dead_page_offsets(LVDeadTuples *dead, LVDeadPage *dp,
+					   OffsetNumber *deadoffsets)
+{
+	uint16	   *words = &dead->words[dp->start];
+	int			ndead = 0;
+	int			i;
 
-		/* stay sane if small maintenance_work_mem */
-		maxtuples = Max(maxtuples, MaxHeapTuplesPerPage);
+	if (LVDeadPageIsBitmap(dp))
+	{
+		for (i = 0; i < dp->nwords * 16; i++)
+		{
+			if (words[i / 16] & ((uint16) 1 << (i % 16)))
+				deadoffsets[ndead++] = (OffsetNumber) i;
+		}
 	}
 	else
 	{
-		maxtuples = MaxHeapTuplesPerPage;
+		for (i = 0; i < dp->nitems; i++)
+			deadoffsets[ndead++] = (OffsetNumber) words[i];
 	}
 
-	vacrelstats->num_dead_tuples = 0;
-	vacrelstats->max_dead_tuples = (int) maxtuples;
-	vacrelstats->dead_tuples = (ItemPointer)
-		palloc(maxtuples * sizeof(ItemPointerData));
+	Assert(ndead == dp->nitems);
+	return ndead;
 }
 
 /*
- * lazy_record_dead_tuple - remember one deletable tuple
+ * Map a block number to its slot in the lookup table of the dead tuple
+ * store.  The slots divide the range of blocks between the first and last
+ * page in the store into npages equal parts; when dead tuples are spread
+ * evenly over the table, that's about one page per slot.
+ */
+#define DEAD_LOOKUP_SLOT(dead, blk) \
+	((int) ((uint64) ((blk) - (dead)->pages[0].blkno) * (dead)->npages / \
+			((uint64) (dead)->pages[(dead)->npages - 1].blkno - \
+			 (dead)->pages[0].blkno + 1)))
+
+/*
+ * lazy_build_dead_lookup - fill in the lookup table of the dead tuple store
+ *
+ * Afterwards, lookup[k] is the index of the first page entry whose block
+ * falls in slot k or later, for k from 0 to npages; so the pages of slot k
+ * are pages[lookup[k]] up to, but not including, pages[lookup[k + 1]].
  */
 static void
-lazy_record_dead_tuple(LVRelStats *vacrelstats,
-					   ItemPointer itemptr)
+lazy_build_dead_lookup(LVDeadTuples *dead)
 {
-	/*
-	 * The array shouldn't overflow under normal behavior, but perhaps it
-	 * could if we are given a really small maintenance_work_mem. In that
-	 * case, just forget the last few tuples (we'll get 'em next time).
-	 */
-	if (vacrelstats->num_dead_tuples < vacrelstats->max_dead_tuples)
+	int			slot = 0;
+	int			i;
+
+	for (i = 0; i < dead->npages; i++)
 	{
-		vacrelstats->dead_tuples[vacrelstats->num_dead_tuples] = *itemptr;
-		vacrelstats->num_dead_tuples++;
+		int			pageslot = DEAD_LOOKUP_SLOT(dead, dead->pages[i].blkno);
+
+		while (slot <= pageslot)
+			dead->lookup[slot++] = i;
 	}
+	while (slot <= dead->npages)
+		dead->lookup[slot++] = dead->npages;
+
+	dead->lookup_valid = true;
 }
 
 /*
@@ -1212,49 +1783,567 @@ lazy_record_dead_tuple(LVRelStats *vacrelstats,
  *
  *		This has the right signature to be an IndexBulkDeleteCallback.
  *
- *		Assumes dead_tuples array is in sorted order.
+ *		The block is found through the lookup table, normally in a range of
+ *		one or two page entries, and the offset is then checked against the
+ *		page's bitmap or short list.  So this takes constant time, unlike a
+ *		binary search over all the dead TIDs.
  */
 static bool
 lazy_tid_reaped(ItemPointer itemptr, void *state)
 {
 	LVRelStats *vacrelstats = (LVRelStats *) state;
-	ItemPointer res;
+	LVDeadTuples *dead = vacrelstats->dead_tuples;
+	BlockNumber blkno = ItemPointerGetBlockNumber(itemptr);
+	OffsetNumber offnum = ItemPointerGetOffsetNumber(itemptr);
+	LVDeadPage *dp;
+	uint16	   *words;
+	int			slot;
+	int			lo,
+				hi;
+
+	if (dead->npages == 0 ||
+		blkno < dead->pages[0].blkno ||
+		blkno > dead->pages[dead->npages - 1].blkno)
+		return false;
+
+	if (!dead->lookup_valid)
+		lazy_build_dead_lookup(dead);
+
+	/* Binary search the pages of the block's slot */
+	slot = DEAD_LOOKUP_SLOT(dead, blkno);
+	lo = dead->lookup[slot];
+	hi = dead->lookup[slot + 1];
+	for (;;)
+	{
+		int			mid;
+
+		if (lo >= hi)
+			return false;
+		mid = lo + (hi - lo) / 2;
+		dp = &dead->pages[mid];
+		if (dp->blkno == blkno)
+			break;
+		if (dp->blkno < blkno)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
 
-	res = (ItemPointer) bsearch((void *) itemptr,
-								(void *) vacrelstats->dead_tuples,
-								vacrelstats->num_dead_tuples,
-								sizeof(ItemPointerData),
-								vac_cmp_itemptr);
+	words = &dead->words[dp->start];
+	if (LVDeadPageIsBitmap(dp))
+	{
+		if (offnum / 16 >= dp->nwords)
+			return false;
+		return (words[offnum / 16] & ((uint16) 1 << (offnum % 16))) != 0;
+	}
+	else
+	{
+		int			i;
 
-	return (res != NULL);
+		for (i = 0; i < dp->nitems && words[i] <= offnum; i++)
+		{
+			if (words[i] == offnum)
+				return true;
+		}
+		return false;
+	}
 }
 
+
 /*
- * Comparator routines for use with qsort() and bsearch().
+ * Routines for parallel index vacuuming
  */
-static int
-vac_cmp_itemptr(const void *left, const void *right)
+
+/*
+ * lazy_begin_parallel - start workers to vacuum some of the indexes
+ *
+ * Returns NULL if no workers can be had, in which case the caller does all
+ * the indexes itself.  Otherwise the indexes are divided up between us and
+ * the workers that managed to start, by size, largest first.
+ */
+static LVParallelState *
+lazy_begin_parallel(Relation *Irel, int nindexes, int nworkers)
+{
+	ParallelContext *pcxt;
+	LVParallelHeader *header;
+	LVParallelState *lps;
+	Oid		   *indexoids;
+	double	   *load;
+	bool	   *assigned;
+	char	   *args;
+	Size		argsize;
+	Size		size;
+	int			i;
+
+	if (!IsUnderPostmaster)
+		return NULL;
+
+	pcxt = CreateParallelContext(PARALLEL_ENTRY_VACUUM, nworkers);
+	args = ParallelContextArgumentSpace(pcxt, &argsize);
+	if (args == NULL)
+	{
+		DestroyParallelContext(pcxt);
+		return NULL;
+	}
+
+	/* Lay out the argument area, giving up if there's no room for queues */
+	header = (LVParallelHeader *) args;
+	size = MAXALIGN(sizeof(LVParallelHeader));
+	header->indexes_offset = size;
+	size += MAXALIGN(nindexes * sizeof(Oid));
+	header->queue_offset = size;
+
+	if (header->queue_offset >= argsize ||
+		(argsize - header->queue_offset) / pcxt->nworkers <
+		PARALLEL_VACUUM_MIN_QUEUE_SIZE)
+	{
+		DestroyParallelContext(pcxt);
+		return NULL;
+	}
+	header->queue_size = (argsize - header->queue_offset) / pcxt->nworkers;
+	header->queue_size -= header->queue_size % MAXIMUM_ALIGNOF;
+
+	/* Fill it in */
+	header->nindexes = nindexes;
+	header->elevel = elevel;
+	header->cost_delay = VacuumCostDelay;
+	header->cost_limit = VacuumCostLimit;
+	header->cost_page_hit = VacuumCostPageHit;
+	header->cost_page_miss = VacuumCostPageMiss;
+	header->cost_page_dirty = VacuumCostPageDirty;
+	vacuum_shared_cost_init(&header->cost);
+	indexoids = (Oid *) (args + header->indexes_offset);
+	for (i = 0; i < nindexes; i++)
+		indexoids[i] = RelationGetRelid(Irel[i]);
+
+	lps = (LVParallelState *) palloc0(sizeof(LVParallelState));
+	lps->pcxt = pcxt;
+	lps->nworkers = pcxt->nworkers;
+	lps->cost = &header->cost;
+	lps->owner = (int *) palloc(nindexes * sizeof(int));
+	lps->nowned = (int *) palloc0(lps->nworkers * sizeof(int));
+	lps->inqueue = (shm_mq **) palloc(lps->nworkers * sizeof(shm_mq *));
+	lps->reader = (shm_mq_handle **)
+		palloc(lps->nworkers * sizeof(shm_mq_handle *));
+	for (i = 0; i < lps->nworkers; i++)
+	{
+		lps->inqueue[i] = shm_mq_create(args + header->queue_offset +
+										i * header->queue_size,
+										header->queue_size);
+		shm_mq_set_sender(lps->inqueue[i], MyProc);
+	}
+
+	/*
+	 * A message can take up half of a queue, so that a worker can copy one
+	 * while the next one is being written.
+	 */
+	lps->max_message = header->queue_size / 2;
+	lps->max_message -= lps->max_message % MAXIMUM_ALIGNOF;
+
+	LaunchParallelWorkers(pcxt);
+
+	/*
+	 * Wait for each worker to say it's ready.  One that couldn't be started,
+	 * or couldn't lock the indexes, goes away without saying anything, and
+	 * simply gets no indexes.  Participant 0 is us, participant i + 1 is
+	 * worker i.
+	 */
+	load = (double *) palloc0((lps->nworkers + 1) * sizeof(double));
+	for (i = 0; i < lps->nworkers; i++)
+	{
+		lps->reader[i] = shm_mq_attach(ParallelWorkerQueue(pcxt, i));
+		if (lazy_parallel_receive(lps, i) != NULL)
+			lps->nactive++;
+		else
+			load[i + 1] = -1;	/* not taking part */
+	}
+
+	if (lps->nactive == 0)
+	{
+		pfree(load);
+		lazy_end_parallel(lps);
+		return NULL;
+	}
+
+	/* Give each index, largest first, to the participant with least work */
+	assigned = (bool *) palloc0(nindexes * sizeof(bool));
+	for (;;)
+	{
+		int			best = -1;
+		double		bestsize = 0;
+		int			p = 0;
+
+		for (i = 0; i < nindexes; i++)
+		{
+			double		indsize = (double) RelationGetNumberOfBlocks(Irel[i]);
+
+			if (!assigned[i] && (best < 0 || indsize > bestsize))
+			{
+				best = i;
+				bestsize = indsize;
+			}
+		}
+		if (best < 0)
+			break;
+
+		for (i = 1; i <= lps->nworkers; i++)
+		{
+			if (load[i] >= 0 && load[i] < load[p])
+				p = i;
+		}
+
+		assigned[best] = true;
+		load[p] += bestsize + 1;
+		lps->owner[best] = p - 1;
+		if (p > 0)
+			lps->nowned[p - 1]++;
+	}
+	pfree(assigned);
+	pfree(load);
+
+	ereport(elevel,
+			(errmsg("using %d parallel workers to vacuum %d indexes",
+					lps->nactive, nindexes)));
+
+	return lps;
+}
+
+/*
+ * lazy_end_parallel - wait for the workers to exit, and clean up
+ */
+static void
+lazy_end_parallel(LVParallelState *lps)
+{
+	int			i;
+
+	for (i = 0; i < lps->nworkers; i++)
+		shm_mq_detach(lps->inqueue[i]);
+	WaitForParallelWorkersToFinish(lps->pcxt);
+	DestroyParallelContext(lps->pcxt);
+
+	for (i = 0; i < lps->nworkers; i++)
+		shm_mq_handle_free(lps->reader[i]);
+	pfree(lps->reader);
+	pfree(lps->inqueue);
+	pfree(lps->nowned);
+	pfree(lps->owner);
+	pfree(lps);
+}
+
+/*
+ * lazy_parallel_send - send data to a worker, in as many messages as needed
+ *
+ * We never block on a full queue, but wait on our latch instead, so that
+ * the error of a worker that has failed gets noticed and rethrown.
+ */
+static void
+lazy_parallel_send(LVParallelState *lps, int worker,
+				   const void *data, Size nbytes)
+{
+	const char *pos = (const char *) data;
+
+	do
+	{
+		Size		chunk = Min(nbytes, lps->max_message);
+		shm_mq_result res;
+
+		res = shm_mq_try_send(lps->inqueue[worker], chunk, pos);
+		if (res == SHM_MQ_SUCCESS)
+		{
+			pos += chunk;
+			nbytes -= chunk;
+			continue;
+		}
+		if (res == SHM_MQ_DETACHED)
+		{
+			CheckParallelWorkers(lps->pcxt);
+			elog(ERROR, "parallel vacuum worker exited unexpectedly");
+		}
+
+		WaitLatch(&MyProc->procLatch, -1L);
+		ResetLatch(&MyProc->procLatch);
+		CHECK_FOR_INTERRUPTS();
+		CheckParallelWorkers(lps->pcxt);
+	} while (nbytes > 0);
+}
+
+/*
+ * lazy_parallel_send_command - send a command to all the active workers
+ *
+ * For LV_PARALLEL_BULKDELETE, the dead tuple store goes along with it.
+ */
+static void
+lazy_parallel_send_command(LVParallelState *lps, LVParallelCommandType type,
+						   int nindexes, LVRelStats *vacrelstats)
+{
+	LVDeadTuples *dead = vacrelstats->dead_tuples;
+	LVParallelCommand *cmd;
+	Size		cmdsize;
+	int			i;
+
+	cmdsize = offsetof(LVParallelCommand, owner) + nindexes * sizeof(int);
+	cmd = (LVParallelCommand *) palloc(cmdsize);
+	cmd->type = type;
+	cmd->scanned_all = vacrelstats->scanned_all;
+	cmd->old_rel_tuples = vacrelstats->old_rel_tuples;
+	cmd->rel_tuples = vacrelstats->rel_tuples;
+	cmd->num_dead_tuples = vacrelstats->num_dead_tuples;
+	cmd->npages = (type == LV_PARALLEL_BULKDELETE) ? dead->npages : 0;
+	cmd->nwords = (type == LV_PARALLEL_BULKDELETE) ? dead->nwords : 0;
+	memcpy(cmd->owner, lps->owner, nindexes * sizeof(int));
+
+	for (i = 0; i < lps->nworkers; i++)
+	{
+		if (lps->nowned[i] == 0)
+			continue;
+
+		lazy_parallel_send(lps, i, cmd, cmdsize);
+		if (cmd->npages > 0)
+			lazy_parallel_send(lps, i, dead->pages,
+							   cmd->npages * sizeof(LVDeadPage));
+		if (cmd->nwords > 0)
+			lazy_parallel_send(lps, i, dead->words,
+							   cmd->nwords * sizeof(uint16));
+	}
+
+	pfree(cmd);
+}
+
+/*
+ * lazy_parallel_receive - wait for the next result from a worker
+ *
+ * Returns NULL if the worker has gone away without an error.  That's only
+ * to be expected before it has said it's ready; afterwards, it's an error.
+ * The result is valid until the next call for the same worker.
+ */
+static LVParallelResult *
+lazy_parallel_receive(LVParallelState *lps, int worker)
+{
+	for (;;)
+	{
+		shm_mq_result res;
+		Size		nbytes;
+		void	   *data;
+
+		res = shm_mq_receive(lps->reader[worker], &nbytes, &data, true);
+		if (res == SHM_MQ_SUCCESS)
+		{
+			if (nbytes != sizeof(LVParallelResult))
+				elog(ERROR, "invalid message from parallel vacuum worker");
+			return (LVParallelResult *) data;
+		}
+		if (res == SHM_MQ_DETACHED)
+		{
+			/* A worker that failed must not look like one that bowed out */
+			CheckParallelWorkers(lps->pcxt);
+			if (lps->nowned != NULL && lps->nowned[worker] > 0)
+				elog(ERROR, "parallel vacuum worker exited unexpectedly");
+			return NULL;
+		}
+
+		WaitLatch(&MyProc->procLatch, -1L);
+		ResetLatch(&MyProc->procLatch);
+		CHECK_FOR_INTERRUPTS();
+		CheckParallelWorkers(lps->pcxt);
+	}
+}
+
+/*
+ * lazy_receive_data - read data sent by lazy_parallel_send into dest
+ */
+static void
+lazy_receive_data(shm_mq_handle *mqh, char *dest, Size nbytes)
+{
+	while (nbytes > 0)
+	{
+		Size		len;
+		void	   *data;
+
+		if (shm_mq_receive(mqh, &len, &data, false) != SHM_MQ_SUCCESS)
+			ereport(ERROR,
+					(errcode(ERRCODE_ADMIN_SHUTDOWN),
+					 errmsg("parallel vacuum leader has gone away")));
+		if (len > nbytes)
+			elog(ERROR, "invalid message from parallel vacuum leader");
+		memcpy(dest, data, len);
+		dest += len;
+		nbytes -= len;
+	}
+}
+
+/*
+ * ParallelVacuumMain
+ *		Entry point for a parallel worker vacuuming indexes.
+ *
+ * We process the indexes the leader assigns to us, keeping the result of
+ * each ambulkdelete call for the next call on the same index, until we're
+ * told to do the cleanup pass.  If we can't lock the indexes right away, we
+ * just return, and the leader does without us.
+ */
+void
+ParallelVacuumMain(char *args, Size size)
 {
-	BlockNumber lblk,
-				rblk;
-	OffsetNumber loff,
-				roff;
+	LVParallelHeader *header = (LVParallelHeader *) args;
+	Oid		   *indexoids = (Oid *) (args + header->indexes_offset);
+	int			nindexes = header->nindexes;
+	Relation   *Irel;
+	IndexBulkDeleteResult **indstats;
+	shm_mq	   *inqueue;
+	shm_mq_handle *inqh;
+	shm_mq	   *outqueue = GetParallelWorkerQueue();
+	LVParallelResult result;
+	bool		done = false;
+	int			i;
+
+	/*
+	 * The leader holds RowExclusiveLock on the indexes.  Don't wait for a
+	 * lock of our own behind somebody queued for a conflicting one; see
+	 * ParallelQueryMain.
+	 */
+	for (i = 0; i < nindexes; i++)
+	{
+		if (!ConditionalLockRelationOid(indexoids[i], RowExclusiveLock))
+			return;
+	}
+
+	/*
+	 * Like the leader, let other VACUUMs ignore our xmin, and set a snapshot
+	 * for any functions in the indexes; see vacuum_rel.
+	 */
+	LWLockAcquire(ProcArrayLock, LW_EXCLUSIVE);
+	MyPgXact->vacuumFlags |= PROC_IN_VACUUM;
+	LWLockRelease(ProcArrayLock);
+	PushActiveSnapshot(GetTransactionSnapshot());
+
+	elevel = header->elevel;
+	vac_strategy = GetAccessStrategy(BAS_VACUUM);
+	VacuumCostDelay = header->cost_delay;
+	VacuumCostLimit = header->cost_limit;
+	VacuumCostPageHit = header->cost_page_hit;
+	VacuumCostPageMiss = header->cost_page_miss;
+	VacuumCostPageDirty = header->cost_page_dirty;
+	VacuumCostActive = (VacuumCostDelay > 0);
+	VacuumCostBalance = 0;
+
+	Irel = (Relation *) palloc(nindexes * sizeof(Relation));
+	for (i = 0; i < nindexes; i++)
+		Irel[i] = index_open(indexoids[i], NoLock);
+	indstats = (IndexBulkDeleteResult **)
+		palloc0(nindexes * sizeof(IndexBulkDeleteResult *));
+
+	inqueue = (shm_mq *) (args + header->queue_offset +
+						  ParallelWorkerNumber * header->queue_size);
+	shm_mq_set_receiver(inqueue, MyProc);
+	inqh = shm_mq_attach(inqueue);
+
+	/* Tell the leader we're ready for work */
+	MemSet(&result, 0, sizeof(result));
+	result.indexno = -1;
+	if (shm_mq_send(outqueue, sizeof(result), &result) != SHM_MQ_SUCCESS)
+		done = true;
+
+	while (!done)
+	{
+		LVParallelCommand *cmd;
+		LVRelStats *vacrelstats;
+		Size		nbytes;
+		void	   *data;
+
+		if (shm_mq_receive(inqh, &nbytes, &data, false) != SHM_MQ_SUCCESS)
+			break;				/* leader has gone away */
+		if (nbytes != offsetof(LVParallelCommand, owner) +
+			nindexes * sizeof(int))
+			elog(ERROR, "invalid message from parallel vacuum leader");
+		cmd = (LVParallelCommand *) palloc(nbytes);
+		memcpy(cmd, data, nbytes);
+
+		vacrelstats = (LVRelStats *) palloc0(sizeof(LVRelStats));
+		vacrelstats->hasindex = true;
+		vacrelstats->scanned_all = cmd->scanned_all;
+		vacrelstats->old_rel_tuples = cmd->old_rel_tuples;
+		vacrelstats->rel_tuples = cmd->rel_tuples;
+		vacrelstats->num_dead_tuples = cmd->num_dead_tuples;
+
+		/* Share the cost limit with the others until we're done */
+		vacuum_shared_cost_attach(&header->cost);
+
+		if (cmd->type == LV_PARALLEL_BULKDELETE)
+		{
+			LVDeadTuples *dead;
+
+			/* Read in the leader's dead tuple store */
+			dead = (LVDeadTuples *) palloc0(sizeof(LVDeadTuples));
+			dead->npages = dead->maxpages = cmd->npages;
+			dead->nwords = dead->maxwords = cmd->nwords;
+			dead->pages = (LVDeadPage *)
+				palloc(Max(dead->npages, 1) * sizeof(LVDeadPage));
+			dead->lookup = (int *) palloc((dead->npages + 1) * sizeof(int));
+			dead->words = (uint16 *)
+				palloc(Max(dead->nwords, 1) * sizeof(uint16));
+			lazy_receive_data(inqh, (char *) dead->pages,
+							  dead->npages * sizeof(LVDeadPage));
+			lazy_receive_data(inqh, (char *) dead->words,
+							  dead->nwords * sizeof(uint16));
+			vacrelstats->dead_tuples = dead;
+
+			for (i = 0; i < nindexes; i++)
+			{
+				if (cmd->owner[i] != ParallelWorkerNumber)
+					continue;
+
+				lazy_vacuum_index(Irel[i], &indstats[i], vacrelstats);
+
+				result.indexno = i;
+				result.isnull = (indstats[i] == NULL);
+				if (indstats[i] != NULL)
+					result.stats = *indstats[i];
+				if (shm_mq_send(outqueue, sizeof(result), &result) !=
+					SHM_MQ_SUCCESS)
+					ereport(ERROR,
+							(errcode(ERRCODE_ADMIN_SHUTDOWN),
+							 errmsg("parallel vacuum leader has gone away")));
+			}
+
+			pfree(dead->pages);
+			pfree(dead->lookup);
+			pfree(dead->words);
+			pfree(dead);
+		}
+		else
+		{
+			for (i = 0; i < nindexes; i++)
+			{
+				IndexBulkDeleteResult *stats;
 
-	lblk = ItemPointerGetBlockNumber((ItemPointer) left);
-	rblk = ItemPointerGetBlockNumber((ItemPointer) right);
+				if (cmd->owner[i] != ParallelWorkerNumber)
+					continue;
+
+				stats = lazy_cleanup_index(Irel[i], indstats[i], vacrelstats);
+
+				MemSet(&result, 0, sizeof(result));
+				result.indexno = i;
+				result.isnull = (stats == NULL);
+				if (stats != NULL)
+					result.stats = *stats;
+				if (shm_mq_send(outqueue, sizeof(result), &result) !=
+					SHM_MQ_SUCCESS)
+					ereport(ERROR,
+							(errcode(ERRCODE_ADMIN_SHUTDOWN),
+							 errmsg("parallel vacuum leader has gone away")));
+			}
+			done = true;
+		}
 
-	if (lblk < rblk)
-		return -1;
-	if (lblk > rblk)
-		return 1;
+		vacuum_shared_cost_detach();
+		pfree(vacrelstats);
+		pfree(cmd);
+	}
 
-	loff = ItemPointerGetOffsetNumber((ItemPointer) left);
-	roff = ItemPointerGetOffsetNumber((ItemPointer) right);
+	shm_mq_handle_free(inqh);
+	shm_mq_detach(inqueue);
 
-	if (loff < roff)
-		return -1;
-	if (loff > roff)
-		return 1;
+	for (i = 0; i < nindexes; i++)
+		index_close(Irel[i], NoLock);
 
-	return 0;
+	PopActiveSnapshot();
 }
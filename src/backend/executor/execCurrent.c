@@ -259,8 +259,16 @@ search_plan_tree(PlanState *node, Oid table_oid)
 			/*
 			 * scan nodes can all be treated alike
 			 */
-		case T_SeqScanState:
 		case T_IndexScanState:
+
+			/*
+			 * An index-only scan returns virtual tuples built from the index
+			 * entries, which don't carry the heap TID we need.
+			 */
+			if (((IndexScanState *) node)->iss_IndexOnly)
+				break;
+			/* FALL THRU */
+		case T_SeqScanState:
 		case T_BitmapHeapScanState:
 		case T_TidScanState:
 			{
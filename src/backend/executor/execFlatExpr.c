@@ -0,0 +1,856 @@
+/*-------------------------------------------------------------------------
+ *
+ * execFlatExpr.c
+ *	  Flattened evaluation of expression state trees.
+ *
+ * ExecInitExpr() produces a tree of ExprState nodes, which execQual.c
+ * evaluates by recursing through their evalfunc pointers.  For the
+ * expressions a plan node evaluates once per row --- its quals and the
+ * non-trivial entries of its targetlist --- we additionally compile that
+ * tree into a flat array of steps, run by a single dispatch loop.  Each
+ * step stores its result directly where its consumer will look for it,
+ * typically an argument slot of the FunctionCallInfoData of the function
+ * it feeds, so there are no intermediate calls and no isDone bookkeeping.
+ * Column references are resolved to slot offsets up front, the slots are
+ * deformed once at the start, and the null checks of strict functions are
+ * done in the step that calls the function.
+ *
+ * Only the most common node types are flattened: Vars, Consts, plain
+ * function and operator calls, AND/OR/NOT, scalar IS [NOT] NULL and
+ * RelabelType.  Anything else becomes a step that calls ExecEvalExpr on
+ * the existing ExprState subtree, so every expression can be compiled; we
+ * just don't bother unless its root is one of the flattened node types.
+ * Expressions that might return a set are never compiled.
+ *
+ * Compilation happens in place: the root ExprState keeps its node type and
+ * children, so code that examines the state tree is unaffected, but its
+ * evalfunc is replaced by ExecEvalProgram.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "executor/execFlatExpr.h"
+#include "executor/executor.h"
+#include "miscadmin.h"
+#include "nodes/nodeFuncs.h"
+#include "optimizer/planmain.h"
+#include "pgstat.h"
+#include "utils/acl.h"
+#include "utils/builtins.h"
+#include "utils/lsyscache.h"
+
+
+/*
+ * Use computed gotos for dispatch where the compiler supports them; this
+ * gives the branch predictor one indirect jump per step rather than one
+ * shared jump for all of them.
+ */
+#if defined(__GNUC__)
+#define EEO_USE_COMPUTED_GOTO
+#endif
+
+/* Step opcodes.  Keep dispatch_table in ExecInterpProgram in sync! */
+typedef enum ExprStepOp
+{
+	EEOP_DONE,
+	EEOP_INNER_FETCHSOME,
+	EEOP_OUTER_FETCHSOME,
+	EEOP_SCAN_FETCHSOME,
+	EEOP_INNER_VAR,
+	EEOP_OUTER_VAR,
+	EEOP_SCAN_VAR,
+	EEOP_CONST,
+	EEOP_FUNC,
+	EEOP_FUNC_STRICT,
+	EEOP_BOOL_AND_FIRST,
+	EEOP_BOOL_AND,
+	EEOP_BOOL_AND_LAST,
+	EEOP_BOOL_OR_FIRST,
+	EEOP_BOOL_OR,
+	EEOP_BOOL_OR_LAST,
+	EEOP_BOOL_NOT,
+	EEOP_NULLTEST_ISNULL,
+	EEOP_NULLTEST_ISNOTNULL,
+	EEOP_EXPRSTATE
+} ExprStepOp;
+
+typedef struct ExprStep
+{
+	ExprStepOp	opcode;
+	Datum	   *resvalue;		/* where to store the step's result */
+	bool	   *resnull;
+	union
+	{
+		/* for EEOP_*_FETCHSOME */
+		struct
+		{
+			int			last_var;	/* highest attnum needed */
+		}			fetch;
+		/* for EEOP_*_VAR */
+		struct
+		{
+			int			attidx;		/* zero-based column number */
+		}			var;
+		/* for EEOP_CONST */
+		struct
+		{
+			Datum		value;
+			bool		isnull;
+		}			constval;
+		/* for EEOP_FUNC and EEOP_FUNC_STRICT */
+		struct
+		{
+			FunctionCallInfo fcinfo;	/* arguments are stored here */
+			int			nargs;
+		}			func;
+		/* for EEOP_BOOL_* */
+		struct
+		{
+			bool	   *anynull;	/* saw a null input so far? */
+			int			jumpdone;	/* step to jump to on early exit */
+		}			boolexpr;
+		/* for EEOP_EXPRSTATE */
+		struct
+		{
+			ExprState  *state;	/* subtree to evaluate the usual way */
+		}			exprstate;
+	}			d;
+} ExprStep;
+
+struct ExprProgram
+{
+	ExprStep   *steps;
+	int			nsteps;
+	int			maxsteps;
+	Datum		resvalue;		/* the expression's result */
+	bool		resnull;
+	/* checks postponed until the first evaluation */
+	bool		checked;
+	List	   *vars;			/* flattened Vars */
+	List	   *funcids;		/* OIDs of called functions */
+};
+
+typedef struct ExprProgram ExprProgram;
+
+static Datum ExecEvalProgram(ExprState *state, ExprContext *econtext,
+				bool *isNull, ExprDoneCond *isDone);
+static Datum ExecInterpProgram(ExprProgram *program, ExprContext *econtext,
+				  bool *isNull);
+static void ExecCheckProgram(ExprProgram *program, ExprContext *econtext);
+static void compile_state(ExprProgram *program, ExprState *state,
+			  Datum *resvalue, bool *resnull);
+static ExprStep *new_step(ExprProgram *program, ExprStepOp opcode,
+		 Datum *resvalue, bool *resnull);
+static bool max_var_walker(Node *node, int *lastvars);
+
+
+/*
+ * ExecCompileExpr
+ *		Compile an ExprState tree in place, if that's worthwhile.
+ *
+ * Returns true if the expression was compiled.  The program is allocated
+ * in the current memory context, which must live as long as the ExprState.
+ */
+bool
+ExecCompileExpr(ExprState *state)
+{
+	ExprProgram *program;
+	Node	   *expr;
+	int			lastvars[3];	/* inner, outer, scan */
+
+	if (state == NULL || state->evalfunc == ExecEvalProgram)
+		return false;
+	expr = (Node *) state->expr;
+	if (expr == NULL)
+		return false;
+
+	/* Only worth it if the root is something we flatten */
+	switch (nodeTag(expr))
+	{
+		case T_FuncExpr:
+		case T_OpExpr:
+		case T_BoolExpr:
+			break;
+		case T_NullTest:
+			if (((NullTest *) expr)->argisrow)
+				return false;
+			break;
+		default:
+			return false;
+	}
+
+	/* The steps assume one result per evaluation */
+	if (expression_returns_set(expr))
+		return false;
+
+	program = (ExprProgram *) palloc0(sizeof(ExprProgram));
+	program->maxsteps = 16;
+	program->steps = (ExprStep *) palloc(program->maxsteps * sizeof(ExprStep));
+
+	/* Deform each input tuple as far as needed, before anything else */
+	lastvars[0] = lastvars[1] = lastvars[2] = 0;
+	max_var_walker(expr, lastvars);
+	if (lastvars[0] > 0)
+		new_step(program, EEOP_INNER_FETCHSOME, NULL, NULL)->d.fetch.last_var =
+			lastvars[0];
+	if (lastvars[1] > 0)
+		new_step(program, EEOP_OUTER_FETCHSOME, NULL, NULL)->d.fetch.last_var =
+			lastvars[1];
+	if (lastvars[2] > 0)
+		new_step(program, EEOP_SCAN_FETCHSOME, NULL, NULL)->d.fetch.last_var =
+			lastvars[2];
+
+	compile_state(program, state, &program->resvalue, &program->resnull);
+	new_step(program, EEOP_DONE, NULL, NULL);
+
+	state->program = program;
+	state->evalfunc = ExecEvalProgram;
+
+	return true;
+}
+
+/*
+ * ExecCompilePlanExprs
+ *		Compile the quals and projection expressions of a plan node.
+ */
+void
+ExecCompilePlanExprs(PlanState *planstate)
+{
+	ListCell   *l;
+
+	foreach(l, planstate->qual)
+		ExecCompileExpr((ExprState *) lfirst(l));
+
+	switch (nodeTag(planstate))
+	{
+		case T_NestLoopState:
+		case T_MergeJoinState:
+		case T_HashJoinState:
+			foreach(l, ((JoinState *) planstate)->joinqual)
+				ExecCompileExpr((ExprState *) lfirst(l));
+			break;
+		default:
+			break;
+	}
+
+	/* Simple Vars are projected directly; only the rest need compiling */
+	if (planstate->ps_ProjInfo)
+	{
+		foreach(l, planstate->ps_ProjInfo->pi_targetlist)
+		{
+			GenericExprState *gstate = (GenericExprState *) lfirst(l);
+
+			ExecCompileExpr(gstate->arg);
+		}
+	}
+}
+
+/*
+ * ExecEvalProgram
+ *		evalfunc of a compiled ExprState
+ */
+static Datum
+ExecEvalProgram(ExprState *state, ExprContext *econtext,
+				bool *isNull, ExprDoneCond *isDone)
+{
+	ExprProgram *program = state->program;
+
+	/* Guard against stack overflow due to overly complex expressions */
+	check_stack_depth();
+
+	if (isDone)
+		*isDone = ExprSingleResult;
+
+	if (!program->checked)
+		ExecCheckProgram(program, econtext);
+
+	return ExecInterpProgram(program, econtext, isNull);
+}
+
+/*
+ * ExecCheckProgram
+ *		Checks done on first evaluation of a compiled expression.
+ *
+ * These are the checks ExecEvalVar and init_fcache would have done the
+ * first time through: that the columns we fetch still have the types the
+ * plan expects, and that we may call the functions.
+ */
+static void
+ExecCheckProgram(ExprProgram *program, ExprContext *econtext)
+{
+	ListCell   *l;
+
+	foreach(l, program->vars)
+	{
+		Var		   *variable = (Var *) lfirst(l);
+		AttrNumber	attnum = variable->varattno;
+		TupleTableSlot *slot;
+		TupleDesc	slot_tupdesc;
+		Form_pg_attribute attr;
+
+		switch (variable->varno)
+		{
+			case INNER:
+				slot = econtext->ecxt_innertuple;
+				break;
+			case OUTER:
+				slot = econtext->ecxt_outertuple;
+				break;
+			default:
+				slot = econtext->ecxt_scantuple;
+				break;
+		}
+
+		slot_tupdesc = slot->tts_tupleDescriptor;
+		if (attnum > slot_tupdesc->natts)		/* should never happen */
+			elog(ERROR, "attribute number %d exceeds number of columns %d",
+				 attnum, slot_tupdesc->natts);
+
+		attr = slot_tupdesc->attrs[attnum - 1];
+
+		/* can't check type if dropped, since atttypid is probably 0 */
+		if (!attr->attisdropped && variable->vartype != attr->atttypid)
+			ereport(ERROR,
+					(errmsg("attribute %d has wrong type", attnum),
+					 errdetail("Table has type %s, but query expects %s.",
+							   format_type_be(attr->atttypid),
+							   format_type_be(variable->vartype))));
+	}
+
+	foreach(l, program->funcids)
+	{
+		Oid			funcid = lfirst_oid(l);
+		AclResult	aclresult;
+
+		aclresult = pg_proc_aclcheck(funcid, GetUserId(), ACL_EXECUTE);
+		if (aclresult != ACLCHECK_OK)
+			aclcheck_error(aclresult, ACL_KIND_PROC, get_func_name(funcid));
+	}
+
+	program->checked = true;
+}
+
+/*
+ * ExecInterpProgram
+ *		Run the steps of a compiled expression.
+ */
+static Datum
+ExecInterpProgram(ExprProgram *program, ExprContext *econtext, bool *isNull)
+{
+	ExprStep   *op = program->steps;
+	TupleTableSlot *innerslot = econtext->ecxt_innertuple;
+	TupleTableSlot *outerslot = econtext->ecxt_outertuple;
+	TupleTableSlot *scanslot = econtext->ecxt_scantuple;
+
+#ifdef EEO_USE_COMPUTED_GOTO
+	static const void *const dispatch_table[] = {
+		&&CASE_EEOP_DONE,
+		&&CASE_EEOP_INNER_FETCHSOME,
+		&&CASE_EEOP_OUTER_FETCHSOME,
+		&&CASE_EEOP_SCAN_FETCHSOME,
+		&&CASE_EEOP_INNER_VAR,
+		&&CASE_EEOP_OUTER_VAR,
+		&&CASE_EEOP_SCAN_VAR,
+		&&CASE_EEOP_CONST,
+		&&CASE_EEOP_FUNC,
+		&&CASE_EEOP_FUNC_STRICT,
+		&&CASE_EEOP_BOOL_AND_FIRST,
+		&&CASE_EEOP_BOOL_AND,
+		&&CASE_EEOP_BOOL_AND_LAST,
+		&&CASE_EEOP_BOOL_OR_FIRST,
+		&&CASE_EEOP_BOOL_OR,
+		&&CASE_EEOP_BOOL_OR_LAST,
+		&&CASE_EEOP_BOOL_NOT,
+		&&CASE_EEOP_NULLTEST_ISNULL,
+		&&CASE_EEOP_NULLTEST_ISNOTNULL,
+		&&CASE_EEOP_EXPRSTATE
+	};
+
+#define EEO_SWITCH()		EEO_DISPATCH();
+#define EEO_CASE(name)		CASE_##name:
+#define EEO_DISPATCH()		goto *dispatch_table[op->opcode]
+#else
+#define EEO_SWITCH()		starteval: switch (op->opcode)
+#define EEO_CASE(name)		case name:
+#define EEO_DISPATCH()		goto starteval
+#endif
+
+#define EEO_NEXT() \
+	do { \
+		op++; \
+		EEO_DISPATCH(); \
+	} while (0)
+
+#define EEO_JUMP(stepno) \
+	do { \
+		op = &program->steps[stepno]; \
+		EEO_DISPATCH(); \
+	} while (0)
+
+	EEO_SWITCH()
+	{
+		EEO_CASE(EEOP_DONE)
+		{
+			goto out;
+		}
+
+		EEO_CASE(EEOP_INNER_FETCHSOME)
+		{
+			if (innerslot->tts_nvalid < op->d.fetch.last_var)
+				slot_getsomeattrs(innerslot, op->d.fetch.last_var);
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_OUTER_FETCHSOME)
+		{
+			if (outerslot->tts_nvalid < op->d.fetch.last_var)
+				slot_getsomeattrs(outerslot, op->d.fetch.last_var);
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_SCAN_FETCHSOME)
+		{
+			if (scanslot->tts_nvalid < op->d.fetch.last_var)
+				slot_getsomeattrs(scanslot, op->d.fetch.last_var);
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_INNER_VAR)
+		{
+			int			attidx = op->d.var.attidx;
+
+			*op->resvalue = innerslot->tts_values[attidx];
+			*op->resnull = innerslot->tts_isnull[attidx];
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_OUTER_VAR)
+		{
+			int			attidx = op->d.var.attidx;
+
+			*op->resvalue = outerslot->tts_values[attidx];
+			*op->resnull = outerslot->tts_isnull[attidx];
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_SCAN_VAR)
+		{
+			int			attidx = op->d.var.attidx;
+
+			*op->resvalue = scanslot->tts_values[attidx];
+			*op->resnull = scanslot->tts_isnull[attidx];
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_CONST)
+		{
+			*op->resvalue = op->d.constval.value;
+			*op->resnull = op->d.constval.isnull;
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_FUNC_STRICT)
+		{
+			FunctionCallInfo fcinfo = op->d.func.fcinfo;
+			int			i;
+
+			/* A strict function returns null for any null input */
+			for (i = 0; i < op->d.func.nargs; i++)
+			{
+				if (fcinfo->argnull[i])
+				{
+					*op->resvalue = (Datum) 0;
+					*op->resnull = true;
+					EEO_NEXT();
+				}
+			}
+		}
+		/* FALL THRU to call the function */
+
+		EEO_CASE(EEOP_FUNC)
+		{
+			FunctionCallInfo fcinfo = op->d.func.fcinfo;
+			PgStat_FunctionCallUsage fcusage;
+
+			pgstat_init_function_usage(fcinfo, &fcusage);
+
+			fcinfo->isnull = false;
+			*op->resvalue = FunctionCallInvoke(fcinfo);
+			*op->resnull = fcinfo->isnull;
+
+			pgstat_end_function_usage(&fcusage, true);
+			EEO_NEXT();
+		}
+
+		/*
+		 * AND: the result is false if any input is false, else null if any
+		 * input is null, else true.  Each input is evaluated into the AND's
+		 * own result, so once we see a false we can just jump to the end.
+		 */
+		EEO_CASE(EEOP_BOOL_AND_FIRST)
+		{
+			*op->d.boolexpr.anynull = false;
+		}
+		/* FALL THRU */
+
+		EEO_CASE(EEOP_BOOL_AND)
+		{
+			if (*op->resnull)
+				*op->d.boolexpr.anynull = true;
+			else if (!DatumGetBool(*op->resvalue))
+				EEO_JUMP(op->d.boolexpr.jumpdone);
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_BOOL_AND_LAST)
+		{
+			if (*op->resnull)
+			{
+				/* result is already null */
+			}
+			else if (!DatumGetBool(*op->resvalue))
+			{
+				/* result is already false */
+			}
+			else if (*op->d.boolexpr.anynull)
+			{
+				*op->resvalue = (Datum) 0;
+				*op->resnull = true;
+			}
+			EEO_NEXT();
+		}
+
+		/* OR is the same, with true and false exchanged */
+		EEO_CASE(EEOP_BOOL_OR_FIRST)
+		{
+			*op->d.boolexpr.anynull = false;
+		}
+		/* FALL THRU */
+
+		EEO_CASE(EEOP_BOOL_OR)
+		{
+			if (*op->resnull)
+				*op->d.boolexpr.anynull = true;
+			else if (DatumGetBool(*op->resvalue))
+				EEO_JUMP(op->d.boolexpr.jumpdone);
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_BOOL_OR_LAST)
+		{
+			if (*op->resnull)
+			{
+				/* result is already null */
+			}
+			else if (DatumGetBool(*op->resvalue))
+			{
+				/* result is already true */
+			}
+			else if (*op->d.boolexpr.anynull)
+			{
+				*op->resvalue = (Datum) 0;
+				*op->resnull = true;
+			}
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_BOOL_NOT)
+		{
+			/* NOT of null is null, so only flip non-null values */
+			if (!*op->resnull)
+				*op->resvalue = BoolGetDatum(!DatumGetBool(*op->resvalue));
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_NULLTEST_ISNULL)
+		{
+			*op->resvalue = BoolGetDatum(*op->resnull);
+			*op->resnull = false;
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_NULLTEST_ISNOTNULL)
+		{
+			*op->resvalue = BoolGetDatum(!*op->resnull);
+			*op->resnull = false;
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_EXPRSTATE)
+		{
+			*op->resvalue = ExecEvalExpr(op->d.exprstate.state, econtext,
+										 op->resnull, NULL);
+			EEO_NEXT();
+		}
+	}
+
+out:
+	*isNull = program->resnull;
+	return program->resvalue;
+}
+
+/*
+ * compile_state
+ *		Append the steps that evaluate state into *resvalue and *resnull.
+ */
+static void
+compile_state(ExprProgram *program, ExprState *state,
+			  Datum *resvalue, bool *resnull)
+{
+	Node	   *expr = (Node *) state->expr;
+
+	switch (nodeTag(expr))
+	{
+		case T_Var:
+			{
+				Var		   *variable = (Var *) expr;
+				ExprStepOp	opcode;
+
+				if (variable->varattno <= 0)
+					break;		/* system or whole-row Var */
+
+				switch (variable->varno)
+				{
+					case INNER:
+						opcode = EEOP_INNER_VAR;
+						break;
+					case OUTER:
+						opcode = EEOP_OUTER_VAR;
+						break;
+					default:
+						opcode = EEOP_SCAN_VAR;
+						break;
+				}
+				new_step(program, opcode, resvalue, resnull)->d.var.attidx =
+					variable->varattno - 1;
+				program->vars = lappend(program->vars, variable);
+				return;
+			}
+
+		case T_Const:
+			{
+				Const	   *con = (Const *) expr;
+				ExprStep   *step;
+
+				step = new_step(program, EEOP_CONST, resvalue, resnull);
+				step->d.constval.value = con->constvalue;
+				step->d.constval.isnull = con->constisnull;
+				return;
+			}
+
+		case T_FuncExpr:
+		case T_OpExpr:
+			{
+				FuncExprState *fstate = (FuncExprState *) state;
+				Oid			funcid;
+				FmgrInfo   *finfo;
+				FunctionCallInfo fcinfo;
+				int			nargs = list_length(fstate->args);
+				ExprStep   *step;
+				ListCell   *l;
+				int			i;
+
+				if (nargs > FUNC_MAX_ARGS)
+					break;		/* let ExecEvalFunc complain */
+
+				if (IsA(expr, FuncExpr))
+					funcid = ((FuncExpr *) expr)->funcid;
+				else
+				{
+					OpExpr	   *op = (OpExpr *) expr;
+
+					set_opfuncid(op);
+					funcid = op->opfuncid;
+				}
+
+				finfo = (FmgrInfo *) palloc0(sizeof(FmgrInfo));
+				fcinfo = (FunctionCallInfo) palloc0(sizeof(FunctionCallInfoData));
+				fmgr_info(funcid, finfo);
+				finfo->fn_expr = expr;
+				InitFunctionCallInfoData(*fcinfo, finfo, nargs, NULL, NULL);
+				program->funcids = lappend_oid(program->funcids, funcid);
+
+				/* Evaluate the arguments straight into fcinfo */
+				i = 0;
+				foreach(l, fstate->args)
+				{
+					compile_state(program, (ExprState *) lfirst(l),
+								  &fcinfo->arg[i], &fcinfo->argnull[i]);
+					i++;
+				}
+
+				step = new_step(program,
+								finfo->fn_strict && nargs > 0 ?
+								EEOP_FUNC_STRICT : EEOP_FUNC,
+								resvalue, resnull);
+				step->d.func.fcinfo = fcinfo;
+				step->d.func.nargs = nargs;
+				return;
+			}
+
+		case T_BoolExpr:
+			{
+				BoolExprState *bstate = (BoolExprState *) state;
+				BoolExprType boolop = ((BoolExpr *) expr)->boolop;
+				bool	   *anynull;
+				List	   *jumps = NIL;
+				ListCell   *l;
+
+				if (boolop == NOT_EXPR)
+				{
+					compile_state(program,
+								  (ExprState *) linitial(bstate->args),
+								  resvalue, resnull);
+					new_step(program, EEOP_BOOL_NOT, resvalue, resnull);
+					return;
+				}
+
+				/* The steps below assume distinct first and last inputs */
+				if (list_length(bstate->args) < 2)
+					break;
+
+				anynull = (bool *) palloc(sizeof(bool));
+				foreach(l, bstate->args)
+				{
+					ExprStepOp	opcode;
+					ExprStep   *step;
+
+					compile_state(program, (ExprState *) lfirst(l),
+								  resvalue, resnull);
+
+					if (boolop == AND_EXPR)
+					{
+						if (l == list_head(bstate->args))
+							opcode = EEOP_BOOL_AND_FIRST;
+						else if (lnext(l) == NULL)
+							opcode = EEOP_BOOL_AND_LAST;
+						else
+							opcode = EEOP_BOOL_AND;
+					}
+					else
+					{
+						if (l == list_head(bstate->args))
+							opcode = EEOP_BOOL_OR_FIRST;
+						else if (lnext(l) == NULL)
+							opcode = EEOP_BOOL_OR_LAST;
+						else
+							opcode = EEOP_BOOL_OR;
+					}
+
+					step = new_step(program, opcode, resvalue, resnull);
+					step->d.boolexpr.anynull = anynull;
+					step->d.boolexpr.jumpdone = -1;
+					jumps = lappend_int(jumps, program->nsteps - 1);
+				}
+
+				/* Early exits go to the step after the last one */
+				foreach(l, jumps)
+					program->steps[lfirst_int(l)].d.boolexpr.jumpdone =
+						program->nsteps;
+				list_free(jumps);
+				return;
+			}
+
+		case T_NullTest:
+			{
+				NullTestState *nstate = (NullTestState *) state;
+				NullTest   *ntest = (NullTest *) expr;
+
+				if (ntest->argisrow)
+					break;
+
+				compile_state(program, nstate->arg, resvalue, resnull);
+				new_step(program,
+						 ntest->nulltesttype == IS_NULL ?
+						 EEOP_NULLTEST_ISNULL : EEOP_NULLTEST_ISNOTNULL,
+						 resvalue, resnull);
+				return;
+			}
+
+		case T_RelabelType:
+			compile_state(program, ((GenericExprState *) state)->arg,
+						  resvalue, resnull);
+			return;
+
+		default:
+			break;
+	}
+
+	/* Anything else is evaluated the usual way */
+	new_step(program, EEOP_EXPRSTATE, resvalue, resnull)->d.exprstate.state =
+		state;
+}
+
+/*
+ * new_step
+ *		Append a step to the program, and return it.
+ */
+static ExprStep *
+new_step(ExprProgram *program, ExprStepOp opcode,
+		 Datum *resvalue, bool *resnull)
+{
+	ExprStep   *step;
+
+	if (program->nsteps >= program->maxsteps)
+	{
+		program->maxsteps *= 2;
+		program->steps = (ExprStep *)
+			repalloc(program->steps, program->maxsteps * sizeof(ExprStep));
+	}
+	step = &program->steps[program->nsteps++];
+	step->opcode = opcode;
+	step->resvalue = resvalue;
+	step->resnull = resnull;
+
+	return step;
+}
+
+/*
+ * max_var_walker
+ *		Find the highest attribute number referenced from each input tuple.
+ *
+ * This may see Vars that end up inside an EEOP_EXPRSTATE subtree, which
+ * is harmless: they'd be fetched anyway if that subtree is evaluated.  We
+ * don't descend into subplans, whose Vars refer to their own inputs, nor
+ * into aggregate and window function arguments, which are not evaluated
+ * in this expression's context at all.
+ */
+static bool
+max_var_walker(Node *node, int *lastvars)
+{
+	if (node == NULL)
+		return false;
+	if (IsA(node, Var))
+	{
+		Var		   *variable = (Var *) node;
+		int			which;
+
+		if (variable->varattno <= 0)
+			return false;
+		switch (variable->varno)
+		{
+			case INNER:
+				which = 0;
+				break;
+			case OUTER:
+				which = 1;
+				break;
+			default:
+				which = 2;
+				break;
+		}
+		lastvars[which] = Max(lastvars[which], variable->varattno);
+		return false;
+	}
+	if (IsA(node, SubPlan) || IsA(node, AlternativeSubPlan) ||
+		IsA(node, Aggref) || IsA(node, WindowFunc))
+		return false;
+	return expression_tree_walker(node, max_var_walker, (void *) lastvars);
+}
@@ -0,0 +1,490 @@
+/*-------------------------------------------------------------------------
+ *
+ * execParallel.c
+ *	  Support routines for running part of a plan in parallel workers
+ *
+ * The leader, in ExecInitParallelPlan, writes everything a worker needs
+ * to run its copy of a parallel-aware plan into the argument area of a
+ * parallel context: the shared scan state, the leader's snapshot, and the
+ * plan itself.  Each worker, in ParallelQueryMain, rebuilds the plan, runs
+ * it with that snapshot, and sends the resulting tuples to the leader
+ * through its tuple queue.
+ *
+ * Plan nodes can't be read back from their string representation, so
+ * what we ship are the scanned relations and the expression lists of the
+ * plan nodes.  The planner only puts two shapes of plan below a Gather
+ * node: a parallel-aware SeqScan, or a parallel-aware HashJoin of two of
+ * them, whose shared hash table lives in working space that the leader
+ * reserves in the parallel context.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/relscan.h"
+#include "executor/execParallel.h"
+#include "executor/executor.h"
+#include "executor/hashjoin.h"
+#include "executor/nodeHash.h"
+#include "executor/nodeHashjoin.h"
+#include "executor/nodeSeqscan.h"
+#include "executor/tqueue.h"
+#include "miscadmin.h"
+#include "nodes/makefuncs.h"
+#include "optimizer/planmain.h"
+#include "storage/lmgr.h"
+#include "storage/procarray.h"
+#include "utils/snapmgr.h"
+#include "utils/tqual.h"
+
+
+/*
+ * The expression lists we ship, as nodeToString representations.  A plain
+ * scan only has the first two.
+ */
+typedef enum ParallelQueryList
+{
+	PQ_OUTER_TLIST,				/* the scan, or a hash join's outer scan */
+	PQ_OUTER_QUAL,
+	PQ_INNER_TLIST,				/* a hash join's inner scan */
+	PQ_INNER_QUAL,
+	PQ_HASH_TLIST,				/* its Hash node */
+	PQ_JOIN_TLIST,				/* the join itself */
+	PQ_JOIN_QUAL,
+	PQ_JOIN_JOINQUAL,
+	PQ_JOIN_HASHCLAUSES,
+	PQ_NUM_LISTS
+} ParallelQueryList;
+
+typedef struct ParallelQueryScan
+{
+	Oid			relid;			/* relation to scan */
+	Index		scanrelid;		/* its range table index in the plan */
+	Size		pscan_offset;	/* its shared scan state */
+} ParallelQueryScan;
+
+/*
+ * Layout of the argument area.  The header is followed, at the given
+ * offsets, by the shared scan states, the serialized snapshot, and the
+ * expression lists.
+ */
+typedef struct ParallelQueryHeader
+{
+	bool		hashjoin;		/* a hash join, rather than a scan? */
+	JoinType	jointype;		/* hash join's type */
+	HashJoinShared hjshared;	/* hash join's shared state */
+	int			nscans;
+	ParallelQueryScan scans[2];	/* the outer scan, and the inner one */
+	Size		snapshot_offset;
+	int			nlists;
+	Size		list_offset[PQ_NUM_LISTS];
+} ParallelQueryHeader;
+
+static ParallelContext *ExecParallelSetup(PlanState *planstate,
+				  ScanState **scans, EState *estate, int nworkers,
+				  ParallelExecutorInfo *pei);
+static void ExecParallelFindScans(PlanState *planstate, ScanState **scans,
+					  int *nscans);
+static List *ShippedList(char *args, ParallelQueryHeader *header, int n);
+
+
+/*
+ * ExecInitParallelPlan
+ *		Set up to run the given plan in up to nworkers parallel workers.
+ *
+ * planstate must be an initialized parallel-aware SeqScan, or HashJoin of
+ * two of them.  We give the local copy of the plan the shared state it
+ * needs, and, if we can get workers, return a parallel context in the
+ * result whose workers are ready to be launched.  If no workers can be had,
+ * or the plan is too large to ship, or there's no room for a hash join's
+ * shared table, the context is NULL, and the local plan must do all the
+ * work by itself; it is then set up just as if no workers were requested.
+ */
+ParallelExecutorInfo *
+ExecInitParallelPlan(PlanState *planstate, EState *estate, int nworkers)
+{
+	ParallelExecutorInfo *pei;
+	ScanState  *scans[2];
+	int			i;
+
+	pei = (ParallelExecutorInfo *) palloc0(sizeof(ParallelExecutorInfo));
+	ExecParallelFindScans(planstate, scans, &pei->nscans);
+
+	/* Workers can only use a plain MVCC snapshot */
+	if (nworkers > 0 && IsMVCCSnapshot(estate->es_snapshot))
+		pei->pcxt = ExecParallelSetup(planstate, scans, estate, nworkers,
+									  pei);
+
+	if (pei->pcxt == NULL)
+	{
+		/* The local plan still needs shared scan states, of its own */
+		for (i = 0; i < pei->nscans; i++)
+		{
+			pei->pscan[i] = (ParallelHeapScanDesc)
+				palloc(sizeof(ParallelHeapScanDescData));
+			heap_parallelscan_initialize(pei->pscan[i],
+										 scans[i]->ss_currentRelation);
+		}
+	}
+
+	for (i = 0; i < pei->nscans; i++)
+		ExecSeqScanInitializeParallel((SeqScanState *) scans[i],
+									  pei->pscan[i]);
+
+	return pei;
+}
+
+/*
+ * ExecParallelStop
+ *		Tell the workers of a parallel plan to stop early.
+ *
+ * Their scans come to an end, and any that are waiting for the others in a
+ * hash join just exit.
+ */
+void
+ExecParallelStop(ParallelExecutorInfo *pei)
+{
+	int			i;
+
+	for (i = 0; i < pei->nscans; i++)
+		heap_parallelscan_stop(pei->pscan[i]);
+	if (pei->hjshared != NULL)
+		ExecHashTableAbandonShared(pei->hjshared);
+}
+
+/*
+ * ExecParallelCleanup
+ *		Release the shared state of a parallel plan.
+ *
+ * The workers must have exited.  The local plan must not be run again until
+ * ExecInitParallelPlan has given it new shared state.
+ */
+void
+ExecParallelCleanup(ParallelExecutorInfo *pei)
+{
+	int			i;
+
+	if (pei->pcxt != NULL)
+		DestroyParallelContext(pei->pcxt);
+	else
+	{
+		for (i = 0; i < pei->nscans; i++)
+			pfree(pei->pscan[i]);
+	}
+	pfree(pei);
+}
+
+/*
+ * Find the parallel-aware scans of a plan: the scan itself, or a hash
+ * join's outer and inner scans, in that order.
+ */
+static void
+ExecParallelFindScans(PlanState *planstate, ScanState **scans, int *nscans)
+{
+	if (IsA(planstate, HashJoinState))
+	{
+		scans[0] = (ScanState *) outerPlanState(planstate);
+		scans[1] = (ScanState *) outerPlanState(innerPlanState(planstate));
+		*nscans = 2;
+	}
+	else
+	{
+		scans[0] = (ScanState *) planstate;
+		*nscans = 1;
+	}
+}
+
+/*
+ * Create a parallel context for the plan and fill in its argument area.
+ * Returns NULL if that can't be done.
+ */
+static ParallelContext *
+ExecParallelSetup(PlanState *planstate, ScanState **scans, EState *estate,
+				  int nworkers, ParallelExecutorInfo *pei)
+{
+	Plan	   *plan = planstate->plan;
+	bool		hashjoin = IsA(plan, HashJoin);
+	ParallelContext *pcxt;
+	ParallelQueryHeader *header;
+	List	   *lists[PQ_NUM_LISTS];
+	char	   *strings[PQ_NUM_LISTS];
+	int			nlists;
+	char	   *args;
+	Size		argsize;
+	Size		size;
+	int			i;
+
+	Assert(plan->parallel_aware);
+
+	/* Collect the expression lists to ship */
+	for (i = 0; i < pei->nscans; i++)
+	{
+		Plan	   *scan = scans[i]->ps.plan;
+
+		Assert(IsA(scan, SeqScan));
+		Assert(scan->parallel_aware);
+		lists[PQ_OUTER_TLIST + 2 * i] = scan->targetlist;
+		lists[PQ_OUTER_QUAL + 2 * i] = scan->qual;
+	}
+	nlists = 2;
+	if (hashjoin)
+	{
+		HashJoin   *join = (HashJoin *) plan;
+
+		lists[PQ_HASH_TLIST] = innerPlan(plan)->targetlist;
+		lists[PQ_JOIN_TLIST] = plan->targetlist;
+		lists[PQ_JOIN_QUAL] = plan->qual;
+		lists[PQ_JOIN_JOINQUAL] = join->join.joinqual;
+		lists[PQ_JOIN_HASHCLAUSES] = join->hashclauses;
+		nlists = PQ_NUM_LISTS;
+	}
+	for (i = 0; i < nlists; i++)
+		strings[i] = nodeToString(lists[i]);
+
+	pcxt = CreateParallelContext(PARALLEL_ENTRY_QUERY, nworkers);
+	args = ParallelContextArgumentSpace(pcxt, &argsize);
+	if (args == NULL)
+	{
+		DestroyParallelContext(pcxt);
+		return NULL;
+	}
+
+	/* Lay out the argument area, giving up if it doesn't fit */
+	header = (ParallelQueryHeader *) args;
+	size = MAXALIGN(sizeof(ParallelQueryHeader));
+	for (i = 0; i < pei->nscans; i++)
+	{
+		header->scans[i].pscan_offset = size;
+		size += MAXALIGN(sizeof(ParallelHeapScanDescData));
+	}
+	header->snapshot_offset = size;
+	size += MAXALIGN(EstimateSnapshotSpace(estate->es_snapshot));
+	for (i = 0; i < nlists; i++)
+	{
+		header->list_offset[i] = size;
+		size += strlen(strings[i]) + 1;
+	}
+
+	if (size > argsize)
+	{
+		DestroyParallelContext(pcxt);
+		return NULL;
+	}
+
+	/*
+	 * A hash join needs working space for its shared table: work_mem for
+	 * each participant if we can get it, but at least work_mem.
+	 */
+	header->hashjoin = hashjoin;
+	header->hjshared = NULL;
+	if (hashjoin)
+	{
+		int			maxparticipants = pcxt->nworkers + 1;
+		Size		hdrsize = HashJoinSharedSize(maxparticipants);
+		Size		work = work_mem * 1024L;
+		char	   *space;
+		Size		spacesize;
+
+		space = ParallelContextSharedSpace(pcxt,
+							add_size(mul_size(work, maxparticipants), hdrsize),
+										   add_size(work, hdrsize),
+										   &spacesize);
+		if (space == NULL)
+		{
+			DestroyParallelContext(pcxt);
+			return NULL;
+		}
+
+		ExecHashJoinInitializeShared((HashJoinState *) planstate,
+									 space, spacesize, maxparticipants, pcxt);
+		header->jointype = ((HashJoin *) plan)->join.jointype;
+		header->hjshared = (HashJoinShared) space;
+		pei->hjshared = header->hjshared;
+	}
+
+	header->nscans = pei->nscans;
+	for (i = 0; i < pei->nscans; i++)
+	{
+		Relation	rel = scans[i]->ss_currentRelation;
+
+		header->scans[i].relid = RelationGetRelid(rel);
+		header->scans[i].scanrelid = ((Scan *) scans[i]->ps.plan)->scanrelid;
+		pei->pscan[i] = (ParallelHeapScanDesc)
+			(args + header->scans[i].pscan_offset);
+		heap_parallelscan_initialize(pei->pscan[i], rel);
+	}
+	SerializeSnapshot(estate->es_snapshot, args + header->snapshot_offset);
+	header->nlists = nlists;
+	for (i = 0; i < nlists; i++)
+	{
+		strcpy(args + header->list_offset[i], strings[i]);
+		pfree(strings[i]);
+	}
+
+	return pcxt;
+}
+
+/*
+ * Rebuild one of the expression lists the leader shipped to us.  readfuncs
+ * leaves operator function OIDs unset, so look them up again before the
+ * executor sees the expressions.
+ */
+static List *
+ShippedList(char *args, ParallelQueryHeader *header, int n)
+{
+	List	   *list = (List *) stringToNode(args + header->list_offset[n]);
+
+	fix_opfuncids((Node *) list);
+	return list;
+}
+
+/*
+ * ParallelQueryMain
+ *		Entry point for a parallel worker running part of a query.
+ *
+ * If we can't safely do anything useful, we just return; the leader and
+ * any other workers will take care of the whole plan.
+ */
+void
+ParallelQueryMain(char *args, Size size)
+{
+	ParallelQueryHeader *header = (ParallelQueryHeader *) args;
+	Snapshot	snapshot;
+	Plan	   *scans[2];
+	Plan	   *plan;
+	PlannedStmt *pstmt;
+	List	   *rtable = NIL;
+	Index		rtlength = 0;
+	DestReceiver *dest;
+	QueryDesc  *queryDesc;
+	PlanState  *planstate;
+	ScanState  *scanstates[2];
+	int			nscans;
+	Index		rti;
+	int			i;
+
+	/*
+	 * Adopt the leader's snapshot.  We need a snapshot of our own first, to
+	 * set up RecentGlobalXmin and friends.
+	 */
+	(void) GetTransactionSnapshot();
+	snapshot = RestoreSnapshot(args + header->snapshot_offset);
+	if (!ProcArrayInstallParallelXmin(snapshot->xmin,
+									  GetParallelLeaderProc()))
+		return;
+
+	/*
+	 * The leader holds AccessShareLock on the relations, so we'd normally get
+	 * them at once.  If we'd have to wait, somebody is queued behind the
+	 * leader for a stronger lock, and waiting could deadlock us against the
+	 * leader, which the deadlock detector can't see.  Just bow out.
+	 */
+	for (i = 0; i < header->nscans; i++)
+	{
+		if (!ConditionalLockRelationOid(header->scans[i].relid,
+										AccessShareLock))
+			return;
+	}
+
+	/*
+	 * Rebuild the scans.  The Vars in each refer to range table entry
+	 * scanrelid, so make a range table long enough, with the right relation
+	 * at each scan's entry; the others are never looked at.  Permissions
+	 * were checked by the leader.
+	 */
+	for (i = 0; i < header->nscans; i++)
+	{
+		SeqScan    *scan = makeNode(SeqScan);
+
+		scan->plan.targetlist =
+			ShippedList(args, header, PQ_OUTER_TLIST + 2 * i);
+		scan->plan.qual =
+			ShippedList(args, header, PQ_OUTER_QUAL + 2 * i);
+		scan->plan.parallel_aware = true;
+		scan->scanrelid = header->scans[i].scanrelid;
+		scans[i] = (Plan *) scan;
+		rtlength = Max(rtlength, scan->scanrelid);
+	}
+
+	for (rti = 1; rti <= rtlength; rti++)
+	{
+		RangeTblEntry *rte = makeNode(RangeTblEntry);
+
+		rte->rtekind = RTE_RELATION;
+		rte->relid = header->scans[0].relid;
+		for (i = 0; i < header->nscans; i++)
+		{
+			if (header->scans[i].scanrelid == rti)
+				rte->relid = header->scans[i].relid;
+		}
+		rte->inh = false;
+		rte->inFromCl = true;
+		rte->requiredPerms = 0;
+		rtable = lappend(rtable, rte);
+	}
+
+	/* Put the hash join together, if it's one */
+	if (header->hashjoin)
+	{
+		HashJoin   *join = makeNode(HashJoin);
+		Hash	   *hash = makeNode(Hash);
+
+		hash->plan.targetlist = ShippedList(args, header, PQ_HASH_TLIST);
+		hash->plan.lefttree = scans[1];
+		hash->plan.parallel_aware = true;
+
+		join->join.plan.targetlist =
+			ShippedList(args, header, PQ_JOIN_TLIST);
+		join->join.plan.qual = ShippedList(args, header, PQ_JOIN_QUAL);
+		join->join.plan.lefttree = scans[0];
+		join->join.plan.righttree = (Plan *) hash;
+		join->join.plan.parallel_aware = true;
+		join->join.jointype = header->jointype;
+		join->join.joinqual = ShippedList(args, header, PQ_JOIN_JOINQUAL);
+		join->hashclauses = ShippedList(args, header, PQ_JOIN_HASHCLAUSES);
+		plan = (Plan *) join;
+	}
+	else
+		plan = scans[0];
+
+	pstmt = makeNode(PlannedStmt);
+	pstmt->commandType = CMD_SELECT;
+	pstmt->canSetTag = true;
+	pstmt->planTree = plan;
+	pstmt->rtable = rtable;
+
+	dest = CreateDestReceiver(DestTupleQueue);
+	SetTupleQueueDestReceiverParams(dest, GetParallelWorkerQueue());
+
+	PushActiveSnapshot(snapshot);
+
+	queryDesc = CreateQueryDesc(pstmt, "<parallel query>",
+								GetActiveSnapshot(), InvalidSnapshot,
+								dest, NULL, 0);
+	ExecutorStart(queryDesc, 0);
+
+	/* Hook the plan up to the leader's shared state */
+	planstate = queryDesc->planstate;
+	ExecParallelFindScans(planstate, scanstates, &nscans);
+	Assert(nscans == header->nscans);
+	for (i = 0; i < nscans; i++)
+		ExecSeqScanInitializeParallel((SeqScanState *) scanstates[i],
+									  (ParallelHeapScanDesc)
+									  (args + header->scans[i].pscan_offset));
+	if (header->hashjoin)
+		((HashJoinState *) planstate)->hj_Shared = header->hjshared;
+
+	ExecutorRun(queryDesc, ForwardScanDirection, 0L);
+	ExecutorEnd(queryDesc);
+	FreeQueryDesc(queryDesc);
+
+	PopActiveSnapshot();
+
+	(*dest->rDestroy) (dest);
+}
@@ -18,12 +18,128 @@
  */
 #include "postgres.h"
 
+#include <math.h>
+
 #include "executor/executor.h"
+#include "executor/nodeHashjoin.h"
 #include "miscadmin.h"
+#include "storage/bufmgr.h"
+#include "utils/fmgroids.h"
+#include "utils/lsyscache.h"
 #include "utils/memutils.h"
 
 
+/*
+ * Batch mode
+ *
+ * When some of a scan's quals are simple comparisons between a column and a
+ * constant, for a few fixed-width types whose comparison operators we can
+ * evaluate inline, we fetch tuples from the access method in batches,
+ * deform the whole batch at once, and apply those quals to it with tight
+ * loops over the column values, without any expression-tree walking or
+ * fmgr calls.  The tuples that survive then go through the remaining quals
+ * and projection one at a time, as usual.
+ *
+ * Every batched tuple keeps its own slot and buffer pin until the next
+ * batch is fetched.  A batch ends at the first tuple from a new page, so
+ * that we never hold more than two pins beyond the scan's own.  Batch mode
+ * can't support backward scans or mark/restore, and isn't used in
+ * EvalPlanQual rechecks, which only ever see one tuple anyway.
+ */
+#define SCAN_BATCH_SIZE		128
+
+typedef enum BatchQualType
+{
+	BQ_INT2,
+	BQ_INT4,
+	BQ_INT8,
+	BQ_FLOAT4,
+	BQ_FLOAT8
+} BatchQualType;
+
+typedef enum BatchQualOp
+{
+	BQ_LT,
+	BQ_LE,
+	BQ_EQ,
+	BQ_NE,
+	BQ_GE,
+	BQ_GT
+} BatchQualOp;
+
+/* A qual of the form "column op constant" */
+typedef struct BatchQual
+{
+	AttrNumber	attno;			/* column to compare */
+	BatchQualType type;			/* its representation */
+	BatchQualOp op;				/* comparison to apply */
+	Datum		constval;		/* the (non-null) constant */
+} BatchQual;
+
+typedef struct ScanBatchData
+{
+	int			nquals;			/* number of batch quals */
+	BatchQual  *quals;			/* array of batch quals */
+	AttrNumber	maxattno;		/* highest column they reference */
+	List	   *qual;			/* remaining quals, as ExprStates */
+	TupleTableSlot **slots;		/* one slot per batched tuple */
+	HeapTupleData *tuples;		/* copies of the tuple headers */
+	int			ntuples;		/* number of tuples in batch */
+	int		   *sel;			/* indexes of tuples passing batch quals */
+	int			nsel;			/* number of entries in sel */
+	int			next;			/* next entry of sel to return */
+	bool		done;			/* access method is exhausted */
+} ScanBatchData;
+
+/* Comparison functions that batch quals know how to evaluate */
+static const struct
+{
+	Oid			funcid;
+	BatchQualType type;
+	BatchQualOp op;
+}	batch_qual_funcs[] =
+{
+	{F_INT2LT, BQ_INT2, BQ_LT},
+	{F_INT2LE, BQ_INT2, BQ_LE},
+	{F_INT2EQ, BQ_INT2, BQ_EQ},
+	{F_INT2NE, BQ_INT2, BQ_NE},
+	{F_INT2GE, BQ_INT2, BQ_GE},
+	{F_INT2GT, BQ_INT2, BQ_GT},
+	{F_INT4LT, BQ_INT4, BQ_LT},
+	{F_INT4LE, BQ_INT4, BQ_LE},
+	{F_INT4EQ, BQ_INT4, BQ_EQ},
+	{F_INT4NE, BQ_INT4, BQ_NE},
+	{F_INT4GE, BQ_INT4, BQ_GE},
+	{F_INT4GT, BQ_INT4, BQ_GT},
+	{F_INT8LT, BQ_INT8, BQ_LT},
+	{F_INT8LE, BQ_INT8, BQ_LE},
+	{F_INT8EQ, BQ_INT8, BQ_EQ},
+	{F_INT8NE, BQ_INT8, BQ_NE},
+	{F_INT8GE, BQ_INT8, BQ_GE},
+	{F_INT8GT, BQ_INT8, BQ_GT},
+	{F_FLOAT4LT, BQ_FLOAT4, BQ_LT},
+	{F_FLOAT4LE, BQ_FLOAT4, BQ_LE},
+	{F_FLOAT4EQ, BQ_FLOAT4, BQ_EQ},
+	{F_FLOAT4NE, BQ_FLOAT4, BQ_NE},
+	{F_FLOAT4GE, BQ_FLOAT4, BQ_GE},
+	{F_FLOAT4GT, BQ_FLOAT4, BQ_GT},
+	{F_FLOAT8LT, BQ_FLOAT8, BQ_LT},
+	{F_FLOAT8LE, BQ_FLOAT8, BQ_LE},
+	{F_FLOAT8EQ, BQ_FLOAT8, BQ_EQ},
+	{F_FLOAT8NE, BQ_FLOAT8, BQ_NE},
+	{F_FLOAT8GE, BQ_FLOAT8, BQ_GE},
+	{F_FLOAT8GT, BQ_FLOAT8, BQ_GT},
+	/* date is an int4 internally */
+	{F_DATE_LT, BQ_INT4, BQ_LT},
+	{F_DATE_LE, BQ_INT4, BQ_LE},
+	{F_DATE_EQ, BQ_INT4, BQ_EQ},
+	{F_DATE_NE, BQ_INT4, BQ_NE},
+	{F_DATE_GE, BQ_INT4, BQ_GE},
+	{F_DATE_GT, BQ_INT4, BQ_GT}
+};
+
 static bool tlist_matches_tupdesc(PlanState *ps, List *tlist, Index varno, TupleDesc tupdesc);
+static bool make_batch_qual(Expr *expr, Index scanrelid, BatchQual *bq);
 
 
 /*
@@ -82,6 +198,183 @@ ExecScanFetch(ScanState *node,
 	return (*accessMtd) (node);
 }
 
+/*
+ * Filtering loops for batch quals.
+ *
+ * Each loop compacts the sel array in place, keeping the entries whose
+ * tuples satisfy "column OP c".  Nulls never pass, since the comparison
+ * operators are strict.  For the float types, NaN must sort above all
+ * other values, as in float.c; for the integer types ISNAN is constant
+ * false and the test disappears.
+ */
+#define BATCH_NOT_NAN(v)	false
+
+#define BATCH_FILTER_LOOP(ctype, getval, ISNAN, OP, nanresult) \
+	for (j = 0; j < nsel; j++) \
+	{ \
+		TupleTableSlot *slot = slots[sel[j]]; \
+		ctype		v; \
+		\
+		if (slot->tts_isnull[attidx]) \
+			continue; \
+		v = getval(slot->tts_values[attidx]); \
+		if (ISNAN(v) ? (nanresult) : (v OP c)) \
+			sel[n++] = sel[j]; \
+	}
+
+#define DEFINE_BATCH_FILTER(fname, ctype, getval, ISNAN) \
+static int \
+fname(BatchQual *bq, TupleTableSlot **slots, int *sel, int nsel) \
+{ \
+	int			attidx = bq->attno - 1; \
+	ctype		c = getval(bq->constval); \
+	int			n = 0; \
+	int			j; \
+	\
+	switch (bq->op) \
+	{ \
+		case BQ_LT: \
+			BATCH_FILTER_LOOP(ctype, getval, ISNAN, <, false); \
+			break; \
+		case BQ_LE: \
+			BATCH_FILTER_LOOP(ctype, getval, ISNAN, <=, false); \
+			break; \
+		case BQ_EQ: \
+			BATCH_FILTER_LOOP(ctype, getval, ISNAN, ==, false); \
+			break; \
+		case BQ_NE: \
+			BATCH_FILTER_LOOP(ctype, getval, ISNAN, !=, true); \
+			break; \
+		case BQ_GE: \
+			BATCH_FILTER_LOOP(ctype, getval, ISNAN, >=, true); \
+			break; \
+		case BQ_GT: \
+			BATCH_FILTER_LOOP(ctype, getval, ISNAN, >, true); \
+			break; \
+	} \
+	return n; \
+}
+
+DEFINE_BATCH_FILTER(batch_filter_int2, int16, DatumGetInt16, BATCH_NOT_NAN)
+DEFINE_BATCH_FILTER(batch_filter_int4, int32, DatumGetInt32, BATCH_NOT_NAN)
+DEFINE_BATCH_FILTER(batch_filter_int8, int64, DatumGetInt64, BATCH_NOT_NAN)
+DEFINE_BATCH_FILTER(batch_filter_float4, float4, DatumGetFloat4, isnan)
+DEFINE_BATCH_FILTER(batch_filter_float8, float8, DatumGetFloat8, isnan)
+
+/*
+ * ExecScanBatchFill -- fetch and filter the next batch of tuples
+ */
+static void
+ExecScanBatchFill(ScanState *node,
+				  ExecScanAccessMtd accessMtd,
+				  ExecScanRecheckMtd recheckMtd)
+{
+	ScanBatchData *batch = node->ss_Batch;
+	Buffer		buffer = InvalidBuffer;
+	int			ntuples = 0;
+	int			nsel;
+	int			i;
+
+	while (ntuples < SCAN_BATCH_SIZE)
+	{
+		TupleTableSlot *slot = ExecScanFetch(node, accessMtd, recheckMtd);
+
+		if (TupIsNull(slot))
+		{
+			batch->done = true;
+			break;
+		}
+
+		/*
+		 * The access method's tuple header will be overwritten by the next
+		 * fetch, but the tuple itself stays valid as long as we keep its
+		 * buffer pinned.
+		 */
+		Assert(slot->tts_tuple != NULL && !slot->tts_shouldFree);
+		batch->tuples[ntuples] = *slot->tts_tuple;
+		ExecStoreTuple(&batch->tuples[ntuples], batch->slots[ntuples],
+					   slot->tts_buffer, false);
+		ntuples++;
+
+		if (BufferIsValid(buffer) && slot->tts_buffer != buffer)
+			break;
+		buffer = slot->tts_buffer;
+	}
+
+	/* Release the pins held by leftovers of the previous batch */
+	for (i = ntuples; i < batch->ntuples; i++)
+		ExecClearTuple(batch->slots[i]);
+	batch->ntuples = ntuples;
+
+	for (i = 0; i < ntuples; i++)
+	{
+		slot_getsomeattrs(batch->slots[i], batch->maxattno);
+		batch->sel[i] = i;
+	}
+
+	nsel = ntuples;
+	for (i = 0; i < batch->nquals && nsel > 0; i++)
+	{
+		BatchQual  *bq = &batch->quals[i];
+
+		switch (bq->type)
+		{
+			case BQ_INT2:
+				nsel = batch_filter_int2(bq, batch->slots, batch->sel, nsel);
+				break;
+			case BQ_INT4:
+				nsel = batch_filter_int4(bq, batch->slots, batch->sel, nsel);
+				break;
+			case BQ_INT8:
+				nsel = batch_filter_int8(bq, batch->slots, batch->sel, nsel);
+				break;
+			case BQ_FLOAT4:
+				nsel = batch_filter_float4(bq, batch->slots, batch->sel, nsel);
+				break;
+			case BQ_FLOAT8:
+				nsel = batch_filter_float8(bq, batch->slots, batch->sel, nsel);
+				break;
+		}
+	}
+	batch->nsel = nsel;
+	batch->next = 0;
+}
+
+/*
+ * ExecScanBatchNext -- return the next tuple that passes the batch quals
+ *
+ * Returns an empty slot when the scan is exhausted.
+ */
+static TupleTableSlot *
+ExecScanBatchNext(ScanState *node,
+				  ExecScanAccessMtd accessMtd,
+				  ExecScanRecheckMtd recheckMtd)
+{
+	ScanBatchData *batch = node->ss_Batch;
+	TupleTableSlot *slot;
+
+	while (batch->next >= batch->nsel)
+	{
+		if (batch->done)
+			return ExecClearTuple(node->ss_ScanTupleSlot);
+
+		CHECK_FOR_INTERRUPTS();
+
+		ExecScanBatchFill(node, accessMtd, recheckMtd);
+	}
+
+	slot = batch->slots[batch->sel[batch->next++]];
+
+	/*
+	 * Make the scan tuple slot show the tuple we're returning, since WHERE
+	 * CURRENT OF looks there for the cursor's current row.
+	 */
+	ExecStoreTuple(slot->tts_tuple, node->ss_ScanTupleSlot,
+				   slot->tts_buffer, false);
+
+	return slot;
+}
+
 /* ----------------------------------------------------------------
  *		ExecScan
  *
@@ -122,12 +415,17 @@ ExecScan(ScanState *node,
 	projInfo = node->ps.ps_ProjInfo;
 
 	/*
-	 * If we have neither a qual to check nor a projection to do, just skip
-	 * all the overhead and return the raw scan tuple.
+	 * If we have neither a qual to check nor a projection to do nor a join
+	 * filter to apply, just skip all the overhead and return the raw scan
+	 * tuple.
 	 */
-	if (!qual && !projInfo)
+	if (!qual && !projInfo && !node->ss_JoinFilter)
 		return ExecScanFetch(node, accessMtd, recheckMtd);
 
+	/* In batch mode, only the quals that couldn't be batched remain */
+	if (node->ss_Batch)
+		qual = node->ss_Batch->qual;
+
 	/*
 	 * Check to see if we're still projecting out tuples from a previous scan
 	 * tuple (because there is a function-returning-set in the projection
@@ -161,7 +459,10 @@ ExecScan(ScanState *node,
 
 		CHECK_FOR_INTERRUPTS();
 
-		slot = ExecScanFetch(node, accessMtd, recheckMtd);
+		if (node->ss_Batch)
+			slot = ExecScanBatchNext(node, accessMtd, recheckMtd);
+		else
+			slot = ExecScanFetch(node, accessMtd, recheckMtd);
 
 		/*
 		 * if the slot returned by the accessMtd contains NULL, then it means
@@ -188,8 +489,13 @@ ExecScan(ScanState *node,
 		 * check for non-nil qual here to avoid a function call to ExecQual()
 		 * when the qual is nil ... saves only a few cycles, but they add up
 		 * ...
+		 *
+		 * If a hash join above us has given us a Bloom filter of its inner
+		 * keys, also drop tuples that can't join, before we project them.
 		 */
-		if (!qual || ExecQual(qual, econtext, false))
+		if ((!qual || ExecQual(qual, econtext, false)) &&
+			(!node->ss_JoinFilter ||
+			 !ExecHashJoinFilterRejects(node->ss_JoinFilter, econtext)))
 		{
 			/*
 			 * Found a satisfactory scan tuple.
@@ -334,4 +640,183 @@ ExecScanReScan(ScanState *node)
 
 		estate->es_epqScanDone[scanrelid - 1] = false;
 	}
+
+	/* Discard any batch of tuples we have fetched ahead */
+	if (node->ss_Batch)
+	{
+		ScanBatchData *batch = node->ss_Batch;
+		int			i;
+
+		for (i = 0; i < batch->ntuples; i++)
+			ExecClearTuple(batch->slots[i]);
+		batch->ntuples = 0;
+		batch->nsel = 0;
+		batch->next = 0;
+		batch->done = false;
+	}
+}
+
+/*
+ * ExecInitScanBatch
+ *		Set up batch mode for a scan node, if any of its quals allow it.
+ *
+ * This must be called at the end of the node's initialization, once its
+ * quals and scan tuple slot are set up.  The access method must return
+ * tuples that remain valid as long as their buffer stays pinned, as
+ * heap scans do.
+ */
+void
+ExecInitScanBatch(ScanState *node, int eflags)
+{
+	EState	   *estate = node->ps.state;
+	Scan	   *plan = (Scan *) node->ps.plan;
+	ScanBatchData *batch;
+	BatchQual  *quals;
+	int			nquals = 0;
+	AttrNumber	maxattno = 0;
+	List	   *remaining = NIL;
+	ListCell   *l,
+			   *ls;
+	int			i;
+
+	node->ss_Batch = NULL;
+
+	if (plan->plan.qual == NIL)
+		return;
+	if (eflags & (EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK))
+		return;
+	if (estate->es_epqTuple != NULL)
+		return;
+
+	quals = (BatchQual *) palloc(list_length(plan->plan.qual) *
+								 sizeof(BatchQual));
+	forboth(l, plan->plan.qual, ls, node->ps.qual)
+	{
+		if (make_batch_qual((Expr *) lfirst(l), plan->scanrelid,
+							&quals[nquals]))
+		{
+			maxattno = Max(maxattno, quals[nquals].attno);
+			nquals++;
+		}
+		else
+			remaining = lappend(remaining, lfirst(ls));
+	}
+
+	if (nquals == 0)
+	{
+		pfree(quals);
+		return;
+	}
+
+	batch = (ScanBatchData *) palloc0(sizeof(ScanBatchData));
+	batch->nquals = nquals;
+	batch->quals = quals;
+	batch->maxattno = maxattno;
+	batch->qual = remaining;
+	batch->slots = (TupleTableSlot **)
+		palloc(SCAN_BATCH_SIZE * sizeof(TupleTableSlot *));
+	for (i = 0; i < SCAN_BATCH_SIZE; i++)
+	{
+		batch->slots[i] = ExecInitExtraTupleSlot(estate);
+		ExecSetSlotDescriptor(batch->slots[i],
+							  node->ss_ScanTupleSlot->tts_tupleDescriptor);
+	}
+	batch->tuples = (HeapTupleData *)
+		palloc(SCAN_BATCH_SIZE * sizeof(HeapTupleData));
+	batch->sel = (int *) palloc(SCAN_BATCH_SIZE * sizeof(int));
+
+	node->ss_Batch = batch;
+}
+
+/*
+ * make_batch_qual
+ *		If expr is a comparison of a column of the scanned relation with a
+ *		constant that batch mode can evaluate, fill in *bq and return true.
+ */
+static bool
+make_batch_qual(Expr *expr, Index scanrelid, BatchQual *bq)
+{
+	OpExpr	   *opexpr;
+	Node	   *leftop;
+	Node	   *rightop;
+	Var		   *var;
+	Const	   *con;
+	bool		commuted;
+	Oid			funcid;
+	int			i;
+
+	if (!IsA(expr, OpExpr))
+		return false;
+	opexpr = (OpExpr *) expr;
+	if (list_length(opexpr->args) != 2)
+		return false;
+	leftop = (Node *) linitial(opexpr->args);
+	rightop = (Node *) lsecond(opexpr->args);
+
+	if (IsA(leftop, Var) && IsA(rightop, Const))
+	{
+		var = (Var *) leftop;
+		con = (Const *) rightop;
+		commuted = false;
+	}
+	else if (IsA(leftop, Const) && IsA(rightop, Var))
+	{
+		var = (Var *) rightop;
+		con = (Const *) leftop;
+		commuted = true;
+	}
+	else
+		return false;
+
+	if (var->varno != scanrelid || var->varattno <= 0 ||
+		var->varlevelsup != 0)
+		return false;
+	if (con->constisnull)
+		return false;
+
+	funcid = opexpr->opfuncid;
+	if (!OidIsValid(funcid))
+		funcid = get_opcode(opexpr->opno);
+
+	for (i = 0; i < lengthof(batch_qual_funcs); i++)
+	{
+		if (batch_qual_funcs[i].funcid == funcid)
+			break;
+	}
+	if (i >= lengthof(batch_qual_funcs))
+		return false;
+
+	bq->attno = var->varattno;
+	bq->type = batch_qual_funcs[i].type;
+	bq->op = batch_qual_funcs[i].op;
+	bq->constval = con->constvalue;
+
+	/* Our loops assume the constant isn't a NaN; just don't batch that */
+	if ((bq->type == BQ_FLOAT4 && isnan(DatumGetFloat4(bq->constval))) ||
+		(bq->type == BQ_FLOAT8 && isnan(DatumGetFloat8(bq->constval))))
+		return false;
+
+	/* "const op column" is the same as "column commuted-op const" */
+	if (commuted)
+	{
+		switch (bq->op)
+		{
+			case BQ_LT:
+				bq->op = BQ_GT;
+				break;
+			case BQ_LE:
+				bq->op = BQ_GE;
+				break;
+			case BQ_GE:
+				bq->op = BQ_LE;
+				break;
+			case BQ_GT:
+				bq->op = BQ_LT;
+				break;
+			default:
+				break;
+		}
+	}
+
+	return true;
 }
@@ -66,6 +66,18 @@
  *	  AggState is available as context in earlier releases (back to 8.1),
  *	  but direct examination of the node is needed to use it before 9.0.
  *
+ *	  In AGG_HASHED mode, the hash table is not allowed to grow much beyond
+ *	  work_mem.  Once it is full, input tuples belonging to groups already in
+ *	  the table are still aggregated as usual, but tuples of any other group
+ *	  are written to one of several temporary files ("batches"), chosen by
+ *	  bits of the group's hash value.  After the groups in memory have been
+ *	  returned, the hash table is thrown away and each batch is processed
+ *	  the same way, with the batch file taking the place of the subplan.
+ *	  A batch that still does not fit is split again using the next few
+ *	  bits of the hash value, so each level of recursion sees only a
+ *	  fraction of the groups.  Since all tuples of a group end up in the same
+ *	  batch, every group is still aggregated exactly once.
+ *
  *
  * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -78,6 +90,8 @@
 
 #include "postgres.h"
 
+#include <math.h>
+
 #include "catalog/pg_aggregate.h"
 #include "catalog/pg_proc.h"
 #include "catalog/pg_type.h"
@@ -89,6 +103,7 @@
 #include "optimizer/tlist.h"
 #include "parser/parse_agg.h"
 #include "parser/parse_coerce.h"
+#include "storage/buffile.h"
 #include "utils/acl.h"
 #include "utils/builtins.h"
 #include "utils/lsyscache.h"
@@ -247,6 +262,33 @@ typedef struct AggHashEntryData
 	AggStatePerGroupData pergroup[1];	/* VARIABLE LENGTH ARRAY */
 } AggHashEntryData;				/* VARIABLE LENGTH STRUCT */
 
+/*
+ * A batch of input tuples that were spilled to disk because their groups did
+ * not fit in the hash table.  used_bits is the number of leading bits of the
+ * hash value that were consumed to route tuples into this batch (and any of
+ * its ancestors); if the batch has to be split again, the next bits are used.
+ */
+typedef struct AggHashBatch
+{
+	BufFile    *file;			/* spilled tuples, positioned at start */
+	int			used_bits;		/* hash bits already used for partitioning */
+} AggHashBatch;
+
+/*
+ * Limits on the number of batches a full hash table is split into.  Each
+ * open batch file costs a BLCKSZ buffer, so we don't want too many; but with
+ * too few, a badly underestimated input needs several levels of recursion.
+ */
+#define HASHAGG_MIN_PARTITIONS_LOG2		2
+#define HASHAGG_MAX_PARTITIONS_LOG2		8
+
+/*
+ * Don't split batches any further once this many hash bits have been used
+ * up; the remaining bits are better left to the hash table itself.  A batch
+ * at that depth is aggregated in memory regardless of work_mem.
+ */
+#define HASHAGG_MAX_USED_BITS			24
+
 
 static void initialize_aggregates(AggState *aggstate,
 					  AggStatePerAgg peragg,
@@ -268,9 +310,16 @@ static void finalize_aggregate(AggState *aggstate,
 				   Datum *resultVal, bool *resultIsNull);
 static Bitmapset *find_unaggregated_cols(AggState *aggstate);
 static bool find_unaggregated_cols_walker(Node *node, Bitmapset **colnos);
-static void build_hash_table(AggState *aggstate);
+static void build_hash_table(AggState *aggstate, double nbuckets);
 static AggHashEntry lookup_hash_entry(AggState *aggstate,
 				  TupleTableSlot *inputslot);
+static uint32 compute_hash_value(AggState *aggstate, TupleTableSlot *hashslot);
+static void hash_agg_start_spill(AggState *aggstate);
+static void hash_agg_spill_tuple(AggState *aggstate, TupleTableSlot *inputslot);
+static TupleTableSlot *hash_agg_read_tuple(AggState *aggstate);
+static void hash_agg_finish_pass(AggState *aggstate);
+static bool hash_agg_next_batch(AggState *aggstate);
+static void hash_agg_reset_spill(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_direct(AggState *aggstate);
 static void agg_fill_hash_table(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_hash_table(AggState *aggstate);
@@ -811,14 +860,19 @@ find_unaggregated_cols_walker(Node *node, Bitmapset **colnos)
 /*
  * Initialize the hash table to empty.
  *
+ * nbuckets is the expected number of groups.  It is clamped to the number of
+ * entries that could possibly fit in work_mem, so that a wildly overestimated
+ * group count doesn't make us allocate a huge bucket array up front.
+ *
  * The hash table always lives in the aggcontext memory context.
  */
 static void
-build_hash_table(AggState *aggstate)
+build_hash_table(AggState *aggstate, double nbuckets)
 {
 	Agg		   *node = (Agg *) aggstate->ss.ps.plan;
 	MemoryContext tmpmem = aggstate->tmpcontext->ecxt_per_tuple_memory;
 	Size		entrysize;
+	double		maxbuckets;
 
 	Assert(node->aggstrategy == AGG_HASHED);
 	Assert(node->numGroups > 0);
@@ -826,14 +880,20 @@ build_hash_table(AggState *aggstate)
 	entrysize = sizeof(AggHashEntryData) +
 		(aggstate->numaggs - 1) *sizeof(AggStatePerGroupData);
 
+	maxbuckets = (double) work_mem * 1024L / hash_agg_entry_size(aggstate->numaggs);
+	nbuckets = Min(nbuckets, maxbuckets);
+	nbuckets = Max(nbuckets, 1.0);
+
 	aggstate->hashtable = BuildTupleHashTable(node->numCols,
 											  node->grpColIdx,
 											  aggstate->eqfunctions,
 											  aggstate->hashfunctions,
-											  node->numGroups,
+											  (long) nbuckets,
 											  entrysize,
 											  aggstate->aggcontext,
 											  tmpmem);
+	aggstate->hash_mem = 0;
+	aggstate->hash_full = false;
 }
 
 /*
@@ -907,6 +967,11 @@ hash_agg_entry_size(int numAggs)
  * Find or create a hashtable entry for the tuple group containing the
  * given tuple.
  *
+ * If the hash table has filled up, no new entries are created; NULL is
+ * returned if the tuple's group is not already present, and the caller
+ * must spill the tuple instead.  In that case hashslot is left holding
+ * the tuple's grouping columns, for compute_hash_value.
+ *
  * When called, CurrentMemoryContext should be the per-query context.
  */
 static AggHashEntry
@@ -935,6 +1000,12 @@ lookup_hash_entry(AggState *aggstate, TupleTableSlot *inputslot)
 		hashslot->tts_isnull[varNumber] = inputslot->tts_isnull[varNumber];
 	}
 
+	/* once the table is full, only look for groups that are already there */
+	if (aggstate->hash_full)
+		return (AggHashEntry) LookupTupleHashEntry(aggstate->hashtable,
+												   hashslot,
+												   NULL);
+
 	/* find or create the hashtable entry using the filtered tuple */
 	entry = (AggHashEntry) LookupTupleHashEntry(aggstate->hashtable,
 												hashslot,
@@ -944,11 +1015,291 @@ lookup_hash_entry(AggState *aggstate, TupleTableSlot *inputslot)
 	{
 		/* initialize aggregates for new tuple group */
 		initialize_aggregates(aggstate, aggstate->peragg, entry->pergroup);
+
+		/*
+		 * Keep track of the space used, and stop adding groups once we reach
+		 * work_mem.  Like the planner's estimate, this doesn't count
+		 * pass-by-reference transition values.
+		 */
+		aggstate->hash_mem += hash_agg_entry_size(aggstate->numaggs) +
+			MAXALIGN(entry->shared.firstTuple->t_len);
+		if (aggstate->hash_mem >= work_mem * 1024L)
+			hash_agg_start_spill(aggstate);
 	}
 
 	return entry;
 }
 
+/*
+ * Compute the hash value of the grouping columns stored in hashslot.
+ *
+ * This uses the same hash functions as the hash table, but that doesn't
+ * matter: the table selects buckets with the low-order bits of the hash
+ * value, while batches are chosen using the high-order bits.
+ */
+static uint32
+compute_hash_value(AggState *aggstate, TupleTableSlot *hashslot)
+{
+	Agg		   *node = (Agg *) aggstate->ss.ps.plan;
+	MemoryContext oldContext;
+	uint32		hashkey = 0;
+	int			i;
+
+	/* Need to run the hash functions in short-lived context */
+	oldContext = MemoryContextSwitchTo(aggstate->tmpcontext->ecxt_per_tuple_memory);
+
+	for (i = 0; i < node->numCols; i++)
+	{
+		AttrNumber	att = node->grpColIdx[i];
+		Datum		attr;
+		bool		isNull;
+
+		/* rotate hashkey left 1 bit at each step */
+		hashkey = (hashkey << 1) | ((hashkey & 0x80000000) ? 1 : 0);
+
+		attr = slot_getattr(hashslot, att, &isNull);
+
+		if (!isNull)			/* treat nulls as having hash key 0 */
+		{
+			uint32		hkey;
+
+			hkey = DatumGetUInt32(FunctionCall1(&aggstate->hashfunctions[i],
+												attr));
+			hashkey ^= hkey;
+		}
+	}
+
+	MemoryContextSwitchTo(oldContext);
+
+	return hashkey;
+}
+
+/*
+ * The hash table has reached work_mem: stop adding new groups, and set up
+ * the batch files that input tuples of other groups will be written to.
+ *
+ * The number of batches is chosen so that each of them is expected to fit
+ * in memory, based on the planner's group estimate and the number of groups
+ * that fit this time.  If the estimate is too low, the batches will just be
+ * split again when they are read back.
+ */
+static void
+hash_agg_start_spill(AggState *aggstate)
+{
+	Agg		   *node = (Agg *) aggstate->ss.ps.plan;
+	double		ngroups;
+	double		nfit;
+	int			nbits;
+
+	/*
+	 * If we have already used up most of the hash bits, splitting further
+	 * won't help much; this can only happen with a great many duplicate hash
+	 * values.  Just let the hash table grow.
+	 */
+	if (aggstate->hash_used_bits + HASHAGG_MIN_PARTITIONS_LOG2 >
+		HASHAGG_MAX_USED_BITS)
+		return;
+
+	/* Groups expected in this pass, versus groups that fit in memory */
+	ngroups = ldexp((double) node->numGroups, -aggstate->hash_used_bits);
+	nfit = (double) hash_get_num_entries(aggstate->hashtable->hashtab);
+
+	nbits = HASHAGG_MIN_PARTITIONS_LOG2;
+	while (nbits < HASHAGG_MAX_PARTITIONS_LOG2 &&
+		   ldexp(nfit, nbits) < ngroups &&
+		   aggstate->hash_used_bits + nbits < HASHAGG_MAX_USED_BITS)
+		nbits++;
+
+	aggstate->hash_full = true;
+	aggstate->hash_spilled = true;
+	aggstate->hash_nbits = nbits;
+	aggstate->hash_spill = (BufFile **) palloc0((1 << nbits) * sizeof(BufFile *));
+}
+
+/*
+ * Write an input tuple whose group isn't in the full hash table to the batch
+ * file selected by the next hash_nbits bits of its hash value.
+ *
+ * The data recorded in the file for each tuple is the whole input tuple in
+ * MinimalTuple format, since the aggregate arguments still have to be
+ * computed from it.  As in ExecHashJoinSaveTuple, this must be called in the
+ * per-query context, not a shorter-lived one.
+ */
+static void
+hash_agg_spill_tuple(AggState *aggstate, TupleTableSlot *inputslot)
+{
+	MinimalTuple tuple;
+	uint32		hashvalue;
+	int			batchno;
+	BufFile    *file;
+	size_t		written;
+
+	hashvalue = compute_hash_value(aggstate, aggstate->hashslot);
+	batchno = (hashvalue << aggstate->hash_used_bits) >>
+		(32 - aggstate->hash_nbits);
+
+	file = aggstate->hash_spill[batchno];
+	if (file == NULL)
+	{
+		/* First write to this batch file, so open it. */
+		file = BufFileCreateTemp(false);
+		aggstate->hash_spill[batchno] = file;
+	}
+
+	tuple = ExecFetchSlotMinimalTuple(inputslot);
+
+	written = BufFileWrite(file, (void *) tuple, tuple->t_len);
+	if (written != tuple->t_len)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+			  errmsg("could not write to hash-aggregate temporary file: %m")));
+}
+
+/*
+ * Read the next tuple from the batch file being processed.  Returns NULL at
+ * end of file.
+ */
+static TupleTableSlot *
+hash_agg_read_tuple(AggState *aggstate)
+{
+	TupleTableSlot *slot = aggstate->hash_spillslot;
+	uint32		t_len;
+	size_t		nread;
+	MinimalTuple tuple;
+
+	nread = BufFileRead(aggstate->hash_input, (void *) &t_len, sizeof(t_len));
+	if (nread == 0)				/* end of file */
+		return ExecClearTuple(slot);
+	if (nread != sizeof(t_len))
+		ereport(ERROR,
+				(errcode_for_file_access(),
+			   errmsg("could not read from hash-aggregate temporary file: %m")));
+	tuple = (MinimalTuple) palloc(t_len);
+	tuple->t_len = t_len;
+	nread = BufFileRead(aggstate->hash_input,
+						(void *) ((char *) tuple + sizeof(uint32)),
+						t_len - sizeof(uint32));
+	if (nread != t_len - sizeof(uint32))
+		ereport(ERROR,
+				(errcode_for_file_access(),
+			   errmsg("could not read from hash-aggregate temporary file: %m")));
+	return ExecStoreMinimalTuple(tuple, slot, true);
+}
+
+/*
+ * All input of the current pass has been consumed.  Close the batch file we
+ * were reading, if any, and queue up the batches written during this pass.
+ */
+static void
+hash_agg_finish_pass(AggState *aggstate)
+{
+	int			batchno;
+
+	if (aggstate->hash_input)
+	{
+		BufFileClose(aggstate->hash_input);
+		aggstate->hash_input = NULL;
+	}
+
+	if (aggstate->hash_spill == NULL)
+		return;
+
+	for (batchno = 0; batchno < (1 << aggstate->hash_nbits); batchno++)
+	{
+		BufFile    *file = aggstate->hash_spill[batchno];
+		AggHashBatch *batch;
+
+		if (file == NULL)
+			continue;
+
+		if (BufFileSeek(file, 0, 0L, SEEK_SET))
+			ereport(ERROR,
+					(errcode_for_file_access(),
+				errmsg("could not rewind hash-aggregate temporary file: %m")));
+
+		batch = (AggHashBatch *) palloc(sizeof(AggHashBatch));
+		batch->file = file;
+		batch->used_bits = aggstate->hash_used_bits + aggstate->hash_nbits;
+		aggstate->hash_batches = lappend(aggstate->hash_batches, batch);
+	}
+
+	pfree(aggstate->hash_spill);
+	aggstate->hash_spill = NULL;
+	aggstate->hash_nbits = 0;
+}
+
+/*
+ * Throw away the current hash table and build a new one from the next
+ * pending batch.  Returns false if there are no more batches.
+ */
+static bool
+hash_agg_next_batch(AggState *aggstate)
+{
+	Agg		   *node = (Agg *) aggstate->ss.ps.plan;
+	AggHashBatch *batch;
+
+	if (aggstate->hash_batches == NIL)
+		return false;
+
+	batch = (AggHashBatch *) linitial(aggstate->hash_batches);
+	aggstate->hash_batches = list_delete_first(aggstate->hash_batches);
+	aggstate->hash_input = batch->file;
+	aggstate->hash_used_bits = batch->used_bits;
+	pfree(batch);
+
+	/* The scan slot may be pointing into the old hash table */
+	ExecClearTuple(aggstate->ss.ss_ScanTupleSlot);
+
+	/* See the comments in ExecReScanAgg */
+	MemoryContextResetAndDeleteChildren(aggstate->aggcontext);
+	build_hash_table(aggstate,
+					 ldexp((double) node->numGroups, -aggstate->hash_used_bits));
+
+	agg_fill_hash_table(aggstate);
+
+	return true;
+}
+
+/*
+ * Close all batch files and forget about spilling, in preparation for a
+ * rescan or at executor shutdown.
+ */
+static void
+hash_agg_reset_spill(AggState *aggstate)
+{
+	ListCell   *l;
+
+	if (aggstate->hash_input)
+		BufFileClose(aggstate->hash_input);
+	aggstate->hash_input = NULL;
+
+	if (aggstate->hash_spill)
+	{
+		int			batchno;
+
+		for (batchno = 0; batchno < (1 << aggstate->hash_nbits); batchno++)
+		{
+			if (aggstate->hash_spill[batchno])
+				BufFileClose(aggstate->hash_spill[batchno]);
+		}
+		pfree(aggstate->hash_spill);
+	}
+	aggstate->hash_spill = NULL;
+	aggstate->hash_nbits = 0;
+
+	foreach(l, aggstate->hash_batches)
+	{
+		AggHashBatch *batch = (AggHashBatch *) lfirst(l);
+
+		BufFileClose(batch->file);
+	}
+	list_free_deep(aggstate->hash_batches);
+	aggstate->hash_batches = NIL;
+
+	aggstate->hash_used_bits = 0;
+	aggstate->hash_spilled = false;
+}
+
 /*
  * ExecAgg -
  *
@@ -1220,11 +1571,15 @@ agg_fill_hash_table(AggState *aggstate)
 
 	/*
 	 * Process each outer-plan tuple, and then fetch the next one, until we
-	 * exhaust the outer plan.
+	 * exhaust the outer plan.  If we are working on a spilled batch, read
+	 * the batch file instead of the outer plan.
 	 */
 	for (;;)
 	{
-		outerslot = ExecProcNode(outerPlan);
+		if (aggstate->hash_input == NULL)
+			outerslot = ExecProcNode(outerPlan);
+		else
+			outerslot = hash_agg_read_tuple(aggstate);
 		if (TupIsNull(outerslot))
 			break;
 		/* set up for advance_aggregates call */
@@ -1233,13 +1588,23 @@ agg_fill_hash_table(AggState *aggstate)
 		/* Find or build hashtable entry for this tuple's group */
 		entry = lookup_hash_entry(aggstate, outerslot);
 
-		/* Advance the aggregates */
-		advance_aggregates(aggstate, entry->pergroup);
+		if (entry != NULL)
+		{
+			/* Advance the aggregates */
+			advance_aggregates(aggstate, entry->pergroup);
+		}
+		else
+		{
+			/* Hash table is full; save the tuple for a later batch */
+			hash_agg_spill_tuple(aggstate, outerslot);
+		}
 
 		/* Reset per-input-tuple context after each tuple */
 		ResetExprContext(tmpcontext);
 	}
 
+	hash_agg_finish_pass(aggstate);
+
 	aggstate->table_filled = true;
 	/* Initialize to walk the hash table */
 	ResetTupleHashIterator(aggstate->hashtable, &aggstate->hashiter);
@@ -1282,7 +1647,11 @@ agg_retrieve_hash_table(AggState *aggstate)
 		entry = (AggHashEntry) ScanTupleHashTable(&aggstate->hashiter);
 		if (entry == NULL)
 		{
-			/* No more entries in hashtable, so done */
+			/* No more entries in hashtable; move on to next batch, if any */
+			if (hash_agg_next_batch(aggstate))
+				continue;
+
+			/* No more batches either, so done */
 			aggstate->agg_done = TRUE;
 			return NULL;
 		}
@@ -1387,6 +1756,14 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	aggstate->pergroup = NULL;
 	aggstate->grp_firstTuple = NULL;
 	aggstate->hashtable = NULL;
+	aggstate->hash_mem = 0;
+	aggstate->hash_full = false;
+	aggstate->hash_spilled = false;
+	aggstate->hash_used_bits = 0;
+	aggstate->hash_nbits = 0;
+	aggstate->hash_input = NULL;
+	aggstate->hash_spill = NULL;
+	aggstate->hash_batches = NIL;
 
 	/*
 	 * Create expression contexts.	We need two, one for per-input-tuple
@@ -1418,6 +1795,7 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	ExecInitScanTupleSlot(estate, &aggstate->ss);
 	ExecInitResultTupleSlot(estate, &aggstate->ss.ps);
 	aggstate->hashslot = ExecInitExtraTupleSlot(estate);
+	aggstate->hash_spillslot = ExecInitExtraTupleSlot(estate);
 
 	/*
 	 * initialize child expressions
@@ -1439,7 +1817,8 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	 * initialize child nodes
 	 *
 	 * If we are doing a hashed aggregation then the child plan does not need
-	 * to handle REWIND efficiently; see ExecReScanAgg.
+	 * to handle REWIND efficiently; see ExecReScanAgg.  (If the hash table
+	 * spills to disk we do rescan the child, but that should be rare.)
 	 */
 	if (node->aggstrategy == AGG_HASHED)
 		eflags &= ~EXEC_FLAG_REWIND;
@@ -1451,6 +1830,11 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	 */
 	ExecAssignScanTypeFromOuterPlan(&aggstate->ss);
 
+	/* tuples read back from batch files look just like the outer tuples */
+	if (node->aggstrategy == AGG_HASHED)
+		ExecSetSlotDescriptor(aggstate->hash_spillslot,
+							  ExecGetResultType(outerPlanState(aggstate)));
+
 	/*
 	 * Initialize result tuple type and projection info.
 	 */
@@ -1507,7 +1891,7 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 
 	if (node->aggstrategy == AGG_HASHED)
 	{
-		build_hash_table(aggstate);
+		build_hash_table(aggstate, (double) node->numGroups);
 		aggstate->table_filled = false;
 		/* Compute the columns we actually need to hash on */
 		aggstate->hash_needed = find_hash_columns(aggstate);
@@ -1869,6 +2253,9 @@ ExecEndAgg(AggState *node)
 			tuplesort_end(peraggstate->sortstate);
 	}
 
+	/* And any temporary files of a hashed aggregation */
+	hash_agg_reset_spill(node);
+
 	/*
 	 * Free both the expr contexts.
 	 */
@@ -1909,13 +2296,18 @@ ExecReScanAgg(AggState *node)
 		/*
 		 * If we do have the hash table and the subplan does not have any
 		 * parameter changes, then we can just rescan the existing hash table;
-		 * no need to build it again.
+		 * no need to build it again.  That doesn't work if we had to spill
+		 * groups to disk, though, since the hash table then holds only the
+		 * last batch.
 		 */
-		if (node->ss.ps.lefttree->chgParam == NULL)
+		if (node->ss.ps.lefttree->chgParam == NULL && !node->hash_spilled)
 		{
 			ResetTupleHashIterator(node->hashtable, &node->hashiter);
 			return;
 		}
+
+		/* Get rid of any batch files; we will read the subplan again */
+		hash_agg_reset_spill(node);
 	}
 
 	/* Make sure we have closed any open tuplesorts */
@@ -1951,7 +2343,7 @@ ExecReScanAgg(AggState *node)
 	if (((Agg *) node->ss.ps.plan)->aggstrategy == AGG_HASHED)
 	{
 		/* Rebuild an empty hash table */
-		build_hash_table(node);
+		build_hash_table(node, (double) ((Agg *) node->ss.ps.plan)->numGroups);
 		node->table_filled = false;
 	}
 	else
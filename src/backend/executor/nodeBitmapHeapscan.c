@@ -593,6 +593,11 @@ ExecInitBitmapHeapScan(BitmapHeapScan *node, EState *estate, int eflags)
 	ExecAssignResultTypeFromTL(&scanstate->ss.ps);
 	ExecAssignScanProjectionInfo(&scanstate->ss);
 
+	/*
+	 * Evaluate simple quals over batches of tuples, if possible.
+	 */
+	ExecInitScanBatch(&scanstate->ss, eflags);
+
 	/*
 	 * initialize child nodes
 	 *
@@ -0,0 +1,310 @@
+/*-------------------------------------------------------------------------
+ *
+ * nodeGather.c
+ *	  Support routines for collecting the output of parallel workers.
+ *
+ * A Gather node runs its parallel-aware subplan in a number of parallel
+ * workers, and also locally, and returns the union of all their output
+ * in no particular order.  The participants divide the work among
+ * themselves through shared state in the subplan; all we do here is start
+ * the workers and read their tuple queues.
+ *
+ * If no workers can be had, the local copy of the subplan does all the
+ * work, so the result is the same either way.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+/*
+ * INTERFACE ROUTINES
+ *		ExecGather		- return the next tuple from any participant
+ *		ExecInitGather	- initialize node and subnodes
+ *		ExecEndGather	- shutdown node and subnodes
+ *		ExecReScanGather - rescan node
+ */
+
+#include "postgres.h"
+
+#include "access/transam.h"
+#include "access/xact.h"
+#include "executor/execParallel.h"
+#include "executor/executor.h"
+#include "executor/nodeGather.h"
+#include "executor/tqueue.h"
+#include "miscadmin.h"
+#include "postmaster/parallelworker.h"
+
+static void StartGather(GatherState *node);
+static HeapTuple GatherReadNext(GatherState *node);
+static void ShutdownGather(GatherState *node);
+
+
+/* ----------------------------------------------------------------
+ *		ExecInitGather
+ * ----------------------------------------------------------------
+ */
+GatherState *
+ExecInitGather(Gather *node, EState *estate, int eflags)
+{
+	GatherState *gatherstate;
+	Plan	   *outerPlan;
+
+	/* Gather node doesn't support backward scan or mark/restore */
+	Assert(!(eflags & (EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK)));
+
+	/*
+	 * create state structure
+	 */
+	gatherstate = makeNode(GatherState);
+	gatherstate->ps.plan = (Plan *) node;
+	gatherstate->ps.state = estate;
+	gatherstate->initialized = false;
+
+	/*
+	 * Tuple table initialization.  The result slot is not actually used; we
+	 * return either our child's slot or the funnel slot.
+	 */
+	ExecInitResultTupleSlot(estate, &gatherstate->ps);
+	gatherstate->funnel_slot = ExecInitExtraTupleSlot(estate);
+
+	/*
+	 * then initialize outer plan
+	 */
+	outerPlan = outerPlan(node);
+	outerPlanState(gatherstate) = ExecInitNode(outerPlan, estate, eflags);
+
+	ExecSetSlotDescriptor(gatherstate->funnel_slot,
+						  ExecGetResultType(outerPlanState(gatherstate)));
+
+	/*
+	 * gather nodes do no projections, so initialize projection info for this
+	 * node appropriately
+	 */
+	ExecAssignResultTypeFromTL(&gatherstate->ps);
+	gatherstate->ps.ps_ProjInfo = NULL;
+
+	return gatherstate;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecGather
+ *
+ *		Returns the next tuple from a worker or from the local copy of
+ *		the subplan.  Workers' tuples are preferred whenever any are
+ *		waiting, so that they aren't held up for lack of queue space.
+ * ----------------------------------------------------------------
+ */
+TupleTableSlot *
+ExecGather(GatherState *node)
+{
+	PlanState  *outerNode = outerPlanState(node);
+	TupleTableSlot *slot;
+	HeapTuple	tuple;
+
+	if (!node->initialized)
+		StartGather(node);
+
+	for (;;)
+	{
+		if (node->nreaders > 0)
+		{
+			tuple = GatherReadNext(node);
+			if (tuple != NULL)
+				return ExecStoreTuple(tuple, node->funnel_slot,
+									  InvalidBuffer, true);
+		}
+
+		if (node->need_to_scan_locally)
+		{
+			slot = ExecProcNode(outerNode);
+			if (!TupIsNull(slot))
+				return slot;
+			node->need_to_scan_locally = false;
+			continue;
+		}
+
+		if (node->nreaders == 0)
+			return ExecClearTuple(node->funnel_slot);
+
+		/* Nothing to do but wait for the workers */
+		WaitLatch(&MyProc->procLatch, -1L);
+		ResetLatch(&MyProc->procLatch);
+		CHECK_FOR_INTERRUPTS();
+		CheckParallelWorkers(node->pei->pcxt);
+	}
+}
+
+/*
+ * Set up the subplan's shared state and launch the workers.
+ *
+ * We can't use workers inside a transaction that has assigned an XID,
+ * since they would not see its changes, nor without a postmaster to start
+ * them.  In that case, or if none are available, we just run the subplan
+ * locally.
+ */
+static void
+StartGather(GatherState *node)
+{
+	Gather	   *gather = (Gather *) node->ps.plan;
+	EState	   *estate = node->ps.state;
+	ParallelContext *pcxt;
+	int			nworkers = 0;
+	int			i;
+
+	node->nreaders = 0;
+	node->nextreader = 0;
+	node->need_to_scan_locally = true;
+
+	if (IsUnderPostmaster &&
+		!TransactionIdIsValid(GetTopTransactionIdIfAny()))
+		nworkers = gather->num_workers;
+
+	node->pei = ExecInitParallelPlan(outerPlanState(node), estate, nworkers);
+	pcxt = node->pei->pcxt;
+
+	if (pcxt != NULL)
+	{
+		LaunchParallelWorkers(pcxt);
+
+		node->nreaders = pcxt->nworkers;
+		node->reader = (shm_mq_handle **)
+			palloc(node->nreaders * sizeof(shm_mq_handle *));
+		node->reader_mq = (shm_mq **)
+			palloc(node->nreaders * sizeof(shm_mq *));
+		for (i = 0; i < node->nreaders; i++)
+		{
+			node->reader_mq[i] = ParallelWorkerQueue(pcxt, i);
+			node->reader[i] = shm_mq_attach(node->reader_mq[i]);
+		}
+	}
+
+	node->initialized = true;
+}
+
+/*
+ * Poll each worker's queue once, starting where we left off last time.
+ * Returns NULL if no tuple is waiting.  Workers that have finished are
+ * dropped from the set of readers.
+ */
+static HeapTuple
+GatherReadNext(GatherState *node)
+{
+	int			nvisited = 0;
+
+	while (nvisited < node->nreaders)
+	{
+		HeapTuple	tuple;
+		bool		done;
+
+		tuple = TupleQueueReceiveTuple(node->reader[node->nextreader],
+									   true, &done);
+		if (tuple != NULL)
+		{
+			/* Move on, so that one busy worker doesn't starve the rest */
+			node->nextreader = (node->nextreader + 1) % node->nreaders;
+			return tuple;
+		}
+
+		if (done)
+		{
+			/* A worker that failed must not look like one that finished */
+			CheckParallelWorkers(node->pei->pcxt);
+
+			shm_mq_handle_free(node->reader[node->nextreader]);
+			--node->nreaders;
+			memmove(&node->reader[node->nextreader],
+					&node->reader[node->nextreader + 1],
+					sizeof(shm_mq_handle *) *
+					(node->nreaders - node->nextreader));
+			memmove(&node->reader_mq[node->nextreader],
+					&node->reader_mq[node->nextreader + 1],
+					sizeof(shm_mq *) * (node->nreaders - node->nextreader));
+			if (node->nextreader >= node->nreaders)
+				node->nextreader = 0;
+			continue;
+		}
+
+		node->nextreader = (node->nextreader + 1) % node->nreaders;
+		nvisited++;
+	}
+
+	return NULL;
+}
+
+/*
+ * Stop the workers, wait for them to exit, and release the parallel
+ * context.  The local copy of the subplan must not be run again until
+ * StartGather has supplied it with new shared state.
+ */
+static void
+ShutdownGather(GatherState *node)
+{
+	int			i;
+
+	if (!node->initialized)
+		return;
+
+	if (node->pei->pcxt != NULL)
+	{
+		/* Tell everybody to stop, and stop listening to them */
+		ExecParallelStop(node->pei);
+		for (i = 0; i < node->nreaders; i++)
+		{
+			shm_mq_detach(node->reader_mq[i]);
+			shm_mq_handle_free(node->reader[i]);
+		}
+		node->nreaders = 0;
+		pfree(node->reader);
+		pfree(node->reader_mq);
+
+		WaitForParallelWorkersToFinish(node->pei->pcxt);
+	}
+
+	ExecParallelCleanup(node->pei);
+	node->pei = NULL;
+	node->initialized = false;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecEndGather
+ *
+ *		frees any storage allocated through C routines.
+ * ----------------------------------------------------------------
+ */
+void
+ExecEndGather(GatherState *node)
+{
+	ShutdownGather(node);
+
+	ExecClearTuple(node->funnel_slot);
+	ExecClearTuple(node->ps.ps_ResultTupleSlot);
+
+	ExecEndNode(outerPlanState(node));
+}
+
+/* ----------------------------------------------------------------
+ *		ExecReScanGather
+ *
+ *		The workers can't be restarted, so we shut them down and launch
+ *		new ones at the next fetch.
+ * ----------------------------------------------------------------
+ */
+void
+ExecReScanGather(GatherState *node)
+{
+	ShutdownGather(node);
+
+	ExecClearTuple(node->funnel_slot);
+
+	/*
+	 * Rescan the child at once, even if its parameters changed, so that it
+	 * doesn't throw away the shared state we give it at the next fetch.
+	 */
+	ExecReScan(outerPlanState(node));
+}
@@ -17,6 +17,9 @@
  *		MultiExecHash	- generate an in-memory hash table of the relation
  *		ExecInitHash	- initialize node and subnodes
  *		ExecEndHash		- shutdown node and subnodes
+ *
+ * A parallel hash join shares a single hash table among its participants;
+ * the routines that manage that are at the end of this file.
  */
 
 #include "postgres.h"
@@ -25,6 +28,7 @@
 #include <limits.h>
 
 #include "catalog/pg_statistic.h"
+#include "catalog/pg_tablespace.h"
 #include "commands/tablespace.h"
 #include "executor/execdebug.h"
 #include "executor/hashjoin.h"
@@ -33,20 +37,48 @@
 #include "executor/nodeHashjoin.h"
 #include "miscadmin.h"
 #include "parser/parse_expr.h"
+#include "postmaster/parallelworker.h"
+#include "storage/fd.h"
+#include "storage/ipc.h"
 #include "utils/dynahash.h"
 #include "utils/memutils.h"
 #include "utils/lsyscache.h"
 #include "utils/syscache.h"
 
 
+static void ChooseHashTableSize(double ntuples, int tupwidth, bool useskew,
+					long hash_table_bytes,
+					int *numbuckets,
+					int *numbatches,
+					int *num_skew_mcvs);
 static void ExecHashIncreaseNumBatches(HashJoinTable hashtable);
 static void ExecHashBuildSkewHash(HashJoinTable hashtable, Hash *node,
 					  int mcvsToUse);
+static void *ExecHashSkewAlloc(HashJoinTable hashtable, Size size);
 static void ExecHashSkewTableInsert(HashJoinTable hashtable,
 						TupleTableSlot *slot,
 						uint32 hashvalue,
 						int bucketNumber);
 static void ExecHashRemoveNextSkewBucket(HashJoinTable hashtable);
+static void ExecHashSharedInsert(HashJoinTable hashtable,
+					 MinimalTuple tuple,
+					 uint32 hashvalue);
+static bool ExecHashSharedSkewInsert(HashJoinTable hashtable,
+						 MinimalTuple tuple,
+						 uint32 hashvalue,
+						 int bucketNumber);
+static HashJoinTuple ExecHashSharedAlloc(HashJoinTable hashtable, Size size);
+static void ExecHashSharedGrow(HashJoinTable hashtable, bool request);
+static void ExecHashSharedIncreaseNumBatches(HashJoinTable hashtable);
+static void ExecHashSharedWait(HashJoinTable hashtable);
+static void ExecHashSharedNextPhase(HashJoinTable hashtable);
+static bool ExecHashSharedBatchExists(HashJoinTable hashtable, int batchno,
+						  bool inner);
+static void ExecHashSharedRefresh(HashJoinTable hashtable);
+static void ExecHashSharedFlush(HashJoinTable hashtable);
+static void ExecHashSharedSleep(HashJoinTable hashtable);
+static void ExecHashSharedWakeAll(HashJoinShared shared);
+static void ExecHashSharedExit(void);
 
 
 /* ----------------------------------------------------------------
@@ -78,6 +110,7 @@ MultiExecHash(HashState *node)
 	TupleTableSlot *slot;
 	ExprContext *econtext;
 	uint32		hashvalue;
+	BloomFilter bloom = NULL;
 
 	/* must provide our own instrumentation support */
 	if (node->ps.instrument)
@@ -95,6 +128,19 @@ MultiExecHash(HashState *node)
 	hashkeys = node->hashkeys;
 	econtext = node->ps.ps_ExprContext;
 
+	/*
+	 * If our parent pushed a Bloom filter down to its outer scan, build it
+	 * alongside the hash table.  It's sized from the planner's estimate and
+	 * allowed a small fraction of work_mem on top of the table itself.
+	 */
+	if (node->filter)
+	{
+		MemoryContext oldcxt = MemoryContextSwitchTo(hashtable->hashCxt);
+
+		bloom = bloom_create(node->ps.plan->plan_rows, work_mem * 1024L / 8);
+		MemoryContextSwitchTo(oldcxt);
+	}
+
 	/*
 	 * get all inner tuples and insert into the hash table (or temp files)
 	 */
@@ -110,6 +156,9 @@ MultiExecHash(HashState *node)
 		{
 			int			bucketNumber;
 
+			if (bloom)
+				bloom_add_hash(bloom, hashvalue);
+
 			bucketNumber = ExecHashGetSkewBucket(hashtable, hashvalue);
 			if (bucketNumber != INVALID_SKEW_BUCKET_NO)
 			{
@@ -126,6 +175,25 @@ MultiExecHash(HashState *node)
 		}
 	}
 
+	/* in a parallel hash join, add our tuples to the shared count */
+	if (hashtable->shared)
+	{
+		volatile HashJoinSharedData *shared = hashtable->shared;
+
+		SpinLockAcquire(&shared->mutex);
+		shared->totalTuples += hashtable->totalTuples;
+		SpinLockRelease(&shared->mutex);
+	}
+
+	if (node->filter)
+	{
+		node->filter->bloom = bloom;
+		node->filter->hashtable = hashtable;
+		node->filter->nprobes = 0;
+		node->filter->nrejected = 0;
+		node->filter->disabled = false;
+	}
+
 	/* must provide our own instrumentation support */
 	if (node->ps.instrument)
 		InstrStopNode(node->ps.instrument, hashtable->totalTuples);
@@ -228,10 +296,15 @@ ExecEndHash(HashState *node)
  *		ExecHashTableCreate
  *
  *		create an empty hashtable data structure for hashjoin.
+ *
+ *		If shared isn't NULL, the table is a parallel hash join's shared
+ *		table, set up by ExecHashTableInitializeShared; we just make our
+ *		own control block for it, and the caller must attach to it with
+ *		ExecHashTableAttach before using it.
  * ----------------------------------------------------------------
  */
 HashJoinTable
-ExecHashTableCreate(Hash *node, List *hashOperators)
+ExecHashTableCreate(Hash *node, List *hashOperators, HashJoinShared shared)
 {
 	HashJoinTable hashtable;
 	Plan	   *outerNode;
@@ -251,9 +324,16 @@ ExecHashTableCreate(Hash *node, List *hashOperators)
 	 */
 	outerNode = outerPlan(node);
 
-	ExecChooseHashTableSize(outerNode->plan_rows, outerNode->plan_width,
-							OidIsValid(node->skewTable),
-							&nbuckets, &nbatch, &num_skew_mcvs);
+	if (shared)
+	{
+		nbuckets = shared->nbuckets;
+		nbatch = shared->nbatch;
+		num_skew_mcvs = 0;
+	}
+	else
+		ExecChooseHashTableSize(outerNode->plan_rows, outerNode->plan_width,
+								OidIsValid(node->skewTable),
+								&nbuckets, &nbatch, &num_skew_mcvs);
 
 #ifdef HJDEBUG
 	printf("nbatch = %d, nbuckets = %d\n", nbatch, nbuckets);
@@ -292,6 +372,13 @@ ExecHashTableCreate(Hash *node, List *hashOperators)
 	hashtable->spaceUsedSkew = 0;
 	hashtable->spaceAllowedSkew =
 		hashtable->spaceAllowed * SKEW_WORK_MEM_PERCENT / 100;
+	hashtable->shared = shared;
+	hashtable->pcxt = NULL;
+	hashtable->participant = -1;
+	hashtable->phase = HJ_PHASE_BUILD;
+	hashtable->phaseno = 0;
+	hashtable->chunk = NULL;
+	hashtable->readFile = NULL;
 
 	/*
 	 * Get info about the hash functions to be used for each hash key. Also
@@ -353,6 +440,23 @@ ExecHashTableCreate(Hash *node, List *hashOperators)
 		PrepareTempTablespaces();
 	}
 
+	/*
+	 * A shared table's buckets and skew hash table are in the shared space,
+	 * and the skew hash table's layout is copied when we attach.
+	 */
+	if (shared)
+	{
+		hashtable->buckets = shared->buckets;
+		hashtable->skewEnabled = shared->skewEnabled;
+		hashtable->skewBucket = shared->skewBucket;
+		hashtable->skewBucketLen = shared->skewBucketLen;
+		hashtable->nSkewBuckets = shared->nSkewBuckets;
+		hashtable->skewBucketNums = shared->skewBucketNums;
+		hashtable->spaceAllowed = shared->space_top - shared->chunk_start;
+		MemoryContextSwitchTo(oldcxt);
+		return hashtable;
+	}
+
 	/*
 	 * Prepare context for the first-scan space allocations; allocate the
 	 * hashbucket array therein, and set each bucket "empty".
@@ -390,10 +494,28 @@ ExecChooseHashTableSize(double ntuples, int tupwidth, bool useskew,
 						int *numbuckets,
 						int *numbatches,
 						int *num_skew_mcvs)
+{
+	/*
+	 * Target in-memory hashtable size is work_mem kilobytes.
+	 */
+	ChooseHashTableSize(ntuples, tupwidth, useskew, work_mem * 1024L,
+						numbuckets, numbatches, num_skew_mcvs);
+}
+
+/*
+ * Workhorse for ExecChooseHashTableSize, taking the space allowed for the
+ * hash table in bytes.  A parallel hash join gets more than work_mem.
+ */
+static void
+ChooseHashTableSize(double ntuples, int tupwidth, bool useskew,
+					long hash_table_bytes,
+					int *numbuckets,
+					int *numbatches,
+					int *num_skew_mcvs)
 {
 	int			tupsize;
 	double		inner_rel_bytes;
-	long		hash_table_bytes;
+	long		space_allowed = hash_table_bytes;
 	long		skew_table_bytes;
 	long		max_pointers;
 	int			nbatch;
@@ -414,11 +536,6 @@ ExecChooseHashTableSize(double ntuples, int tupwidth, bool useskew,
 		MAXALIGN(tupwidth);
 	inner_rel_bytes = ntuples * tupsize;
 
-	/*
-	 * Target in-memory hashtable size is work_mem kilobytes.
-	 */
-	hash_table_bytes = work_mem * 1024L;
-
 	/*
 	 * If skew optimization is possible, estimate the number of skew buckets
 	 * that will fit in the memory allowed, and decrement the assumed space
@@ -459,9 +576,9 @@ ExecChooseHashTableSize(double ntuples, int tupwidth, bool useskew,
 	 * Set nbuckets to achieve an average bucket load of NTUP_PER_BUCKET when
 	 * memory is filled.  Set nbatch to the smallest power of 2 that appears
 	 * sufficient.	The Min() steps limit the results so that the pointer
-	 * arrays we'll try to allocate do not exceed work_mem.
+	 * arrays we'll try to allocate do not exceed the space allowed.
 	 */
-	max_pointers = (work_mem * 1024L) / sizeof(void *);
+	max_pointers = space_allowed / sizeof(void *);
 	/* also ensure we avoid integer overflow in nbatch and nbuckets */
 	max_pointers = Min(max_pointers, INT_MAX / 2);
 
@@ -534,6 +651,8 @@ ExecHashTableDestroy(HashJoinTable hashtable)
 		if (hashtable->outerBatchFile[i])
 			BufFileClose(hashtable->outerBatchFile[i]);
 	}
+	if (hashtable->readFile)
+		BufFileClose(hashtable->readFile);
 
 	/* Release working memory (batchCxt is a child, so it goes away too) */
 	MemoryContextDelete(hashtable->hashCxt);
@@ -698,6 +817,12 @@ ExecHashTableInsert(HashJoinTable hashtable,
 	int			bucketno;
 	int			batchno;
 
+	if (hashtable->shared)
+	{
+		ExecHashSharedInsert(hashtable, tuple, hashvalue);
+		return;
+	}
+
 	ExecHashGetBucketAndBatch(hashtable, hashvalue,
 							  &bucketno, &batchno);
 
@@ -1063,11 +1188,10 @@ ExecHashBuildSkewHash(HashJoinTable hashtable, Hash *node, int mcvsToUse)
 		 * automatically removed once the first batch is done.
 		 */
 		hashtable->skewBucket = (HashSkewBucket **)
-			MemoryContextAllocZero(hashtable->batchCxt,
-								   nbuckets * sizeof(HashSkewBucket *));
+			ExecHashSkewAlloc(hashtable,
+							  nbuckets * sizeof(HashSkewBucket *));
 		hashtable->skewBucketNums = (int *)
-			MemoryContextAllocZero(hashtable->batchCxt,
-								   mcvsToUse * sizeof(int));
+			ExecHashSkewAlloc(hashtable, mcvsToUse * sizeof(int));
 
 		hashtable->spaceUsed += nbuckets * sizeof(HashSkewBucket *)
 			+ mcvsToUse * sizeof(int);
@@ -1115,8 +1239,7 @@ ExecHashBuildSkewHash(HashJoinTable hashtable, Hash *node, int mcvsToUse)
 
 			/* Okay, create a new skew bucket for this hashvalue. */
 			hashtable->skewBucket[bucket] = (HashSkewBucket *)
-				MemoryContextAlloc(hashtable->batchCxt,
-								   sizeof(HashSkewBucket));
+				ExecHashSkewAlloc(hashtable, sizeof(HashSkewBucket));
 			hashtable->skewBucket[bucket]->hashvalue = hashvalue;
 			hashtable->skewBucket[bucket]->tuples = NULL;
 			hashtable->skewBucketNums[hashtable->nSkewBuckets] = bucket;
@@ -1134,6 +1257,27 @@ ExecHashBuildSkewHash(HashJoinTable hashtable, Hash *node, int mcvsToUse)
 	ReleaseSysCache(statsTuple);
 }
 
+/*
+ * ExecHashSkewAlloc
+ *
+ *		Allocate zeroed space for the skew hash table, in the batch context
+ *		or, for a parallel hash join, at the top of the shared space.  The
+ *		shared table has just been set up, so there's sure to be room.
+ */
+static void *
+ExecHashSkewAlloc(HashJoinTable hashtable, Size size)
+{
+	HashJoinShared shared = hashtable->shared;
+
+	if (shared == NULL)
+		return MemoryContextAllocZero(hashtable->batchCxt, size);
+
+	shared->space_end -= MAXALIGN(size);
+	Assert(shared->space_end >= shared->space_next);
+	MemSet(shared->space_end, 0, size);
+	return shared->space_end;
+}
+
 /*
  * ExecHashGetSkewBucket
  *
@@ -1197,6 +1341,15 @@ ExecHashSkewTableInsert(HashJoinTable hashtable,
 	HashJoinTuple hashTuple;
 	int			hashTupleSize;
 
+	if (hashtable->shared)
+	{
+		/* if the bucket has just been removed, insert normally */
+		if (!ExecHashSharedSkewInsert(hashtable, tuple, hashvalue,
+									  bucketNumber))
+			ExecHashSharedInsert(hashtable, tuple, hashvalue);
+		return;
+	}
+
 	/* Create the HashJoinTuple */
 	hashTupleSize = HJTUPLE_OVERHEAD + tuple->t_len;
 	hashTuple = (HashJoinTuple) MemoryContextAlloc(hashtable->batchCxt,
@@ -1322,3 +1475,977 @@ ExecHashRemoveNextSkewBucket(HashJoinTable hashtable)
 		hashtable->spaceUsedSkew = 0;
 	}
 }
+
+
+/* ----------------------------------------------------------------
+ *				Parallel hash join support
+ *
+ * The leader sets up the shared table with ExecHashTableInitializeShared
+ * before launching the workers.  Every participant then makes its own
+ * control block for it with ExecHashTableCreate, joins in with
+ * ExecHashTableAttach, and goes from phase to phase with
+ * ExecHashTableArrive; the leader leaves early with ExecHashTableDetach,
+ * so that it can get back to reading the workers' output.
+ *
+ * Nobody waits for a participant that might itself be waiting for the
+ * leader to read its output: the leader only waits while batch 0 is being
+ * built, when nobody produces any.
+ * ----------------------------------------------------------------
+ */
+
+/* Distinguishes the batch files of successive joins in this backend */
+static int	hash_fileset_counter = 0;
+
+/*
+ * ExecHashTableInitializeShared
+ *
+ *		Set up the shared table of a parallel hash join, for up to
+ *		maxparticipants participants, in size bytes of shared space.
+ *		The table gets all the space that the control block doesn't.
+ */
+void
+ExecHashTableInitializeShared(Hash *node, List *hashOperators, bool outerjoin,
+							  char *space, Size size, int maxparticipants)
+{
+	HashJoinShared shared = (HashJoinShared) space;
+	Plan	   *outerNode = outerPlan(node);
+	Size		hdrsize = HashJoinSharedSize(maxparticipants);
+	int			nbuckets;
+	int			nbatch;
+	int			num_skew_mcvs;
+	Oid			tablespace;
+	int			i;
+
+	Assert(size > hdrsize);
+
+	MemSet(shared, 0, hdrsize);
+	SpinLockInit(&shared->mutex);
+	SpinLockInit(&shared->skewlock);
+	for (i = 0; i < HJ_NUM_BUCKET_LOCKS; i++)
+		SpinLockInit(&shared->bucketlocks[i]);
+
+	ChooseHashTableSize(outerNode->plan_rows, outerNode->plan_width,
+						OidIsValid(node->skewTable), size - hdrsize,
+						&nbuckets, &nbatch, &num_skew_mcvs);
+
+	shared->phase = HJ_PHASE_BUILD;
+	shared->curbatch = 0;
+	shared->nbatch = nbatch;
+	shared->nbatch_original = nbatch;
+	shared->nbatch_outstart = nbatch;
+	shared->growEnabled = true;
+	shared->outerjoin = outerjoin;
+	shared->nbuckets = nbuckets;
+	shared->log2_nbuckets = my_log2(nbuckets);
+	Assert(nbuckets == (1 << shared->log2_nbuckets));
+
+	/* The bucket array comes first, then the tuple chunks */
+	shared->space_start = space + hdrsize;
+	shared->buckets = (HashJoinTuple *) shared->space_start;
+	MemSet(shared->buckets, 0, nbuckets * sizeof(HashJoinTuple));
+	shared->chunk_start = shared->space_start +
+		MAXALIGN(nbuckets * sizeof(HashJoinTuple));
+	shared->space_next = shared->chunk_start;
+	shared->space_top = space + size;
+	shared->space_end = shared->space_top;
+	shared->spaceAllowedSkew = (size - hdrsize) * SKEW_WORK_MEM_PERCENT / 100;
+
+	/*
+	 * The batch files all go in one tablespace, so that the participants
+	 * can find each other's files.
+	 */
+	PrepareTempTablespaces();
+	tablespace = GetNextTempTableSpace();
+	if (!OidIsValid(tablespace))
+		tablespace = MyDatabaseTableSpace ? MyDatabaseTableSpace :
+			DEFAULTTABLESPACE_OID;
+	shared->tablespace = tablespace;
+	shared->leader_pid = MyProcPid;
+	shared->fileset = hash_fileset_counter++;
+	shared->maxparticipants = maxparticipants;
+
+	/* Set up for skew optimization, as ExecHashTableCreate would */
+	if (nbatch > 1)
+	{
+		HashJoinTable hashtable;
+
+		hashtable = ExecHashTableCreate(node, hashOperators, shared);
+		ExecHashBuildSkewHash(hashtable, node, num_skew_mcvs);
+		shared->skewEnabled = hashtable->skewEnabled;
+		shared->skewBucket = hashtable->skewBucket;
+		shared->skewBucketLen = hashtable->skewBucketLen;
+		shared->nSkewBuckets = hashtable->nSkewBuckets;
+		shared->skewBucketNums = hashtable->skewBucketNums;
+		shared->spaceUsedSkew = hashtable->spaceUsedSkew;
+		ExecHashTableDestroy(hashtable);
+	}
+
+	shared->spacePeak = (shared->space_next - shared->space_start) +
+		(shared->space_top - shared->space_end);
+}
+
+/*
+ * ExecHashTableAttach
+ *
+ *		Join in the work on a parallel hash join's shared table.
+ *
+ * We can only join in while batch 0 is being built or probed, and not
+ * while nbatch is being increased, since the others might already have
+ * stopped inserting for that.  Returns false, without attaching, if we
+ * can't.
+ */
+bool
+ExecHashTableAttach(HashJoinTable hashtable)
+{
+	volatile HashJoinSharedData *shared = hashtable->shared;
+	bool		attached = false;
+
+	Assert(hashtable->participant < 0);
+
+	SpinLockAcquire(&shared->mutex);
+	if (shared->curbatch == 0 && shared->phase != HJ_PHASE_DONE &&
+		!shared->transitioning && !shared->growthNeeded &&
+		!shared->abandoned && shared->nattached < shared->maxparticipants)
+	{
+		hashtable->participant = shared->nattached++;
+		shared->procs[hashtable->participant] = MyProc;
+		shared->nparticipants++;
+		attached = true;
+	}
+	SpinLockRelease(&shared->mutex);
+
+	if (attached)
+		ExecHashSharedRefresh(hashtable);
+
+	return attached;
+}
+
+/*
+ * ExecHashTableArrive
+ *
+ *		Finish our part in the current phase of a parallel hash join, and
+ *		wait until everybody else has finished theirs and the join has
+ *		moved on to its next phase.
+ */
+void
+ExecHashTableArrive(HashJoinTable hashtable)
+{
+	volatile HashJoinSharedData *shared = hashtable->shared;
+
+	/* Let the others read what we've written to our batch files */
+	ExecHashSharedFlush(hashtable);
+
+	SpinLockAcquire(&shared->mutex);
+	shared->nwaiting++;
+	SpinLockRelease(&shared->mutex);
+
+	ExecHashSharedWait(hashtable);
+	ExecHashSharedRefresh(hashtable);
+}
+
+/*
+ * ExecHashTableDetach
+ *
+ *		Stop taking part in a parallel hash join once batch 0 has been
+ *		probed, leaving any remaining batches to the others.
+ *
+ * If nobody else is attached, we have to carry on by ourselves: the join
+ * moves on to its next phase as in ExecHashTableArrive, and we return
+ * false.  Either way, nobody can attach from now on.
+ */
+bool
+ExecHashTableDetach(HashJoinTable hashtable)
+{
+	volatile HashJoinSharedData *shared = hashtable->shared;
+	bool		alone;
+	bool		mine = false;
+
+	Assert(hashtable->curbatch == 0 && hashtable->phase == HJ_PHASE_PROBE);
+
+	ExecHashSharedFlush(hashtable);
+
+	SpinLockAcquire(&shared->mutex);
+	alone = (shared->nparticipants == 1);
+	if (alone)
+	{
+		Assert(!shared->transitioning);
+		shared->transitioning = true;
+		mine = true;
+	}
+	else
+	{
+		shared->nparticipants--;
+		shared->procs[hashtable->participant] = NULL;
+		if (shared->nwaiting == shared->nparticipants &&
+			!shared->transitioning)
+		{
+			shared->transitioning = true;
+			mine = true;
+		}
+	}
+	SpinLockRelease(&shared->mutex);
+
+	if (mine)
+	{
+		ExecHashSharedNextPhase(hashtable);
+
+		SpinLockAcquire(&shared->mutex);
+		shared->phaseno++;
+		shared->nwaiting = 0;
+		shared->transitioning = false;
+		SpinLockRelease(&shared->mutex);
+
+		ExecHashSharedWakeAll(hashtable->shared);
+	}
+
+	if (alone)
+	{
+		ExecHashSharedRefresh(hashtable);
+		return false;
+	}
+
+	/* We're done; our batch files stay until we destroy the table */
+	hashtable->phase = HJ_PHASE_DONE;
+	hashtable->curbatch = hashtable->nbatch;
+	return true;
+}
+
+/*
+ * ExecHashTableAbandonShared
+ *
+ *		Tell the participants in a parallel hash join that the leader has
+ *		stopped reading their output.  Any that are waiting for the others
+ *		just exit.
+ */
+void
+ExecHashTableAbandonShared(HashJoinShared shared)
+{
+	volatile HashJoinSharedData *vshared = shared;
+
+	SpinLockAcquire(&vshared->mutex);
+	vshared->abandoned = true;
+	SpinLockRelease(&vshared->mutex);
+
+	ExecHashSharedWakeAll(shared);
+}
+
+/*
+ * ExecHashTableNextSharedFile
+ *
+ *		Claim the next batch file of the current phase to read, returning
+ *		the participant number of its writer, or -1 if there are no more.
+ */
+int
+ExecHashTableNextSharedFile(HashJoinTable hashtable)
+{
+	volatile HashJoinSharedData *shared = hashtable->shared;
+	int			participant = -1;
+
+	SpinLockAcquire(&shared->mutex);
+	if (shared->nextfile < shared->nattached)
+		participant = shared->nextfile++;
+	SpinLockRelease(&shared->mutex);
+
+	return participant;
+}
+
+/*
+ * ExecHashSharedInsert
+ *		insert a tuple into a parallel hash join's shared table, or into one
+ *		of our batch files if it belongs to a later batch
+ *
+ * This should generally match up with ExecHashTableInsert.
+ */
+static void
+ExecHashSharedInsert(HashJoinTable hashtable,
+					 MinimalTuple tuple,
+					 uint32 hashvalue)
+{
+	volatile HashJoinSharedData *shared = hashtable->shared;
+	HashJoinTuple hashTuple;
+	int			bucketno;
+	int			batchno;
+	volatile slock_t *lock;
+
+	for (;;)
+	{
+		ExecHashGetBucketAndBatch(hashtable, hashvalue,
+								  &bucketno, &batchno);
+		if (batchno != hashtable->curbatch)
+		{
+			Assert(batchno > hashtable->curbatch);
+			ExecHashJoinSaveBatchTuple(hashtable, tuple, hashvalue,
+									   batchno, true);
+			return;
+		}
+
+		hashTuple = ExecHashSharedAlloc(hashtable,
+										HJTUPLE_OVERHEAD + tuple->t_len);
+		if (hashTuple != NULL)
+			break;
+
+		/* Out of space, so make some; the tuple may then go to a file */
+		ExecHashSharedGrow(hashtable, true);
+	}
+
+	hashTuple->hashvalue = hashvalue;
+	memcpy(HJTUPLE_MINTUPLE(hashTuple), tuple, tuple->t_len);
+
+	lock = &shared->bucketlocks[bucketno % HJ_NUM_BUCKET_LOCKS];
+	SpinLockAcquire(lock);
+	hashTuple->next = shared->buckets[bucketno];
+	shared->buckets[bucketno] = hashTuple;
+	SpinLockRelease(lock);
+
+	/* Help out if somebody else has run out of space */
+	if (shared->growthNeeded)
+		ExecHashSharedGrow(hashtable, false);
+}
+
+/*
+ * ExecHashSharedSkewInsert
+ *		insert a tuple into a parallel hash join's skew hash table
+ *
+ * This should generally match up with ExecHashSkewTableInsert.  Returns
+ * false if the skew bucket has been removed, or there's no room; the
+ * caller must then insert the tuple normally.
+ */
+static bool
+ExecHashSharedSkewInsert(HashJoinTable hashtable,
+						 MinimalTuple tuple,
+						 uint32 hashvalue,
+						 int bucketNumber)
+{
+	volatile HashJoinSharedData *shared = hashtable->shared;
+	Size		hashTupleSize = MAXALIGN(HJTUPLE_OVERHEAD + tuple->t_len);
+	HashJoinTuple hashTuple;
+	HashSkewBucket *bucket;
+	HashSkewBucket *removed = NULL;
+	Size		used;
+
+	/* Take space from the top of the shared space */
+	SpinLockAcquire(&shared->mutex);
+	if (shared->space_end - shared->space_next < hashTupleSize)
+	{
+		SpinLockRelease(&shared->mutex);
+		return false;
+	}
+	shared->space_end -= hashTupleSize;
+	hashTuple = (HashJoinTuple) shared->space_end;
+	used = (shared->space_next - shared->space_start) +
+		(shared->space_top - shared->space_end);
+	if (used > shared->spacePeak)
+		shared->spacePeak = used;
+	SpinLockRelease(&shared->mutex);
+
+	hashTuple->hashvalue = hashvalue;
+	memcpy(HJTUPLE_MINTUPLE(hashTuple), tuple, tuple->t_len);
+
+	SpinLockAcquire(&shared->skewlock);
+	bucket = shared->skewBucket[bucketNumber];
+	if (bucket == NULL)
+	{
+		/* the space we took is wasted, but this is rare */
+		SpinLockRelease(&shared->skewlock);
+		return false;
+	}
+
+	/* Push it onto the front of the skew bucket's list */
+	hashTuple->next = bucket->tuples;
+	bucket->tuples = hashTuple;
+
+	/*
+	 * If we've used too much, remove the least valuable skew bucket, in the
+	 * order explained in ExecHashRemoveNextSkewBucket.
+	 */
+	shared->spaceUsedSkew += hashTupleSize;
+	if (shared->spaceUsedSkew > shared->spaceAllowedSkew)
+	{
+		int			bucketToRemove;
+
+		bucketToRemove = shared->skewBucketNums[shared->nSkewBuckets - 1];
+		removed = shared->skewBucket[bucketToRemove];
+		shared->skewBucket[bucketToRemove] = NULL;
+		if (--shared->nSkewBuckets == 0)
+			shared->skewEnabled = false;
+	}
+	SpinLockRelease(&shared->skewlock);
+
+	/*
+	 * Copy the removed bucket's tuples into the main hash table, or our
+	 * batch files.  Unlike ExecHashRemoveNextSkewBucket, we can't relink
+	 * them, since the main table's chunks may be moved about.
+	 */
+	if (removed != NULL)
+	{
+		Size		freed = 0;
+
+		hashTuple = removed->tuples;
+		while (hashTuple != NULL)
+		{
+			HashJoinTuple nextHashTuple = hashTuple->next;
+			MinimalTuple mintuple = HJTUPLE_MINTUPLE(hashTuple);
+
+			freed += MAXALIGN(HJTUPLE_OVERHEAD + mintuple->t_len);
+			ExecHashSharedInsert(hashtable, mintuple, hashTuple->hashvalue);
+			hashTuple = nextHashTuple;
+		}
+
+		SpinLockAcquire(&shared->skewlock);
+		shared->spaceUsedSkew -= freed;
+		SpinLockRelease(&shared->skewlock);
+	}
+
+	return true;
+}
+
+/*
+ * ExecHashSharedAlloc
+ *		allocate space for a tuple in a parallel hash join's shared table
+ *
+ * Small tuples go in the chunk we are filling, if there's room; otherwise
+ * we take a new chunk from the shared space.  Returns NULL if the space is
+ * exhausted.
+ */
+static HashJoinTuple
+ExecHashSharedAlloc(HashJoinTable hashtable, Size size)
+{
+	volatile HashJoinSharedData *shared = hashtable->shared;
+	HashMemoryChunk chunk = hashtable->chunk;
+	Size		maxlen;
+	Size		used;
+
+	size = MAXALIGN(size);
+
+	if (size <= HASH_CHUNK_THRESHOLD && chunk != NULL &&
+		chunk->used + size <= chunk->maxlen)
+	{
+		char	   *result = HASH_CHUNK_DATA(chunk) + chunk->used;
+
+		chunk->used += size;
+		return (HashJoinTuple) result;
+	}
+
+	/* A big tuple gets a chunk to itself */
+	maxlen = (size > HASH_CHUNK_THRESHOLD) ? size : HASH_CHUNK_SIZE;
+
+	SpinLockAcquire(&shared->mutex);
+	if (shared->space_end - shared->space_next <
+		HASH_CHUNK_HEADER_SIZE + maxlen)
+	{
+		SpinLockRelease(&shared->mutex);
+		return NULL;
+	}
+	chunk = (HashMemoryChunk) shared->space_next;
+	shared->space_next += HASH_CHUNK_HEADER_SIZE + maxlen;
+	used = (shared->space_next - shared->space_start) +
+		(shared->space_top - shared->space_end);
+	if (used > shared->spacePeak)
+		shared->spacePeak = used;
+	SpinLockRelease(&shared->mutex);
+
+	chunk->maxlen = maxlen;
+	chunk->used = size;
+	if (maxlen == HASH_CHUNK_SIZE)
+		hashtable->chunk = chunk;
+
+	return (HashJoinTuple) HASH_CHUNK_DATA(chunk);
+}
+
+/*
+ * ExecHashSharedGrow
+ *
+ *		Take part in increasing nbatch in a parallel hash join: if request
+ *		is true, because we have run out of space, else because somebody
+ *		else has.  We wait until every participant has stopped inserting,
+ *		and the last one to get here does the work.
+ */
+static void
+ExecHashSharedGrow(HashJoinTable hashtable, bool request)
+{
+	volatile HashJoinSharedData *shared = hashtable->shared;
+	int			growgen;
+	bool		mine = false;
+
+	SpinLockAcquire(&shared->mutex);
+	if (request)
+	{
+		if (!shared->growEnabled)
+		{
+			SpinLockRelease(&shared->mutex);
+			ereport(ERROR,
+					(errcode(ERRCODE_OUT_OF_MEMORY),
+					 errmsg("out of shared memory for parallel hash join"),
+					 errhint("You might need to increase parallel_shared_memory.")));
+		}
+		shared->growthNeeded = true;
+	}
+	else if (!shared->growthNeeded)
+	{
+		/* somebody beat us to it */
+		SpinLockRelease(&shared->mutex);
+		return;
+	}
+	growgen = shared->growgen;
+	if (++shared->ngrowwaiting == shared->nparticipants)
+	{
+		shared->ngrowwaiting = 0;
+		mine = true;
+	}
+	SpinLockRelease(&shared->mutex);
+
+	/* Anybody who has finished inserting must come and help, too */
+	if (request && !mine)
+		ExecHashSharedWakeAll(hashtable->shared);
+
+	if (mine)
+	{
+		ExecHashSharedIncreaseNumBatches(hashtable);
+
+		SpinLockAcquire(&shared->mutex);
+		shared->growthNeeded = false;
+		shared->growgen++;
+		SpinLockRelease(&shared->mutex);
+
+		ExecHashSharedWakeAll(hashtable->shared);
+	}
+	else
+	{
+		for (;;)
+		{
+			bool		done;
+
+			SpinLockAcquire(&shared->mutex);
+			if (shared->abandoned)
+			{
+				SpinLockRelease(&shared->mutex);
+				ExecHashSharedExit();
+			}
+			done = (shared->growgen != growgen);
+			SpinLockRelease(&shared->mutex);
+
+			if (done)
+				break;
+			ExecHashSharedSleep(hashtable);
+		}
+	}
+
+	/* Our chunk may have been moved, and nbatch has changed */
+	hashtable->chunk = NULL;
+	ExecHashSharedRefresh(hashtable);
+}
+
+/*
+ * ExecHashSharedIncreaseNumBatches
+ *		double nbatch in a parallel hash join, moving the tuples that are
+ *		no longer of the current batch out to our own batch files
+ *
+ * This is the counterpart of ExecHashIncreaseNumBatches.  Everybody else
+ * is waiting, so we have the table to ourselves.  We compact the chunks in
+ * place as we go: the chunks we make are packed at least as tightly as the
+ * ones the tuples came from, so no tuple ever moves to a higher address.
+ * Skew tuples are not in the chunks, and stay where they are.
+ */
+static void
+ExecHashSharedIncreaseNumBatches(HashJoinTable hashtable)
+{
+	HashJoinShared shared = hashtable->shared;
+	int			curbatch = shared->curbatch;
+	HashMemoryChunk newchunk = NULL;
+	bool		newchunk_big = false;
+	char	   *src;
+	char	   *dst;
+	long		ninmemory;
+	long		nfreed;
+
+	/* safety check to avoid overflow */
+	if (shared->nbatch > INT_MAX / 2)
+	{
+		shared->growEnabled = false;
+		return;
+	}
+
+	shared->nbatch *= 2;
+	ExecHashSharedRefresh(hashtable);
+
+#ifdef HJDEBUG
+	printf("Increasing nbatch to %d in parallel hash join\n", shared->nbatch);
+#endif
+
+	MemSet(shared->buckets, 0, shared->nbuckets * sizeof(HashJoinTuple));
+
+	ninmemory = nfreed = 0;
+	src = dst = shared->chunk_start;
+	while (src < shared->space_next)
+	{
+		HashMemoryChunk chunk = (HashMemoryChunk) src;
+		char	   *tuples = HASH_CHUNK_DATA(chunk);
+		char	   *end = tuples + chunk->used;
+
+		/* Step past the chunk now; we may overwrite its header below */
+		src = tuples + chunk->maxlen;
+
+		while (tuples < end)
+		{
+			HashJoinTuple hashTuple = (HashJoinTuple) tuples;
+			Size		size;
+			int			bucketno;
+			int			batchno;
+
+			size = MAXALIGN(HJTUPLE_OVERHEAD +
+							HJTUPLE_MINTUPLE(hashTuple)->t_len);
+			tuples += size;
+			ninmemory++;
+
+			ExecHashGetBucketAndBatch(hashtable, hashTuple->hashvalue,
+									  &bucketno, &batchno);
+			if (batchno != curbatch)
+			{
+				/* dump it out */
+				Assert(batchno > curbatch);
+				ExecHashJoinSaveBatchTuple(hashtable,
+										   HJTUPLE_MINTUPLE(hashTuple),
+										   hashTuple->hashvalue,
+										   batchno, true);
+				nfreed++;
+				continue;
+			}
+
+			/* keep it, starting a new chunk as ExecHashSharedAlloc would */
+			if (newchunk == NULL || newchunk_big ||
+				size > HASH_CHUNK_THRESHOLD ||
+				newchunk->used + size > HASH_CHUNK_SIZE)
+			{
+				newchunk = (HashMemoryChunk) dst;
+				newchunk->used = 0;
+				newchunk_big = (size > HASH_CHUNK_THRESHOLD);
+				dst += HASH_CHUNK_HEADER_SIZE;
+			}
+			memmove(dst, hashTuple, size);
+			hashTuple = (HashJoinTuple) dst;
+			dst += size;
+			newchunk->used += size;
+			newchunk->maxlen = newchunk->used;
+
+			hashTuple->next = shared->buckets[bucketno];
+			shared->buckets[bucketno] = hashTuple;
+		}
+	}
+	shared->space_next = dst;
+
+#ifdef HJDEBUG
+	printf("Freed %ld of %ld tuples\n", nfreed, ninmemory);
+#endif
+
+	/* As in ExecHashIncreaseNumBatches */
+	if (nfreed == 0 || nfreed == ninmemory)
+		shared->growEnabled = false;
+}
+
+/*
+ * ExecHashSharedWait
+ *		wait for a parallel hash join to move on to its next phase
+ *
+ * Meanwhile, we take part in any increase of nbatch.  If we find that
+ * everybody has arrived, we move the join on ourselves.  Note that taking
+ * part in an increase refreshes hashtable->phaseno, so we must remember
+ * the phase we're waiting to leave.
+ */
+static void
+ExecHashSharedWait(HashJoinTable hashtable)
+{
+	volatile HashJoinSharedData *shared = hashtable->shared;
+	int			phaseno = hashtable->phaseno;
+
+	for (;;)
+	{
+		bool		growing;
+		bool		mine = false;
+
+		SpinLockAcquire(&shared->mutex);
+		if (shared->abandoned)
+		{
+			SpinLockRelease(&shared->mutex);
+			ExecHashSharedExit();
+		}
+		if (shared->phaseno != phaseno)
+		{
+			SpinLockRelease(&shared->mutex);
+			return;
+		}
+		growing = shared->growthNeeded;
+		if (!growing && !shared->transitioning &&
+			shared->nwaiting == shared->nparticipants)
+		{
+			shared->transitioning = true;
+			mine = true;
+		}
+		SpinLockRelease(&shared->mutex);
+
+		if (mine)
+		{
+			ExecHashSharedNextPhase(hashtable);
+
+			SpinLockAcquire(&shared->mutex);
+			shared->phaseno++;
+			shared->nwaiting = 0;
+			shared->transitioning = false;
+			SpinLockRelease(&shared->mutex);
+
+			ExecHashSharedWakeAll(hashtable->shared);
+			return;
+		}
+
+		if (growing)
+			ExecHashSharedGrow(hashtable, false);
+		else
+			ExecHashSharedSleep(hashtable);
+	}
+}
+
+/*
+ * ExecHashSharedNextPhase
+ *		move a parallel hash join on to its next phase
+ *
+ * Everybody else is waiting for us, or gone.
+ */
+static void
+ExecHashSharedNextPhase(HashJoinTable hashtable)
+{
+	HashJoinShared shared = hashtable->shared;
+	int			nbatch = shared->nbatch;
+	int			curbatch = shared->curbatch;
+
+	shared->nextfile = 0;
+
+	if (shared->phase == HJ_PHASE_BUILD)
+	{
+		if (curbatch == 0)
+		{
+			/*
+			 * If the inner relation is completely empty, and we're not doing
+			 * an outer join, we can quit without scanning the outer
+			 * relation.
+			 */
+			if (shared->totalTuples == 0 && !shared->outerjoin)
+			{
+				shared->phase = HJ_PHASE_DONE;
+				return;
+			}
+
+			/* remember whether nbatch increases during the outer scan */
+			shared->nbatch_outstart = nbatch;
+		}
+		shared->phase = HJ_PHASE_PROBE;
+		return;
+	}
+
+	Assert(shared->phase == HJ_PHASE_PROBE);
+
+	/*
+	 * Find the next batch to process, skipping over those we can ignore by
+	 * the rules explained in ExecHashJoinNewBatch.
+	 */
+	for (curbatch++; curbatch < nbatch; curbatch++)
+	{
+		bool		inner = ExecHashSharedBatchExists(hashtable, curbatch, true);
+		bool		outer = ExecHashSharedBatchExists(hashtable, curbatch, false);
+
+		if (inner && outer)
+			break;
+		if (outer && shared->outerjoin)
+			break;				/* must process due to rule 1 */
+		if (inner && nbatch != shared->nbatch_original)
+			break;				/* must process due to rule 2 */
+		if (outer && nbatch != shared->nbatch_outstart)
+			break;				/* must process due to rule 3 */
+	}
+
+	if (curbatch >= nbatch)
+	{
+		shared->phase = HJ_PHASE_DONE;
+		return;
+	}
+
+	/* Empty the table for the new batch; the skew table is gone for good */
+	MemSet(shared->buckets, 0, shared->nbuckets * sizeof(HashJoinTuple));
+	shared->space_next = shared->chunk_start;
+	shared->space_end = shared->space_top;
+	shared->skewEnabled = false;
+	shared->skewBucket = NULL;
+	shared->skewBucketNums = NULL;
+	shared->nSkewBuckets = 0;
+	shared->spaceUsedSkew = 0;
+
+	shared->curbatch = curbatch;
+	shared->phase = HJ_PHASE_BUILD;
+}
+
+/*
+ * Does any participant have an inner (or outer) file for the batch?
+ */
+static bool
+ExecHashSharedBatchExists(HashJoinTable hashtable, int batchno, bool inner)
+{
+	int			participant;
+
+	for (participant = 0;
+		 participant < hashtable->shared->nattached;
+		 participant++)
+	{
+		BufFile    *file;
+
+		file = ExecHashJoinOpenSharedBatch(hashtable, participant,
+										   batchno, inner);
+		if (file != NULL)
+		{
+			BufFileClose(file);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * ExecHashSharedRefresh
+ *		bring our copy of a parallel hash join's state up to date
+ */
+static void
+ExecHashSharedRefresh(HashJoinTable hashtable)
+{
+	volatile HashJoinSharedData *shared = hashtable->shared;
+	int			oldnbatch = hashtable->nbatch;
+	int			nbatch;
+	int			curbatch;
+	int			i;
+
+	SpinLockAcquire(&shared->mutex);
+	nbatch = shared->nbatch;
+	curbatch = shared->curbatch;
+	hashtable->phase = shared->phase;
+	hashtable->phaseno = shared->phaseno;
+	hashtable->nbatch_original = shared->nbatch_original;
+	hashtable->nbatch_outstart = shared->nbatch_outstart;
+	hashtable->growEnabled = shared->growEnabled;
+	hashtable->spaceUsed = (shared->space_next - shared->space_start) +
+		(shared->space_top - shared->space_end);
+	hashtable->spacePeak = shared->spacePeak;
+	SpinLockRelease(&shared->mutex);
+
+	/* Make room for the files of any new batches */
+	if (nbatch > oldnbatch)
+	{
+		MemoryContext oldcxt = MemoryContextSwitchTo(hashtable->hashCxt);
+
+		if (hashtable->innerBatchFile == NULL)
+		{
+			hashtable->innerBatchFile = (BufFile **)
+				palloc0(nbatch * sizeof(BufFile *));
+			hashtable->outerBatchFile = (BufFile **)
+				palloc0(nbatch * sizeof(BufFile *));
+		}
+		else
+		{
+			hashtable->innerBatchFile = (BufFile **)
+				repalloc(hashtable->innerBatchFile, nbatch * sizeof(BufFile *));
+			hashtable->outerBatchFile = (BufFile **)
+				repalloc(hashtable->outerBatchFile, nbatch * sizeof(BufFile *));
+			MemSet(hashtable->innerBatchFile + oldnbatch, 0,
+				   (nbatch - oldnbatch) * sizeof(BufFile *));
+			MemSet(hashtable->outerBatchFile + oldnbatch, 0,
+				   (nbatch - oldnbatch) * sizeof(BufFile *));
+		}
+
+		MemoryContextSwitchTo(oldcxt);
+	}
+	hashtable->nbatch = nbatch;
+
+	if (hashtable->phase == HJ_PHASE_DONE)
+		curbatch = nbatch;
+
+	/*
+	 * Everybody has finished with the earlier batches, so we can release
+	 * our files for them right away to free disk space.
+	 */
+	for (i = 1; i < curbatch; i++)
+	{
+		if (hashtable->innerBatchFile[i])
+			BufFileClose(hashtable->innerBatchFile[i]);
+		hashtable->innerBatchFile[i] = NULL;
+		if (hashtable->outerBatchFile[i])
+			BufFileClose(hashtable->outerBatchFile[i]);
+		hashtable->outerBatchFile[i] = NULL;
+	}
+
+	if (curbatch != hashtable->curbatch)
+	{
+		hashtable->chunk = NULL;
+		hashtable->skewEnabled = false;
+	}
+	hashtable->curbatch = curbatch;
+}
+
+/*
+ * Flush our batch files, so that the other participants can read them.
+ */
+static void
+ExecHashSharedFlush(HashJoinTable hashtable)
+{
+	int			i;
+
+	for (i = 1; i < hashtable->nbatch; i++)
+	{
+		if ((hashtable->innerBatchFile[i] &&
+			 BufFileFlush(hashtable->innerBatchFile[i]) != 0) ||
+			(hashtable->outerBatchFile[i] &&
+			 BufFileFlush(hashtable->outerBatchFile[i]) != 0))
+			ereport(ERROR,
+					(errcode_for_file_access(),
+				 errmsg("could not write to hash-join temporary file: %m")));
+	}
+}
+
+/*
+ * Wait for another participant to wake us up, checking for interrupts and,
+ * in the leader, for failed workers.
+ */
+static void
+ExecHashSharedSleep(HashJoinTable hashtable)
+{
+	WaitLatch(&MyProc->procLatch, -1L);
+	ResetLatch(&MyProc->procLatch);
+	CHECK_FOR_INTERRUPTS();
+	if (hashtable->pcxt != NULL)
+		CheckParallelWorkers(hashtable->pcxt);
+}
+
+/*
+ * Wake up all the participants in a parallel hash join.
+ */
+static void
+ExecHashSharedWakeAll(HashJoinShared shared)
+{
+	int			i;
+
+	for (i = 0; i < shared->maxparticipants; i++)
+	{
+		PGPROC	   *proc = ((volatile HashJoinSharedData *) shared)->procs[i];
+
+		if (proc != NULL && proc != MyProc)
+			SetLatch(&proc->procLatch);
+	}
+}
+
+/*
+ * The leader has abandoned the join, and won't read any more of a
+ * worker's output, so a worker just exits quietly, as in tqueue.c.  The
+ * leader itself never waits once it has abandoned the join.
+ */
+static void
+ExecHashSharedExit(void)
+{
+	if (IsParallelWorkerProcess())
+		proc_exit(0);
+	elog(ERROR, "parallel hash join was abandoned");
+}
@@ -19,6 +19,9 @@
 #include "executor/hashjoin.h"
 #include "executor/nodeHash.h"
 #include "executor/nodeHashjoin.h"
+#include "nodes/nodeFuncs.h"
+#include "optimizer/clauses.h"
+#include "parser/parsetree.h"
 #include "utils/memutils.h"
 
 
@@ -33,6 +36,18 @@ static TupleTableSlot *ExecHashJoinGetSavedTuple(HashJoinState *hjstate,
 						  uint32 *hashvalue,
 						  TupleTableSlot *tupleSlot);
 static int	ExecHashJoinNewBatch(HashJoinState *hjstate);
+static HashJoinTable ExecHashJoinBuildShared(HashJoinState *hjstate);
+static int	ExecHashJoinNewSharedBatch(HashJoinState *hjstate);
+static TupleTableSlot *ExecHashJoinGetSharedTuple(HashJoinState *hjstate,
+						   bool inner,
+						   uint32 *hashvalue,
+						   TupleTableSlot *tupleSlot);
+static void ExecHashJoinSharedBatchName(HashJoinTable hashtable,
+							int participant, int batchno, bool inner,
+							char *name);
+static void ExecHashJoinInitFilter(HashJoinState *hjstate, HashJoin *node);
+static Node *replace_outer_vars_mutator(Node *node, List *tlist);
+static void ExecHashJoinResetFilter(HashJoinState *hjstate);
 
 
 /* ----------------------------------------------------------------
@@ -99,6 +114,18 @@ ExecHashJoin(HashJoinState *node)
 	 */
 	ResetExprContext(econtext);
 
+	/*
+	 * In a parallel hash join, the first call joins in the work on the
+	 * shared hash table instead.  We can't try fetching an outer tuple first
+	 * as below, since that would take it away from the other participants.
+	 */
+	if (hashtable == NULL && node->hj_Shared != NULL)
+	{
+		hashtable = ExecHashJoinBuildShared(node);
+		if (hashtable->curbatch >= hashtable->nbatch)
+			return NULL;
+	}
+
 	/*
 	 * if this is the first call, build the hash table for inner relation
 	 */
@@ -144,7 +171,8 @@ ExecHashJoin(HashJoinState *node)
 		 * create the hash table
 		 */
 		hashtable = ExecHashTableCreate((Hash *) hashNode->ps.plan,
-										node->hj_HashOperators);
+										node->hj_HashOperators,
+										NULL);
 		node->hj_HashTable = hashtable;
 
 		/*
@@ -221,9 +249,9 @@ ExecHashJoin(HashJoinState *node)
 				 * in the corresponding outer-batch file.
 				 */
 				Assert(batchno > hashtable->curbatch);
-				ExecHashJoinSaveTuple(ExecFetchSlotMinimalTuple(outerTupleSlot),
-									  hashvalue,
-									  &hashtable->outerBatchFile[batchno]);
+				ExecHashJoinSaveBatchTuple(hashtable,
+									ExecFetchSlotMinimalTuple(outerTupleSlot),
+										   hashvalue, batchno, false);
 				node->hj_NeedNewOuter = true;
 				continue;		/* loop around for a new outer tuple */
 			}
@@ -451,6 +479,8 @@ ExecInitHashJoin(HashJoin *node, EState *estate, int eflags)
 	 */
 	hjstate->hj_HashTable = NULL;
 	hjstate->hj_FirstOuterTupleSlot = NULL;
+	hjstate->hj_Shared = NULL;
+	hjstate->hj_ParallelContext = NULL;
 
 	hjstate->hj_CurHashValue = 0;
 	hjstate->hj_CurBucketNo = 0;
@@ -489,9 +519,145 @@ ExecInitHashJoin(HashJoin *node, EState *estate, int eflags)
 	hjstate->hj_MatchedOuter = false;
 	hjstate->hj_OuterNotEmpty = false;
 
+	ExecHashJoinInitFilter(hjstate, node);
+
 	return hjstate;
 }
 
+/*
+ * ExecHashJoinInitFilter
+ *
+ *		Arrange for the Hash node to build a Bloom filter over the inner
+ *		tuples and for the outer scan node to test its tuples against it,
+ *		if that is possible for this join.
+ *
+ * Outer tuples that find no match are simply discarded by inner and semi
+ * joins, so for those the scan can drop them before projecting them.  We
+ * can only push the test into node types that go through ExecScan, and
+ * only if the outer hash keys can be computed from the scan tuple.
+ */
+static void
+ExecHashJoinInitFilter(HashJoinState *hjstate, HashJoin *node)
+{
+	PlanState  *outerState = outerPlanState(hjstate);
+	List	   *tlist = outerState->plan->targetlist;
+	List	   *keys = NIL;
+	ListCell   *l;
+	HashJoinFilter filter;
+
+	hjstate->hj_Filter = NULL;
+
+	if (HASHJOIN_IS_OUTER(hjstate))
+		return;
+	/* each participant in a parallel hash join sees only some inner tuples */
+	if (node->join.plan.parallel_aware)
+		return;
+	if (!IsA(outerState, SeqScanState) &&
+		!IsA(outerState, BitmapHeapScanState))
+		return;
+
+	/*
+	 * The hash clauses' outer arguments refer to the scan node's output
+	 * columns; substitute the scan's targetlist expressions so that we can
+	 * evaluate them against the scan tuple instead.
+	 */
+	foreach(l, node->hashclauses)
+	{
+		OpExpr	   *hclause = (OpExpr *) lfirst(l);
+
+		Assert(IsA(hclause, OpExpr));
+		keys = lappend(keys,
+					   replace_outer_vars_mutator((Node *) linitial(hclause->args),
+												  tlist));
+	}
+
+	/* Evaluating the keys for rejected tuples mustn't have side effects */
+	if (contain_volatile_functions((Node *) keys) ||
+		expression_returns_set((Node *) keys))
+		return;
+
+	filter = (HashJoinFilter) palloc0(sizeof(HashJoinFilterData));
+	filter->keys = (List *) ExecInitExpr((Expr *) keys, outerState);
+
+	hjstate->hj_Filter = filter;
+	((HashState *) innerPlanState(hjstate))->filter = filter;
+	((ScanState *) outerState)->ss_JoinFilter = filter;
+}
+
+static Node *
+replace_outer_vars_mutator(Node *node, List *tlist)
+{
+	if (node == NULL)
+		return NULL;
+	if (IsA(node, Var) &&
+		((Var *) node)->varno == OUTER)
+	{
+		TargetEntry *tle = get_tle_by_resno(tlist, ((Var *) node)->varattno);
+
+		if (tle == NULL)
+			elog(ERROR, "hash key does not reference outer plan targetlist");
+		return (Node *) copyObject(tle->expr);
+	}
+	return expression_tree_mutator(node, replace_outer_vars_mutator,
+								   (void *) tlist);
+}
+
+/*
+ * ExecHashJoinFilterRejects
+ *
+ *		Test the scan tuple in econtext against a hash join's Bloom filter.
+ *		Returns true if the tuple certainly has no join partner.
+ *
+ * Called by ExecScan for a tuple that has passed the scan's quals.
+ */
+bool
+ExecHashJoinFilterRejects(HashJoinFilter filter, ExprContext *econtext)
+{
+	uint32		hashvalue;
+	bool		rejected;
+
+	if (filter->bloom == NULL || filter->disabled)
+		return false;
+
+	/* A null key can't match anything when the hash operators are strict */
+	if (!ExecHashGetHashValue(filter->hashtable, econtext, filter->keys,
+							  true, false, &hashvalue))
+		rejected = true;
+	else
+		rejected = bloom_lacks_hash(filter->bloom, hashvalue);
+
+	filter->nprobes += 1;
+	if (rejected)
+	{
+		filter->nrejected += 1;
+		filter->ntotalrejected += 1;
+	}
+
+	/*
+	 * If after a while the filter hasn't paid for itself, stop consulting
+	 * it; the join is going to discard the few extra tuples anyway.
+	 */
+	if (filter->nprobes == HASHJOIN_FILTER_SAMPLE &&
+		filter->nrejected < filter->nprobes * HASHJOIN_FILTER_MIN_REJECT)
+		filter->disabled = true;
+
+	return rejected;
+}
+
+/*
+ * Forget the Bloom filter, if any.  Must be done whenever the hash table is
+ * destroyed, since the filter lives in the table's memory.
+ */
+static void
+ExecHashJoinResetFilter(HashJoinState *hjstate)
+{
+	if (hjstate->hj_Filter)
+	{
+		hjstate->hj_Filter->bloom = NULL;
+		hjstate->hj_Filter->hashtable = NULL;
+	}
+}
+
 /* ----------------------------------------------------------------
  *		ExecEndHashJoin
  *
@@ -506,6 +672,7 @@ ExecEndHashJoin(HashJoinState *node)
 	 */
 	if (node->hj_HashTable)
 	{
+		ExecHashJoinResetFilter(node);
 		ExecHashTableDestroy(node->hj_HashTable);
 		node->hj_HashTable = NULL;
 	}
@@ -602,10 +769,14 @@ ExecHashJoinOuterGetTuple(PlanState *outerNode,
 	 */
 	while (curbatch < hashtable->nbatch)
 	{
-		slot = ExecHashJoinGetSavedTuple(hjstate,
+		if (hashtable->shared)
+			slot = ExecHashJoinGetSharedTuple(hjstate, false, hashvalue,
+											  hjstate->hj_OuterTupleSlot);
+		else
+			slot = ExecHashJoinGetSavedTuple(hjstate,
 										 hashtable->outerBatchFile[curbatch],
-										 hashvalue,
-										 hjstate->hj_OuterTupleSlot);
+											 hashvalue,
+											 hjstate->hj_OuterTupleSlot);
 		if (!TupIsNull(slot))
 			return slot;
 		curbatch = ExecHashJoinNewBatch(hjstate);
@@ -632,6 +803,9 @@ ExecHashJoinNewBatch(HashJoinState *hjstate)
 	TupleTableSlot *slot;
 	uint32		hashvalue;
 
+	if (hashtable->shared)
+		return ExecHashJoinNewSharedBatch(hjstate);
+
 start_over:
 	nbatch = hashtable->nbatch;
 	curbatch = hashtable->curbatch;
@@ -757,6 +931,217 @@ start_over:
 	return curbatch;
 }
 
+/*
+ * ExecHashJoinInitializeShared
+ *		set up the shared table of a parallel hash join in the given space,
+ *		and have the leader's join node use it
+ */
+void
+ExecHashJoinInitializeShared(HashJoinState *hjstate, char *space, Size size,
+							 int maxparticipants,
+							 struct ParallelContext *pcxt)
+{
+	HashState  *hashNode = (HashState *) innerPlanState(hjstate);
+
+	ExecHashTableInitializeShared((Hash *) hashNode->ps.plan,
+								  hjstate->hj_HashOperators,
+								  HASHJOIN_IS_OUTER(hjstate),
+								  space, size, maxparticipants);
+	hjstate->hj_Shared = (HashJoinShared) space;
+	hjstate->hj_ParallelContext = pcxt;
+}
+
+/*
+ * ExecHashJoinBuildShared
+ *		join in the work on a parallel hash join's shared table, helping to
+ *		build batch 0 if that's still in progress
+ *
+ * If it's too late to join in, or the inner relation turns out to be empty
+ * and the join needn't scan the outer one, the returned table's curbatch is
+ * already past its last batch.
+ */
+static HashJoinTable
+ExecHashJoinBuildShared(HashJoinState *hjstate)
+{
+	HashState  *hashNode = (HashState *) innerPlanState(hjstate);
+	HashJoinTable hashtable;
+
+	hashtable = ExecHashTableCreate((Hash *) hashNode->ps.plan,
+									hjstate->hj_HashOperators,
+									hjstate->hj_Shared);
+	hashtable->pcxt = hjstate->hj_ParallelContext;
+	hjstate->hj_HashTable = hashtable;
+	hashNode->hashtable = hashtable;
+
+	if (!ExecHashTableAttach(hashtable))
+	{
+		hashtable->phase = HJ_PHASE_DONE;
+		hashtable->curbatch = hashtable->nbatch;
+		return hashtable;
+	}
+
+	/* if batch 0 is still being built, help with that */
+	if (hashtable->phase == HJ_PHASE_BUILD)
+	{
+		(void) MultiExecProcNode((PlanState *) hashNode);
+		ExecHashTableArrive(hashtable);
+	}
+
+	return hashtable;
+}
+
+/*
+ * ExecHashJoinNewSharedBatch
+ *		switch to a new batch of a parallel hash join
+ *
+ * This is the counterpart of ExecHashJoinNewBatch.  All the participants
+ * load each batch into the shared table together, from everybody's inner
+ * batch files, and then probe it together; the last to finish a phase
+ * chooses the next batch.  The leader takes no part after batch 0 if any
+ * workers are still at it, so that it can get back to reading their output.
+ */
+static int
+ExecHashJoinNewSharedBatch(HashJoinState *hjstate)
+{
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	TupleTableSlot *slot;
+	uint32		hashvalue;
+
+	Assert(hashtable->phase == HJ_PHASE_PROBE);
+
+	if (hashtable->curbatch == 0 && hashtable->pcxt != NULL)
+	{
+		if (ExecHashTableDetach(hashtable))
+			return hashtable->nbatch;
+	}
+	else
+		ExecHashTableArrive(hashtable);
+
+	while (hashtable->phase == HJ_PHASE_BUILD)
+	{
+		/*
+		 * NOTE: some tuples may be sent to future batches.  Also, it is
+		 * possible for nbatch to be increased here!
+		 */
+		while ((slot = ExecHashJoinGetSharedTuple(hjstate, true, &hashvalue,
+											  hjstate->hj_HashTupleSlot)))
+			ExecHashTableInsert(hashtable, slot, hashvalue);
+
+		ExecHashTableArrive(hashtable);
+	}
+
+	/* curbatch is nbatch if we're done */
+	return hashtable->curbatch;
+}
+
+/*
+ * ExecHashJoinGetSharedTuple
+ *		read the next tuple of the current batch of a parallel hash join,
+ *		from the inner or outer batch files.  Return NULL if no more.
+ *
+ * Each participant's files are read by whichever participant claims them.
+ */
+static TupleTableSlot *
+ExecHashJoinGetSharedTuple(HashJoinState *hjstate,
+						   bool inner,
+						   uint32 *hashvalue,
+						   TupleTableSlot *tupleSlot)
+{
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+
+	for (;;)
+	{
+		TupleTableSlot *slot;
+
+		if (hashtable->readFile == NULL)
+		{
+			int			participant;
+
+			participant = ExecHashTableNextSharedFile(hashtable);
+			if (participant < 0)
+			{
+				ExecClearTuple(tupleSlot);
+				return NULL;
+			}
+			hashtable->readFile =
+				ExecHashJoinOpenSharedBatch(hashtable, participant,
+											hashtable->curbatch, inner);
+			if (hashtable->readFile == NULL)
+				continue;
+		}
+
+		slot = ExecHashJoinGetSavedTuple(hjstate, hashtable->readFile,
+										 hashvalue, tupleSlot);
+		if (!TupIsNull(slot))
+			return slot;
+
+		BufFileClose(hashtable->readFile);
+		hashtable->readFile = NULL;
+	}
+}
+
+/*
+ * ExecHashJoinSaveBatchTuple
+ *		save a tuple to the inner or outer file of the given batch.
+ *
+ * In a parallel hash join, the file is named so that the other participants
+ * can open it with ExecHashJoinOpenSharedBatch.
+ */
+void
+ExecHashJoinSaveBatchTuple(HashJoinTable hashtable, MinimalTuple tuple,
+						   uint32 hashvalue, int batchno, bool inner)
+{
+	BufFile   **fileptr;
+
+	if (inner)
+		fileptr = &hashtable->innerBatchFile[batchno];
+	else
+		fileptr = &hashtable->outerBatchFile[batchno];
+
+	if (*fileptr == NULL && hashtable->shared != NULL)
+	{
+		char		name[MAXPGPATH];
+
+		ExecHashJoinSharedBatchName(hashtable, hashtable->participant,
+									batchno, inner, name);
+		*fileptr = BufFileCreateShared(hashtable->shared->tablespace, name);
+	}
+
+	ExecHashJoinSaveTuple(tuple, hashvalue, fileptr);
+}
+
+/*
+ * ExecHashJoinOpenSharedBatch
+ *		open the inner or outer file of the given batch written by one
+ *		participant in a parallel hash join, or return NULL if it has none.
+ *
+ * The participant must have flushed the file.
+ */
+BufFile *
+ExecHashJoinOpenSharedBatch(HashJoinTable hashtable, int participant,
+							int batchno, bool inner)
+{
+	char		name[MAXPGPATH];
+
+	ExecHashJoinSharedBatchName(hashtable, participant, batchno, inner, name);
+	return BufFileOpenShared(hashtable->shared->tablespace, name);
+}
+
+/*
+ * Build the name of a batch file of a parallel hash join.  name must have
+ * room for MAXPGPATH bytes.
+ */
+static void
+ExecHashJoinSharedBatchName(HashJoinTable hashtable, int participant,
+							int batchno, bool inner, char *name)
+{
+	HashJoinShared shared = hashtable->shared;
+
+	snprintf(name, MAXPGPATH, "hj%d.%d.%d.%c%d",
+			 shared->leader_pid, shared->fileset, participant,
+			 inner ? 'i' : 'o', batchno);
+}
+
 /*
  * ExecHashJoinSaveTuple
  *		save a tuple to a batch file.
@@ -854,6 +1239,7 @@ ExecReScanHashJoin(HashJoinState *node)
 	if (node->hj_HashTable != NULL)
 	{
 		if (node->hj_HashTable->nbatch == 1 &&
+			node->hj_HashTable->shared == NULL &&
 			node->js.ps.righttree->chgParam == NULL)
 		{
 			/*
@@ -873,6 +1259,7 @@ ExecReScanHashJoin(HashJoinState *node)
 		else
 		{
 			/* must destroy and rebuild hash table */
+			ExecHashJoinResetFilter(node);
 			ExecHashTableDestroy(node->hj_HashTable);
 			node->hj_HashTable = NULL;
 
@@ -885,6 +1272,10 @@ ExecReScanHashJoin(HashJoinState *node)
 		}
 	}
 
+	/* A parallel hash join's shared table is gone, or will be */
+	node->hj_Shared = NULL;
+	node->hj_ParallelContext = NULL;
+
 	/* Always reset intra-tuple state */
 	node->hj_CurHashValue = 0;
 	node->hj_CurBucketNo = 0;
@@ -27,15 +27,22 @@
 #include "access/genam.h"
 #include "access/nbtree.h"
 #include "access/relscan.h"
+#include "access/visibilitymap.h"
 #include "executor/execdebug.h"
 #include "executor/nodeIndexscan.h"
 #include "optimizer/clauses.h"
+#include "storage/bufmgr.h"
 #include "utils/array.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
+#include "utils/tqual.h"
 
 
 static TupleTableSlot *IndexNext(IndexScanState *node);
+static TupleTableSlot *IndexOnlyNext(IndexScanState *node,
+			  ScanDirection direction);
+static void StoreIndexTuple(TupleTableSlot *slot, IndexTuple itup,
+				Relation indexRel);
 
 
 /* ----------------------------------------------------------------
@@ -72,6 +79,9 @@ IndexNext(IndexScanState *node)
 	econtext = node->ss.ps.ps_ExprContext;
 	slot = node->ss.ss_ScanTupleSlot;
 
+	if (node->iss_IndexOnly)
+		return IndexOnlyNext(node, direction);
+
 	/*
 	 * ok, now that we have what we need, fetch the next tuple.
 	 */
@@ -109,6 +119,97 @@ IndexNext(IndexScanState *node)
 	return ExecClearTuple(slot);
 }
 
+/* ----------------------------------------------------------------
+ *		IndexOnlyNext
+ *
+ *		IndexNext for an index-only scan: return the column values
+ *		stored in the index entries, visiting the heap only to check
+ *		visibility on pages that aren't known to be all-visible.
+ * ----------------------------------------------------------------
+ */
+static TupleTableSlot *
+IndexOnlyNext(IndexScanState *node, ScanDirection direction)
+{
+	ExprContext *econtext = node->ss.ps.ps_ExprContext;
+	IndexScanDesc scandesc = node->iss_ScanDesc;
+	TupleTableSlot *slot = node->ss.ss_ScanTupleSlot;
+	ItemPointer tid;
+
+	while ((tid = index_getnext_tid(scandesc, direction)) != NULL)
+	{
+		/*
+		 * We can skip the heap fetch if the TID references a heap page on
+		 * which all tuples are known visible to everybody.  Otherwise we
+		 * have to check the heap for a visible tuple; since we only use
+		 * index-only scans with MVCC snapshots, there can be at most one.
+		 * Either way, the index tuple is the source of the data.
+		 */
+		if (!visibilitymap_test(scandesc->heapRelation,
+								ItemPointerGetBlockNumber(tid),
+								&node->iss_VMBuffer))
+		{
+			if (index_fetch_heap(scandesc) == NULL)
+				continue;		/* no visible tuple, try next index entry */
+		}
+
+		StoreIndexTuple(slot, scandesc->xs_itup, node->iss_RelationDesc);
+
+		/*
+		 * If the index was lossy, we have to recheck the index quals.  The
+		 * index columns are all we have, but they are all the quals need.
+		 */
+		if (scandesc->xs_recheck)
+		{
+			econtext->ecxt_scantuple = slot;
+			ResetExprContext(econtext);
+			if (!ExecQual(node->indexqualorig, econtext, false))
+				continue;		/* nope, so ask index for another one */
+		}
+
+		return slot;
+	}
+
+	/*
+	 * if we get here it means the index scan failed so we are at the end of
+	 * the scan..
+	 */
+	return ExecClearTuple(slot);
+}
+
+/*
+ * StoreIndexTuple
+ *		Fill the scan slot with the column values of an index tuple.
+ *
+ * The slot has the heap relation's rowtype; columns that aren't in the
+ * index are set to null, since the planner made sure nobody needs them.
+ * Expression columns of the index have no place in that rowtype, and the
+ * planner doesn't try to use their values, so they are skipped.
+ */
+static void
+StoreIndexTuple(TupleTableSlot *slot, IndexTuple itup, Relation indexRel)
+{
+	TupleDesc	itupdesc = RelationGetDescr(indexRel);
+	int2vector *indkey = &indexRel->rd_index->indkey;
+	int			natts = slot->tts_tupleDescriptor->natts;
+	int			i;
+
+	ExecClearTuple(slot);
+	memset(slot->tts_isnull, true, natts * sizeof(bool));
+
+	for (i = 0; i < itupdesc->natts; i++)
+	{
+		int			attno = indkey->values[i];
+
+		if (attno == 0)
+			continue;			/* expression column */
+		Assert(attno > 0 && attno <= natts);
+		slot->tts_values[attno - 1] =
+			index_getattr(itup, i + 1, itupdesc, &slot->tts_isnull[attno - 1]);
+	}
+
+	ExecStoreVirtualTuple(slot);
+}
+
 /*
  * IndexRecheck -- access method routine to recheck a tuple in EvalPlanQual
  */
@@ -408,6 +509,13 @@ ExecEndIndexScan(IndexScanState *node)
 	ExecClearTuple(node->ss.ps.ps_ResultTupleSlot);
 	ExecClearTuple(node->ss.ss_ScanTupleSlot);
 
+	/* Release VM buffer pin, if any */
+	if (BufferIsValid(node->iss_VMBuffer))
+	{
+		ReleaseBuffer(node->iss_VMBuffer);
+		node->iss_VMBuffer = InvalidBuffer;
+	}
+
 	/*
 	 * close the index relation (no-op if we didn't open it)
 	 */
@@ -466,6 +574,8 @@ ExecInitIndexScan(IndexScan *node, EState *estate, int eflags)
 	indexstate = makeNode(IndexScanState);
 	indexstate->ss.ps.plan = (Plan *) node;
 	indexstate->ss.ps.state = estate;
+	indexstate->iss_IndexOnly = false;
+	indexstate->iss_VMBuffer = InvalidBuffer;
 
 	/*
 	 * Miscellaneous initialization
@@ -586,6 +696,26 @@ ExecInitIndexScan(IndexScan *node, EState *estate, int eflags)
 											   indexstate->iss_NumScanKeys,
 											   indexstate->iss_ScanKeys);
 
+	/*
+	 * If the planner chose an index-only scan, ask the AM for the index
+	 * tuples.  The visibility map tells us only whether a page's tuples are
+	 * visible to every transaction, so this works only for MVCC snapshots;
+	 * otherwise fall back to fetching every heap tuple.
+	 */
+	if (node->indexonly && IsMVCCSnapshot(estate->es_snapshot))
+	{
+		indexstate->iss_IndexOnly = true;
+		indexstate->iss_ScanDesc->xs_want_itup = true;
+	}
+
+	/*
+	 * Let the AM prefetch the heap pages of upcoming index entries, as
+	 * effective_io_concurrency permits.  An index-only scan expects to skip
+	 * most heap pages, so prefetching them all would mostly be wasted I/O.
+	 */
+	if (!indexstate->iss_IndexOnly)
+		indexstate->iss_ScanDesc->xs_prefetch_pages = target_prefetch_pages;
+
 	/*
 	 * all done.
 	 */
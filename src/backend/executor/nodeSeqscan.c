@@ -21,6 +21,7 @@
  *		ExecReScanSeqScan		rescans the relation
  *		ExecSeqMarkPos			marks scan position
  *		ExecSeqRestrPos			restores scan position
+ *		ExecSeqScanInitializeParallel	attaches to a parallel scan
  */
 #include "postgres.h"
 
@@ -135,10 +136,17 @@ InitScanRelation(SeqScanState *node, EState *estate)
 	currentRelation = ExecOpenScanRelation(estate,
 									 ((SeqScan *) node->ps.plan)->scanrelid);
 
-	currentScanDesc = heap_beginscan(currentRelation,
-									 estate->es_snapshot,
-									 0,
-									 NULL);
+	/*
+	 * A parallel-aware scan doesn't know yet what to scan; the scan is begun
+	 * when the parent Gather node calls ExecSeqScanInitializeParallel.
+	 */
+	if (node->ps.plan->parallel_aware)
+		currentScanDesc = NULL;
+	else
+		currentScanDesc = heap_beginscan(currentRelation,
+										 estate->es_snapshot,
+										 0,
+										 NULL);
 
 	node->ss_currentRelation = currentRelation;
 	node->ss_currentScanDesc = currentScanDesc;
@@ -206,6 +214,11 @@ ExecInitSeqScan(SeqScan *node, EState *estate, int eflags)
 	ExecAssignResultTypeFromTL(&scanstate->ps);
 	ExecAssignScanProjectionInfo(scanstate);
 
+	/*
+	 * Evaluate simple quals over batches of tuples, if possible.
+	 */
+	ExecInitScanBatch(scanstate, eflags);
+
 	return scanstate;
 }
 
@@ -239,9 +252,10 @@ ExecEndSeqScan(SeqScanState *node)
 	ExecClearTuple(node->ss_ScanTupleSlot);
 
 	/*
-	 * close heap scan
+	 * close heap scan, if it was ever started
 	 */
-	heap_endscan(scanDesc);
+	if (scanDesc != NULL)
+		heap_endscan(scanDesc);
 
 	/*
 	 * close the heap relation.
@@ -267,12 +281,46 @@ ExecReScanSeqScan(SeqScanState *node)
 
 	scan = node->ss_currentScanDesc;
 
-	heap_rescan(scan,			/* scan desc */
-				NULL);			/* new scan keys */
+	/*
+	 * A parallel-aware scan can't just be restarted, since the shared scan
+	 * state has been used up; our parent will supply fresh state.
+	 */
+	if (node->ps.plan->parallel_aware)
+	{
+		if (scan != NULL)
+			heap_endscan(scan);
+		node->ss_currentScanDesc = NULL;
+	}
+	else
+		heap_rescan(scan,		/* scan desc */
+					NULL);		/* new scan keys */
 
 	ExecScanReScan((ScanState *) node);
 }
 
+/* ----------------------------------------------------------------
+ *		ExecSeqScanInitializeParallel
+ *
+ *		Begins a parallel-aware scan, using the given shared scan state.
+ *		The owner of the shared state is responsible for resetting it
+ *		before any rescan.
+ * ----------------------------------------------------------------
+ */
+void
+ExecSeqScanInitializeParallel(SeqScanState *node,
+							  ParallelHeapScanDesc parallel_scan)
+{
+	EState	   *estate = node->ps.state;
+
+	Assert(node->ps.plan->parallel_aware);
+	Assert(node->ss_currentScanDesc == NULL);
+
+	node->ss_currentScanDesc =
+		heap_beginscan_parallel(node->ss_currentRelation,
+								estate->es_snapshot,
+								parallel_scan);
+}
+
 /* ----------------------------------------------------------------
  *		ExecSeqMarkPos(node)
  *
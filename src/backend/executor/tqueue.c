@@ -0,0 +1,155 @@
+/*-------------------------------------------------------------------------
+ *
+ * tqueue.c
+ *	  Use shm_mq to send & receive tuples between parallel backends
+ *
+ * A DestReceiver of type DestTupleQueue, which is a TQueueDestReceiver
+ * under the hood, writes tuples from the executor to a shm_mq.  Each
+ * message is just the tuple's HeapTupleHeader; TupleQueueReceiveTuple
+ * turns it back into a HeapTuple on the other end.
+ *
+ * Tuples may contain toast pointers.  The receiver is expected to be
+ * running in the same database and with the same snapshot as the sender,
+ * so it can fetch the toasted values itself.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include "access/htup.h"
+#include "executor/tqueue.h"
+#include "storage/ipc.h"
+
+
+typedef struct
+{
+	DestReceiver pub;
+	shm_mq	   *queue;			/* where to send the tuples */
+} TQueueDestReceiver;
+
+
+/*
+ * Send a tuple to the queue.
+ *
+ * If the receiver has detached, it doesn't want any more tuples; that only
+ * happens when the receiving backend is shutting down the scan early, so we
+ * just exit quietly.
+ */
+static void
+tqueueReceiveSlot(TupleTableSlot *slot, DestReceiver *self)
+{
+	TQueueDestReceiver *tqueue = (TQueueDestReceiver *) self;
+	HeapTuple	tuple;
+	shm_mq_result result;
+
+	tuple = ExecFetchSlotTuple(slot);
+	result = shm_mq_send(tqueue->queue, tuple->t_len, tuple->t_data);
+	if (result == SHM_MQ_DETACHED)
+		proc_exit(0);
+}
+
+/*
+ * Prepare to receive tuples from executor.
+ */
+static void
+tqueueStartupReceiver(DestReceiver *self, int operation, TupleDesc typeinfo)
+{
+	/* do nothing */
+}
+
+/*
+ * Clean up at end of an executor run
+ */
+static void
+tqueueShutdownReceiver(DestReceiver *self)
+{
+	/* do nothing */
+}
+
+/*
+ * Destroy receiver when done with it
+ */
+static void
+tqueueDestroyReceiver(DestReceiver *self)
+{
+	pfree(self);
+}
+
+/*
+ * Initially create a DestReceiver object.
+ */
+DestReceiver *
+CreateTupleQueueDestReceiver(void)
+{
+	TQueueDestReceiver *self;
+
+	self = (TQueueDestReceiver *) palloc0(sizeof(TQueueDestReceiver));
+
+	self->pub.receiveSlot = tqueueReceiveSlot;
+	self->pub.rStartup = tqueueStartupReceiver;
+	self->pub.rShutdown = tqueueShutdownReceiver;
+	self->pub.rDestroy = tqueueDestroyReceiver;
+	self->pub.mydest = DestTupleQueue;
+
+	/* private fields will be set by SetTupleQueueDestReceiverParams */
+
+	return (DestReceiver *) self;
+}
+
+/*
+ * Set parameters for a TupleQueueDestReceiver
+ */
+void
+SetTupleQueueDestReceiverParams(DestReceiver *self, shm_mq *queue)
+{
+	TQueueDestReceiver *myState = (TQueueDestReceiver *) self;
+
+	Assert(myState->pub.mydest == DestTupleQueue);
+	myState->queue = queue;
+}
+
+/*
+ * Fetch a tuple from a tuple queue.
+ *
+ * The tuple is palloc'd in the current memory context.  Returns NULL if no
+ * tuple is available; in that case, *done is set to true if the sender has
+ * detached and there will never be any more.  (If nowait is false, we only
+ * return NULL in the latter case.)
+ */
+HeapTuple
+TupleQueueReceiveTuple(shm_mq_handle *mqh, bool nowait, bool *done)
+{
+	shm_mq_result result;
+	Size		nbytes;
+	void	   *data;
+	HeapTuple	tuple;
+
+	*done = false;
+
+	result = shm_mq_receive(mqh, &nbytes, &data, nowait);
+	if (result == SHM_MQ_DETACHED)
+	{
+		*done = true;
+		return NULL;
+	}
+	if (result == SHM_MQ_WOULD_BLOCK)
+		return NULL;
+
+	Assert(result == SHM_MQ_SUCCESS);
+
+	tuple = (HeapTuple) palloc(HEAPTUPLESIZE + nbytes);
+	tuple->t_len = nbytes;
+	ItemPointerSetInvalid(&tuple->t_self);
+	tuple->t_tableOid = InvalidOid;
+	tuple->t_data = (HeapTupleHeader) ((char *) tuple + HEAPTUPLESIZE);
+	memcpy(tuple->t_data, data, nbytes);
+
+	return tuple;
+}
@@ -0,0 +1,133 @@
+/*-------------------------------------------------------------------------
+ *
+ * bloomfilter.c
+ *	  A simple Bloom filter over 32-bit hash values.
+ *
+ * A Bloom filter answers the question "might this set contain x?" with no
+ * false negatives and a tunable rate of false positives, using only a few
+ * bits per element.  Callers add and test elements by a hash value they
+ * have already computed, such as the hash value of a hash join key; the
+ * probe positions are derived from it by double hashing, with the second
+ * hash obtained by re-hashing the value.
+ *
+ * The bitset size is a power of two, so that probe positions are found by
+ * masking.  We aim at about 8 bits per element, which gives a false
+ * positive rate of a few percent, but never use more than the caller's
+ * memory budget; with too little memory the filter just becomes less
+ * selective.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <math.h>
+
+#include "access/hash.h"
+#include "lib/bloomfilter.h"
+
+
+#define BLOOM_BITS_PER_ELEMENT	8
+#define BLOOM_MIN_BITS			64
+#define BLOOM_MAX_HASH_FUNCS	8
+
+typedef struct BloomFilterData
+{
+	int			nhashes;		/* number of probes per element */
+	uint32		mask;			/* number of bits in bitset, minus one */
+	unsigned char bitset[1];	/* VARIABLE LENGTH ARRAY */
+} BloomFilterData;				/* VARIABLE LENGTH STRUCT */
+
+
+/*
+ * Create an empty Bloom filter for about total_elems elements, using at
+ * most max_bytes for the bitset (but at least BLOOM_MIN_BITS bits).
+ *
+ * The filter is allocated in the current memory context.
+ */
+BloomFilter
+bloom_create(double total_elems, long max_bytes)
+{
+	BloomFilter filter;
+	double		target_bits;
+	double		max_bits;
+	uint32		nbits;
+	int			nhashes;
+
+	total_elems = Max(total_elems, 1.0);
+	target_bits = total_elems * BLOOM_BITS_PER_ELEMENT;
+	max_bits = (double) max_bytes * BITS_PER_BYTE;
+	/* keep the mask within a uint32 */
+	max_bits = Min(max_bits, (double) ((uint32) 1 << 31));
+
+	nbits = BLOOM_MIN_BITS;
+	while (nbits < target_bits && nbits * 2.0 <= max_bits)
+		nbits *= 2;
+
+	/* The optimal number of probes is ln(2) times bits per element */
+	nhashes = (int) rint(log(2.0) * nbits / total_elems);
+	nhashes = Max(nhashes, 1);
+	nhashes = Min(nhashes, BLOOM_MAX_HASH_FUNCS);
+
+	filter = (BloomFilter) palloc0(offsetof(BloomFilterData, bitset) +
+								   nbits / BITS_PER_BYTE);
+	filter->nhashes = nhashes;
+	filter->mask = nbits - 1;
+
+	return filter;
+}
+
+/*
+ * Release a Bloom filter.
+ */
+void
+bloom_free(BloomFilter filter)
+{
+	pfree(filter);
+}
+
+/*
+ * Add an element, given by its hash value.
+ */
+void
+bloom_add_hash(BloomFilter filter, uint32 hashvalue)
+{
+	uint32		h2 = DatumGetUInt32(hash_uint32(hashvalue)) | 1;
+	uint32		pos = hashvalue;
+	int			i;
+
+	for (i = 0; i < filter->nhashes; i++)
+	{
+		uint32		bit = pos & filter->mask;
+
+		filter->bitset[bit / BITS_PER_BYTE] |= 1 << (bit % BITS_PER_BYTE);
+		pos += h2;
+	}
+}
+
+/*
+ * Test whether an element, given by its hash value, is certainly not in the
+ * set.  A false result means only that it may be.
+ */
+bool
+bloom_lacks_hash(BloomFilter filter, uint32 hashvalue)
+{
+	uint32		h2 = DatumGetUInt32(hash_uint32(hashvalue)) | 1;
+	uint32		pos = hashvalue;
+	int			i;
+
+	for (i = 0; i < filter->nhashes; i++)
+	{
+		uint32		bit = pos & filter->mask;
+
+		if (!(filter->bitset[bit / BITS_PER_BYTE] & (1 << (bit % BITS_PER_BYTE))))
+			return true;
+		pos += h2;
+	}
+	return false;
+}
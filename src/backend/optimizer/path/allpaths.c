@@ -17,6 +17,7 @@
 
 #include <math.h>
 
+#include "catalog/namespace.h"
 #include "nodes/nodeFuncs.h"
 #ifdef OPTIMIZER_DEBUG
 #include "nodes/print.h"
@@ -34,6 +35,7 @@
 #include "parser/parse_clause.h"
 #include "parser/parsetree.h"
 #include "rewrite/rewriteManip.h"
+#include "utils/lsyscache.h"
 
 
 /* These parameters are set by GUC */
@@ -49,6 +51,8 @@ static void set_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 				 Index rti, RangeTblEntry *rte);
 static void set_plain_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 					   RangeTblEntry *rte);
+static bool rel_is_parallel_safe(PlannerInfo *root, RelOptInfo *rel,
+					 RangeTblEntry *rte);
 static void set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 						Index rti, RangeTblEntry *rte);
 static void set_dummy_rel_pathlist(RelOptInfo *rel);
@@ -257,6 +261,16 @@ set_plain_rel_pathlist(PlannerInfo *root, RelOptInfo *rel, RangeTblEntry *rte)
 	/* Consider sequential scan */
 	add_path(rel, create_seqscan_path(root, rel));
 
+	/*
+	 * Consider sequential scan in parallel.  Remember whether we could, so
+	 * that joins of the rel can be considered for parallelism too.
+	 */
+	rel->consider_parallel = rel_is_parallel_safe(root, rel, rte);
+	if (rel->consider_parallel)
+		add_path(rel, (Path *)
+				 create_gather_path(rel, create_seqscan_path(root, rel),
+									max_parallel_degree));
+
 	/* Consider index scans */
 	create_index_paths(root, rel);
 
@@ -267,6 +281,41 @@ set_plain_rel_pathlist(PlannerInfo *root, RelOptInfo *rel, RangeTblEntry *rte)
 	set_cheapest(rel);
 }
 
+/*
+ * rel_is_parallel_safe
+ *	  Check whether a plain relation can be scanned by parallel workers.
+ *
+ * Workers can't see a temporary relation's local buffers, nor evaluate
+ * anything that depends on the leader's private state; see
+ * has_parallel_hazard.  We also stay away from queries that lock rows.
+ * Whether workers can actually be used is decided again at execution time.
+ */
+static bool
+rel_is_parallel_safe(PlannerInfo *root, RelOptInfo *rel, RangeTblEntry *rte)
+{
+	ListCell   *lc;
+
+	if (max_parallel_degree <= 0)
+		return false;
+
+	if (root->parse->commandType != CMD_SELECT ||
+		root->parse->rowMarks != NIL)
+		return false;
+
+	if (isAnyTempNamespace(get_rel_namespace(rte->relid)))
+		return false;
+
+	foreach(lc, rel->baserestrictinfo)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(lc);
+
+		if (has_parallel_hazard((Node *) rinfo->clause))
+			return false;
+	}
+
+	return !has_parallel_hazard((Node *) rel->reltargetlist);
+}
+
 /*
  * set_append_rel_pathlist
  *	  Build access paths for an "append relation"
@@ -1396,6 +1445,10 @@ print_path(PlannerInfo *root, Path *path, int indent)
 			ptype = "Unique";
 			subpath = ((UniquePath *) path)->subpath;
 			break;
+		case T_GatherPath:
+			ptype = "Gather";
+			subpath = ((GatherPath *) path)->subpath;
+			break;
 		case T_NestPath:
 			ptype = "NestLoop";
 			join = true;
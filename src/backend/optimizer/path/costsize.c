@@ -102,13 +102,18 @@ double		random_page_cost = DEFAULT_RANDOM_PAGE_COST;
 double		cpu_tuple_cost = DEFAULT_CPU_TUPLE_COST;
 double		cpu_index_tuple_cost = DEFAULT_CPU_INDEX_TUPLE_COST;
 double		cpu_operator_cost = DEFAULT_CPU_OPERATOR_COST;
+double		parallel_tuple_cost = DEFAULT_PARALLEL_TUPLE_COST;
+double		parallel_setup_cost = DEFAULT_PARALLEL_SETUP_COST;
 
 int			effective_cache_size = DEFAULT_EFFECTIVE_CACHE_SIZE;
 
 Cost		disable_cost = 1.0e10;
 
+int			max_parallel_degree = 0;
+
 bool		enable_seqscan = true;
 bool		enable_indexscan = true;
+bool		enable_indexonlyscan = true;
 bool		enable_bitmapscan = true;
 bool		enable_tidscan = true;
 bool		enable_sort = true;
@@ -883,6 +888,36 @@ cost_tidscan(Path *path, PlannerInfo *root,
 	path->total_cost = startup_cost + run_cost;
 }
 
+/*
+ * cost_gather
+ *	  Determines and returns the cost of running a path in parallel.
+ *
+ * The run cost of the subpath is divided among the workers and the leader,
+ * which also takes part in the scan.  The participants in a hash join build
+ * its hash table together, so its startup cost is divided too.  To that we
+ * add the cost of starting the workers, and of passing each tuple from a
+ * worker to the leader.
+ * Tuples produced by the leader itself don't pay the transfer cost, but we
+ * don't try to account for that.
+ */
+void
+cost_gather(GatherPath *path, Path *subpath, int num_workers)
+{
+	Cost		startup_cost = subpath->startup_cost;
+	Cost		run_cost;
+
+	run_cost = (subpath->total_cost - subpath->startup_cost) /
+		(num_workers + 1);
+	if (IsA(subpath, HashPath))
+		startup_cost /= (num_workers + 1);
+
+	startup_cost += parallel_setup_cost;
+	run_cost += parallel_tuple_cost * subpath->parent->rows;
+
+	path->path.startup_cost = startup_cost;
+	path->path.total_cost = startup_cost + run_cost;
+}
+
 /*
  * cost_subqueryscan
  *	  Determines and returns the cost of scanning a subquery RTE.
@@ -1262,13 +1297,16 @@ cost_material(Path *path,
  *
  * Note: when aggstrategy == AGG_SORTED, caller must ensure that input costs
  * are for appropriately-sorted input.
+ *
+ * hashentrysize is the estimated space per group of an AGG_HASHED hash
+ * table; it is ignored for the other strategies.
  */
 void
 cost_agg(Path *path, PlannerInfo *root,
 		 AggStrategy aggstrategy, int numAggs,
 		 int numGroupCols, double numGroups,
 		 Cost input_startup_cost, Cost input_total_cost,
-		 double input_tuples)
+		 double input_tuples, double hashentrysize)
 {
 	Cost		startup_cost;
 	Cost		total_cost;
@@ -1286,7 +1324,7 @@ cost_agg(Path *path, PlannerInfo *root,
 	 * Note: in this cost model, AGG_SORTED and AGG_HASHED have exactly the
 	 * same total CPU cost, but AGG_SORTED has lower startup cost.	If the
 	 * input path is already sorted appropriately, AGG_SORTED should be
-	 * preferred (since it has no risk of memory overflow).  This will happen
+	 * preferred (since it needs no hash table memory).  This will happen
 	 * as long as the computed total costs are indeed exactly equal --- but if
 	 * there's roundoff error we might do the wrong thing.  So be sure that
 	 * the computations below form the same intermediate values in the same
@@ -1320,6 +1358,25 @@ cost_agg(Path *path, PlannerInfo *root,
 		startup_cost = input_total_cost;
 		startup_cost += cpu_operator_cost * input_tuples * numGroupCols;
 		startup_cost += cpu_operator_cost * input_tuples * numAggs;
+
+		/*
+		 * If the hash table won't fit in work_mem, the input tuples of the
+		 * groups that don't fit are written out to batch files and read back
+		 * later.  Charge for writing and reading them once, at the same mix
+		 * of sequential and random access as an external sort.  We use the
+		 * hash entry size as a proxy for the width of the spilled tuples.
+		 */
+		if (hashentrysize * numGroups > work_mem * 1024L)
+		{
+			double		spill_fraction;
+			double		npages;
+
+			spill_fraction = 1.0 - work_mem * 1024L / (hashentrysize * numGroups);
+			npages = ceil(input_tuples * spill_fraction * hashentrysize / BLCKSZ);
+			startup_cost += 2.0 * npages *
+				(seq_page_cost * 0.75 + random_page_cost * 0.25);
+		}
+
 		total_cost = startup_cost;
 		total_cost += cpu_operator_cost * numGroups * numAggs;
 		total_cost += cpu_tuple_cost * numGroups;
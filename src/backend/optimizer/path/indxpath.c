@@ -2023,6 +2023,76 @@ flatten_clausegroups_list(List *clausegroups)
 	return allclauses;
 }
 
+/*
+ * check_index_only
+ *	  Determine whether an index scan on this index could be done
+ *	  index-only, that is, whether every column of the relation that the
+ *	  query needs can be taken from the index entries.
+ *
+ * Only simple index columns count; we don't try to match the values of
+ * expression columns to expressions in the query.  System columns and
+ * whole-row references can never be provided by the index.
+ */
+bool
+check_index_only(RelOptInfo *rel, IndexOptInfo *index)
+{
+	bool		result;
+	List	   *vars;
+	Bitmapset  *index_attrs = NULL;
+	ListCell   *lc;
+	int			i;
+
+	/* Index-only scans must be enabled, and the AM must support them */
+	if (!enable_indexonlyscan || !index->canreturn)
+		return false;
+
+	/*
+	 * Collect the Vars needed from the relation: those in its targetlist
+	 * (which covers both the query output and any join clauses) and those
+	 * in its restriction clauses.
+	 */
+	vars = pull_var_clause((Node *) rel->reltargetlist,
+						   PVC_RECURSE_PLACEHOLDERS);
+	foreach(lc, rel->baserestrictinfo)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(lc);
+
+		vars = list_concat(vars,
+						   pull_var_clause((Node *) rinfo->clause,
+										   PVC_RECURSE_PLACEHOLDERS));
+	}
+
+	/* Construct a bitmapset of columns stored in the index */
+	for (i = 0; i < index->ncolumns; i++)
+	{
+		int			attno = index->indexkeys[i];
+
+		if (attno > 0)
+			index_attrs = bms_add_member(index_attrs, attno);
+	}
+
+	result = true;
+	foreach(lc, vars)
+	{
+		Var		   *var = (Var *) lfirst(lc);
+
+		Assert(IsA(var, Var));
+		if (var->varno != rel->relid || var->varlevelsup != 0)
+			continue;
+		if (var->varattno <= 0 ||
+			!bms_is_member(var->varattno, index_attrs))
+		{
+			result = false;
+			break;
+		}
+	}
+
+	list_free(vars);
+	bms_free(index_attrs);
+
+	return result;
+}
+
 
 /****************************************************************************
  *				----  ROUTINES TO CHECK OPERANDS  ----
@@ -17,6 +17,7 @@
 #include <math.h>
 
 #include "executor/executor.h"
+#include "optimizer/clauses.h"
 #include "optimizer/cost.h"
 #include "optimizer/pathnode.h"
 #include "optimizer/paths.h"
@@ -34,6 +35,8 @@ static void hash_inner_and_outer(PlannerInfo *root, RelOptInfo *joinrel,
 					 RelOptInfo *outerrel, RelOptInfo *innerrel,
 					 List *restrictlist,
 					 JoinType jointype, SpecialJoinInfo *sjinfo);
+static bool join_is_parallel_safe(RelOptInfo *joinrel, RelOptInfo *outerrel,
+					  RelOptInfo *innerrel, List *restrictlist);
 static Path *best_appendrel_indexscan(PlannerInfo *root, RelOptInfo *rel,
 						 RelOptInfo *outer_rel, JoinType jointype);
 static List *select_mergejoin_clauses(PlannerInfo *root,
@@ -782,12 +785,17 @@ hash_inner_and_outer(PlannerInfo *root,
 					 SpecialJoinInfo *sjinfo)
 {
 	bool		isouterjoin;
+	bool		parallel_ok;
 	List	   *hashclauses;
 	ListCell   *l;
 
 	/*
-	 * Hashjoin only supports inner, left, semi, and anti joins.
+	 * Hashjoin only supports inner, left, semi, and anti joins.  We don't
+	 * try the unique-ified joins in parallel, as every participant would
+	 * have to see all of the unique-ified rel.
 	 */
+	parallel_ok = (jointype != JOIN_UNIQUE_OUTER &&
+				   jointype != JOIN_UNIQUE_INNER);
 	switch (jointype)
 	{
 		case JOIN_INNER:
@@ -886,7 +894,58 @@ hash_inner_and_outer(PlannerInfo *root,
 										  cheapest_total_inner,
 										  restrictlist,
 										  hashclauses));
+
+		/*
+		 * Consider a parallel hash join of sequential scans of the two rels,
+		 * whose participants build a shared hash table together.
+		 */
+		if (parallel_ok &&
+			join_is_parallel_safe(joinrel, outerrel, innerrel, restrictlist))
+		{
+			Path	   *hashpath;
+
+			hashpath = (Path *)
+				create_hashjoin_path(root,
+									 joinrel,
+									 jointype,
+									 sjinfo,
+									 create_seqscan_path(root, outerrel),
+									 create_seqscan_path(root, innerrel),
+									 restrictlist,
+									 hashclauses);
+			add_path(joinrel, (Path *)
+					 create_gather_path(joinrel, hashpath,
+										max_parallel_degree));
+		}
+	}
+}
+
+/*
+ * join_is_parallel_safe
+ *	  Check whether parallel workers can join two relations.
+ *
+ * Both must be base relations that workers can scan (see
+ * rel_is_parallel_safe), and the join's clauses and output columns must be
+ * safe to evaluate in a worker.
+ */
+static bool
+join_is_parallel_safe(RelOptInfo *joinrel, RelOptInfo *outerrel,
+					  RelOptInfo *innerrel, List *restrictlist)
+{
+	ListCell   *lc;
+
+	if (!outerrel->consider_parallel || !innerrel->consider_parallel)
+		return false;
+
+	foreach(lc, restrictlist)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(lc);
+
+		if (has_parallel_hazard((Node *) rinfo->clause))
+			return false;
 	}
+
+	return !has_parallel_hazard((Node *) joinrel->reltargetlist);
 }
 
 /*
@@ -20,6 +20,7 @@
 #include <math.h>
 
 #include "access/skey.h"
+#include "executor/nodeAgg.h"
 #include "nodes/makefuncs.h"
 #include "nodes/nodeFuncs.h"
 #include "optimizer/clauses.h"
@@ -47,6 +48,7 @@ static Plan *create_append_plan(PlannerInfo *root, AppendPath *best_path);
 static Result *create_result_plan(PlannerInfo *root, ResultPath *best_path);
 static Material *create_material_plan(PlannerInfo *root, MaterialPath *best_path);
 static Plan *create_unique_plan(PlannerInfo *root, UniquePath *best_path);
+static Plan *create_gather_plan(PlannerInfo *root, GatherPath *best_path);
 static SeqScan *create_seqscan_plan(PlannerInfo *root, Path *best_path,
 					List *tlist, List *scan_clauses);
 static IndexScan *create_indexscan_plan(PlannerInfo *root, IndexPath *best_path,
@@ -85,7 +87,7 @@ static void copy_plan_costsize(Plan *dest, Plan *src);
 static SeqScan *make_seqscan(List *qptlist, List *qpqual, Index scanrelid);
 static IndexScan *make_indexscan(List *qptlist, List *qpqual, Index scanrelid,
 			   Oid indexid, List *indexqual, List *indexqualorig,
-			   ScanDirection indexscandir);
+			   ScanDirection indexscandir, bool indexonly);
 static BitmapIndexScan *make_bitmap_indexscan(Index scanrelid, Oid indexid,
 					  List *indexqual,
 					  List *indexqualorig);
@@ -134,6 +136,7 @@ static Sort *make_sort(PlannerInfo *root, Plan *lefttree, int numCols,
 		  AttrNumber *sortColIdx, Oid *sortOperators, bool *nullsFirst,
 		  double limit_tuples);
 static Material *make_material(Plan *lefttree);
+static Gather *make_gather(List *qptlist, int num_workers, Plan *lefttree);
 
 
 /*
@@ -214,6 +217,10 @@ create_plan_recurse(PlannerInfo *root, Path *best_path)
 			plan = create_unique_plan(root,
 									  (UniquePath *) best_path);
 			break;
+		case T_Gather:
+			plan = create_gather_plan(root,
+									  (GatherPath *) best_path);
+			break;
 		default:
 			elog(ERROR, "unrecognized node type: %d",
 				 (int) best_path->pathtype);
@@ -667,6 +674,52 @@ create_material_plan(PlannerInfo *root, MaterialPath *best_path)
 	return plan;
 }
 
+/*
+ * create_gather_plan
+ *	  Create a Gather plan for 'best_path' and (recursively) a
+ *	  parallel-aware plan for its subpath.
+ *
+ *	  Returns a Plan node.
+ */
+static Plan *
+create_gather_plan(PlannerInfo *root, GatherPath *best_path)
+{
+	Gather	   *plan;
+	Plan	   *subplan;
+
+	subplan = create_plan_recurse(root, best_path->subpath);
+
+	/*
+	 * The executor only knows how to run a bare SeqScan, or a HashJoin of
+	 * two of them, in parallel.  If a gating Result was stuck on top of
+	 * anything, just run the plan in the leader.
+	 */
+	if (IsA(subplan, SeqScan))
+	{
+		/* Workers have to send every column, so don't ask for excess ones */
+		disuse_physical_tlist(subplan, best_path->subpath);
+	}
+	else if (IsA(subplan, HashJoin) &&
+			 IsA(outerPlan(subplan), SeqScan) &&
+			 IsA(innerPlan(subplan), Hash) &&
+			 IsA(outerPlan(innerPlan(subplan)), SeqScan))
+	{
+		outerPlan(subplan)->parallel_aware = true;
+		innerPlan(subplan)->parallel_aware = true;
+		outerPlan(innerPlan(subplan))->parallel_aware = true;
+	}
+	else
+		return subplan;
+
+	subplan->parallel_aware = true;
+
+	plan = make_gather(subplan->targetlist, best_path->num_workers, subplan);
+
+	copy_path_costsize(&plan->plan, (Path *) best_path);
+
+	return (Plan *) plan;
+}
+
 /*
  * create_unique_plan
  *	  Create a Unique plan for 'best_path' and (recursively) plans
@@ -1037,7 +1090,8 @@ create_indexscan_plan(PlannerInfo *root,
 							   indexoid,
 							   fixed_indexquals,
 							   stripped_indexquals,
-							   best_path->indexscandir);
+							   best_path->indexscandir,
+							   best_path->indexonly);
 
 	copy_path_costsize(&scan_plan->scan.plan, &best_path->path);
 	/* use the indexscan-specific rows estimate, not the parent rel's */
@@ -2582,7 +2636,8 @@ make_indexscan(List *qptlist,
 			   Oid indexid,
 			   List *indexqual,
 			   List *indexqualorig,
-			   ScanDirection indexscandir)
+			   ScanDirection indexscandir,
+			   bool indexonly)
 {
 	IndexScan  *node = makeNode(IndexScan);
 	Plan	   *plan = &node->scan.plan;
@@ -2597,6 +2652,7 @@ make_indexscan(List *qptlist,
 	node->indexqual = indexqual;
 	node->indexqualorig = indexqualorig;
 	node->indexorderdir = indexscandir;
+	node->indexonly = indexonly;
 
 	return node;
 }
@@ -3417,6 +3473,22 @@ make_material(Plan *lefttree)
 	return node;
 }
 
+static Gather *
+make_gather(List *qptlist, int num_workers, Plan *lefttree)
+{
+	Gather	   *node = makeNode(Gather);
+	Plan	   *plan = &node->plan;
+
+	/* cost should be inserted by caller */
+	plan->targetlist = qptlist;
+	plan->qual = NIL;
+	plan->lefttree = lefttree;
+	plan->righttree = NULL;
+	node->num_workers = num_workers;
+
+	return node;
+}
+
 /*
  * materialize_finished_plan: stick a Material node atop a completed plan
  *
@@ -3464,6 +3536,7 @@ make_agg(PlannerInfo *root, List *tlist, List *qual,
 	Plan	   *plan = &node->plan;
 	Path		agg_path;		/* dummy for result of cost_agg */
 	QualCost	qual_cost;
+	double		hashentrysize = 0;
 
 	node->aggstrategy = aggstrategy;
 	node->numCols = numGroupCols;
@@ -3471,13 +3544,19 @@ make_agg(PlannerInfo *root, List *tlist, List *qual,
 	node->grpOperators = grpOperators;
 	node->numGroups = numGroups;
 
+	/* estimate hash table entry size the same way planner.c does */
+	if (aggstrategy == AGG_HASHED)
+		hashentrysize = MAXALIGN(lefttree->plan_width) +
+			MAXALIGN(sizeof(MinimalTupleData)) +
+			hash_agg_entry_size(numAggs);
+
 	copy_plan_costsize(plan, lefttree); /* only care about copying size */
 	cost_agg(&agg_path, root,
 			 aggstrategy, numAggs,
 			 numGroupCols, numGroups,
 			 lefttree->startup_cost,
 			 lefttree->total_cost,
-			 lefttree->plan_rows);
+			 lefttree->plan_rows, hashentrysize);
 	plan->startup_cost = agg_path.startup_cost;
 	plan->total_cost = agg_path.total_cost;
 
@@ -3993,6 +4072,7 @@ is_projection_capable_plan(Plan *plan)
 		case T_SetOp:
 		case T_LockRows:
 		case T_Limit:
+		case T_Gather:
 		case T_ModifyTable:
 		case T_Append:
 		case T_RecursiveUnion:
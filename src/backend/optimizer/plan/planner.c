@@ -2226,8 +2226,8 @@ choose_hashed_grouping(PlannerInfo *root,
 		return false;
 
 	/*
-	 * Don't do it if it doesn't look like the hashtable will fit into
-	 * work_mem.
+	 * Estimate the size of the hashtable.  If it won't fit into work_mem,
+	 * the executor will spill groups to disk, and cost_agg charges for that.
 	 */
 
 	/* Estimate per-hash-entry space at tuple width... */
@@ -2237,9 +2237,6 @@ choose_hashed_grouping(PlannerInfo *root,
 	/* plus the per-hash-entry overhead */
 	hashentrysize += hash_agg_entry_size(agg_counts->numAggs);
 
-	if (hashentrysize * dNumGroups > work_mem * 1024L)
-		return false;
-
 	/*
 	 * When we have both GROUP BY and DISTINCT, use the more-rigorous of
 	 * DISTINCT and ORDER BY as the assumed required output sort order. This
@@ -2272,7 +2269,7 @@ choose_hashed_grouping(PlannerInfo *root,
 	cost_agg(&hashed_p, root, AGG_HASHED, agg_counts->numAggs,
 			 numGroupCols, dNumGroups,
 			 cheapest_path->startup_cost, cheapest_path->total_cost,
-			 path_rows);
+			 path_rows, hashentrysize);
 	/* Result of hashed agg is always unsorted */
 	if (target_pathkeys)
 		cost_sort(&hashed_p, root, target_pathkeys, hashed_p.total_cost,
@@ -2301,7 +2298,7 @@ choose_hashed_grouping(PlannerInfo *root,
 		cost_agg(&sorted_p, root, AGG_SORTED, agg_counts->numAggs,
 				 numGroupCols, dNumGroups,
 				 sorted_p.startup_cost, sorted_p.total_cost,
-				 path_rows);
+				 path_rows, 0);
 	else
 		cost_group(&sorted_p, root, numGroupCols, dNumGroups,
 				   sorted_p.startup_cost, sorted_p.total_cost,
@@ -2395,13 +2392,11 @@ choose_hashed_distinct(PlannerInfo *root,
 		return false;
 
 	/*
-	 * Don't do it if it doesn't look like the hashtable will fit into
-	 * work_mem.
+	 * Estimate the size of the hashtable.  If it won't fit into work_mem,
+	 * the executor will spill groups to disk, and cost_agg charges for that.
 	 */
 	hashentrysize = MAXALIGN(path_width) + MAXALIGN(sizeof(MinimalTupleData));
-
-	if (hashentrysize * dNumDistinctRows > work_mem * 1024L)
-		return false;
+	hashentrysize += hash_agg_entry_size(0);
 
 	/*
 	 * See if the estimated cost is no more than doing it the other way. While
@@ -2419,7 +2414,7 @@ choose_hashed_distinct(PlannerInfo *root,
 	cost_agg(&hashed_p, root, AGG_HASHED, 0,
 			 numDistinctCols, dNumDistinctRows,
 			 cheapest_startup_cost, cheapest_total_cost,
-			 path_rows);
+			 path_rows, hashentrysize);
 
 	/*
 	 * Result of hashed agg is always unsorted, so if ORDER BY is present we
@@ -2166,6 +2166,7 @@ finalize_plan(PlannerInfo *root, Plan *plan, Bitmapset *valid_params,
 		case T_Unique:
 		case T_SetOp:
 		case T_Group:
+		case T_Gather:
 			break;
 
 		default:
@@ -80,7 +80,7 @@ static bool choose_hashed_setop(PlannerInfo *root, List *groupClauses,
 					Plan *input_plan,
 					double dNumGroups, double dNumOutputRows,
 					double tuple_fraction,
-					const char *construct);
+					bool hashagg, const char *construct);
 static List *generate_setop_tlist(List *colTypes, int flag,
 					 Index varno,
 					 bool hack_constants,
@@ -579,6 +579,7 @@ generate_nonunion_plan(SetOperationStmt *op, PlannerInfo *root,
 	 */
 	use_hash = choose_hashed_setop(root, groupList, plan,
 								   dNumGroups, dNumOutputRows, tuple_fraction,
+								   false,
 					   (op->op == SETOP_INTERSECT) ? "INTERSECT" : "EXCEPT");
 
 	if (!use_hash)
@@ -703,7 +704,7 @@ make_union_unique(SetOperationStmt *op, Plan *plan,
 	/* Decide whether to hash or sort */
 	if (choose_hashed_setop(root, groupList, plan,
 							dNumGroups, dNumGroups, tuple_fraction,
-							"UNION"))
+							true, "UNION"))
 	{
 		/* Hashed aggregate plan --- no sort needed */
 		plan = (Plan *) make_agg(root,
@@ -735,13 +736,16 @@ make_union_unique(SetOperationStmt *op, Plan *plan,
 
 /*
  * choose_hashed_setop - should we use hashing for a set operation?
+ *
+ * hashagg is true if the hashed plan will be an Agg node, which can spill
+ * to disk, rather than a SetOp node, which cannot.
  */
 static bool
 choose_hashed_setop(PlannerInfo *root, List *groupClauses,
 					Plan *input_plan,
 					double dNumGroups, double dNumOutputRows,
 					double tuple_fraction,
-					const char *construct)
+					bool hashagg, const char *construct)
 {
 	int			numGroupCols = list_length(groupClauses);
 	bool		can_sort;
@@ -774,11 +778,12 @@ choose_hashed_setop(PlannerInfo *root, List *groupClauses,
 
 	/*
 	 * Don't do it if it doesn't look like the hashtable will fit into
-	 * work_mem.
+	 * work_mem, unless the plan is a hashed Agg, which spills to disk as
+	 * needed.  cost_agg charges for the spilling in that case.
 	 */
 	hashentrysize = MAXALIGN(input_plan->plan_width) + MAXALIGN(sizeof(MinimalTupleData));
 
-	if (hashentrysize * dNumGroups > work_mem * 1024L)
+	if (!hashagg && hashentrysize * dNumGroups > work_mem * 1024L)
 		return false;
 
 	/*
@@ -795,7 +800,7 @@ choose_hashed_setop(PlannerInfo *root, List *groupClauses,
 	cost_agg(&hashed_p, root, AGG_HASHED, 0,
 			 numGroupCols, dNumGroups,
 			 input_plan->startup_cost, input_plan->total_cost,
-			 input_plan->plan_rows);
+			 input_plan->plan_rows, hashentrysize);
 
 	/*
 	 * Now for the sorted case.  Note that the input is *always* unsorted,
@@ -83,6 +83,7 @@ static bool count_agg_clauses_walker(Node *node, AggClauseCounts *counts);
 static bool find_window_functions_walker(Node *node, WindowFuncLists *lists);
 static bool expression_returns_set_rows_walker(Node *node, double *count);
 static bool contain_subplans_walker(Node *node, void *context);
+static bool has_parallel_hazard_walker(Node *node, void *context);
 static bool contain_mutable_functions_walker(Node *node, void *context);
 static bool contain_volatile_functions_walker(Node *node, void *context);
 static bool contain_nonstrict_functions_walker(Node *node, void *context);
@@ -772,6 +773,43 @@ contain_subplans_walker(Node *node, void *context)
 }
 
 
+/*****************************************************************************
+ *		Check clauses for parallel safety
+ *****************************************************************************/
+
+/*
+ * has_parallel_hazard
+ *	  Detect whether a clause can't be evaluated in a parallel worker.
+ *
+ * A worker runs with its own copy of the session state, and sees neither
+ * the leader's parameter values nor its subplans, so we insist on clauses
+ * built only from Vars, constants and immutable functions.  Mutable
+ * functions are rejected since they may depend on settings the worker
+ * doesn't share.
+ */
+bool
+has_parallel_hazard(Node *clause)
+{
+	if (contain_mutable_functions(clause))
+		return true;
+	return has_parallel_hazard_walker(clause, NULL);
+}
+
+static bool
+has_parallel_hazard_walker(Node *node, void *context)
+{
+	if (node == NULL)
+		return false;
+	if (IsA(node, SubPlan) ||
+		IsA(node, AlternativeSubPlan) ||
+		IsA(node, SubLink) ||
+		IsA(node, Param) ||
+		IsA(node, CurrentOfExpr))
+		return true;			/* abort the tree traversal and return true */
+	return expression_tree_walker(node, has_parallel_hazard_walker, context);
+}
+
+
 /*****************************************************************************
  *		Check clauses for mutable functions
  *****************************************************************************/
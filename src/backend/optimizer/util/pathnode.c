@@ -465,6 +465,7 @@ create_index_path(PlannerInfo *root,
 
 	pathnode->isjoininner = (outer_rel != NULL);
 	pathnode->indexscandir = indexscandir;
+	pathnode->indexonly = check_index_only(rel, index);
 
 	if (outer_rel != NULL)
 	{
@@ -718,6 +719,31 @@ create_material_path(RelOptInfo *rel, Path *subpath)
 	return pathnode;
 }
 
+/*
+ * create_gather_path
+ *	  Creates a path corresponding to a Gather node, which runs copies of
+ *	  the parallel-aware subpath in num_workers workers, and in the leader,
+ *	  returning the union of their results.
+ *
+ * The result is unordered, since the participants' output is interleaved.
+ */
+GatherPath *
+create_gather_path(RelOptInfo *rel, Path *subpath, int num_workers)
+{
+	GatherPath *pathnode = makeNode(GatherPath);
+
+	pathnode->path.pathtype = T_Gather;
+	pathnode->path.parent = rel;
+	pathnode->path.pathkeys = NIL;
+
+	pathnode->subpath = subpath;
+	pathnode->num_workers = num_workers;
+
+	cost_gather(pathnode, subpath, num_workers);
+
+	return pathnode;
+}
+
 /*
  * create_unique_path
  *	  Creates a path representing elimination of distinct rows from the
@@ -984,19 +1010,17 @@ create_unique_path(PlannerInfo *root, RelOptInfo *rel, Path *subpath,
 	{
 		/*
 		 * Estimate the overhead per hashtable entry at 64 bytes (same as in
-		 * planner.c).
+		 * planner.c).  If the hashtable won't fit in work_mem, the Agg node
+		 * spills to disk; cost_agg charges for that.
 		 */
 		int			hashentrysize = rel->width + 64;
 
-		if (hashentrysize * pathnode->rows > work_mem * 1024L)
-			all_hash = false;	/* don't try to hash */
-		else
-			cost_agg(&agg_path, root,
-					 AGG_HASHED, 0,
-					 numCols, pathnode->rows,
-					 subpath->startup_cost,
-					 subpath->total_cost,
-					 rel->rows);
+		cost_agg(&agg_path, root,
+				 AGG_HASHED, 0,
+				 numCols, pathnode->rows,
+				 subpath->startup_cost,
+				 subpath->total_cost,
+				 rel->rows, hashentrysize);
 	}
 
 	if (all_btree && all_hash)
@@ -90,6 +90,7 @@ build_simple_rel(PlannerInfo *root, int relid, RelOptKind reloptkind)
 	rel->baserestrictcost.per_tuple = 0;
 	rel->joininfo = NIL;
 	rel->has_eclass_joins = false;
+	rel->consider_parallel = false;
 	rel->index_outer_relids = NULL;
 	rel->index_inner_paths = NIL;
 
@@ -344,6 +345,7 @@ build_join_rel(PlannerInfo *root,
 	joinrel->baserestrictcost.per_tuple = 0;
 	joinrel->joininfo = NIL;
 	joinrel->has_eclass_joins = false;
+	joinrel->consider_parallel = false;
 	joinrel->index_outer_relids = NULL;
 	joinrel->index_inner_paths = NIL;
 
@@ -131,6 +131,7 @@ static Node *makeXmlExpr(XmlExprOp op, char *name, List *named_args,
 						 List *args, int location);
 static List *mergeTableFuncParameters(List *func_args, List *columns);
 static TypeName *TableFuncTypeName(List *columns);
+static void processVacuumOptions(VacuumStmt *n, List *options);
 
 %}
 
@@ -229,7 +230,6 @@ static TypeName *TableFuncTypeName(List *columns);
 				transaction_mode_item
 
 %type <ival>	opt_lock lock_type cast_context
-%type <ival>	vacuum_option_list vacuum_option_elem
 %type <boolean>	opt_force opt_or_replace
 				opt_grant_grant_option opt_grant_admin_option
 				opt_nowait opt_if_exists opt_with_data
@@ -382,6 +382,8 @@ static TypeName *TableFuncTypeName(List *columns);
 %type <str>		explain_option_name
 %type <node>	explain_option_arg
 %type <defelt>	explain_option_elem
+%type <list>	vacuum_option_list
+%type <defelt>	vacuum_option_elem
 %type <list>	explain_option_list
 %type <node>	copy_generic_opt_arg copy_generic_opt_arg_list_item
 %type <defelt>	copy_generic_opt_elem
@@ -6822,6 +6824,7 @@ VacuumStmt: VACUUM opt_full opt_freeze opt_verbose
 					n->freeze_table_age = $3 ? 0 : -1;
 					n->relation = NULL;
 					n->va_cols = NIL;
+					n->parallel_workers = 0;
 					$$ = (Node *)n;
 				}
 			| VACUUM opt_full opt_freeze opt_verbose qualified_name
@@ -6836,6 +6839,7 @@ VacuumStmt: VACUUM opt_full opt_freeze opt_verbose
 					n->freeze_table_age = $3 ? 0 : -1;
 					n->relation = $5;
 					n->va_cols = NIL;
+					n->parallel_workers = 0;
 					$$ = (Node *)n;
 				}
 			| VACUUM opt_full opt_freeze opt_verbose AnalyzeStmt
@@ -6853,7 +6857,8 @@ VacuumStmt: VACUUM opt_full opt_freeze opt_verbose
 			| VACUUM '(' vacuum_option_list ')'
 				{
 					VacuumStmt *n = makeNode(VacuumStmt);
-					n->options = VACOPT_VACUUM | $3;
+					n->options = VACOPT_VACUUM;
+					processVacuumOptions(n, $3);
 					if (n->options & VACOPT_FREEZE)
 						n->freeze_min_age = n->freeze_table_age = 0;
 					else
@@ -6865,7 +6870,8 @@ VacuumStmt: VACUUM opt_full opt_freeze opt_verbose
 			| VACUUM '(' vacuum_option_list ')' qualified_name opt_name_list
 				{
 					VacuumStmt *n = makeNode(VacuumStmt);
-					n->options = VACOPT_VACUUM | $3;
+					n->options = VACOPT_VACUUM;
+					processVacuumOptions(n, $3);
 					if (n->options & VACOPT_FREEZE)
 						n->freeze_min_age = n->freeze_table_age = 0;
 					else
@@ -6879,15 +6885,25 @@ VacuumStmt: VACUUM opt_full opt_freeze opt_verbose
 		;
 
 vacuum_option_list:
-			vacuum_option_elem								{ $$ = $1; }
-			| vacuum_option_list ',' vacuum_option_elem		{ $$ = $1 | $3; }
+			vacuum_option_elem								{ $$ = list_make1($1); }
+			| vacuum_option_list ',' vacuum_option_elem		{ $$ = lappend($1, $3); }
 		;
 
 vacuum_option_elem:
-			analyze_keyword		{ $$ = VACOPT_ANALYZE; }
-			| VERBOSE			{ $$ = VACOPT_VERBOSE; }
-			| FREEZE			{ $$ = VACOPT_FREEZE; }
-			| FULL				{ $$ = VACOPT_FULL; }
+			analyze_keyword		{ $$ = makeDefElem("analyze", NULL); }
+			| VERBOSE			{ $$ = makeDefElem("verbose", NULL); }
+			| FREEZE			{ $$ = makeDefElem("freeze", NULL); }
+			| FULL				{ $$ = makeDefElem("full", NULL); }
+			| IDENT Iconst
+				{
+					/* PARALLEL isn't a keyword, so check the name here */
+					if (strcmp($1, "parallel") != 0)
+						ereport(ERROR,
+								(errcode(ERRCODE_SYNTAX_ERROR),
+								 errmsg("unrecognized VACUUM option \"%s\"", $1),
+								 parser_errposition(@1)));
+					$$ = makeDefElem("parallel", (Node *) makeInteger($2));
+				}
 		;
 
 AnalyzeStmt:
@@ -6901,6 +6917,7 @@ AnalyzeStmt:
 					n->freeze_table_age = -1;
 					n->relation = NULL;
 					n->va_cols = NIL;
+					n->parallel_workers = 0;
 					$$ = (Node *)n;
 				}
 			| analyze_keyword opt_verbose qualified_name opt_name_list
@@ -6913,6 +6930,7 @@ AnalyzeStmt:
 					n->freeze_table_age = -1;
 					n->relation = $3;
 					n->va_cols = $4;
+					n->parallel_workers = 0;
 					$$ = (Node *)n;
 				}
 		;
@@ -11857,6 +11875,34 @@ TableFuncTypeName(List *columns)
 	return result;
 }
 
+/*
+ * Apply a list of parenthesized VACUUM options to a VacuumStmt.
+ */
+static void
+processVacuumOptions(VacuumStmt *n, List *options)
+{
+	ListCell   *lc;
+
+	n->parallel_workers = 0;
+	foreach(lc, options)
+	{
+		DefElem    *opt = (DefElem *) lfirst(lc);
+
+		if (strcmp(opt->defname, "analyze") == 0)
+			n->options |= VACOPT_ANALYZE;
+		else if (strcmp(opt->defname, "verbose") == 0)
+			n->options |= VACOPT_VERBOSE;
+		else if (strcmp(opt->defname, "freeze") == 0)
+			n->options |= VACOPT_FREEZE;
+		else if (strcmp(opt->defname, "full") == 0)
+			n->options |= VACOPT_FULL;
+		else if (strcmp(opt->defname, "parallel") == 0)
+			n->parallel_workers = intVal(opt->arg);
+		else
+			elog(ERROR, "unrecognized VACUUM option \"%s\"", opt->defname);
+	}
+}
+
 /*
  * Must undefine this stuff before including scan.c, since it has different
  * definitions for these macros.
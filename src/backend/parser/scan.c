@@ -0,0 +1,2207 @@
+/* Generated by pyflex from scan.l; do not edit. */
+#define FLEX_SCANNER
+#define YY_FLEX_MAJOR_VERSION 2
+#define YY_FLEX_MINOR_VERSION 5
+#define YY_FLEX_SUBMINOR_VERSION 35
+#define yy_create_buffer core_yy_create_buffer
+#define yy_delete_buffer core_yy_delete_buffer
+#define yy_scan_buffer core_yy_scan_buffer
+#define yy_scan_string core_yy_scan_string
+#define yy_scan_bytes core_yy_scan_bytes
+#define yy_switch_to_buffer core_yy_switch_to_buffer
+#define yylex core_yylex
+#define yyalloc core_yyalloc
+#define yyrealloc core_yyrealloc
+#define yyfree core_yyfree
+#define yyrestart core_yyrestart
+#define yylex_init core_yylex_init
+#define yylex_destroy core_yylex_destroy
+#define yyget_extra core_yyget_extra
+#define yyset_extra core_yyset_extra
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+typedef size_t yy_size_t;
+#ifndef YY_TYPEDEF_YY_BUFFER_STATE
+#define YY_TYPEDEF_YY_BUFFER_STATE
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+#endif
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void *yyscan_t;
+#endif
+#define YY_END_OF_BUFFER_CHAR 0
+#define YY_BUF_SIZE 16384
+#define YY_NULL 0
+#define YY_EXIT_FAILURE 2
+#define INITIAL 0
+#define xb 1
+#define xc 2
+#define xd 3
+#define xh 4
+#define xe 5
+#define xq 6
+#define xdolq 7
+#define xui 8
+#define xus 9
+#define xeu 10
+
+/*-------------------------------------------------------------------------
+ *
+ * scan.l
+ *	  lexical scanner for PostgreSQL
+ *
+ * NOTE NOTE NOTE:
+ *
+ * The rules in this file must be kept in sync with psql's lexer!!!
+ *
+ * The rules are designed so that the scanner never has to backtrack,
+ * in the sense that there is always a rule that can match the input
+ * consumed so far (the rule action may internally throw back some input
+ * with yyless(), however).  As explained in the flex manual, this makes
+ * for a useful speed increase --- about a third faster than a plain -CF
+ * lexer, in simple testing.  The extra complexity is mostly in the rules
+ * for handling float numbers and continued string literals.  If you change
+ * the lexical rules, verify that you haven't broken the no-backtrack
+ * property by running flex with the "-b" option and checking that the
+ * resulting "lex.backup" file says that no backing up is needed.
+ *
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL: pgsql/src/backend/parser/scan.l,v 1.167 2010/05/30 18:10:41 tgl Exp $
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <ctype.h>
+#include <unistd.h>
+
+#include "parser/parser.h"				/* only needed for GUC variables */
+#include "parser/scanner.h"
+#include "parser/scansup.h"
+#include "mb/pg_wchar.h"
+
+
+/* Avoid exit() on fatal scanner errors (a bit ugly -- see yy_fatal_error) */
+#undef fprintf
+#define fprintf(file, fmt, msg)  ereport(ERROR, (errmsg_internal("%s", msg)))
+
+/*
+ * GUC variables.  This is a DIRECT violation of the warning given at the
+ * head of gram.y, ie flex/bison code must not depend on any GUC variables;
+ * as such, changing their values can induce very unintuitive behavior.
+ * But we shall have to live with it as a short-term thing until the switch
+ * to SQL-standard string syntax is complete.
+ */
+int				backslash_quote = BACKSLASH_QUOTE_SAFE_ENCODING;
+bool			escape_string_warning = true;
+bool			standard_conforming_strings = true;
+
+/*
+ * Set the type of YYSTYPE.
+ */
+#define YYSTYPE core_YYSTYPE
+
+/*
+ * Set the type of yyextra.  All state variables used by the scanner should
+ * be in yyextra, *not* statically allocated.
+ */
+#define YY_EXTRA_TYPE core_yy_extra_type *
+
+/*
+ * Each call to yylex must set yylloc to the location of the found token
+ * (expressed as a byte offset from the start of the input text).
+ * When we parse a token that requires multiple lexer rules to process,
+ * this should be done in the first such rule, else yylloc will point
+ * into the middle of the token.
+ */
+#define SET_YYLLOC()  (*(yylloc) = yytext - yyextra->scanbuf)
+
+/*
+ * Advance yylloc by the given number of bytes.
+ */
+#define ADVANCE_YYLLOC(delta)  ( *(yylloc) += (delta) )
+
+#define startlit()  ( yyextra->literallen = 0 )
+static void addlit(char *ytext, int yleng, core_yyscan_t yyscanner);
+static void addlitchar(unsigned char ychar, core_yyscan_t yyscanner);
+static char *litbufdup(core_yyscan_t yyscanner);
+static char *litbuf_udeescape(unsigned char escape, core_yyscan_t yyscanner);
+static unsigned char unescape_single_char(unsigned char c, core_yyscan_t yyscanner);
+static int	process_integer_literal(const char *token, YYSTYPE *lval);
+static bool is_utf16_surrogate_first(pg_wchar c);
+static bool is_utf16_surrogate_second(pg_wchar c);
+static pg_wchar surrogate_pair_to_codepoint(pg_wchar first, pg_wchar second);
+static void addunicode(pg_wchar c, yyscan_t yyscanner);
+
+#define yyerror(msg)  scanner_yyerror(msg, yyscanner)
+
+#define lexer_errposition()  scanner_errposition(*(yylloc), yyscanner)
+
+static void check_string_escape_warning(unsigned char ychar, core_yyscan_t yyscanner);
+static void check_escape_warning(core_yyscan_t yyscanner);
+
+/*
+ * Work around a bug in flex 2.5.35: it emits a couple of functions that
+ * it forgets to emit declarations for.  Since we use -Wmissing-prototypes,
+ * this would cause warnings.  Providing our own declarations should be
+ * harmless even when the bug gets fixed.
+ */
+extern int	core_yyget_column(yyscan_t yyscanner);
+extern void core_yyset_column(int column_no, yyscan_t yyscanner);
+
+
+#ifndef YY_EXTRA_TYPE
+#define YY_EXTRA_TYPE void *
+#endif
+struct yy_buffer_state
+{
+	char *base;
+	char *end;
+	char *pos;
+	int at_bol;
+	int owns;
+};
+struct yyguts_t
+{
+	YY_EXTRA_TYPE yyextra_r;
+	YY_BUFFER_STATE cur;
+	char *c_buf_p;
+	char hold_char;
+	int at_bol;
+	int yy_start;
+	char *yytext_r;
+	int yyleng_r;
+	YYSTYPE *yylval_r;
+	YYLTYPE *yylloc_r;
+};
+#define yytext (yyg->yytext_r)
+#define yyleng (yyg->yyleng_r)
+#define yyextra (yyg->yyextra_r)
+#define yylval (yyg->yylval_r)
+#define yylloc (yyg->yylloc_r)
+#define BEGIN (yyg->yy_start) =
+#define YY_START (yyg->yy_start)
+#define YYSTATE YY_START
+#define YY_CURRENT_BUFFER (yyg->cur)
+#define yyterminate() return YY_NULL
+#define YY_FATAL_ERROR(msg) yy_fatal_error(msg, yyscanner)
+#define yyless(n) do { int yyless_n = (n); *yyg->c_buf_p = yyg->hold_char; yyg->c_buf_p = yytext + yyless_n; yyleng = yyless_n; yyg->hold_char = *yyg->c_buf_p; *yyg->c_buf_p = 0; } while (0)
+#ifndef ECHO
+#define ECHO do { if (fwrite(yytext, yyleng, 1, stdout)) {} } while (0)
+#endif
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+#define YY_BREAK break;
+#define YY_RULE_SETUP if (yyleng > 0) yyg->at_bol = (yytext[yyleng - 1] == '\n'); YY_USER_ACTION
+void *yyalloc(yy_size_t, yyscan_t yyscanner);
+void *yyrealloc(void *, yy_size_t, yyscan_t yyscanner);
+void yyfree(void *, yyscan_t yyscanner);
+YY_BUFFER_STATE yy_create_buffer(FILE *file, int size, yyscan_t yyscanner);
+void yy_delete_buffer(YY_BUFFER_STATE b, yyscan_t yyscanner);
+void yy_switch_to_buffer(YY_BUFFER_STATE b, yyscan_t yyscanner);
+YY_BUFFER_STATE yy_scan_buffer(char *base, yy_size_t size, yyscan_t yyscanner);
+YY_BUFFER_STATE yy_scan_bytes(const char *bytes, int len, yyscan_t yyscanner);
+YY_BUFFER_STATE yy_scan_string(const char *str, yyscan_t yyscanner);
+void yyrestart(FILE *file, yyscan_t yyscanner);
+int yylex_init(yyscan_t *ptr);
+int yylex_destroy(yyscan_t yyscanner);
+YY_EXTRA_TYPE yyget_extra(yyscan_t yyscanner);
+void yyset_extra(YY_EXTRA_TYPE e, yyscan_t yyscanner);
+int yylex(YYSTYPE *yylval_param, YYLTYPE *yylloc_param, yyscan_t yyscanner);
+static void yy_fatal_error(const char *msg, yyscan_t yyscanner);
+static const unsigned char yy_ec[256] = {0,0,0,0,0,0,0,0,0,1,2,0,1,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,4,5,4,6,7,8,9,10,10,11,12,10,13,14,15,16,16,16,16,16,16,16,16,17,17,18,10,7,19,7,4,4,20,21,22,23,24,23,25,25,25,25,25,25,25,26,25,27,25,25,28,25,29,25,25,30,25,25,10,31,10,7,25,4,20,21,22,23,24,23,25,25,25,25,25,25,25,26,25,27,25,25,28,25,32,25,25,33,25,25,0,4,0,4,0,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25};
+#define YY_NCLASSES 34
+static const short yy_nxt[12580] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,29,13,14,13,20,30,21,18,20,31,19,18,18,15,16,17,22,22,12,18,24,23,24,24,25,24,
+26,24,24,27,28,29,27,28,33,33,33,33,33,33,33,33,33,32,33,33,33,33,33,33,33,33,33,33,33,33,
+33,33,33,33,33,33,33,33,33,33,33,33,35,35,35,35,36,35,35,36,36,35,35,34,36,36,35,37,35,35,
+35,36,35,35,35,35,35,35,35,35,35,35,35,35,35,35,39,39,39,39,39,38,39,39,39,39,39,39,39,39,
+39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,41,41,41,41,41,41,41,41,41,40,
+41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,44,44,45,44,44,44,
+44,44,44,42,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,43,44,44,47,47,
+47,47,47,47,47,47,47,46,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,
+47,47,48,48,50,48,48,48,49,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+48,48,48,48,48,48,39,39,39,39,39,51,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+39,39,39,39,39,39,39,39,39,39,47,47,47,47,47,47,47,47,47,52,47,47,47,47,47,47,47,47,47,47,
+47,47,47,47,47,47,47,47,47,47,47,47,47,47,55,55,54,55,55,55,55,55,55,55,55,55,55,55,55,55,
+55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,53,55,55,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,56,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,14,14,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,14,14,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,58,0,0,58,58,0,0,58,58,59,0,58,0,0,0,58,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,0,61,61,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,58,58,0,0,62,58,58,0,58,0,0,0,58,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,58,58,0,0,58,58,58,0,58,0,0,
+0,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,58,58,0,
+0,58,58,58,0,58,0,0,0,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+64,0,0,0,0,0,0,0,0,0,65,65,0,0,63,63,63,63,63,63,63,63,63,63,63,0,63,63,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,67,0,66,66,0,0,0,0,0,0,68,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,70,0,0,69,0,0,0,0,0,0,70,70,0,0,70,70,70,70,70,70,70,70,
+70,70,70,0,70,70,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,0,70,70,0,0,70,70,70,70,
+70,70,70,70,70,70,70,0,70,70,0,0,0,0,0,0,70,0,0,71,0,0,0,0,0,0,70,70,0,0,
+70,70,70,70,70,70,70,70,70,70,70,0,70,70,0,0,0,0,0,0,70,0,0,72,0,0,0,0,0,0,
+70,70,0,0,70,70,70,70,70,70,70,70,70,70,70,0,70,70,0,0,0,0,0,0,70,0,73,0,0,0,
+0,0,0,0,70,70,0,0,70,70,70,70,70,70,70,70,70,70,70,0,70,70,0,0,0,0,0,0,70,0,
+0,74,0,0,0,0,0,0,70,70,0,0,70,70,70,70,70,70,70,70,70,70,70,0,70,70,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,75,76,76,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,33,33,33,33,33,33,33,33,33,0,33,33,33,33,33,33,33,33,
+33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,0,0,0,0,0,0,0,0,0,0,0,78,0,0,
+0,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,35,35,35,35,35,35,35,35,35,
+35,0,35,35,35,0,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+35,35,35,35,35,0,35,35,35,0,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,0,0,
+0,0,0,0,0,0,0,0,0,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,81,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,39,39,39,39,39,0,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+39,39,39,39,39,39,39,39,39,39,0,82,83,83,0,0,0,0,0,0,0,0,0,84,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,41,41,41,41,41,41,41,41,0,41,41,41,41,41,41,
+41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,0,85,86,86,0,0,0,0,0,88,0,0,
+0,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,89,89,89,89,89,89,89,
+89,89,89,89,89,89,89,89,93,89,89,89,89,89,89,89,89,89,89,89,89,90,89,89,91,92,45,45,45,45,
+45,45,45,45,45,0,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,0,45,45,
+45,45,45,45,45,45,45,45,45,0,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,
+45,0,45,45,0,85,86,86,0,0,0,0,0,88,0,0,0,87,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,47,47,47,47,47,47,47,47,47,0,47,47,47,47,47,47,47,47,47,47,47,47,
+47,47,47,47,47,47,47,47,47,47,47,47,50,50,50,50,50,50,0,50,50,50,50,50,50,50,50,50,50,50,
+50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,0,0,0,0,0,0,94,0,0,0,0,0,0,0,
+0,0,0,0,0,0,95,95,95,95,95,95,95,95,95,95,95,0,95,95,50,50,50,50,50,50,0,50,50,50,
+50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,0,96,96,96,0,81,
+0,0,0,0,0,0,0,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,0,0,98,0,0,100,
+101,101,0,0,0,0,0,88,0,0,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,99,0,0,
+99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,103,0,0,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,58,
+58,0,0,58,58,58,0,58,0,0,0,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,105,0,0,
+106,105,105,106,106,105,105,106,106,106,105,106,105,105,105,106,105,105,105,105,105,105,105,105,105,105,105,105,105,105,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,61,0,0,0,0,0,0,68,0,
+0,0,0,0,0,0,0,0,0,0,0,0,107,0,0,107,107,0,0,107,107,107,0,107,0,0,0,107,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,108,108,
+0,0,108,108,108,108,108,108,108,108,108,108,108,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,65,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,67,0,66,66,0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,110,0,109,109,0,0,0,0,0,0,68,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,112,0,0,111,111,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,0,70,70,0,0,
+70,70,70,70,70,70,70,70,70,70,70,0,70,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,0,0,
+0,113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,75,76,76,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,115,115,115,0,0,0,0,0,117,0,0,0,116,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,0,0,0,79,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,119,0,0,119,119,0,
+0,119,119,119,0,119,0,0,0,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,82,
+83,83,0,0,0,0,0,0,0,0,0,84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,121,121,121,0,0,0,0,0,120,0,0,0,122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,123,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,85,86,86,0,0,0,0,0,0,0,0,0,87,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,124,124,0,0,0,0,0,126,0,0,0,125,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,128,0,0,128,128,128,128,128,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,129,129,0,0,129,129,129,129,129,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,130,0,0,130,130,
+130,130,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,94,0,0,0,
+0,0,0,0,0,0,132,132,0,0,132,132,132,132,132,132,132,132,132,132,132,0,132,132,0,96,96,96,0,0,
+0,0,0,0,0,0,0,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,0,0,98,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,134,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+135,0,0,0,0,0,0,0,0,0,0,100,101,101,0,0,0,0,0,0,0,0,0,102,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,99,0,0,99,0,0,136,136,136,0,0,0,0,0,126,0,0,0,137,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,99,0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,139,139,0,0,139,139,139,139,139,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,140,140,0,0,140,140,140,140,140,0,0,0,0,0,0,0,0,0,
+105,105,0,0,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,
+105,105,105,105,105,105,0,0,106,105,105,106,106,105,105,106,106,106,105,106,105,105,105,106,105,105,105,105,105,105,
+105,105,105,105,105,105,105,105,0,0,0,0,107,0,0,107,107,0,0,107,107,107,0,107,0,0,0,107,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,108,108,
+0,0,108,108,108,108,108,108,108,108,108,108,108,0,108,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,109,109,0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,111,111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,111,111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,115,115,115,0,0,0,0,0,117,0,0,0,116,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,141,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,142,143,76,76,142,142,142,142,
+142,142,142,142,142,144,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,0,0,0,0,
+119,0,0,119,119,0,0,119,119,119,0,119,0,0,0,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,121,121,121,0,0,0,0,0,120,0,0,0,122,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,146,147,83,83,146,146,146,146,146,146,146,146,146,148,146,146,146,146,
+146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,0,124,124,124,0,0,0,0,0,126,0,0,0,125,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,152,150,
+86,86,152,152,152,152,152,152,152,152,152,151,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+152,152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,153,153,0,0,153,153,153,153,153,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,154,154,0,0,154,154,154,154,
+154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,155,0,0,
+155,155,155,155,155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,94,0,0,0,0,0,
+0,0,0,0,132,132,0,0,132,132,132,132,132,132,132,132,132,132,132,0,132,132,159,157,96,96,159,159,159,159,
+159,159,159,159,159,158,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,160,159,159,160,159,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,161,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,162,0,
+0,0,0,0,0,136,136,136,0,0,0,0,0,126,0,0,0,137,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,99,0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,167,165,101,101,167,167,167,167,167,167,167,167,167,166,167,167,167,167,
+167,167,167,167,167,167,167,167,167,167,167,164,167,167,164,167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,168,168,0,0,168,168,168,168,168,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,169,169,0,0,169,169,169,169,169,0,0,0,0,0,0,0,0,0,170,171,173,173,170,170,
+170,170,170,170,170,170,170,172,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,142,143,
+76,76,142,142,142,142,142,142,142,142,142,144,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,
+142,142,142,143,76,76,142,142,142,142,142,142,142,142,142,144,142,142,142,142,142,142,142,142,142,142,142,142,142,142,
+142,142,142,142,142,142,142,143,76,76,142,142,142,142,142,142,142,142,142,174,142,142,142,142,142,142,142,142,142,142,
+142,142,142,142,142,142,142,142,142,142,175,176,178,178,175,175,175,175,175,175,175,175,175,177,175,175,175,175,175,175,
+175,175,175,175,175,175,175,175,175,175,175,175,175,175,146,147,83,83,146,146,146,146,146,146,146,146,146,148,146,146,
+146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,147,83,83,146,146,146,146,146,146,146,146,
+146,148,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,147,83,83,146,146,146,146,
+146,146,146,146,146,179,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,183,180,181,181,
+183,183,183,183,183,183,183,183,183,182,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+152,150,86,86,152,152,152,152,152,152,152,152,152,151,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+152,152,152,152,152,150,86,86,152,152,152,152,152,152,152,152,152,184,152,152,152,152,152,152,152,152,152,152,152,152,
+152,152,152,152,152,152,152,152,152,150,86,86,152,152,152,152,152,152,152,152,152,151,152,152,152,152,152,152,152,152,
+152,152,152,152,152,152,152,152,152,152,152,152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,185,185,
+0,0,185,185,185,185,185,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,186,186,0,0,186,186,186,186,186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,159,157,
+96,96,159,159,159,159,159,159,159,159,159,158,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,160,159,159,
+160,159,159,157,96,96,159,159,159,159,159,159,159,159,159,187,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+159,160,159,159,160,159,159,157,96,96,159,159,159,159,159,159,159,159,159,158,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,160,159,159,160,159,159,157,96,96,159,159,159,159,159,159,159,159,159,158,159,159,159,159,159,159,
+159,159,159,159,188,159,159,159,159,160,159,159,160,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,189,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,190,0,0,0,0,0,0,0,0,0,0,0,195,192,193,193,195,195,195,195,
+195,195,195,195,195,194,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,191,195,195,191,195,167,165,101,101,
+167,167,167,167,167,167,167,167,167,166,167,167,167,167,167,167,167,167,167,167,196,167,167,167,167,164,167,167,164,167,
+167,165,101,101,167,167,167,167,167,167,167,167,167,166,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,164,
+167,167,164,167,167,165,101,101,167,167,167,167,167,167,167,167,167,197,167,167,167,167,167,167,167,167,167,167,167,167,
+167,167,167,164,167,167,164,167,167,165,101,101,167,167,167,167,167,167,167,167,167,166,167,167,167,167,167,167,167,167,
+167,167,167,167,167,167,167,164,167,167,164,167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,198,198,
+0,0,198,198,198,198,198,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,199,199,0,0,199,199,199,199,199,0,0,0,0,0,0,0,0,0,170,171,173,173,170,170,170,170,170,170,
+170,170,170,172,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,171,173,173,170,170,
+170,170,170,170,170,170,170,172,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,171,
+173,173,170,170,170,170,170,170,170,170,170,200,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,0,115,115,115,0,0,0,0,0,117,0,0,0,116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,142,143,76,76,142,142,142,142,142,142,142,142,142,174,142,142,142,142,142,142,142,142,142,142,
+142,142,142,142,142,142,142,142,142,142,175,176,178,178,175,175,175,175,175,175,175,175,175,177,175,175,175,175,175,175,
+175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,176,178,178,175,175,175,175,175,175,175,175,175,177,175,175,
+175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,176,178,178,175,175,175,175,175,175,175,175,
+175,201,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,0,121,121,121,0,0,0,0,
+0,120,0,0,0,122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,146,147,83,83,
+146,146,146,146,146,146,146,146,146,179,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,
+183,180,181,181,183,183,183,183,183,183,183,183,183,182,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+183,183,183,183,0,124,124,124,0,0,0,0,0,126,0,0,0,125,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,183,180,181,181,183,183,183,183,183,183,183,183,183,202,183,183,183,183,183,183,183,183,
+183,183,183,183,183,183,183,183,183,183,183,183,183,180,181,181,183,183,183,183,183,183,183,183,183,182,183,183,183,183,
+183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,152,150,86,86,152,152,152,152,152,152,152,152,152,184,
+152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,203,203,0,0,203,203,203,203,203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,204,204,0,0,204,204,204,204,204,0,0,0,0,0,0,0,0,0,159,157,
+96,96,159,159,159,159,159,159,159,159,159,187,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,160,159,159,
+160,159,159,157,96,96,159,159,159,159,159,159,159,159,159,158,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+205,160,159,159,160,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+207,0,0,0,0,0,0,0,0,0,0,0,0,0,195,192,193,193,195,195,195,195,195,195,195,195,195,194,195,195,
+195,195,195,195,195,195,195,195,208,195,195,195,195,191,195,195,191,195,195,192,193,193,195,195,195,195,195,195,195,195,
+195,194,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,191,195,195,191,195,0,136,136,136,0,0,0,0,
+0,126,0,0,0,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,99,0,0,99,0,195,192,193,193,
+195,195,195,195,195,195,195,195,195,209,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,191,195,195,191,195,
+195,192,193,193,195,195,195,195,195,195,195,195,195,194,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,191,
+195,195,191,195,167,165,101,101,167,167,167,167,167,167,167,167,167,166,167,167,167,167,167,167,167,167,167,167,167,167,
+167,167,210,164,167,167,164,167,167,165,101,101,167,167,167,167,167,167,167,167,167,197,167,167,167,167,167,167,167,167,
+167,167,167,167,167,167,167,164,167,167,164,167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,211,211,
+0,0,211,211,211,211,211,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,212,212,0,0,212,212,212,212,212,0,0,0,0,0,0,0,0,0,170,171,173,173,170,170,170,170,170,170,
+170,170,170,200,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,175,176,178,178,175,175,
+175,175,175,175,175,175,175,201,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,183,180,
+181,181,183,183,183,183,183,183,183,183,183,202,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+183,183,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,213,213,0,0,213,213,213,213,213,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,159,157,96,96,159,159,159,159,159,159,159,159,159,158,159,159,159,159,159,159,
+159,159,214,159,159,159,159,159,159,160,159,159,160,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,216,0,0,0,0,0,0,195,192,193,193,195,195,195,195,
+195,195,195,195,195,194,195,195,195,195,195,195,195,195,195,195,195,195,195,195,217,191,195,195,191,195,195,192,193,193,
+195,195,195,195,195,195,195,195,195,209,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,191,195,195,191,195,
+167,165,101,101,167,167,167,167,167,167,167,167,167,166,167,167,167,167,167,167,167,167,218,167,167,167,167,167,167,164,
+167,167,164,167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,219,219,0,0,219,219,219,219,219,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,220,
+0,0,220,220,220,220,220,0,0,0,0,0,0,0,0,0,159,157,96,96,159,159,159,159,159,159,159,159,159,158,
+159,159,159,159,159,159,221,159,159,159,159,159,159,159,159,160,159,159,160,159,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,223,0,0,0,0,0,0,0,0,0,195,192,
+193,193,195,195,195,195,195,195,195,195,195,194,195,195,195,195,195,195,195,195,224,195,195,195,195,195,195,191,195,195,
+191,195,167,165,101,101,167,167,167,167,167,167,167,167,167,166,167,167,167,167,167,167,225,167,167,167,167,167,167,167,
+167,164,167,167,164,167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,226,226,0,0,226,226,226,226,
+226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,227,227,0,0,
+227,227,227,227,227,0,0,0,0,0,0,0,0,0,159,157,96,96,159,159,159,159,159,159,159,159,159,158,159,159,
+159,159,159,159,159,159,159,159,159,159,159,228,159,160,159,159,160,159,0,229,229,229,0,0,0,0,0,231,0,0,
+0,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,233,233,233,0,0,0,0,
+0,232,0,0,0,234,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,195,192,193,193,
+195,195,195,195,195,195,195,195,195,194,195,195,195,195,195,195,235,195,195,195,195,195,195,195,195,191,195,195,191,195,
+167,165,101,101,167,167,167,167,167,167,167,167,167,166,167,167,167,167,167,167,167,167,167,167,167,167,167,236,167,164,
+167,167,164,167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,237,237,0,0,237,237,237,237,237,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,238,238,0,0,238,238,
+238,238,238,0,0,0,0,0,0,0,0,0,159,157,96,96,159,159,159,159,159,159,159,159,159,158,159,159,159,159,
+159,159,159,159,159,159,239,159,159,159,159,160,159,159,160,159,0,229,229,229,0,0,0,0,0,231,0,0,0,230,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,241,241,241,241,241,241,
+241,241,241,0,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,242,242,
+242,242,242,242,242,242,242,0,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,
+242,242,0,233,233,233,0,0,0,0,0,232,0,0,0,234,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,195,192,193,193,195,195,195,195,195,195,195,195,195,194,195,195,195,195,195,195,
+195,195,195,195,195,195,195,244,195,191,195,195,191,195,167,165,101,101,167,167,167,167,167,167,167,167,167,166,167,167,
+167,167,167,167,167,167,167,167,245,167,167,167,167,164,167,167,164,167,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,246,246,0,0,246,246,246,246,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,159,247,248,248,
+159,159,159,159,159,250,159,159,159,249,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,160,159,159,160,159,
+253,251,229,229,253,253,253,253,253,254,253,253,253,252,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,
+253,253,253,253,0,0,0,0,0,0,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,256,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,257,258,233,233,257,257,257,257,257,259,257,257,257,260,257,257,257,257,
+257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,195,192,193,193,195,195,195,195,195,195,195,195,195,194,
+195,195,195,195,195,195,195,195,195,195,261,195,195,195,195,191,195,195,191,195,167,262,263,263,167,167,167,167,167,265,
+167,167,167,264,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,164,167,167,164,167,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,159,247,
+248,248,159,159,159,159,159,250,159,159,159,249,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,160,159,159,
+160,159,0,248,248,248,0,0,0,0,0,231,0,0,0,266,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,98,0,0,98,0,159,157,96,96,159,159,159,159,159,159,159,159,159,267,159,159,159,159,159,159,159,159,159,159,
+159,159,159,159,159,160,159,159,160,159,271,268,269,269,271,271,271,271,271,159,271,271,271,270,271,271,271,271,271,271,
+271,271,271,271,271,271,271,271,271,272,271,271,272,271,253,251,229,229,253,253,253,253,253,254,253,253,253,252,253,253,
+253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,251,229,229,253,253,253,253,253,254,253,253,
+253,273,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,251,229,229,253,253,253,253,
+253,254,253,253,253,252,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,277,274,275,275,
+277,277,277,277,277,254,277,277,277,276,277,277,277,277,277,277,277,277,277,277,277,277,277,277,277,277,277,277,277,277,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,257,258,233,233,257,257,257,257,257,259,257,257,257,260,257,257,257,257,257,257,257,257,
+257,257,257,257,257,257,257,257,257,257,257,257,257,258,233,233,257,257,257,257,257,259,257,257,257,260,257,257,257,257,
+257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,278,279,280,280,278,278,278,278,278,259,278,278,278,281,
+278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,257,258,233,233,257,257,257,257,257,259,
+257,257,257,282,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,195,283,284,284,195,195,
+195,195,195,286,195,195,195,285,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,191,195,195,191,195,167,262,
+263,263,167,167,167,167,167,265,167,167,167,264,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,164,167,167,
+164,167,0,287,287,287,0,0,0,0,0,289,0,0,0,288,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,99,0,0,99,0,167,165,101,101,167,167,167,167,167,167,167,167,167,290,167,167,167,167,167,167,167,167,167,167,
+167,167,167,167,167,164,167,167,164,167,291,292,293,293,291,291,291,291,291,167,291,291,291,294,291,291,291,291,291,291,
+291,291,291,291,291,291,291,291,291,295,291,291,295,291,0,0,0,0,0,0,0,0,0,0,0,0,0,296,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,299,297,248,248,299,299,299,299,299,300,299,299,
+299,298,299,299,299,299,299,299,299,299,299,299,299,299,299,299,299,301,299,299,301,299,159,157,96,96,159,159,159,159,
+159,302,159,159,159,158,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,160,159,159,160,159,0,96,96,96,
+0,0,0,0,0,255,0,0,0,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,0,0,98,0,
+159,157,96,96,159,159,159,159,159,302,159,159,159,187,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,160,
+159,159,160,159,159,157,96,96,159,159,159,159,159,302,159,159,159,158,159,159,159,159,159,159,159,159,159,159,159,159,
+159,159,159,160,159,159,160,159,159,157,96,96,159,159,159,159,159,302,159,159,159,158,159,159,159,159,159,159,159,159,
+159,159,188,159,159,159,159,160,159,159,160,159,253,251,229,229,253,253,253,253,253,254,253,253,253,273,253,253,253,253,
+253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,251,229,229,253,253,253,253,253,303,253,253,253,252,
+253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,0,229,229,229,0,0,0,0,0,304,
+0,0,0,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,253,251,229,229,253,253,
+253,253,253,303,253,253,253,273,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,251,
+229,229,253,253,253,253,253,303,253,253,253,252,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,253,
+253,253,257,258,233,233,257,257,257,257,257,305,257,257,257,260,257,257,257,257,257,257,257,257,257,257,257,257,257,257,
+257,257,257,257,257,257,257,258,233,233,257,257,257,257,257,305,257,257,257,260,257,257,257,257,257,257,257,257,257,257,
+257,257,257,257,257,257,257,257,257,257,0,233,233,233,0,0,0,0,0,306,0,0,0,234,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,257,258,233,233,257,257,257,257,257,305,257,257,257,282,257,257,
+257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,258,233,233,257,257,257,257,257,259,257,257,
+257,282,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,257,195,283,284,284,195,195,195,195,
+195,286,195,195,195,285,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,191,195,195,191,195,0,287,287,287,
+0,0,0,0,0,289,0,0,0,288,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,99,0,0,99,0,
+195,192,193,193,195,195,195,195,195,195,195,195,195,307,195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,191,
+195,195,191,195,308,309,310,310,308,308,308,308,308,195,308,308,308,311,308,308,308,308,308,308,308,308,308,308,308,308,
+308,308,308,312,308,308,312,308,0,287,287,287,0,0,0,0,0,289,0,0,0,288,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,99,0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,313,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,242,242,242,242,242,242,242,242,242,0,242,242,242,242,
+242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,316,314,263,263,316,316,316,316,316,317,
+316,316,316,315,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,318,316,316,318,316,167,165,101,101,167,167,
+167,167,167,319,167,167,167,166,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,164,167,167,164,167,167,165,
+101,101,167,167,167,167,167,319,167,167,167,166,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,164,167,167,
+164,167,0,136,136,136,0,0,0,0,0,320,0,0,0,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,99,0,0,99,0,167,165,101,101,167,167,167,167,167,319,167,167,167,197,167,167,167,167,167,167,167,167,167,167,
+167,167,167,167,167,164,167,167,164,167,167,165,101,101,167,167,167,167,167,319,167,167,167,166,167,167,167,167,167,167,
+167,167,167,167,196,167,167,167,167,164,167,167,164,167,299,297,248,248,299,299,299,299,299,300,299,299,299,321,299,299,
+299,299,299,299,299,299,299,299,299,299,299,299,299,301,299,299,301,299,299,297,248,248,299,299,299,299,299,300,299,299,
+299,321,299,299,299,299,299,299,299,299,299,299,299,299,299,299,299,301,299,299,301,299,299,297,248,248,299,299,299,299,
+299,300,299,299,299,322,299,299,299,299,299,299,299,299,299,299,299,299,299,299,299,301,299,299,301,299,299,297,248,248,
+299,299,299,299,299,300,299,299,299,321,299,299,299,299,299,299,299,299,299,299,299,299,299,299,299,301,299,299,301,299,
+326,323,324,324,326,326,326,326,326,300,326,326,326,325,326,326,326,326,326,326,326,326,326,326,326,326,326,326,326,327,
+326,326,327,326,299,297,248,248,299,299,299,299,299,300,299,299,299,321,299,299,299,299,299,299,299,299,299,299,328,299,
+299,299,299,301,299,299,301,299,159,157,96,96,159,159,159,159,159,159,159,159,159,158,159,159,159,159,159,159,159,159,
+159,159,159,159,159,159,159,160,159,159,160,159,277,274,275,275,277,277,277,277,277,254,277,277,277,276,277,277,277,277,
+277,277,277,277,277,277,277,277,277,277,277,277,277,277,277,277,241,241,241,241,241,241,241,241,241,0,241,241,241,241,
+241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,278,279,280,280,278,278,278,278,278,259,
+278,278,278,281,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,242,242,242,242,242,242,
+242,242,242,0,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,331,329,
+284,284,331,331,331,331,331,332,331,331,331,330,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,333,331,331,
+333,331,195,192,193,193,195,195,195,195,195,334,195,195,195,194,195,195,195,195,195,195,195,195,195,195,195,195,195,195,
+195,191,195,195,191,195,195,192,193,193,195,195,195,195,195,334,195,195,195,194,195,195,195,195,195,195,195,195,195,195,
+195,195,195,195,195,191,195,195,191,195,0,136,136,136,0,0,0,0,0,320,0,0,0,137,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,99,0,0,99,0,195,192,193,193,195,195,195,195,195,334,195,195,195,209,195,195,
+195,195,195,195,195,195,195,195,195,195,195,195,195,191,195,195,191,195,195,192,193,193,195,195,195,195,195,334,195,195,
+195,194,195,195,195,195,195,195,195,195,195,195,208,195,195,195,195,191,195,195,191,195,331,329,284,284,331,331,331,331,
+331,332,331,331,331,335,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,333,331,331,333,331,316,314,263,263,
+316,316,316,316,316,317,316,316,316,336,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,318,316,316,318,316,
+316,314,263,263,316,316,316,316,316,317,316,316,316,337,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,318,
+316,316,318,316,316,314,263,263,316,316,316,316,316,317,316,316,316,336,316,316,316,316,316,316,316,316,316,316,316,316,
+316,316,316,318,316,316,318,316,338,339,340,340,338,338,338,338,338,317,338,338,338,341,338,338,338,338,338,338,338,338,
+338,338,338,338,338,338,338,342,338,338,342,338,316,314,263,263,316,316,316,316,316,317,316,316,316,336,316,316,316,316,
+316,316,316,316,316,316,343,316,316,316,316,318,316,316,318,316,167,165,101,101,167,167,167,167,167,167,167,167,167,166,
+167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,164,167,167,164,167,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,299,297,248,248,299,299,
+299,299,299,300,299,299,299,322,299,299,299,299,299,299,299,299,299,299,299,299,299,299,299,301,299,299,301,299,299,297,
+248,248,299,299,299,299,299,300,299,299,299,322,299,299,299,299,299,299,299,299,299,299,299,299,299,299,299,301,299,299,
+301,299,299,297,248,248,299,299,299,299,299,344,299,299,299,321,299,299,299,299,299,299,299,299,299,299,299,299,299,299,
+299,301,299,299,301,299,0,248,248,248,0,0,0,0,0,304,0,0,0,266,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,98,0,0,98,0,299,297,248,248,299,299,299,299,299,344,299,299,299,322,299,299,299,299,299,299,
+299,299,299,299,299,299,299,299,299,301,299,299,301,299,299,297,248,248,299,299,299,299,299,344,299,299,299,321,299,299,
+299,299,299,299,299,299,299,299,299,299,299,299,299,301,299,299,301,299,299,297,248,248,299,299,299,299,299,344,299,299,
+299,321,299,299,299,299,299,299,299,299,299,299,328,299,299,299,299,301,299,299,301,299,299,297,248,248,299,299,299,299,
+299,300,299,299,299,321,299,299,299,299,299,299,299,299,299,299,299,299,299,299,345,301,299,299,301,299,331,329,284,284,
+331,331,331,331,331,332,331,331,331,335,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,333,331,331,333,331,
+331,329,284,284,331,331,331,331,331,332,331,331,331,346,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,333,
+331,331,333,331,331,329,284,284,331,331,331,331,331,332,331,331,331,335,331,331,331,331,331,331,331,331,331,331,331,331,
+331,331,331,333,331,331,333,331,347,348,349,349,347,347,347,347,347,332,347,347,347,350,347,347,347,347,347,347,347,347,
+347,347,347,347,347,347,347,351,347,347,351,347,331,329,284,284,331,331,331,331,331,332,331,331,331,335,331,331,331,331,
+331,331,331,331,331,331,352,331,331,331,331,333,331,331,333,331,195,192,193,193,195,195,195,195,195,195,195,195,195,194,
+195,195,195,195,195,195,195,195,195,195,195,195,195,195,195,191,195,195,191,195,331,329,284,284,331,331,331,331,331,332,
+331,331,331,346,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,333,331,331,333,331,316,314,263,263,316,316,
+316,316,316,317,316,316,316,337,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,318,316,316,318,316,316,314,
+263,263,316,316,316,316,316,317,316,316,316,337,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,318,316,316,
+318,316,316,314,263,263,316,316,316,316,316,353,316,316,316,336,316,316,316,316,316,316,316,316,316,316,316,316,316,316,
+316,318,316,316,318,316,316,314,263,263,316,316,316,316,316,353,316,316,316,336,316,316,316,316,316,316,316,316,316,316,
+316,316,316,316,316,318,316,316,318,316,0,287,287,287,0,0,0,0,0,354,0,0,0,288,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,99,0,0,99,0,316,314,263,263,316,316,316,316,316,353,316,316,316,337,316,316,
+316,316,316,316,316,316,316,316,316,316,316,316,316,318,316,316,318,316,316,314,263,263,316,316,316,316,316,353,316,316,
+316,336,316,316,316,316,316,316,316,316,316,316,343,316,316,316,316,318,316,316,318,316,316,314,263,263,316,316,316,316,
+316,317,316,316,316,336,316,316,316,316,316,316,316,316,316,316,316,316,316,316,355,318,316,316,318,316,326,323,324,324,
+326,326,326,326,326,300,326,326,326,325,326,326,326,326,326,326,326,326,326,326,326,326,326,326,326,327,326,326,327,326,
+299,297,248,248,299,299,299,299,299,300,299,299,299,321,299,299,299,299,299,299,299,299,356,299,299,299,299,299,299,301,
+299,299,301,299,331,329,284,284,331,331,331,331,331,332,331,331,331,346,331,331,331,331,331,331,331,331,331,331,331,331,
+331,331,331,333,331,331,333,331,331,329,284,284,331,331,331,331,331,357,331,331,331,335,331,331,331,331,331,331,331,331,
+331,331,331,331,331,331,331,333,331,331,333,331,331,329,284,284,331,331,331,331,331,357,331,331,331,335,331,331,331,331,
+331,331,331,331,331,331,331,331,331,331,331,333,331,331,333,331,0,287,287,287,0,0,0,0,0,354,0,0,0,288,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,99,0,0,99,0,331,329,284,284,331,331,331,331,331,357,
+331,331,331,346,331,331,331,331,331,331,331,331,331,331,331,331,331,331,331,333,331,331,333,331,331,329,284,284,331,331,
+331,331,331,357,331,331,331,335,331,331,331,331,331,331,331,331,331,331,352,331,331,331,331,333,331,331,333,331,331,329,
+284,284,331,331,331,331,331,332,331,331,331,335,331,331,331,331,331,331,331,331,331,331,331,331,331,331,358,333,331,331,
+333,331,338,339,340,340,338,338,338,338,338,317,338,338,338,341,338,338,338,338,338,338,338,338,338,338,338,338,338,338,
+338,342,338,338,342,338,242,242,242,242,242,242,242,242,242,0,242,242,242,242,242,242,242,242,242,242,242,242,242,242,
+242,242,242,242,242,242,242,242,242,242,316,314,263,263,316,316,316,316,316,317,316,316,316,336,316,316,316,316,316,316,
+316,316,359,316,316,316,316,316,316,318,316,316,318,316,299,297,248,248,299,299,299,299,299,300,299,299,299,321,299,299,
+299,299,299,299,360,299,299,299,299,299,299,299,299,301,299,299,301,299,347,348,349,349,347,347,347,347,347,332,347,347,
+347,350,347,347,347,347,347,347,347,347,347,347,347,347,347,347,347,351,347,347,351,347,331,329,284,284,331,331,331,331,
+331,332,331,331,331,335,331,331,331,331,331,331,331,331,361,331,331,331,331,331,331,333,331,331,333,331,316,314,263,263,
+316,316,316,316,316,317,316,316,316,336,316,316,316,316,316,316,362,316,316,316,316,316,316,316,316,318,316,316,318,316,
+299,297,248,248,299,299,299,299,299,300,299,299,299,321,299,299,299,299,299,299,299,299,299,299,299,299,299,363,299,301,
+299,299,301,299,331,329,284,284,331,331,331,331,331,332,331,331,331,335,331,331,331,331,331,331,364,331,331,331,331,331,
+331,331,331,333,331,331,333,331,316,314,263,263,316,316,316,316,316,317,316,316,316,336,316,316,316,316,316,316,316,316,
+316,316,316,316,316,365,316,318,316,316,318,316,299,297,248,248,299,299,299,299,299,300,299,299,299,321,299,299,299,299,
+299,299,299,299,299,299,366,299,299,299,299,301,299,299,301,299,331,329,284,284,331,331,331,331,331,332,331,331,331,335,
+331,331,331,331,331,331,331,331,331,331,331,331,331,367,331,333,331,331,333,331,316,314,263,263,316,316,316,316,316,317,
+316,316,316,336,316,316,316,316,316,316,316,316,316,316,368,316,316,316,316,318,316,316,318,316,299,297,248,248,299,299,
+299,299,299,300,299,299,299,321,299,299,299,299,299,299,299,299,299,299,299,299,299,299,299,301,299,299,301,299,331,329,
+284,284,331,331,331,331,331,332,331,331,331,335,331,331,331,331,331,331,331,331,331,331,369,331,331,331,331,333,331,331,
+333,331,316,314,263,263,316,316,316,316,316,317,316,316,316,336,316,316,316,316,316,316,316,316,316,316,316,316,316,316,
+316,318,316,316,318,316,331,329,284,284,331,331,331,331,331,332,331,331,331,335,331,331,331,331,331,331,331,331,331,331,
+331,331,331,331,331,333,331,331,333,331,
+};
+static const short yy_acc[370] = {0,0,12,0,0,11,0,0,0,0,0,0,56,1,1,56,56,56,56,56,57,66,59,65,65,65,65,65,65,66,45,19,9,12,6,5,5,6,47,51,16,11,22,38,28,28,22,27,42,44,42,48,24,31,32,31,53,55,57,1,54,60,2,40,39,58,59,60,63,8,65,20,18,52,15,9,9,10,7,4,3,50,16,16,17,22,22,23,26,34,33,33,34,35,41,43,48,48,48,24,24,24,24,33,33,1,1,2,40,60,61,62,64,21,46,9,10,14,9,3,13,16,17,16,22,23,37,22,33,33,36,35,43,48,48,24,24,24,24,33,33,9,9,9,9,16,16,16,16,22,22,22,22,33,33,36,35,48,48,48,48,48,24,24,24,24,24,24,33,33,9,9,9,9,9,16,16,16,16,16,22,22,22,22,22,33,33,48,48,48,24,24,24,24,24,24,24,24,33,33,9,16,22,33,29,48,48,24,24,24,24,33,30,33,48,48,24,24,24,33,33,48,48,24,24,24,33,33,48,48,48,48,24,24,24,24,24,33,29,48,48,48,24,24,24,24,30,48,48,48,48,48,48,48,48,49,25,24,24,24,24,24,24,24,24,24,48,48,48,48,48,48,48,48,48,48,48,48,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,48,48,48,48,48,48,48,48,48,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,25,48,48,48,48,48,48,48,48,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,48,48,24,24,24,24,24,24,24,24,24,24,48,24,24,24,48,24,24,48,24,24,48,24,24,24};
+static const short yy_starts[22] = {1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11};
+int yylex(YYSTYPE *yylval_param, YYLTYPE *yylloc_param, yyscan_t yyscanner)
+{
+	struct yyguts_t *yyg = (struct yyguts_t *) yyscanner;
+	char *yy_cp, *yy_bp, *yy_end, *yy_last;
+	int yy_state, yy_rule;
+	yylval = yylval_param;
+	yylloc = yylloc_param;
+	if (yyg->cur == NULL)
+		YY_FATAL_ERROR("no input buffer");
+	for (;;)
+	{
+		*yyg->c_buf_p = yyg->hold_char;
+		yy_cp = yy_bp = yyg->c_buf_p;
+		yy_end = yyg->cur->end;
+		if (yy_cp >= yy_end)
+		{
+			yytext = yy_cp;
+			yyleng = 0;
+			switch (YY_START)
+			{
+				case xc:
+{
+{ yyerror("unterminated /* comment"); }
+}
+				break;
+				case xb:
+{
+{ yyerror("unterminated bit string literal"); }
+}
+				break;
+				case xh:
+{
+{ yyerror("unterminated hexadecimal string literal"); }
+}
+				break;
+				case xeu:
+{
+{ yyerror("invalid Unicode surrogate pair"); }
+}
+				break;
+				case xq:
+				case xe:
+				case xus:
+{
+{ yyerror("unterminated quoted string"); }
+}
+				break;
+				case xdolq:
+{
+{ yyerror("unterminated dollar-quoted string"); }
+}
+				break;
+				case xd:
+				case xui:
+{
+{ yyerror("unterminated quoted identifier"); }
+}
+				break;
+				case INITIAL:
+{
+{
+					SET_YYLLOC();
+					yyterminate();
+				}
+}
+				break;
+				default:
+					yyterminate();
+			}
+			continue;
+		}
+		yy_state = yy_starts[YY_START * 2 + (yyg->at_bol ? 1 : 0)];
+		yy_rule = 0;
+		yy_last = yy_cp;
+		while (yy_cp < yy_end)
+		{
+			yy_state = yy_nxt[yy_state * YY_NCLASSES + yy_ec[(unsigned char) *yy_cp]];
+			if (yy_state == 0)
+				break;
+			yy_cp++;
+			if (yy_acc[yy_state])
+			{
+				yy_rule = yy_acc[yy_state];
+				yy_last = yy_cp;
+			}
+		}
+		if (yy_rule == 0)
+			YY_FATAL_ERROR("flex scanner jammed");
+		yy_cp = yy_last;
+		yytext = yy_bp;
+		yyleng = (int) (yy_cp - yy_bp);
+		yyg->hold_char = *yy_cp;
+		*yy_cp = 0;
+		yyg->c_buf_p = yy_cp;
+		switch (yy_rule)
+		{
+case 1:
+YY_RULE_SETUP
+{
+{
+					/* ignore */
+				}
+}
+	YY_BREAK
+case 2:
+YY_RULE_SETUP
+{
+{
+					/* Set location in case of syntax error in comment */
+					SET_YYLLOC();
+					yyextra->xcdepth = 0;
+					BEGIN(xc);
+					/* Put back any characters past slash-star; see above */
+					yyless(2);
+				}
+}
+	YY_BREAK
+case 3:
+YY_RULE_SETUP
+{
+{
+					(yyextra->xcdepth)++;
+					/* Put back any characters past slash-star; see above */
+					yyless(2);
+				}
+}
+	YY_BREAK
+case 4:
+YY_RULE_SETUP
+{
+{
+					if (yyextra->xcdepth <= 0)
+						BEGIN(INITIAL);
+					else
+						(yyextra->xcdepth)--;
+				}
+}
+	YY_BREAK
+case 5:
+YY_RULE_SETUP
+{
+{
+					/* ignore */
+				}
+}
+	YY_BREAK
+case 6:
+YY_RULE_SETUP
+{
+{
+					/* ignore */
+				}
+}
+	YY_BREAK
+case 7:
+YY_RULE_SETUP
+{
+{
+					/* ignore */
+				}
+}
+	YY_BREAK
+case 8:
+YY_RULE_SETUP
+{
+{
+					/* Binary bit type.
+					 * At some point we should simply pass the string
+					 * forward to the parser and label it there.
+					 * In the meantime, place a leading "b" on the string
+					 * to mark it for the input routine as a binary string.
+					 */
+					SET_YYLLOC();
+					BEGIN(xb);
+					startlit();
+					addlitchar('b', yyscanner);
+				}
+}
+	YY_BREAK
+case 9:
+case 10:
+YY_RULE_SETUP
+{
+{
+					yyless(1);
+					BEGIN(INITIAL);
+					yylval->str = litbufdup(yyscanner);
+					return BCONST;
+				}
+}
+	YY_BREAK
+case 11:
+case 12:
+YY_RULE_SETUP
+{
+{
+					addlit(yytext, yyleng, yyscanner);
+				}
+}
+	YY_BREAK
+case 13:
+case 14:
+YY_RULE_SETUP
+{
+{
+					/* ignore */
+				}
+}
+	YY_BREAK
+case 15:
+YY_RULE_SETUP
+{
+{
+					/* Hexadecimal bit type.
+					 * At some point we should simply pass the string
+					 * forward to the parser and label it there.
+					 * In the meantime, place a leading "x" on the string
+					 * to mark it for the input routine as a hex string.
+					 */
+					SET_YYLLOC();
+					BEGIN(xh);
+					startlit();
+					addlitchar('x', yyscanner);
+				}
+}
+	YY_BREAK
+case 16:
+case 17:
+YY_RULE_SETUP
+{
+{
+					yyless(1);
+					BEGIN(INITIAL);
+					yylval->str = litbufdup(yyscanner);
+					return XCONST;
+				}
+}
+	YY_BREAK
+case 18:
+YY_RULE_SETUP
+{
+{
+					/* National character.
+					 * We will pass this along as a normal character string,
+					 * but preceded with an internally-generated "NCHAR".
+					 */
+					const ScanKeyword *keyword;
+
+					SET_YYLLOC();
+					yyless(1);				/* eat only 'n' this time */
+
+					keyword = ScanKeywordLookup("nchar",
+												yyextra->keywords,
+												yyextra->num_keywords);
+					if (keyword != NULL)
+					{
+						yylval->keyword = keyword->name;
+						return keyword->value;
+					}
+					else
+					{
+						/* If NCHAR isn't a keyword, just return "n" */
+						yylval->str = pstrdup("n");
+						return IDENT;
+					}
+				}
+}
+	YY_BREAK
+case 19:
+YY_RULE_SETUP
+{
+{
+					yyextra->warn_on_first_escape = true;
+					yyextra->saw_non_ascii = false;
+					SET_YYLLOC();
+					if (standard_conforming_strings)
+						BEGIN(xq);
+					else
+						BEGIN(xe);
+					startlit();
+				}
+}
+	YY_BREAK
+case 20:
+YY_RULE_SETUP
+{
+{
+					yyextra->warn_on_first_escape = false;
+					yyextra->saw_non_ascii = false;
+					SET_YYLLOC();
+					BEGIN(xe);
+					startlit();
+				}
+}
+	YY_BREAK
+case 21:
+YY_RULE_SETUP
+{
+{
+					SET_YYLLOC();
+					if (!standard_conforming_strings)
+						ereport(ERROR,
+								(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+								 errmsg("unsafe use of string constant with Unicode escapes"),
+								 errdetail("String constants with Unicode escapes cannot be used when standard_conforming_strings is off."),
+								 lexer_errposition()));
+					BEGIN(xus);
+					startlit();
+				}
+}
+	YY_BREAK
+case 22:
+case 23:
+YY_RULE_SETUP
+{
+{
+					yyless(1);
+					BEGIN(INITIAL);
+					/*
+					 * check that the data remains valid if it might have been
+					 * made invalid by unescaping any chars.
+					 */
+					if (yyextra->saw_non_ascii)
+						pg_verifymbstr(yyextra->literalbuf,
+									   yyextra->literallen,
+									   false);
+					yylval->str = litbufdup(yyscanner);
+					return SCONST;
+				}
+}
+	YY_BREAK
+case 24:
+YY_RULE_SETUP
+{
+{
+					/* throw back all but the quote */
+					yyless(1);
+					BEGIN(INITIAL);
+					yylval->str = litbuf_udeescape('\\', yyscanner);
+					return SCONST;
+				}
+}
+	YY_BREAK
+case 25:
+YY_RULE_SETUP
+{
+{
+					BEGIN(INITIAL);
+					yylval->str = litbuf_udeescape(yytext[yyleng-2], yyscanner);
+					return SCONST;
+				}
+}
+	YY_BREAK
+case 26:
+YY_RULE_SETUP
+{
+{
+					addlitchar('\'', yyscanner);
+				}
+}
+	YY_BREAK
+case 27:
+YY_RULE_SETUP
+{
+{
+					addlit(yytext, yyleng, yyscanner);
+				}
+}
+	YY_BREAK
+case 28:
+YY_RULE_SETUP
+{
+{
+					addlit(yytext, yyleng, yyscanner);
+				}
+}
+	YY_BREAK
+case 29:
+YY_RULE_SETUP
+{
+{
+					pg_wchar c = strtoul(yytext+2, NULL, 16);
+
+					check_escape_warning(yyscanner);
+
+					if (is_utf16_surrogate_first(c))
+					{
+						yyextra->utf16_first_part = c;
+						BEGIN(xeu);
+					}
+					else if (is_utf16_surrogate_second(c))
+						yyerror("invalid Unicode surrogate pair");
+					else
+						addunicode(c, yyscanner);
+				}
+}
+	YY_BREAK
+case 30:
+YY_RULE_SETUP
+{
+{
+					pg_wchar c = strtoul(yytext+2, NULL, 16);
+
+					if (!is_utf16_surrogate_second(c))
+						yyerror("invalid Unicode surrogate pair");
+
+					c = surrogate_pair_to_codepoint(yyextra->utf16_first_part, c);
+
+					addunicode(c, yyscanner);
+
+					BEGIN(xe);
+				}
+}
+	YY_BREAK
+case 31:
+YY_RULE_SETUP
+{
+{ yyerror("invalid Unicode surrogate pair"); }
+}
+	YY_BREAK
+case 32:
+YY_RULE_SETUP
+{
+{ yyerror("invalid Unicode surrogate pair"); }
+}
+	YY_BREAK
+case 33:
+YY_RULE_SETUP
+{
+{
+						ereport(ERROR,
+								(errcode(ERRCODE_INVALID_ESCAPE_SEQUENCE),
+								 errmsg("invalid Unicode escape"),
+								 errhint("Unicode escapes must be \\uXXXX or \\UXXXXXXXX."),
+								 lexer_errposition()));
+				}
+}
+	YY_BREAK
+case 34:
+YY_RULE_SETUP
+{
+{
+					if (yytext[1] == '\'')
+					{
+						if (backslash_quote == BACKSLASH_QUOTE_OFF ||
+							(backslash_quote == BACKSLASH_QUOTE_SAFE_ENCODING &&
+							 PG_ENCODING_IS_CLIENT_ONLY(pg_get_client_encoding())))
+							ereport(ERROR,
+									(errcode(ERRCODE_NONSTANDARD_USE_OF_ESCAPE_CHARACTER),
+									 errmsg("unsafe use of \\' in a string literal"),
+									 errhint("Use '' to write quotes in strings. \\' is insecure in client-only encodings."),
+									 lexer_errposition()));
+					}
+					check_string_escape_warning(yytext[1], yyscanner);
+					addlitchar(unescape_single_char(yytext[1], yyscanner),
+							   yyscanner);
+				}
+}
+	YY_BREAK
+case 35:
+YY_RULE_SETUP
+{
+{
+					unsigned char c = strtoul(yytext+1, NULL, 8);
+
+					check_escape_warning(yyscanner);
+					addlitchar(c, yyscanner);
+					if (c == '\0' || IS_HIGHBIT_SET(c))
+						yyextra->saw_non_ascii = true;
+				}
+}
+	YY_BREAK
+case 36:
+YY_RULE_SETUP
+{
+{
+					unsigned char c = strtoul(yytext+2, NULL, 16);
+
+					check_escape_warning(yyscanner);
+					addlitchar(c, yyscanner);
+					if (c == '\0' || IS_HIGHBIT_SET(c))
+						yyextra->saw_non_ascii = true;
+				}
+}
+	YY_BREAK
+case 37:
+YY_RULE_SETUP
+{
+{
+					/* ignore */
+				}
+}
+	YY_BREAK
+case 38:
+YY_RULE_SETUP
+{
+{
+					/* This is only needed for \ just before EOF */
+					addlitchar(yytext[0], yyscanner);
+				}
+}
+	YY_BREAK
+case 39:
+YY_RULE_SETUP
+{
+{
+					SET_YYLLOC();
+					yyextra->dolqstart = pstrdup(yytext);
+					BEGIN(xdolq);
+					startlit();
+				}
+}
+	YY_BREAK
+case 40:
+YY_RULE_SETUP
+{
+{
+					SET_YYLLOC();
+					/* throw back all but the initial "$" */
+					yyless(1);
+					/* and treat it as {other} */
+					return yytext[0];
+				}
+}
+	YY_BREAK
+case 41:
+YY_RULE_SETUP
+{
+{
+					if (strcmp(yytext, yyextra->dolqstart) == 0)
+					{
+						pfree(yyextra->dolqstart);
+						yyextra->dolqstart = NULL;
+						BEGIN(INITIAL);
+						yylval->str = litbufdup(yyscanner);
+						return SCONST;
+					}
+					else
+					{
+						/*
+						 * When we fail to match $...$ to dolqstart, transfer
+						 * the $... part to the output, but put back the final
+						 * $ for rescanning.  Consider $delim$...$junk$delim$
+						 */
+						addlit(yytext, yyleng-1, yyscanner);
+						yyless(yyleng-1);
+					}
+				}
+}
+	YY_BREAK
+case 42:
+YY_RULE_SETUP
+{
+{
+					addlit(yytext, yyleng, yyscanner);
+				}
+}
+	YY_BREAK
+case 43:
+YY_RULE_SETUP
+{
+{
+					addlit(yytext, yyleng, yyscanner);
+				}
+}
+	YY_BREAK
+case 44:
+YY_RULE_SETUP
+{
+{
+					/* This is only needed for $ inside the quoted text */
+					addlitchar(yytext[0], yyscanner);
+				}
+}
+	YY_BREAK
+case 45:
+YY_RULE_SETUP
+{
+{
+					SET_YYLLOC();
+					BEGIN(xd);
+					startlit();
+				}
+}
+	YY_BREAK
+case 46:
+YY_RULE_SETUP
+{
+{
+					SET_YYLLOC();
+					BEGIN(xui);
+					startlit();
+				}
+}
+	YY_BREAK
+case 47:
+YY_RULE_SETUP
+{
+{
+					char		   *ident;
+
+					BEGIN(INITIAL);
+					if (yyextra->literallen == 0)
+						yyerror("zero-length delimited identifier");
+					ident = litbufdup(yyscanner);
+					if (yyextra->literallen >= NAMEDATALEN)
+						truncate_identifier(ident, yyextra->literallen, true);
+					yylval->str = ident;
+					return IDENT;
+				}
+}
+	YY_BREAK
+case 48:
+YY_RULE_SETUP
+{
+{
+					char		   *ident;
+
+					BEGIN(INITIAL);
+					if (yyextra->literallen == 0)
+						yyerror("zero-length delimited identifier");
+					ident = litbuf_udeescape('\\', yyscanner);
+					if (yyextra->literallen >= NAMEDATALEN)
+						truncate_identifier(ident, yyextra->literallen, true);
+					yylval->str = ident;
+					/* throw back all but the quote */
+					yyless(1);
+					return IDENT;
+				}
+}
+	YY_BREAK
+case 49:
+YY_RULE_SETUP
+{
+{
+					char		   *ident;
+
+					BEGIN(INITIAL);
+					if (yyextra->literallen == 0)
+						yyerror("zero-length delimited identifier");
+					ident = litbuf_udeescape(yytext[yyleng - 2], yyscanner);
+					if (yyextra->literallen >= NAMEDATALEN)
+						truncate_identifier(ident, yyextra->literallen, true);
+					yylval->str = ident;
+					return IDENT;
+				}
+}
+	YY_BREAK
+case 50:
+YY_RULE_SETUP
+{
+{
+					addlitchar('"', yyscanner);
+				}
+}
+	YY_BREAK
+case 51:
+YY_RULE_SETUP
+{
+{
+					addlit(yytext, yyleng, yyscanner);
+				}
+}
+	YY_BREAK
+case 52:
+YY_RULE_SETUP
+{
+{
+					char		   *ident;
+
+					SET_YYLLOC();
+					/* throw back all but the initial u/U */
+					yyless(1);
+					/* and treat it as {identifier} */
+					ident = downcase_truncate_identifier(yytext, yyleng, true);
+					yylval->str = ident;
+					return IDENT;
+				}
+}
+	YY_BREAK
+case 53:
+YY_RULE_SETUP
+{
+{
+					SET_YYLLOC();
+					return TYPECAST;
+				}
+}
+	YY_BREAK
+case 54:
+YY_RULE_SETUP
+{
+{
+					SET_YYLLOC();
+					return DOT_DOT;
+				}
+}
+	YY_BREAK
+case 55:
+YY_RULE_SETUP
+{
+{
+					SET_YYLLOC();
+					return COLON_EQUALS;
+				}
+}
+	YY_BREAK
+case 56:
+YY_RULE_SETUP
+{
+{
+					SET_YYLLOC();
+					return yytext[0];
+				}
+}
+	YY_BREAK
+case 57:
+YY_RULE_SETUP
+{
+{
+					/*
+					 * Check for embedded slash-star or dash-dash; those
+					 * are comment starts, so operator must stop there.
+					 * Note that slash-star or dash-dash at the first
+					 * character will match a prior rule, not this one.
+					 */
+					int		nchars = yyleng;
+					char   *slashstar = strstr(yytext, "/*");
+					char   *dashdash = strstr(yytext, "--");
+
+					if (slashstar && dashdash)
+					{
+						/* if both appear, take the first one */
+						if (slashstar > dashdash)
+							slashstar = dashdash;
+					}
+					else if (!slashstar)
+						slashstar = dashdash;
+					if (slashstar)
+						nchars = slashstar - yytext;
+
+					/*
+					 * For SQL compatibility, '+' and '-' cannot be the
+					 * last char of a multi-char operator unless the operator
+					 * contains chars that are not in SQL operators.
+					 * The idea is to lex '=-' as two operators, but not
+					 * to forbid operator names like '?-' that could not be
+					 * sequences of SQL operators.
+					 */
+					while (nchars > 1 &&
+						   (yytext[nchars-1] == '+' ||
+							yytext[nchars-1] == '-'))
+					{
+						int		ic;
+
+						for (ic = nchars-2; ic >= 0; ic--)
+						{
+							if (strchr("~!@#^&|`?%", yytext[ic]))
+								break;
+						}
+						if (ic >= 0)
+							break; /* found a char that makes it OK */
+						nchars--; /* else remove the +/-, and check again */
+					}
+
+					SET_YYLLOC();
+
+					if (nchars < yyleng)
+					{
+						/* Strip the unwanted chars from the token */
+						yyless(nchars);
+						/*
+						 * If what we have left is only one char, and it's
+						 * one of the characters matching "self", then
+						 * return it as a character token the same way
+						 * that the "self" rule would have.
+						 */
+						if (nchars == 1 &&
+							strchr(",()[].;:+-*/%^<>=", yytext[0]))
+							return yytext[0];
+					}
+
+					/*
+					 * Complain if operator is too long.  Unlike the case
+					 * for identifiers, we make this an error not a notice-
+					 * and-truncate, because the odds are we are looking at
+					 * a syntactic mistake anyway.
+					 */
+					if (nchars >= NAMEDATALEN)
+						yyerror("operator too long");
+
+					/* Convert "!=" operator to "<>" for compatibility */
+					if (strcmp(yytext, "!=") == 0)
+						yylval->str = pstrdup("<>");
+					else
+						yylval->str = pstrdup(yytext);
+					return Op;
+				}
+}
+	YY_BREAK
+case 58:
+YY_RULE_SETUP
+{
+{
+					SET_YYLLOC();
+					yylval->ival = atol(yytext + 1);
+					return PARAM;
+				}
+}
+	YY_BREAK
+case 59:
+YY_RULE_SETUP
+{
+{
+					SET_YYLLOC();
+					return process_integer_literal(yytext, yylval);
+				}
+}
+	YY_BREAK
+case 60:
+YY_RULE_SETUP
+{
+{
+					SET_YYLLOC();
+					yylval->str = pstrdup(yytext);
+					return FCONST;
+				}
+}
+	YY_BREAK
+case 61:
+YY_RULE_SETUP
+{
+{
+					/* throw back the .., and treat as integer */
+					yyless(yyleng-2);
+					SET_YYLLOC();
+					return process_integer_literal(yytext, yylval);
+				}
+}
+	YY_BREAK
+case 62:
+YY_RULE_SETUP
+{
+{
+					SET_YYLLOC();
+					yylval->str = pstrdup(yytext);
+					return FCONST;
+				}
+}
+	YY_BREAK
+case 63:
+YY_RULE_SETUP
+{
+{
+					/*
+					 * throw back the [Ee], and treat as {decimal}.  Note
+					 * that it is possible the input is actually {integer},
+					 * but since this case will almost certainly lead to a
+					 * syntax error anyway, we don't bother to distinguish.
+					 */
+					yyless(yyleng-1);
+					SET_YYLLOC();
+					yylval->str = pstrdup(yytext);
+					return FCONST;
+				}
+}
+	YY_BREAK
+case 64:
+YY_RULE_SETUP
+{
+{
+					/* throw back the [Ee][+-], and proceed as above */
+					yyless(yyleng-2);
+					SET_YYLLOC();
+					yylval->str = pstrdup(yytext);
+					return FCONST;
+				}
+}
+	YY_BREAK
+case 65:
+YY_RULE_SETUP
+{
+{
+					const ScanKeyword *keyword;
+					char		   *ident;
+
+					SET_YYLLOC();
+
+					/* Is it a keyword? */
+					keyword = ScanKeywordLookup(yytext,
+												yyextra->keywords,
+												yyextra->num_keywords);
+					if (keyword != NULL)
+					{
+						yylval->keyword = keyword->name;
+						return keyword->value;
+					}
+
+					/*
+					 * No.  Convert the identifier to lower case, and truncate
+					 * if necessary.
+					 */
+					ident = downcase_truncate_identifier(yytext, yyleng, true);
+					yylval->str = ident;
+					return IDENT;
+				}
+}
+	YY_BREAK
+case 66:
+YY_RULE_SETUP
+{
+{
+					SET_YYLLOC();
+					return yytext[0];
+				}
+}
+	YY_BREAK
+			default:
+				YY_FATAL_ERROR("bad rule");
+		}
+	}
+}
+static void yy_fatal_error(const char *msg, yyscan_t yyscanner)
+{
+	(void) fprintf(stderr, "%s\n", msg);
+	exit(YY_EXIT_FAILURE);
+}
+static void yy_save_state(struct yyguts_t *g)
+{
+	if (g->cur)
+	{
+		*g->c_buf_p = g->hold_char;
+		g->cur->pos = g->c_buf_p;
+		g->cur->at_bol = g->at_bol;
+	}
+}
+void yy_switch_to_buffer(YY_BUFFER_STATE b, yyscan_t yyscanner)
+{
+	struct yyguts_t *yyg = (struct yyguts_t *) yyscanner;
+	yy_save_state(yyg);
+	yyg->cur = b;
+	if (b)
+	{
+		yyg->c_buf_p = b->pos;
+		yyg->hold_char = *b->pos;
+		yyg->at_bol = b->at_bol;
+	}
+}
+static YY_BUFFER_STATE yy_new_buffer(char *base, yy_size_t len, int owns, yyscan_t yyscanner)
+{
+	YY_BUFFER_STATE b = (YY_BUFFER_STATE) yyalloc(sizeof(struct yy_buffer_state), yyscanner);
+	if (!b)
+		YY_FATAL_ERROR("out of dynamic memory");
+	b->base = base;
+	b->end = base + len;
+	b->pos = base;
+	b->at_bol = 1;
+	b->owns = owns;
+	return b;
+}
+YY_BUFFER_STATE yy_scan_buffer(char *base, yy_size_t size, yyscan_t yyscanner)
+{
+	YY_BUFFER_STATE b;
+	if (size < 2 || base[size - 2] != YY_END_OF_BUFFER_CHAR || base[size - 1] != YY_END_OF_BUFFER_CHAR)
+		return NULL;
+	b = yy_new_buffer(base, size - 2, 0, yyscanner);
+	yy_switch_to_buffer(b, yyscanner);
+	return b;
+}
+YY_BUFFER_STATE yy_scan_bytes(const char *bytes, int len, yyscan_t yyscanner)
+{
+	char *buf = (char *) yyalloc(len + 2, yyscanner);
+	YY_BUFFER_STATE b;
+	if (!buf)
+		YY_FATAL_ERROR("out of dynamic memory");
+	memcpy(buf, bytes, len);
+	buf[len] = buf[len + 1] = YY_END_OF_BUFFER_CHAR;
+	b = yy_scan_buffer(buf, len + 2, yyscanner);
+	b->owns = 1;
+	return b;
+}
+YY_BUFFER_STATE yy_scan_string(const char *str, yyscan_t yyscanner)
+{
+	return yy_scan_bytes(str, (int) strlen(str), yyscanner);
+}
+YY_BUFFER_STATE yy_create_buffer(FILE *file, int size, yyscan_t yyscanner)
+{
+	yy_size_t cap = 8192, len = 0, n;
+	char *buf = (char *) yyalloc(cap, yyscanner);
+	(void) size;
+	if (!buf)
+		YY_FATAL_ERROR("out of dynamic memory");
+	while ((n = fread(buf + len, 1, cap - len - 2, file)) > 0)
+	{
+		len += n;
+		if (cap - len - 2 == 0)
+		{
+			cap *= 2;
+			buf = (char *) yyrealloc(buf, cap, yyscanner);
+			if (!buf)
+				YY_FATAL_ERROR("out of dynamic memory");
+		}
+	}
+	buf[len] = buf[len + 1] = YY_END_OF_BUFFER_CHAR;
+	return yy_new_buffer(buf, len, 1, yyscanner);
+}
+void yyrestart(FILE *file, yyscan_t yyscanner)
+{
+	yy_switch_to_buffer(yy_create_buffer(file, YY_BUF_SIZE, yyscanner), yyscanner);
+}
+void yy_delete_buffer(YY_BUFFER_STATE b, yyscan_t yyscanner)
+{
+	struct yyguts_t *yyg = (struct yyguts_t *) yyscanner;
+	if (!b)
+		return;
+	if (b == yyg->cur)
+		yyg->cur = NULL;
+	if (b->owns)
+		yyfree(b->base, yyscanner);
+	yyfree(b, yyscanner);
+}
+int yylex_init(yyscan_t *ptr)
+{
+	struct yyguts_t *g = (struct yyguts_t *) yyalloc(sizeof(struct yyguts_t), NULL);
+	if (!g)
+	{
+		errno = ENOMEM;
+		return 1;
+	}
+	memset(g, 0, sizeof(struct yyguts_t));
+	*ptr = g;
+	return 0;
+}
+int yylex_destroy(yyscan_t yyscanner)
+{
+	struct yyguts_t *yyg = (struct yyguts_t *) yyscanner;
+	if (yyg->cur)
+		yy_delete_buffer(yyg->cur, yyscanner);
+	yyfree(yyscanner, yyscanner);
+	return 0;
+}
+YY_EXTRA_TYPE yyget_extra(yyscan_t yyscanner)
+{
+	struct yyguts_t *yyg = (struct yyguts_t *) yyscanner;
+	return yyextra;
+}
+void yyset_extra(YY_EXTRA_TYPE e, yyscan_t yyscanner)
+{
+	struct yyguts_t *yyg = (struct yyguts_t *) yyscanner;
+	yyextra = e;
+}
+
+
+/*
+ * Arrange access to yyextra for subroutines of the main yylex() function.
+ * We expect each subroutine to have a yyscanner parameter.  Rather than
+ * use the yyget_xxx functions, which might or might not get inlined by the
+ * compiler, we cheat just a bit and cast yyscanner to the right type.
+ */
+#undef yyextra
+#define yyextra  (((struct yyguts_t *) yyscanner)->yyextra_r)
+
+/* Likewise for a couple of other things we need. */
+#undef yylloc
+#define yylloc  (((struct yyguts_t *) yyscanner)->yylloc_r)
+#undef yyleng
+#define yyleng  (((struct yyguts_t *) yyscanner)->yyleng_r)
+
+
+/*
+ * scanner_errposition
+ *		Report a lexer or grammar error cursor position, if possible.
+ *
+ * This is expected to be used within an ereport() call.  The return value
+ * is a dummy (always 0, in fact).
+ *
+ * Note that this can only be used for messages emitted during raw parsing
+ * (essentially, scan.l and gram.y), since it requires the yyscanner struct
+ * to still be available.
+ */
+int
+scanner_errposition(int location, core_yyscan_t yyscanner)
+{
+	int		pos;
+
+	if (location < 0)
+		return 0;				/* no-op if location is unknown */
+
+	/* Convert byte offset to character number */
+	pos = pg_mbstrlen_with_len(yyextra->scanbuf, location) + 1;
+	/* And pass it to the ereport mechanism */
+	return errposition(pos);
+}
+
+/*
+ * scanner_yyerror
+ *		Report a lexer or grammar error.
+ *
+ * The message's cursor position is whatever YYLLOC was last set to,
+ * ie, the start of the current token if called within yylex(), or the
+ * most recently lexed token if called from the grammar.
+ * This is OK for syntax error messages from the Bison parser, because Bison
+ * parsers report error as soon as the first unparsable token is reached.
+ * Beware of using yyerror for other purposes, as the cursor position might
+ * be misleading!
+ */
+void
+scanner_yyerror(const char *message, core_yyscan_t yyscanner)
+{
+	const char *loc = yyextra->scanbuf + *yylloc;
+
+	if (*loc == YY_END_OF_BUFFER_CHAR)
+	{
+		ereport(ERROR,
+				(errcode(ERRCODE_SYNTAX_ERROR),
+				 /* translator: %s is typically the translation of "syntax error" */
+				 errmsg("%s at end of input", _(message)),
+				 lexer_errposition()));
+	}
+	else
+	{
+		ereport(ERROR,
+				(errcode(ERRCODE_SYNTAX_ERROR),
+				 /* translator: first %s is typically the translation of "syntax error" */
+				 errmsg("%s at or near \"%s\"", _(message), loc),
+				 lexer_errposition()));
+	}
+}
+
+
+/*
+ * Called before any actual parsing is done
+ */
+core_yyscan_t
+scanner_init(const char *str,
+			 core_yy_extra_type *yyext,
+			 const ScanKeyword *keywords,
+			 int num_keywords)
+{
+	Size		slen = strlen(str);
+	yyscan_t	scanner;
+
+	if (yylex_init(&scanner) != 0)
+		elog(ERROR, "yylex_init() failed: %m");
+
+	core_yyset_extra(yyext, scanner);
+
+	yyext->keywords = keywords;
+	yyext->num_keywords = num_keywords;
+
+	/*
+	 * Make a scan buffer with special termination needed by flex.
+	 */
+	yyext->scanbuf = (char *) palloc(slen + 2);
+	yyext->scanbuflen = slen;
+	memcpy(yyext->scanbuf, str, slen);
+	yyext->scanbuf[slen] = yyext->scanbuf[slen + 1] = YY_END_OF_BUFFER_CHAR;
+	yy_scan_buffer(yyext->scanbuf, slen + 2, scanner);
+
+	/* initialize literal buffer to a reasonable but expansible size */
+	yyext->literalalloc = 1024;
+	yyext->literalbuf = (char *) palloc(yyext->literalalloc);
+	yyext->literallen = 0;
+
+	return scanner;
+}
+
+
+/*
+ * Called after parsing is done to clean up after scanner_init()
+ */
+void
+scanner_finish(core_yyscan_t yyscanner)
+{
+	/*
+	 * We don't bother to call yylex_destroy(), because all it would do
+	 * is pfree a small amount of control storage.  It's cheaper to leak
+	 * the storage until the parsing context is destroyed.  The amount of
+	 * space involved is usually negligible compared to the output parse
+	 * tree anyway.
+	 *
+	 * We do bother to pfree the scanbuf and literal buffer, but only if they
+	 * represent a nontrivial amount of space.  The 8K cutoff is arbitrary.
+	 */
+	if (yyextra->scanbuflen >= 8192)
+		pfree(yyextra->scanbuf);
+	if (yyextra->literalalloc >= 8192)
+		pfree(yyextra->literalbuf);
+}
+
+
+static void
+addlit(char *ytext, int yleng, core_yyscan_t yyscanner)
+{
+	/* enlarge buffer if needed */
+	if ((yyextra->literallen + yleng) >= yyextra->literalalloc)
+	{
+		do {
+			yyextra->literalalloc *= 2;
+		} while ((yyextra->literallen + yleng) >= yyextra->literalalloc);
+		yyextra->literalbuf = (char *) repalloc(yyextra->literalbuf,
+												yyextra->literalalloc);
+	}
+	/* append new data */
+	memcpy(yyextra->literalbuf + yyextra->literallen, ytext, yleng);
+	yyextra->literallen += yleng;
+}
+
+
+static void
+addlitchar(unsigned char ychar, core_yyscan_t yyscanner)
+{
+	/* enlarge buffer if needed */
+	if ((yyextra->literallen + 1) >= yyextra->literalalloc)
+	{
+		yyextra->literalalloc *= 2;
+		yyextra->literalbuf = (char *) repalloc(yyextra->literalbuf,
+												yyextra->literalalloc);
+	}
+	/* append new data */
+	yyextra->literalbuf[yyextra->literallen] = ychar;
+	yyextra->literallen += 1;
+}
+
+
+/*
+ * Create a palloc'd copy of literalbuf, adding a trailing null.
+ */
+static char *
+litbufdup(core_yyscan_t yyscanner)
+{
+	int			llen = yyextra->literallen;
+	char	   *new;
+
+	new = palloc(llen + 1);
+	memcpy(new, yyextra->literalbuf, llen);
+	new[llen] = '\0';
+	return new;
+}
+
+static int
+process_integer_literal(const char *token, YYSTYPE *lval)
+{
+	long		val;
+	char	   *endptr;
+
+	errno = 0;
+	val = strtol(token, &endptr, 10);
+	if (*endptr != '\0' || errno == ERANGE
+#ifdef HAVE_LONG_INT_64
+		/* if long > 32 bits, check for overflow of int4 */
+		|| val != (long) ((int32) val)
+#endif
+		)
+	{
+		/* integer too large, treat it as a float */
+		lval->str = pstrdup(token);
+		return FCONST;
+	}
+	lval->ival = val;
+	return ICONST;
+}
+
+static unsigned int
+hexval(unsigned char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 0xA;
+	if (c >= 'A' && c <= 'F')
+		return c - 'A' + 0xA;
+	elog(ERROR, "invalid hexadecimal digit");
+	return 0; /* not reached */
+}
+
+static void
+check_unicode_value(pg_wchar c, char *loc, core_yyscan_t yyscanner)
+{
+	if (GetDatabaseEncoding() == PG_UTF8)
+		return;
+
+	if (c > 0x7F)
+	{
+		ADVANCE_YYLLOC(loc - yyextra->literalbuf + 3);   /* 3 for U&" */
+		yyerror("Unicode escape values cannot be used for code point values above 007F when the server encoding is not UTF8");
+	}
+}
+
+static bool
+is_utf16_surrogate_first(pg_wchar c)
+{
+	return (c >= 0xD800 && c <= 0xDBFF);
+}
+
+static bool
+is_utf16_surrogate_second(pg_wchar c)
+{
+	return (c >= 0xDC00 && c <= 0xDFFF);
+}
+
+static pg_wchar
+surrogate_pair_to_codepoint(pg_wchar first, pg_wchar second)
+{
+	return ((first & 0x3FF) << 10) + 0x10000 + (second & 0x3FF);
+}
+
+static void
+addunicode(pg_wchar c, core_yyscan_t yyscanner)
+{
+	char buf[8];
+
+	if (c == 0 || c > 0x10FFFF)
+		yyerror("invalid Unicode escape value");
+	if (c > 0x7F)
+	{
+		if (GetDatabaseEncoding() != PG_UTF8)
+			yyerror("Unicode escape values cannot be used for code point values above 007F when the server encoding is not UTF8");
+		yyextra->saw_non_ascii = true;
+	}
+	unicode_to_utf8(c, (unsigned char *) buf);
+	addlit(buf, pg_mblen(buf), yyscanner);
+}
+
+static char *
+litbuf_udeescape(unsigned char escape, core_yyscan_t yyscanner)
+{
+	char *new;
+	char *litbuf, *in, *out;
+	pg_wchar pair_first = 0;
+
+	if (isxdigit(escape)
+		|| escape == '+'
+		|| escape == '\''
+		|| escape == '"'
+		|| scanner_isspace(escape))
+	{
+		ADVANCE_YYLLOC(yyextra->literallen + yyleng + 1);
+		yyerror("invalid Unicode escape character");
+	}
+
+	/* Make literalbuf null-terminated to simplify the scanning loop */
+	litbuf = yyextra->literalbuf;
+	litbuf[yyextra->literallen] = '\0';
+
+	/*
+	 * This relies on the subtle assumption that a UTF-8 expansion
+	 * cannot be longer than its escaped representation.
+	 */
+	new = palloc(yyextra->literallen + 1);
+
+	in = litbuf;
+	out = new;
+	while (*in)
+	{
+		if (in[0] == escape)
+		{
+			if (in[1] == escape)
+			{
+				if (pair_first)
+				{
+					ADVANCE_YYLLOC(in - litbuf + 3);   /* 3 for U&" */
+					yyerror("invalid Unicode surrogate pair");
+				}
+				*out++ = escape;
+				in += 2;
+			}
+			else if (isxdigit((unsigned char) in[1]) &&
+					 isxdigit((unsigned char) in[2]) &&
+					 isxdigit((unsigned char) in[3]) &&
+					 isxdigit((unsigned char) in[4]))
+			{
+				pg_wchar unicode;
+
+				unicode = (hexval(in[1]) << 12) +
+					(hexval(in[2]) << 8) +
+					(hexval(in[3]) << 4) +
+					hexval(in[4]);
+				check_unicode_value(unicode, in, yyscanner);
+				if (pair_first)
+				{
+					if (is_utf16_surrogate_second(unicode))
+					{
+						unicode = surrogate_pair_to_codepoint(pair_first, unicode);
+						pair_first = 0;
+					}
+					else
+					{
+						ADVANCE_YYLLOC(in - litbuf + 3);   /* 3 for U&" */
+						yyerror("invalid Unicode surrogate pair");
+					}
+				}
+				else if (is_utf16_surrogate_second(unicode))
+					yyerror("invalid Unicode surrogate pair");
+
+				if (is_utf16_surrogate_first(unicode))
+					pair_first = unicode;
+				else
+				{
+					unicode_to_utf8(unicode, (unsigned char *) out);
+					out += pg_mblen(out);
+				}
+				in += 5;
+			}
+			else if (in[1] == '+' &&
+					 isxdigit((unsigned char) in[2]) &&
+					 isxdigit((unsigned char) in[3]) &&
+					 isxdigit((unsigned char) in[4]) &&
+					 isxdigit((unsigned char) in[5]) &&
+					 isxdigit((unsigned char) in[6]) &&
+					 isxdigit((unsigned char) in[7]))
+			{
+				pg_wchar unicode;
+
+				unicode = (hexval(in[2]) << 20) +
+					(hexval(in[3]) << 16) +
+					(hexval(in[4]) << 12) +
+					(hexval(in[5]) << 8) +
+					(hexval(in[6]) << 4) +
+					hexval(in[7]);
+				check_unicode_value(unicode, in, yyscanner);
+				if (pair_first)
+				{
+					if (is_utf16_surrogate_second(unicode))
+					{
+						unicode = surrogate_pair_to_codepoint(pair_first, unicode);
+						pair_first = 0;
+					}
+					else
+					{
+						ADVANCE_YYLLOC(in - litbuf + 3);   /* 3 for U&" */
+						yyerror("invalid Unicode surrogate pair");
+					}
+				}
+				else if (is_utf16_surrogate_second(unicode))
+					yyerror("invalid Unicode surrogate pair");
+
+				if (is_utf16_surrogate_first(unicode))
+					pair_first = unicode;
+				else
+				{
+					unicode_to_utf8(unicode, (unsigned char *) out);
+					out += pg_mblen(out);
+				}
+				in += 8;
+			}
+			else
+			{
+				ADVANCE_YYLLOC(in - litbuf + 3);   /* 3 for U&" */
+				yyerror("invalid Unicode escape value");
+			}
+		}
+		else
+		{
+			if (pair_first)
+			{
+				ADVANCE_YYLLOC(in - litbuf + 3);   /* 3 for U&" */
+				yyerror("invalid Unicode surrogate pair");
+			}
+			*out++ = *in++;
+		}
+	}
+
+	*out = '\0';
+	/*
+	 * We could skip pg_verifymbstr if we didn't process any non-7-bit-ASCII
+	 * codes; but it's probably not worth the trouble, since this isn't
+	 * likely to be a performance-critical path.
+	 */
+	pg_verifymbstr(new, out - new, false);
+	return new;
+}
+
+static unsigned char
+unescape_single_char(unsigned char c, core_yyscan_t yyscanner)
+{
+	switch (c)
+	{
+		case 'b':
+			return '\b';
+		case 'f':
+			return '\f';
+		case 'n':
+			return '\n';
+		case 'r':
+			return '\r';
+		case 't':
+			return '\t';
+		default:
+			/* check for backslash followed by non-7-bit-ASCII */
+			if (c == '\0' || IS_HIGHBIT_SET(c))
+				yyextra->saw_non_ascii = true;
+
+			return c;
+	}
+}
+
+static void
+check_string_escape_warning(unsigned char ychar, core_yyscan_t yyscanner)
+{
+	if (ychar == '\'')
+	{
+		if (yyextra->warn_on_first_escape && escape_string_warning)
+			ereport(WARNING,
+					(errcode(ERRCODE_NONSTANDARD_USE_OF_ESCAPE_CHARACTER),
+					 errmsg("nonstandard use of \\' in a string literal"),
+					 errhint("Use '' to write quotes in strings, or use the escape string syntax (E'...')."),
+					 lexer_errposition()));
+		yyextra->warn_on_first_escape = false;	/* warn only once per string */
+	}
+	else if (ychar == '\\')
+	{
+		if (yyextra->warn_on_first_escape && escape_string_warning)
+			ereport(WARNING,
+					(errcode(ERRCODE_NONSTANDARD_USE_OF_ESCAPE_CHARACTER),
+					 errmsg("nonstandard use of \\\\ in a string literal"),
+					 errhint("Use the escape string syntax for backslashes, e.g., E'\\\\'."),
+					 lexer_errposition()));
+		yyextra->warn_on_first_escape = false;	/* warn only once per string */
+	}
+	else
+		check_escape_warning(yyscanner);
+}
+
+static void
+check_escape_warning(core_yyscan_t yyscanner)
+{
+	if (yyextra->warn_on_first_escape && escape_string_warning)
+		ereport(WARNING,
+				(errcode(ERRCODE_NONSTANDARD_USE_OF_ESCAPE_CHARACTER),
+				 errmsg("nonstandard use of escape in a string literal"),
+				 errhint("Use the escape string syntax for escapes, e.g., E'\\r\\n'."),
+				 lexer_errposition()));
+	yyextra->warn_on_first_escape = false;	/* warn only once per string */
+}
+
+/*
+ * Interface functions to make flex use palloc() instead of malloc().
+ * It'd be better to make these static, but flex insists otherwise.
+ */
+
+void *
+core_yyalloc(yy_size_t bytes, core_yyscan_t yyscanner)
+{
+	return palloc(bytes);
+}
+
+void *
+core_yyrealloc(void *ptr, yy_size_t bytes, core_yyscan_t yyscanner)
+{
+	if (ptr)
+		return repalloc(ptr, bytes);
+	else
+		return palloc(bytes);
+}
+
+void
+core_yyfree(void *ptr, core_yyscan_t yyscanner)
+{
+	if (ptr)
+		pfree(ptr);
+}
+
@@ -46,6 +46,7 @@ volatile uint32 InterruptHoldoffCount = 0;
 volatile uint32 CritSectionCount = 0;
 
 bool		IsUnderPostmaster = false;
+bool		IsPostmasterEnvironment = false;
 bool		assert_enabled = true;
 
 int			MaxBackends = 32;
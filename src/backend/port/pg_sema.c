@@ -0,0 +1 @@
+../../../src/backend/port/sysv_sema.c
\ No newline at end of file
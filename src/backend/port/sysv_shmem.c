@@ -46,17 +46,58 @@ typedef int IpcMemoryId;		/* shared memory ID returned by shmget(2) */
 #define PG_SHMAT_FLAGS			0
 #endif
 
+/* huge page size to assume if /proc/meminfo doesn't tell us */
+#define DEFAULT_HUGE_PAGE_SIZE	(2 * 1024 * 1024)
+
 
 unsigned long UsedShmemSegID = 0;
 void	   *UsedShmemSegAddr = NULL;
 
+/* GUC variable */
+int			huge_pages = HUGE_PAGES_TRY;
+
 static void *InternalIpcMemoryCreate(IpcMemoryKey memKey, Size size);
+#ifdef SHM_HUGETLB
+static Size GetHugePageSize(void);
+#endif
 static void IpcMemoryDetach(int status, Datum shmaddr);
 static void IpcMemoryDelete(int status, Datum shmId);
 static PGShmemHeader *PGSharedMemoryAttach(IpcMemoryKey key,
 					 IpcMemoryId *shmid);
 
 
+#ifdef SHM_HUGETLB
+/*
+ *	GetHugePageSize()
+ *
+ * Return the size of the kernel's default huge page, as reported in
+ * /proc/meminfo.  If that can't be read, assume the common 2MB.
+ */
+static Size
+GetHugePageSize(void)
+{
+	Size		result = DEFAULT_HUGE_PAGE_SIZE;
+	FILE	   *fp;
+	char		buf[128];
+	unsigned long sz;
+
+	fp = fopen("/proc/meminfo", "r");
+	if (fp == NULL)
+		return result;
+	while (fgets(buf, sizeof(buf), fp) != NULL)
+	{
+		if (sscanf(buf, "Hugepagesize: %lu kB", &sz) == 1)
+		{
+			if (sz > 0)
+				result = (Size) sz * 1024;
+			break;
+		}
+	}
+	fclose(fp);
+	return result;
+}
+#endif
+
 /*
  *	InternalIpcMemoryCreate(memKey, size)
  *
@@ -66,16 +107,72 @@ static PGShmemHeader *PGSharedMemoryAttach(IpcMemoryKey key,
  * On success, callbacks are registered with on_shmem_exit to detach and
  * delete the segment when on_shmem_exit is called.
  *
+ * If huge_pages is "on" or "try", we first ask for a segment backed by huge
+ * pages, which cuts the page table and TLB overhead of a large segment
+ * mapped by many processes.  If the kernel refuses (typically because too
+ * few huge pages are reserved), "try" quietly falls back to a normal segment.
+ *
  * If we fail with a failure code other than collision-with-existing-segment,
  * print out an error and abort.  Other types of errors are not recoverable.
  */
 static void *
 InternalIpcMemoryCreate(IpcMemoryKey memKey, Size size)
 {
-	IpcMemoryId shmid;
+	IpcMemoryId shmid = -1;
 	void	   *memAddress;
+	Size		hugepagesize = 0;
+	Size		hugesize = 0;
+
+#ifdef SHM_HUGETLB
+	if (huge_pages != HUGE_PAGES_OFF)
+	{
+		/* The segment size must be a multiple of the huge page size */
+		hugepagesize = GetHugePageSize();
+		hugesize = size + hugepagesize - 1;
+		hugesize -= hugesize % hugepagesize;
 
-	shmid = shmget(memKey, size, IPC_CREAT | IPC_EXCL | IPCProtection);
+		shmid = shmget(memKey, hugesize,
+					   IPC_CREAT | IPC_EXCL | IPCProtection | SHM_HUGETLB);
+
+		if (shmid < 0)
+		{
+			/* Fail quietly on collision, as below */
+			if (errno == EEXIST || errno == EACCES
+#ifdef EIDRM
+				|| errno == EIDRM
+#endif
+				)
+				return NULL;
+
+			if (huge_pages == HUGE_PAGES_ON)
+				ereport(FATAL,
+						(errmsg("could not create shared memory segment with huge pages: %m"),
+						 errdetail("Failed system call was shmget(key=%lu, size=%lu, 0%o).",
+								   (unsigned long) memKey,
+								   (unsigned long) hugesize,
+						 IPC_CREAT | IPC_EXCL | IPCProtection | SHM_HUGETLB),
+						 errhint("This error usually means that the kernel has too few "
+								 "huge pages reserved for a segment of %lu bytes, "
+								 "or that the server's user is not permitted to use "
+								 "them.  Reserve more huge pages (vm.nr_hugepages), "
+								 "check vm.hugetlb_shm_group, or set huge_pages "
+								 "to \"try\" or \"off\".",
+								 (unsigned long) hugesize)));
+
+			elog(DEBUG1, "shmget(key=%lu, size=%lu) with SHM_HUGETLB failed, falling back to normal pages: %m",
+				 (unsigned long) memKey, (unsigned long) hugesize);
+			hugepagesize = 0;
+		}
+	}
+#else
+	if (huge_pages == HUGE_PAGES_ON)
+		ereport(FATAL,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("huge pages not supported on this platform")));
+#endif
+
+	if (shmid < 0)
+		shmid = shmget(memKey, size, IPC_CREAT | IPC_EXCL | IPCProtection);
 
 	if (shmid < 0)
 	{
@@ -202,6 +299,14 @@ InternalIpcMemoryCreate(IpcMemoryKey memKey, Size size)
 	RecordSharedMemoryInLockFile((unsigned long) memKey,
 								 (unsigned long) shmid);
 
+	/* Standalone backends needn't make noise about it */
+	if (hugepagesize > 0)
+		ereport(IsPostmasterEnvironment ? LOG : DEBUG1,
+				(errmsg("using %lu huge pages of %lu kB for shared memory segment of %lu bytes",
+						(unsigned long) (hugesize / hugepagesize),
+						(unsigned long) (hugepagesize / 1024),
+						(unsigned long) size)));
+
 	return memAddress;
 }
 
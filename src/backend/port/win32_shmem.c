@@ -20,6 +20,9 @@ HANDLE		UsedShmemSegID = 0;
 void	   *UsedShmemSegAddr = NULL;
 static Size UsedShmemSegSize = 0;
 
+/* GUC variable; large pages are not implemented on Windows */
+int			huge_pages = HUGE_PAGES_TRY;
+
 static void pgwin32_SharedMemoryDelete(int status, Datum shmId);
 
 /*
@@ -131,6 +134,11 @@ PGSharedMemoryCreate(Size size, bool makePrivate, int port)
 	/* Room for a header? */
 	Assert(size > MAXALIGN(sizeof(PGShmemHeader)));
 
+	if (huge_pages == HUGE_PAGES_ON)
+		ereport(FATAL,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("huge pages not supported on this platform")));
+
 	szShareMem = GetSharedMemName();
 
 	UsedShmemSegAddr = NULL;
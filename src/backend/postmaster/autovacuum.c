@@ -112,6 +112,7 @@ int			autovacuum_freeze_max_age;
 
 int			autovacuum_vac_cost_delay;
 int			autovacuum_vac_cost_limit;
+int			autovacuum_vac_parallel_workers;
 
 int			Log_autovacuum_min_duration = -1;
 
@@ -2644,6 +2645,7 @@ autovacuum_do_vac_analyze(autovac_table *tab,
 	vacstmt.freeze_table_age = tab->at_freeze_table_age;
 	vacstmt.relation = NULL;	/* not used since we pass a relid */
 	vacstmt.va_cols = NIL;
+	vacstmt.parallel_workers = autovacuum_vac_parallel_workers;
 
 	/* Let pgstat know what we're doing */
 	autovac_report_activity(tab);
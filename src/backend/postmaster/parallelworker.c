@@ -0,0 +1,1191 @@
+/*-------------------------------------------------------------------------
+ *
+ * parallelworker.c
+ *
+ * Parallel worker processes
+ *
+ * A backend that wants help with a task (the "leader") reserves some worker
+ * slots in shared memory with CreateParallelContext, fills in a shared
+ * argument area describing the work, and then calls LaunchParallelWorkers.
+ * Like autovacuum workers, parallel workers are forked by the postmaster,
+ * which we ask to do so through a postmaster signal; the postmaster then
+ * forks one process for each slot in PWS_REQUESTED state.  A worker
+ * connects to the leader's database as the leader's user, runs the entry
+ * function named in its context, and exits.
+ *
+ * Each worker slot contains a shared message queue on which the leader is
+ * the receiver and the worker the sender.  What gets sent is up to the entry
+ * function.  When the worker exits, for whatever reason, it detaches from
+ * the queue and marks its slot as exited, which wakes up the leader.  If the
+ * worker failed with an error, the error code, message and context are saved
+ * in the slot, and CheckParallelWorkers rethrows them in the leader.
+ *
+ * A worker that couldn't be forked, or that found it couldn't do anything
+ * useful, simply does nothing.  Callers must be prepared to get fewer
+ * workers than they asked for, and have to arrange for the work to be
+ * divided up dynamically, so that whatever the workers don't do gets done
+ * by the leader.
+ *
+ * A context can also reserve working space that the leader and its workers
+ * share, for example a hash table that they all build.  That space comes
+ * from an area of parallel_shared_memory kilobytes, set aside at server
+ * start; since the main shared memory segment is mapped at the same address
+ * in every process, it can contain plain pointers.
+ *
+ * If the leader's transaction aborts while workers are still running, the
+ * workers are sent a cancel signal and left to exit on their own; the slots
+ * they occupy are "orphaned", and are released by the workers themselves
+ * when they exit.  Orphaned workers don't report errors, since nobody is
+ * interested anymore.
+ *
+ * The postmaster reads the slot array without taking the spinlock, and
+ * writes only the pws_pid, pws_forked and pws_fork_failed fields, which
+ * nobody else writes while the slot is in PWS_REQUESTED state.  This keeps
+ * the postmaster from ever waiting on a lock held by a backend.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "access/xact.h"
+#include "commands/copy.h"
+#include "commands/vacuum.h"
+#include "executor/execParallel.h"
+#include "libpq/pqsignal.h"
+#include "miscadmin.h"
+#include "postmaster/fork_process.h"
+#include "postmaster/parallelworker.h"
+#include "postmaster/postmaster.h"
+#include "storage/ipc.h"
+#include "storage/pmsignal.h"
+#include "storage/procsignal.h"
+#include "storage/shmem.h"
+#include "storage/spin.h"
+#include "tcop/tcopprot.h"
+#include "utils/guc.h"
+#include "utils/memutils.h"
+#include "utils/ps_status.h"
+#include "utils/tuplesort.h"
+
+
+/* GUC variables */
+int			max_parallel_workers = 8;
+int			parallel_shared_memory = 8192;
+
+int			ParallelWorkerNumber = -1;
+
+/* size of each worker's message queue, and of each context's arguments */
+#define PARALLEL_QUEUE_SIZE			65536
+#define PARALLEL_ARGUMENT_SIZE		65536
+
+#define PARALLEL_ERRMSG_LEN			256
+
+typedef enum
+{
+	PWS_FREE,					/* available for use */
+	PWS_RESERVED,				/* reserved by a leader, not yet launched */
+	PWS_REQUESTED,				/* postmaster asked to start a worker */
+	PWS_RUNNING,				/* worker has attached to the slot */
+	PWS_EXITED					/* worker has exited */
+} ParallelWorkerState;
+
+/*
+ * Shared state of one parallel worker.  pws_pid, pws_forked and
+ * pws_fork_failed are set by the postmaster; everything else is protected
+ * by the spinlock in ParallelWorkerShmemStruct.
+ */
+typedef struct
+{
+	ParallelWorkerState pws_state;
+	int			pws_context;	/* index of context slot */
+	int			pws_number;		/* worker number within context */
+	bool		pws_orphaned;	/* leader has gone away */
+	pid_t		pws_pid;
+	bool		pws_forked;
+	bool		pws_fork_failed;
+	bool		pws_failed;		/* worker exited with an error */
+	int			pws_errcode;
+	char		pws_errmsg[PARALLEL_ERRMSG_LEN];
+	char		pws_errcontext[PARALLEL_ERRMSG_LEN];
+} ParallelWorkerSlot;
+
+/*
+ * Shared state of a group of workers working for the same leader.  A
+ * context slot is in use as long as pcs_refcount is nonzero; the leader
+ * holds one reference, and so does every worker slot pointing at it.  The
+ * argument area, PARALLEL_ARGUMENT_SIZE bytes, follows the struct.
+ *
+ * pcs_space_size is the size of the context's reservation in the shared
+ * working space, or zero if it has none; it's released together with the
+ * slot, so that orphaned workers can't see it reused beneath them.
+ */
+typedef struct
+{
+	int			pcs_refcount;
+	ParallelWorkerEntry pcs_entry;
+	PGPROC	   *pcs_leader;
+	Oid			pcs_database;
+	Oid			pcs_session_userid;
+	bool		pcs_session_superuser;
+	Oid			pcs_userid;
+	int			pcs_sec_context;
+	Size		pcs_space_offset;	/* offset of reservation in shared space */
+	Size		pcs_space_size; /* its size, or 0 if none */
+} ParallelContextSlot;
+
+typedef struct
+{
+	slock_t		mutex;
+	ParallelWorkerSlot slots[1];	/* VARIABLE LENGTH ARRAY */
+} ParallelWorkerShmemStruct;
+
+static ParallelWorkerShmemStruct *ParallelWorkerShmem = NULL;
+
+/*
+ * Offsets of the context array, the queues and the shared working space,
+ * and size of a context
+ */
+static Size context_offset;
+static Size context_size;
+static Size queue_offset;
+static Size space_offset;
+
+#define ContextSlot(n) \
+	((ParallelContextSlot *) ((char *) ParallelWorkerShmem + \
+							  context_offset + (n) * context_size))
+#define ContextArguments(n) \
+	((char *) ContextSlot(n) + MAXALIGN(sizeof(ParallelContextSlot)))
+#define WorkerQueue(n) \
+	((shm_mq *) ((char *) ParallelWorkerShmem + queue_offset + \
+				 (n) * PARALLEL_QUEUE_SIZE))
+#define SharedSpace(offset) \
+	((char *) ParallelWorkerShmem + space_offset + (offset))
+
+/* Parallel contexts created in the current transaction */
+static ParallelContext *pcxt_list = NULL;
+
+/* Worker-side state */
+static bool am_parallel_worker = false;
+static int	MyParallelWorkerSlot = -1;
+
+typedef void (*parallel_worker_main_type) (char *args, Size size);
+
+/* Entry points, indexed by ParallelWorkerEntry */
+static const parallel_worker_main_type ParallelWorkerEntries[] = {
+	ParallelQueryMain,
+	ParallelCopyMain,
+	ParallelSortMain,
+	ParallelVacuumMain
+};
+
+static void ComputeShmemLayout(void);
+static void ReleaseContextSlot(volatile ParallelContextSlot *ctx);
+static void ParallelWorkerReportError(void);
+static void ParallelWorkerExit(int code, Datum arg);
+
+#ifdef EXEC_BACKEND
+static pid_t pworker_forkexec(int slot);
+#endif
+NON_EXEC_STATIC void ParallelWorkerMain(int argc, char *argv[]);
+
+
+/********************************************************************
+ *					  SHARED MEMORY
+ ********************************************************************/
+
+static void
+ComputeShmemLayout(void)
+{
+	Size		size;
+
+	size = offsetof(ParallelWorkerShmemStruct, slots);
+	size = add_size(size, mul_size(max_parallel_workers,
+								   sizeof(ParallelWorkerSlot)));
+	context_offset = MAXALIGN(size);
+	context_size = MAXALIGN(sizeof(ParallelContextSlot)) +
+		PARALLEL_ARGUMENT_SIZE;
+	queue_offset = add_size(context_offset,
+							mul_size(max_parallel_workers, context_size));
+	space_offset = add_size(queue_offset,
+							mul_size(max_parallel_workers, PARALLEL_QUEUE_SIZE));
+}
+
+/*
+ * ParallelWorkerShmemSize
+ *		Compute space needed for parallel worker related shared memory
+ */
+Size
+ParallelWorkerShmemSize(void)
+{
+	ComputeShmemLayout();
+	return add_size(space_offset, mul_size(parallel_shared_memory, 1024));
+}
+
+/*
+ * ParallelWorkerShmemInit
+ *		Allocate and initialize parallel worker related shared memory
+ */
+void
+ParallelWorkerShmemInit(void)
+{
+	bool		found;
+
+	ParallelWorkerShmem = (ParallelWorkerShmemStruct *)
+		ShmemInitStruct("Parallel Worker Data",
+						ParallelWorkerShmemSize(),
+						&found);
+
+	if (!IsUnderPostmaster)
+	{
+		int			i;
+
+		Assert(!found);
+
+		SpinLockInit(&ParallelWorkerShmem->mutex);
+		for (i = 0; i < max_parallel_workers; i++)
+		{
+			ParallelWorkerShmem->slots[i].pws_state = PWS_FREE;
+			ContextSlot(i)->pcs_refcount = 0;
+			ContextSlot(i)->pcs_space_size = 0;
+		}
+	}
+	else
+		Assert(found);
+}
+
+
+/********************************************************************
+ *					  LEADER CODE
+ ********************************************************************/
+
+/*
+ * CreateParallelContext
+ *		Reserve up to nworkers parallel workers for the given entry point.
+ *
+ * The context is allocated in TopTransactionContext, and is destroyed
+ * automatically at the end of the (sub)transaction if the caller doesn't do
+ * it first.
+ */
+ParallelContext *
+CreateParallelContext(ParallelWorkerEntry entry, int nworkers)
+{
+	ParallelContext *pcxt;
+	int			i;
+
+	pcxt = (ParallelContext *)
+		MemoryContextAllocZero(TopTransactionContext, sizeof(ParallelContext));
+	pcxt->entry = entry;
+	pcxt->nworkers = 0;
+	pcxt->context_slot = -1;
+	pcxt->launched = false;
+	pcxt->subid = GetCurrentSubTransactionId();
+
+	nworkers = Min(nworkers, max_parallel_workers);
+	if (nworkers > 0 && IsUnderPostmaster && ParallelWorkerShmem != NULL)
+	{
+		/* use volatile pointer to prevent code rearrangement */
+		volatile ParallelWorkerShmemStruct *pws = ParallelWorkerShmem;
+		int			ctx = -1;
+
+		pcxt->worker_slot = (int *)
+			MemoryContextAlloc(TopTransactionContext, nworkers * sizeof(int));
+
+		SpinLockAcquire(&ParallelWorkerShmem->mutex);
+
+		for (i = 0; i < max_parallel_workers; i++)
+		{
+			volatile ParallelWorkerSlot *slot = &pws->slots[i];
+
+			/*
+			 * Reclaim orphaned slots whose worker was never started; there's
+			 * no worker to release them.
+			 */
+			if (slot->pws_state == PWS_REQUESTED && slot->pws_orphaned &&
+				slot->pws_fork_failed)
+			{
+				slot->pws_state = PWS_FREE;
+				ReleaseContextSlot(ContextSlot(slot->pws_context));
+			}
+
+			if (ctx < 0 && ContextSlot(i)->pcs_refcount == 0)
+				ctx = i;
+		}
+
+		if (ctx >= 0)
+		{
+			for (i = 0; i < max_parallel_workers && pcxt->nworkers < nworkers;
+				 i++)
+			{
+				volatile ParallelWorkerSlot *slot = &pws->slots[i];
+
+				if (slot->pws_state != PWS_FREE)
+					continue;
+
+				slot->pws_state = PWS_RESERVED;
+				slot->pws_context = ctx;
+				slot->pws_number = pcxt->nworkers;
+				slot->pws_orphaned = false;
+				slot->pws_pid = 0;
+				slot->pws_forked = false;
+				slot->pws_fork_failed = false;
+				slot->pws_failed = false;
+				pcxt->worker_slot[pcxt->nworkers++] = i;
+			}
+
+			if (pcxt->nworkers > 0)
+			{
+				volatile ParallelContextSlot *cslot = ContextSlot(ctx);
+
+				cslot->pcs_refcount = pcxt->nworkers + 1;
+				cslot->pcs_entry = entry;
+				cslot->pcs_leader = MyProc;
+				cslot->pcs_space_size = 0;
+				pcxt->context_slot = ctx;
+			}
+		}
+
+		SpinLockRelease(&ParallelWorkerShmem->mutex);
+
+		/* Set up the queues; nobody else can be looking at them yet */
+		for (i = 0; i < pcxt->nworkers; i++)
+		{
+			shm_mq	   *mq;
+
+			mq = shm_mq_create(WorkerQueue(pcxt->worker_slot[i]),
+							   PARALLEL_QUEUE_SIZE);
+			shm_mq_set_receiver(mq, MyProc);
+		}
+	}
+
+	pcxt->next = pcxt_list;
+	pcxt_list = pcxt;
+
+	return pcxt;
+}
+
+/*
+ * ParallelContextArgumentSpace
+ *		Return the shared argument area of a context, and its size.
+ *
+ * Returns NULL if no workers were reserved.  The area must be filled in
+ * before calling LaunchParallelWorkers, and not changed afterwards except
+ * through objects that provide their own locking.
+ */
+char *
+ParallelContextArgumentSpace(ParallelContext *pcxt, Size *size)
+{
+	if (pcxt->context_slot < 0)
+	{
+		*size = 0;
+		return NULL;
+	}
+
+	*size = PARALLEL_ARGUMENT_SIZE;
+	return ContextArguments(pcxt->context_slot);
+}
+
+/*
+ * ParallelContextSharedSpace
+ *		Reserve working space shared by the leader and the workers.
+ *
+ * We reserve as much as we can of the requested size, but not less than
+ * minimum; *size is set to the amount reserved.  Returns NULL if the context
+ * has no workers, or not even minimum bytes are free.  A context can have
+ * only one reservation, which must be made before LaunchParallelWorkers.
+ * It lasts until the leader and all the workers are gone.
+ */
+char *
+ParallelContextSharedSpace(ParallelContext *pcxt, Size request, Size minimum,
+						   Size *size)
+{
+	volatile ParallelContextSlot *cslot;
+	Size		total = mul_size(parallel_shared_memory, 1024);
+	Size		best_start = 0;
+	Size		best_size = 0;
+	Size		start;
+	int			i;
+	int			j;
+
+	Assert(!pcxt->launched);
+
+	*size = 0;
+	if (pcxt->context_slot < 0)
+		return NULL;
+
+	cslot = ContextSlot(pcxt->context_slot);
+	Assert(cslot->pcs_space_size == 0);
+
+	request = MAXALIGN(request);
+	minimum = MAXALIGN(minimum);
+
+	/*
+	 * Find the largest free gap.  There are at most max_parallel_workers
+	 * reservations, so just try the start of the space and the end of each
+	 * reservation as candidate starting points.
+	 */
+	SpinLockAcquire(&ParallelWorkerShmem->mutex);
+
+	for (i = -1; i < max_parallel_workers; i++)
+	{
+		Size		end = total;
+
+		if (i < 0)
+			start = 0;
+		else
+		{
+			volatile ParallelContextSlot *other = ContextSlot(i);
+
+			if (other->pcs_refcount == 0 || other->pcs_space_size == 0)
+				continue;
+			start = other->pcs_space_offset + other->pcs_space_size;
+		}
+
+		for (j = 0; j < max_parallel_workers; j++)
+		{
+			volatile ParallelContextSlot *other = ContextSlot(j);
+
+			if (other->pcs_refcount == 0 || other->pcs_space_size == 0)
+				continue;
+			if (other->pcs_space_offset + other->pcs_space_size <= start)
+				continue;
+			if (other->pcs_space_offset <= start)
+			{
+				/* candidate lies within another reservation */
+				end = start;
+				break;
+			}
+			end = Min(end, other->pcs_space_offset);
+		}
+
+		if (end - start > best_size)
+		{
+			best_start = start;
+			best_size = end - start;
+		}
+	}
+
+	if (best_size >= minimum && minimum > 0)
+	{
+		cslot->pcs_space_offset = best_start;
+		cslot->pcs_space_size = Min(best_size, request);
+		*size = cslot->pcs_space_size;
+	}
+
+	SpinLockRelease(&ParallelWorkerShmem->mutex);
+
+	if (*size == 0)
+		return NULL;
+
+	return SharedSpace(best_start);
+}
+
+/*
+ * ParallelWorkerQueue
+ *		Return the queue on which the given worker (0 .. nworkers-1) sends.
+ */
+shm_mq *
+ParallelWorkerQueue(ParallelContext *pcxt, int worker)
+{
+	Assert(worker >= 0 && worker < pcxt->nworkers);
+	return WorkerQueue(pcxt->worker_slot[worker]);
+}
+
+/*
+ * LaunchParallelWorkers
+ *		Ask the postmaster to start the reserved workers.
+ */
+void
+LaunchParallelWorkers(ParallelContext *pcxt)
+{
+	volatile ParallelWorkerShmemStruct *pws = ParallelWorkerShmem;
+	volatile ParallelContextSlot *cslot;
+	Oid			userid;
+	int			sec_context;
+	int			i;
+
+	Assert(!pcxt->launched);
+	pcxt->launched = true;
+
+	if (pcxt->nworkers == 0)
+		return;
+
+	/* Workers run as our session and current user */
+	cslot = ContextSlot(pcxt->context_slot);
+	GetUserIdAndSecContext(&userid, &sec_context);
+	cslot->pcs_database = MyDatabaseId;
+	cslot->pcs_session_userid = GetSessionUserId();
+	cslot->pcs_session_superuser = superuser_arg(GetSessionUserId());
+	cslot->pcs_userid = userid;
+	cslot->pcs_sec_context = sec_context;
+
+	SpinLockAcquire(&ParallelWorkerShmem->mutex);
+	for (i = 0; i < pcxt->nworkers; i++)
+		pws->slots[pcxt->worker_slot[i]].pws_state = PWS_REQUESTED;
+	SpinLockRelease(&ParallelWorkerShmem->mutex);
+
+	SendPostmasterSignal(PMSIGNAL_START_PARALLEL_WORKER);
+}
+
+/*
+ * CheckParallelWorkers
+ *		Rethrow the error of any worker that has failed.
+ *
+ * This also detaches from the queues of workers that the postmaster could
+ * not start, so that readers see them as finished.  Callers waiting for a
+ * worker should call this each time their latch is set.
+ */
+void
+CheckParallelWorkers(ParallelContext *pcxt)
+{
+	volatile ParallelWorkerShmemStruct *pws = ParallelWorkerShmem;
+	bool		failed = false;
+	int			sqlerrcode = 0;
+	pid_t		pid = 0;
+	char		message[PARALLEL_ERRMSG_LEN];
+	char		context[PARALLEL_ERRMSG_LEN];
+	int			i;
+
+	if (!pcxt->launched || pcxt->nworkers == 0)
+		return;
+
+	for (i = 0; i < pcxt->nworkers; i++)
+	{
+		volatile ParallelWorkerSlot *slot = &pws->slots[pcxt->worker_slot[i]];
+		bool		fork_failed;
+
+		SpinLockAcquire(&ParallelWorkerShmem->mutex);
+		fork_failed = (slot->pws_state == PWS_REQUESTED &&
+					   slot->pws_fork_failed);
+		if (slot->pws_failed && !failed)
+		{
+			failed = true;
+			sqlerrcode = slot->pws_errcode;
+			pid = slot->pws_pid;
+			strlcpy(message, (const char *) slot->pws_errmsg,
+					PARALLEL_ERRMSG_LEN);
+			strlcpy(context, (const char *) slot->pws_errcontext,
+					PARALLEL_ERRMSG_LEN);
+		}
+		SpinLockRelease(&ParallelWorkerShmem->mutex);
+
+		if (fork_failed)
+			shm_mq_detach(WorkerQueue(pcxt->worker_slot[i]));
+	}
+
+	if (failed)
+	{
+		if (context[0] != '\0')
+			ereport(ERROR,
+					(errcode(sqlerrcode),
+					 errmsg_internal("%s", message),
+					 errcontext("%s", context),
+					 errcontext("parallel worker, PID %d", (int) pid)));
+		else
+			ereport(ERROR,
+					(errcode(sqlerrcode),
+					 errmsg_internal("%s", message),
+					 errcontext("parallel worker, PID %d", (int) pid)));
+	}
+}
+
+/*
+ * WaitForParallelWorkersToFinish
+ *		Wait until all launched workers have exited.
+ *
+ * The caller should normally have detached from the workers' queues, or
+ * read them to the end; otherwise a worker may wait forever for room to
+ * send more data.
+ */
+void
+WaitForParallelWorkersToFinish(ParallelContext *pcxt)
+{
+	volatile ParallelWorkerShmemStruct *pws = ParallelWorkerShmem;
+
+	if (!pcxt->launched || pcxt->nworkers == 0)
+		return;
+
+	for (;;)
+	{
+		bool		anyrunning = false;
+		int			i;
+
+		CheckParallelWorkers(pcxt);
+
+		SpinLockAcquire(&ParallelWorkerShmem->mutex);
+		for (i = 0; i < pcxt->nworkers; i++)
+		{
+			volatile ParallelWorkerSlot *slot;
+
+			slot = &pws->slots[pcxt->worker_slot[i]];
+			if (slot->pws_state == PWS_RUNNING ||
+				(slot->pws_state == PWS_REQUESTED && !slot->pws_fork_failed))
+			{
+				anyrunning = true;
+				break;
+			}
+		}
+		SpinLockRelease(&ParallelWorkerShmem->mutex);
+
+		if (!anyrunning)
+			break;
+
+		WaitLatch(&MyProc->procLatch, -1L);
+		ResetLatch(&MyProc->procLatch);
+		CHECK_FOR_INTERRUPTS();
+	}
+}
+
+/*
+ * DestroyParallelContext
+ *		Release a parallel context and its worker slots.
+ *
+ * Workers that are still running are sent a cancel signal, and release
+ * their slots themselves when they exit.
+ */
+void
+DestroyParallelContext(ParallelContext *pcxt)
+{
+	volatile ParallelWorkerShmemStruct *pws = ParallelWorkerShmem;
+	ParallelContext **prev;
+	int			i;
+
+	/* Unlink from the list of live contexts */
+	for (prev = &pcxt_list; *prev != NULL; prev = &(*prev)->next)
+	{
+		if (*prev == pcxt)
+		{
+			*prev = pcxt->next;
+			break;
+		}
+	}
+
+	if (pcxt->context_slot >= 0)
+	{
+		pid_t	   *victims = palloc(pcxt->nworkers * sizeof(pid_t));
+		int			nvictims = 0;
+
+		/* Wake up anybody blocked sending to us */
+		for (i = 0; i < pcxt->nworkers; i++)
+			shm_mq_detach(WorkerQueue(pcxt->worker_slot[i]));
+
+		SpinLockAcquire(&ParallelWorkerShmem->mutex);
+		for (i = 0; i < pcxt->nworkers; i++)
+		{
+			volatile ParallelWorkerSlot *slot;
+
+			slot = &pws->slots[pcxt->worker_slot[i]];
+			if (slot->pws_state == PWS_RESERVED ||
+				slot->pws_state == PWS_EXITED ||
+				(slot->pws_state == PWS_REQUESTED && slot->pws_fork_failed))
+			{
+				slot->pws_state = PWS_FREE;
+				ReleaseContextSlot(ContextSlot(pcxt->context_slot));
+			}
+			else
+			{
+				slot->pws_orphaned = true;
+				if (slot->pws_pid != 0)
+					victims[nvictims++] = slot->pws_pid;
+			}
+		}
+		/* And drop the leader's own reference */
+		ReleaseContextSlot(ContextSlot(pcxt->context_slot));
+		SpinLockRelease(&ParallelWorkerShmem->mutex);
+
+		for (i = 0; i < nvictims; i++)
+			kill(victims[i], SIGINT);
+
+		pfree(victims);
+		pfree(pcxt->worker_slot);
+	}
+
+	pfree(pcxt);
+}
+
+/*
+ * Drop a reference to a context slot.  Caller must hold the spinlock.
+ */
+static void
+ReleaseContextSlot(volatile ParallelContextSlot *ctx)
+{
+	Assert(ctx->pcs_refcount > 0);
+	if (--ctx->pcs_refcount == 0)
+	{
+		ctx->pcs_leader = NULL;
+		ctx->pcs_space_size = 0;
+	}
+}
+
+/*
+ * AtEOXact_Parallel
+ *		Destroy any parallel contexts left over at end of transaction.
+ *
+ * On commit, that indicates somebody forgot to clean up.
+ */
+void
+AtEOXact_Parallel(bool isCommit)
+{
+	while (pcxt_list != NULL)
+	{
+		if (isCommit)
+			elog(WARNING, "leaked parallel context");
+		DestroyParallelContext(pcxt_list);
+	}
+}
+
+/*
+ * AtEOSubXact_Parallel
+ *		Destroy any parallel contexts created in the ending subtransaction.
+ */
+void
+AtEOSubXact_Parallel(bool isCommit, SubTransactionId mySubId)
+{
+	ParallelContext *pcxt = pcxt_list;
+
+	while (pcxt != NULL)
+	{
+		ParallelContext *next = pcxt->next;
+
+		if (pcxt->subid == mySubId)
+		{
+			if (isCommit)
+				elog(WARNING, "leaked parallel context");
+			DestroyParallelContext(pcxt);
+		}
+		pcxt = next;
+	}
+}
+
+
+/********************************************************************
+ *					  POSTMASTER CODE
+ ********************************************************************/
+
+/*
+ * ParallelWorkerPendingSlot
+ *		Return a slot whose worker should be started, or -1 if none.
+ *
+ * A slot that has been orphaned before we got to it is marked as failed
+ * instead; there's no point in starting its worker.
+ */
+int
+ParallelWorkerPendingSlot(void)
+{
+	volatile ParallelWorkerShmemStruct *pws = ParallelWorkerShmem;
+	int			i;
+
+	if (pws == NULL)
+		return -1;
+
+	for (i = 0; i < max_parallel_workers; i++)
+	{
+		volatile ParallelWorkerSlot *slot = &pws->slots[i];
+
+		if (slot->pws_state != PWS_REQUESTED || slot->pws_forked ||
+			slot->pws_fork_failed)
+			continue;
+		if (slot->pws_orphaned)
+		{
+			slot->pws_fork_failed = true;
+			continue;
+		}
+		return i;
+	}
+
+	return -1;
+}
+
+/*
+ * ParallelWorkerForkFailed
+ *		Mark a worker as not started, and tell its leader.
+ */
+void
+ParallelWorkerForkFailed(int slotno)
+{
+	volatile ParallelWorkerSlot *slot = &ParallelWorkerShmem->slots[slotno];
+	PGPROC	   *leader;
+
+	slot->pws_fork_failed = true;
+	leader = ContextSlot(slot->pws_context)->pcs_leader;
+	if (leader != NULL)
+		SetLatch(&leader->procLatch);
+}
+
+#ifdef EXEC_BACKEND
+/*
+ * forkexec routine for parallel workers.
+ *
+ * Format up the arglist, then fork and exec.
+ */
+static pid_t
+pworker_forkexec(int slot)
+{
+	char	   *av[10];
+	char		slotbuf[32];
+	int			ac = 0;
+
+	snprintf(slotbuf, sizeof(slotbuf), "%d", slot);
+
+	av[ac++] = "postgres";
+	av[ac++] = "--forkpworker";
+	av[ac++] = NULL;			/* filled in by postmaster_forkexec */
+	av[ac++] = slotbuf;
+	av[ac] = NULL;
+
+	Assert(ac < lengthof(av));
+
+	return postmaster_forkexec(ac, av);
+}
+
+/*
+ * We need this set from the outside, before InitProcess is called
+ */
+void
+ParallelWorkerIAm(int slot)
+{
+	am_parallel_worker = true;
+	MyParallelWorkerSlot = slot;
+	on_shmem_exit(ParallelWorkerExit, 0);
+}
+#endif
+
+/*
+ * StartParallelWorker
+ *		Fork the worker for the given slot.
+ *
+ * Returns the PID of the new process, or zero on failure.
+ */
+int
+StartParallelWorker(int slotno)
+{
+	volatile ParallelWorkerSlot *slot = &ParallelWorkerShmem->slots[slotno];
+	pid_t		worker_pid;
+
+	slot->pws_forked = true;
+
+#ifdef EXEC_BACKEND
+	switch ((worker_pid = pworker_forkexec(slotno)))
+#else
+	switch ((worker_pid = fork_process()))
+#endif
+	{
+		case -1:
+			ereport(LOG,
+					(errmsg("could not fork parallel worker process: %m")));
+			return 0;
+
+#ifndef EXEC_BACKEND
+		case 0:
+			/* in postmaster child ... */
+			/* Close the postmaster's sockets */
+			ClosePostmasterPorts(false);
+
+			/* Lose the postmaster's on-exit routines */
+			on_exit_reset();
+
+			MyParallelWorkerSlot = slotno;
+			ParallelWorkerMain(0, NULL);
+			break;
+#endif
+		default:
+			slot->pws_pid = worker_pid;
+			return (int) worker_pid;
+	}
+
+	/* shouldn't get here */
+	return 0;
+}
+
+
+/********************************************************************
+ *					  WORKER CODE
+ ********************************************************************/
+
+/*
+ * ParallelWorkerMain
+ */
+NON_EXEC_STATIC void
+ParallelWorkerMain(int argc, char *argv[])
+{
+	sigjmp_buf	local_sigjmp_buf;
+	volatile ParallelWorkerSlot *slot;
+	volatile ParallelContextSlot *cslot;
+	char		dbname[NAMEDATALEN];
+	bool		orphaned;
+
+	/* we are a postmaster subprocess now */
+	IsUnderPostmaster = true;
+	am_parallel_worker = true;
+
+	/* reset MyProcPid */
+	MyProcPid = getpid();
+
+	/* record Start Time for logging */
+	MyStartTime = time(NULL);
+
+	/* Identify myself via ps */
+	init_ps_display("parallel worker process", "", "", "");
+
+	SetProcessingMode(InitProcessing);
+
+	/*
+	 * If possible, make this process a group leader, so that the postmaster
+	 * can signal any child processes too.
+	 */
+#ifdef HAVE_SETSID
+	if (setsid() < 0)
+		elog(FATAL, "setsid() failed: %m");
+#endif
+
+	/*
+	 * Set up signal handlers.  We operate on databases much like a regular
+	 * backend, so we use the same signal handling.  See equivalent code in
+	 * tcop/postgres.c.  We don't run long enough to bother with SIGHUP.
+	 */
+	pqsignal(SIGHUP, SIG_IGN);
+	pqsignal(SIGINT, StatementCancelHandler);
+	pqsignal(SIGTERM, die);
+	pqsignal(SIGQUIT, quickdie);
+	pqsignal(SIGALRM, handle_sig_alarm);
+
+	pqsignal(SIGPIPE, SIG_IGN);
+	pqsignal(SIGUSR1, procsignal_sigusr1_handler);
+	pqsignal(SIGUSR2, SIG_IGN);
+	pqsignal(SIGFPE, FloatExceptionHandler);
+	pqsignal(SIGCHLD, SIG_DFL);
+
+	/* Early initialization */
+	BaseInit();
+
+	/*
+	 * Create a per-backend PGPROC struct in shared memory, except in the
+	 * EXEC_BACKEND case where this was done in SubPostmasterMain.  Either
+	 * way, make sure our slot gets released however we exit from here on.
+	 */
+#ifndef EXEC_BACKEND
+	on_shmem_exit(ParallelWorkerExit, 0);
+	InitProcess();
+#endif
+
+	/*
+	 * If an exception is encountered, processing resumes here.
+	 *
+	 * See notes in postgres.c about the design of this coding.
+	 */
+	if (sigsetjmp(local_sigjmp_buf, 1) != 0)
+	{
+		/* Prevents interrupts while cleaning up */
+		HOLD_INTERRUPTS();
+
+		/* Save the error for the leader, and report it to the server log */
+		ParallelWorkerReportError();
+
+		/*
+		 * We can now go away.  Our exit callback detaches from the queue and
+		 * wakes up the leader.
+		 */
+		proc_exit(1);
+	}
+
+	/* We can now handle ereport(ERROR) */
+	PG_exception_stack = &local_sigjmp_buf;
+
+	PG_SETMASK(&UnBlockSig);
+
+	/* The leader's statement_timeout takes care of us, too */
+	SetConfigOption("statement_timeout", "0", PGC_SUSET, PGC_S_OVERRIDE);
+
+	/*
+	 * Attach to our slot, unless the leader has already lost interest.
+	 */
+	slot = &ParallelWorkerShmem->slots[MyParallelWorkerSlot];
+	SpinLockAcquire(&ParallelWorkerShmem->mutex);
+	orphaned = slot->pws_orphaned;
+	if (!orphaned)
+		slot->pws_state = PWS_RUNNING;
+	ParallelWorkerNumber = slot->pws_number;
+	cslot = ContextSlot(slot->pws_context);
+	SpinLockRelease(&ParallelWorkerShmem->mutex);
+
+	if (orphaned)
+		proc_exit(0);
+
+	shm_mq_set_sender(WorkerQueue(MyParallelWorkerSlot), MyProc);
+
+	/* Connect to the leader's database */
+	InitPostgres(NULL, cslot->pcs_database, NULL, dbname);
+	SetProcessingMode(NormalProcessing);
+	set_ps_display(dbname, false);
+
+	if (PostAuthDelay)
+		pg_usleep(PostAuthDelay * 1000000L);
+
+	/* Become the leader's user */
+	SetSessionAuthorization(cslot->pcs_session_userid,
+							cslot->pcs_session_superuser);
+	SetUserIdAndSecContext(cslot->pcs_userid, cslot->pcs_sec_context);
+
+	/* And do the work */
+	StartTransactionCommand();
+	ParallelWorkerEntries[cslot->pcs_entry] (ContextArguments(slot->pws_context),
+											 PARALLEL_ARGUMENT_SIZE);
+	CommitTransactionCommand();
+
+	proc_exit(0);
+}
+
+/*
+ * GetParallelWorkerArgumentSpace
+ *		Return the argument area set up by our leader.
+ */
+char *
+GetParallelWorkerArgumentSpace(Size *size)
+{
+	Assert(am_parallel_worker);
+
+	*size = PARALLEL_ARGUMENT_SIZE;
+	return ContextArguments(ParallelWorkerShmem->slots[MyParallelWorkerSlot].pws_context);
+}
+
+/*
+ * GetParallelWorkerQueue
+ *		Return the queue on which we send to our leader.
+ */
+shm_mq *
+GetParallelWorkerQueue(void)
+{
+	Assert(am_parallel_worker);
+
+	return WorkerQueue(MyParallelWorkerSlot);
+}
+
+/*
+ * GetParallelLeaderProc
+ *		Return our leader's PGPROC.
+ */
+PGPROC *
+GetParallelLeaderProc(void)
+{
+	Assert(am_parallel_worker);
+
+	return ContextSlot(ParallelWorkerShmem->slots[MyParallelWorkerSlot].pws_context)->pcs_leader;
+}
+
+/*
+ * Save the current error in our slot, so that the leader can rethrow it,
+ * and send it to the server log.  Errors of orphaned workers are not
+ * interesting to anybody and are not logged either; most likely they are
+ * just the result of the leader cancelling us.
+ */
+static void
+ParallelWorkerReportError(void)
+{
+	volatile ParallelWorkerSlot *slot;
+	ErrorData  *edata;
+	bool		orphaned;
+
+	MemoryContextSwitchTo(TopMemoryContext);
+	edata = CopyErrorData();
+
+	slot = &ParallelWorkerShmem->slots[MyParallelWorkerSlot];
+	SpinLockAcquire(&ParallelWorkerShmem->mutex);
+	orphaned = slot->pws_orphaned;
+	if (!slot->pws_failed)
+	{
+		slot->pws_failed = true;
+		slot->pws_errcode = edata->sqlerrcode;
+		strlcpy((char *) slot->pws_errmsg,
+				edata->message ? edata->message : "unknown error",
+				PARALLEL_ERRMSG_LEN);
+		strlcpy((char *) slot->pws_errcontext,
+				edata->context ? edata->context : "",
+				PARALLEL_ERRMSG_LEN);
+	}
+	SpinLockRelease(&ParallelWorkerShmem->mutex);
+
+	if (!orphaned)
+		EmitErrorReport();
+	FlushErrorState();
+}
+
+/*
+ * on_shmem_exit callback for parallel workers: detach from the queue and
+ * release the slot, or leave it for the leader to release.
+ *
+ * A worker that exits with a nonzero code without having saved an error,
+ * for example because of a FATAL error, is reported as failed too; the
+ * leader can't know how much work it got done.
+ */
+static void
+ParallelWorkerExit(int code, Datum arg)
+{
+	volatile ParallelWorkerShmemStruct *pws = ParallelWorkerShmem;
+	volatile ParallelWorkerSlot *slot;
+	PGPROC	   *leader = NULL;
+
+	if (pws == NULL || MyParallelWorkerSlot < 0)
+		return;
+
+	slot = &pws->slots[MyParallelWorkerSlot];
+
+	/*
+	 * Record the failure before detaching, so that a leader that sees the
+	 * queue go away also sees why.
+	 */
+	if (code != 0)
+	{
+		SpinLockAcquire(&ParallelWorkerShmem->mutex);
+		if (!slot->pws_failed)
+		{
+			slot->pws_failed = true;
+			slot->pws_errcode = ERRCODE_INTERNAL_ERROR;
+			strlcpy((char *) slot->pws_errmsg,
+					"parallel worker exited unexpectedly",
+					PARALLEL_ERRMSG_LEN);
+			slot->pws_errcontext[0] = '\0';
+		}
+		SpinLockRelease(&ParallelWorkerShmem->mutex);
+	}
+
+	/* The slot can't be reused until we mark it as exited */
+	shm_mq_detach(WorkerQueue(MyParallelWorkerSlot));
+
+	SpinLockAcquire(&ParallelWorkerShmem->mutex);
+	if (slot->pws_orphaned)
+	{
+		slot->pws_state = PWS_FREE;
+		ReleaseContextSlot(ContextSlot(slot->pws_context));
+	}
+	else
+	{
+		slot->pws_state = PWS_EXITED;
+		leader = ContextSlot(slot->pws_context)->pcs_leader;
+	}
+	SpinLockRelease(&ParallelWorkerShmem->mutex);
+
+	MyParallelWorkerSlot = -1;
+
+	if (leader != NULL)
+		SetLatch(&leader->procLatch);
+}
+
+/*
+ * IsParallelWorkerProcess
+ *		Are we a parallel worker?
+ */
+bool
+IsParallelWorkerProcess(void)
+{
+	return am_parallel_worker;
+}
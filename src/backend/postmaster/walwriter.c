@@ -52,6 +52,7 @@
 #include "storage/bufmgr.h"
 #include "storage/fd.h"
 #include "storage/ipc.h"
+#include "storage/latch.h"
 #include "storage/lwlock.h"
 #include "storage/pmsignal.h"
 #include "storage/smgr.h"
@@ -76,6 +77,7 @@ static volatile sig_atomic_t shutdown_requested = false;
 static void wal_quickdie(SIGNAL_ARGS);
 static void WalSigHupHandler(SIGNAL_ARGS);
 static void WalShutdownHandler(SIGNAL_ARGS);
+static void WalSigUsr1Handler(SIGNAL_ARGS);
 
 
 /*
@@ -106,6 +108,9 @@ WalWriterMain(void)
 	 *
 	 * We have no particular use for SIGINT at the moment, but seems
 	 * reasonable to treat like SIGTERM.
+	 *
+	 * SIGUSR1 is used for latch wakeups, in case we ever have to wait for a
+	 * WAL flush group leader.
 	 */
 	pqsignal(SIGHUP, WalSigHupHandler); /* set flag to read config file */
 	pqsignal(SIGINT, WalShutdownHandler);		/* request shutdown */
@@ -113,7 +118,7 @@ WalWriterMain(void)
 	pqsignal(SIGQUIT, wal_quickdie);	/* hard crash time */
 	pqsignal(SIGALRM, SIG_IGN);
 	pqsignal(SIGPIPE, SIG_IGN);
-	pqsignal(SIGUSR1, SIG_IGN); /* reserve for ProcSignal */
+	pqsignal(SIGUSR1, WalSigUsr1Handler);	/* latch wakeup */
 	pqsignal(SIGUSR2, SIG_IGN); /* not used */
 
 	/*
@@ -317,3 +322,10 @@ WalShutdownHandler(SIGNAL_ARGS)
 {
 	shutdown_requested = true;
 }
+
+/* SIGUSR1: used for latch wakeups */
+static void
+WalSigUsr1Handler(SIGNAL_ARGS)
+{
+	latch_sigusr1_handler();
+}
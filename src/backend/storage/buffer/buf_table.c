@@ -9,6 +9,18 @@
  * in most cases the caller needs to adjust the buffer header contents
  * before the lock is released (see notes in README).
  *
+ * The exception is BufTableProbe, which consults a lock-free index kept
+ * alongside the hashtable.  The index is an open-addressing table of
+ * cache-line sized buckets, each holding the hash codes and buffer IDs of a
+ * few entries and a version counter.  Writers, which hold the partition lock
+ * anyway, make the version odd while they change a bucket; readers retry if
+ * it changed under them.  The low-order bits of a bucket's number are those
+ * of the hash codes that go into it, so all writers of a bucket hold the
+ * same partition lock.  The index is lossy: an entry that doesn't fit in its
+ * bucket is simply left out, and the caller then falls back to a locked
+ * lookup in the hashtable.  Nor is it exact without memory barriers, which
+ * is why the caller must check the buffer's tag before trusting the result.
+ *
  *
  * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -34,6 +46,31 @@ typedef struct
 
 static HTAB *SharedBufHash;
 
+/*
+ * Bucket of the lookup index.  The number of ways is chosen to fill a
+ * typical cache line.
+ */
+#define BUF_INDEX_WAYS			7
+#define BUF_INDEX_BUCKET_SIZE	64
+
+typedef struct
+{
+	uint32		version;		/* odd while a writer is changing the bucket */
+	uint32		hashcode[BUF_INDEX_WAYS];	/* hash codes of the entries */
+	int32		id[BUF_INDEX_WAYS];		/* buffer IDs, or -1 if way is unused */
+	uint32		pad;			/* to BUF_INDEX_BUCKET_SIZE */
+} BufferIndexBucket;
+
+/* Give up on a bucket that keeps changing after this many tries */
+#define BUF_INDEX_MAX_RETRIES	3
+
+static volatile BufferIndexBucket *SharedBufIndex;
+static uint32 SharedBufIndexMask;	/* number of buckets - 1 */
+
+static uint32 BufIndexNumBuckets(int size);
+static void BufIndexInsert(uint32 hashcode, int buf_id);
+static void BufIndexDelete(uint32 hashcode, int buf_id);
+
 
 /*
  * Estimate space needed for mapping hashtable
@@ -42,7 +79,34 @@ static HTAB *SharedBufHash;
 Size
 BufTableShmemSize(int size)
 {
-	return hash_estimate_size(size, sizeof(BufferLookupEnt));
+	Size		sz;
+
+	sz = hash_estimate_size(size, sizeof(BufferLookupEnt));
+
+	/* the lookup index, with room to align it on a bucket boundary */
+	sz = add_size(sz, mul_size(BufIndexNumBuckets(size),
+							   sizeof(BufferIndexBucket)));
+	sz = add_size(sz, BUF_INDEX_BUCKET_SIZE);
+
+	return sz;
+}
+
+/*
+ * Number of buckets in the lookup index for a hashtable of the given size.
+ *
+ * We aim for about two entries per bucket, so that few buckets overflow.
+ * The number must be a power of 2, and at least NUM_BUFFER_PARTITIONS so
+ * that each bucket belongs to a single partition.
+ */
+static uint32
+BufIndexNumBuckets(int size)
+{
+	uint32		nbuckets = NUM_BUFFER_PARTITIONS;
+
+	while (nbuckets < (uint32) size / 2)
+		nbuckets <<= 1;
+
+	return nbuckets;
 }
 
 /*
@@ -53,6 +117,9 @@ void
 InitBufTable(int size)
 {
 	HASHCTL		info;
+	uint32		nbuckets;
+	char	   *ptr;
+	bool		found;
 
 	/* assume no locking is needed yet */
 
@@ -66,6 +133,32 @@ InitBufTable(int size)
 								  size, size,
 								  &info,
 								  HASH_ELEM | HASH_FUNCTION | HASH_PARTITION);
+
+	/* And the lookup index */
+	nbuckets = BufIndexNumBuckets(size);
+	ptr = ShmemInitStruct("Shared Buffer Lookup Index",
+						  nbuckets * sizeof(BufferIndexBucket) +
+						  BUF_INDEX_BUCKET_SIZE,
+						  &found);
+	SharedBufIndex = (volatile BufferIndexBucket *)
+		TYPEALIGN(BUF_INDEX_BUCKET_SIZE, ptr);
+	SharedBufIndexMask = nbuckets - 1;
+
+	if (!found)
+	{
+		uint32		i;
+		int			j;
+
+		for (i = 0; i < nbuckets; i++)
+		{
+			SharedBufIndex[i].version = 0;
+			for (j = 0; j < BUF_INDEX_WAYS; j++)
+			{
+				SharedBufIndex[i].hashcode[j] = 0;
+				SharedBufIndex[i].id[j] = -1;
+			}
+		}
+	}
 }
 
 /*
@@ -138,6 +231,8 @@ BufTableInsert(BufferTag *tagPtr, uint32 hashcode, int buf_id)
 
 	result->id = buf_id;
 
+	BufIndexInsert(hashcode, buf_id);
+
 	return -1;
 }
 
@@ -152,13 +247,134 @@ BufTableDelete(BufferTag *tagPtr, uint32 hashcode)
 {
 	BufferLookupEnt *result;
 
+	/*
+	 * Find the entry first, to take it out of the lookup index.  Once it's
+	 * removed from the hashtable, the entry might be reused at any moment by
+	 * an insertion in another partition, so we can't look at it then.
+	 */
 	result = (BufferLookupEnt *)
 		hash_search_with_hash_value(SharedBufHash,
 									(void *) tagPtr,
 									hashcode,
-									HASH_REMOVE,
+									HASH_FIND,
 									NULL);
+	if (result)
+	{
+		BufIndexDelete(hashcode, result->id);
+
+		result = (BufferLookupEnt *)
+			hash_search_with_hash_value(SharedBufHash,
+										(void *) tagPtr,
+										hashcode,
+										HASH_REMOVE,
+										NULL);
+	}
 
 	if (!result)				/* shouldn't happen */
 		elog(ERROR, "shared buffer hash table corrupted");
 }
+
+/*
+ * BufTableProbe
+ *		Look for a buffer ID for the given hash code in the lookup index,
+ *		without any lock; return it, or -1 if none was found
+ *
+ * The result is only a candidate: the buffer might hold a different page
+ * with the same hash code, or have been reassigned since, so the caller
+ * must check the buffer's tag while holding its header spinlock.  -1 doesn't
+ * prove anything either; the caller must then do a BufTableLookup.
+ */
+int
+BufTableProbe(uint32 hashcode)
+{
+	volatile BufferIndexBucket *bucket;
+	int			tries;
+
+	bucket = &SharedBufIndex[hashcode & SharedBufIndexMask];
+
+	for (tries = 0; tries < BUF_INDEX_MAX_RETRIES; tries++)
+	{
+		uint32		version = bucket->version;
+		int			result = -1;
+		int			i;
+
+		if (version & 1)
+			continue;			/* a writer is busy with it */
+
+		for (i = 0; i < BUF_INDEX_WAYS; i++)
+		{
+			if (bucket->hashcode[i] == hashcode && bucket->id[i] >= 0)
+			{
+				result = bucket->id[i];
+				break;
+			}
+		}
+
+		if (bucket->version == version)
+		{
+			/* guard against a torn read, however unlikely */
+			if (result >= NBuffers)
+				result = -1;
+			return result;
+		}
+	}
+
+	return -1;
+}
+
+/*
+ * BufIndexInsert
+ *		Add an entry to the lookup index, if there's room in its bucket
+ *
+ * Caller must hold exclusive lock on BufMappingLock for the hash code's
+ * partition, which covers the whole bucket.
+ */
+static void
+BufIndexInsert(uint32 hashcode, int buf_id)
+{
+	volatile BufferIndexBucket *bucket;
+	int			i;
+
+	bucket = &SharedBufIndex[hashcode & SharedBufIndexMask];
+
+	for (i = 0; i < BUF_INDEX_WAYS; i++)
+	{
+		if (bucket->id[i] < 0)
+		{
+			bucket->version++;
+			bucket->hashcode[i] = hashcode;
+			bucket->id[i] = buf_id;
+			bucket->version++;
+			return;
+		}
+	}
+
+	/* No room; lookups of this entry will have to take the lock */
+}
+
+/*
+ * BufIndexDelete
+ *		Remove an entry from the lookup index, if it's there
+ *
+ * Caller must hold exclusive lock on BufMappingLock for the hash code's
+ * partition.
+ */
+static void
+BufIndexDelete(uint32 hashcode, int buf_id)
+{
+	volatile BufferIndexBucket *bucket;
+	int			i;
+
+	bucket = &SharedBufIndex[hashcode & SharedBufIndexMask];
+
+	for (i = 0; i < BUF_INDEX_WAYS; i++)
+	{
+		if (bucket->id[i] == buf_id && bucket->hashcode[i] == hashcode)
+		{
+			bucket->version++;
+			bucket->id[i] = -1;
+			bucket->version++;
+			return;
+		}
+	}
+}
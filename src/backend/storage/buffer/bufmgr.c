@@ -66,6 +66,7 @@
 bool		zero_damaged_pages = false;
 int			bgwriter_lru_maxpages = 100;
 double		bgwriter_lru_multiplier = 2.0;
+int			checkpoint_flush_after = 32;
 
 /*
  * How many buffers PrefetchBuffer callers should try to stay ahead of their
@@ -81,6 +82,14 @@ static bool IsForInput;
 /* local state for LockBufferForCleanup */
 static volatile BufferDesc *PinCountWaitBuf = NULL;
 
+/*
+ * Tags of buffers written by BufferSync whose writeback hasn't been requested
+ * from the kernel yet.  They are accumulated in sorted order, so neighbouring
+ * blocks can be passed down as a single range.
+ */
+static BufferTag PendingWritebacks[WRITEBACK_MAX_PENDING_FLUSHES];
+static int	NumPendingWritebacks = 0;
+
 
 static Buffer ReadBuffer_common(SMgrRelation reln,
 				  ForkNumber forkNum, BlockNumber blockNum,
@@ -88,8 +97,13 @@ static Buffer ReadBuffer_common(SMgrRelation reln,
 				  bool *hit);
 static bool PinBuffer(volatile BufferDesc *buf, BufferAccessStrategy strategy);
 static void PinBuffer_Locked(volatile BufferDesc *buf);
+static bool PinBufferIfTagged(volatile BufferDesc *buf, BufferTag *tag,
+				  BufferAccessStrategy strategy, bool *valid);
 static void UnpinBuffer(volatile BufferDesc *buf, bool fixOwner);
 static void BufferSync(int flags);
+static int	ckpt_buforder_comparator(const void *pa, const void *pb);
+static void ScheduleBufferWriteback(CkptSortItem *item);
+static void IssuePendingWritebacks(void);
 static int	SyncOneBuffer(int buf_id, bool skip_recently_used);
 static void WaitIO(volatile BufferDesc *buf);
 static bool StartBufferIO(volatile BufferDesc *buf, bool forInput);
@@ -149,10 +163,17 @@ PrefetchBuffer(Relation reln, ForkNumber forkNum, BlockNumber blockNum)
 		newHash = BufTableHashCode(&newTag);
 		newPartitionLock = BufMappingPartitionLock(newHash);
 
-		/* see if the block is in the buffer pool already */
-		LWLockAcquire(newPartitionLock, LW_SHARED);
-		buf_id = BufTableLookup(&newTag, newHash);
-		LWLockRelease(newPartitionLock);
+		/*
+		 * See if the block is in the buffer pool already.  This is only a
+		 * hint, so the lock-free probe will do if it finds anything.
+		 */
+		buf_id = BufTableProbe(newHash);
+		if (buf_id < 0)
+		{
+			LWLockAcquire(newPartitionLock, LW_SHARED);
+			buf_id = BufTableLookup(&newTag, newHash);
+			LWLockRelease(newPartitionLock);
+		}
 
 		/* If not in buffers, initiate prefetch */
 		if (buf_id < 0)
@@ -523,23 +544,43 @@ BufferAlloc(SMgrRelation smgr, ForkNumber forkNum,
 	newHash = BufTableHashCode(&newTag);
 	newPartitionLock = BufMappingPartitionLock(newHash);
 
-	/* see if the block is in the buffer pool already */
-	LWLockAcquire(newPartitionLock, LW_SHARED);
-	buf_id = BufTableLookup(&newTag, newHash);
-	if (buf_id >= 0)
-	{
-		/*
-		 * Found it.  Now, pin the buffer so no one can steal it from the
-		 * buffer pool, and check to see if the correct data has been loaded
-		 * into the buffer.
-		 */
+	/*
+	 * See if the block is in the buffer pool already.  First try the
+	 * lock-free lookup index; a buffer found there is ours if it still has
+	 * the right tag once we've locked its header, since a buffer's tag and
+	 * its mapping entry only change together.  Otherwise, or if the index
+	 * has nothing, do it the hard way with the mapping lock.
+	 */
+	buf_id = BufTableProbe(newHash);
+	if (buf_id >= 0 &&
+		PinBufferIfTagged(&BufferDescriptors[buf_id], &newTag, strategy,
+						  &valid))
 		buf = &BufferDescriptors[buf_id];
-
-		valid = PinBuffer(buf, strategy);
+	else
+	{
+		LWLockAcquire(newPartitionLock, LW_SHARED);
+		buf_id = BufTableLookup(&newTag, newHash);
+		if (buf_id >= 0)
+		{
+			/*
+			 * Found it.  Now, pin the buffer so no one can steal it from the
+			 * buffer pool.
+			 */
+			buf = &BufferDescriptors[buf_id];
+			valid = PinBuffer(buf, strategy);
+		}
 
 		/* Can release the mapping lock as soon as we've pinned it */
 		LWLockRelease(newPartitionLock);
+	}
 
+	if (buf_id >= 0)
+	{
+		/*
+		 * Found it, and pinned it so no one can steal it from the buffer
+		 * pool.  Check to see if the correct data has been loaded into the
+		 * buffer.
+		 */
 		*foundPtr = TRUE;
 
 		if (!valid)
@@ -566,22 +607,17 @@ BufferAlloc(SMgrRelation smgr, ForkNumber forkNum,
 
 	/*
 	 * Didn't find it in the buffer pool.  We'll have to initialize a new
-	 * buffer.	Remember to unlock the mapping lock while doing the work.
+	 * buffer.
 	 */
-	LWLockRelease(newPartitionLock);
 
 	/* Loop here in case we have to try another victim buffer */
 	for (;;)
 	{
-		bool		lock_held;
-
 		/*
 		 * Select a victim buffer.	The buffer is returned with its header
-		 * spinlock still held!  Also (in most cases) the BufFreelistLock is
-		 * still held, since it would be bad to hold the spinlock while
-		 * possibly waking up other processes.
+		 * spinlock still held!
 		 */
-		buf = StrategyGetBuffer(strategy, &lock_held);
+		buf = StrategyGetBuffer(strategy);
 
 		Assert(buf->refcount == 0);
 
@@ -591,10 +627,6 @@ BufferAlloc(SMgrRelation smgr, ForkNumber forkNum,
 		/* Pin the buffer and then release the buffer spinlock */
 		PinBuffer_Locked(buf);
 
-		/* Now it's safe to release the freelist lock */
-		if (lock_held)
-			LWLockRelease(BufFreelistLock);
-
 		/*
 		 * If the buffer was dirty, try to write it out.  There is a race
 		 * condition here, in that someone might dirty it after we released it
@@ -1077,6 +1109,57 @@ PinBuffer(volatile BufferDesc *buf, BufferAccessStrategy strategy)
 	return result;
 }
 
+/*
+ * PinBufferIfTagged -- as PinBuffer, but only if the buffer holds the given
+ * page.
+ *
+ * This is for callers that found the buffer without holding the mapping
+ * lock, and so can't be sure it hasn't been reassigned since.  Returns TRUE
+ * and sets *valid as PinBuffer would if the buffer was pinned, FALSE if it
+ * holds some other page.
+ */
+static bool
+PinBufferIfTagged(volatile BufferDesc *buf, BufferTag *tag,
+				  BufferAccessStrategy strategy, bool *valid)
+{
+	int			b = buf->buf_id;
+
+	if (PrivateRefCount[b] == 0)
+	{
+		LockBufHdr(buf);
+		if (!(buf->flags & BM_TAG_VALID) || !BUFFERTAGS_EQUAL(buf->tag, *tag))
+		{
+			UnlockBufHdr(buf);
+			return false;
+		}
+		buf->refcount++;
+		if (strategy == NULL)
+		{
+			if (buf->usage_count < BM_MAX_USAGE_COUNT)
+				buf->usage_count++;
+		}
+		else
+		{
+			if (buf->usage_count == 0)
+				buf->usage_count = 1;
+		}
+		*valid = (buf->flags & BM_VALID) != 0;
+		UnlockBufHdr(buf);
+	}
+	else
+	{
+		/* We have it pinned already, so its tag can't change under us */
+		if (!BUFFERTAGS_EQUAL(buf->tag, *tag))
+			return false;
+		*valid = true;
+	}
+	PrivateRefCount[b]++;
+	Assert(PrivateRefCount[b] > 0);
+	ResourceOwnerRememberBuffer(CurrentResourceOwner,
+								BufferDescriptorGetBuffer(buf));
+	return true;
+}
+
 /*
  * PinBuffer_Locked -- as above, but caller already locked the buffer header.
  * The spinlock is released before return.
@@ -1162,8 +1245,8 @@ static void
 BufferSync(int flags)
 {
 	int			buf_id;
-	int			num_to_scan;
 	int			num_to_write;
+	int			num_processed;
 	int			num_written;
 
 	/* Make sure we can handle the pin inside SyncOneBuffer */
@@ -1172,7 +1255,8 @@ BufferSync(int flags)
 	/*
 	 * Loop over all buffers, and mark the ones that need to be written with
 	 * BM_CHECKPOINT_NEEDED.  Count them as we go (num_to_write), so that we
-	 * can estimate how much work needs to be done.
+	 * can estimate how much work needs to be done, and remember their tags
+	 * in CkptBufferIds so that we can write them in file order below.
 	 *
 	 * This allows us to write only those pages that were dirty when the
 	 * checkpoint began, and not those that get dirtied while it proceeds.
@@ -1198,8 +1282,16 @@ BufferSync(int flags)
 
 		if (bufHdr->flags & BM_DIRTY)
 		{
+			CkptSortItem *item = &CkptBufferIds[num_to_write++];
+
 			bufHdr->flags |= BM_CHECKPOINT_NEEDED;
-			num_to_write++;
+
+			item->buf_id = buf_id;
+			item->tsId = bufHdr->tag.rnode.spcNode;
+			item->dbId = bufHdr->tag.rnode.dbNode;
+			item->relNode = bufHdr->tag.rnode.relNode;
+			item->forkNum = bufHdr->tag.forkNum;
+			item->blockNum = bufHdr->tag.blockNum;
 		}
 
 		UnlockBufHdr(bufHdr);
@@ -1211,19 +1303,30 @@ BufferSync(int flags)
 	TRACE_POSTGRESQL_BUFFER_SYNC_START(NBuffers, num_to_write);
 
 	/*
-	 * Loop over all buffers again, and write the ones (still) marked with
-	 * BM_CHECKPOINT_NEEDED.  In this loop, we start at the clock sweep point
-	 * since we might as well dump soon-to-be-recycled buffers first.
+	 * Sort the buffers by tablespace, relation, fork and block number.
+	 * Writing them in that order lets the kernel and the disk see mostly
+	 * sequential writes instead of a random scattering over all files, and
+	 * lets us request writeback of whole ranges as we go.
+	 */
+	qsort(CkptBufferIds, num_to_write, sizeof(CkptSortItem),
+		  ckpt_buforder_comparator);
+
+	/*
+	 * Now write the buffers (still) marked with BM_CHECKPOINT_NEEDED, in
+	 * sorted order.
 	 *
 	 * Note that we don't read the buffer alloc count here --- that should be
 	 * left untouched till the next BgBufferSync() call.
 	 */
-	buf_id = StrategySyncStart(NULL, NULL);
-	num_to_scan = NBuffers;
 	num_written = 0;
-	while (num_to_scan-- > 0)
+	NumPendingWritebacks = 0;
+	for (num_processed = 0; num_processed < num_to_write; num_processed++)
 	{
-		volatile BufferDesc *bufHdr = &BufferDescriptors[buf_id];
+		CkptSortItem *item = &CkptBufferIds[num_processed];
+		volatile BufferDesc *bufHdr;
+
+		buf_id = item->buf_id;
+		bufHdr = &BufferDescriptors[buf_id];
 
 		/*
 		 * We don't need to acquire the lock here, because we're only looking
@@ -1234,7 +1337,8 @@ BufferSync(int flags)
 		 * examine the bit here and the time SyncOneBuffer acquires lock,
 		 * someone else not only wrote the buffer but replaced it with another
 		 * page and dirtied it.  In that improbable case, SyncOneBuffer will
-		 * write the buffer though we didn't need to.  It doesn't seem worth
+		 * write the buffer though we didn't need to, and the writeback we
+		 * request for it covers the wrong block.  It doesn't seem worth
 		 * guarding against this, though.
 		 */
 		if (bufHdr->flags & BM_CHECKPOINT_NEEDED)
@@ -1245,33 +1349,25 @@ BufferSync(int flags)
 				BgWriterStats.m_buf_written_checkpoints++;
 				num_written++;
 
-				/*
-				 * We know there are at most num_to_write buffers with
-				 * BM_CHECKPOINT_NEEDED set; so we can stop scanning if
-				 * num_written reaches num_to_write.
-				 *
-				 * Note that num_written doesn't include buffers written by
-				 * other backends, or by the bgwriter cleaning scan. That
-				 * means that the estimate of how much progress we've made is
-				 * conservative, and also that this test will often fail to
-				 * trigger.  But it seems worth making anyway.
-				 */
-				if (num_written >= num_to_write)
-					break;
+				ScheduleBufferWriteback(item);
 
 				/*
-				 * Perform normal bgwriter duties and sleep to throttle our
-				 * I/O rate.
+				 * Absorb fsync requests and sleep to throttle our I/O rate.
+				 * Buffers written meanwhile by other backends or by the
+				 * bgwriter cleaning scan count as progress too, since we pass
+				 * over them in this loop.  The last part of the schedule is
+				 * left for mdsync().
 				 */
 				CheckpointWriteDelay(flags,
-									 (double) num_written / num_to_write);
+									 (1.0 - CHECKPOINT_SYNC_SHARE) *
+									 (double) (num_processed + 1) / num_to_write);
 			}
 		}
-
-		if (++buf_id >= NBuffers)
-			buf_id = 0;
 	}
 
+	/* Start writeback of whatever is left over */
+	IssuePendingWritebacks();
+
 	/*
 	 * Update checkpoint statistics. As noted above, this doesn't include
 	 * buffers written by other backends or bgwriter scan.
@@ -1281,6 +1377,96 @@ BufferSync(int flags)
 	TRACE_POSTGRESQL_BUFFER_SYNC_DONE(NBuffers, num_written, num_to_write);
 }
 
+/*
+ * qsort comparator for CkptSortItems: order by tablespace, database,
+ * relation, fork and block number, which is the order of the files and of
+ * the blocks within them on disk.
+ */
+static int
+ckpt_buforder_comparator(const void *pa, const void *pb)
+{
+	const CkptSortItem *a = (const CkptSortItem *) pa;
+	const CkptSortItem *b = (const CkptSortItem *) pb;
+
+	if (a->tsId != b->tsId)
+		return (a->tsId < b->tsId) ? -1 : 1;
+	if (a->dbId != b->dbId)
+		return (a->dbId < b->dbId) ? -1 : 1;
+	if (a->relNode != b->relNode)
+		return (a->relNode < b->relNode) ? -1 : 1;
+	if (a->forkNum != b->forkNum)
+		return (a->forkNum < b->forkNum) ? -1 : 1;
+	if (a->blockNum != b->blockNum)
+		return (a->blockNum < b->blockNum) ? -1 : 1;
+	return 0;
+}
+
+/*
+ * ScheduleBufferWriteback -- remember a checkpoint-written buffer so that the
+ * kernel can be asked to start writing it out.
+ *
+ * Once checkpoint_flush_after buffers have accumulated, the requests are
+ * issued.  This keeps the kernel's backlog of dirty data for the relation
+ * files small, so that the fsyncs at the end of the checkpoint don't have to
+ * push out gigabytes at once.
+ */
+static void
+ScheduleBufferWriteback(CkptSortItem *item)
+{
+	BufferTag  *tag;
+
+	if (checkpoint_flush_after <= 0)
+		return;
+
+	tag = &PendingWritebacks[NumPendingWritebacks++];
+	tag->rnode.spcNode = item->tsId;
+	tag->rnode.dbNode = item->dbId;
+	tag->rnode.relNode = item->relNode;
+	tag->forkNum = item->forkNum;
+	tag->blockNum = item->blockNum;
+
+	if (NumPendingWritebacks >= Min(checkpoint_flush_after,
+									WRITEBACK_MAX_PENDING_FLUSHES))
+		IssuePendingWritebacks();
+}
+
+/*
+ * IssuePendingWritebacks -- request writeback of the remembered buffers
+ *
+ * The tags arrive in BufferSync's sort order, so runs of consecutive blocks
+ * of the same relation fork are simply coalesced into one request.
+ */
+static void
+IssuePendingWritebacks(void)
+{
+	int			i = 0;
+
+	while (i < NumPendingWritebacks)
+	{
+		BufferTag  *tag = &PendingWritebacks[i];
+		BlockNumber nblocks = 1;
+		SMgrRelation reln;
+
+		while (i + nblocks < NumPendingWritebacks)
+		{
+			BufferTag  *next = &PendingWritebacks[i + nblocks];
+
+			if (!RelFileNodeEquals(next->rnode, tag->rnode) ||
+				next->forkNum != tag->forkNum ||
+				next->blockNum != tag->blockNum + nblocks)
+				break;
+			nblocks++;
+		}
+
+		reln = smgropen(tag->rnode, InvalidBackendId);
+		smgrwriteback(reln, tag->forkNum, tag->blockNum, nblocks);
+
+		i += nblocks;
+	}
+
+	NumPendingWritebacks = 0;
+}
+
 /*
  * BgBufferSync -- Write out some dirty buffers in the pool.
  *
@@ -1741,7 +1927,7 @@ CheckPointBuffers(int flags)
 	BufferSync(flags);
 	CheckpointStats.ckpt_sync_t = GetCurrentTimestamp();
 	TRACE_POSTGRESQL_BUFFER_CHECKPOINT_SYNC_START();
-	smgrsync();
+	smgrsync(flags);
 	CheckpointStats.ckpt_sync_end_t = GetCurrentTimestamp();
 	TRACE_POSTGRESQL_BUFFER_CHECKPOINT_DONE();
 }
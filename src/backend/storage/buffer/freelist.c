@@ -17,15 +17,44 @@
 
 #include "storage/buf_internals.h"
 #include "storage/bufmgr.h"
+#include "storage/spin.h"
 
 
+/*
+ * Atomic operations on the uint32 counters of the strategy control block.
+ *
+ * Where the compiler provides them, we use its atomic builtins, which are
+ * full memory barriers.  Elsewhere they are emulated with a spinlock, which
+ * is still far cheaper than the LWLock that used to protect the clock hand,
+ * since it is held for just the instructions below.
+ */
+#if defined(__GNUC__) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4)
+#define StrategyFetchAdd(ptr, add) \
+	__sync_fetch_and_add((ptr), (add))
+#define StrategyCompareExchange(ptr, oldval, newval) \
+	__sync_bool_compare_and_swap((ptr), (oldval), (newval))
+#else
+#define STRATEGY_EMULATE_ATOMICS
+#define StrategyFetchAdd(ptr, add) \
+	StrategyFetchAddEmulated((ptr), (add))
+#define StrategyCompareExchange(ptr, oldval, newval) \
+	StrategyCompareExchangeEmulated((ptr), (oldval), (newval))
+#endif
+
 /*
  * The shared freelist control information.
  */
 typedef struct
 {
-	/* Clock sweep hand: index of next buffer to consider grabbing */
-	int			nextVictimBuffer;
+	/* Spinlock: protects the freelist and completePasses */
+	slock_t		buffer_strategy_lock;
+
+	/*
+	 * Clock sweep hand: index of next buffer to consider grabbing.  It's
+	 * advanced atomically, and so may run past NBuffers for a while before
+	 * it's wrapped around; see ClockSweepTick.
+	 */
+	volatile uint32 nextVictimBuffer;
 
 	int			firstFreeBuffer;	/* Head of list of unused buffers */
 	int			lastFreeBuffer; /* Tail of list of unused buffers */
@@ -40,7 +69,11 @@ typedef struct
 	 * overflow during a single bgwriter cycle.
 	 */
 	uint32		completePasses; /* Complete cycles of the clock sweep */
-	uint32		numBufferAllocs;	/* Buffers allocated since last reset */
+	volatile uint32 numBufferAllocs;	/* Buffers allocated since last reset */
+
+#ifdef STRATEGY_EMULATE_ATOMICS
+	slock_t		atomics_lock;	/* protects the atomic counters */
+#endif
 } BufferStrategyControl;
 
 /* Pointers to shared state */
@@ -85,6 +118,86 @@ static volatile BufferDesc *GetBufferFromRing(BufferAccessStrategy strategy);
 static void AddBufferToRing(BufferAccessStrategy strategy,
 				volatile BufferDesc *buf);
 
+#ifdef STRATEGY_EMULATE_ATOMICS
+static uint32
+StrategyFetchAddEmulated(volatile uint32 *ptr, uint32 add)
+{
+	uint32		result;
+
+	SpinLockAcquire(&StrategyControl->atomics_lock);
+	result = *ptr;
+	*ptr = result + add;
+	SpinLockRelease(&StrategyControl->atomics_lock);
+	return result;
+}
+
+static bool
+StrategyCompareExchangeEmulated(volatile uint32 *ptr, uint32 oldval,
+								uint32 newval)
+{
+	bool		result;
+
+	SpinLockAcquire(&StrategyControl->atomics_lock);
+	result = (*ptr == oldval);
+	if (result)
+		*ptr = newval;
+	SpinLockRelease(&StrategyControl->atomics_lock);
+	return result;
+}
+#endif   /* STRATEGY_EMULATE_ATOMICS */
+
+/*
+ * ClockSweepTick - advance the clock hand, returning the buffer to look at
+ *
+ * Each caller gets a distinct value of the hand by incrementing it
+ * atomically.  Once the hand has gone past NBuffers, the caller that got the
+ * buffer numbered 0 wraps it back around and counts the complete pass; in
+ * the meantime, others just take their value modulo NBuffers.
+ */
+static int
+ClockSweepTick(void)
+{
+	volatile BufferStrategyControl *sc = StrategyControl;
+	uint32		victim;
+
+	victim = StrategyFetchAdd(&sc->nextVictimBuffer, 1);
+	if (victim >= (uint32) NBuffers)
+	{
+		uint32		originalVictim = victim;
+
+		victim = victim % NBuffers;
+
+		if (victim == 0)
+		{
+			uint32		expected = originalVictim + 1;
+
+			/*
+			 * Others may have advanced the hand further since we read it, so
+			 * retry with their value until we manage to wrap it.  Holding the
+			 * spinlock meanwhile keeps StrategySyncStart from seeing the hand
+			 * wrapped but the pass not yet counted.
+			 */
+			for (;;)
+			{
+				bool		wrapped;
+
+				SpinLockAcquire(&sc->buffer_strategy_lock);
+				wrapped = StrategyCompareExchange(&sc->nextVictimBuffer,
+												  expected,
+												  expected % NBuffers);
+				if (wrapped)
+					sc->completePasses++;
+				SpinLockRelease(&sc->buffer_strategy_lock);
+
+				if (wrapped)
+					break;
+				expected = sc->nextVictimBuffer;
+			}
+		}
+	}
+
+	return (int) victim;
+}
 
 /*
  * StrategyGetBuffer
@@ -96,59 +209,65 @@ static void AddBufferToRing(BufferAccessStrategy strategy,
  *	strategy is a BufferAccessStrategy object, or NULL for default strategy.
  *
  *	To ensure that no one else can pin the buffer before we do, we must
- *	return the buffer with the buffer header spinlock still held.  If
- *	*lock_held is set on exit, we have returned with the BufFreelistLock
- *	still held, as well; the caller must release that lock once the spinlock
- *	is dropped.  We do it that way because releasing the BufFreelistLock
- *	might awaken other processes, and it would be bad to do the associated
- *	kernel calls while holding the buffer header spinlock.
+ *	return the buffer with the buffer header spinlock still held.  No other
+ *	lock is held on return.
  */
 volatile BufferDesc *
-StrategyGetBuffer(BufferAccessStrategy strategy, bool *lock_held)
+StrategyGetBuffer(BufferAccessStrategy strategy)
 {
+	volatile BufferStrategyControl *sc = StrategyControl;
 	volatile BufferDesc *buf;
 	int			trycounter;
 
 	/*
 	 * If given a strategy object, see whether it can select a buffer. We
-	 * assume strategy objects don't need the BufFreelistLock.
+	 * assume strategy objects don't need any shared state.
 	 */
 	if (strategy != NULL)
 	{
 		buf = GetBufferFromRing(strategy);
 		if (buf != NULL)
-		{
-			*lock_held = false;
 			return buf;
-		}
 	}
 
-	/* Nope, so lock the freelist */
-	*lock_held = true;
-	LWLockAcquire(BufFreelistLock, LW_EXCLUSIVE);
-
 	/*
 	 * We count buffer allocation requests so that the bgwriter can estimate
 	 * the rate of buffer consumption.	Note that buffers recycled by a
 	 * strategy object are intentionally not counted here.
 	 */
-	StrategyControl->numBufferAllocs++;
+	StrategyFetchAdd(&sc->numBufferAllocs, 1);
 
 	/*
 	 * Try to get a buffer from the freelist.  Note that the freeNext fields
-	 * are considered to be protected by the BufFreelistLock not the
+	 * are considered to be protected by the buffer_strategy_lock not the
 	 * individual buffer spinlocks, so it's OK to manipulate them without
-	 * holding the spinlock.
+	 * holding the buffer spinlock.  The list is empty most of the time once
+	 * the buffer pool has filled up, so peek at it without the lock first;
+	 * at worst we miss a buffer that was just freed.
 	 */
-	while (StrategyControl->firstFreeBuffer >= 0)
+	while (sc->firstFreeBuffer >= 0)
 	{
-		buf = &BufferDescriptors[StrategyControl->firstFreeBuffer];
+		SpinLockAcquire(&sc->buffer_strategy_lock);
+
+		if (sc->firstFreeBuffer < 0)
+		{
+			SpinLockRelease(&sc->buffer_strategy_lock);
+			break;
+		}
+
+		buf = &BufferDescriptors[sc->firstFreeBuffer];
 		Assert(buf->freeNext != FREENEXT_NOT_IN_LIST);
 
 		/* Unconditionally remove buffer from freelist */
-		StrategyControl->firstFreeBuffer = buf->freeNext;
+		sc->firstFreeBuffer = buf->freeNext;
 		buf->freeNext = FREENEXT_NOT_IN_LIST;
 
+		/*
+		 * Release the lock before taking the buffer header spinlock, so that
+		 * we never hold two spinlocks at once.
+		 */
+		SpinLockRelease(&sc->buffer_strategy_lock);
+
 		/*
 		 * If the buffer is pinned or has a nonzero usage_count, we cannot use
 		 * it; discard it and retry.  (This can only happen if VACUUM put a
@@ -166,16 +285,26 @@ StrategyGetBuffer(BufferAccessStrategy strategy, bool *lock_held)
 		UnlockBufHdr(buf);
 	}
 
-	/* Nothing on the freelist, so run the "clock sweep" algorithm */
+	/*
+	 * Nothing on the freelist, so run the "clock sweep" algorithm.  No global
+	 * lock is needed: the hand is advanced atomically, and each buffer is
+	 * examined under its own header spinlock only.
+	 */
 	trycounter = NBuffers;
 	for (;;)
 	{
-		buf = &BufferDescriptors[StrategyControl->nextVictimBuffer];
+		buf = &BufferDescriptors[ClockSweepTick()];
 
-		if (++StrategyControl->nextVictimBuffer >= NBuffers)
+		/*
+		 * A pinned buffer is skipped without touching its usage_count, so
+		 * don't bother with its spinlock either.  A stale read is harmless:
+		 * at worst we pass over a buffer that has just been unpinned.
+		 */
+		if (buf->refcount != 0)
 		{
-			StrategyControl->nextVictimBuffer = 0;
-			StrategyControl->completePasses++;
+			if (--trycounter == 0)
+				elog(ERROR, "no unpinned buffers available");
+			continue;
 		}
 
 		/*
@@ -223,7 +352,9 @@ StrategyGetBuffer(BufferAccessStrategy strategy, bool *lock_held)
 void
 StrategyFreeBuffer(volatile BufferDesc *buf)
 {
-	LWLockAcquire(BufFreelistLock, LW_EXCLUSIVE);
+	volatile BufferStrategyControl *sc = StrategyControl;
+
+	SpinLockAcquire(&sc->buffer_strategy_lock);
 
 	/*
 	 * It is possible that we are told to put something in the freelist that
@@ -231,13 +362,13 @@ StrategyFreeBuffer(volatile BufferDesc *buf)
 	 */
 	if (buf->freeNext == FREENEXT_NOT_IN_LIST)
 	{
-		buf->freeNext = StrategyControl->firstFreeBuffer;
+		buf->freeNext = sc->firstFreeBuffer;
 		if (buf->freeNext < 0)
-			StrategyControl->lastFreeBuffer = buf->buf_id;
-		StrategyControl->firstFreeBuffer = buf->buf_id;
+			sc->lastFreeBuffer = buf->buf_id;
+		sc->firstFreeBuffer = buf->buf_id;
 	}
 
-	LWLockRelease(BufFreelistLock);
+	SpinLockRelease(&sc->buffer_strategy_lock);
 }
 
 /*
@@ -254,18 +385,37 @@ StrategyFreeBuffer(volatile BufferDesc *buf)
 int
 StrategySyncStart(uint32 *complete_passes, uint32 *num_buf_alloc)
 {
+	volatile BufferStrategyControl *sc = StrategyControl;
+	uint32		nextVictimBuffer;
 	int			result;
 
-	LWLockAcquire(BufFreelistLock, LW_EXCLUSIVE);
-	result = StrategyControl->nextVictimBuffer;
+	SpinLockAcquire(&sc->buffer_strategy_lock);
+	nextVictimBuffer = sc->nextVictimBuffer;
+	result = nextVictimBuffer % NBuffers;
+
 	if (complete_passes)
-		*complete_passes = StrategyControl->completePasses;
+	{
+		*complete_passes = sc->completePasses;
+
+		/*
+		 * Count the passes of a hand that has gone past NBuffers but hasn't
+		 * been wrapped around yet.
+		 */
+		*complete_passes += nextVictimBuffer / NBuffers;
+	}
+	SpinLockRelease(&sc->buffer_strategy_lock);
+
 	if (num_buf_alloc)
 	{
-		*num_buf_alloc = StrategyControl->numBufferAllocs;
-		StrategyControl->numBufferAllocs = 0;
+		uint32		nallocs;
+
+		do
+		{
+			nallocs = sc->numBufferAllocs;
+		} while (!StrategyCompareExchange(&sc->numBufferAllocs, nallocs, 0));
+		*num_buf_alloc = nallocs;
 	}
-	LWLockRelease(BufFreelistLock);
+
 	return result;
 }
 
@@ -331,6 +481,11 @@ StrategyInitialize(bool init)
 		 */
 		Assert(init);
 
+		SpinLockInit(&StrategyControl->buffer_strategy_lock);
+#ifdef STRATEGY_EMULATE_ATOMICS
+		SpinLockInit(&StrategyControl->atomics_lock);
+#endif
+
 		/*
 		 * Grab the whole linked list of free buffers for our strategy. We
 		 * assume it was previously set up by InitBufferPool().
@@ -29,6 +29,11 @@
  * BufFile also supports temporary files that exceed the OS file size limit
  * (by opening multiple fd.c temporary files).	This is an essential feature
  * for sorts and hashjoins on large amounts of data.
+ *
+ * A temporary BufFile can also be given a name, so that other backends
+ * working on the same query can open it for reading once its creator has
+ * flushed it (see BufFileCreateShared).  It is still deleted when its
+ * creator closes it.
  *-------------------------------------------------------------------------
  */
 
@@ -66,6 +71,8 @@ struct BufFile
 
 	bool		isTemp;			/* can only add files if this is TRUE */
 	bool		isInterXact;	/* keep open over transactions? */
+	char	   *name;			/* name of a shared file, else NULL */
+	Oid			tblspcOid;		/* tablespace of a shared file */
 	bool		dirty;			/* does buffer need to be written? */
 
 	/*
@@ -83,7 +90,7 @@ static BufFile *makeBufFile(File firstfile);
 static void extendBufFile(BufFile *file);
 static void BufFileLoadBuffer(BufFile *file);
 static void BufFileDumpBuffer(BufFile *file);
-static int	BufFileFlush(BufFile *file);
+static void SharedSegmentName(char *segname, const char *name, int segment);
 
 
 /*
@@ -102,6 +109,8 @@ makeBufFile(File firstfile)
 	file->offsets[0] = 0L;
 	file->isTemp = false;
 	file->isInterXact = false;
+	file->name = NULL;
+	file->tblspcOid = InvalidOid;
 	file->dirty = false;
 	file->curFile = 0;
 	file->curOffset = 0L;
@@ -120,7 +129,15 @@ extendBufFile(BufFile *file)
 	File		pfile;
 
 	Assert(file->isTemp);
-	pfile = OpenTemporaryFile(file->isInterXact);
+	if (file->name)
+	{
+		char		segname[MAXPGPATH];
+
+		SharedSegmentName(segname, file->name, file->numFiles);
+		pfile = OpenNamedTemporaryFile(file->tblspcOid, segname, true);
+	}
+	else
+		pfile = OpenTemporaryFile(file->isInterXact);
 	Assert(pfile >= 0);
 
 	file->files = (File *) repalloc(file->files,
@@ -159,6 +176,90 @@ BufFileCreateTemp(bool interXact)
 	return file;
 }
 
+/*
+ * Create a BufFile for a new named temporary file in the given tablespace.
+ *
+ * Other backends can open the file for reading with BufFileOpenShared, but
+ * only see what we have flushed with BufFileFlush.  The caller must make
+ * the name unique across the cluster.  Like a file made by
+ * BufFileCreateTemp, the file can grow beyond MAX_PHYSICAL_FILESIZE, and
+ * is deleted when we close it or at end of transaction.
+ */
+BufFile *
+BufFileCreateShared(Oid tblspcOid, const char *name)
+{
+	BufFile    *file;
+	File		pfile;
+	char		segname[MAXPGPATH];
+
+	SharedSegmentName(segname, name, 0);
+	pfile = OpenNamedTemporaryFile(tblspcOid, segname, true);
+	Assert(pfile >= 0);
+
+	file = makeBufFile(pfile);
+	file->isTemp = true;
+	file->name = pstrdup(name);
+	file->tblspcOid = tblspcOid;
+
+	return file;
+}
+
+/*
+ * Open a named temporary file made by BufFileCreateShared, possibly in
+ * another backend, for reading.  Returns NULL if there is no such file.
+ *
+ * Closing the result leaves the file in place for its creator to delete.
+ */
+BufFile *
+BufFileOpenShared(Oid tblspcOid, const char *name)
+{
+	BufFile    *file = NULL;
+	char		segname[MAXPGPATH];
+	int			segment;
+
+	for (segment = 0;; segment++)
+	{
+		File		pfile;
+
+		SharedSegmentName(segname, name, segment);
+		pfile = OpenNamedTemporaryFile(tblspcOid, segname, false);
+		if (pfile < 0)
+		{
+			if (errno != ENOENT)
+				ereport(ERROR,
+						(errcode_for_file_access(),
+						 errmsg("could not open temporary file \"%s\": %m",
+								segname)));
+			break;
+		}
+
+		if (file == NULL)
+			file = makeBufFile(pfile);
+		else
+		{
+			file->files = (File *) repalloc(file->files,
+										(file->numFiles + 1) * sizeof(File));
+			file->offsets = (off_t *) repalloc(file->offsets,
+									   (file->numFiles + 1) * sizeof(off_t));
+			file->files[file->numFiles] = pfile;
+			file->offsets[file->numFiles] = 0L;
+			file->numFiles++;
+		}
+	}
+
+	return file;
+}
+
+/*
+ * Build the name of one segment of a shared BufFile.  segname must have
+ * room for MAXPGPATH bytes.
+ */
+static void
+SharedSegmentName(char *segname, const char *name, int segment)
+{
+	snprintf(segname, MAXPGPATH, "%s.%d", name, segment);
+}
+
 #ifdef NOT_USED
 /*
  * Create a BufFile and attach it to an already-opened virtual File.
@@ -192,6 +293,8 @@ BufFileClose(BufFile *file)
 	/* release the buffer space */
 	pfree(file->files);
 	pfree(file->offsets);
+	if (file->name)
+		pfree(file->name);
 	pfree(file);
 }
 
@@ -432,7 +535,7 @@ BufFileWrite(BufFile *file, void *ptr, size_t size)
  *
  * Like fflush()
  */
-static int
+int
 BufFileFlush(BufFile *file)
 {
 	if (file->dirty)
@@ -246,6 +246,8 @@ static void FreeVfd(File file);
 
 static int	FileAccess(File file);
 static File OpenTemporaryFileInTablespace(Oid tblspcOid, bool rejectError);
+static void TempTablespacePath(char *path, Oid tblspcOid);
+static void RegisterTemporaryFile(File file);
 static void AtProcExit_Files(int code, Datum arg);
 static void CleanupTempFiles(bool isProcExit);
 static void RemovePgTempFilesInDir(const char *tmpdirname);
@@ -324,14 +326,21 @@ pg_fdatasync(int fd)
 }
 
 /*
- * pg_flush_data --- advise OS that the data described won't be needed soon
+ * pg_flush_data --- advise OS that the described dirty data should be
+ * written out soon
  *
- * Not all platforms have posix_fadvise; treat as noop if not available.
+ * Where sync_file_range() is available we use it to start writeback without
+ * waiting for it to complete, and without evicting the data from the kernel
+ * cache.  Otherwise fall back to posix_fadvise(POSIX_FADV_DONTNEED), which
+ * starts writeback too but also discards the pages.  Not all platforms have
+ * either; treat as noop if not available.
  */
 int
 pg_flush_data(int fd, off_t offset, off_t amount)
 {
-#if defined(USE_POSIX_FADVISE) && defined(POSIX_FADV_DONTNEED)
+#if defined(SYNC_FILE_RANGE_WRITE)
+	return sync_file_range(fd, offset, amount, SYNC_FILE_RANGE_WRITE);
+#elif defined(USE_POSIX_FADVISE) && defined(POSIX_FADV_DONTNEED)
 	return posix_fadvise(fd, offset, amount, POSIX_FADV_DONTNEED);
 #else
 	return 0;
@@ -871,8 +880,11 @@ PathNameOpenFile(FileName fileName, int fileFlags, int fileMode)
 
 	if (vfdP->fd < 0)
 	{
+		int			save_errno = errno;
+
 		FreeVfd(file);
 		free(fnamecopy);
+		errno = save_errno;
 		return -1;
 	}
 	++nfile;
@@ -946,47 +958,118 @@ OpenTemporaryFile(bool interXact)
 	if (!interXact)
 	{
 		VfdCache[file].fdstate |= FD_XACT_TEMPORARY;
-
-		ResourceOwnerEnlargeFiles(CurrentResourceOwner);
-		ResourceOwnerRememberFile(CurrentResourceOwner, file);
-		VfdCache[file].resowner = CurrentResourceOwner;
-
-		/* ensure cleanup happens at eoxact */
-		have_xact_temporary_files = true;
+		RegisterTemporaryFile(file);
 	}
 
 	return file;
 }
 
 /*
- * Open a temporary file in a specific tablespace.
- * Subroutine for OpenTemporaryFile, which see for details.
+ * Create or open a named temporary file, which other backends can open too.
+ *
+ * The file is made in the temporary file directory of the given tablespace,
+ * and its name is PG_TEMP_FILE_PREFIX followed by name; the caller must
+ * make the name unique, typically by including its PID.  If create is true,
+ * a new file is created, which is deleted when closed and is closed at the
+ * end of the transaction, like one made by OpenTemporaryFile.  Otherwise an
+ * existing file is opened for reading, and is left in place when closed;
+ * if there is no such file, we return -1 with errno set.
  */
-static File
-OpenTemporaryFileInTablespace(Oid tblspcOid, bool rejectError)
+File
+OpenNamedTemporaryFile(Oid tblspcOid, const char *name, bool create)
 {
 	char		tempdirpath[MAXPGPATH];
 	char		tempfilepath[MAXPGPATH];
 	File		file;
 
+	TempTablespacePath(tempdirpath, tblspcOid);
+	snprintf(tempfilepath, sizeof(tempfilepath), "%s/%s%s",
+			 tempdirpath, PG_TEMP_FILE_PREFIX, name);
+
+	if (!create)
+	{
+		file = PathNameOpenFile(tempfilepath, O_RDONLY | PG_BINARY, 0);
+		if (file >= 0)
+			RegisterTemporaryFile(file);
+		return file;
+	}
+
+	file = PathNameOpenFile(tempfilepath,
+							O_RDWR | O_CREAT | O_TRUNC | PG_BINARY,
+							0600);
+	if (file <= 0)
+	{
+		/* See OpenTemporaryFileInTablespace */
+		mkdir(tempdirpath, S_IRWXU);
+
+		file = PathNameOpenFile(tempfilepath,
+								O_RDWR | O_CREAT | O_TRUNC | PG_BINARY,
+								0600);
+		if (file <= 0)
+			elog(ERROR, "could not create temporary file \"%s\": %m",
+				 tempfilepath);
+	}
+
+	VfdCache[file].fdstate |= FD_TEMPORARY | FD_XACT_TEMPORARY;
+	RegisterTemporaryFile(file);
+
+	return file;
+}
+
+/*
+ * Remember a temporary file in the current resource owner, so that it is
+ * closed at the end of the transaction.
+ */
+static void
+RegisterTemporaryFile(File file)
+{
+	ResourceOwnerEnlargeFiles(CurrentResourceOwner);
+	ResourceOwnerRememberFile(CurrentResourceOwner, file);
+	VfdCache[file].resowner = CurrentResourceOwner;
+
+	/* ensure cleanup happens at eoxact */
+	have_xact_temporary_files = true;
+}
+
+/*
+ * Compute the temporary file directory of a tablespace.  path must have
+ * room for MAXPGPATH bytes.
+ */
+static void
+TempTablespacePath(char *path, Oid tblspcOid)
+{
 	/*
-	 * Identify the tempfile directory for this tablespace.
-	 *
 	 * If someone tries to specify pg_global, use pg_default instead.
 	 */
 	if (tblspcOid == DEFAULTTABLESPACE_OID ||
 		tblspcOid == GLOBALTABLESPACE_OID)
 	{
 		/* The default tablespace is {datadir}/base */
-		snprintf(tempdirpath, sizeof(tempdirpath), "base/%s",
-				 PG_TEMP_FILES_DIR);
+		snprintf(path, MAXPGPATH, "base/%s", PG_TEMP_FILES_DIR);
 	}
 	else
 	{
 		/* All other tablespaces are accessed via symlinks */
-		snprintf(tempdirpath, sizeof(tempdirpath), "pg_tblspc/%u/%s/%s",
+		snprintf(path, MAXPGPATH, "pg_tblspc/%u/%s/%s",
 				 tblspcOid, TABLESPACE_VERSION_DIRECTORY, PG_TEMP_FILES_DIR);
 	}
+}
+
+/*
+ * Open a temporary file in a specific tablespace.
+ * Subroutine for OpenTemporaryFile, which see for details.
+ */
+static File
+OpenTemporaryFileInTablespace(Oid tblspcOid, bool rejectError)
+{
+	char		tempdirpath[MAXPGPATH];
+	char		tempfilepath[MAXPGPATH];
+	File		file;
+
+	/*
+	 * Identify the tempfile directory for this tablespace.
+	 */
+	TempTablespacePath(tempdirpath, tblspcOid);
 
 	/*
 	 * Generate a tempfile name that should be unique within the current
@@ -1124,6 +1207,37 @@ FilePrefetch(File file, off_t offset, int amount)
 #endif
 }
 
+/*
+ * FileWriteback - ask the kernel to start writing out a range of the file
+ *
+ * This is only a hint, used to keep the kernel from accumulating a large
+ * amount of dirty data that a later fsync would then have to write all at
+ * once.  It is a no-op unless sync_file_range() is available, because the
+ * posix_fadvise() fallback of pg_flush_data() would also evict data that we
+ * are likely to want again.
+ */
+void
+FileWriteback(File file, off_t offset, off_t amount)
+{
+#if defined(SYNC_FILE_RANGE_WRITE)
+	Assert(FileIsValid(file));
+
+	DO_DB(elog(LOG, "FileWriteback: %d (%s) " INT64_FORMAT " " INT64_FORMAT,
+			   file, VfdCache[file].fileName,
+			   (int64) offset, (int64) amount));
+
+	if (amount <= 0)
+		return;
+
+	if (FileAccess(file) < 0)
+		return;
+
+	(void) pg_flush_data(VfdCache[file].fd, offset, amount);
+#else
+	Assert(FileIsValid(file));
+#endif
+}
+
 int
 FileRead(File file, char *buffer, int amount)
 {
@@ -0,0 +1,487 @@
+/*-------------------------------------------------------------------------
+ *
+ * shm_mq.c
+ *	  single-reader, single-writer shared memory message queue
+ *
+ * Both the sender and the receiver must have a PGPROC; their respective
+ * process latches are used for synchronization.  Only the sender may send,
+ * and only the receiver may receive.  This is intended to allow a parallel
+ * worker to stream results back to the backend that launched it, or the
+ * launching backend to hand out work to a worker.
+ *
+ * The queue is a ring buffer.  Each message is stored as a length word
+ * followed by the payload, both padded to MAXALIGN, so that the length word
+ * of the next message always starts at an aligned offset and can never wrap
+ * around the end of the ring.  The payload of a message can wrap, and a
+ * message may be larger than the ring itself: the sender simply waits for
+ * the receiver to make room and keeps going.
+ *
+ * The read and write positions are 64-bit byte counters that never wrap.
+ * They are only changed while holding the queue's spinlock, which also
+ * serves as the memory barrier that makes the copied bytes visible to the
+ * other side before the counter that covers them.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "miscadmin.h"
+#include "storage/shm_mq.h"
+#include "storage/spin.h"
+#include "utils/memutils.h"
+
+
+/*
+ * mq_receiver and mq_bytes_read can only be changed by the receiver;
+ * mq_sender and mq_bytes_written can only be changed by the sender.  Either
+ * side may set mq_detached.  All of them are protected by mq_mutex.
+ * mq_ring_size and mq_ring_offset never change after initialization.
+ */
+struct shm_mq
+{
+	slock_t		mq_mutex;
+	PGPROC	   *mq_receiver;
+	PGPROC	   *mq_sender;
+	uint64		mq_bytes_read;
+	uint64		mq_bytes_written;
+	Size		mq_ring_size;
+	bool		mq_detached;
+	uint8		mq_ring_offset;
+	char		mq_ring[1];		/* VARIABLE LENGTH ARRAY */
+};
+
+/*
+ * Receiver-side state.  A message that doesn't arrive in one piece is
+ * reassembled in mqh_buffer; mqh_partial_bytes counts the (padded) payload
+ * bytes consumed from the ring so far.
+ */
+struct shm_mq_handle
+{
+	shm_mq	   *mqh_queue;
+	char	   *mqh_buffer;
+	Size		mqh_buflen;
+	Size		mqh_partial_bytes;
+	Size		mqh_expected_bytes;
+	bool		mqh_length_word_complete;
+	MemoryContext mqh_context;
+};
+
+#define MQH_INITIAL_BUFSIZE		8192
+
+#define MQ_RING(mq)		((char *) (mq) + (mq)->mq_ring_offset)
+
+static shm_mq_result shm_mq_send_bytes(shm_mq *mq, Size nbytes,
+				  const void *data);
+static void shm_mq_inc_bytes_read(volatile shm_mq *mq, Size n);
+
+const Size	shm_mq_minimum_size =
+MAXALIGN(offsetof(shm_mq, mq_ring)) + MAXIMUM_ALIGNOF;
+
+
+/*
+ * Initialize a new shared message queue at the given address, which must be
+ * suitably aligned.  The ring occupies whatever part of 'size' is left over
+ * after the queue header, rounded down to a multiple of MAXALIGN.
+ */
+shm_mq *
+shm_mq_create(void *address, Size size)
+{
+	shm_mq	   *mq = address;
+	Size		data_offset = MAXALIGN(offsetof(shm_mq, mq_ring));
+
+	Assert(size >= shm_mq_minimum_size);
+	Assert(address == (void *) MAXALIGN(address));
+
+	SpinLockInit(&mq->mq_mutex);
+	mq->mq_receiver = NULL;
+	mq->mq_sender = NULL;
+	mq->mq_bytes_read = 0;
+	mq->mq_bytes_written = 0;
+	mq->mq_ring_size = MAXALIGN_DOWN(size - data_offset);
+	mq->mq_detached = false;
+	mq->mq_ring_offset = data_offset;
+
+	return mq;
+}
+
+/*
+ * Set the identity of the process that will receive from a queue.
+ */
+void
+shm_mq_set_receiver(shm_mq *mq, PGPROC *proc)
+{
+	volatile shm_mq *vmq = mq;
+
+	SpinLockAcquire(&mq->mq_mutex);
+	Assert(vmq->mq_receiver == NULL);
+	vmq->mq_receiver = proc;
+	SpinLockRelease(&mq->mq_mutex);
+}
+
+/*
+ * Set the identity of the process that will send to a queue.
+ */
+void
+shm_mq_set_sender(shm_mq *mq, PGPROC *proc)
+{
+	volatile shm_mq *vmq = mq;
+
+	SpinLockAcquire(&mq->mq_mutex);
+	Assert(vmq->mq_sender == NULL);
+	vmq->mq_sender = proc;
+	SpinLockRelease(&mq->mq_mutex);
+}
+
+/*
+ * Get the process that receives from a queue, or NULL if none has attached
+ * yet.
+ */
+PGPROC *
+shm_mq_get_receiver(shm_mq *mq)
+{
+	volatile shm_mq *vmq = mq;
+	PGPROC	   *receiver;
+
+	SpinLockAcquire(&mq->mq_mutex);
+	receiver = vmq->mq_receiver;
+	SpinLockRelease(&mq->mq_mutex);
+
+	return receiver;
+}
+
+/*
+ * Notify the other side that we're no longer going to send or receive
+ * anything.  Whatever the sender managed to write before detaching can
+ * still be read; after that the receiver gets SHM_MQ_DETACHED.  A sender
+ * gets SHM_MQ_DETACHED as soon as the receiver has gone away.
+ */
+void
+shm_mq_detach(shm_mq *mq)
+{
+	volatile shm_mq *vmq = mq;
+	PGPROC	   *victim;
+
+	SpinLockAcquire(&mq->mq_mutex);
+	vmq->mq_detached = true;
+	if (vmq->mq_receiver == MyProc)
+		victim = vmq->mq_sender;
+	else
+		victim = vmq->mq_receiver;
+	SpinLockRelease(&mq->mq_mutex);
+
+	if (victim != NULL)
+		SetLatch(&victim->procLatch);
+}
+
+/*
+ * Write a message into a shared message queue.
+ *
+ * This waits, if necessary, until the receiver has made enough room.
+ * Returns SHM_MQ_DETACHED if the receiver has gone away.
+ */
+shm_mq_result
+shm_mq_send(shm_mq *mq, Size nbytes, const void *data)
+{
+	volatile shm_mq *vmq = mq;
+	shm_mq_result res;
+	PGPROC	   *receiver;
+
+	Assert(vmq->mq_sender == MyProc);
+
+	/* Write the length word first, then the payload. */
+	res = shm_mq_send_bytes(mq, sizeof(Size), &nbytes);
+	if (res != SHM_MQ_SUCCESS)
+		return res;
+	res = shm_mq_send_bytes(mq, nbytes, data);
+	if (res != SHM_MQ_SUCCESS)
+		return res;
+
+	/* Let the receiver know there's a complete message waiting. */
+	SpinLockAcquire(&mq->mq_mutex);
+	receiver = vmq->mq_receiver;
+	SpinLockRelease(&mq->mq_mutex);
+	if (receiver != NULL)
+		SetLatch(&receiver->procLatch);
+
+	return SHM_MQ_SUCCESS;
+}
+
+/*
+ * Write a message into a shared message queue, but only if it fits into the
+ * ring in its entirety right now.
+ *
+ * Returns SHM_MQ_WOULD_BLOCK, having written nothing, if it doesn't; a
+ * message larger than the ring can therefore never be sent this way.  Since
+ * there is only one sender, a message that fits can be written without
+ * waiting.  This lets a sender that is also receiving from the same process
+ * avoid blocking on a full queue while the other side blocks on it.
+ */
+shm_mq_result
+shm_mq_try_send(shm_mq *mq, Size nbytes, const void *data)
+{
+	volatile shm_mq *vmq = mq;
+	uint64		rb;
+	uint64		wb;
+	bool		detached;
+
+	Assert(vmq->mq_sender == MyProc);
+
+	SpinLockAcquire(&mq->mq_mutex);
+	rb = vmq->mq_bytes_read;
+	wb = vmq->mq_bytes_written;
+	detached = vmq->mq_detached;
+	SpinLockRelease(&mq->mq_mutex);
+
+	if (detached)
+		return SHM_MQ_DETACHED;
+
+	if (MAXALIGN(sizeof(Size)) + MAXALIGN(nbytes) >
+		mq->mq_ring_size - (Size) (wb - rb))
+		return SHM_MQ_WOULD_BLOCK;
+
+	return shm_mq_send(mq, nbytes, data);
+}
+
+/*
+ * Write bytes into the ring, followed by enough padding to reach the next
+ * MAXALIGN boundary.  The padding is not actually written; we just advance
+ * the write position over it.
+ */
+static shm_mq_result
+shm_mq_send_bytes(shm_mq *mq, Size nbytes, const void *data)
+{
+	volatile shm_mq *vmq = mq;
+	Size		ringsize = mq->mq_ring_size;
+	Size		total = MAXALIGN(nbytes);
+	Size		sent = 0;
+
+	while (sent < total)
+	{
+		uint64		rb;
+		uint64		wb;
+		bool		detached;
+		PGPROC	   *receiver;
+		Size		available;
+		Size		offset;
+		Size		sendnow;
+
+		SpinLockAcquire(&mq->mq_mutex);
+		rb = vmq->mq_bytes_read;
+		wb = vmq->mq_bytes_written;
+		detached = vmq->mq_detached;
+		receiver = vmq->mq_receiver;
+		SpinLockRelease(&mq->mq_mutex);
+
+		if (detached)
+			return SHM_MQ_DETACHED;
+
+		Assert(wb - rb <= ringsize);
+		available = ringsize - (Size) (wb - rb);
+		if (available == 0)
+		{
+			/*
+			 * The ring is full.  Make sure the receiver knows there's data to
+			 * be read, then wait for it to consume some.
+			 */
+			if (receiver != NULL)
+				SetLatch(&receiver->procLatch);
+			WaitLatch(&MyProc->procLatch, -1L);
+			ResetLatch(&MyProc->procLatch);
+			CHECK_FOR_INTERRUPTS();
+			continue;
+		}
+
+		offset = (Size) (wb % ringsize);
+		sendnow = Min(available, ringsize - offset);
+		sendnow = Min(sendnow, total - sent);
+
+		/* Copy the part of this chunk that isn't padding. */
+		if (sent < nbytes)
+			memcpy(&MQ_RING(mq)[offset], (const char *) data + sent,
+				   Min(sendnow, nbytes - sent));
+		sent += sendnow;
+
+		/* Acquiring the spinlock orders the copy before the update. */
+		SpinLockAcquire(&mq->mq_mutex);
+		vmq->mq_bytes_written += sendnow;
+		SpinLockRelease(&mq->mq_mutex);
+	}
+
+	return SHM_MQ_SUCCESS;
+}
+
+/*
+ * Prepare to receive from a queue.  The returned handle, and the buffer
+ * it uses to reassemble messages, live in the current memory context.
+ */
+shm_mq_handle *
+shm_mq_attach(shm_mq *mq)
+{
+	shm_mq_handle *mqh = palloc(sizeof(shm_mq_handle));
+
+	mqh->mqh_queue = mq;
+	mqh->mqh_buffer = NULL;
+	mqh->mqh_buflen = 0;
+	mqh->mqh_partial_bytes = 0;
+	mqh->mqh_expected_bytes = 0;
+	mqh->mqh_length_word_complete = false;
+	mqh->mqh_context = CurrentMemoryContext;
+
+	return mqh;
+}
+
+/*
+ * Release a handle obtained from shm_mq_attach.  This does not detach from
+ * the queue.
+ */
+void
+shm_mq_handle_free(shm_mq_handle *mqh)
+{
+	if (mqh->mqh_buffer != NULL)
+		pfree(mqh->mqh_buffer);
+	pfree(mqh);
+}
+
+/*
+ * Receive a message from a shared message queue.
+ *
+ * On success, *nbytesp and *datap are set to the length and location of
+ * the message.  The data is only valid until the next call on this handle.
+ * If nowait is true and no complete message is available, we return
+ * SHM_MQ_WOULD_BLOCK; whatever part of the message has already arrived is
+ * remembered, so the caller can simply try again later.  Once the sender
+ * has detached and everything it wrote has been read, we return
+ * SHM_MQ_DETACHED.
+ */
+shm_mq_result
+shm_mq_receive(shm_mq_handle *mqh, Size *nbytesp, void **datap, bool nowait)
+{
+	shm_mq	   *mq = mqh->mqh_queue;
+	volatile shm_mq *vmq = mq;
+	Size		ringsize = mq->mq_ring_size;
+
+	Assert(vmq->mq_receiver == MyProc);
+
+	for (;;)
+	{
+		uint64		rb;
+		uint64		wb;
+		bool		detached;
+		Size		used;
+
+		SpinLockAcquire(&mq->mq_mutex);
+		rb = vmq->mq_bytes_read;
+		wb = vmq->mq_bytes_written;
+		detached = vmq->mq_detached;
+		SpinLockRelease(&mq->mq_mutex);
+
+		used = (Size) (wb - rb);
+
+		if (!mqh->mqh_length_word_complete)
+		{
+			Size		lengthbytes = MAXALIGN(sizeof(Size));
+
+			if (used >= lengthbytes)
+			{
+				Size		needed;
+
+				/* The length word never wraps; see comments at top. */
+				memcpy(&mqh->mqh_expected_bytes,
+					   &MQ_RING(mq)[rb % ringsize], sizeof(Size));
+				shm_mq_inc_bytes_read(vmq, lengthbytes);
+				mqh->mqh_length_word_complete = true;
+				mqh->mqh_partial_bytes = 0;
+
+				/* Make sure we've got room to reassemble the message. */
+				needed = Max(mqh->mqh_expected_bytes, 1);
+				if (mqh->mqh_buflen < needed)
+				{
+					Size		newbuflen = Max(mqh->mqh_buflen,
+												MQH_INITIAL_BUFSIZE);
+
+					while (newbuflen < needed)
+						newbuflen *= 2;
+					if (mqh->mqh_buffer != NULL)
+						pfree(mqh->mqh_buffer);
+					mqh->mqh_buffer = MemoryContextAlloc(mqh->mqh_context,
+														 newbuflen);
+					mqh->mqh_buflen = newbuflen;
+				}
+				continue;
+			}
+		}
+		else
+		{
+			Size		expected = mqh->mqh_expected_bytes;
+			Size		total = MAXALIGN(expected);
+
+			if (mqh->mqh_partial_bytes < total && used > 0)
+			{
+				Size		offset = (Size) (rb % ringsize);
+				Size		readnow;
+
+				readnow = Min(used, ringsize - offset);
+				readnow = Min(readnow, total - mqh->mqh_partial_bytes);
+
+				/* Copy the part of this chunk that isn't padding. */
+				if (mqh->mqh_partial_bytes < expected)
+					memcpy(mqh->mqh_buffer + mqh->mqh_partial_bytes,
+						   &MQ_RING(mq)[offset],
+						   Min(readnow, expected - mqh->mqh_partial_bytes));
+				mqh->mqh_partial_bytes += readnow;
+				shm_mq_inc_bytes_read(vmq, readnow);
+			}
+
+			if (mqh->mqh_partial_bytes >= total)
+			{
+				/* Got the whole message; reset state for the next one. */
+				mqh->mqh_length_word_complete = false;
+				mqh->mqh_partial_bytes = 0;
+				*nbytesp = expected;
+				*datap = mqh->mqh_buffer;
+				return SHM_MQ_SUCCESS;
+			}
+
+			if (used > 0)
+				continue;
+		}
+
+		/*
+		 * Nothing more to read right now.  Since we fetched mq_detached
+		 * together with mq_bytes_written, a detached sender can't have
+		 * written anything we haven't seen yet.
+		 */
+		if (detached)
+			return SHM_MQ_DETACHED;
+		if (nowait)
+			return SHM_MQ_WOULD_BLOCK;
+
+		WaitLatch(&MyProc->procLatch, -1L);
+		ResetLatch(&MyProc->procLatch);
+		CHECK_FOR_INTERRUPTS();
+	}
+}
+
+/*
+ * Advance the read position, and wake the sender, which may be waiting for
+ * room in the ring.
+ */
+static void
+shm_mq_inc_bytes_read(volatile shm_mq *mq, Size n)
+{
+	PGPROC	   *sender;
+
+	SpinLockAcquire(&mq->mq_mutex);
+	mq->mq_bytes_read += n;
+	sender = mq->mq_sender;
+	SpinLockRelease(&mq->mq_mutex);
+
+	if (sender != NULL)
+		SetLatch(&sender->procLatch);
+}
@@ -36,9 +36,11 @@
 #include <sys/time.h>
 
 #include "access/transam.h"
+#include "access/twophase.h"
 #include "access/xact.h"
 #include "miscadmin.h"
 #include "postmaster/autovacuum.h"
+#include "postmaster/parallelworker.h"
 #include "storage/ipc.h"
 #include "storage/lmgr.h"
 #include "storage/pmsignal.h"
@@ -53,8 +55,9 @@ int			DeadlockTimeout = 1000;
 int			StatementTimeout = 0;
 bool		log_lock_waits = false;
 
-/* Pointer to this process's PGPROC struct, if any */
+/* Pointer to this process's PGPROC and PGXACT structs, if any */
 PGPROC	   *MyProc = NULL;
+PGXACT	   *MyPgXact = NULL;
 
 /*
  * This spinlock protects the freelist of recycled PGPROC structures.
@@ -66,8 +69,9 @@ PGPROC	   *MyProc = NULL;
 NON_EXEC_STATIC slock_t *ProcStructLock = NULL;
 
 /* Pointers to shared-memory structures */
-NON_EXEC_STATIC PROC_HDR *ProcGlobal = NULL;
+PROC_HDR   *ProcGlobal = NULL;
 NON_EXEC_STATIC PGPROC *AuxiliaryProcs = NULL;
+PGPROC	   *PreparedXactProcs = NULL;
 
 /* If we are waiting for a lock, this points to the associated LOCALLOCK */
 static LOCALLOCK *lockAwaited = NULL;
@@ -104,10 +108,15 @@ ProcGlobalShmemSize(void)
 
 	/* ProcGlobal */
 	size = add_size(size, sizeof(PROC_HDR));
+	/* MyProcs, including autovacuum and parallel workers and launcher */
+	size = add_size(size, mul_size(MaxBackends, sizeof(PGPROC)));
 	/* AuxiliaryProcs */
 	size = add_size(size, mul_size(NUM_AUXILIARY_PROCS, sizeof(PGPROC)));
-	/* MyProcs, including autovacuum workers and launcher */
-	size = add_size(size, mul_size(MaxBackends, sizeof(PGPROC)));
+	/* Prepared xacts */
+	size = add_size(size, mul_size(max_prepared_xacts, sizeof(PGPROC)));
+	/* PGXACTs for all of the above */
+	size = add_size(size, mul_size(MaxBackends + NUM_AUXILIARY_PROCS +
+								   max_prepared_xacts, sizeof(PGXACT)));
 	/* ProcStructLock */
 	size = add_size(size, sizeof(slock_t));
 	/* startupBufferPinWaitBufId */
@@ -123,8 +132,8 @@ int
 ProcGlobalSemas(void)
 {
 	/*
-	 * We need a sema per backend (including autovacuum), plus one for each
-	 * auxiliary process.
+	 * We need a sema per backend (including autovacuum and parallel workers),
+	 * plus one for each auxiliary process.
 	 */
 	return MaxBackends + NUM_AUXILIARY_PROCS;
 }
@@ -157,74 +166,104 @@ void
 InitProcGlobal(void)
 {
 	PGPROC	   *procs;
+	PGXACT	   *pgxacts;
 	int			i;
 	bool		found;
+	uint32		TotalProcs = MaxBackends + NUM_AUXILIARY_PROCS + max_prepared_xacts;
 
 	/* Create the ProcGlobal shared structure */
 	ProcGlobal = (PROC_HDR *)
 		ShmemInitStruct("Proc Header", sizeof(PROC_HDR), &found);
 	Assert(!found);
 
-	/*
-	 * Create the PGPROC structures for auxiliary (bgwriter) processes, too.
-	 * These do not get linked into the freeProcs list.
-	 */
-	AuxiliaryProcs = (PGPROC *)
-		ShmemInitStruct("AuxiliaryProcs", NUM_AUXILIARY_PROCS * sizeof(PGPROC),
-						&found);
-	Assert(!found);
-
 	/*
 	 * Initialize the data structures.
 	 */
 	ProcGlobal->freeProcs = NULL;
 	ProcGlobal->autovacFreeProcs = NULL;
+	ProcGlobal->parallelFreeProcs = NULL;
 
 	ProcGlobal->spins_per_delay = DEFAULT_SPINS_PER_DELAY;
 
 	/*
-	 * Pre-create the PGPROC structures and create a semaphore for each.
+	 * Create and initialize all the PGPROC structures we'll need, in a single
+	 * array so that the fast-path lock code can find all of them.  There are
+	 * five separate consumers: (1) normal backends, (2) autovacuum workers
+	 * and the autovacuum launcher, (3) parallel workers, (4) auxiliary
+	 * processes, and (5) prepared transactions.  Each PGPROC structure is
+	 * dedicated to exactly one of these purposes, and they do not move
+	 * between groups.
 	 */
-	procs = (PGPROC *) ShmemAlloc((MaxConnections) * sizeof(PGPROC));
+	procs = (PGPROC *) ShmemAlloc(TotalProcs * sizeof(PGPROC));
 	if (!procs)
 		ereport(FATAL,
 				(errcode(ERRCODE_OUT_OF_MEMORY),
 				 errmsg("out of shared memory")));
-	MemSet(procs, 0, MaxConnections * sizeof(PGPROC));
-	for (i = 0; i < MaxConnections; i++)
-	{
-		PGSemaphoreCreate(&(procs[i].sem));
-		procs[i].links.next = (SHM_QUEUE *) ProcGlobal->freeProcs;
-		ProcGlobal->freeProcs = &procs[i];
-	}
+	MemSet(procs, 0, TotalProcs * sizeof(PGPROC));
+	ProcGlobal->allProcs = procs;
+	/* The prepared-xact dummies never hold fast-path locks */
+	ProcGlobal->allProcCount = MaxBackends + NUM_AUXILIARY_PROCS;
 
 	/*
-	 * Likewise for the PGPROCs reserved for autovacuum.
-	 *
-	 * Note: the "+1" here accounts for the autovac launcher
+	 * Also allocate a separate array of PGXACT structures, one for each
+	 * PGPROC.  See the comments on PGXACT in proc.h.
 	 */
-	procs = (PGPROC *) ShmemAlloc((autovacuum_max_workers + 1) * sizeof(PGPROC));
-	if (!procs)
+	pgxacts = (PGXACT *) ShmemAlloc(TotalProcs * sizeof(PGXACT));
+	if (!pgxacts)
 		ereport(FATAL,
 				(errcode(ERRCODE_OUT_OF_MEMORY),
 				 errmsg("out of shared memory")));
-	MemSet(procs, 0, (autovacuum_max_workers + 1) * sizeof(PGPROC));
-	for (i = 0; i < autovacuum_max_workers + 1; i++)
+	MemSet(pgxacts, 0, TotalProcs * sizeof(PGXACT));
+	ProcGlobal->allPgXact = pgxacts;
+
+	for (i = 0; i < TotalProcs; i++)
 	{
+		/* Common initialization for all PGPROCs, regardless of type. */
+		procs[i].pgprocno = i;
+
+		/*
+		 * Set up per-PGPROC semaphore, latch, and backendLock.  Prepared
+		 * xact dummy PGPROCs don't need these, though --- they're never
+		 * associated with a real process.
+		 */
+		if (i >= MaxBackends + NUM_AUXILIARY_PROCS)
+			continue;
 		PGSemaphoreCreate(&(procs[i].sem));
-		procs[i].links.next = (SHM_QUEUE *) ProcGlobal->autovacFreeProcs;
-		ProcGlobal->autovacFreeProcs = &procs[i];
+		InitSharedLatch(&(procs[i].procLatch));
+		procs[i].backendLock = LWLockAssign();
+
+		/*
+		 * Newly created PGPROCs for normal backends, autovacuum and parallel
+		 * workers must be queued up on the appropriate free list.  Auxiliary
+		 * processes are not linked into any free list; they use the
+		 * AuxiliaryProcs pointer set up below instead.
+		 *
+		 * Note: the "+1" accounts for the autovac launcher.
+		 */
+		if (i < MaxConnections)
+		{
+			procs[i].links.next = (SHM_QUEUE *) ProcGlobal->freeProcs;
+			ProcGlobal->freeProcs = &procs[i];
+		}
+		else if (i < MaxConnections + autovacuum_max_workers + 1)
+		{
+			procs[i].links.next = (SHM_QUEUE *) ProcGlobal->autovacFreeProcs;
+			ProcGlobal->autovacFreeProcs = &procs[i];
+		}
+		else if (i < MaxBackends)
+		{
+			procs[i].links.next = (SHM_QUEUE *) ProcGlobal->parallelFreeProcs;
+			ProcGlobal->parallelFreeProcs = &procs[i];
+		}
 	}
 
 	/*
-	 * And auxiliary procs.
+	 * Save a pointer to the block of PGPROC structures reserved for
+	 * auxiliary processes.  Their pid is zero, which marks them as not in
+	 * use.
 	 */
-	MemSet(AuxiliaryProcs, 0, NUM_AUXILIARY_PROCS * sizeof(PGPROC));
-	for (i = 0; i < NUM_AUXILIARY_PROCS; i++)
-	{
-		AuxiliaryProcs[i].pid = 0;		/* marks auxiliary proc as not in use */
-		PGSemaphoreCreate(&(AuxiliaryProcs[i].sem));
-	}
+	AuxiliaryProcs = &procs[MaxBackends];
+	PreparedXactProcs = &procs[MaxBackends + NUM_AUXILIARY_PROCS];
 
 	/* Create ProcStructLock spinlock, too */
 	ProcStructLock = (slock_t *) ShmemAlloc(sizeof(slock_t));
@@ -264,6 +303,8 @@ InitProcess(void)
 
 	if (IsAnyAutoVacuumProcess())
 		MyProc = procglobal->autovacFreeProcs;
+	else if (IsParallelWorkerProcess())
+		MyProc = procglobal->parallelFreeProcs;
 	else
 		MyProc = procglobal->freeProcs;
 
@@ -271,6 +312,8 @@ InitProcess(void)
 	{
 		if (IsAnyAutoVacuumProcess())
 			procglobal->autovacFreeProcs = (PGPROC *) MyProc->links.next;
+		else if (IsParallelWorkerProcess())
+			procglobal->parallelFreeProcs = (PGPROC *) MyProc->links.next;
 		else
 			procglobal->freeProcs = (PGPROC *) MyProc->links.next;
 		SpinLockRelease(ProcStructLock);
@@ -302,26 +345,34 @@ InitProcess(void)
 	 * Initialize all fields of MyProc, except for the semaphore which was
 	 * prepared for us by InitProcGlobal.
 	 */
+	MyPgXact = &ProcGlobal->allPgXact[MyProc->pgprocno];
 	SHMQueueElemInit(&(MyProc->links));
 	MyProc->waitStatus = STATUS_OK;
 	MyProc->lxid = InvalidLocalTransactionId;
-	MyProc->xid = InvalidTransactionId;
-	MyProc->xmin = InvalidTransactionId;
+	MyPgXact->xid = InvalidTransactionId;
+	MyPgXact->xmin = InvalidTransactionId;
 	MyProc->pid = MyProcPid;
 	/* backendId, databaseId and roleId will be filled in later */
 	MyProc->backendId = InvalidBackendId;
 	MyProc->databaseId = InvalidOid;
 	MyProc->roleId = InvalidOid;
-	MyProc->inCommit = false;
-	MyProc->vacuumFlags = 0;
+	MyPgXact->inCommit = false;
+	MyPgXact->vacuumFlags = 0;
 	/* NB -- autovac launcher intentionally does not set IS_AUTOVACUUM */
 	if (IsAutoVacuumWorkerProcess())
-		MyProc->vacuumFlags |= PROC_IS_AUTOVACUUM;
+		MyPgXact->vacuumFlags |= PROC_IS_AUTOVACUUM;
+	MyPgXact->overflowed = false;
+	MyPgXact->nxids = 0;
 	MyProc->lwWaiting = false;
 	MyProc->lwExclusive = false;
 	MyProc->lwWaitLink = NULL;
+	MyProc->flushWaiting = false;
+	MyProc->flushLeader = false;
+	MyProc->flushWaitLink = NULL;
 	MyProc->waitLock = NULL;
 	MyProc->waitProcLock = NULL;
+	MyProc->fpLockBits = 0;
+	MemSet(MyProc->fpRelId, 0, sizeof(MyProc->fpRelId));
 	for (i = 0; i < NUM_LOCK_PARTITIONS; i++)
 		SHMQueueInit(&(MyProc->myProcLocks[i]));
 	MyProc->recoveryConflictPending = false;
@@ -333,6 +384,11 @@ InitProcess(void)
 	 */
 	PGSemaphoreReset(&MyProc->sem);
 
+	/*
+	 * Acquire ownership of the PGPROC's latch, so that we can use WaitLatch.
+	 */
+	OwnLatch(&MyProc->procLatch);
+
 	/*
 	 * Arrange to clean up at backend exit.
 	 */
@@ -442,21 +498,29 @@ InitAuxiliaryProcess(void)
 	 * Initialize all fields of MyProc, except for the semaphore which was
 	 * prepared for us by InitProcGlobal.
 	 */
+	MyPgXact = &ProcGlobal->allPgXact[MyProc->pgprocno];
 	SHMQueueElemInit(&(MyProc->links));
 	MyProc->waitStatus = STATUS_OK;
 	MyProc->lxid = InvalidLocalTransactionId;
-	MyProc->xid = InvalidTransactionId;
-	MyProc->xmin = InvalidTransactionId;
+	MyPgXact->xid = InvalidTransactionId;
+	MyPgXact->xmin = InvalidTransactionId;
 	MyProc->backendId = InvalidBackendId;
 	MyProc->databaseId = InvalidOid;
 	MyProc->roleId = InvalidOid;
-	MyProc->inCommit = false;
-	MyProc->vacuumFlags = 0;
+	MyPgXact->inCommit = false;
+	MyPgXact->vacuumFlags = 0;
+	MyPgXact->overflowed = false;
+	MyPgXact->nxids = 0;
 	MyProc->lwWaiting = false;
 	MyProc->lwExclusive = false;
 	MyProc->lwWaitLink = NULL;
+	MyProc->flushWaiting = false;
+	MyProc->flushLeader = false;
+	MyProc->flushWaitLink = NULL;
 	MyProc->waitLock = NULL;
 	MyProc->waitProcLock = NULL;
+	MyProc->fpLockBits = 0;
+	MemSet(MyProc->fpRelId, 0, sizeof(MyProc->fpRelId));
 	for (i = 0; i < NUM_LOCK_PARTITIONS; i++)
 		SHMQueueInit(&(MyProc->myProcLocks[i]));
 
@@ -467,6 +531,11 @@ InitAuxiliaryProcess(void)
 	 */
 	PGSemaphoreReset(&MyProc->sem);
 
+	/*
+	 * Acquire ownership of the PGPROC's latch, so that we can use WaitLatch.
+	 */
+	OwnLatch(&MyProc->procLatch);
+
 	/*
 	 * Arrange to clean up at process exit.
 	 */
@@ -573,6 +642,13 @@ LockWaitCancel(void)
 {
 	LWLockId	partitionLock;
 
+	/*
+	 * If we were in the middle of acquiring a strong relation lock, forget
+	 * about it; the lock acquisition will be retried, if at all, from
+	 * scratch.  This must be done whether or not we were waiting.
+	 */
+	AbortStrongLockAcquire();
+
 	/* Nothing to do if we weren't waiting for a lock */
 	if (lockAwaited == NULL)
 		return;
@@ -673,6 +749,9 @@ ProcKill(int code, Datum arg)
 	 */
 	LWLockReleaseAll();
 
+	/* Release ownership of the process's latch, too */
+	DisownLatch(&MyProc->procLatch);
+
 	SpinLockAcquire(ProcStructLock);
 
 	/* Return PGPROC structure (and semaphore) to appropriate freelist */
@@ -681,6 +760,11 @@ ProcKill(int code, Datum arg)
 		MyProc->links.next = (SHM_QUEUE *) procglobal->autovacFreeProcs;
 		procglobal->autovacFreeProcs = MyProc;
 	}
+	else if (IsParallelWorkerProcess())
+	{
+		MyProc->links.next = (SHM_QUEUE *) procglobal->parallelFreeProcs;
+		procglobal->parallelFreeProcs = MyProc;
+	}
 	else
 	{
 		MyProc->links.next = (SHM_QUEUE *) procglobal->freeProcs;
@@ -728,6 +812,9 @@ AuxiliaryProcKill(int code, Datum arg)
 	/* Release any LW locks I am holding (see notes above) */
 	LWLockReleaseAll();
 
+	/* Release ownership of the process's latch, too */
+	DisownLatch(&MyProc->procLatch);
+
 	SpinLockAcquire(ProcStructLock);
 
 	/* Mark auxiliary proc no longer in use */
@@ -979,16 +1066,19 @@ ProcSleep(LOCALLOCK *locallock, LockMethod lockMethodTable)
 		if (deadlock_state == DS_BLOCKED_BY_AUTOVACUUM && allow_autovacuum_cancel)
 		{
 			PGPROC	   *autovac = GetBlockingAutoVacuumPgproc();
+			uint8		vacuumFlags = 0;
 
 			LWLockAcquire(ProcArrayLock, LW_EXCLUSIVE);
 
+			if (autovac != NULL)
+				vacuumFlags = ProcGlobal->allPgXact[autovac->pgprocno].vacuumFlags;
+
 			/*
 			 * Only do it if the worker is not working to protect against Xid
 			 * wraparound.
 			 */
-			if ((autovac != NULL) &&
-				(autovac->vacuumFlags & PROC_IS_AUTOVACUUM) &&
-				!(autovac->vacuumFlags & PROC_VACUUM_FOR_WRAPAROUND))
+			if ((vacuumFlags & PROC_IS_AUTOVACUUM) &&
+				!(vacuumFlags & PROC_VACUUM_FOR_WRAPAROUND))
 			{
 				int			pid = autovac->pid;
 
@@ -18,6 +18,8 @@
 #include <fcntl.h>
 #include <sys/file.h>
 
+#include "access/xlog.h"
+#include "bootstrap/bootstrap.h"
 #include "catalog/catalog.h"
 #include "miscadmin.h"
 #include "postmaster/bgwriter.h"
@@ -103,7 +105,7 @@ static MemoryContext MdCxt;		/* context for all md.c allocations */
 
 
 /*
- * In some contexts (currently, standalone backends and the bgwriter process)
+ * In some contexts (currently, standalone backends and the checkpointer)
  * we keep track of pending fsync operations: we need to remember all relation
  * segments that have been written since the last checkpoint, so that we can
  * fsync them down to disk before completing the next checkpoint.  This hash
@@ -115,7 +117,7 @@ static MemoryContext MdCxt;		/* context for all md.c allocations */
  * a hash table, because we don't expect there to be any duplicate requests.
  *
  * (Regular backends do not track pending operations locally, but forward
- * them to the bgwriter.)
+ * them to the checkpointer.)
  */
 typedef struct
 {
@@ -184,11 +186,12 @@ mdinit(void)
 
 	/*
 	 * Create pending-operations hashtable if we need it.  Currently, we need
-	 * it if we are standalone (not under a postmaster) OR if we are a
-	 * bootstrap-mode subprocess of a postmaster (that is, a startup or
-	 * bgwriter process).
+	 * it if we are standalone (not under a postmaster) OR if we are the
+	 * startup or checkpointer subprocess of a postmaster.  Other auxiliary
+	 * processes, notably the bgwriter, forward their fsync requests to the
+	 * checkpointer like regular backends do.
 	 */
-	if (!IsUnderPostmaster || IsBootstrapProcessingMode())
+	if (!IsUnderPostmaster || AmStartupProcess() || AmCheckpointerProcess())
 	{
 		HASHCTL		hash_ctl;
 
@@ -206,17 +209,17 @@ mdinit(void)
 }
 
 /*
- * In archive recovery, we rely on bgwriter to do fsyncs, but we will have
+ * In archive recovery, we rely on checkpointer to do fsyncs, but we will have
  * already created the pendingOpsTable during initialization of the startup
  * process.  Calling this function drops the local pendingOpsTable so that
- * subsequent requests will be forwarded to bgwriter.
+ * subsequent requests will be forwarded to checkpointer.
  */
 void
 SetForwardFsyncRequests(void)
 {
 	/* Perform any pending ops we may have queued up */
 	if (pendingOpsTable)
-		mdsync();
+		mdsync(CHECKPOINT_IMMEDIATE);
 	pendingOpsTable = NULL;
 }
 
@@ -592,6 +595,44 @@ mdprefetch(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum)
 #endif   /* USE_PREFETCH */
 }
 
+/*
+ *	mdwriteback() -- Ask the kernel to start writing out a range of blocks.
+ *
+ * The blocks must already have been written with mdwrite or mdextend.  The
+ * range may span segment boundaries.  Segments that no longer exist, because
+ * the relation was truncated or dropped meanwhile, are silently skipped.
+ */
+void
+mdwriteback(SMgrRelation reln, ForkNumber forknum,
+			BlockNumber blocknum, BlockNumber nblocks)
+{
+	while (nblocks > 0)
+	{
+		BlockNumber nflush = nblocks;
+		BlockNumber segend;
+		off_t		seekpos;
+		MdfdVec    *v;
+
+		v = _mdfd_getseg(reln, forknum, blocknum, false,
+						 EXTENSION_RETURN_NULL);
+		if (v == NULL)
+			return;
+
+		/* Don't run past the end of this segment */
+		segend = ((BlockNumber) RELSEG_SIZE) -
+			(blocknum % ((BlockNumber) RELSEG_SIZE));
+		if (nflush > segend)
+			nflush = segend;
+
+		seekpos = (off_t) BLCKSZ *(blocknum % ((BlockNumber) RELSEG_SIZE));
+
+		FileWriteback(v->mdfd_vfd, seekpos, (off_t) BLCKSZ * nflush);
+
+		nblocks -= nflush;
+		blocknum += nflush;
+	}
+}
+
 
 /*
  *	mdread() -- Read the specified block from a relation.
@@ -751,9 +792,9 @@ mdnblocks(SMgrRelation reln, ForkNumber forknum)
 	 * NOTE: this assumption could only be wrong if another backend has
 	 * truncated the relation.	We rely on higher code levels to handle that
 	 * scenario by closing and re-opening the md fd, which is handled via
-	 * relcache flush.	(Since the bgwriter doesn't participate in relcache
-	 * flush, it could have segment chain entries for inactive segments;
-	 * that's OK because the bgwriter never needs to compute relation size.)
+	 * relcache flush.	(Since the bgwriter and checkpointer don't participate
+	 * in relcache flush, they could have segment chain entries for inactive
+	 * segments; that's OK because they never need to compute relation size.)
 	 */
 	while (v->mdfd_chain != NULL)
 	{
@@ -917,15 +958,22 @@ mdimmedsync(SMgrRelation reln, ForkNumber forknum)
 
 /*
  *	mdsync() -- Sync previous writes to stable storage.
+ *
+ * flags are the checkpoint request flags.  Unless CHECKPOINT_IMMEDIATE is
+ * given, the checkpointer spreads the fsyncs over the final CHECKPOINT_SYNC_SHARE
+ * of the checkpoint schedule rather than issuing them back to back, so that
+ * the kernel isn't asked to flush everything at the same moment.
  */
 void
-mdsync(void)
+mdsync(int flags)
 {
 	static bool mdsync_in_progress = false;
 
 	HASH_SEQ_STATUS hstat;
 	PendingOperationEntry *entry;
 	int			absorb_counter;
+	long		num_to_sync;
+	long		num_synced = 0;
 
 	/*
 	 * This is only called during checkpoints, and checkpoints should only
@@ -935,7 +983,7 @@ mdsync(void)
 		elog(ERROR, "cannot sync without a pendingOpsTable");
 
 	/*
-	 * If we are in the bgwriter, the sync had better include all fsync
+	 * If we are in the checkpointer, the sync had better include all fsync
 	 * requests that were queued by backends up to this point.	The tightest
 	 * race condition that could occur is that a buffer that must be written
 	 * and fsync'd for the checkpoint could have been dumped by a backend just
@@ -982,6 +1030,9 @@ mdsync(void)
 	/* Advance counter so that new hashtable entries are distinguishable */
 	mdsync_cycle_ctr++;
 
+	/* All entries present now are old ones; count them to track progress */
+	num_to_sync = hash_get_num_entries(pendingOpsTable);
+
 	/* Set flag to detect failure if we don't reach the end of the loop */
 	mdsync_in_progress = true;
 
@@ -1011,7 +1062,7 @@ mdsync(void)
 			int			failures;
 
 			/*
-			 * If in bgwriter, we want to absorb pending requests every so
+			 * If in checkpointer, we want to absorb pending requests every so
 			 * often to prevent overflow of the fsync request queue.  It is
 			 * unspecified whether newly-added entries will be visited by
 			 * hash_seq_search, but we don't care since we don't need to
@@ -1048,10 +1099,10 @@ mdsync(void)
 				 * say "but an unreferenced SMgrRelation is still a leak!" Not
 				 * really, because the only case in which a checkpoint is done
 				 * by a process that isn't about to shut down is in the
-				 * bgwriter, and it will periodically do smgrcloseall(). This
-				 * fact justifies our not closing the reln in the success path
-				 * either, which is a good thing since in non-bgwriter cases
-				 * we couldn't safely do that.)  Furthermore, in many cases
+				 * checkpointer, and it will periodically do smgrcloseall().
+				 * This fact justifies our not closing the reln in the success
+				 * path either, which is a good thing since in non-checkpointer
+				 * cases we couldn't safely do that.)  Furthermore, in many cases
 				 * the relation will have been dirtied through this same smgr
 				 * relation, and so we can save a file open/close cycle.
 				 */
@@ -1101,6 +1152,16 @@ mdsync(void)
 				if (entry->canceled)
 					break;
 			}					/* end retry loop */
+
+			/*
+			 * Sleep between fsyncs to stay on the checkpoint schedule.  The
+			 * write phase has used up the first part of it.
+			 */
+			num_synced++;
+			CheckpointWriteDelay(flags,
+								 (1.0 - CHECKPOINT_SYNC_SHARE) +
+								 CHECKPOINT_SYNC_SHARE *
+								 (double) num_synced / num_to_sync);
 		}
 
 		/*
@@ -1207,7 +1268,7 @@ mdpostckpt(void)
  *
  * If there is a local pending-ops table, just make an entry in it for
  * mdsync to process later.  Otherwise, try to pass off the fsync request
- * to the background writer process.  If that fails, just do the fsync
+ * to the checkpointer process.  If that fails, just do the fsync
  * locally before returning (we expect this will not happen often enough
  * to be a performance problem).
  */
@@ -1249,7 +1310,7 @@ register_unlink(RelFileNodeBackend rnode)
 	else
 	{
 		/*
-		 * Notify the bgwriter about it.  If we fail to queue the request
+		 * Notify the checkpointer about it.  If we fail to queue the request
 		 * message, we have to sleep and try again, because we can't simply
 		 * delete the file now.  Ugly, but hopefully won't happen often.
 		 *
@@ -1263,10 +1324,10 @@ register_unlink(RelFileNodeBackend rnode)
 }
 
 /*
- * RememberFsyncRequest() -- callback from bgwriter side of fsync request
+ * RememberFsyncRequest() -- callback from checkpointer side of fsync request
  *
  * We stuff most fsync requests into the local hash table for execution
- * during the bgwriter's next checkpoint.  UNLINK requests go into a
+ * during the checkpointer's next checkpoint.  UNLINK requests go into a
  * separate linked list, however, because they get processed separately.
  *
  * The range of possible segment numbers is way less than the range of
@@ -1408,21 +1469,21 @@ ForgetRelationFsyncRequests(RelFileNodeBackend rnode, ForkNumber forknum)
 	else if (IsUnderPostmaster)
 	{
 		/*
-		 * Notify the bgwriter about it.  If we fail to queue the revoke
+		 * Notify the checkpointer about it.  If we fail to queue the revoke
 		 * message, we have to sleep and try again ... ugly, but hopefully
 		 * won't happen often.
 		 *
 		 * XXX should we CHECK_FOR_INTERRUPTS in this loop?  Escaping with an
 		 * error would leave the no-longer-used file still present on disk,
-		 * which would be bad, so I'm inclined to assume that the bgwriter
-		 * will always empty the queue soon.
+		 * which would be bad, so I'm inclined to assume that the
+		 * checkpointer will always empty the queue soon.
 		 */
 		while (!ForwardFsyncRequest(rnode, forknum, FORGET_RELATION_FSYNC))
 			pg_usleep(10000L);	/* 10 msec seems a good number */
 
 		/*
-		 * Note we don't wait for the bgwriter to actually absorb the revoke
-		 * message; see mdsync() for the implications.
+		 * Note we don't wait for the checkpointer to actually absorb the
+		 * revoke message; see mdsync() for the implications.
 		 */
 	}
 }
@@ -51,6 +51,8 @@ typedef struct f_smgr
 							BlockNumber blocknum, char *buffer, bool skipFsync);
 	void		(*smgr_prefetch) (SMgrRelation reln, ForkNumber forknum,
 											  BlockNumber blocknum);
+	void		(*smgr_writeback) (SMgrRelation reln, ForkNumber forknum,
+								   BlockNumber blocknum, BlockNumber nblocks);
 	void		(*smgr_read) (SMgrRelation reln, ForkNumber forknum,
 										  BlockNumber blocknum, char *buffer);
 	void		(*smgr_write) (SMgrRelation reln, ForkNumber forknum,
@@ -60,7 +62,7 @@ typedef struct f_smgr
 										   BlockNumber nblocks);
 	void		(*smgr_immedsync) (SMgrRelation reln, ForkNumber forknum);
 	void		(*smgr_pre_ckpt) (void);		/* may be NULL */
-	void		(*smgr_sync) (void);	/* may be NULL */
+	void		(*smgr_sync) (int flags);	/* may be NULL */
 	void		(*smgr_post_ckpt) (void);		/* may be NULL */
 } f_smgr;
 
@@ -68,7 +70,8 @@ typedef struct f_smgr
 static const f_smgr smgrsw[] = {
 	/* magnetic disk */
 	{mdinit, NULL, mdclose, mdcreate, mdexists, mdunlink, mdextend,
-		mdprefetch, mdread, mdwrite, mdnblocks, mdtruncate, mdimmedsync,
+		mdprefetch, mdwriteback, mdread, mdwrite, mdnblocks, mdtruncate,
+		mdimmedsync,
 		mdpreckpt, mdsync, mdpostckpt
 	}
 };
@@ -391,6 +394,20 @@ smgrprefetch(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum)
 	(*(smgrsw[reln->smgr_which].smgr_prefetch)) (reln, forknum, blocknum);
 }
 
+/*
+ *	smgrwriteback() -- Ask the kernel to start writing out the given range of
+ *					   already-written blocks of a relation.
+ *
+ *		This is only a hint; nothing is guaranteed to be on disk afterwards.
+ */
+void
+smgrwriteback(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
+			  BlockNumber nblocks)
+{
+	(*(smgrsw[reln->smgr_which].smgr_writeback)) (reln, forknum, blocknum,
+												  nblocks);
+}
+
 /*
  *	smgrread() -- read a particular block from a relation into the supplied
  *				  buffer.
@@ -519,16 +536,18 @@ smgrpreckpt(void)
 
 /*
  *	smgrsync() -- Sync files to disk during checkpoint.
+ *
+ *		flags are the checkpoint request flags, used to pace the work.
  */
 void
-smgrsync(void)
+smgrsync(int flags)
 {
 	int			i;
 
 	for (i = 0; i < NSmgr; i++)
 	{
 		if (smgrsw[i].smgr_sync)
-			(*(smgrsw[i].smgr_sync)) ();
+			(*(smgrsw[i].smgr_sync)) (flags);
 	}
 }
 
@@ -173,11 +173,13 @@ pg_lock_status(PG_FUNCTION_ARGS)
 
 		/*
 		 * If no (more) held modes to report, see if PROC is waiting for a
-		 * lock on this lock.
+		 * lock on this lock.  Fast-path locks have no LOCK object (myLock is
+		 * NULL) and can never be awaited.
 		 */
 		if (!granted)
 		{
-			if (proc->waitLock == proclock->tag.myLock)
+			if (proclock->tag.myLock != NULL &&
+				proc->waitLock == proclock->tag.myLock)
 			{
 				/* Yes, so report it with proper mode */
 				mode = proc->waitLockMode;
@@ -0,0 +1,4085 @@
+/*-------------------------------------------------------------------------
+ *
+ * fmgrtab.c
+ *    The function manager's table of internal functions.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * NOTES
+ *
+ *	******************************
+ *	*** DO NOT EDIT THIS FILE! ***
+ *	******************************
+ *
+ *	It has been GENERATED by Gen_fmgrtab.pl
+ *	from ../../../src/include/catalog/pg_proc.h
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include "utils/fmgrtab.h"
+
+extern Datum byteaout (PG_FUNCTION_ARGS);
+extern Datum charout (PG_FUNCTION_ARGS);
+extern Datum namein (PG_FUNCTION_ARGS);
+extern Datum nameout (PG_FUNCTION_ARGS);
+extern Datum int2in (PG_FUNCTION_ARGS);
+extern Datum int2out (PG_FUNCTION_ARGS);
+extern Datum int2vectorin (PG_FUNCTION_ARGS);
+extern Datum int2vectorout (PG_FUNCTION_ARGS);
+extern Datum int4in (PG_FUNCTION_ARGS);
+extern Datum int4out (PG_FUNCTION_ARGS);
+extern Datum regprocin (PG_FUNCTION_ARGS);
+extern Datum regprocout (PG_FUNCTION_ARGS);
+extern Datum textin (PG_FUNCTION_ARGS);
+extern Datum textout (PG_FUNCTION_ARGS);
+extern Datum tidin (PG_FUNCTION_ARGS);
+extern Datum tidout (PG_FUNCTION_ARGS);
+extern Datum xidin (PG_FUNCTION_ARGS);
+extern Datum xidout (PG_FUNCTION_ARGS);
+extern Datum cidin (PG_FUNCTION_ARGS);
+extern Datum cidout (PG_FUNCTION_ARGS);
+extern Datum oidvectorin (PG_FUNCTION_ARGS);
+extern Datum oidvectorout (PG_FUNCTION_ARGS);
+extern Datum boollt (PG_FUNCTION_ARGS);
+extern Datum boolgt (PG_FUNCTION_ARGS);
+extern Datum booleq (PG_FUNCTION_ARGS);
+extern Datum chareq (PG_FUNCTION_ARGS);
+extern Datum nameeq (PG_FUNCTION_ARGS);
+extern Datum int2eq (PG_FUNCTION_ARGS);
+extern Datum int2lt (PG_FUNCTION_ARGS);
+extern Datum int4eq (PG_FUNCTION_ARGS);
+extern Datum int4lt (PG_FUNCTION_ARGS);
+extern Datum texteq (PG_FUNCTION_ARGS);
+extern Datum xideq (PG_FUNCTION_ARGS);
+extern Datum cideq (PG_FUNCTION_ARGS);
+extern Datum charne (PG_FUNCTION_ARGS);
+extern Datum charle (PG_FUNCTION_ARGS);
+extern Datum chargt (PG_FUNCTION_ARGS);
+extern Datum charge (PG_FUNCTION_ARGS);
+extern Datum chartoi4 (PG_FUNCTION_ARGS);
+extern Datum i4tochar (PG_FUNCTION_ARGS);
+extern Datum nameregexeq (PG_FUNCTION_ARGS);
+extern Datum boolne (PG_FUNCTION_ARGS);
+extern Datum pgsql_version (PG_FUNCTION_ARGS);
+extern Datum eqsel (PG_FUNCTION_ARGS);
+extern Datum neqsel (PG_FUNCTION_ARGS);
+extern Datum scalarltsel (PG_FUNCTION_ARGS);
+extern Datum scalargtsel (PG_FUNCTION_ARGS);
+extern Datum eqjoinsel (PG_FUNCTION_ARGS);
+extern Datum neqjoinsel (PG_FUNCTION_ARGS);
+extern Datum scalarltjoinsel (PG_FUNCTION_ARGS);
+extern Datum scalargtjoinsel (PG_FUNCTION_ARGS);
+extern Datum unknownin (PG_FUNCTION_ARGS);
+extern Datum unknownout (PG_FUNCTION_ARGS);
+extern Datum numeric_fac (PG_FUNCTION_ARGS);
+extern Datum box_above_eq (PG_FUNCTION_ARGS);
+extern Datum box_below_eq (PG_FUNCTION_ARGS);
+extern Datum point_in (PG_FUNCTION_ARGS);
+extern Datum point_out (PG_FUNCTION_ARGS);
+extern Datum lseg_in (PG_FUNCTION_ARGS);
+extern Datum lseg_out (PG_FUNCTION_ARGS);
+extern Datum path_in (PG_FUNCTION_ARGS);
+extern Datum path_out (PG_FUNCTION_ARGS);
+extern Datum box_in (PG_FUNCTION_ARGS);
+extern Datum box_out (PG_FUNCTION_ARGS);
+extern Datum box_overlap (PG_FUNCTION_ARGS);
+extern Datum box_ge (PG_FUNCTION_ARGS);
+extern Datum box_gt (PG_FUNCTION_ARGS);
+extern Datum box_eq (PG_FUNCTION_ARGS);
+extern Datum box_lt (PG_FUNCTION_ARGS);
+extern Datum box_le (PG_FUNCTION_ARGS);
+extern Datum point_above (PG_FUNCTION_ARGS);
+extern Datum point_left (PG_FUNCTION_ARGS);
+extern Datum point_right (PG_FUNCTION_ARGS);
+extern Datum point_below (PG_FUNCTION_ARGS);
+extern Datum point_eq (PG_FUNCTION_ARGS);
+extern Datum on_pb (PG_FUNCTION_ARGS);
+extern Datum on_ppath (PG_FUNCTION_ARGS);
+extern Datum box_center (PG_FUNCTION_ARGS);
+extern Datum areasel (PG_FUNCTION_ARGS);
+extern Datum areajoinsel (PG_FUNCTION_ARGS);
+extern Datum int4mul (PG_FUNCTION_ARGS);
+extern Datum int4ne (PG_FUNCTION_ARGS);
+extern Datum int2ne (PG_FUNCTION_ARGS);
+extern Datum int2gt (PG_FUNCTION_ARGS);
+extern Datum int4gt (PG_FUNCTION_ARGS);
+extern Datum int2le (PG_FUNCTION_ARGS);
+extern Datum int4le (PG_FUNCTION_ARGS);
+extern Datum int4ge (PG_FUNCTION_ARGS);
+extern Datum int2ge (PG_FUNCTION_ARGS);
+extern Datum int2mul (PG_FUNCTION_ARGS);
+extern Datum int2div (PG_FUNCTION_ARGS);
+extern Datum int4div (PG_FUNCTION_ARGS);
+extern Datum int2mod (PG_FUNCTION_ARGS);
+extern Datum int4mod (PG_FUNCTION_ARGS);
+extern Datum textne (PG_FUNCTION_ARGS);
+extern Datum int24eq (PG_FUNCTION_ARGS);
+extern Datum int42eq (PG_FUNCTION_ARGS);
+extern Datum int24lt (PG_FUNCTION_ARGS);
+extern Datum int42lt (PG_FUNCTION_ARGS);
+extern Datum int24gt (PG_FUNCTION_ARGS);
+extern Datum int42gt (PG_FUNCTION_ARGS);
+extern Datum int24ne (PG_FUNCTION_ARGS);
+extern Datum int42ne (PG_FUNCTION_ARGS);
+extern Datum int24le (PG_FUNCTION_ARGS);
+extern Datum int42le (PG_FUNCTION_ARGS);
+extern Datum int24ge (PG_FUNCTION_ARGS);
+extern Datum int42ge (PG_FUNCTION_ARGS);
+extern Datum int24mul (PG_FUNCTION_ARGS);
+extern Datum int42mul (PG_FUNCTION_ARGS);
+extern Datum int24div (PG_FUNCTION_ARGS);
+extern Datum int42div (PG_FUNCTION_ARGS);
+extern Datum int2pl (PG_FUNCTION_ARGS);
+extern Datum int4pl (PG_FUNCTION_ARGS);
+extern Datum int24pl (PG_FUNCTION_ARGS);
+extern Datum int42pl (PG_FUNCTION_ARGS);
+extern Datum int2mi (PG_FUNCTION_ARGS);
+extern Datum int4mi (PG_FUNCTION_ARGS);
+extern Datum int24mi (PG_FUNCTION_ARGS);
+extern Datum int42mi (PG_FUNCTION_ARGS);
+extern Datum oideq (PG_FUNCTION_ARGS);
+extern Datum oidne (PG_FUNCTION_ARGS);
+extern Datum box_same (PG_FUNCTION_ARGS);
+extern Datum box_contain (PG_FUNCTION_ARGS);
+extern Datum box_left (PG_FUNCTION_ARGS);
+extern Datum box_overleft (PG_FUNCTION_ARGS);
+extern Datum box_overright (PG_FUNCTION_ARGS);
+extern Datum box_right (PG_FUNCTION_ARGS);
+extern Datum box_contained (PG_FUNCTION_ARGS);
+extern Datum box_contain_pt (PG_FUNCTION_ARGS);
+extern Datum pg_node_tree_in (PG_FUNCTION_ARGS);
+extern Datum pg_node_tree_out (PG_FUNCTION_ARGS);
+extern Datum pg_node_tree_recv (PG_FUNCTION_ARGS);
+extern Datum pg_node_tree_send (PG_FUNCTION_ARGS);
+extern Datum float4in (PG_FUNCTION_ARGS);
+extern Datum float4out (PG_FUNCTION_ARGS);
+extern Datum float4mul (PG_FUNCTION_ARGS);
+extern Datum float4div (PG_FUNCTION_ARGS);
+extern Datum float4pl (PG_FUNCTION_ARGS);
+extern Datum float4mi (PG_FUNCTION_ARGS);
+extern Datum float4um (PG_FUNCTION_ARGS);
+extern Datum float4abs (PG_FUNCTION_ARGS);
+extern Datum float4_accum (PG_FUNCTION_ARGS);
+extern Datum float4larger (PG_FUNCTION_ARGS);
+extern Datum float4smaller (PG_FUNCTION_ARGS);
+extern Datum int4um (PG_FUNCTION_ARGS);
+extern Datum int2um (PG_FUNCTION_ARGS);
+extern Datum float8in (PG_FUNCTION_ARGS);
+extern Datum float8out (PG_FUNCTION_ARGS);
+extern Datum float8mul (PG_FUNCTION_ARGS);
+extern Datum float8div (PG_FUNCTION_ARGS);
+extern Datum float8pl (PG_FUNCTION_ARGS);
+extern Datum float8mi (PG_FUNCTION_ARGS);
+extern Datum float8um (PG_FUNCTION_ARGS);
+extern Datum float8abs (PG_FUNCTION_ARGS);
+extern Datum float8_accum (PG_FUNCTION_ARGS);
+extern Datum float8larger (PG_FUNCTION_ARGS);
+extern Datum float8smaller (PG_FUNCTION_ARGS);
+extern Datum lseg_center (PG_FUNCTION_ARGS);
+extern Datum path_center (PG_FUNCTION_ARGS);
+extern Datum poly_center (PG_FUNCTION_ARGS);
+extern Datum dround (PG_FUNCTION_ARGS);
+extern Datum dtrunc (PG_FUNCTION_ARGS);
+extern Datum dsqrt (PG_FUNCTION_ARGS);
+extern Datum dcbrt (PG_FUNCTION_ARGS);
+extern Datum dpow (PG_FUNCTION_ARGS);
+extern Datum dexp (PG_FUNCTION_ARGS);
+extern Datum dlog1 (PG_FUNCTION_ARGS);
+extern Datum i2tod (PG_FUNCTION_ARGS);
+extern Datum i2tof (PG_FUNCTION_ARGS);
+extern Datum dtoi2 (PG_FUNCTION_ARGS);
+extern Datum ftoi2 (PG_FUNCTION_ARGS);
+extern Datum line_distance (PG_FUNCTION_ARGS);
+extern Datum abstimein (PG_FUNCTION_ARGS);
+extern Datum abstimeout (PG_FUNCTION_ARGS);
+extern Datum reltimein (PG_FUNCTION_ARGS);
+extern Datum reltimeout (PG_FUNCTION_ARGS);
+extern Datum timepl (PG_FUNCTION_ARGS);
+extern Datum timemi (PG_FUNCTION_ARGS);
+extern Datum tintervalin (PG_FUNCTION_ARGS);
+extern Datum tintervalout (PG_FUNCTION_ARGS);
+extern Datum intinterval (PG_FUNCTION_ARGS);
+extern Datum tintervalrel (PG_FUNCTION_ARGS);
+extern Datum timenow (PG_FUNCTION_ARGS);
+extern Datum abstimeeq (PG_FUNCTION_ARGS);
+extern Datum abstimene (PG_FUNCTION_ARGS);
+extern Datum abstimelt (PG_FUNCTION_ARGS);
+extern Datum abstimegt (PG_FUNCTION_ARGS);
+extern Datum abstimele (PG_FUNCTION_ARGS);
+extern Datum abstimege (PG_FUNCTION_ARGS);
+extern Datum reltimeeq (PG_FUNCTION_ARGS);
+extern Datum reltimene (PG_FUNCTION_ARGS);
+extern Datum reltimelt (PG_FUNCTION_ARGS);
+extern Datum reltimegt (PG_FUNCTION_ARGS);
+extern Datum reltimele (PG_FUNCTION_ARGS);
+extern Datum reltimege (PG_FUNCTION_ARGS);
+extern Datum tintervalsame (PG_FUNCTION_ARGS);
+extern Datum tintervalct (PG_FUNCTION_ARGS);
+extern Datum tintervalov (PG_FUNCTION_ARGS);
+extern Datum tintervalleneq (PG_FUNCTION_ARGS);
+extern Datum tintervallenne (PG_FUNCTION_ARGS);
+extern Datum tintervallenlt (PG_FUNCTION_ARGS);
+extern Datum tintervallengt (PG_FUNCTION_ARGS);
+extern Datum tintervallenle (PG_FUNCTION_ARGS);
+extern Datum tintervallenge (PG_FUNCTION_ARGS);
+extern Datum tintervalstart (PG_FUNCTION_ARGS);
+extern Datum tintervalend (PG_FUNCTION_ARGS);
+extern Datum timeofday (PG_FUNCTION_ARGS);
+extern Datum abstime_finite (PG_FUNCTION_ARGS);
+extern Datum inter_sl (PG_FUNCTION_ARGS);
+extern Datum inter_lb (PG_FUNCTION_ARGS);
+extern Datum float48mul (PG_FUNCTION_ARGS);
+extern Datum float48div (PG_FUNCTION_ARGS);
+extern Datum float48pl (PG_FUNCTION_ARGS);
+extern Datum float48mi (PG_FUNCTION_ARGS);
+extern Datum float84mul (PG_FUNCTION_ARGS);
+extern Datum float84div (PG_FUNCTION_ARGS);
+extern Datum float84pl (PG_FUNCTION_ARGS);
+extern Datum float84mi (PG_FUNCTION_ARGS);
+extern Datum float4eq (PG_FUNCTION_ARGS);
+extern Datum float4ne (PG_FUNCTION_ARGS);
+extern Datum float4lt (PG_FUNCTION_ARGS);
+extern Datum float4le (PG_FUNCTION_ARGS);
+extern Datum float4gt (PG_FUNCTION_ARGS);
+extern Datum float4ge (PG_FUNCTION_ARGS);
+extern Datum float8eq (PG_FUNCTION_ARGS);
+extern Datum float8ne (PG_FUNCTION_ARGS);
+extern Datum float8lt (PG_FUNCTION_ARGS);
+extern Datum float8le (PG_FUNCTION_ARGS);
+extern Datum float8gt (PG_FUNCTION_ARGS);
+extern Datum float8ge (PG_FUNCTION_ARGS);
+extern Datum float48eq (PG_FUNCTION_ARGS);
+extern Datum float48ne (PG_FUNCTION_ARGS);
+extern Datum float48lt (PG_FUNCTION_ARGS);
+extern Datum float48le (PG_FUNCTION_ARGS);
+extern Datum float48gt (PG_FUNCTION_ARGS);
+extern Datum float48ge (PG_FUNCTION_ARGS);
+extern Datum float84eq (PG_FUNCTION_ARGS);
+extern Datum float84ne (PG_FUNCTION_ARGS);
+extern Datum float84lt (PG_FUNCTION_ARGS);
+extern Datum float84le (PG_FUNCTION_ARGS);
+extern Datum float84gt (PG_FUNCTION_ARGS);
+extern Datum float84ge (PG_FUNCTION_ARGS);
+extern Datum ftod (PG_FUNCTION_ARGS);
+extern Datum dtof (PG_FUNCTION_ARGS);
+extern Datum i2toi4 (PG_FUNCTION_ARGS);
+extern Datum i4toi2 (PG_FUNCTION_ARGS);
+extern Datum int2vectoreq (PG_FUNCTION_ARGS);
+extern Datum i4tod (PG_FUNCTION_ARGS);
+extern Datum dtoi4 (PG_FUNCTION_ARGS);
+extern Datum i4tof (PG_FUNCTION_ARGS);
+extern Datum ftoi4 (PG_FUNCTION_ARGS);
+extern Datum width_bucket_float8 (PG_FUNCTION_ARGS);
+extern Datum hash_aclitem (PG_FUNCTION_ARGS);
+extern Datum btgettuple (PG_FUNCTION_ARGS);
+extern Datum btinsert (PG_FUNCTION_ARGS);
+extern Datum btbulkdelete (PG_FUNCTION_ARGS);
+extern Datum btbeginscan (PG_FUNCTION_ARGS);
+extern Datum btrescan (PG_FUNCTION_ARGS);
+extern Datum btendscan (PG_FUNCTION_ARGS);
+extern Datum btmarkpos (PG_FUNCTION_ARGS);
+extern Datum btrestrpos (PG_FUNCTION_ARGS);
+extern Datum btbuild (PG_FUNCTION_ARGS);
+extern Datum poly_same (PG_FUNCTION_ARGS);
+extern Datum poly_contain (PG_FUNCTION_ARGS);
+extern Datum poly_left (PG_FUNCTION_ARGS);
+extern Datum poly_overleft (PG_FUNCTION_ARGS);
+extern Datum poly_overright (PG_FUNCTION_ARGS);
+extern Datum poly_right (PG_FUNCTION_ARGS);
+extern Datum poly_contained (PG_FUNCTION_ARGS);
+extern Datum poly_overlap (PG_FUNCTION_ARGS);
+extern Datum poly_in (PG_FUNCTION_ARGS);
+extern Datum poly_out (PG_FUNCTION_ARGS);
+extern Datum btint2cmp (PG_FUNCTION_ARGS);
+extern Datum btint4cmp (PG_FUNCTION_ARGS);
+extern Datum btfloat4cmp (PG_FUNCTION_ARGS);
+extern Datum btfloat8cmp (PG_FUNCTION_ARGS);
+extern Datum btoidcmp (PG_FUNCTION_ARGS);
+extern Datum btabstimecmp (PG_FUNCTION_ARGS);
+extern Datum btcharcmp (PG_FUNCTION_ARGS);
+extern Datum btnamecmp (PG_FUNCTION_ARGS);
+extern Datum bttextcmp (PG_FUNCTION_ARGS);
+extern Datum lseg_distance (PG_FUNCTION_ARGS);
+extern Datum lseg_interpt (PG_FUNCTION_ARGS);
+extern Datum dist_ps (PG_FUNCTION_ARGS);
+extern Datum dist_pb (PG_FUNCTION_ARGS);
+extern Datum dist_sb (PG_FUNCTION_ARGS);
+extern Datum close_ps (PG_FUNCTION_ARGS);
+extern Datum close_pb (PG_FUNCTION_ARGS);
+extern Datum close_sb (PG_FUNCTION_ARGS);
+extern Datum on_ps (PG_FUNCTION_ARGS);
+extern Datum path_distance (PG_FUNCTION_ARGS);
+extern Datum dist_ppath (PG_FUNCTION_ARGS);
+extern Datum on_sb (PG_FUNCTION_ARGS);
+extern Datum inter_sb (PG_FUNCTION_ARGS);
+extern Datum text_to_array_null (PG_FUNCTION_ARGS);
+extern Datum cash_cmp (PG_FUNCTION_ARGS);
+extern Datum array_push (PG_FUNCTION_ARGS);
+extern Datum btreltimecmp (PG_FUNCTION_ARGS);
+extern Datum bttintervalcmp (PG_FUNCTION_ARGS);
+extern Datum btarraycmp (PG_FUNCTION_ARGS);
+extern Datum array_cat (PG_FUNCTION_ARGS);
+extern Datum array_to_text_null (PG_FUNCTION_ARGS);
+extern Datum array_ne (PG_FUNCTION_ARGS);
+extern Datum array_lt (PG_FUNCTION_ARGS);
+extern Datum array_gt (PG_FUNCTION_ARGS);
+extern Datum array_le (PG_FUNCTION_ARGS);
+extern Datum text_to_array (PG_FUNCTION_ARGS);
+extern Datum array_to_text (PG_FUNCTION_ARGS);
+extern Datum array_ge (PG_FUNCTION_ARGS);
+extern Datum hashint2vector (PG_FUNCTION_ARGS);
+extern Datum hashmacaddr (PG_FUNCTION_ARGS);
+extern Datum hashtext (PG_FUNCTION_ARGS);
+extern Datum rtrim1 (PG_FUNCTION_ARGS);
+extern Datum btoidvectorcmp (PG_FUNCTION_ARGS);
+extern Datum name_text (PG_FUNCTION_ARGS);
+extern Datum text_name (PG_FUNCTION_ARGS);
+extern Datum name_bpchar (PG_FUNCTION_ARGS);
+extern Datum bpchar_name (PG_FUNCTION_ARGS);
+extern Datum hashinet (PG_FUNCTION_ARGS);
+extern Datum hashvacuumcleanup (PG_FUNCTION_ARGS);
+extern Datum hash_numeric (PG_FUNCTION_ARGS);
+extern Datum macaddr_in (PG_FUNCTION_ARGS);
+extern Datum macaddr_out (PG_FUNCTION_ARGS);
+extern Datum hashcostestimate (PG_FUNCTION_ARGS);
+extern Datum hashgettuple (PG_FUNCTION_ARGS);
+extern Datum hashinsert (PG_FUNCTION_ARGS);
+extern Datum hashbulkdelete (PG_FUNCTION_ARGS);
+extern Datum hashbeginscan (PG_FUNCTION_ARGS);
+extern Datum hashrescan (PG_FUNCTION_ARGS);
+extern Datum hashendscan (PG_FUNCTION_ARGS);
+extern Datum hashmarkpos (PG_FUNCTION_ARGS);
+extern Datum hashrestrpos (PG_FUNCTION_ARGS);
+extern Datum hashbuild (PG_FUNCTION_ARGS);
+extern Datum hashint2 (PG_FUNCTION_ARGS);
+extern Datum hashint4 (PG_FUNCTION_ARGS);
+extern Datum hashfloat4 (PG_FUNCTION_ARGS);
+extern Datum hashfloat8 (PG_FUNCTION_ARGS);
+extern Datum hashoid (PG_FUNCTION_ARGS);
+extern Datum hashchar (PG_FUNCTION_ARGS);
+extern Datum hashname (PG_FUNCTION_ARGS);
+extern Datum hashvarlena (PG_FUNCTION_ARGS);
+extern Datum hashoidvector (PG_FUNCTION_ARGS);
+extern Datum text_larger (PG_FUNCTION_ARGS);
+extern Datum text_smaller (PG_FUNCTION_ARGS);
+extern Datum int8in (PG_FUNCTION_ARGS);
+extern Datum int8out (PG_FUNCTION_ARGS);
+extern Datum int8um (PG_FUNCTION_ARGS);
+extern Datum int8pl (PG_FUNCTION_ARGS);
+extern Datum int8mi (PG_FUNCTION_ARGS);
+extern Datum int8mul (PG_FUNCTION_ARGS);
+extern Datum int8div (PG_FUNCTION_ARGS);
+extern Datum int8eq (PG_FUNCTION_ARGS);
+extern Datum int8ne (PG_FUNCTION_ARGS);
+extern Datum int8lt (PG_FUNCTION_ARGS);
+extern Datum int8gt (PG_FUNCTION_ARGS);
+extern Datum int8le (PG_FUNCTION_ARGS);
+extern Datum int8ge (PG_FUNCTION_ARGS);
+extern Datum int84eq (PG_FUNCTION_ARGS);
+extern Datum int84ne (PG_FUNCTION_ARGS);
+extern Datum int84lt (PG_FUNCTION_ARGS);
+extern Datum int84gt (PG_FUNCTION_ARGS);
+extern Datum int84le (PG_FUNCTION_ARGS);
+extern Datum int84ge (PG_FUNCTION_ARGS);
+extern Datum int84 (PG_FUNCTION_ARGS);
+extern Datum int48 (PG_FUNCTION_ARGS);
+extern Datum i8tod (PG_FUNCTION_ARGS);
+extern Datum dtoi8 (PG_FUNCTION_ARGS);
+extern Datum array_larger (PG_FUNCTION_ARGS);
+extern Datum array_smaller (PG_FUNCTION_ARGS);
+extern Datum inet_abbrev (PG_FUNCTION_ARGS);
+extern Datum cidr_abbrev (PG_FUNCTION_ARGS);
+extern Datum inet_set_masklen (PG_FUNCTION_ARGS);
+extern Datum oidvectorne (PG_FUNCTION_ARGS);
+extern Datum cidr_set_masklen (PG_FUNCTION_ARGS);
+extern Datum btgetbitmap (PG_FUNCTION_ARGS);
+extern Datum hashgetbitmap (PG_FUNCTION_ARGS);
+extern Datum gistgetbitmap (PG_FUNCTION_ARGS);
+extern Datum i8tof (PG_FUNCTION_ARGS);
+extern Datum ftoi8 (PG_FUNCTION_ARGS);
+extern Datum namelt (PG_FUNCTION_ARGS);
+extern Datum namele (PG_FUNCTION_ARGS);
+extern Datum namegt (PG_FUNCTION_ARGS);
+extern Datum namege (PG_FUNCTION_ARGS);
+extern Datum namene (PG_FUNCTION_ARGS);
+extern Datum bpchar (PG_FUNCTION_ARGS);
+extern Datum varchar (PG_FUNCTION_ARGS);
+extern Datum mktinterval (PG_FUNCTION_ARGS);
+extern Datum oidvectorlt (PG_FUNCTION_ARGS);
+extern Datum oidvectorle (PG_FUNCTION_ARGS);
+extern Datum oidvectoreq (PG_FUNCTION_ARGS);
+extern Datum oidvectorge (PG_FUNCTION_ARGS);
+extern Datum oidvectorgt (PG_FUNCTION_ARGS);
+extern Datum network_network (PG_FUNCTION_ARGS);
+extern Datum network_netmask (PG_FUNCTION_ARGS);
+extern Datum network_masklen (PG_FUNCTION_ARGS);
+extern Datum network_broadcast (PG_FUNCTION_ARGS);
+extern Datum network_host (PG_FUNCTION_ARGS);
+extern Datum current_user (PG_FUNCTION_ARGS);
+extern Datum network_family (PG_FUNCTION_ARGS);
+extern Datum int82 (PG_FUNCTION_ARGS);
+extern Datum lo_create (PG_FUNCTION_ARGS);
+extern Datum oidlt (PG_FUNCTION_ARGS);
+extern Datum oidle (PG_FUNCTION_ARGS);
+extern Datum byteaoctetlen (PG_FUNCTION_ARGS);
+extern Datum byteaGetByte (PG_FUNCTION_ARGS);
+extern Datum byteaSetByte (PG_FUNCTION_ARGS);
+extern Datum byteaGetBit (PG_FUNCTION_ARGS);
+extern Datum byteaSetBit (PG_FUNCTION_ARGS);
+extern Datum dist_pl (PG_FUNCTION_ARGS);
+extern Datum dist_lb (PG_FUNCTION_ARGS);
+extern Datum dist_sl (PG_FUNCTION_ARGS);
+extern Datum dist_cpoly (PG_FUNCTION_ARGS);
+extern Datum poly_distance (PG_FUNCTION_ARGS);
+extern Datum network_show (PG_FUNCTION_ARGS);
+extern Datum text_lt (PG_FUNCTION_ARGS);
+extern Datum text_le (PG_FUNCTION_ARGS);
+extern Datum text_gt (PG_FUNCTION_ARGS);
+extern Datum text_ge (PG_FUNCTION_ARGS);
+extern Datum array_eq (PG_FUNCTION_ARGS);
+extern Datum session_user (PG_FUNCTION_ARGS);
+extern Datum array_dims (PG_FUNCTION_ARGS);
+extern Datum array_ndims (PG_FUNCTION_ARGS);
+extern Datum byteaoverlay (PG_FUNCTION_ARGS);
+extern Datum array_in (PG_FUNCTION_ARGS);
+extern Datum array_out (PG_FUNCTION_ARGS);
+extern Datum byteaoverlay_no_len (PG_FUNCTION_ARGS);
+extern Datum macaddr_trunc (PG_FUNCTION_ARGS);
+extern Datum int28 (PG_FUNCTION_ARGS);
+extern Datum smgrin (PG_FUNCTION_ARGS);
+extern Datum smgrout (PG_FUNCTION_ARGS);
+extern Datum smgreq (PG_FUNCTION_ARGS);
+extern Datum smgrne (PG_FUNCTION_ARGS);
+extern Datum lo_import (PG_FUNCTION_ARGS);
+extern Datum lo_export (PG_FUNCTION_ARGS);
+extern Datum int4inc (PG_FUNCTION_ARGS);
+extern Datum lo_import_with_oid (PG_FUNCTION_ARGS);
+extern Datum int4larger (PG_FUNCTION_ARGS);
+extern Datum int4smaller (PG_FUNCTION_ARGS);
+extern Datum int2larger (PG_FUNCTION_ARGS);
+extern Datum int2smaller (PG_FUNCTION_ARGS);
+extern Datum gistcostestimate (PG_FUNCTION_ARGS);
+extern Datum gistgettuple (PG_FUNCTION_ARGS);
+extern Datum gistinsert (PG_FUNCTION_ARGS);
+extern Datum gistbulkdelete (PG_FUNCTION_ARGS);
+extern Datum gistbeginscan (PG_FUNCTION_ARGS);
+extern Datum gistrescan (PG_FUNCTION_ARGS);
+extern Datum gistendscan (PG_FUNCTION_ARGS);
+extern Datum gistmarkpos (PG_FUNCTION_ARGS);
+extern Datum gistrestrpos (PG_FUNCTION_ARGS);
+extern Datum gistbuild (PG_FUNCTION_ARGS);
+extern Datum tintervaleq (PG_FUNCTION_ARGS);
+extern Datum tintervalne (PG_FUNCTION_ARGS);
+extern Datum tintervallt (PG_FUNCTION_ARGS);
+extern Datum tintervalgt (PG_FUNCTION_ARGS);
+extern Datum tintervalle (PG_FUNCTION_ARGS);
+extern Datum tintervalge (PG_FUNCTION_ARGS);
+extern Datum pg_client_encoding (PG_FUNCTION_ARGS);
+extern Datum current_query (PG_FUNCTION_ARGS);
+extern Datum macaddr_eq (PG_FUNCTION_ARGS);
+extern Datum macaddr_lt (PG_FUNCTION_ARGS);
+extern Datum macaddr_le (PG_FUNCTION_ARGS);
+extern Datum macaddr_gt (PG_FUNCTION_ARGS);
+extern Datum macaddr_ge (PG_FUNCTION_ARGS);
+extern Datum macaddr_ne (PG_FUNCTION_ARGS);
+extern Datum macaddr_cmp (PG_FUNCTION_ARGS);
+extern Datum int82pl (PG_FUNCTION_ARGS);
+extern Datum int82mi (PG_FUNCTION_ARGS);
+extern Datum int82mul (PG_FUNCTION_ARGS);
+extern Datum int82div (PG_FUNCTION_ARGS);
+extern Datum int28pl (PG_FUNCTION_ARGS);
+extern Datum btint8cmp (PG_FUNCTION_ARGS);
+extern Datum cash_mul_flt4 (PG_FUNCTION_ARGS);
+extern Datum cash_div_flt4 (PG_FUNCTION_ARGS);
+extern Datum flt4_mul_cash (PG_FUNCTION_ARGS);
+extern Datum textpos (PG_FUNCTION_ARGS);
+extern Datum textlike (PG_FUNCTION_ARGS);
+extern Datum textnlike (PG_FUNCTION_ARGS);
+extern Datum int48eq (PG_FUNCTION_ARGS);
+extern Datum int48ne (PG_FUNCTION_ARGS);
+extern Datum int48lt (PG_FUNCTION_ARGS);
+extern Datum int48gt (PG_FUNCTION_ARGS);
+extern Datum int48le (PG_FUNCTION_ARGS);
+extern Datum int48ge (PG_FUNCTION_ARGS);
+extern Datum namelike (PG_FUNCTION_ARGS);
+extern Datum namenlike (PG_FUNCTION_ARGS);
+extern Datum char_bpchar (PG_FUNCTION_ARGS);
+extern Datum current_database (PG_FUNCTION_ARGS);
+extern Datum int4_mul_cash (PG_FUNCTION_ARGS);
+extern Datum int2_mul_cash (PG_FUNCTION_ARGS);
+extern Datum cash_mul_int4 (PG_FUNCTION_ARGS);
+extern Datum cash_div_int4 (PG_FUNCTION_ARGS);
+extern Datum cash_mul_int2 (PG_FUNCTION_ARGS);
+extern Datum cash_div_int2 (PG_FUNCTION_ARGS);
+extern Datum lower (PG_FUNCTION_ARGS);
+extern Datum upper (PG_FUNCTION_ARGS);
+extern Datum initcap (PG_FUNCTION_ARGS);
+extern Datum lpad (PG_FUNCTION_ARGS);
+extern Datum rpad (PG_FUNCTION_ARGS);
+extern Datum ltrim (PG_FUNCTION_ARGS);
+extern Datum rtrim (PG_FUNCTION_ARGS);
+extern Datum text_substr (PG_FUNCTION_ARGS);
+extern Datum translate (PG_FUNCTION_ARGS);
+extern Datum ltrim1 (PG_FUNCTION_ARGS);
+extern Datum text_substr_no_len (PG_FUNCTION_ARGS);
+extern Datum btrim (PG_FUNCTION_ARGS);
+extern Datum btrim1 (PG_FUNCTION_ARGS);
+extern Datum cash_in (PG_FUNCTION_ARGS);
+extern Datum cash_out (PG_FUNCTION_ARGS);
+extern Datum cash_eq (PG_FUNCTION_ARGS);
+extern Datum cash_ne (PG_FUNCTION_ARGS);
+extern Datum cash_lt (PG_FUNCTION_ARGS);
+extern Datum cash_le (PG_FUNCTION_ARGS);
+extern Datum cash_gt (PG_FUNCTION_ARGS);
+extern Datum cash_ge (PG_FUNCTION_ARGS);
+extern Datum cash_pl (PG_FUNCTION_ARGS);
+extern Datum cash_mi (PG_FUNCTION_ARGS);
+extern Datum cash_mul_flt8 (PG_FUNCTION_ARGS);
+extern Datum cash_div_flt8 (PG_FUNCTION_ARGS);
+extern Datum cashlarger (PG_FUNCTION_ARGS);
+extern Datum cashsmaller (PG_FUNCTION_ARGS);
+extern Datum inet_in (PG_FUNCTION_ARGS);
+extern Datum inet_out (PG_FUNCTION_ARGS);
+extern Datum flt8_mul_cash (PG_FUNCTION_ARGS);
+extern Datum network_eq (PG_FUNCTION_ARGS);
+extern Datum network_lt (PG_FUNCTION_ARGS);
+extern Datum network_le (PG_FUNCTION_ARGS);
+extern Datum network_gt (PG_FUNCTION_ARGS);
+extern Datum network_ge (PG_FUNCTION_ARGS);
+extern Datum network_ne (PG_FUNCTION_ARGS);
+extern Datum network_cmp (PG_FUNCTION_ARGS);
+extern Datum network_sub (PG_FUNCTION_ARGS);
+extern Datum network_subeq (PG_FUNCTION_ARGS);
+extern Datum network_sup (PG_FUNCTION_ARGS);
+extern Datum network_supeq (PG_FUNCTION_ARGS);
+extern Datum cash_words (PG_FUNCTION_ARGS);
+extern Datum generate_series_timestamp (PG_FUNCTION_ARGS);
+extern Datum generate_series_timestamptz (PG_FUNCTION_ARGS);
+extern Datum int28mi (PG_FUNCTION_ARGS);
+extern Datum int28mul (PG_FUNCTION_ARGS);
+extern Datum text_char (PG_FUNCTION_ARGS);
+extern Datum int8mod (PG_FUNCTION_ARGS);
+extern Datum char_text (PG_FUNCTION_ARGS);
+extern Datum int28div (PG_FUNCTION_ARGS);
+extern Datum hashint8 (PG_FUNCTION_ARGS);
+extern Datum lo_open (PG_FUNCTION_ARGS);
+extern Datum lo_close (PG_FUNCTION_ARGS);
+extern Datum loread (PG_FUNCTION_ARGS);
+extern Datum lowrite (PG_FUNCTION_ARGS);
+extern Datum lo_lseek (PG_FUNCTION_ARGS);
+extern Datum lo_creat (PG_FUNCTION_ARGS);
+extern Datum lo_tell (PG_FUNCTION_ARGS);
+extern Datum on_pl (PG_FUNCTION_ARGS);
+extern Datum on_sl (PG_FUNCTION_ARGS);
+extern Datum close_pl (PG_FUNCTION_ARGS);
+extern Datum close_sl (PG_FUNCTION_ARGS);
+extern Datum close_lb (PG_FUNCTION_ARGS);
+extern Datum lo_unlink (PG_FUNCTION_ARGS);
+extern Datum btvacuumcleanup (PG_FUNCTION_ARGS);
+extern Datum path_inter (PG_FUNCTION_ARGS);
+extern Datum box_area (PG_FUNCTION_ARGS);
+extern Datum box_width (PG_FUNCTION_ARGS);
+extern Datum box_height (PG_FUNCTION_ARGS);
+extern Datum box_distance (PG_FUNCTION_ARGS);
+extern Datum path_area (PG_FUNCTION_ARGS);
+extern Datum box_intersect (PG_FUNCTION_ARGS);
+extern Datum box_diagonal (PG_FUNCTION_ARGS);
+extern Datum path_n_lt (PG_FUNCTION_ARGS);
+extern Datum path_n_gt (PG_FUNCTION_ARGS);
+extern Datum path_n_eq (PG_FUNCTION_ARGS);
+extern Datum path_n_le (PG_FUNCTION_ARGS);
+extern Datum path_n_ge (PG_FUNCTION_ARGS);
+extern Datum path_length (PG_FUNCTION_ARGS);
+extern Datum point_ne (PG_FUNCTION_ARGS);
+extern Datum point_vert (PG_FUNCTION_ARGS);
+extern Datum point_horiz (PG_FUNCTION_ARGS);
+extern Datum point_distance (PG_FUNCTION_ARGS);
+extern Datum point_slope (PG_FUNCTION_ARGS);
+extern Datum lseg_construct (PG_FUNCTION_ARGS);
+extern Datum lseg_intersect (PG_FUNCTION_ARGS);
+extern Datum lseg_parallel (PG_FUNCTION_ARGS);
+extern Datum lseg_perp (PG_FUNCTION_ARGS);
+extern Datum lseg_vertical (PG_FUNCTION_ARGS);
+extern Datum lseg_horizontal (PG_FUNCTION_ARGS);
+extern Datum lseg_eq (PG_FUNCTION_ARGS);
+extern Datum lo_truncate (PG_FUNCTION_ARGS);
+extern Datum timestamptz_izone (PG_FUNCTION_ARGS);
+extern Datum gist_point_compress (PG_FUNCTION_ARGS);
+extern Datum aclitemin (PG_FUNCTION_ARGS);
+extern Datum aclitemout (PG_FUNCTION_ARGS);
+extern Datum aclinsert (PG_FUNCTION_ARGS);
+extern Datum aclremove (PG_FUNCTION_ARGS);
+extern Datum aclcontains (PG_FUNCTION_ARGS);
+extern Datum getdatabaseencoding (PG_FUNCTION_ARGS);
+extern Datum bpcharin (PG_FUNCTION_ARGS);
+extern Datum bpcharout (PG_FUNCTION_ARGS);
+extern Datum varcharin (PG_FUNCTION_ARGS);
+extern Datum varcharout (PG_FUNCTION_ARGS);
+extern Datum bpchareq (PG_FUNCTION_ARGS);
+extern Datum bpcharlt (PG_FUNCTION_ARGS);
+extern Datum bpcharle (PG_FUNCTION_ARGS);
+extern Datum bpchargt (PG_FUNCTION_ARGS);
+extern Datum bpcharge (PG_FUNCTION_ARGS);
+extern Datum bpcharne (PG_FUNCTION_ARGS);
+extern Datum aclitem_eq (PG_FUNCTION_ARGS);
+extern Datum bpchar_larger (PG_FUNCTION_ARGS);
+extern Datum bpchar_smaller (PG_FUNCTION_ARGS);
+extern Datum pg_prepared_xact (PG_FUNCTION_ARGS);
+extern Datum generate_series_step_int4 (PG_FUNCTION_ARGS);
+extern Datum generate_series_int4 (PG_FUNCTION_ARGS);
+extern Datum generate_series_step_int8 (PG_FUNCTION_ARGS);
+extern Datum generate_series_int8 (PG_FUNCTION_ARGS);
+extern Datum bpcharcmp (PG_FUNCTION_ARGS);
+extern Datum text_regclass (PG_FUNCTION_ARGS);
+extern Datum hashbpchar (PG_FUNCTION_ARGS);
+extern Datum format_type (PG_FUNCTION_ARGS);
+extern Datum date_in (PG_FUNCTION_ARGS);
+extern Datum date_out (PG_FUNCTION_ARGS);
+extern Datum date_eq (PG_FUNCTION_ARGS);
+extern Datum date_lt (PG_FUNCTION_ARGS);
+extern Datum date_le (PG_FUNCTION_ARGS);
+extern Datum date_gt (PG_FUNCTION_ARGS);
+extern Datum date_ge (PG_FUNCTION_ARGS);
+extern Datum date_ne (PG_FUNCTION_ARGS);
+extern Datum date_cmp (PG_FUNCTION_ARGS);
+extern Datum time_lt (PG_FUNCTION_ARGS);
+extern Datum time_le (PG_FUNCTION_ARGS);
+extern Datum time_gt (PG_FUNCTION_ARGS);
+extern Datum time_ge (PG_FUNCTION_ARGS);
+extern Datum time_ne (PG_FUNCTION_ARGS);
+extern Datum time_cmp (PG_FUNCTION_ARGS);
+extern Datum date_larger (PG_FUNCTION_ARGS);
+extern Datum date_smaller (PG_FUNCTION_ARGS);
+extern Datum date_mi (PG_FUNCTION_ARGS);
+extern Datum date_pli (PG_FUNCTION_ARGS);
+extern Datum date_mii (PG_FUNCTION_ARGS);
+extern Datum time_in (PG_FUNCTION_ARGS);
+extern Datum time_out (PG_FUNCTION_ARGS);
+extern Datum time_eq (PG_FUNCTION_ARGS);
+extern Datum circle_add_pt (PG_FUNCTION_ARGS);
+extern Datum circle_sub_pt (PG_FUNCTION_ARGS);
+extern Datum circle_mul_pt (PG_FUNCTION_ARGS);
+extern Datum circle_div_pt (PG_FUNCTION_ARGS);
+extern Datum timestamptz_in (PG_FUNCTION_ARGS);
+extern Datum timestamptz_out (PG_FUNCTION_ARGS);
+extern Datum timestamp_eq (PG_FUNCTION_ARGS);
+extern Datum timestamp_ne (PG_FUNCTION_ARGS);
+extern Datum timestamp_lt (PG_FUNCTION_ARGS);
+extern Datum timestamp_le (PG_FUNCTION_ARGS);
+extern Datum timestamp_ge (PG_FUNCTION_ARGS);
+extern Datum timestamp_gt (PG_FUNCTION_ARGS);
+extern Datum timestamptz_zone (PG_FUNCTION_ARGS);
+extern Datum interval_in (PG_FUNCTION_ARGS);
+extern Datum interval_out (PG_FUNCTION_ARGS);
+extern Datum interval_eq (PG_FUNCTION_ARGS);
+extern Datum interval_ne (PG_FUNCTION_ARGS);
+extern Datum interval_lt (PG_FUNCTION_ARGS);
+extern Datum interval_le (PG_FUNCTION_ARGS);
+extern Datum interval_ge (PG_FUNCTION_ARGS);
+extern Datum interval_gt (PG_FUNCTION_ARGS);
+extern Datum interval_um (PG_FUNCTION_ARGS);
+extern Datum interval_pl (PG_FUNCTION_ARGS);
+extern Datum interval_mi (PG_FUNCTION_ARGS);
+extern Datum timestamptz_part (PG_FUNCTION_ARGS);
+extern Datum interval_part (PG_FUNCTION_ARGS);
+extern Datum abstime_timestamptz (PG_FUNCTION_ARGS);
+extern Datum date_timestamptz (PG_FUNCTION_ARGS);
+extern Datum interval_justify_hours (PG_FUNCTION_ARGS);
+extern Datum reltime_interval (PG_FUNCTION_ARGS);
+extern Datum timestamptz_date (PG_FUNCTION_ARGS);
+extern Datum abstime_date (PG_FUNCTION_ARGS);
+extern Datum timestamptz_abstime (PG_FUNCTION_ARGS);
+extern Datum xid_age (PG_FUNCTION_ARGS);
+extern Datum timestamp_mi (PG_FUNCTION_ARGS);
+extern Datum timestamptz_pl_interval (PG_FUNCTION_ARGS);
+extern Datum timestamptz_mi_interval (PG_FUNCTION_ARGS);
+extern Datum generate_subscripts (PG_FUNCTION_ARGS);
+extern Datum generate_subscripts_nodir (PG_FUNCTION_ARGS);
+extern Datum array_fill (PG_FUNCTION_ARGS);
+extern Datum interval_reltime (PG_FUNCTION_ARGS);
+extern Datum timestamp_smaller (PG_FUNCTION_ARGS);
+extern Datum timestamp_larger (PG_FUNCTION_ARGS);
+extern Datum interval_smaller (PG_FUNCTION_ARGS);
+extern Datum interval_larger (PG_FUNCTION_ARGS);
+extern Datum timestamptz_age (PG_FUNCTION_ARGS);
+extern Datum interval_scale (PG_FUNCTION_ARGS);
+extern Datum timestamptz_trunc (PG_FUNCTION_ARGS);
+extern Datum interval_trunc (PG_FUNCTION_ARGS);
+extern Datum int8inc (PG_FUNCTION_ARGS);
+extern Datum int8abs (PG_FUNCTION_ARGS);
+extern Datum int8larger (PG_FUNCTION_ARGS);
+extern Datum int8smaller (PG_FUNCTION_ARGS);
+extern Datum texticregexeq (PG_FUNCTION_ARGS);
+extern Datum texticregexne (PG_FUNCTION_ARGS);
+extern Datum nameicregexeq (PG_FUNCTION_ARGS);
+extern Datum nameicregexne (PG_FUNCTION_ARGS);
+extern Datum boolin (PG_FUNCTION_ARGS);
+extern Datum boolout (PG_FUNCTION_ARGS);
+extern Datum byteain (PG_FUNCTION_ARGS);
+extern Datum charin (PG_FUNCTION_ARGS);
+extern Datum charlt (PG_FUNCTION_ARGS);
+extern Datum unique_key_recheck (PG_FUNCTION_ARGS);
+extern Datum int4abs (PG_FUNCTION_ARGS);
+extern Datum nameregexne (PG_FUNCTION_ARGS);
+extern Datum int2abs (PG_FUNCTION_ARGS);
+extern Datum textregexeq (PG_FUNCTION_ARGS);
+extern Datum textregexne (PG_FUNCTION_ARGS);
+extern Datum textlen (PG_FUNCTION_ARGS);
+extern Datum textcat (PG_FUNCTION_ARGS);
+extern Datum PG_char_to_encoding (PG_FUNCTION_ARGS);
+extern Datum tidne (PG_FUNCTION_ARGS);
+extern Datum cidr_in (PG_FUNCTION_ARGS);
+extern Datum btcostestimate (PG_FUNCTION_ARGS);
+extern Datum pg_column_size (PG_FUNCTION_ARGS);
+extern Datum overlaps_timetz (PG_FUNCTION_ARGS);
+extern Datum datetime_timestamp (PG_FUNCTION_ARGS);
+extern Datum timetz_part (PG_FUNCTION_ARGS);
+extern Datum int84pl (PG_FUNCTION_ARGS);
+extern Datum int84mi (PG_FUNCTION_ARGS);
+extern Datum int84mul (PG_FUNCTION_ARGS);
+extern Datum int84div (PG_FUNCTION_ARGS);
+extern Datum int48pl (PG_FUNCTION_ARGS);
+extern Datum int48mi (PG_FUNCTION_ARGS);
+extern Datum int48mul (PG_FUNCTION_ARGS);
+extern Datum int48div (PG_FUNCTION_ARGS);
+extern Datum quote_ident (PG_FUNCTION_ARGS);
+extern Datum quote_literal (PG_FUNCTION_ARGS);
+extern Datum array_fill_with_lower_bounds (PG_FUNCTION_ARGS);
+extern Datum i8tooid (PG_FUNCTION_ARGS);
+extern Datum oidtoi8 (PG_FUNCTION_ARGS);
+extern Datum quote_nullable (PG_FUNCTION_ARGS);
+extern Datum suppress_redundant_updates_trigger (PG_FUNCTION_ARGS);
+extern Datum tideq (PG_FUNCTION_ARGS);
+extern Datum currtid_byreloid (PG_FUNCTION_ARGS);
+extern Datum currtid_byrelname (PG_FUNCTION_ARGS);
+extern Datum interval_justify_days (PG_FUNCTION_ARGS);
+extern Datum datetimetz_timestamptz (PG_FUNCTION_ARGS);
+extern Datum now (PG_FUNCTION_ARGS);
+extern Datum positionsel (PG_FUNCTION_ARGS);
+extern Datum positionjoinsel (PG_FUNCTION_ARGS);
+extern Datum contsel (PG_FUNCTION_ARGS);
+extern Datum contjoinsel (PG_FUNCTION_ARGS);
+extern Datum overlaps_timestamp (PG_FUNCTION_ARGS);
+extern Datum overlaps_time (PG_FUNCTION_ARGS);
+extern Datum timestamp_in (PG_FUNCTION_ARGS);
+extern Datum timestamp_out (PG_FUNCTION_ARGS);
+extern Datum timestamp_cmp (PG_FUNCTION_ARGS);
+extern Datum interval_cmp (PG_FUNCTION_ARGS);
+extern Datum timestamp_time (PG_FUNCTION_ARGS);
+extern Datum bpcharlen (PG_FUNCTION_ARGS);
+extern Datum interval_div (PG_FUNCTION_ARGS);
+extern Datum dlog10 (PG_FUNCTION_ARGS);
+extern Datum oidvectortypes (PG_FUNCTION_ARGS);
+extern Datum timetz_in (PG_FUNCTION_ARGS);
+extern Datum timetz_out (PG_FUNCTION_ARGS);
+extern Datum timetz_eq (PG_FUNCTION_ARGS);
+extern Datum timetz_ne (PG_FUNCTION_ARGS);
+extern Datum timetz_lt (PG_FUNCTION_ARGS);
+extern Datum timetz_le (PG_FUNCTION_ARGS);
+extern Datum timetz_ge (PG_FUNCTION_ARGS);
+extern Datum timetz_gt (PG_FUNCTION_ARGS);
+extern Datum timetz_cmp (PG_FUNCTION_ARGS);
+extern Datum network_hostmask (PG_FUNCTION_ARGS);
+extern Datum makeaclitem (PG_FUNCTION_ARGS);
+extern Datum time_interval (PG_FUNCTION_ARGS);
+extern Datum pg_lock_status (PG_FUNCTION_ARGS);
+extern Datum date_finite (PG_FUNCTION_ARGS);
+extern Datum textoctetlen (PG_FUNCTION_ARGS);
+extern Datum bpcharoctetlen (PG_FUNCTION_ARGS);
+extern Datum time_larger (PG_FUNCTION_ARGS);
+extern Datum time_smaller (PG_FUNCTION_ARGS);
+extern Datum timetz_larger (PG_FUNCTION_ARGS);
+extern Datum timetz_smaller (PG_FUNCTION_ARGS);
+extern Datum time_part (PG_FUNCTION_ARGS);
+extern Datum pg_get_constraintdef (PG_FUNCTION_ARGS);
+extern Datum timestamptz_timetz (PG_FUNCTION_ARGS);
+extern Datum timestamp_finite (PG_FUNCTION_ARGS);
+extern Datum interval_finite (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_backend_start (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_backend_client_addr (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_backend_client_port (PG_FUNCTION_ARGS);
+extern Datum current_schema (PG_FUNCTION_ARGS);
+extern Datum current_schemas (PG_FUNCTION_ARGS);
+extern Datum textoverlay (PG_FUNCTION_ARGS);
+extern Datum textoverlay_no_len (PG_FUNCTION_ARGS);
+extern Datum line_parallel (PG_FUNCTION_ARGS);
+extern Datum line_perp (PG_FUNCTION_ARGS);
+extern Datum line_vertical (PG_FUNCTION_ARGS);
+extern Datum line_horizontal (PG_FUNCTION_ARGS);
+extern Datum circle_center (PG_FUNCTION_ARGS);
+extern Datum interval_time (PG_FUNCTION_ARGS);
+extern Datum points_box (PG_FUNCTION_ARGS);
+extern Datum box_add (PG_FUNCTION_ARGS);
+extern Datum box_sub (PG_FUNCTION_ARGS);
+extern Datum box_mul (PG_FUNCTION_ARGS);
+extern Datum box_div (PG_FUNCTION_ARGS);
+extern Datum cidr_out (PG_FUNCTION_ARGS);
+extern Datum poly_contain_pt (PG_FUNCTION_ARGS);
+extern Datum pt_contained_poly (PG_FUNCTION_ARGS);
+extern Datum path_isclosed (PG_FUNCTION_ARGS);
+extern Datum path_isopen (PG_FUNCTION_ARGS);
+extern Datum path_npoints (PG_FUNCTION_ARGS);
+extern Datum path_close (PG_FUNCTION_ARGS);
+extern Datum path_open (PG_FUNCTION_ARGS);
+extern Datum path_add (PG_FUNCTION_ARGS);
+extern Datum path_add_pt (PG_FUNCTION_ARGS);
+extern Datum path_sub_pt (PG_FUNCTION_ARGS);
+extern Datum path_mul_pt (PG_FUNCTION_ARGS);
+extern Datum path_div_pt (PG_FUNCTION_ARGS);
+extern Datum construct_point (PG_FUNCTION_ARGS);
+extern Datum point_add (PG_FUNCTION_ARGS);
+extern Datum point_sub (PG_FUNCTION_ARGS);
+extern Datum point_mul (PG_FUNCTION_ARGS);
+extern Datum point_div (PG_FUNCTION_ARGS);
+extern Datum poly_npoints (PG_FUNCTION_ARGS);
+extern Datum poly_box (PG_FUNCTION_ARGS);
+extern Datum poly_path (PG_FUNCTION_ARGS);
+extern Datum box_poly (PG_FUNCTION_ARGS);
+extern Datum path_poly (PG_FUNCTION_ARGS);
+extern Datum circle_in (PG_FUNCTION_ARGS);
+extern Datum circle_out (PG_FUNCTION_ARGS);
+extern Datum circle_same (PG_FUNCTION_ARGS);
+extern Datum circle_contain (PG_FUNCTION_ARGS);
+extern Datum circle_left (PG_FUNCTION_ARGS);
+extern Datum circle_overleft (PG_FUNCTION_ARGS);
+extern Datum circle_overright (PG_FUNCTION_ARGS);
+extern Datum circle_right (PG_FUNCTION_ARGS);
+extern Datum circle_contained (PG_FUNCTION_ARGS);
+extern Datum circle_overlap (PG_FUNCTION_ARGS);
+extern Datum circle_below (PG_FUNCTION_ARGS);
+extern Datum circle_above (PG_FUNCTION_ARGS);
+extern Datum circle_eq (PG_FUNCTION_ARGS);
+extern Datum circle_ne (PG_FUNCTION_ARGS);
+extern Datum circle_lt (PG_FUNCTION_ARGS);
+extern Datum circle_gt (PG_FUNCTION_ARGS);
+extern Datum circle_le (PG_FUNCTION_ARGS);
+extern Datum circle_ge (PG_FUNCTION_ARGS);
+extern Datum circle_area (PG_FUNCTION_ARGS);
+extern Datum circle_diameter (PG_FUNCTION_ARGS);
+extern Datum circle_radius (PG_FUNCTION_ARGS);
+extern Datum circle_distance (PG_FUNCTION_ARGS);
+extern Datum cr_circle (PG_FUNCTION_ARGS);
+extern Datum poly_circle (PG_FUNCTION_ARGS);
+extern Datum circle_poly (PG_FUNCTION_ARGS);
+extern Datum dist_pc (PG_FUNCTION_ARGS);
+extern Datum circle_contain_pt (PG_FUNCTION_ARGS);
+extern Datum pt_contained_circle (PG_FUNCTION_ARGS);
+extern Datum box_circle (PG_FUNCTION_ARGS);
+extern Datum circle_box (PG_FUNCTION_ARGS);
+extern Datum lseg_ne (PG_FUNCTION_ARGS);
+extern Datum lseg_lt (PG_FUNCTION_ARGS);
+extern Datum lseg_le (PG_FUNCTION_ARGS);
+extern Datum lseg_gt (PG_FUNCTION_ARGS);
+extern Datum lseg_ge (PG_FUNCTION_ARGS);
+extern Datum lseg_length (PG_FUNCTION_ARGS);
+extern Datum close_ls (PG_FUNCTION_ARGS);
+extern Datum close_lseg (PG_FUNCTION_ARGS);
+extern Datum line_in (PG_FUNCTION_ARGS);
+extern Datum line_out (PG_FUNCTION_ARGS);
+extern Datum line_eq (PG_FUNCTION_ARGS);
+extern Datum line_construct_pp (PG_FUNCTION_ARGS);
+extern Datum line_interpt (PG_FUNCTION_ARGS);
+extern Datum line_intersect (PG_FUNCTION_ARGS);
+extern Datum bit_in (PG_FUNCTION_ARGS);
+extern Datum bit_out (PG_FUNCTION_ARGS);
+extern Datum pg_get_ruledef (PG_FUNCTION_ARGS);
+extern Datum nextval_oid (PG_FUNCTION_ARGS);
+extern Datum currval_oid (PG_FUNCTION_ARGS);
+extern Datum setval_oid (PG_FUNCTION_ARGS);
+extern Datum varbit_in (PG_FUNCTION_ARGS);
+extern Datum varbit_out (PG_FUNCTION_ARGS);
+extern Datum biteq (PG_FUNCTION_ARGS);
+extern Datum bitne (PG_FUNCTION_ARGS);
+extern Datum bitge (PG_FUNCTION_ARGS);
+extern Datum bitgt (PG_FUNCTION_ARGS);
+extern Datum bitle (PG_FUNCTION_ARGS);
+extern Datum bitlt (PG_FUNCTION_ARGS);
+extern Datum bitcmp (PG_FUNCTION_ARGS);
+extern Datum PG_encoding_to_char (PG_FUNCTION_ARGS);
+extern Datum drandom (PG_FUNCTION_ARGS);
+extern Datum setseed (PG_FUNCTION_ARGS);
+extern Datum dasin (PG_FUNCTION_ARGS);
+extern Datum dacos (PG_FUNCTION_ARGS);
+extern Datum datan (PG_FUNCTION_ARGS);
+extern Datum datan2 (PG_FUNCTION_ARGS);
+extern Datum dsin (PG_FUNCTION_ARGS);
+extern Datum dcos (PG_FUNCTION_ARGS);
+extern Datum dtan (PG_FUNCTION_ARGS);
+extern Datum dcot (PG_FUNCTION_ARGS);
+extern Datum degrees (PG_FUNCTION_ARGS);
+extern Datum radians (PG_FUNCTION_ARGS);
+extern Datum dpi (PG_FUNCTION_ARGS);
+extern Datum interval_mul (PG_FUNCTION_ARGS);
+extern Datum pg_typeof (PG_FUNCTION_ARGS);
+extern Datum ascii (PG_FUNCTION_ARGS);
+extern Datum chr (PG_FUNCTION_ARGS);
+extern Datum repeat (PG_FUNCTION_ARGS);
+extern Datum similar_escape (PG_FUNCTION_ARGS);
+extern Datum mul_d_interval (PG_FUNCTION_ARGS);
+extern Datum texticlike (PG_FUNCTION_ARGS);
+extern Datum texticnlike (PG_FUNCTION_ARGS);
+extern Datum nameiclike (PG_FUNCTION_ARGS);
+extern Datum nameicnlike (PG_FUNCTION_ARGS);
+extern Datum like_escape (PG_FUNCTION_ARGS);
+extern Datum oidgt (PG_FUNCTION_ARGS);
+extern Datum oidge (PG_FUNCTION_ARGS);
+extern Datum pg_get_viewdef_name (PG_FUNCTION_ARGS);
+extern Datum pg_get_viewdef (PG_FUNCTION_ARGS);
+extern Datum pg_get_userbyid (PG_FUNCTION_ARGS);
+extern Datum pg_get_indexdef (PG_FUNCTION_ARGS);
+extern Datum RI_FKey_check_ins (PG_FUNCTION_ARGS);
+extern Datum RI_FKey_check_upd (PG_FUNCTION_ARGS);
+extern Datum RI_FKey_cascade_del (PG_FUNCTION_ARGS);
+extern Datum RI_FKey_cascade_upd (PG_FUNCTION_ARGS);
+extern Datum RI_FKey_restrict_del (PG_FUNCTION_ARGS);
+extern Datum RI_FKey_restrict_upd (PG_FUNCTION_ARGS);
+extern Datum RI_FKey_setnull_del (PG_FUNCTION_ARGS);
+extern Datum RI_FKey_setnull_upd (PG_FUNCTION_ARGS);
+extern Datum RI_FKey_setdefault_del (PG_FUNCTION_ARGS);
+extern Datum RI_FKey_setdefault_upd (PG_FUNCTION_ARGS);
+extern Datum RI_FKey_noaction_del (PG_FUNCTION_ARGS);
+extern Datum RI_FKey_noaction_upd (PG_FUNCTION_ARGS);
+extern Datum pg_get_triggerdef (PG_FUNCTION_ARGS);
+extern Datum pg_get_serial_sequence (PG_FUNCTION_ARGS);
+extern Datum bitand (PG_FUNCTION_ARGS);
+extern Datum bitor (PG_FUNCTION_ARGS);
+extern Datum bitxor (PG_FUNCTION_ARGS);
+extern Datum bitnot (PG_FUNCTION_ARGS);
+extern Datum bitshiftleft (PG_FUNCTION_ARGS);
+extern Datum bitshiftright (PG_FUNCTION_ARGS);
+extern Datum bitcat (PG_FUNCTION_ARGS);
+extern Datum bitsubstr (PG_FUNCTION_ARGS);
+extern Datum bitlength (PG_FUNCTION_ARGS);
+extern Datum bitoctetlength (PG_FUNCTION_ARGS);
+extern Datum bitfromint4 (PG_FUNCTION_ARGS);
+extern Datum bittoint4 (PG_FUNCTION_ARGS);
+extern Datum bit (PG_FUNCTION_ARGS);
+extern Datum pg_get_keywords (PG_FUNCTION_ARGS);
+extern Datum varbit (PG_FUNCTION_ARGS);
+extern Datum time_hash (PG_FUNCTION_ARGS);
+extern Datum aclexplode (PG_FUNCTION_ARGS);
+extern Datum time_mi_time (PG_FUNCTION_ARGS);
+extern Datum boolle (PG_FUNCTION_ARGS);
+extern Datum boolge (PG_FUNCTION_ARGS);
+extern Datum btboolcmp (PG_FUNCTION_ARGS);
+extern Datum timetz_hash (PG_FUNCTION_ARGS);
+extern Datum interval_hash (PG_FUNCTION_ARGS);
+extern Datum bitposition (PG_FUNCTION_ARGS);
+extern Datum bitsubstr_no_len (PG_FUNCTION_ARGS);
+extern Datum numeric_in (PG_FUNCTION_ARGS);
+extern Datum numeric_out (PG_FUNCTION_ARGS);
+extern Datum numeric (PG_FUNCTION_ARGS);
+extern Datum numeric_abs (PG_FUNCTION_ARGS);
+extern Datum numeric_sign (PG_FUNCTION_ARGS);
+extern Datum numeric_round (PG_FUNCTION_ARGS);
+extern Datum numeric_trunc (PG_FUNCTION_ARGS);
+extern Datum numeric_ceil (PG_FUNCTION_ARGS);
+extern Datum numeric_floor (PG_FUNCTION_ARGS);
+extern Datum length_in_encoding (PG_FUNCTION_ARGS);
+extern Datum pg_convert_from (PG_FUNCTION_ARGS);
+extern Datum inet_to_cidr (PG_FUNCTION_ARGS);
+extern Datum pg_get_expr (PG_FUNCTION_ARGS);
+extern Datum pg_convert_to (PG_FUNCTION_ARGS);
+extern Datum numeric_eq (PG_FUNCTION_ARGS);
+extern Datum numeric_ne (PG_FUNCTION_ARGS);
+extern Datum numeric_gt (PG_FUNCTION_ARGS);
+extern Datum numeric_ge (PG_FUNCTION_ARGS);
+extern Datum numeric_lt (PG_FUNCTION_ARGS);
+extern Datum numeric_le (PG_FUNCTION_ARGS);
+extern Datum numeric_add (PG_FUNCTION_ARGS);
+extern Datum numeric_sub (PG_FUNCTION_ARGS);
+extern Datum numeric_mul (PG_FUNCTION_ARGS);
+extern Datum numeric_div (PG_FUNCTION_ARGS);
+extern Datum numeric_mod (PG_FUNCTION_ARGS);
+extern Datum numeric_sqrt (PG_FUNCTION_ARGS);
+extern Datum numeric_exp (PG_FUNCTION_ARGS);
+extern Datum numeric_ln (PG_FUNCTION_ARGS);
+extern Datum numeric_log (PG_FUNCTION_ARGS);
+extern Datum numeric_power (PG_FUNCTION_ARGS);
+extern Datum int4_numeric (PG_FUNCTION_ARGS);
+extern Datum float4_numeric (PG_FUNCTION_ARGS);
+extern Datum float8_numeric (PG_FUNCTION_ARGS);
+extern Datum numeric_int4 (PG_FUNCTION_ARGS);
+extern Datum numeric_float4 (PG_FUNCTION_ARGS);
+extern Datum numeric_float8 (PG_FUNCTION_ARGS);
+extern Datum time_pl_interval (PG_FUNCTION_ARGS);
+extern Datum time_mi_interval (PG_FUNCTION_ARGS);
+extern Datum timetz_pl_interval (PG_FUNCTION_ARGS);
+extern Datum timetz_mi_interval (PG_FUNCTION_ARGS);
+extern Datum numeric_inc (PG_FUNCTION_ARGS);
+extern Datum setval3_oid (PG_FUNCTION_ARGS);
+extern Datum numeric_smaller (PG_FUNCTION_ARGS);
+extern Datum numeric_larger (PG_FUNCTION_ARGS);
+extern Datum interval_to_char (PG_FUNCTION_ARGS);
+extern Datum numeric_cmp (PG_FUNCTION_ARGS);
+extern Datum timestamptz_to_char (PG_FUNCTION_ARGS);
+extern Datum numeric_uminus (PG_FUNCTION_ARGS);
+extern Datum numeric_to_char (PG_FUNCTION_ARGS);
+extern Datum int4_to_char (PG_FUNCTION_ARGS);
+extern Datum int8_to_char (PG_FUNCTION_ARGS);
+extern Datum float4_to_char (PG_FUNCTION_ARGS);
+extern Datum float8_to_char (PG_FUNCTION_ARGS);
+extern Datum numeric_to_number (PG_FUNCTION_ARGS);
+extern Datum to_timestamp (PG_FUNCTION_ARGS);
+extern Datum numeric_int8 (PG_FUNCTION_ARGS);
+extern Datum to_date (PG_FUNCTION_ARGS);
+extern Datum int8_numeric (PG_FUNCTION_ARGS);
+extern Datum int2_numeric (PG_FUNCTION_ARGS);
+extern Datum numeric_int2 (PG_FUNCTION_ARGS);
+extern Datum oidin (PG_FUNCTION_ARGS);
+extern Datum oidout (PG_FUNCTION_ARGS);
+extern Datum pg_convert (PG_FUNCTION_ARGS);
+extern Datum iclikesel (PG_FUNCTION_ARGS);
+extern Datum icnlikesel (PG_FUNCTION_ARGS);
+extern Datum iclikejoinsel (PG_FUNCTION_ARGS);
+extern Datum icnlikejoinsel (PG_FUNCTION_ARGS);
+extern Datum regexeqsel (PG_FUNCTION_ARGS);
+extern Datum likesel (PG_FUNCTION_ARGS);
+extern Datum icregexeqsel (PG_FUNCTION_ARGS);
+extern Datum regexnesel (PG_FUNCTION_ARGS);
+extern Datum nlikesel (PG_FUNCTION_ARGS);
+extern Datum icregexnesel (PG_FUNCTION_ARGS);
+extern Datum regexeqjoinsel (PG_FUNCTION_ARGS);
+extern Datum likejoinsel (PG_FUNCTION_ARGS);
+extern Datum icregexeqjoinsel (PG_FUNCTION_ARGS);
+extern Datum regexnejoinsel (PG_FUNCTION_ARGS);
+extern Datum nlikejoinsel (PG_FUNCTION_ARGS);
+extern Datum icregexnejoinsel (PG_FUNCTION_ARGS);
+extern Datum float8_avg (PG_FUNCTION_ARGS);
+extern Datum float8_var_samp (PG_FUNCTION_ARGS);
+extern Datum float8_stddev_samp (PG_FUNCTION_ARGS);
+extern Datum numeric_accum (PG_FUNCTION_ARGS);
+extern Datum int2_accum (PG_FUNCTION_ARGS);
+extern Datum int4_accum (PG_FUNCTION_ARGS);
+extern Datum int8_accum (PG_FUNCTION_ARGS);
+extern Datum numeric_avg (PG_FUNCTION_ARGS);
+extern Datum numeric_var_samp (PG_FUNCTION_ARGS);
+extern Datum numeric_stddev_samp (PG_FUNCTION_ARGS);
+extern Datum int2_sum (PG_FUNCTION_ARGS);
+extern Datum int4_sum (PG_FUNCTION_ARGS);
+extern Datum int8_sum (PG_FUNCTION_ARGS);
+extern Datum interval_accum (PG_FUNCTION_ARGS);
+extern Datum interval_avg (PG_FUNCTION_ARGS);
+extern Datum to_ascii_default (PG_FUNCTION_ARGS);
+extern Datum to_ascii_enc (PG_FUNCTION_ARGS);
+extern Datum to_ascii_encname (PG_FUNCTION_ARGS);
+extern Datum int28eq (PG_FUNCTION_ARGS);
+extern Datum int28ne (PG_FUNCTION_ARGS);
+extern Datum int28lt (PG_FUNCTION_ARGS);
+extern Datum int28gt (PG_FUNCTION_ARGS);
+extern Datum int28le (PG_FUNCTION_ARGS);
+extern Datum int28ge (PG_FUNCTION_ARGS);
+extern Datum int82eq (PG_FUNCTION_ARGS);
+extern Datum int82ne (PG_FUNCTION_ARGS);
+extern Datum int82lt (PG_FUNCTION_ARGS);
+extern Datum int82gt (PG_FUNCTION_ARGS);
+extern Datum int82le (PG_FUNCTION_ARGS);
+extern Datum int82ge (PG_FUNCTION_ARGS);
+extern Datum int2and (PG_FUNCTION_ARGS);
+extern Datum int2or (PG_FUNCTION_ARGS);
+extern Datum int2xor (PG_FUNCTION_ARGS);
+extern Datum int2not (PG_FUNCTION_ARGS);
+extern Datum int2shl (PG_FUNCTION_ARGS);
+extern Datum int2shr (PG_FUNCTION_ARGS);
+extern Datum int4and (PG_FUNCTION_ARGS);
+extern Datum int4or (PG_FUNCTION_ARGS);
+extern Datum int4xor (PG_FUNCTION_ARGS);
+extern Datum int4not (PG_FUNCTION_ARGS);
+extern Datum int4shl (PG_FUNCTION_ARGS);
+extern Datum int4shr (PG_FUNCTION_ARGS);
+extern Datum int8and (PG_FUNCTION_ARGS);
+extern Datum int8or (PG_FUNCTION_ARGS);
+extern Datum int8xor (PG_FUNCTION_ARGS);
+extern Datum int8not (PG_FUNCTION_ARGS);
+extern Datum int8shl (PG_FUNCTION_ARGS);
+extern Datum int8shr (PG_FUNCTION_ARGS);
+extern Datum int8up (PG_FUNCTION_ARGS);
+extern Datum int2up (PG_FUNCTION_ARGS);
+extern Datum int4up (PG_FUNCTION_ARGS);
+extern Datum float4up (PG_FUNCTION_ARGS);
+extern Datum float8up (PG_FUNCTION_ARGS);
+extern Datum numeric_uplus (PG_FUNCTION_ARGS);
+extern Datum has_table_privilege_name_name (PG_FUNCTION_ARGS);
+extern Datum has_table_privilege_name_id (PG_FUNCTION_ARGS);
+extern Datum has_table_privilege_id_name (PG_FUNCTION_ARGS);
+extern Datum has_table_privilege_id_id (PG_FUNCTION_ARGS);
+extern Datum has_table_privilege_name (PG_FUNCTION_ARGS);
+extern Datum has_table_privilege_id (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_numscans (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_tuples_returned (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_tuples_fetched (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_tuples_inserted (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_tuples_updated (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_tuples_deleted (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_blocks_fetched (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_blocks_hit (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_backend_idset (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_backend_pid (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_backend_dbid (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_backend_userid (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_backend_activity (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_db_numbackends (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_db_xact_commit (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_db_xact_rollback (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_db_blocks_fetched (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_db_blocks_hit (PG_FUNCTION_ARGS);
+extern Datum binary_encode (PG_FUNCTION_ARGS);
+extern Datum binary_decode (PG_FUNCTION_ARGS);
+extern Datum byteaeq (PG_FUNCTION_ARGS);
+extern Datum bytealt (PG_FUNCTION_ARGS);
+extern Datum byteale (PG_FUNCTION_ARGS);
+extern Datum byteagt (PG_FUNCTION_ARGS);
+extern Datum byteage (PG_FUNCTION_ARGS);
+extern Datum byteane (PG_FUNCTION_ARGS);
+extern Datum byteacmp (PG_FUNCTION_ARGS);
+extern Datum timestamp_scale (PG_FUNCTION_ARGS);
+extern Datum int2_avg_accum (PG_FUNCTION_ARGS);
+extern Datum int4_avg_accum (PG_FUNCTION_ARGS);
+extern Datum int8_avg (PG_FUNCTION_ARGS);
+extern Datum oidlarger (PG_FUNCTION_ARGS);
+extern Datum oidsmaller (PG_FUNCTION_ARGS);
+extern Datum timestamptz_scale (PG_FUNCTION_ARGS);
+extern Datum time_scale (PG_FUNCTION_ARGS);
+extern Datum timetz_scale (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_tuples_hot_updated (PG_FUNCTION_ARGS);
+extern Datum numeric_div_trunc (PG_FUNCTION_ARGS);
+extern Datum bytealike (PG_FUNCTION_ARGS);
+extern Datum byteanlike (PG_FUNCTION_ARGS);
+extern Datum like_escape_bytea (PG_FUNCTION_ARGS);
+extern Datum byteacat (PG_FUNCTION_ARGS);
+extern Datum bytea_substr (PG_FUNCTION_ARGS);
+extern Datum bytea_substr_no_len (PG_FUNCTION_ARGS);
+extern Datum byteapos (PG_FUNCTION_ARGS);
+extern Datum byteatrim (PG_FUNCTION_ARGS);
+extern Datum timestamptz_time (PG_FUNCTION_ARGS);
+extern Datum timestamp_trunc (PG_FUNCTION_ARGS);
+extern Datum timestamp_part (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_activity (PG_FUNCTION_ARGS);
+extern Datum abstime_timestamp (PG_FUNCTION_ARGS);
+extern Datum date_timestamp (PG_FUNCTION_ARGS);
+extern Datum pg_backend_pid (PG_FUNCTION_ARGS);
+extern Datum timestamptz_timestamp (PG_FUNCTION_ARGS);
+extern Datum timestamp_timestamptz (PG_FUNCTION_ARGS);
+extern Datum timestamp_date (PG_FUNCTION_ARGS);
+extern Datum timestamp_abstime (PG_FUNCTION_ARGS);
+extern Datum timestamp_pl_interval (PG_FUNCTION_ARGS);
+extern Datum timestamp_mi_interval (PG_FUNCTION_ARGS);
+extern Datum pg_conf_load_time (PG_FUNCTION_ARGS);
+extern Datum timetz_zone (PG_FUNCTION_ARGS);
+extern Datum timetz_izone (PG_FUNCTION_ARGS);
+extern Datum timestamp_hash (PG_FUNCTION_ARGS);
+extern Datum timetz_time (PG_FUNCTION_ARGS);
+extern Datum time_timetz (PG_FUNCTION_ARGS);
+extern Datum timestamp_to_char (PG_FUNCTION_ARGS);
+extern Datum aggregate_dummy (PG_FUNCTION_ARGS);
+extern Datum timestamp_age (PG_FUNCTION_ARGS);
+extern Datum timestamp_zone (PG_FUNCTION_ARGS);
+extern Datum timestamp_izone (PG_FUNCTION_ARGS);
+extern Datum date_pl_interval (PG_FUNCTION_ARGS);
+extern Datum date_mi_interval (PG_FUNCTION_ARGS);
+extern Datum textregexsubstr (PG_FUNCTION_ARGS);
+extern Datum bitfromint8 (PG_FUNCTION_ARGS);
+extern Datum bittoint8 (PG_FUNCTION_ARGS);
+extern Datum show_config_by_name (PG_FUNCTION_ARGS);
+extern Datum set_config_by_name (PG_FUNCTION_ARGS);
+extern Datum pg_table_is_visible (PG_FUNCTION_ARGS);
+extern Datum pg_type_is_visible (PG_FUNCTION_ARGS);
+extern Datum pg_function_is_visible (PG_FUNCTION_ARGS);
+extern Datum pg_operator_is_visible (PG_FUNCTION_ARGS);
+extern Datum pg_opclass_is_visible (PG_FUNCTION_ARGS);
+extern Datum show_all_settings (PG_FUNCTION_ARGS);
+extern Datum replace_text (PG_FUNCTION_ARGS);
+extern Datum split_text (PG_FUNCTION_ARGS);
+extern Datum to_hex32 (PG_FUNCTION_ARGS);
+extern Datum to_hex64 (PG_FUNCTION_ARGS);
+extern Datum array_lower (PG_FUNCTION_ARGS);
+extern Datum array_upper (PG_FUNCTION_ARGS);
+extern Datum pg_conversion_is_visible (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_backend_activity_start (PG_FUNCTION_ARGS);
+extern Datum pg_terminate_backend (PG_FUNCTION_ARGS);
+extern Datum pg_get_functiondef (PG_FUNCTION_ARGS);
+extern Datum text_pattern_lt (PG_FUNCTION_ARGS);
+extern Datum text_pattern_le (PG_FUNCTION_ARGS);
+extern Datum pg_get_function_arguments (PG_FUNCTION_ARGS);
+extern Datum text_pattern_ge (PG_FUNCTION_ARGS);
+extern Datum text_pattern_gt (PG_FUNCTION_ARGS);
+extern Datum pg_get_function_result (PG_FUNCTION_ARGS);
+extern Datum bttext_pattern_cmp (PG_FUNCTION_ARGS);
+extern Datum pg_database_size_name (PG_FUNCTION_ARGS);
+extern Datum width_bucket_numeric (PG_FUNCTION_ARGS);
+extern Datum pg_cancel_backend (PG_FUNCTION_ARGS);
+extern Datum pg_start_backup (PG_FUNCTION_ARGS);
+extern Datum pg_stop_backup (PG_FUNCTION_ARGS);
+extern Datum bpchar_pattern_lt (PG_FUNCTION_ARGS);
+extern Datum bpchar_pattern_le (PG_FUNCTION_ARGS);
+extern Datum array_length (PG_FUNCTION_ARGS);
+extern Datum bpchar_pattern_ge (PG_FUNCTION_ARGS);
+extern Datum bpchar_pattern_gt (PG_FUNCTION_ARGS);
+extern Datum gist_point_consistent (PG_FUNCTION_ARGS);
+extern Datum btbpchar_pattern_cmp (PG_FUNCTION_ARGS);
+extern Datum has_sequence_privilege_name_name (PG_FUNCTION_ARGS);
+extern Datum has_sequence_privilege_name_id (PG_FUNCTION_ARGS);
+extern Datum has_sequence_privilege_id_name (PG_FUNCTION_ARGS);
+extern Datum has_sequence_privilege_id_id (PG_FUNCTION_ARGS);
+extern Datum has_sequence_privilege_name (PG_FUNCTION_ARGS);
+extern Datum has_sequence_privilege_id (PG_FUNCTION_ARGS);
+extern Datum btint48cmp (PG_FUNCTION_ARGS);
+extern Datum btint84cmp (PG_FUNCTION_ARGS);
+extern Datum btint24cmp (PG_FUNCTION_ARGS);
+extern Datum btint42cmp (PG_FUNCTION_ARGS);
+extern Datum btint28cmp (PG_FUNCTION_ARGS);
+extern Datum btint82cmp (PG_FUNCTION_ARGS);
+extern Datum btfloat48cmp (PG_FUNCTION_ARGS);
+extern Datum btfloat84cmp (PG_FUNCTION_ARGS);
+extern Datum inet_client_addr (PG_FUNCTION_ARGS);
+extern Datum inet_client_port (PG_FUNCTION_ARGS);
+extern Datum inet_server_addr (PG_FUNCTION_ARGS);
+extern Datum inet_server_port (PG_FUNCTION_ARGS);
+extern Datum regprocedurein (PG_FUNCTION_ARGS);
+extern Datum regprocedureout (PG_FUNCTION_ARGS);
+extern Datum regoperin (PG_FUNCTION_ARGS);
+extern Datum regoperout (PG_FUNCTION_ARGS);
+extern Datum regoperatorin (PG_FUNCTION_ARGS);
+extern Datum regoperatorout (PG_FUNCTION_ARGS);
+extern Datum regclassin (PG_FUNCTION_ARGS);
+extern Datum regclassout (PG_FUNCTION_ARGS);
+extern Datum regtypein (PG_FUNCTION_ARGS);
+extern Datum regtypeout (PG_FUNCTION_ARGS);
+extern Datum pg_stat_clear_snapshot (PG_FUNCTION_ARGS);
+extern Datum pg_get_function_identity_arguments (PG_FUNCTION_ARGS);
+extern Datum fmgr_internal_validator (PG_FUNCTION_ARGS);
+extern Datum fmgr_c_validator (PG_FUNCTION_ARGS);
+extern Datum fmgr_sql_validator (PG_FUNCTION_ARGS);
+extern Datum has_database_privilege_name_name (PG_FUNCTION_ARGS);
+extern Datum has_database_privilege_name_id (PG_FUNCTION_ARGS);
+extern Datum has_database_privilege_id_name (PG_FUNCTION_ARGS);
+extern Datum has_database_privilege_id_id (PG_FUNCTION_ARGS);
+extern Datum has_database_privilege_name (PG_FUNCTION_ARGS);
+extern Datum has_database_privilege_id (PG_FUNCTION_ARGS);
+extern Datum has_function_privilege_name_name (PG_FUNCTION_ARGS);
+extern Datum has_function_privilege_name_id (PG_FUNCTION_ARGS);
+extern Datum has_function_privilege_id_name (PG_FUNCTION_ARGS);
+extern Datum has_function_privilege_id_id (PG_FUNCTION_ARGS);
+extern Datum has_function_privilege_name (PG_FUNCTION_ARGS);
+extern Datum has_function_privilege_id (PG_FUNCTION_ARGS);
+extern Datum has_language_privilege_name_name (PG_FUNCTION_ARGS);
+extern Datum has_language_privilege_name_id (PG_FUNCTION_ARGS);
+extern Datum has_language_privilege_id_name (PG_FUNCTION_ARGS);
+extern Datum has_language_privilege_id_id (PG_FUNCTION_ARGS);
+extern Datum has_language_privilege_name (PG_FUNCTION_ARGS);
+extern Datum has_language_privilege_id (PG_FUNCTION_ARGS);
+extern Datum has_schema_privilege_name_name (PG_FUNCTION_ARGS);
+extern Datum has_schema_privilege_name_id (PG_FUNCTION_ARGS);
+extern Datum has_schema_privilege_id_name (PG_FUNCTION_ARGS);
+extern Datum has_schema_privilege_id_id (PG_FUNCTION_ARGS);
+extern Datum has_schema_privilege_name (PG_FUNCTION_ARGS);
+extern Datum has_schema_privilege_id (PG_FUNCTION_ARGS);
+extern Datum pg_stat_reset (PG_FUNCTION_ARGS);
+extern Datum textregexreplace_noopt (PG_FUNCTION_ARGS);
+extern Datum textregexreplace (PG_FUNCTION_ARGS);
+extern Datum pg_total_relation_size (PG_FUNCTION_ARGS);
+extern Datum pg_size_pretty (PG_FUNCTION_ARGS);
+extern Datum pg_options_to_table (PG_FUNCTION_ARGS);
+extern Datum record_in (PG_FUNCTION_ARGS);
+extern Datum record_out (PG_FUNCTION_ARGS);
+extern Datum cstring_in (PG_FUNCTION_ARGS);
+extern Datum cstring_out (PG_FUNCTION_ARGS);
+extern Datum any_in (PG_FUNCTION_ARGS);
+extern Datum any_out (PG_FUNCTION_ARGS);
+extern Datum anyarray_in (PG_FUNCTION_ARGS);
+extern Datum anyarray_out (PG_FUNCTION_ARGS);
+extern Datum void_in (PG_FUNCTION_ARGS);
+extern Datum void_out (PG_FUNCTION_ARGS);
+extern Datum trigger_in (PG_FUNCTION_ARGS);
+extern Datum trigger_out (PG_FUNCTION_ARGS);
+extern Datum language_handler_in (PG_FUNCTION_ARGS);
+extern Datum language_handler_out (PG_FUNCTION_ARGS);
+extern Datum internal_in (PG_FUNCTION_ARGS);
+extern Datum internal_out (PG_FUNCTION_ARGS);
+extern Datum opaque_in (PG_FUNCTION_ARGS);
+extern Datum opaque_out (PG_FUNCTION_ARGS);
+extern Datum dceil (PG_FUNCTION_ARGS);
+extern Datum dfloor (PG_FUNCTION_ARGS);
+extern Datum dsign (PG_FUNCTION_ARGS);
+extern Datum md5_text (PG_FUNCTION_ARGS);
+extern Datum anyelement_in (PG_FUNCTION_ARGS);
+extern Datum anyelement_out (PG_FUNCTION_ARGS);
+extern Datum postgresql_fdw_validator (PG_FUNCTION_ARGS);
+extern Datum pg_encoding_max_length_sql (PG_FUNCTION_ARGS);
+extern Datum md5_bytea (PG_FUNCTION_ARGS);
+extern Datum pg_tablespace_size_oid (PG_FUNCTION_ARGS);
+extern Datum pg_tablespace_size_name (PG_FUNCTION_ARGS);
+extern Datum pg_database_size_oid (PG_FUNCTION_ARGS);
+extern Datum array_unnest (PG_FUNCTION_ARGS);
+extern Datum pg_relation_size (PG_FUNCTION_ARGS);
+extern Datum array_agg_transfn (PG_FUNCTION_ARGS);
+extern Datum array_agg_finalfn (PG_FUNCTION_ARGS);
+extern Datum date_lt_timestamp (PG_FUNCTION_ARGS);
+extern Datum date_le_timestamp (PG_FUNCTION_ARGS);
+extern Datum date_eq_timestamp (PG_FUNCTION_ARGS);
+extern Datum date_gt_timestamp (PG_FUNCTION_ARGS);
+extern Datum date_ge_timestamp (PG_FUNCTION_ARGS);
+extern Datum date_ne_timestamp (PG_FUNCTION_ARGS);
+extern Datum date_cmp_timestamp (PG_FUNCTION_ARGS);
+extern Datum date_lt_timestamptz (PG_FUNCTION_ARGS);
+extern Datum date_le_timestamptz (PG_FUNCTION_ARGS);
+extern Datum date_eq_timestamptz (PG_FUNCTION_ARGS);
+extern Datum date_gt_timestamptz (PG_FUNCTION_ARGS);
+extern Datum date_ge_timestamptz (PG_FUNCTION_ARGS);
+extern Datum date_ne_timestamptz (PG_FUNCTION_ARGS);
+extern Datum date_cmp_timestamptz (PG_FUNCTION_ARGS);
+extern Datum timestamp_lt_date (PG_FUNCTION_ARGS);
+extern Datum timestamp_le_date (PG_FUNCTION_ARGS);
+extern Datum timestamp_eq_date (PG_FUNCTION_ARGS);
+extern Datum timestamp_gt_date (PG_FUNCTION_ARGS);
+extern Datum timestamp_ge_date (PG_FUNCTION_ARGS);
+extern Datum timestamp_ne_date (PG_FUNCTION_ARGS);
+extern Datum timestamp_cmp_date (PG_FUNCTION_ARGS);
+extern Datum timestamptz_lt_date (PG_FUNCTION_ARGS);
+extern Datum timestamptz_le_date (PG_FUNCTION_ARGS);
+extern Datum timestamptz_eq_date (PG_FUNCTION_ARGS);
+extern Datum timestamptz_gt_date (PG_FUNCTION_ARGS);
+extern Datum timestamptz_ge_date (PG_FUNCTION_ARGS);
+extern Datum timestamptz_ne_date (PG_FUNCTION_ARGS);
+extern Datum timestamptz_cmp_date (PG_FUNCTION_ARGS);
+extern Datum has_tablespace_privilege_name_name (PG_FUNCTION_ARGS);
+extern Datum has_tablespace_privilege_name_id (PG_FUNCTION_ARGS);
+extern Datum has_tablespace_privilege_id_name (PG_FUNCTION_ARGS);
+extern Datum has_tablespace_privilege_id_id (PG_FUNCTION_ARGS);
+extern Datum has_tablespace_privilege_name (PG_FUNCTION_ARGS);
+extern Datum has_tablespace_privilege_id (PG_FUNCTION_ARGS);
+extern Datum shell_in (PG_FUNCTION_ARGS);
+extern Datum shell_out (PG_FUNCTION_ARGS);
+extern Datum array_recv (PG_FUNCTION_ARGS);
+extern Datum array_send (PG_FUNCTION_ARGS);
+extern Datum record_recv (PG_FUNCTION_ARGS);
+extern Datum record_send (PG_FUNCTION_ARGS);
+extern Datum int2recv (PG_FUNCTION_ARGS);
+extern Datum int2send (PG_FUNCTION_ARGS);
+extern Datum int4recv (PG_FUNCTION_ARGS);
+extern Datum int4send (PG_FUNCTION_ARGS);
+extern Datum int8recv (PG_FUNCTION_ARGS);
+extern Datum int8send (PG_FUNCTION_ARGS);
+extern Datum int2vectorrecv (PG_FUNCTION_ARGS);
+extern Datum int2vectorsend (PG_FUNCTION_ARGS);
+extern Datum bytearecv (PG_FUNCTION_ARGS);
+extern Datum byteasend (PG_FUNCTION_ARGS);
+extern Datum textrecv (PG_FUNCTION_ARGS);
+extern Datum textsend (PG_FUNCTION_ARGS);
+extern Datum unknownrecv (PG_FUNCTION_ARGS);
+extern Datum unknownsend (PG_FUNCTION_ARGS);
+extern Datum oidrecv (PG_FUNCTION_ARGS);
+extern Datum oidsend (PG_FUNCTION_ARGS);
+extern Datum oidvectorrecv (PG_FUNCTION_ARGS);
+extern Datum oidvectorsend (PG_FUNCTION_ARGS);
+extern Datum namerecv (PG_FUNCTION_ARGS);
+extern Datum namesend (PG_FUNCTION_ARGS);
+extern Datum float4recv (PG_FUNCTION_ARGS);
+extern Datum float4send (PG_FUNCTION_ARGS);
+extern Datum float8recv (PG_FUNCTION_ARGS);
+extern Datum float8send (PG_FUNCTION_ARGS);
+extern Datum point_recv (PG_FUNCTION_ARGS);
+extern Datum point_send (PG_FUNCTION_ARGS);
+extern Datum bpcharrecv (PG_FUNCTION_ARGS);
+extern Datum bpcharsend (PG_FUNCTION_ARGS);
+extern Datum varcharrecv (PG_FUNCTION_ARGS);
+extern Datum varcharsend (PG_FUNCTION_ARGS);
+extern Datum charrecv (PG_FUNCTION_ARGS);
+extern Datum charsend (PG_FUNCTION_ARGS);
+extern Datum boolrecv (PG_FUNCTION_ARGS);
+extern Datum boolsend (PG_FUNCTION_ARGS);
+extern Datum tidrecv (PG_FUNCTION_ARGS);
+extern Datum tidsend (PG_FUNCTION_ARGS);
+extern Datum xidrecv (PG_FUNCTION_ARGS);
+extern Datum xidsend (PG_FUNCTION_ARGS);
+extern Datum cidrecv (PG_FUNCTION_ARGS);
+extern Datum cidsend (PG_FUNCTION_ARGS);
+extern Datum regprocrecv (PG_FUNCTION_ARGS);
+extern Datum regprocsend (PG_FUNCTION_ARGS);
+extern Datum regprocedurerecv (PG_FUNCTION_ARGS);
+extern Datum regproceduresend (PG_FUNCTION_ARGS);
+extern Datum regoperrecv (PG_FUNCTION_ARGS);
+extern Datum regopersend (PG_FUNCTION_ARGS);
+extern Datum regoperatorrecv (PG_FUNCTION_ARGS);
+extern Datum regoperatorsend (PG_FUNCTION_ARGS);
+extern Datum regclassrecv (PG_FUNCTION_ARGS);
+extern Datum regclasssend (PG_FUNCTION_ARGS);
+extern Datum regtyperecv (PG_FUNCTION_ARGS);
+extern Datum regtypesend (PG_FUNCTION_ARGS);
+extern Datum bit_recv (PG_FUNCTION_ARGS);
+extern Datum bit_send (PG_FUNCTION_ARGS);
+extern Datum varbit_recv (PG_FUNCTION_ARGS);
+extern Datum varbit_send (PG_FUNCTION_ARGS);
+extern Datum numeric_recv (PG_FUNCTION_ARGS);
+extern Datum numeric_send (PG_FUNCTION_ARGS);
+extern Datum abstimerecv (PG_FUNCTION_ARGS);
+extern Datum abstimesend (PG_FUNCTION_ARGS);
+extern Datum reltimerecv (PG_FUNCTION_ARGS);
+extern Datum reltimesend (PG_FUNCTION_ARGS);
+extern Datum tintervalrecv (PG_FUNCTION_ARGS);
+extern Datum tintervalsend (PG_FUNCTION_ARGS);
+extern Datum date_recv (PG_FUNCTION_ARGS);
+extern Datum date_send (PG_FUNCTION_ARGS);
+extern Datum time_recv (PG_FUNCTION_ARGS);
+extern Datum time_send (PG_FUNCTION_ARGS);
+extern Datum timetz_recv (PG_FUNCTION_ARGS);
+extern Datum timetz_send (PG_FUNCTION_ARGS);
+extern Datum timestamp_recv (PG_FUNCTION_ARGS);
+extern Datum timestamp_send (PG_FUNCTION_ARGS);
+extern Datum timestamptz_recv (PG_FUNCTION_ARGS);
+extern Datum timestamptz_send (PG_FUNCTION_ARGS);
+extern Datum interval_recv (PG_FUNCTION_ARGS);
+extern Datum interval_send (PG_FUNCTION_ARGS);
+extern Datum lseg_recv (PG_FUNCTION_ARGS);
+extern Datum lseg_send (PG_FUNCTION_ARGS);
+extern Datum path_recv (PG_FUNCTION_ARGS);
+extern Datum path_send (PG_FUNCTION_ARGS);
+extern Datum box_recv (PG_FUNCTION_ARGS);
+extern Datum box_send (PG_FUNCTION_ARGS);
+extern Datum poly_recv (PG_FUNCTION_ARGS);
+extern Datum poly_send (PG_FUNCTION_ARGS);
+extern Datum line_recv (PG_FUNCTION_ARGS);
+extern Datum line_send (PG_FUNCTION_ARGS);
+extern Datum circle_recv (PG_FUNCTION_ARGS);
+extern Datum circle_send (PG_FUNCTION_ARGS);
+extern Datum cash_recv (PG_FUNCTION_ARGS);
+extern Datum cash_send (PG_FUNCTION_ARGS);
+extern Datum macaddr_recv (PG_FUNCTION_ARGS);
+extern Datum macaddr_send (PG_FUNCTION_ARGS);
+extern Datum inet_recv (PG_FUNCTION_ARGS);
+extern Datum inet_send (PG_FUNCTION_ARGS);
+extern Datum cidr_recv (PG_FUNCTION_ARGS);
+extern Datum cidr_send (PG_FUNCTION_ARGS);
+extern Datum cstring_recv (PG_FUNCTION_ARGS);
+extern Datum cstring_send (PG_FUNCTION_ARGS);
+extern Datum anyarray_recv (PG_FUNCTION_ARGS);
+extern Datum anyarray_send (PG_FUNCTION_ARGS);
+extern Datum pg_get_ruledef_ext (PG_FUNCTION_ARGS);
+extern Datum pg_get_viewdef_name_ext (PG_FUNCTION_ARGS);
+extern Datum pg_get_viewdef_ext (PG_FUNCTION_ARGS);
+extern Datum pg_get_indexdef_ext (PG_FUNCTION_ARGS);
+extern Datum pg_get_constraintdef_ext (PG_FUNCTION_ARGS);
+extern Datum pg_get_expr_ext (PG_FUNCTION_ARGS);
+extern Datum pg_prepared_statement (PG_FUNCTION_ARGS);
+extern Datum pg_cursor (PG_FUNCTION_ARGS);
+extern Datum float8_var_pop (PG_FUNCTION_ARGS);
+extern Datum float8_stddev_pop (PG_FUNCTION_ARGS);
+extern Datum numeric_var_pop (PG_FUNCTION_ARGS);
+extern Datum booland_statefunc (PG_FUNCTION_ARGS);
+extern Datum boolor_statefunc (PG_FUNCTION_ARGS);
+extern Datum timestamp_lt_timestamptz (PG_FUNCTION_ARGS);
+extern Datum timestamp_le_timestamptz (PG_FUNCTION_ARGS);
+extern Datum timestamp_eq_timestamptz (PG_FUNCTION_ARGS);
+extern Datum timestamp_gt_timestamptz (PG_FUNCTION_ARGS);
+extern Datum timestamp_ge_timestamptz (PG_FUNCTION_ARGS);
+extern Datum timestamp_ne_timestamptz (PG_FUNCTION_ARGS);
+extern Datum timestamp_cmp_timestamptz (PG_FUNCTION_ARGS);
+extern Datum timestamptz_lt_timestamp (PG_FUNCTION_ARGS);
+extern Datum timestamptz_le_timestamp (PG_FUNCTION_ARGS);
+extern Datum timestamptz_eq_timestamp (PG_FUNCTION_ARGS);
+extern Datum timestamptz_gt_timestamp (PG_FUNCTION_ARGS);
+extern Datum timestamptz_ge_timestamp (PG_FUNCTION_ARGS);
+extern Datum timestamptz_ne_timestamp (PG_FUNCTION_ARGS);
+extern Datum timestamptz_cmp_timestamp (PG_FUNCTION_ARGS);
+extern Datum pg_tablespace_databases (PG_FUNCTION_ARGS);
+extern Datum int4_bool (PG_FUNCTION_ARGS);
+extern Datum bool_int4 (PG_FUNCTION_ARGS);
+extern Datum lastval (PG_FUNCTION_ARGS);
+extern Datum pg_postmaster_start_time (PG_FUNCTION_ARGS);
+extern Datum gistvacuumcleanup (PG_FUNCTION_ARGS);
+extern Datum box_below (PG_FUNCTION_ARGS);
+extern Datum box_overbelow (PG_FUNCTION_ARGS);
+extern Datum box_overabove (PG_FUNCTION_ARGS);
+extern Datum box_above (PG_FUNCTION_ARGS);
+extern Datum poly_below (PG_FUNCTION_ARGS);
+extern Datum poly_overbelow (PG_FUNCTION_ARGS);
+extern Datum poly_overabove (PG_FUNCTION_ARGS);
+extern Datum poly_above (PG_FUNCTION_ARGS);
+extern Datum gist_box_consistent (PG_FUNCTION_ARGS);
+extern Datum gist_box_compress (PG_FUNCTION_ARGS);
+extern Datum gist_box_decompress (PG_FUNCTION_ARGS);
+extern Datum gist_box_penalty (PG_FUNCTION_ARGS);
+extern Datum gist_box_picksplit (PG_FUNCTION_ARGS);
+extern Datum gist_box_union (PG_FUNCTION_ARGS);
+extern Datum gist_box_same (PG_FUNCTION_ARGS);
+extern Datum gist_poly_consistent (PG_FUNCTION_ARGS);
+extern Datum gist_poly_compress (PG_FUNCTION_ARGS);
+extern Datum circle_overbelow (PG_FUNCTION_ARGS);
+extern Datum circle_overabove (PG_FUNCTION_ARGS);
+extern Datum gist_circle_consistent (PG_FUNCTION_ARGS);
+extern Datum gist_circle_compress (PG_FUNCTION_ARGS);
+extern Datum numeric_stddev_pop (PG_FUNCTION_ARGS);
+extern Datum domain_in (PG_FUNCTION_ARGS);
+extern Datum domain_recv (PG_FUNCTION_ARGS);
+extern Datum pg_timezone_abbrevs (PG_FUNCTION_ARGS);
+extern Datum xmlexists (PG_FUNCTION_ARGS);
+extern Datum pg_reload_conf (PG_FUNCTION_ARGS);
+extern Datum pg_rotate_logfile (PG_FUNCTION_ARGS);
+extern Datum pg_stat_file (PG_FUNCTION_ARGS);
+extern Datum pg_read_file (PG_FUNCTION_ARGS);
+extern Datum pg_ls_dir (PG_FUNCTION_ARGS);
+extern Datum pg_sleep (PG_FUNCTION_ARGS);
+extern Datum inetnot (PG_FUNCTION_ARGS);
+extern Datum inetand (PG_FUNCTION_ARGS);
+extern Datum inetor (PG_FUNCTION_ARGS);
+extern Datum inetpl (PG_FUNCTION_ARGS);
+extern Datum inetmi_int8 (PG_FUNCTION_ARGS);
+extern Datum inetmi (PG_FUNCTION_ARGS);
+extern Datum statement_timestamp (PG_FUNCTION_ARGS);
+extern Datum clock_timestamp (PG_FUNCTION_ARGS);
+extern Datum gin_cmp_prefix (PG_FUNCTION_ARGS);
+extern Datum pg_has_role_name_name (PG_FUNCTION_ARGS);
+extern Datum pg_has_role_name_id (PG_FUNCTION_ARGS);
+extern Datum pg_has_role_id_name (PG_FUNCTION_ARGS);
+extern Datum pg_has_role_id_id (PG_FUNCTION_ARGS);
+extern Datum pg_has_role_name (PG_FUNCTION_ARGS);
+extern Datum pg_has_role_id (PG_FUNCTION_ARGS);
+extern Datum interval_justify_interval (PG_FUNCTION_ARGS);
+extern Datum pg_get_triggerdef_ext (PG_FUNCTION_ARGS);
+extern Datum gingetbitmap (PG_FUNCTION_ARGS);
+extern Datum gininsert (PG_FUNCTION_ARGS);
+extern Datum ginbeginscan (PG_FUNCTION_ARGS);
+extern Datum ginrescan (PG_FUNCTION_ARGS);
+extern Datum ginendscan (PG_FUNCTION_ARGS);
+extern Datum ginmarkpos (PG_FUNCTION_ARGS);
+extern Datum ginrestrpos (PG_FUNCTION_ARGS);
+extern Datum ginbuild (PG_FUNCTION_ARGS);
+extern Datum ginbulkdelete (PG_FUNCTION_ARGS);
+extern Datum ginvacuumcleanup (PG_FUNCTION_ARGS);
+extern Datum gincostestimate (PG_FUNCTION_ARGS);
+extern Datum ginarrayextract (PG_FUNCTION_ARGS);
+extern Datum ginarrayconsistent (PG_FUNCTION_ARGS);
+extern Datum int8_avg_accum (PG_FUNCTION_ARGS);
+extern Datum arrayoverlap (PG_FUNCTION_ARGS);
+extern Datum arraycontains (PG_FUNCTION_ARGS);
+extern Datum arraycontained (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_db_tuples_returned (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_db_tuples_fetched (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_db_tuples_inserted (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_db_tuples_updated (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_db_tuples_deleted (PG_FUNCTION_ARGS);
+extern Datum regexp_matches_no_flags (PG_FUNCTION_ARGS);
+extern Datum regexp_matches (PG_FUNCTION_ARGS);
+extern Datum regexp_split_to_table_no_flags (PG_FUNCTION_ARGS);
+extern Datum regexp_split_to_table (PG_FUNCTION_ARGS);
+extern Datum regexp_split_to_array_no_flags (PG_FUNCTION_ARGS);
+extern Datum regexp_split_to_array (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_bgwriter_timed_checkpoints (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_bgwriter_requested_checkpoints (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_bgwriter_buf_written_checkpoints (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_bgwriter_buf_written_clean (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_bgwriter_maxwritten_clean (PG_FUNCTION_ARGS);
+extern Datum ginqueryarrayextract (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_buf_written_backend (PG_FUNCTION_ARGS);
+extern Datum anynonarray_in (PG_FUNCTION_ARGS);
+extern Datum anynonarray_out (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_last_vacuum_time (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_last_autovacuum_time (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_last_analyze_time (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_last_autoanalyze_time (PG_FUNCTION_ARGS);
+extern Datum btoptions (PG_FUNCTION_ARGS);
+extern Datum hashoptions (PG_FUNCTION_ARGS);
+extern Datum gistoptions (PG_FUNCTION_ARGS);
+extern Datum ginoptions (PG_FUNCTION_ARGS);
+extern Datum tidgt (PG_FUNCTION_ARGS);
+extern Datum tidlt (PG_FUNCTION_ARGS);
+extern Datum tidge (PG_FUNCTION_ARGS);
+extern Datum tidle (PG_FUNCTION_ARGS);
+extern Datum bttidcmp (PG_FUNCTION_ARGS);
+extern Datum tidlarger (PG_FUNCTION_ARGS);
+extern Datum tidsmaller (PG_FUNCTION_ARGS);
+extern Datum int8inc_any (PG_FUNCTION_ARGS);
+extern Datum int8inc_float8_float8 (PG_FUNCTION_ARGS);
+extern Datum float8_regr_accum (PG_FUNCTION_ARGS);
+extern Datum float8_regr_sxx (PG_FUNCTION_ARGS);
+extern Datum float8_regr_syy (PG_FUNCTION_ARGS);
+extern Datum float8_regr_sxy (PG_FUNCTION_ARGS);
+extern Datum float8_regr_avgx (PG_FUNCTION_ARGS);
+extern Datum float8_regr_avgy (PG_FUNCTION_ARGS);
+extern Datum float8_regr_r2 (PG_FUNCTION_ARGS);
+extern Datum float8_regr_slope (PG_FUNCTION_ARGS);
+extern Datum float8_regr_intercept (PG_FUNCTION_ARGS);
+extern Datum float8_covar_pop (PG_FUNCTION_ARGS);
+extern Datum float8_covar_samp (PG_FUNCTION_ARGS);
+extern Datum float8_corr (PG_FUNCTION_ARGS);
+extern Datum pg_switch_xlog (PG_FUNCTION_ARGS);
+extern Datum pg_current_xlog_location (PG_FUNCTION_ARGS);
+extern Datum pg_xlogfile_name_offset (PG_FUNCTION_ARGS);
+extern Datum pg_xlogfile_name (PG_FUNCTION_ARGS);
+extern Datum pg_current_xlog_insert_location (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_backend_waiting (PG_FUNCTION_ARGS);
+extern Datum pg_my_temp_schema (PG_FUNCTION_ARGS);
+extern Datum pg_is_other_temp_schema (PG_FUNCTION_ARGS);
+extern Datum pg_timezone_names (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_backend_xact_start (PG_FUNCTION_ARGS);
+extern Datum numeric_avg_accum (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_buf_alloc (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_live_tuples (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_dead_tuples (PG_FUNCTION_ARGS);
+extern Datum pg_advisory_lock_int8 (PG_FUNCTION_ARGS);
+extern Datum pg_advisory_lock_shared_int8 (PG_FUNCTION_ARGS);
+extern Datum pg_try_advisory_lock_int8 (PG_FUNCTION_ARGS);
+extern Datum pg_try_advisory_lock_shared_int8 (PG_FUNCTION_ARGS);
+extern Datum pg_advisory_unlock_int8 (PG_FUNCTION_ARGS);
+extern Datum pg_advisory_unlock_shared_int8 (PG_FUNCTION_ARGS);
+extern Datum pg_advisory_lock_int4 (PG_FUNCTION_ARGS);
+extern Datum pg_advisory_lock_shared_int4 (PG_FUNCTION_ARGS);
+extern Datum pg_try_advisory_lock_int4 (PG_FUNCTION_ARGS);
+extern Datum pg_try_advisory_lock_shared_int4 (PG_FUNCTION_ARGS);
+extern Datum pg_advisory_unlock_int4 (PG_FUNCTION_ARGS);
+extern Datum pg_advisory_unlock_shared_int4 (PG_FUNCTION_ARGS);
+extern Datum pg_advisory_unlock_all (PG_FUNCTION_ARGS);
+extern Datum xml_in (PG_FUNCTION_ARGS);
+extern Datum xml_out (PG_FUNCTION_ARGS);
+extern Datum xmlcomment (PG_FUNCTION_ARGS);
+extern Datum texttoxml (PG_FUNCTION_ARGS);
+extern Datum xmlvalidate (PG_FUNCTION_ARGS);
+extern Datum xml_recv (PG_FUNCTION_ARGS);
+extern Datum xml_send (PG_FUNCTION_ARGS);
+extern Datum xmlconcat2 (PG_FUNCTION_ARGS);
+extern Datum varbittypmodin (PG_FUNCTION_ARGS);
+extern Datum intervaltypmodin (PG_FUNCTION_ARGS);
+extern Datum intervaltypmodout (PG_FUNCTION_ARGS);
+extern Datum timestamptypmodin (PG_FUNCTION_ARGS);
+extern Datum timestamptypmodout (PG_FUNCTION_ARGS);
+extern Datum timestamptztypmodin (PG_FUNCTION_ARGS);
+extern Datum timestamptztypmodout (PG_FUNCTION_ARGS);
+extern Datum timetypmodin (PG_FUNCTION_ARGS);
+extern Datum timetypmodout (PG_FUNCTION_ARGS);
+extern Datum timetztypmodin (PG_FUNCTION_ARGS);
+extern Datum timetztypmodout (PG_FUNCTION_ARGS);
+extern Datum bpchartypmodin (PG_FUNCTION_ARGS);
+extern Datum bpchartypmodout (PG_FUNCTION_ARGS);
+extern Datum varchartypmodin (PG_FUNCTION_ARGS);
+extern Datum varchartypmodout (PG_FUNCTION_ARGS);
+extern Datum numerictypmodin (PG_FUNCTION_ARGS);
+extern Datum numerictypmodout (PG_FUNCTION_ARGS);
+extern Datum bittypmodin (PG_FUNCTION_ARGS);
+extern Datum bittypmodout (PG_FUNCTION_ARGS);
+extern Datum varbittypmodout (PG_FUNCTION_ARGS);
+extern Datum xmltotext (PG_FUNCTION_ARGS);
+extern Datum table_to_xml (PG_FUNCTION_ARGS);
+extern Datum query_to_xml (PG_FUNCTION_ARGS);
+extern Datum cursor_to_xml (PG_FUNCTION_ARGS);
+extern Datum table_to_xmlschema (PG_FUNCTION_ARGS);
+extern Datum query_to_xmlschema (PG_FUNCTION_ARGS);
+extern Datum cursor_to_xmlschema (PG_FUNCTION_ARGS);
+extern Datum table_to_xml_and_xmlschema (PG_FUNCTION_ARGS);
+extern Datum query_to_xml_and_xmlschema (PG_FUNCTION_ARGS);
+extern Datum xpath (PG_FUNCTION_ARGS);
+extern Datum schema_to_xml (PG_FUNCTION_ARGS);
+extern Datum schema_to_xmlschema (PG_FUNCTION_ARGS);
+extern Datum schema_to_xml_and_xmlschema (PG_FUNCTION_ARGS);
+extern Datum database_to_xml (PG_FUNCTION_ARGS);
+extern Datum database_to_xmlschema (PG_FUNCTION_ARGS);
+extern Datum database_to_xml_and_xmlschema (PG_FUNCTION_ARGS);
+extern Datum txid_snapshot_in (PG_FUNCTION_ARGS);
+extern Datum txid_snapshot_out (PG_FUNCTION_ARGS);
+extern Datum txid_snapshot_recv (PG_FUNCTION_ARGS);
+extern Datum txid_snapshot_send (PG_FUNCTION_ARGS);
+extern Datum txid_current (PG_FUNCTION_ARGS);
+extern Datum txid_current_snapshot (PG_FUNCTION_ARGS);
+extern Datum txid_snapshot_xmin (PG_FUNCTION_ARGS);
+extern Datum txid_snapshot_xmax (PG_FUNCTION_ARGS);
+extern Datum txid_snapshot_xip (PG_FUNCTION_ARGS);
+extern Datum txid_visible_in_snapshot (PG_FUNCTION_ARGS);
+extern Datum uuid_in (PG_FUNCTION_ARGS);
+extern Datum uuid_out (PG_FUNCTION_ARGS);
+extern Datum uuid_lt (PG_FUNCTION_ARGS);
+extern Datum uuid_le (PG_FUNCTION_ARGS);
+extern Datum uuid_eq (PG_FUNCTION_ARGS);
+extern Datum uuid_ge (PG_FUNCTION_ARGS);
+extern Datum uuid_gt (PG_FUNCTION_ARGS);
+extern Datum uuid_ne (PG_FUNCTION_ARGS);
+extern Datum uuid_cmp (PG_FUNCTION_ARGS);
+extern Datum uuid_recv (PG_FUNCTION_ARGS);
+extern Datum uuid_send (PG_FUNCTION_ARGS);
+extern Datum uuid_hash (PG_FUNCTION_ARGS);
+extern Datum booltext (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_function_calls (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_function_time (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_function_self_time (PG_FUNCTION_ARGS);
+extern Datum record_eq (PG_FUNCTION_ARGS);
+extern Datum record_ne (PG_FUNCTION_ARGS);
+extern Datum record_lt (PG_FUNCTION_ARGS);
+extern Datum record_gt (PG_FUNCTION_ARGS);
+extern Datum record_le (PG_FUNCTION_ARGS);
+extern Datum record_ge (PG_FUNCTION_ARGS);
+extern Datum btrecordcmp (PG_FUNCTION_ARGS);
+extern Datum pg_table_size (PG_FUNCTION_ARGS);
+extern Datum pg_indexes_size (PG_FUNCTION_ARGS);
+extern Datum pg_relation_filenode (PG_FUNCTION_ARGS);
+extern Datum has_foreign_data_wrapper_privilege_name_name (PG_FUNCTION_ARGS);
+extern Datum has_foreign_data_wrapper_privilege_name_id (PG_FUNCTION_ARGS);
+extern Datum has_foreign_data_wrapper_privilege_id_name (PG_FUNCTION_ARGS);
+extern Datum has_foreign_data_wrapper_privilege_id_id (PG_FUNCTION_ARGS);
+extern Datum has_foreign_data_wrapper_privilege_name (PG_FUNCTION_ARGS);
+extern Datum has_foreign_data_wrapper_privilege_id (PG_FUNCTION_ARGS);
+extern Datum has_server_privilege_name_name (PG_FUNCTION_ARGS);
+extern Datum has_server_privilege_name_id (PG_FUNCTION_ARGS);
+extern Datum has_server_privilege_id_name (PG_FUNCTION_ARGS);
+extern Datum has_server_privilege_id_id (PG_FUNCTION_ARGS);
+extern Datum has_server_privilege_name (PG_FUNCTION_ARGS);
+extern Datum has_server_privilege_id (PG_FUNCTION_ARGS);
+extern Datum has_column_privilege_name_name_name (PG_FUNCTION_ARGS);
+extern Datum has_column_privilege_name_name_attnum (PG_FUNCTION_ARGS);
+extern Datum has_column_privilege_name_id_name (PG_FUNCTION_ARGS);
+extern Datum has_column_privilege_name_id_attnum (PG_FUNCTION_ARGS);
+extern Datum has_column_privilege_id_name_name (PG_FUNCTION_ARGS);
+extern Datum has_column_privilege_id_name_attnum (PG_FUNCTION_ARGS);
+extern Datum has_column_privilege_id_id_name (PG_FUNCTION_ARGS);
+extern Datum has_column_privilege_id_id_attnum (PG_FUNCTION_ARGS);
+extern Datum has_column_privilege_name_name (PG_FUNCTION_ARGS);
+extern Datum has_column_privilege_name_attnum (PG_FUNCTION_ARGS);
+extern Datum has_column_privilege_id_name (PG_FUNCTION_ARGS);
+extern Datum has_column_privilege_id_attnum (PG_FUNCTION_ARGS);
+extern Datum has_any_column_privilege_name_name (PG_FUNCTION_ARGS);
+extern Datum has_any_column_privilege_name_id (PG_FUNCTION_ARGS);
+extern Datum has_any_column_privilege_id_name (PG_FUNCTION_ARGS);
+extern Datum has_any_column_privilege_id_id (PG_FUNCTION_ARGS);
+extern Datum has_any_column_privilege_name (PG_FUNCTION_ARGS);
+extern Datum has_any_column_privilege_id (PG_FUNCTION_ARGS);
+extern Datum bitoverlay (PG_FUNCTION_ARGS);
+extern Datum bitoverlay_no_len (PG_FUNCTION_ARGS);
+extern Datum bitgetbit (PG_FUNCTION_ARGS);
+extern Datum bitsetbit (PG_FUNCTION_ARGS);
+extern Datum pg_relation_filepath (PG_FUNCTION_ARGS);
+extern Datum pg_listening_channels (PG_FUNCTION_ARGS);
+extern Datum pg_notify (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_xact_numscans (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_xact_tuples_returned (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_xact_tuples_fetched (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_xact_tuples_inserted (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_xact_tuples_updated (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_xact_tuples_deleted (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_xact_tuples_hot_updated (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_xact_blocks_fetched (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_xact_blocks_hit (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_xact_function_calls (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_xact_function_time (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_xact_function_self_time (PG_FUNCTION_ARGS);
+extern Datum xpath_exists (PG_FUNCTION_ARGS);
+extern Datum xml_is_well_formed (PG_FUNCTION_ARGS);
+extern Datum xml_is_well_formed_document (PG_FUNCTION_ARGS);
+extern Datum xml_is_well_formed_content (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_vacuum_count (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_autovacuum_count (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_analyze_count (PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_autoanalyze_count (PG_FUNCTION_ARGS);
+extern Datum text_concat (PG_FUNCTION_ARGS);
+extern Datum text_concat_ws (PG_FUNCTION_ARGS);
+extern Datum text_left (PG_FUNCTION_ARGS);
+extern Datum text_right (PG_FUNCTION_ARGS);
+extern Datum text_reverse (PG_FUNCTION_ARGS);
+extern Datum window_row_number (PG_FUNCTION_ARGS);
+extern Datum window_rank (PG_FUNCTION_ARGS);
+extern Datum window_dense_rank (PG_FUNCTION_ARGS);
+extern Datum window_percent_rank (PG_FUNCTION_ARGS);
+extern Datum window_cume_dist (PG_FUNCTION_ARGS);
+extern Datum window_ntile (PG_FUNCTION_ARGS);
+extern Datum window_lag (PG_FUNCTION_ARGS);
+extern Datum window_lag_with_offset (PG_FUNCTION_ARGS);
+extern Datum window_lag_with_offset_and_default (PG_FUNCTION_ARGS);
+extern Datum window_lead (PG_FUNCTION_ARGS);
+extern Datum window_lead_with_offset (PG_FUNCTION_ARGS);
+extern Datum window_lead_with_offset_and_default (PG_FUNCTION_ARGS);
+extern Datum window_first_value (PG_FUNCTION_ARGS);
+extern Datum window_last_value (PG_FUNCTION_ARGS);
+extern Datum window_nth_value (PG_FUNCTION_ARGS);
+extern Datum anyenum_in (PG_FUNCTION_ARGS);
+extern Datum anyenum_out (PG_FUNCTION_ARGS);
+extern Datum enum_in (PG_FUNCTION_ARGS);
+extern Datum enum_out (PG_FUNCTION_ARGS);
+extern Datum enum_eq (PG_FUNCTION_ARGS);
+extern Datum enum_ne (PG_FUNCTION_ARGS);
+extern Datum enum_lt (PG_FUNCTION_ARGS);
+extern Datum enum_gt (PG_FUNCTION_ARGS);
+extern Datum enum_le (PG_FUNCTION_ARGS);
+extern Datum enum_ge (PG_FUNCTION_ARGS);
+extern Datum enum_cmp (PG_FUNCTION_ARGS);
+extern Datum hashenum (PG_FUNCTION_ARGS);
+extern Datum enum_smaller (PG_FUNCTION_ARGS);
+extern Datum enum_larger (PG_FUNCTION_ARGS);
+extern Datum enum_first (PG_FUNCTION_ARGS);
+extern Datum enum_last (PG_FUNCTION_ARGS);
+extern Datum enum_range_bounds (PG_FUNCTION_ARGS);
+extern Datum enum_range_all (PG_FUNCTION_ARGS);
+extern Datum enum_recv (PG_FUNCTION_ARGS);
+extern Datum enum_send (PG_FUNCTION_ARGS);
+extern Datum string_agg_transfn (PG_FUNCTION_ARGS);
+extern Datum string_agg_finalfn (PG_FUNCTION_ARGS);
+extern Datum tsvectorin (PG_FUNCTION_ARGS);
+extern Datum tsvectorout (PG_FUNCTION_ARGS);
+extern Datum tsqueryin (PG_FUNCTION_ARGS);
+extern Datum tsqueryout (PG_FUNCTION_ARGS);
+extern Datum tsvector_lt (PG_FUNCTION_ARGS);
+extern Datum tsvector_le (PG_FUNCTION_ARGS);
+extern Datum tsvector_eq (PG_FUNCTION_ARGS);
+extern Datum tsvector_ne (PG_FUNCTION_ARGS);
+extern Datum tsvector_ge (PG_FUNCTION_ARGS);
+extern Datum tsvector_gt (PG_FUNCTION_ARGS);
+extern Datum tsvector_cmp (PG_FUNCTION_ARGS);
+extern Datum tsvector_strip (PG_FUNCTION_ARGS);
+extern Datum tsvector_setweight (PG_FUNCTION_ARGS);
+extern Datum tsvector_concat (PG_FUNCTION_ARGS);
+extern Datum ts_match_vq (PG_FUNCTION_ARGS);
+extern Datum ts_match_qv (PG_FUNCTION_ARGS);
+extern Datum tsvectorsend (PG_FUNCTION_ARGS);
+extern Datum tsvectorrecv (PG_FUNCTION_ARGS);
+extern Datum tsquerysend (PG_FUNCTION_ARGS);
+extern Datum tsqueryrecv (PG_FUNCTION_ARGS);
+extern Datum gtsvectorin (PG_FUNCTION_ARGS);
+extern Datum gtsvectorout (PG_FUNCTION_ARGS);
+extern Datum gtsvector_compress (PG_FUNCTION_ARGS);
+extern Datum gtsvector_decompress (PG_FUNCTION_ARGS);
+extern Datum gtsvector_picksplit (PG_FUNCTION_ARGS);
+extern Datum gtsvector_union (PG_FUNCTION_ARGS);
+extern Datum gtsvector_same (PG_FUNCTION_ARGS);
+extern Datum gtsvector_penalty (PG_FUNCTION_ARGS);
+extern Datum gtsvector_consistent (PG_FUNCTION_ARGS);
+extern Datum gin_extract_tsvector (PG_FUNCTION_ARGS);
+extern Datum gin_extract_tsquery (PG_FUNCTION_ARGS);
+extern Datum gin_tsquery_consistent (PG_FUNCTION_ARGS);
+extern Datum tsquery_lt (PG_FUNCTION_ARGS);
+extern Datum tsquery_le (PG_FUNCTION_ARGS);
+extern Datum tsquery_eq (PG_FUNCTION_ARGS);
+extern Datum tsquery_ne (PG_FUNCTION_ARGS);
+extern Datum tsquery_ge (PG_FUNCTION_ARGS);
+extern Datum tsquery_gt (PG_FUNCTION_ARGS);
+extern Datum tsquery_cmp (PG_FUNCTION_ARGS);
+extern Datum tsquery_and (PG_FUNCTION_ARGS);
+extern Datum tsquery_or (PG_FUNCTION_ARGS);
+extern Datum tsquery_not (PG_FUNCTION_ARGS);
+extern Datum tsquery_numnode (PG_FUNCTION_ARGS);
+extern Datum tsquerytree (PG_FUNCTION_ARGS);
+extern Datum tsquery_rewrite (PG_FUNCTION_ARGS);
+extern Datum tsquery_rewrite_query (PG_FUNCTION_ARGS);
+extern Datum tsmatchsel (PG_FUNCTION_ARGS);
+extern Datum tsmatchjoinsel (PG_FUNCTION_ARGS);
+extern Datum ts_typanalyze (PG_FUNCTION_ARGS);
+extern Datum ts_stat1 (PG_FUNCTION_ARGS);
+extern Datum ts_stat2 (PG_FUNCTION_ARGS);
+extern Datum tsq_mcontains (PG_FUNCTION_ARGS);
+extern Datum tsq_mcontained (PG_FUNCTION_ARGS);
+extern Datum gtsquery_compress (PG_FUNCTION_ARGS);
+extern Datum gtsquery_decompress (PG_FUNCTION_ARGS);
+extern Datum gtsquery_picksplit (PG_FUNCTION_ARGS);
+extern Datum gtsquery_union (PG_FUNCTION_ARGS);
+extern Datum gtsquery_same (PG_FUNCTION_ARGS);
+extern Datum gtsquery_penalty (PG_FUNCTION_ARGS);
+extern Datum gtsquery_consistent (PG_FUNCTION_ARGS);
+extern Datum ts_rank_wttf (PG_FUNCTION_ARGS);
+extern Datum ts_rank_wtt (PG_FUNCTION_ARGS);
+extern Datum ts_rank_ttf (PG_FUNCTION_ARGS);
+extern Datum ts_rank_tt (PG_FUNCTION_ARGS);
+extern Datum ts_rankcd_wttf (PG_FUNCTION_ARGS);
+extern Datum ts_rankcd_wtt (PG_FUNCTION_ARGS);
+extern Datum ts_rankcd_ttf (PG_FUNCTION_ARGS);
+extern Datum ts_rankcd_tt (PG_FUNCTION_ARGS);
+extern Datum tsvector_length (PG_FUNCTION_ARGS);
+extern Datum ts_token_type_byid (PG_FUNCTION_ARGS);
+extern Datum ts_token_type_byname (PG_FUNCTION_ARGS);
+extern Datum ts_parse_byid (PG_FUNCTION_ARGS);
+extern Datum ts_parse_byname (PG_FUNCTION_ARGS);
+extern Datum prsd_start (PG_FUNCTION_ARGS);
+extern Datum prsd_nexttoken (PG_FUNCTION_ARGS);
+extern Datum prsd_end (PG_FUNCTION_ARGS);
+extern Datum prsd_headline (PG_FUNCTION_ARGS);
+extern Datum prsd_lextype (PG_FUNCTION_ARGS);
+extern Datum ts_lexize (PG_FUNCTION_ARGS);
+extern Datum gin_cmp_tslexeme (PG_FUNCTION_ARGS);
+extern Datum dsimple_init (PG_FUNCTION_ARGS);
+extern Datum dsimple_lexize (PG_FUNCTION_ARGS);
+extern Datum dsynonym_init (PG_FUNCTION_ARGS);
+extern Datum dsynonym_lexize (PG_FUNCTION_ARGS);
+extern Datum dispell_init (PG_FUNCTION_ARGS);
+extern Datum dispell_lexize (PG_FUNCTION_ARGS);
+extern Datum regconfigin (PG_FUNCTION_ARGS);
+extern Datum regconfigout (PG_FUNCTION_ARGS);
+extern Datum regconfigrecv (PG_FUNCTION_ARGS);
+extern Datum regconfigsend (PG_FUNCTION_ARGS);
+extern Datum thesaurus_init (PG_FUNCTION_ARGS);
+extern Datum thesaurus_lexize (PG_FUNCTION_ARGS);
+extern Datum ts_headline_byid_opt (PG_FUNCTION_ARGS);
+extern Datum ts_headline_byid (PG_FUNCTION_ARGS);
+extern Datum to_tsvector_byid (PG_FUNCTION_ARGS);
+extern Datum to_tsquery_byid (PG_FUNCTION_ARGS);
+extern Datum plainto_tsquery_byid (PG_FUNCTION_ARGS);
+extern Datum to_tsvector (PG_FUNCTION_ARGS);
+extern Datum to_tsquery (PG_FUNCTION_ARGS);
+extern Datum plainto_tsquery (PG_FUNCTION_ARGS);
+extern Datum tsvector_update_trigger_byid (PG_FUNCTION_ARGS);
+extern Datum tsvector_update_trigger_bycolumn (PG_FUNCTION_ARGS);
+extern Datum ts_headline_opt (PG_FUNCTION_ARGS);
+extern Datum ts_headline (PG_FUNCTION_ARGS);
+extern Datum pg_ts_parser_is_visible (PG_FUNCTION_ARGS);
+extern Datum pg_ts_dict_is_visible (PG_FUNCTION_ARGS);
+extern Datum pg_ts_config_is_visible (PG_FUNCTION_ARGS);
+extern Datum get_current_ts_config (PG_FUNCTION_ARGS);
+extern Datum ts_match_tt (PG_FUNCTION_ARGS);
+extern Datum ts_match_tq (PG_FUNCTION_ARGS);
+extern Datum pg_ts_template_is_visible (PG_FUNCTION_ARGS);
+extern Datum regdictionaryin (PG_FUNCTION_ARGS);
+extern Datum regdictionaryout (PG_FUNCTION_ARGS);
+extern Datum regdictionaryrecv (PG_FUNCTION_ARGS);
+extern Datum regdictionarysend (PG_FUNCTION_ARGS);
+extern Datum pg_stat_reset_shared (PG_FUNCTION_ARGS);
+extern Datum pg_stat_reset_single_table_counters (PG_FUNCTION_ARGS);
+extern Datum pg_stat_reset_single_function_counters (PG_FUNCTION_ARGS);
+extern Datum pg_is_in_recovery (PG_FUNCTION_ARGS);
+extern Datum pg_last_xlog_receive_location (PG_FUNCTION_ARGS);
+extern Datum pg_last_xlog_replay_location (PG_FUNCTION_ARGS);
+extern Datum cash_div_cash (PG_FUNCTION_ARGS);
+extern Datum cash_numeric (PG_FUNCTION_ARGS);
+extern Datum numeric_cash (PG_FUNCTION_ARGS);
+
+const FmgrBuiltin fmgr_builtins[] = {
+  { 31, "byteaout", 1, true, false, byteaout },
+  { 33, "charout", 1, true, false, charout },
+  { 34, "namein", 1, true, false, namein },
+  { 35, "nameout", 1, true, false, nameout },
+  { 38, "int2in", 1, true, false, int2in },
+  { 39, "int2out", 1, true, false, int2out },
+  { 40, "int2vectorin", 1, true, false, int2vectorin },
+  { 41, "int2vectorout", 1, true, false, int2vectorout },
+  { 42, "int4in", 1, true, false, int4in },
+  { 43, "int4out", 1, true, false, int4out },
+  { 44, "regprocin", 1, true, false, regprocin },
+  { 45, "regprocout", 1, true, false, regprocout },
+  { 46, "textin", 1, true, false, textin },
+  { 47, "textout", 1, true, false, textout },
+  { 48, "tidin", 1, true, false, tidin },
+  { 49, "tidout", 1, true, false, tidout },
+  { 50, "xidin", 1, true, false, xidin },
+  { 51, "xidout", 1, true, false, xidout },
+  { 52, "cidin", 1, true, false, cidin },
+  { 53, "cidout", 1, true, false, cidout },
+  { 54, "oidvectorin", 1, true, false, oidvectorin },
+  { 55, "oidvectorout", 1, true, false, oidvectorout },
+  { 56, "boollt", 2, true, false, boollt },
+  { 57, "boolgt", 2, true, false, boolgt },
+  { 60, "booleq", 2, true, false, booleq },
+  { 61, "chareq", 2, true, false, chareq },
+  { 62, "nameeq", 2, true, false, nameeq },
+  { 63, "int2eq", 2, true, false, int2eq },
+  { 64, "int2lt", 2, true, false, int2lt },
+  { 65, "int4eq", 2, true, false, int4eq },
+  { 66, "int4lt", 2, true, false, int4lt },
+  { 67, "texteq", 2, true, false, texteq },
+  { 68, "xideq", 2, true, false, xideq },
+  { 69, "cideq", 2, true, false, cideq },
+  { 70, "charne", 2, true, false, charne },
+  { 72, "charle", 2, true, false, charle },
+  { 73, "chargt", 2, true, false, chargt },
+  { 74, "charge", 2, true, false, charge },
+  { 77, "chartoi4", 1, true, false, chartoi4 },
+  { 78, "i4tochar", 1, true, false, i4tochar },
+  { 79, "nameregexeq", 2, true, false, nameregexeq },
+  { 84, "boolne", 2, true, false, boolne },
+  { 89, "pgsql_version", 0, true, false, pgsql_version },
+  { 101, "eqsel", 4, true, false, eqsel },
+  { 102, "neqsel", 4, true, false, neqsel },
+  { 103, "scalarltsel", 4, true, false, scalarltsel },
+  { 104, "scalargtsel", 4, true, false, scalargtsel },
+  { 105, "eqjoinsel", 5, true, false, eqjoinsel },
+  { 106, "neqjoinsel", 5, true, false, neqjoinsel },
+  { 107, "scalarltjoinsel", 5, true, false, scalarltjoinsel },
+  { 108, "scalargtjoinsel", 5, true, false, scalargtjoinsel },
+  { 109, "unknownin", 1, true, false, unknownin },
+  { 110, "unknownout", 1, true, false, unknownout },
+  { 111, "numeric_fac", 1, true, false, numeric_fac },
+  { 115, "box_above_eq", 2, true, false, box_above_eq },
+  { 116, "box_below_eq", 2, true, false, box_below_eq },
+  { 117, "point_in", 1, true, false, point_in },
+  { 118, "point_out", 1, true, false, point_out },
+  { 119, "lseg_in", 1, true, false, lseg_in },
+  { 120, "lseg_out", 1, true, false, lseg_out },
+  { 121, "path_in", 1, true, false, path_in },
+  { 122, "path_out", 1, true, false, path_out },
+  { 123, "box_in", 1, true, false, box_in },
+  { 124, "box_out", 1, true, false, box_out },
+  { 125, "box_overlap", 2, true, false, box_overlap },
+  { 126, "box_ge", 2, true, false, box_ge },
+  { 127, "box_gt", 2, true, false, box_gt },
+  { 128, "box_eq", 2, true, false, box_eq },
+  { 129, "box_lt", 2, true, false, box_lt },
+  { 130, "box_le", 2, true, false, box_le },
+  { 131, "point_above", 2, true, false, point_above },
+  { 132, "point_left", 2, true, false, point_left },
+  { 133, "point_right", 2, true, false, point_right },
+  { 134, "point_below", 2, true, false, point_below },
+  { 135, "point_eq", 2, true, false, point_eq },
+  { 136, "on_pb", 2, true, false, on_pb },
+  { 137, "on_ppath", 2, true, false, on_ppath },
+  { 138, "box_center", 1, true, false, box_center },
+  { 139, "areasel", 4, true, false, areasel },
+  { 140, "areajoinsel", 5, true, false, areajoinsel },
+  { 141, "int4mul", 2, true, false, int4mul },
+  { 144, "int4ne", 2, true, false, int4ne },
+  { 145, "int2ne", 2, true, false, int2ne },
+  { 146, "int2gt", 2, true, false, int2gt },
+  { 147, "int4gt", 2, true, false, int4gt },
+  { 148, "int2le", 2, true, false, int2le },
+  { 149, "int4le", 2, true, false, int4le },
+  { 150, "int4ge", 2, true, false, int4ge },
+  { 151, "int2ge", 2, true, false, int2ge },
+  { 152, "int2mul", 2, true, false, int2mul },
+  { 153, "int2div", 2, true, false, int2div },
+  { 154, "int4div", 2, true, false, int4div },
+  { 155, "int2mod", 2, true, false, int2mod },
+  { 156, "int4mod", 2, true, false, int4mod },
+  { 157, "textne", 2, true, false, textne },
+  { 158, "int24eq", 2, true, false, int24eq },
+  { 159, "int42eq", 2, true, false, int42eq },
+  { 160, "int24lt", 2, true, false, int24lt },
+  { 161, "int42lt", 2, true, false, int42lt },
+  { 162, "int24gt", 2, true, false, int24gt },
+  { 163, "int42gt", 2, true, false, int42gt },
+  { 164, "int24ne", 2, true, false, int24ne },
+  { 165, "int42ne", 2, true, false, int42ne },
+  { 166, "int24le", 2, true, false, int24le },
+  { 167, "int42le", 2, true, false, int42le },
+  { 168, "int24ge", 2, true, false, int24ge },
+  { 169, "int42ge", 2, true, false, int42ge },
+  { 170, "int24mul", 2, true, false, int24mul },
+  { 171, "int42mul", 2, true, false, int42mul },
+  { 172, "int24div", 2, true, false, int24div },
+  { 173, "int42div", 2, true, false, int42div },
+  { 176, "int2pl", 2, true, false, int2pl },
+  { 177, "int4pl", 2, true, false, int4pl },
+  { 178, "int24pl", 2, true, false, int24pl },
+  { 179, "int42pl", 2, true, false, int42pl },
+  { 180, "int2mi", 2, true, false, int2mi },
+  { 181, "int4mi", 2, true, false, int4mi },
+  { 182, "int24mi", 2, true, false, int24mi },
+  { 183, "int42mi", 2, true, false, int42mi },
+  { 184, "oideq", 2, true, false, oideq },
+  { 185, "oidne", 2, true, false, oidne },
+  { 186, "box_same", 2, true, false, box_same },
+  { 187, "box_contain", 2, true, false, box_contain },
+  { 188, "box_left", 2, true, false, box_left },
+  { 189, "box_overleft", 2, true, false, box_overleft },
+  { 190, "box_overright", 2, true, false, box_overright },
+  { 191, "box_right", 2, true, false, box_right },
+  { 192, "box_contained", 2, true, false, box_contained },
+  { 193, "box_contain_pt", 2, true, false, box_contain_pt },
+  { 195, "pg_node_tree_in", 1, true, false, pg_node_tree_in },
+  { 196, "pg_node_tree_out", 1, true, false, pg_node_tree_out },
+  { 197, "pg_node_tree_recv", 1, true, false, pg_node_tree_recv },
+  { 198, "pg_node_tree_send", 1, true, false, pg_node_tree_send },
+  { 200, "float4in", 1, true, false, float4in },
+  { 201, "float4out", 1, true, false, float4out },
+  { 202, "float4mul", 2, true, false, float4mul },
+  { 203, "float4div", 2, true, false, float4div },
+  { 204, "float4pl", 2, true, false, float4pl },
+  { 205, "float4mi", 2, true, false, float4mi },
+  { 206, "float4um", 1, true, false, float4um },
+  { 207, "float4abs", 1, true, false, float4abs },
+  { 208, "float4_accum", 2, true, false, float4_accum },
+  { 209, "float4larger", 2, true, false, float4larger },
+  { 211, "float4smaller", 2, true, false, float4smaller },
+  { 212, "int4um", 1, true, false, int4um },
+  { 213, "int2um", 1, true, false, int2um },
+  { 214, "float8in", 1, true, false, float8in },
+  { 215, "float8out", 1, true, false, float8out },
+  { 216, "float8mul", 2, true, false, float8mul },
+  { 217, "float8div", 2, true, false, float8div },
+  { 218, "float8pl", 2, true, false, float8pl },
+  { 219, "float8mi", 2, true, false, float8mi },
+  { 220, "float8um", 1, true, false, float8um },
+  { 221, "float8abs", 1, true, false, float8abs },
+  { 222, "float8_accum", 2, true, false, float8_accum },
+  { 223, "float8larger", 2, true, false, float8larger },
+  { 224, "float8smaller", 2, true, false, float8smaller },
+  { 225, "lseg_center", 1, true, false, lseg_center },
+  { 226, "path_center", 1, true, false, path_center },
+  { 227, "poly_center", 1, true, false, poly_center },
+  { 228, "dround", 1, true, false, dround },
+  { 229, "dtrunc", 1, true, false, dtrunc },
+  { 230, "dsqrt", 1, true, false, dsqrt },
+  { 231, "dcbrt", 1, true, false, dcbrt },
+  { 232, "dpow", 2, true, false, dpow },
+  { 233, "dexp", 1, true, false, dexp },
+  { 234, "dlog1", 1, true, false, dlog1 },
+  { 235, "i2tod", 1, true, false, i2tod },
+  { 236, "i2tof", 1, true, false, i2tof },
+  { 237, "dtoi2", 1, true, false, dtoi2 },
+  { 238, "ftoi2", 1, true, false, ftoi2 },
+  { 239, "line_distance", 2, true, false, line_distance },
+  { 240, "abstimein", 1, true, false, abstimein },
+  { 241, "abstimeout", 1, true, false, abstimeout },
+  { 242, "reltimein", 1, true, false, reltimein },
+  { 243, "reltimeout", 1, true, false, reltimeout },
+  { 244, "timepl", 2, true, false, timepl },
+  { 245, "timemi", 2, true, false, timemi },
+  { 246, "tintervalin", 1, true, false, tintervalin },
+  { 247, "tintervalout", 1, true, false, tintervalout },
+  { 248, "intinterval", 2, true, false, intinterval },
+  { 249, "tintervalrel", 1, true, false, tintervalrel },
+  { 250, "timenow", 0, true, false, timenow },
+  { 251, "abstimeeq", 2, true, false, abstimeeq },
+  { 252, "abstimene", 2, true, false, abstimene },
+  { 253, "abstimelt", 2, true, false, abstimelt },
+  { 254, "abstimegt", 2, true, false, abstimegt },
+  { 255, "abstimele", 2, true, false, abstimele },
+  { 256, "abstimege", 2, true, false, abstimege },
+  { 257, "reltimeeq", 2, true, false, reltimeeq },
+  { 258, "reltimene", 2, true, false, reltimene },
+  { 259, "reltimelt", 2, true, false, reltimelt },
+  { 260, "reltimegt", 2, true, false, reltimegt },
+  { 261, "reltimele", 2, true, false, reltimele },
+  { 262, "reltimege", 2, true, false, reltimege },
+  { 263, "tintervalsame", 2, true, false, tintervalsame },
+  { 264, "tintervalct", 2, true, false, tintervalct },
+  { 265, "tintervalov", 2, true, false, tintervalov },
+  { 266, "tintervalleneq", 2, true, false, tintervalleneq },
+  { 267, "tintervallenne", 2, true, false, tintervallenne },
+  { 268, "tintervallenlt", 2, true, false, tintervallenlt },
+  { 269, "tintervallengt", 2, true, false, tintervallengt },
+  { 270, "tintervallenle", 2, true, false, tintervallenle },
+  { 271, "tintervallenge", 2, true, false, tintervallenge },
+  { 272, "tintervalstart", 1, true, false, tintervalstart },
+  { 273, "tintervalend", 1, true, false, tintervalend },
+  { 274, "timeofday", 0, true, false, timeofday },
+  { 275, "abstime_finite", 1, true, false, abstime_finite },
+  { 277, "inter_sl", 2, true, false, inter_sl },
+  { 278, "inter_lb", 2, true, false, inter_lb },
+  { 279, "float48mul", 2, true, false, float48mul },
+  { 280, "float48div", 2, true, false, float48div },
+  { 281, "float48pl", 2, true, false, float48pl },
+  { 282, "float48mi", 2, true, false, float48mi },
+  { 283, "float84mul", 2, true, false, float84mul },
+  { 284, "float84div", 2, true, false, float84div },
+  { 285, "float84pl", 2, true, false, float84pl },
+  { 286, "float84mi", 2, true, false, float84mi },
+  { 287, "float4eq", 2, true, false, float4eq },
+  { 288, "float4ne", 2, true, false, float4ne },
+  { 289, "float4lt", 2, true, false, float4lt },
+  { 290, "float4le", 2, true, false, float4le },
+  { 291, "float4gt", 2, true, false, float4gt },
+  { 292, "float4ge", 2, true, false, float4ge },
+  { 293, "float8eq", 2, true, false, float8eq },
+  { 294, "float8ne", 2, true, false, float8ne },
+  { 295, "float8lt", 2, true, false, float8lt },
+  { 296, "float8le", 2, true, false, float8le },
+  { 297, "float8gt", 2, true, false, float8gt },
+  { 298, "float8ge", 2, true, false, float8ge },
+  { 299, "float48eq", 2, true, false, float48eq },
+  { 300, "float48ne", 2, true, false, float48ne },
+  { 301, "float48lt", 2, true, false, float48lt },
+  { 302, "float48le", 2, true, false, float48le },
+  { 303, "float48gt", 2, true, false, float48gt },
+  { 304, "float48ge", 2, true, false, float48ge },
+  { 305, "float84eq", 2, true, false, float84eq },
+  { 306, "float84ne", 2, true, false, float84ne },
+  { 307, "float84lt", 2, true, false, float84lt },
+  { 308, "float84le", 2, true, false, float84le },
+  { 309, "float84gt", 2, true, false, float84gt },
+  { 310, "float84ge", 2, true, false, float84ge },
+  { 311, "ftod", 1, true, false, ftod },
+  { 312, "dtof", 1, true, false, dtof },
+  { 313, "i2toi4", 1, true, false, i2toi4 },
+  { 314, "i4toi2", 1, true, false, i4toi2 },
+  { 315, "int2vectoreq", 2, true, false, int2vectoreq },
+  { 316, "i4tod", 1, true, false, i4tod },
+  { 317, "dtoi4", 1, true, false, dtoi4 },
+  { 318, "i4tof", 1, true, false, i4tof },
+  { 319, "ftoi4", 1, true, false, ftoi4 },
+  { 320, "width_bucket_float8", 4, true, false, width_bucket_float8 },
+  { 329, "hash_aclitem", 1, true, false, hash_aclitem },
+  { 330, "btgettuple", 2, true, false, btgettuple },
+  { 331, "btinsert", 6, true, false, btinsert },
+  { 332, "btbulkdelete", 4, true, false, btbulkdelete },
+  { 333, "btbeginscan", 3, true, false, btbeginscan },
+  { 334, "btrescan", 2, true, false, btrescan },
+  { 335, "btendscan", 1, true, false, btendscan },
+  { 336, "btmarkpos", 1, true, false, btmarkpos },
+  { 337, "btrestrpos", 1, true, false, btrestrpos },
+  { 338, "btbuild", 3, true, false, btbuild },
+  { 339, "poly_same", 2, true, false, poly_same },
+  { 340, "poly_contain", 2, true, false, poly_contain },
+  { 341, "poly_left", 2, true, false, poly_left },
+  { 342, "poly_overleft", 2, true, false, poly_overleft },
+  { 343, "poly_overright", 2, true, false, poly_overright },
+  { 344, "poly_right", 2, true, false, poly_right },
+  { 345, "poly_contained", 2, true, false, poly_contained },
+  { 346, "poly_overlap", 2, true, false, poly_overlap },
+  { 347, "poly_in", 1, true, false, poly_in },
+  { 348, "poly_out", 1, true, false, poly_out },
+  { 350, "btint2cmp", 2, true, false, btint2cmp },
+  { 351, "btint4cmp", 2, true, false, btint4cmp },
+  { 354, "btfloat4cmp", 2, true, false, btfloat4cmp },
+  { 355, "btfloat8cmp", 2, true, false, btfloat8cmp },
+  { 356, "btoidcmp", 2, true, false, btoidcmp },
+  { 357, "btabstimecmp", 2, true, false, btabstimecmp },
+  { 358, "btcharcmp", 2, true, false, btcharcmp },
+  { 359, "btnamecmp", 2, true, false, btnamecmp },
+  { 360, "bttextcmp", 2, true, false, bttextcmp },
+  { 361, "lseg_distance", 2, true, false, lseg_distance },
+  { 362, "lseg_interpt", 2, true, false, lseg_interpt },
+  { 363, "dist_ps", 2, true, false, dist_ps },
+  { 364, "dist_pb", 2, true, false, dist_pb },
+  { 365, "dist_sb", 2, true, false, dist_sb },
+  { 366, "close_ps", 2, true, false, close_ps },
+  { 367, "close_pb", 2, true, false, close_pb },
+  { 368, "close_sb", 2, true, false, close_sb },
+  { 369, "on_ps", 2, true, false, on_ps },
+  { 370, "path_distance", 2, true, false, path_distance },
+  { 371, "dist_ppath", 2, true, false, dist_ppath },
+  { 372, "on_sb", 2, true, false, on_sb },
+  { 373, "inter_sb", 2, true, false, inter_sb },
+  { 376, "text_to_array_null", 3, false, false, text_to_array_null },
+  { 377, "cash_cmp", 2, true, false, cash_cmp },
+  { 378, "array_push", 2, false, false, array_push },
+  { 379, "array_push", 2, false, false, array_push },
+  { 380, "btreltimecmp", 2, true, false, btreltimecmp },
+  { 381, "bttintervalcmp", 2, true, false, bttintervalcmp },
+  { 382, "btarraycmp", 2, true, false, btarraycmp },
+  { 383, "array_cat", 2, false, false, array_cat },
+  { 384, "array_to_text_null", 3, false, false, array_to_text_null },
+  { 390, "array_ne", 2, true, false, array_ne },
+  { 391, "array_lt", 2, true, false, array_lt },
+  { 392, "array_gt", 2, true, false, array_gt },
+  { 393, "array_le", 2, true, false, array_le },
+  { 394, "text_to_array", 2, false, false, text_to_array },
+  { 395, "array_to_text", 2, true, false, array_to_text },
+  { 396, "array_ge", 2, true, false, array_ge },
+  { 398, "hashint2vector", 1, true, false, hashint2vector },
+  { 399, "hashmacaddr", 1, true, false, hashmacaddr },
+  { 400, "hashtext", 1, true, false, hashtext },
+  { 401, "rtrim1", 1, true, false, rtrim1 },
+  { 404, "btoidvectorcmp", 2, true, false, btoidvectorcmp },
+  { 406, "name_text", 1, true, false, name_text },
+  { 407, "text_name", 1, true, false, text_name },
+  { 408, "name_bpchar", 1, true, false, name_bpchar },
+  { 409, "bpchar_name", 1, true, false, bpchar_name },
+  { 422, "hashinet", 1, true, false, hashinet },
+  { 425, "hashvacuumcleanup", 2, true, false, hashvacuumcleanup },
+  { 432, "hash_numeric", 1, true, false, hash_numeric },
+  { 436, "macaddr_in", 1, true, false, macaddr_in },
+  { 437, "macaddr_out", 1, true, false, macaddr_out },
+  { 438, "hashcostestimate", 8, true, false, hashcostestimate },
+  { 440, "hashgettuple", 2, true, false, hashgettuple },
+  { 441, "hashinsert", 6, true, false, hashinsert },
+  { 442, "hashbulkdelete", 4, true, false, hashbulkdelete },
+  { 443, "hashbeginscan", 3, true, false, hashbeginscan },
+  { 444, "hashrescan", 2, true, false, hashrescan },
+  { 445, "hashendscan", 1, true, false, hashendscan },
+  { 446, "hashmarkpos", 1, true, false, hashmarkpos },
+  { 447, "hashrestrpos", 1, true, false, hashrestrpos },
+  { 448, "hashbuild", 3, true, false, hashbuild },
+  { 449, "hashint2", 1, true, false, hashint2 },
+  { 450, "hashint4", 1, true, false, hashint4 },
+  { 451, "hashfloat4", 1, true, false, hashfloat4 },
+  { 452, "hashfloat8", 1, true, false, hashfloat8 },
+  { 453, "hashoid", 1, true, false, hashoid },
+  { 454, "hashchar", 1, true, false, hashchar },
+  { 455, "hashname", 1, true, false, hashname },
+  { 456, "hashvarlena", 1, true, false, hashvarlena },
+  { 457, "hashoidvector", 1, true, false, hashoidvector },
+  { 458, "text_larger", 2, true, false, text_larger },
+  { 459, "text_smaller", 2, true, false, text_smaller },
+  { 460, "int8in", 1, true, false, int8in },
+  { 461, "int8out", 1, true, false, int8out },
+  { 462, "int8um", 1, true, false, int8um },
+  { 463, "int8pl", 2, true, false, int8pl },
+  { 464, "int8mi", 2, true, false, int8mi },
+  { 465, "int8mul", 2, true, false, int8mul },
+  { 466, "int8div", 2, true, false, int8div },
+  { 467, "int8eq", 2, true, false, int8eq },
+  { 468, "int8ne", 2, true, false, int8ne },
+  { 469, "int8lt", 2, true, false, int8lt },
+  { 470, "int8gt", 2, true, false, int8gt },
+  { 471, "int8le", 2, true, false, int8le },
+  { 472, "int8ge", 2, true, false, int8ge },
+  { 474, "int84eq", 2, true, false, int84eq },
+  { 475, "int84ne", 2, true, false, int84ne },
+  { 476, "int84lt", 2, true, false, int84lt },
+  { 477, "int84gt", 2, true, false, int84gt },
+  { 478, "int84le", 2, true, false, int84le },
+  { 479, "int84ge", 2, true, false, int84ge },
+  { 480, "int84", 1, true, false, int84 },
+  { 481, "int48", 1, true, false, int48 },
+  { 482, "i8tod", 1, true, false, i8tod },
+  { 483, "dtoi8", 1, true, false, dtoi8 },
+  { 515, "array_larger", 2, true, false, array_larger },
+  { 516, "array_smaller", 2, true, false, array_smaller },
+  { 598, "inet_abbrev", 1, true, false, inet_abbrev },
+  { 599, "cidr_abbrev", 1, true, false, cidr_abbrev },
+  { 605, "inet_set_masklen", 2, true, false, inet_set_masklen },
+  { 619, "oidvectorne", 2, true, false, oidvectorne },
+  { 635, "cidr_set_masklen", 2, true, false, cidr_set_masklen },
+  { 636, "btgetbitmap", 2, true, false, btgetbitmap },
+  { 637, "hashgetbitmap", 2, true, false, hashgetbitmap },
+  { 638, "gistgetbitmap", 2, true, false, gistgetbitmap },
+  { 652, "i8tof", 1, true, false, i8tof },
+  { 653, "ftoi8", 1, true, false, ftoi8 },
+  { 655, "namelt", 2, true, false, namelt },
+  { 656, "namele", 2, true, false, namele },
+  { 657, "namegt", 2, true, false, namegt },
+  { 658, "namege", 2, true, false, namege },
+  { 659, "namene", 2, true, false, namene },
+  { 668, "bpchar", 3, true, false, bpchar },
+  { 669, "varchar", 3, true, false, varchar },
+  { 676, "mktinterval", 2, true, false, mktinterval },
+  { 677, "oidvectorlt", 2, true, false, oidvectorlt },
+  { 678, "oidvectorle", 2, true, false, oidvectorle },
+  { 679, "oidvectoreq", 2, true, false, oidvectoreq },
+  { 680, "oidvectorge", 2, true, false, oidvectorge },
+  { 681, "oidvectorgt", 2, true, false, oidvectorgt },
+  { 683, "network_network", 1, true, false, network_network },
+  { 696, "network_netmask", 1, true, false, network_netmask },
+  { 697, "network_masklen", 1, true, false, network_masklen },
+  { 698, "network_broadcast", 1, true, false, network_broadcast },
+  { 699, "network_host", 1, true, false, network_host },
+  { 710, "current_user", 0, true, false, current_user },
+  { 711, "network_family", 1, true, false, network_family },
+  { 714, "int82", 1, true, false, int82 },
+  { 715, "lo_create", 1, true, false, lo_create },
+  { 716, "oidlt", 2, true, false, oidlt },
+  { 717, "oidle", 2, true, false, oidle },
+  { 720, "byteaoctetlen", 1, true, false, byteaoctetlen },
+  { 721, "byteaGetByte", 2, true, false, byteaGetByte },
+  { 722, "byteaSetByte", 3, true, false, byteaSetByte },
+  { 723, "byteaGetBit", 2, true, false, byteaGetBit },
+  { 724, "byteaSetBit", 3, true, false, byteaSetBit },
+  { 725, "dist_pl", 2, true, false, dist_pl },
+  { 726, "dist_lb", 2, true, false, dist_lb },
+  { 727, "dist_sl", 2, true, false, dist_sl },
+  { 728, "dist_cpoly", 2, true, false, dist_cpoly },
+  { 729, "poly_distance", 2, true, false, poly_distance },
+  { 730, "network_show", 1, true, false, network_show },
+  { 740, "text_lt", 2, true, false, text_lt },
+  { 741, "text_le", 2, true, false, text_le },
+  { 742, "text_gt", 2, true, false, text_gt },
+  { 743, "text_ge", 2, true, false, text_ge },
+  { 744, "array_eq", 2, true, false, array_eq },
+  { 745, "current_user", 0, true, false, current_user },
+  { 746, "session_user", 0, true, false, session_user },
+  { 747, "array_dims", 1, true, false, array_dims },
+  { 748, "array_ndims", 1, true, false, array_ndims },
+  { 749, "byteaoverlay", 4, true, false, byteaoverlay },
+  { 750, "array_in", 3, true, false, array_in },
+  { 751, "array_out", 1, true, false, array_out },
+  { 752, "byteaoverlay_no_len", 3, true, false, byteaoverlay_no_len },
+  { 753, "macaddr_trunc", 1, true, false, macaddr_trunc },
+  { 754, "int28", 1, true, false, int28 },
+  { 760, "smgrin", 1, true, false, smgrin },
+  { 761, "smgrout", 1, true, false, smgrout },
+  { 762, "smgreq", 2, true, false, smgreq },
+  { 763, "smgrne", 2, true, false, smgrne },
+  { 764, "lo_import", 1, true, false, lo_import },
+  { 765, "lo_export", 2, true, false, lo_export },
+  { 766, "int4inc", 1, true, false, int4inc },
+  { 767, "lo_import_with_oid", 2, true, false, lo_import_with_oid },
+  { 768, "int4larger", 2, true, false, int4larger },
+  { 769, "int4smaller", 2, true, false, int4smaller },
+  { 770, "int2larger", 2, true, false, int2larger },
+  { 771, "int2smaller", 2, true, false, int2smaller },
+  { 772, "gistcostestimate", 8, true, false, gistcostestimate },
+  { 774, "gistgettuple", 2, true, false, gistgettuple },
+  { 775, "gistinsert", 6, true, false, gistinsert },
+  { 776, "gistbulkdelete", 4, true, false, gistbulkdelete },
+  { 777, "gistbeginscan", 3, true, false, gistbeginscan },
+  { 778, "gistrescan", 2, true, false, gistrescan },
+  { 779, "gistendscan", 1, true, false, gistendscan },
+  { 780, "gistmarkpos", 1, true, false, gistmarkpos },
+  { 781, "gistrestrpos", 1, true, false, gistrestrpos },
+  { 782, "gistbuild", 3, true, false, gistbuild },
+  { 784, "tintervaleq", 2, true, false, tintervaleq },
+  { 785, "tintervalne", 2, true, false, tintervalne },
+  { 786, "tintervallt", 2, true, false, tintervallt },
+  { 787, "tintervalgt", 2, true, false, tintervalgt },
+  { 788, "tintervalle", 2, true, false, tintervalle },
+  { 789, "tintervalge", 2, true, false, tintervalge },
+  { 810, "pg_client_encoding", 0, true, false, pg_client_encoding },
+  { 817, "current_query", 0, false, false, current_query },
+  { 830, "macaddr_eq", 2, true, false, macaddr_eq },
+  { 831, "macaddr_lt", 2, true, false, macaddr_lt },
+  { 832, "macaddr_le", 2, true, false, macaddr_le },
+  { 833, "macaddr_gt", 2, true, false, macaddr_gt },
+  { 834, "macaddr_ge", 2, true, false, macaddr_ge },
+  { 835, "macaddr_ne", 2, true, false, macaddr_ne },
+  { 836, "macaddr_cmp", 2, true, false, macaddr_cmp },
+  { 837, "int82pl", 2, true, false, int82pl },
+  { 838, "int82mi", 2, true, false, int82mi },
+  { 839, "int82mul", 2, true, false, int82mul },
+  { 840, "int82div", 2, true, false, int82div },
+  { 841, "int28pl", 2, true, false, int28pl },
+  { 842, "btint8cmp", 2, true, false, btint8cmp },
+  { 846, "cash_mul_flt4", 2, true, false, cash_mul_flt4 },
+  { 847, "cash_div_flt4", 2, true, false, cash_div_flt4 },
+  { 848, "flt4_mul_cash", 2, true, false, flt4_mul_cash },
+  { 849, "textpos", 2, true, false, textpos },
+  { 850, "textlike", 2, true, false, textlike },
+  { 851, "textnlike", 2, true, false, textnlike },
+  { 852, "int48eq", 2, true, false, int48eq },
+  { 853, "int48ne", 2, true, false, int48ne },
+  { 854, "int48lt", 2, true, false, int48lt },
+  { 855, "int48gt", 2, true, false, int48gt },
+  { 856, "int48le", 2, true, false, int48le },
+  { 857, "int48ge", 2, true, false, int48ge },
+  { 858, "namelike", 2, true, false, namelike },
+  { 859, "namenlike", 2, true, false, namenlike },
+  { 860, "char_bpchar", 1, true, false, char_bpchar },
+  { 861, "current_database", 0, true, false, current_database },
+  { 862, "int4_mul_cash", 2, true, false, int4_mul_cash },
+  { 863, "int2_mul_cash", 2, true, false, int2_mul_cash },
+  { 864, "cash_mul_int4", 2, true, false, cash_mul_int4 },
+  { 865, "cash_div_int4", 2, true, false, cash_div_int4 },
+  { 866, "cash_mul_int2", 2, true, false, cash_mul_int2 },
+  { 867, "cash_div_int2", 2, true, false, cash_div_int2 },
+  { 868, "textpos", 2, true, false, textpos },
+  { 870, "lower", 1, true, false, lower },
+  { 871, "upper", 1, true, false, upper },
+  { 872, "initcap", 1, true, false, initcap },
+  { 873, "lpad", 3, true, false, lpad },
+  { 874, "rpad", 3, true, false, rpad },
+  { 875, "ltrim", 2, true, false, ltrim },
+  { 876, "rtrim", 2, true, false, rtrim },
+  { 877, "text_substr", 3, true, false, text_substr },
+  { 878, "translate", 3, true, false, translate },
+  { 881, "ltrim1", 1, true, false, ltrim1 },
+  { 882, "rtrim1", 1, true, false, rtrim1 },
+  { 883, "text_substr_no_len", 2, true, false, text_substr_no_len },
+  { 884, "btrim", 2, true, false, btrim },
+  { 885, "btrim1", 1, true, false, btrim1 },
+  { 886, "cash_in", 1, true, false, cash_in },
+  { 887, "cash_out", 1, true, false, cash_out },
+  { 888, "cash_eq", 2, true, false, cash_eq },
+  { 889, "cash_ne", 2, true, false, cash_ne },
+  { 890, "cash_lt", 2, true, false, cash_lt },
+  { 891, "cash_le", 2, true, false, cash_le },
+  { 892, "cash_gt", 2, true, false, cash_gt },
+  { 893, "cash_ge", 2, true, false, cash_ge },
+  { 894, "cash_pl", 2, true, false, cash_pl },
+  { 895, "cash_mi", 2, true, false, cash_mi },
+  { 896, "cash_mul_flt8", 2, true, false, cash_mul_flt8 },
+  { 897, "cash_div_flt8", 2, true, false, cash_div_flt8 },
+  { 898, "cashlarger", 2, true, false, cashlarger },
+  { 899, "cashsmaller", 2, true, false, cashsmaller },
+  { 910, "inet_in", 1, true, false, inet_in },
+  { 911, "inet_out", 1, true, false, inet_out },
+  { 919, "flt8_mul_cash", 2, true, false, flt8_mul_cash },
+  { 920, "network_eq", 2, true, false, network_eq },
+  { 921, "network_lt", 2, true, false, network_lt },
+  { 922, "network_le", 2, true, false, network_le },
+  { 923, "network_gt", 2, true, false, network_gt },
+  { 924, "network_ge", 2, true, false, network_ge },
+  { 925, "network_ne", 2, true, false, network_ne },
+  { 926, "network_cmp", 2, true, false, network_cmp },
+  { 927, "network_sub", 2, true, false, network_sub },
+  { 928, "network_subeq", 2, true, false, network_subeq },
+  { 929, "network_sup", 2, true, false, network_sup },
+  { 930, "network_supeq", 2, true, false, network_supeq },
+  { 935, "cash_words", 1, true, false, cash_words },
+  { 936, "text_substr", 3, true, false, text_substr },
+  { 937, "text_substr_no_len", 2, true, false, text_substr_no_len },
+  { 938, "generate_series_timestamp", 3, true, true, generate_series_timestamp },
+  { 939, "generate_series_timestamptz", 3, true, true, generate_series_timestamptz },
+  { 940, "int2mod", 2, true, false, int2mod },
+  { 941, "int4mod", 2, true, false, int4mod },
+  { 942, "int28mi", 2, true, false, int28mi },
+  { 943, "int28mul", 2, true, false, int28mul },
+  { 944, "text_char", 1, true, false, text_char },
+  { 945, "int8mod", 2, true, false, int8mod },
+  { 946, "char_text", 1, true, false, char_text },
+  { 947, "int8mod", 2, true, false, int8mod },
+  { 948, "int28div", 2, true, false, int28div },
+  { 949, "hashint8", 1, true, false, hashint8 },
+  { 952, "lo_open", 2, true, false, lo_open },
+  { 953, "lo_close", 1, true, false, lo_close },
+  { 954, "loread", 2, true, false, loread },
+  { 955, "lowrite", 2, true, false, lowrite },
+  { 956, "lo_lseek", 3, true, false, lo_lseek },
+  { 957, "lo_creat", 1, true, false, lo_creat },
+  { 958, "lo_tell", 1, true, false, lo_tell },
+  { 959, "on_pl", 2, true, false, on_pl },
+  { 960, "on_sl", 2, true, false, on_sl },
+  { 961, "close_pl", 2, true, false, close_pl },
+  { 962, "close_sl", 2, true, false, close_sl },
+  { 963, "close_lb", 2, true, false, close_lb },
+  { 964, "lo_unlink", 1, true, false, lo_unlink },
+  { 972, "btvacuumcleanup", 2, true, false, btvacuumcleanup },
+  { 973, "path_inter", 2, true, false, path_inter },
+  { 975, "box_area", 1, true, false, box_area },
+  { 976, "box_width", 1, true, false, box_width },
+  { 977, "box_height", 1, true, false, box_height },
+  { 978, "box_distance", 2, true, false, box_distance },
+  { 979, "path_area", 1, true, false, path_area },
+  { 980, "box_intersect", 2, true, false, box_intersect },
+  { 981, "box_diagonal", 1, true, false, box_diagonal },
+  { 982, "path_n_lt", 2, true, false, path_n_lt },
+  { 983, "path_n_gt", 2, true, false, path_n_gt },
+  { 984, "path_n_eq", 2, true, false, path_n_eq },
+  { 985, "path_n_le", 2, true, false, path_n_le },
+  { 986, "path_n_ge", 2, true, false, path_n_ge },
+  { 987, "path_length", 1, true, false, path_length },
+  { 988, "point_ne", 2, true, false, point_ne },
+  { 989, "point_vert", 2, true, false, point_vert },
+  { 990, "point_horiz", 2, true, false, point_horiz },
+  { 991, "point_distance", 2, true, false, point_distance },
+  { 992, "point_slope", 2, true, false, point_slope },
+  { 993, "lseg_construct", 2, true, false, lseg_construct },
+  { 994, "lseg_intersect", 2, true, false, lseg_intersect },
+  { 995, "lseg_parallel", 2, true, false, lseg_parallel },
+  { 996, "lseg_perp", 2, true, false, lseg_perp },
+  { 997, "lseg_vertical", 1, true, false, lseg_vertical },
+  { 998, "lseg_horizontal", 1, true, false, lseg_horizontal },
+  { 999, "lseg_eq", 2, true, false, lseg_eq },
+  { 1004, "lo_truncate", 2, true, false, lo_truncate },
+  { 1026, "timestamptz_izone", 2, true, false, timestamptz_izone },
+  { 1030, "gist_point_compress", 1, true, false, gist_point_compress },
+  { 1031, "aclitemin", 1, true, false, aclitemin },
+  { 1032, "aclitemout", 1, true, false, aclitemout },
+  { 1035, "aclinsert", 2, true, false, aclinsert },
+  { 1036, "aclremove", 2, true, false, aclremove },
+  { 1037, "aclcontains", 2, true, false, aclcontains },
+  { 1039, "getdatabaseencoding", 0, true, false, getdatabaseencoding },
+  { 1044, "bpcharin", 3, true, false, bpcharin },
+  { 1045, "bpcharout", 1, true, false, bpcharout },
+  { 1046, "varcharin", 3, true, false, varcharin },
+  { 1047, "varcharout", 1, true, false, varcharout },
+  { 1048, "bpchareq", 2, true, false, bpchareq },
+  { 1049, "bpcharlt", 2, true, false, bpcharlt },
+  { 1050, "bpcharle", 2, true, false, bpcharle },
+  { 1051, "bpchargt", 2, true, false, bpchargt },
+  { 1052, "bpcharge", 2, true, false, bpcharge },
+  { 1053, "bpcharne", 2, true, false, bpcharne },
+  { 1062, "aclitem_eq", 2, true, false, aclitem_eq },
+  { 1063, "bpchar_larger", 2, true, false, bpchar_larger },
+  { 1064, "bpchar_smaller", 2, true, false, bpchar_smaller },
+  { 1065, "pg_prepared_xact", 0, true, true, pg_prepared_xact },
+  { 1066, "generate_series_step_int4", 3, true, true, generate_series_step_int4 },
+  { 1067, "generate_series_int4", 2, true, true, generate_series_int4 },
+  { 1068, "generate_series_step_int8", 3, true, true, generate_series_step_int8 },
+  { 1069, "generate_series_int8", 2, true, true, generate_series_int8 },
+  { 1078, "bpcharcmp", 2, true, false, bpcharcmp },
+  { 1079, "text_regclass", 1, true, false, text_regclass },
+  { 1080, "hashbpchar", 1, true, false, hashbpchar },
+  { 1081, "format_type", 2, false, false, format_type },
+  { 1084, "date_in", 1, true, false, date_in },
+  { 1085, "date_out", 1, true, false, date_out },
+  { 1086, "date_eq", 2, true, false, date_eq },
+  { 1087, "date_lt", 2, true, false, date_lt },
+  { 1088, "date_le", 2, true, false, date_le },
+  { 1089, "date_gt", 2, true, false, date_gt },
+  { 1090, "date_ge", 2, true, false, date_ge },
+  { 1091, "date_ne", 2, true, false, date_ne },
+  { 1092, "date_cmp", 2, true, false, date_cmp },
+  { 1102, "time_lt", 2, true, false, time_lt },
+  { 1103, "time_le", 2, true, false, time_le },
+  { 1104, "time_gt", 2, true, false, time_gt },
+  { 1105, "time_ge", 2, true, false, time_ge },
+  { 1106, "time_ne", 2, true, false, time_ne },
+  { 1107, "time_cmp", 2, true, false, time_cmp },
+  { 1138, "date_larger", 2, true, false, date_larger },
+  { 1139, "date_smaller", 2, true, false, date_smaller },
+  { 1140, "date_mi", 2, true, false, date_mi },
+  { 1141, "date_pli", 2, true, false, date_pli },
+  { 1142, "date_mii", 2, true, false, date_mii },
+  { 1143, "time_in", 3, true, false, time_in },
+  { 1144, "time_out", 1, true, false, time_out },
+  { 1145, "time_eq", 2, true, false, time_eq },
+  { 1146, "circle_add_pt", 2, true, false, circle_add_pt },
+  { 1147, "circle_sub_pt", 2, true, false, circle_sub_pt },
+  { 1148, "circle_mul_pt", 2, true, false, circle_mul_pt },
+  { 1149, "circle_div_pt", 2, true, false, circle_div_pt },
+  { 1150, "timestamptz_in", 3, true, false, timestamptz_in },
+  { 1151, "timestamptz_out", 1, true, false, timestamptz_out },
+  { 1152, "timestamp_eq", 2, true, false, timestamp_eq },
+  { 1153, "timestamp_ne", 2, true, false, timestamp_ne },
+  { 1154, "timestamp_lt", 2, true, false, timestamp_lt },
+  { 1155, "timestamp_le", 2, true, false, timestamp_le },
+  { 1156, "timestamp_ge", 2, true, false, timestamp_ge },
+  { 1157, "timestamp_gt", 2, true, false, timestamp_gt },
+  { 1159, "timestamptz_zone", 2, true, false, timestamptz_zone },
+  { 1160, "interval_in", 3, true, false, interval_in },
+  { 1161, "interval_out", 1, true, false, interval_out },
+  { 1162, "interval_eq", 2, true, false, interval_eq },
+  { 1163, "interval_ne", 2, true, false, interval_ne },
+  { 1164, "interval_lt", 2, true, false, interval_lt },
+  { 1165, "interval_le", 2, true, false, interval_le },
+  { 1166, "interval_ge", 2, true, false, interval_ge },
+  { 1167, "interval_gt", 2, true, false, interval_gt },
+  { 1168, "interval_um", 1, true, false, interval_um },
+  { 1169, "interval_pl", 2, true, false, interval_pl },
+  { 1170, "interval_mi", 2, true, false, interval_mi },
+  { 1171, "timestamptz_part", 2, true, false, timestamptz_part },
+  { 1172, "interval_part", 2, true, false, interval_part },
+  { 1173, "abstime_timestamptz", 1, true, false, abstime_timestamptz },
+  { 1174, "date_timestamptz", 1, true, false, date_timestamptz },
+  { 1175, "interval_justify_hours", 1, true, false, interval_justify_hours },
+  { 1177, "reltime_interval", 1, true, false, reltime_interval },
+  { 1178, "timestamptz_date", 1, true, false, timestamptz_date },
+  { 1179, "abstime_date", 1, true, false, abstime_date },
+  { 1180, "timestamptz_abstime", 1, true, false, timestamptz_abstime },
+  { 1181, "xid_age", 1, true, false, xid_age },
+  { 1188, "timestamp_mi", 2, true, false, timestamp_mi },
+  { 1189, "timestamptz_pl_interval", 2, true, false, timestamptz_pl_interval },
+  { 1190, "timestamptz_mi_interval", 2, true, false, timestamptz_mi_interval },
+  { 1191, "generate_subscripts", 3, true, true, generate_subscripts },
+  { 1192, "generate_subscripts_nodir", 2, true, true, generate_subscripts_nodir },
+  { 1193, "array_fill", 2, false, false, array_fill },
+  { 1194, "interval_reltime", 1, true, false, interval_reltime },
+  { 1195, "timestamp_smaller", 2, true, false, timestamp_smaller },
+  { 1196, "timestamp_larger", 2, true, false, timestamp_larger },
+  { 1197, "interval_smaller", 2, true, false, interval_smaller },
+  { 1198, "interval_larger", 2, true, false, interval_larger },
+  { 1199, "timestamptz_age", 2, true, false, timestamptz_age },
+  { 1200, "interval_scale", 2, true, false, interval_scale },
+  { 1217, "timestamptz_trunc", 2, true, false, timestamptz_trunc },
+  { 1218, "interval_trunc", 2, true, false, interval_trunc },
+  { 1219, "int8inc", 1, true, false, int8inc },
+  { 1230, "int8abs", 1, true, false, int8abs },
+  { 1236, "int8larger", 2, true, false, int8larger },
+  { 1237, "int8smaller", 2, true, false, int8smaller },
+  { 1238, "texticregexeq", 2, true, false, texticregexeq },
+  { 1239, "texticregexne", 2, true, false, texticregexne },
+  { 1240, "nameicregexeq", 2, true, false, nameicregexeq },
+  { 1241, "nameicregexne", 2, true, false, nameicregexne },
+  { 1242, "boolin", 1, true, false, boolin },
+  { 1243, "boolout", 1, true, false, boolout },
+  { 1244, "byteain", 1, true, false, byteain },
+  { 1245, "charin", 1, true, false, charin },
+  { 1246, "charlt", 2, true, false, charlt },
+  { 1250, "unique_key_recheck", 0, true, false, unique_key_recheck },
+  { 1251, "int4abs", 1, true, false, int4abs },
+  { 1252, "nameregexne", 2, true, false, nameregexne },
+  { 1253, "int2abs", 1, true, false, int2abs },
+  { 1254, "textregexeq", 2, true, false, textregexeq },
+  { 1256, "textregexne", 2, true, false, textregexne },
+  { 1257, "textlen", 1, true, false, textlen },
+  { 1258, "textcat", 2, true, false, textcat },
+  { 1264, "PG_char_to_encoding", 1, true, false, PG_char_to_encoding },
+  { 1265, "tidne", 2, true, false, tidne },
+  { 1267, "cidr_in", 1, true, false, cidr_in },
+  { 1268, "btcostestimate", 8, true, false, btcostestimate },
+  { 1269, "pg_column_size", 1, true, false, pg_column_size },
+  { 1271, "overlaps_timetz", 4, false, false, overlaps_timetz },
+  { 1272, "datetime_timestamp", 2, true, false, datetime_timestamp },
+  { 1273, "timetz_part", 2, true, false, timetz_part },
+  { 1274, "int84pl", 2, true, false, int84pl },
+  { 1275, "int84mi", 2, true, false, int84mi },
+  { 1276, "int84mul", 2, true, false, int84mul },
+  { 1277, "int84div", 2, true, false, int84div },
+  { 1278, "int48pl", 2, true, false, int48pl },
+  { 1279, "int48mi", 2, true, false, int48mi },
+  { 1280, "int48mul", 2, true, false, int48mul },
+  { 1281, "int48div", 2, true, false, int48div },
+  { 1282, "quote_ident", 1, true, false, quote_ident },
+  { 1283, "quote_literal", 1, true, false, quote_literal },
+  { 1286, "array_fill_with_lower_bounds", 3, false, false, array_fill_with_lower_bounds },
+  { 1287, "i8tooid", 1, true, false, i8tooid },
+  { 1288, "oidtoi8", 1, true, false, oidtoi8 },
+  { 1289, "quote_nullable", 1, false, false, quote_nullable },
+  { 1291, "suppress_redundant_updates_trigger", 0, true, false, suppress_redundant_updates_trigger },
+  { 1292, "tideq", 2, true, false, tideq },
+  { 1293, "currtid_byreloid", 2, true, false, currtid_byreloid },
+  { 1294, "currtid_byrelname", 2, true, false, currtid_byrelname },
+  { 1295, "interval_justify_days", 1, true, false, interval_justify_days },
+  { 1297, "datetimetz_timestamptz", 2, true, false, datetimetz_timestamptz },
+  { 1299, "now", 0, true, false, now },
+  { 1300, "positionsel", 4, true, false, positionsel },
+  { 1301, "positionjoinsel", 5, true, false, positionjoinsel },
+  { 1302, "contsel", 4, true, false, contsel },
+  { 1303, "contjoinsel", 5, true, false, contjoinsel },
+  { 1304, "overlaps_timestamp", 4, false, false, overlaps_timestamp },
+  { 1308, "overlaps_time", 4, false, false, overlaps_time },
+  { 1312, "timestamp_in", 3, true, false, timestamp_in },
+  { 1313, "timestamp_out", 1, true, false, timestamp_out },
+  { 1314, "timestamp_cmp", 2, true, false, timestamp_cmp },
+  { 1315, "interval_cmp", 2, true, false, interval_cmp },
+  { 1316, "timestamp_time", 1, true, false, timestamp_time },
+  { 1317, "textlen", 1, true, false, textlen },
+  { 1318, "bpcharlen", 1, true, false, bpcharlen },
+  { 1319, "xideq", 2, true, false, xideq },
+  { 1326, "interval_div", 2, true, false, interval_div },
+  { 1339, "dlog10", 1, true, false, dlog10 },
+  { 1340, "dlog10", 1, true, false, dlog10 },
+  { 1341, "dlog1", 1, true, false, dlog1 },
+  { 1342, "dround", 1, true, false, dround },
+  { 1343, "dtrunc", 1, true, false, dtrunc },
+  { 1344, "dsqrt", 1, true, false, dsqrt },
+  { 1345, "dcbrt", 1, true, false, dcbrt },
+  { 1346, "dpow", 2, true, false, dpow },
+  { 1347, "dexp", 1, true, false, dexp },
+  { 1349, "oidvectortypes", 1, true, false, oidvectortypes },
+  { 1350, "timetz_in", 3, true, false, timetz_in },
+  { 1351, "timetz_out", 1, true, false, timetz_out },
+  { 1352, "timetz_eq", 2, true, false, timetz_eq },
+  { 1353, "timetz_ne", 2, true, false, timetz_ne },
+  { 1354, "timetz_lt", 2, true, false, timetz_lt },
+  { 1355, "timetz_le", 2, true, false, timetz_le },
+  { 1356, "timetz_ge", 2, true, false, timetz_ge },
+  { 1357, "timetz_gt", 2, true, false, timetz_gt },
+  { 1358, "timetz_cmp", 2, true, false, timetz_cmp },
+  { 1359, "datetimetz_timestamptz", 2, true, false, datetimetz_timestamptz },
+  { 1362, "network_hostmask", 1, true, false, network_hostmask },
+  { 1365, "makeaclitem", 4, true, false, makeaclitem },
+  { 1367, "bpcharlen", 1, true, false, bpcharlen },
+  { 1368, "dpow", 2, true, false, dpow },
+  { 1369, "textlen", 1, true, false, textlen },
+  { 1370, "time_interval", 1, true, false, time_interval },
+  { 1371, "pg_lock_status", 0, true, true, pg_lock_status },
+  { 1372, "bpcharlen", 1, true, false, bpcharlen },
+  { 1373, "date_finite", 1, true, false, date_finite },
+  { 1374, "textoctetlen", 1, true, false, textoctetlen },
+  { 1375, "bpcharoctetlen", 1, true, false, bpcharoctetlen },
+  { 1376, "numeric_fac", 1, true, false, numeric_fac },
+  { 1377, "time_larger", 2, true, false, time_larger },
+  { 1378, "time_smaller", 2, true, false, time_smaller },
+  { 1379, "timetz_larger", 2, true, false, timetz_larger },
+  { 1380, "timetz_smaller", 2, true, false, timetz_smaller },
+  { 1381, "textlen", 1, true, false, textlen },
+  { 1385, "time_part", 2, true, false, time_part },
+  { 1387, "pg_get_constraintdef", 1, true, false, pg_get_constraintdef },
+  { 1388, "timestamptz_timetz", 1, true, false, timestamptz_timetz },
+  { 1389, "timestamp_finite", 1, true, false, timestamp_finite },
+  { 1390, "interval_finite", 1, true, false, interval_finite },
+  { 1391, "pg_stat_get_backend_start", 1, true, false, pg_stat_get_backend_start },
+  { 1392, "pg_stat_get_backend_client_addr", 1, true, false, pg_stat_get_backend_client_addr },
+  { 1393, "pg_stat_get_backend_client_port", 1, true, false, pg_stat_get_backend_client_port },
+  { 1394, "float4abs", 1, true, false, float4abs },
+  { 1395, "float8abs", 1, true, false, float8abs },
+  { 1396, "int8abs", 1, true, false, int8abs },
+  { 1397, "int4abs", 1, true, false, int4abs },
+  { 1398, "int2abs", 1, true, false, int2abs },
+  { 1400, "text_name", 1, true, false, text_name },
+  { 1401, "name_text", 1, true, false, name_text },
+  { 1402, "current_schema", 0, true, false, current_schema },
+  { 1403, "current_schemas", 1, true, false, current_schemas },
+  { 1404, "textoverlay", 4, true, false, textoverlay },
+  { 1405, "textoverlay_no_len", 3, true, false, textoverlay_no_len },
+  { 1406, "point_vert", 2, true, false, point_vert },
+  { 1407, "point_horiz", 2, true, false, point_horiz },
+  { 1408, "lseg_parallel", 2, true, false, lseg_parallel },
+  { 1409, "lseg_perp", 2, true, false, lseg_perp },
+  { 1410, "lseg_vertical", 1, true, false, lseg_vertical },
+  { 1411, "lseg_horizontal", 1, true, false, lseg_horizontal },
+  { 1412, "line_parallel", 2, true, false, line_parallel },
+  { 1413, "line_perp", 2, true, false, line_perp },
+  { 1414, "line_vertical", 1, true, false, line_vertical },
+  { 1415, "line_horizontal", 1, true, false, line_horizontal },
+  { 1416, "circle_center", 1, true, false, circle_center },
+  { 1419, "interval_time", 1, true, false, interval_time },
+  { 1421, "points_box", 2, true, false, points_box },
+  { 1422, "box_add", 2, true, false, box_add },
+  { 1423, "box_sub", 2, true, false, box_sub },
+  { 1424, "box_mul", 2, true, false, box_mul },
+  { 1425, "box_div", 2, true, false, box_div },
+  { 1427, "cidr_out", 1, true, false, cidr_out },
+  { 1428, "poly_contain_pt", 2, true, false, poly_contain_pt },
+  { 1429, "pt_contained_poly", 2, true, false, pt_contained_poly },
+  { 1430, "path_isclosed", 1, true, false, path_isclosed },
+  { 1431, "path_isopen", 1, true, false, path_isopen },
+  { 1432, "path_npoints", 1, true, false, path_npoints },
+  { 1433, "path_close", 1, true, false, path_close },
+  { 1434, "path_open", 1, true, false, path_open },
+  { 1435, "path_add", 2, true, false, path_add },
+  { 1436, "path_add_pt", 2, true, false, path_add_pt },
+  { 1437, "path_sub_pt", 2, true, false, path_sub_pt },
+  { 1438, "path_mul_pt", 2, true, false, path_mul_pt },
+  { 1439, "path_div_pt", 2, true, false, path_div_pt },
+  { 1440, "construct_point", 2, true, false, construct_point },
+  { 1441, "point_add", 2, true, false, point_add },
+  { 1442, "point_sub", 2, true, false, point_sub },
+  { 1443, "point_mul", 2, true, false, point_mul },
+  { 1444, "point_div", 2, true, false, point_div },
+  { 1445, "poly_npoints", 1, true, false, poly_npoints },
+  { 1446, "poly_box", 1, true, false, poly_box },
+  { 1447, "poly_path", 1, true, false, poly_path },
+  { 1448, "box_poly", 1, true, false, box_poly },
+  { 1449, "path_poly", 1, true, false, path_poly },
+  { 1450, "circle_in", 1, true, false, circle_in },
+  { 1451, "circle_out", 1, true, false, circle_out },
+  { 1452, "circle_same", 2, true, false, circle_same },
+  { 1453, "circle_contain", 2, true, false, circle_contain },
+  { 1454, "circle_left", 2, true, false, circle_left },
+  { 1455, "circle_overleft", 2, true, false, circle_overleft },
+  { 1456, "circle_overright", 2, true, false, circle_overright },
+  { 1457, "circle_right", 2, true, false, circle_right },
+  { 1458, "circle_contained", 2, true, false, circle_contained },
+  { 1459, "circle_overlap", 2, true, false, circle_overlap },
+  { 1460, "circle_below", 2, true, false, circle_below },
+  { 1461, "circle_above", 2, true, false, circle_above },
+  { 1462, "circle_eq", 2, true, false, circle_eq },
+  { 1463, "circle_ne", 2, true, false, circle_ne },
+  { 1464, "circle_lt", 2, true, false, circle_lt },
+  { 1465, "circle_gt", 2, true, false, circle_gt },
+  { 1466, "circle_le", 2, true, false, circle_le },
+  { 1467, "circle_ge", 2, true, false, circle_ge },
+  { 1468, "circle_area", 1, true, false, circle_area },
+  { 1469, "circle_diameter", 1, true, false, circle_diameter },
+  { 1470, "circle_radius", 1, true, false, circle_radius },
+  { 1471, "circle_distance", 2, true, false, circle_distance },
+  { 1472, "circle_center", 1, true, false, circle_center },
+  { 1473, "cr_circle", 2, true, false, cr_circle },
+  { 1474, "poly_circle", 1, true, false, poly_circle },
+  { 1475, "circle_poly", 2, true, false, circle_poly },
+  { 1476, "dist_pc", 2, true, false, dist_pc },
+  { 1477, "circle_contain_pt", 2, true, false, circle_contain_pt },
+  { 1478, "pt_contained_circle", 2, true, false, pt_contained_circle },
+  { 1479, "box_circle", 1, true, false, box_circle },
+  { 1480, "circle_box", 1, true, false, circle_box },
+  { 1481, "mktinterval", 2, true, false, mktinterval },
+  { 1482, "lseg_ne", 2, true, false, lseg_ne },
+  { 1483, "lseg_lt", 2, true, false, lseg_lt },
+  { 1484, "lseg_le", 2, true, false, lseg_le },
+  { 1485, "lseg_gt", 2, true, false, lseg_gt },
+  { 1486, "lseg_ge", 2, true, false, lseg_ge },
+  { 1487, "lseg_length", 1, true, false, lseg_length },
+  { 1488, "close_ls", 2, true, false, close_ls },
+  { 1489, "close_lseg", 2, true, false, close_lseg },
+  { 1490, "line_in", 1, true, false, line_in },
+  { 1491, "line_out", 1, true, false, line_out },
+  { 1492, "line_eq", 2, true, false, line_eq },
+  { 1493, "line_construct_pp", 2, true, false, line_construct_pp },
+  { 1494, "line_interpt", 2, true, false, line_interpt },
+  { 1495, "line_intersect", 2, true, false, line_intersect },
+  { 1496, "line_parallel", 2, true, false, line_parallel },
+  { 1497, "line_perp", 2, true, false, line_perp },
+  { 1498, "line_vertical", 1, true, false, line_vertical },
+  { 1499, "line_horizontal", 1, true, false, line_horizontal },
+  { 1530, "lseg_length", 1, true, false, lseg_length },
+  { 1531, "path_length", 1, true, false, path_length },
+  { 1532, "lseg_center", 1, true, false, lseg_center },
+  { 1533, "path_center", 1, true, false, path_center },
+  { 1534, "box_center", 1, true, false, box_center },
+  { 1540, "poly_center", 1, true, false, poly_center },
+  { 1541, "box_diagonal", 1, true, false, box_diagonal },
+  { 1542, "box_center", 1, true, false, box_center },
+  { 1543, "circle_center", 1, true, false, circle_center },
+  { 1545, "path_npoints", 1, true, false, path_npoints },
+  { 1556, "poly_npoints", 1, true, false, poly_npoints },
+  { 1564, "bit_in", 3, true, false, bit_in },
+  { 1565, "bit_out", 1, true, false, bit_out },
+  { 1569, "textlike", 2, true, false, textlike },
+  { 1570, "textnlike", 2, true, false, textnlike },
+  { 1571, "namelike", 2, true, false, namelike },
+  { 1572, "namenlike", 2, true, false, namenlike },
+  { 1573, "pg_get_ruledef", 1, true, false, pg_get_ruledef },
+  { 1574, "nextval_oid", 1, true, false, nextval_oid },
+  { 1575, "currval_oid", 1, true, false, currval_oid },
+  { 1576, "setval_oid", 2, true, false, setval_oid },
+  { 1579, "varbit_in", 3, true, false, varbit_in },
+  { 1580, "varbit_out", 1, true, false, varbit_out },
+  { 1581, "biteq", 2, true, false, biteq },
+  { 1582, "bitne", 2, true, false, bitne },
+  { 1592, "bitge", 2, true, false, bitge },
+  { 1593, "bitgt", 2, true, false, bitgt },
+  { 1594, "bitle", 2, true, false, bitle },
+  { 1595, "bitlt", 2, true, false, bitlt },
+  { 1596, "bitcmp", 2, true, false, bitcmp },
+  { 1597, "PG_encoding_to_char", 1, true, false, PG_encoding_to_char },
+  { 1598, "drandom", 0, true, false, drandom },
+  { 1599, "setseed", 1, true, false, setseed },
+  { 1600, "dasin", 1, true, false, dasin },
+  { 1601, "dacos", 1, true, false, dacos },
+  { 1602, "datan", 1, true, false, datan },
+  { 1603, "datan2", 2, true, false, datan2 },
+  { 1604, "dsin", 1, true, false, dsin },
+  { 1605, "dcos", 1, true, false, dcos },
+  { 1606, "dtan", 1, true, false, dtan },
+  { 1607, "dcot", 1, true, false, dcot },
+  { 1608, "degrees", 1, true, false, degrees },
+  { 1609, "radians", 1, true, false, radians },
+  { 1610, "dpi", 0, true, false, dpi },
+  { 1618, "interval_mul", 2, true, false, interval_mul },
+  { 1619, "pg_typeof", 1, false, false, pg_typeof },
+  { 1620, "ascii", 1, true, false, ascii },
+  { 1621, "chr", 1, true, false, chr },
+  { 1622, "repeat", 2, true, false, repeat },
+  { 1623, "similar_escape", 2, false, false, similar_escape },
+  { 1624, "mul_d_interval", 2, true, false, mul_d_interval },
+  { 1631, "textlike", 2, true, false, textlike },
+  { 1632, "textnlike", 2, true, false, textnlike },
+  { 1633, "texticlike", 2, true, false, texticlike },
+  { 1634, "texticnlike", 2, true, false, texticnlike },
+  { 1635, "nameiclike", 2, true, false, nameiclike },
+  { 1636, "nameicnlike", 2, true, false, nameicnlike },
+  { 1637, "like_escape", 2, true, false, like_escape },
+  { 1638, "oidgt", 2, true, false, oidgt },
+  { 1639, "oidge", 2, true, false, oidge },
+  { 1640, "pg_get_viewdef_name", 1, true, false, pg_get_viewdef_name },
+  { 1641, "pg_get_viewdef", 1, true, false, pg_get_viewdef },
+  { 1642, "pg_get_userbyid", 1, true, false, pg_get_userbyid },
+  { 1643, "pg_get_indexdef", 1, true, false, pg_get_indexdef },
+  { 1644, "RI_FKey_check_ins", 0, true, false, RI_FKey_check_ins },
+  { 1645, "RI_FKey_check_upd", 0, true, false, RI_FKey_check_upd },
+  { 1646, "RI_FKey_cascade_del", 0, true, false, RI_FKey_cascade_del },
+  { 1647, "RI_FKey_cascade_upd", 0, true, false, RI_FKey_cascade_upd },
+  { 1648, "RI_FKey_restrict_del", 0, true, false, RI_FKey_restrict_del },
+  { 1649, "RI_FKey_restrict_upd", 0, true, false, RI_FKey_restrict_upd },
+  { 1650, "RI_FKey_setnull_del", 0, true, false, RI_FKey_setnull_del },
+  { 1651, "RI_FKey_setnull_upd", 0, true, false, RI_FKey_setnull_upd },
+  { 1652, "RI_FKey_setdefault_del", 0, true, false, RI_FKey_setdefault_del },
+  { 1653, "RI_FKey_setdefault_upd", 0, true, false, RI_FKey_setdefault_upd },
+  { 1654, "RI_FKey_noaction_del", 0, true, false, RI_FKey_noaction_del },
+  { 1655, "RI_FKey_noaction_upd", 0, true, false, RI_FKey_noaction_upd },
+  { 1656, "texticregexeq", 2, true, false, texticregexeq },
+  { 1657, "texticregexne", 2, true, false, texticregexne },
+  { 1658, "textregexeq", 2, true, false, textregexeq },
+  { 1659, "textregexne", 2, true, false, textregexne },
+  { 1660, "texticlike", 2, true, false, texticlike },
+  { 1661, "texticnlike", 2, true, false, texticnlike },
+  { 1662, "pg_get_triggerdef", 1, true, false, pg_get_triggerdef },
+  { 1665, "pg_get_serial_sequence", 2, true, false, pg_get_serial_sequence },
+  { 1666, "biteq", 2, true, false, biteq },
+  { 1667, "bitne", 2, true, false, bitne },
+  { 1668, "bitge", 2, true, false, bitge },
+  { 1669, "bitgt", 2, true, false, bitgt },
+  { 1670, "bitle", 2, true, false, bitle },
+  { 1671, "bitlt", 2, true, false, bitlt },
+  { 1672, "bitcmp", 2, true, false, bitcmp },
+  { 1673, "bitand", 2, true, false, bitand },
+  { 1674, "bitor", 2, true, false, bitor },
+  { 1675, "bitxor", 2, true, false, bitxor },
+  { 1676, "bitnot", 1, true, false, bitnot },
+  { 1677, "bitshiftleft", 2, true, false, bitshiftleft },
+  { 1678, "bitshiftright", 2, true, false, bitshiftright },
+  { 1679, "bitcat", 2, true, false, bitcat },
+  { 1680, "bitsubstr", 3, true, false, bitsubstr },
+  { 1681, "bitlength", 1, true, false, bitlength },
+  { 1682, "bitoctetlength", 1, true, false, bitoctetlength },
+  { 1683, "bitfromint4", 2, true, false, bitfromint4 },
+  { 1684, "bittoint4", 1, true, false, bittoint4 },
+  { 1685, "bit", 3, true, false, bit },
+  { 1686, "pg_get_keywords", 0, true, true, pg_get_keywords },
+  { 1687, "varbit", 3, true, false, varbit },
+  { 1688, "time_hash", 1, true, false, time_hash },
+  { 1689, "aclexplode", 1, true, true, aclexplode },
+  { 1690, "time_mi_time", 2, true, false, time_mi_time },
+  { 1691, "boolle", 2, true, false, boolle },
+  { 1692, "boolge", 2, true, false, boolge },
+  { 1693, "btboolcmp", 2, true, false, btboolcmp },
+  { 1696, "timetz_hash", 1, true, false, timetz_hash },
+  { 1697, "interval_hash", 1, true, false, interval_hash },
+  { 1698, "bitposition", 2, true, false, bitposition },
+  { 1699, "bitsubstr_no_len", 2, true, false, bitsubstr_no_len },
+  { 1701, "numeric_in", 3, true, false, numeric_in },
+  { 1702, "numeric_out", 1, true, false, numeric_out },
+  { 1703, "numeric", 2, true, false, numeric },
+  { 1704, "numeric_abs", 1, true, false, numeric_abs },
+  { 1705, "numeric_abs", 1, true, false, numeric_abs },
+  { 1706, "numeric_sign", 1, true, false, numeric_sign },
+  { 1707, "numeric_round", 2, true, false, numeric_round },
+  { 1709, "numeric_trunc", 2, true, false, numeric_trunc },
+  { 1711, "numeric_ceil", 1, true, false, numeric_ceil },
+  { 1712, "numeric_floor", 1, true, false, numeric_floor },
+  { 1713, "length_in_encoding", 2, true, false, length_in_encoding },
+  { 1714, "pg_convert_from", 2, true, false, pg_convert_from },
+  { 1715, "inet_to_cidr", 1, true, false, inet_to_cidr },
+  { 1716, "pg_get_expr", 2, true, false, pg_get_expr },
+  { 1717, "pg_convert_to", 2, true, false, pg_convert_to },
+  { 1718, "numeric_eq", 2, true, false, numeric_eq },
+  { 1719, "numeric_ne", 2, true, false, numeric_ne },
+  { 1720, "numeric_gt", 2, true, false, numeric_gt },
+  { 1721, "numeric_ge", 2, true, false, numeric_ge },
+  { 1722, "numeric_lt", 2, true, false, numeric_lt },
+  { 1723, "numeric_le", 2, true, false, numeric_le },
+  { 1724, "numeric_add", 2, true, false, numeric_add },
+  { 1725, "numeric_sub", 2, true, false, numeric_sub },
+  { 1726, "numeric_mul", 2, true, false, numeric_mul },
+  { 1727, "numeric_div", 2, true, false, numeric_div },
+  { 1728, "numeric_mod", 2, true, false, numeric_mod },
+  { 1729, "numeric_mod", 2, true, false, numeric_mod },
+  { 1730, "numeric_sqrt", 1, true, false, numeric_sqrt },
+  { 1731, "numeric_sqrt", 1, true, false, numeric_sqrt },
+  { 1732, "numeric_exp", 1, true, false, numeric_exp },
+  { 1733, "numeric_exp", 1, true, false, numeric_exp },
+  { 1734, "numeric_ln", 1, true, false, numeric_ln },
+  { 1735, "numeric_ln", 1, true, false, numeric_ln },
+  { 1736, "numeric_log", 2, true, false, numeric_log },
+  { 1737, "numeric_log", 2, true, false, numeric_log },
+  { 1738, "numeric_power", 2, true, false, numeric_power },
+  { 1739, "numeric_power", 2, true, false, numeric_power },
+  { 1740, "int4_numeric", 1, true, false, int4_numeric },
+  { 1742, "float4_numeric", 1, true, false, float4_numeric },
+  { 1743, "float8_numeric", 1, true, false, float8_numeric },
+  { 1744, "numeric_int4", 1, true, false, numeric_int4 },
+  { 1745, "numeric_float4", 1, true, false, numeric_float4 },
+  { 1746, "numeric_float8", 1, true, false, numeric_float8 },
+  { 1747, "time_pl_interval", 2, true, false, time_pl_interval },
+  { 1748, "time_mi_interval", 2, true, false, time_mi_interval },
+  { 1749, "timetz_pl_interval", 2, true, false, timetz_pl_interval },
+  { 1750, "timetz_mi_interval", 2, true, false, timetz_mi_interval },
+  { 1764, "numeric_inc", 1, true, false, numeric_inc },
+  { 1765, "setval3_oid", 3, true, false, setval3_oid },
+  { 1766, "numeric_smaller", 2, true, false, numeric_smaller },
+  { 1767, "numeric_larger", 2, true, false, numeric_larger },
+  { 1768, "interval_to_char", 2, true, false, interval_to_char },
+  { 1769, "numeric_cmp", 2, true, false, numeric_cmp },
+  { 1770, "timestamptz_to_char", 2, true, false, timestamptz_to_char },
+  { 1771, "numeric_uminus", 1, true, false, numeric_uminus },
+  { 1772, "numeric_to_char", 2, true, false, numeric_to_char },
+  { 1773, "int4_to_char", 2, true, false, int4_to_char },
+  { 1774, "int8_to_char", 2, true, false, int8_to_char },
+  { 1775, "float4_to_char", 2, true, false, float4_to_char },
+  { 1776, "float8_to_char", 2, true, false, float8_to_char },
+  { 1777, "numeric_to_number", 2, true, false, numeric_to_number },
+  { 1778, "to_timestamp", 2, true, false, to_timestamp },
+  { 1779, "numeric_int8", 1, true, false, numeric_int8 },
+  { 1780, "to_date", 2, true, false, to_date },
+  { 1781, "int8_numeric", 1, true, false, int8_numeric },
+  { 1782, "int2_numeric", 1, true, false, int2_numeric },
+  { 1783, "numeric_int2", 1, true, false, numeric_int2 },
+  { 1798, "oidin", 1, true, false, oidin },
+  { 1799, "oidout", 1, true, false, oidout },
+  { 1813, "pg_convert", 3, true, false, pg_convert },
+  { 1814, "iclikesel", 4, true, false, iclikesel },
+  { 1815, "icnlikesel", 4, true, false, icnlikesel },
+  { 1816, "iclikejoinsel", 5, true, false, iclikejoinsel },
+  { 1817, "icnlikejoinsel", 5, true, false, icnlikejoinsel },
+  { 1818, "regexeqsel", 4, true, false, regexeqsel },
+  { 1819, "likesel", 4, true, false, likesel },
+  { 1820, "icregexeqsel", 4, true, false, icregexeqsel },
+  { 1821, "regexnesel", 4, true, false, regexnesel },
+  { 1822, "nlikesel", 4, true, false, nlikesel },
+  { 1823, "icregexnesel", 4, true, false, icregexnesel },
+  { 1824, "regexeqjoinsel", 5, true, false, regexeqjoinsel },
+  { 1825, "likejoinsel", 5, true, false, likejoinsel },
+  { 1826, "icregexeqjoinsel", 5, true, false, icregexeqjoinsel },
+  { 1827, "regexnejoinsel", 5, true, false, regexnejoinsel },
+  { 1828, "nlikejoinsel", 5, true, false, nlikejoinsel },
+  { 1829, "icregexnejoinsel", 5, true, false, icregexnejoinsel },
+  { 1830, "float8_avg", 1, true, false, float8_avg },
+  { 1831, "float8_var_samp", 1, true, false, float8_var_samp },
+  { 1832, "float8_stddev_samp", 1, true, false, float8_stddev_samp },
+  { 1833, "numeric_accum", 2, true, false, numeric_accum },
+  { 1834, "int2_accum", 2, true, false, int2_accum },
+  { 1835, "int4_accum", 2, true, false, int4_accum },
+  { 1836, "int8_accum", 2, true, false, int8_accum },
+  { 1837, "numeric_avg", 1, true, false, numeric_avg },
+  { 1838, "numeric_var_samp", 1, true, false, numeric_var_samp },
+  { 1839, "numeric_stddev_samp", 1, true, false, numeric_stddev_samp },
+  { 1840, "int2_sum", 2, false, false, int2_sum },
+  { 1841, "int4_sum", 2, false, false, int4_sum },
+  { 1842, "int8_sum", 2, false, false, int8_sum },
+  { 1843, "interval_accum", 2, true, false, interval_accum },
+  { 1844, "interval_avg", 1, true, false, interval_avg },
+  { 1845, "to_ascii_default", 1, true, false, to_ascii_default },
+  { 1846, "to_ascii_enc", 2, true, false, to_ascii_enc },
+  { 1847, "to_ascii_encname", 2, true, false, to_ascii_encname },
+  { 1850, "int28eq", 2, true, false, int28eq },
+  { 1851, "int28ne", 2, true, false, int28ne },
+  { 1852, "int28lt", 2, true, false, int28lt },
+  { 1853, "int28gt", 2, true, false, int28gt },
+  { 1854, "int28le", 2, true, false, int28le },
+  { 1855, "int28ge", 2, true, false, int28ge },
+  { 1856, "int82eq", 2, true, false, int82eq },
+  { 1857, "int82ne", 2, true, false, int82ne },
+  { 1858, "int82lt", 2, true, false, int82lt },
+  { 1859, "int82gt", 2, true, false, int82gt },
+  { 1860, "int82le", 2, true, false, int82le },
+  { 1861, "int82ge", 2, true, false, int82ge },
+  { 1892, "int2and", 2, true, false, int2and },
+  { 1893, "int2or", 2, true, false, int2or },
+  { 1894, "int2xor", 2, true, false, int2xor },
+  { 1895, "int2not", 1, true, false, int2not },
+  { 1896, "int2shl", 2, true, false, int2shl },
+  { 1897, "int2shr", 2, true, false, int2shr },
+  { 1898, "int4and", 2, true, false, int4and },
+  { 1899, "int4or", 2, true, false, int4or },
+  { 1900, "int4xor", 2, true, false, int4xor },
+  { 1901, "int4not", 1, true, false, int4not },
+  { 1902, "int4shl", 2, true, false, int4shl },
+  { 1903, "int4shr", 2, true, false, int4shr },
+  { 1904, "int8and", 2, true, false, int8and },
+  { 1905, "int8or", 2, true, false, int8or },
+  { 1906, "int8xor", 2, true, false, int8xor },
+  { 1907, "int8not", 1, true, false, int8not },
+  { 1908, "int8shl", 2, true, false, int8shl },
+  { 1909, "int8shr", 2, true, false, int8shr },
+  { 1910, "int8up", 1, true, false, int8up },
+  { 1911, "int2up", 1, true, false, int2up },
+  { 1912, "int4up", 1, true, false, int4up },
+  { 1913, "float4up", 1, true, false, float4up },
+  { 1914, "float8up", 1, true, false, float8up },
+  { 1915, "numeric_uplus", 1, true, false, numeric_uplus },
+  { 1922, "has_table_privilege_name_name", 3, true, false, has_table_privilege_name_name },
+  { 1923, "has_table_privilege_name_id", 3, true, false, has_table_privilege_name_id },
+  { 1924, "has_table_privilege_id_name", 3, true, false, has_table_privilege_id_name },
+  { 1925, "has_table_privilege_id_id", 3, true, false, has_table_privilege_id_id },
+  { 1926, "has_table_privilege_name", 2, true, false, has_table_privilege_name },
+  { 1927, "has_table_privilege_id", 2, true, false, has_table_privilege_id },
+  { 1928, "pg_stat_get_numscans", 1, true, false, pg_stat_get_numscans },
+  { 1929, "pg_stat_get_tuples_returned", 1, true, false, pg_stat_get_tuples_returned },
+  { 1930, "pg_stat_get_tuples_fetched", 1, true, false, pg_stat_get_tuples_fetched },
+  { 1931, "pg_stat_get_tuples_inserted", 1, true, false, pg_stat_get_tuples_inserted },
+  { 1932, "pg_stat_get_tuples_updated", 1, true, false, pg_stat_get_tuples_updated },
+  { 1933, "pg_stat_get_tuples_deleted", 1, true, false, pg_stat_get_tuples_deleted },
+  { 1934, "pg_stat_get_blocks_fetched", 1, true, false, pg_stat_get_blocks_fetched },
+  { 1935, "pg_stat_get_blocks_hit", 1, true, false, pg_stat_get_blocks_hit },
+  { 1936, "pg_stat_get_backend_idset", 0, true, true, pg_stat_get_backend_idset },
+  { 1937, "pg_stat_get_backend_pid", 1, true, false, pg_stat_get_backend_pid },
+  { 1938, "pg_stat_get_backend_dbid", 1, true, false, pg_stat_get_backend_dbid },
+  { 1939, "pg_stat_get_backend_userid", 1, true, false, pg_stat_get_backend_userid },
+  { 1940, "pg_stat_get_backend_activity", 1, true, false, pg_stat_get_backend_activity },
+  { 1941, "pg_stat_get_db_numbackends", 1, true, false, pg_stat_get_db_numbackends },
+  { 1942, "pg_stat_get_db_xact_commit", 1, true, false, pg_stat_get_db_xact_commit },
+  { 1943, "pg_stat_get_db_xact_rollback", 1, true, false, pg_stat_get_db_xact_rollback },
+  { 1944, "pg_stat_get_db_blocks_fetched", 1, true, false, pg_stat_get_db_blocks_fetched },
+  { 1945, "pg_stat_get_db_blocks_hit", 1, true, false, pg_stat_get_db_blocks_hit },
+  { 1946, "binary_encode", 2, true, false, binary_encode },
+  { 1947, "binary_decode", 2, true, false, binary_decode },
+  { 1948, "byteaeq", 2, true, false, byteaeq },
+  { 1949, "bytealt", 2, true, false, bytealt },
+  { 1950, "byteale", 2, true, false, byteale },
+  { 1951, "byteagt", 2, true, false, byteagt },
+  { 1952, "byteage", 2, true, false, byteage },
+  { 1953, "byteane", 2, true, false, byteane },
+  { 1954, "byteacmp", 2, true, false, byteacmp },
+  { 1961, "timestamp_scale", 2, true, false, timestamp_scale },
+  { 1962, "int2_avg_accum", 2, true, false, int2_avg_accum },
+  { 1963, "int4_avg_accum", 2, true, false, int4_avg_accum },
+  { 1964, "int8_avg", 1, true, false, int8_avg },
+  { 1965, "oidlarger", 2, true, false, oidlarger },
+  { 1966, "oidsmaller", 2, true, false, oidsmaller },
+  { 1967, "timestamptz_scale", 2, true, false, timestamptz_scale },
+  { 1968, "time_scale", 2, true, false, time_scale },
+  { 1969, "timetz_scale", 2, true, false, timetz_scale },
+  { 1972, "pg_stat_get_tuples_hot_updated", 1, true, false, pg_stat_get_tuples_hot_updated },
+  { 1973, "numeric_div_trunc", 2, true, false, numeric_div_trunc },
+  { 1980, "numeric_div_trunc", 2, true, false, numeric_div_trunc },
+  { 2005, "bytealike", 2, true, false, bytealike },
+  { 2006, "byteanlike", 2, true, false, byteanlike },
+  { 2007, "bytealike", 2, true, false, bytealike },
+  { 2008, "byteanlike", 2, true, false, byteanlike },
+  { 2009, "like_escape_bytea", 2, true, false, like_escape_bytea },
+  { 2010, "byteaoctetlen", 1, true, false, byteaoctetlen },
+  { 2011, "byteacat", 2, true, false, byteacat },
+  { 2012, "bytea_substr", 3, true, false, bytea_substr },
+  { 2013, "bytea_substr_no_len", 2, true, false, bytea_substr_no_len },
+  { 2014, "byteapos", 2, true, false, byteapos },
+  { 2015, "byteatrim", 2, true, false, byteatrim },
+  { 2019, "timestamptz_time", 1, true, false, timestamptz_time },
+  { 2020, "timestamp_trunc", 2, true, false, timestamp_trunc },
+  { 2021, "timestamp_part", 2, true, false, timestamp_part },
+  { 2022, "pg_stat_get_activity", 1, false, true, pg_stat_get_activity },
+  { 2023, "abstime_timestamp", 1, true, false, abstime_timestamp },
+  { 2024, "date_timestamp", 1, true, false, date_timestamp },
+  { 2025, "datetime_timestamp", 2, true, false, datetime_timestamp },
+  { 2026, "pg_backend_pid", 0, true, false, pg_backend_pid },
+  { 2027, "timestamptz_timestamp", 1, true, false, timestamptz_timestamp },
+  { 2028, "timestamp_timestamptz", 1, true, false, timestamp_timestamptz },
+  { 2029, "timestamp_date", 1, true, false, timestamp_date },
+  { 2030, "timestamp_abstime", 1, true, false, timestamp_abstime },
+  { 2031, "timestamp_mi", 2, true, false, timestamp_mi },
+  { 2032, "timestamp_pl_interval", 2, true, false, timestamp_pl_interval },
+  { 2033, "timestamp_mi_interval", 2, true, false, timestamp_mi_interval },
+  { 2034, "pg_conf_load_time", 0, true, false, pg_conf_load_time },
+  { 2035, "timestamp_smaller", 2, true, false, timestamp_smaller },
+  { 2036, "timestamp_larger", 2, true, false, timestamp_larger },
+  { 2037, "timetz_zone", 2, true, false, timetz_zone },
+  { 2038, "timetz_izone", 2, true, false, timetz_izone },
+  { 2039, "timestamp_hash", 1, true, false, timestamp_hash },
+  { 2041, "overlaps_timestamp", 4, false, false, overlaps_timestamp },
+  { 2045, "timestamp_cmp", 2, true, false, timestamp_cmp },
+  { 2046, "timetz_time", 1, true, false, timetz_time },
+  { 2047, "time_timetz", 1, true, false, time_timetz },
+  { 2048, "timestamp_finite", 1, true, false, timestamp_finite },
+  { 2049, "timestamp_to_char", 2, true, false, timestamp_to_char },
+  { 2050, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2051, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2052, "timestamp_eq", 2, true, false, timestamp_eq },
+  { 2053, "timestamp_ne", 2, true, false, timestamp_ne },
+  { 2054, "timestamp_lt", 2, true, false, timestamp_lt },
+  { 2055, "timestamp_le", 2, true, false, timestamp_le },
+  { 2056, "timestamp_ge", 2, true, false, timestamp_ge },
+  { 2057, "timestamp_gt", 2, true, false, timestamp_gt },
+  { 2058, "timestamp_age", 2, true, false, timestamp_age },
+  { 2069, "timestamp_zone", 2, true, false, timestamp_zone },
+  { 2070, "timestamp_izone", 2, true, false, timestamp_izone },
+  { 2071, "date_pl_interval", 2, true, false, date_pl_interval },
+  { 2072, "date_mi_interval", 2, true, false, date_mi_interval },
+  { 2073, "textregexsubstr", 2, true, false, textregexsubstr },
+  { 2075, "bitfromint8", 2, true, false, bitfromint8 },
+  { 2076, "bittoint8", 1, true, false, bittoint8 },
+  { 2077, "show_config_by_name", 1, true, false, show_config_by_name },
+  { 2078, "set_config_by_name", 3, false, false, set_config_by_name },
+  { 2079, "pg_table_is_visible", 1, true, false, pg_table_is_visible },
+  { 2080, "pg_type_is_visible", 1, true, false, pg_type_is_visible },
+  { 2081, "pg_function_is_visible", 1, true, false, pg_function_is_visible },
+  { 2082, "pg_operator_is_visible", 1, true, false, pg_operator_is_visible },
+  { 2083, "pg_opclass_is_visible", 1, true, false, pg_opclass_is_visible },
+  { 2084, "show_all_settings", 0, true, true, show_all_settings },
+  { 2085, "bytea_substr", 3, true, false, bytea_substr },
+  { 2086, "bytea_substr_no_len", 2, true, false, bytea_substr_no_len },
+  { 2087, "replace_text", 3, true, false, replace_text },
+  { 2088, "split_text", 3, true, false, split_text },
+  { 2089, "to_hex32", 1, true, false, to_hex32 },
+  { 2090, "to_hex64", 1, true, false, to_hex64 },
+  { 2091, "array_lower", 2, true, false, array_lower },
+  { 2092, "array_upper", 2, true, false, array_upper },
+  { 2093, "pg_conversion_is_visible", 1, true, false, pg_conversion_is_visible },
+  { 2094, "pg_stat_get_backend_activity_start", 1, true, false, pg_stat_get_backend_activity_start },
+  { 2096, "pg_terminate_backend", 1, true, false, pg_terminate_backend },
+  { 2098, "pg_get_functiondef", 1, true, false, pg_get_functiondef },
+  { 2100, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2101, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2102, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2103, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2104, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2105, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2106, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2107, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2108, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2109, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2110, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2111, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2112, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2113, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2114, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2115, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2116, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2117, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2118, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2119, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2120, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2121, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2122, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2123, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2124, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2125, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2126, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2127, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2128, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2129, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2130, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2131, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2132, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2133, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2134, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2135, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2136, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2137, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2138, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2139, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2140, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2141, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2142, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2143, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2144, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2145, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2146, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2147, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2148, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2149, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2150, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2151, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2152, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2153, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2154, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2155, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2156, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2157, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2158, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2159, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2160, "text_pattern_lt", 2, true, false, text_pattern_lt },
+  { 2161, "text_pattern_le", 2, true, false, text_pattern_le },
+  { 2162, "pg_get_function_arguments", 1, true, false, pg_get_function_arguments },
+  { 2163, "text_pattern_ge", 2, true, false, text_pattern_ge },
+  { 2164, "text_pattern_gt", 2, true, false, text_pattern_gt },
+  { 2165, "pg_get_function_result", 1, true, false, pg_get_function_result },
+  { 2166, "bttext_pattern_cmp", 2, true, false, bttext_pattern_cmp },
+  { 2167, "numeric_ceil", 1, true, false, numeric_ceil },
+  { 2168, "pg_database_size_name", 1, true, false, pg_database_size_name },
+  { 2169, "numeric_power", 2, true, false, numeric_power },
+  { 2170, "width_bucket_numeric", 4, true, false, width_bucket_numeric },
+  { 2171, "pg_cancel_backend", 1, true, false, pg_cancel_backend },
+  { 2172, "pg_start_backup", 2, true, false, pg_start_backup },
+  { 2173, "pg_stop_backup", 0, true, false, pg_stop_backup },
+  { 2174, "bpchar_pattern_lt", 2, true, false, bpchar_pattern_lt },
+  { 2175, "bpchar_pattern_le", 2, true, false, bpchar_pattern_le },
+  { 2176, "array_length", 2, true, false, array_length },
+  { 2177, "bpchar_pattern_ge", 2, true, false, bpchar_pattern_ge },
+  { 2178, "bpchar_pattern_gt", 2, true, false, bpchar_pattern_gt },
+  { 2179, "gist_point_consistent", 5, true, false, gist_point_consistent },
+  { 2180, "btbpchar_pattern_cmp", 2, true, false, btbpchar_pattern_cmp },
+  { 2181, "has_sequence_privilege_name_name", 3, true, false, has_sequence_privilege_name_name },
+  { 2182, "has_sequence_privilege_name_id", 3, true, false, has_sequence_privilege_name_id },
+  { 2183, "has_sequence_privilege_id_name", 3, true, false, has_sequence_privilege_id_name },
+  { 2184, "has_sequence_privilege_id_id", 3, true, false, has_sequence_privilege_id_id },
+  { 2185, "has_sequence_privilege_name", 2, true, false, has_sequence_privilege_name },
+  { 2186, "has_sequence_privilege_id", 2, true, false, has_sequence_privilege_id },
+  { 2188, "btint48cmp", 2, true, false, btint48cmp },
+  { 2189, "btint84cmp", 2, true, false, btint84cmp },
+  { 2190, "btint24cmp", 2, true, false, btint24cmp },
+  { 2191, "btint42cmp", 2, true, false, btint42cmp },
+  { 2192, "btint28cmp", 2, true, false, btint28cmp },
+  { 2193, "btint82cmp", 2, true, false, btint82cmp },
+  { 2194, "btfloat48cmp", 2, true, false, btfloat48cmp },
+  { 2195, "btfloat84cmp", 2, true, false, btfloat84cmp },
+  { 2196, "inet_client_addr", 0, false, false, inet_client_addr },
+  { 2197, "inet_client_port", 0, false, false, inet_client_port },
+  { 2198, "inet_server_addr", 0, false, false, inet_server_addr },
+  { 2199, "inet_server_port", 0, false, false, inet_server_port },
+  { 2212, "regprocedurein", 1, true, false, regprocedurein },
+  { 2213, "regprocedureout", 1, true, false, regprocedureout },
+  { 2214, "regoperin", 1, true, false, regoperin },
+  { 2215, "regoperout", 1, true, false, regoperout },
+  { 2216, "regoperatorin", 1, true, false, regoperatorin },
+  { 2217, "regoperatorout", 1, true, false, regoperatorout },
+  { 2218, "regclassin", 1, true, false, regclassin },
+  { 2219, "regclassout", 1, true, false, regclassout },
+  { 2220, "regtypein", 1, true, false, regtypein },
+  { 2221, "regtypeout", 1, true, false, regtypeout },
+  { 2230, "pg_stat_clear_snapshot", 0, false, false, pg_stat_clear_snapshot },
+  { 2232, "pg_get_function_identity_arguments", 1, true, false, pg_get_function_identity_arguments },
+  { 2236, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2237, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2238, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2239, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2240, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2241, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2242, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2243, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2244, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2245, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2246, "fmgr_internal_validator", 1, true, false, fmgr_internal_validator },
+  { 2247, "fmgr_c_validator", 1, true, false, fmgr_c_validator },
+  { 2248, "fmgr_sql_validator", 1, true, false, fmgr_sql_validator },
+  { 2250, "has_database_privilege_name_name", 3, true, false, has_database_privilege_name_name },
+  { 2251, "has_database_privilege_name_id", 3, true, false, has_database_privilege_name_id },
+  { 2252, "has_database_privilege_id_name", 3, true, false, has_database_privilege_id_name },
+  { 2253, "has_database_privilege_id_id", 3, true, false, has_database_privilege_id_id },
+  { 2254, "has_database_privilege_name", 2, true, false, has_database_privilege_name },
+  { 2255, "has_database_privilege_id", 2, true, false, has_database_privilege_id },
+  { 2256, "has_function_privilege_name_name", 3, true, false, has_function_privilege_name_name },
+  { 2257, "has_function_privilege_name_id", 3, true, false, has_function_privilege_name_id },
+  { 2258, "has_function_privilege_id_name", 3, true, false, has_function_privilege_id_name },
+  { 2259, "has_function_privilege_id_id", 3, true, false, has_function_privilege_id_id },
+  { 2260, "has_function_privilege_name", 2, true, false, has_function_privilege_name },
+  { 2261, "has_function_privilege_id", 2, true, false, has_function_privilege_id },
+  { 2262, "has_language_privilege_name_name", 3, true, false, has_language_privilege_name_name },
+  { 2263, "has_language_privilege_name_id", 3, true, false, has_language_privilege_name_id },
+  { 2264, "has_language_privilege_id_name", 3, true, false, has_language_privilege_id_name },
+  { 2265, "has_language_privilege_id_id", 3, true, false, has_language_privilege_id_id },
+  { 2266, "has_language_privilege_name", 2, true, false, has_language_privilege_name },
+  { 2267, "has_language_privilege_id", 2, true, false, has_language_privilege_id },
+  { 2268, "has_schema_privilege_name_name", 3, true, false, has_schema_privilege_name_name },
+  { 2269, "has_schema_privilege_name_id", 3, true, false, has_schema_privilege_name_id },
+  { 2270, "has_schema_privilege_id_name", 3, true, false, has_schema_privilege_id_name },
+  { 2271, "has_schema_privilege_id_id", 3, true, false, has_schema_privilege_id_id },
+  { 2272, "has_schema_privilege_name", 2, true, false, has_schema_privilege_name },
+  { 2273, "has_schema_privilege_id", 2, true, false, has_schema_privilege_id },
+  { 2274, "pg_stat_reset", 0, false, false, pg_stat_reset },
+  { 2284, "textregexreplace_noopt", 3, true, false, textregexreplace_noopt },
+  { 2285, "textregexreplace", 4, true, false, textregexreplace },
+  { 2286, "pg_total_relation_size", 1, true, false, pg_total_relation_size },
+  { 2288, "pg_size_pretty", 1, true, false, pg_size_pretty },
+  { 2289, "pg_options_to_table", 1, true, true, pg_options_to_table },
+  { 2290, "record_in", 3, true, false, record_in },
+  { 2291, "record_out", 1, true, false, record_out },
+  { 2292, "cstring_in", 1, true, false, cstring_in },
+  { 2293, "cstring_out", 1, true, false, cstring_out },
+  { 2294, "any_in", 1, true, false, any_in },
+  { 2295, "any_out", 1, true, false, any_out },
+  { 2296, "anyarray_in", 1, true, false, anyarray_in },
+  { 2297, "anyarray_out", 1, true, false, anyarray_out },
+  { 2298, "void_in", 1, true, false, void_in },
+  { 2299, "void_out", 1, true, false, void_out },
+  { 2300, "trigger_in", 1, false, false, trigger_in },
+  { 2301, "trigger_out", 1, true, false, trigger_out },
+  { 2302, "language_handler_in", 1, false, false, language_handler_in },
+  { 2303, "language_handler_out", 1, true, false, language_handler_out },
+  { 2304, "internal_in", 1, false, false, internal_in },
+  { 2305, "internal_out", 1, true, false, internal_out },
+  { 2306, "opaque_in", 1, false, false, opaque_in },
+  { 2307, "opaque_out", 1, true, false, opaque_out },
+  { 2308, "dceil", 1, true, false, dceil },
+  { 2309, "dfloor", 1, true, false, dfloor },
+  { 2310, "dsign", 1, true, false, dsign },
+  { 2311, "md5_text", 1, true, false, md5_text },
+  { 2312, "anyelement_in", 1, true, false, anyelement_in },
+  { 2313, "anyelement_out", 1, true, false, anyelement_out },
+  { 2316, "postgresql_fdw_validator", 2, true, false, postgresql_fdw_validator },
+  { 2319, "pg_encoding_max_length_sql", 1, true, false, pg_encoding_max_length_sql },
+  { 2320, "dceil", 1, true, false, dceil },
+  { 2321, "md5_bytea", 1, true, false, md5_bytea },
+  { 2322, "pg_tablespace_size_oid", 1, true, false, pg_tablespace_size_oid },
+  { 2323, "pg_tablespace_size_name", 1, true, false, pg_tablespace_size_name },
+  { 2324, "pg_database_size_oid", 1, true, false, pg_database_size_oid },
+  { 2331, "array_unnest", 1, true, true, array_unnest },
+  { 2332, "pg_relation_size", 2, true, false, pg_relation_size },
+  { 2333, "array_agg_transfn", 2, false, false, array_agg_transfn },
+  { 2334, "array_agg_finalfn", 1, false, false, array_agg_finalfn },
+  { 2335, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2338, "date_lt_timestamp", 2, true, false, date_lt_timestamp },
+  { 2339, "date_le_timestamp", 2, true, false, date_le_timestamp },
+  { 2340, "date_eq_timestamp", 2, true, false, date_eq_timestamp },
+  { 2341, "date_gt_timestamp", 2, true, false, date_gt_timestamp },
+  { 2342, "date_ge_timestamp", 2, true, false, date_ge_timestamp },
+  { 2343, "date_ne_timestamp", 2, true, false, date_ne_timestamp },
+  { 2344, "date_cmp_timestamp", 2, true, false, date_cmp_timestamp },
+  { 2351, "date_lt_timestamptz", 2, true, false, date_lt_timestamptz },
+  { 2352, "date_le_timestamptz", 2, true, false, date_le_timestamptz },
+  { 2353, "date_eq_timestamptz", 2, true, false, date_eq_timestamptz },
+  { 2354, "date_gt_timestamptz", 2, true, false, date_gt_timestamptz },
+  { 2355, "date_ge_timestamptz", 2, true, false, date_ge_timestamptz },
+  { 2356, "date_ne_timestamptz", 2, true, false, date_ne_timestamptz },
+  { 2357, "date_cmp_timestamptz", 2, true, false, date_cmp_timestamptz },
+  { 2364, "timestamp_lt_date", 2, true, false, timestamp_lt_date },
+  { 2365, "timestamp_le_date", 2, true, false, timestamp_le_date },
+  { 2366, "timestamp_eq_date", 2, true, false, timestamp_eq_date },
+  { 2367, "timestamp_gt_date", 2, true, false, timestamp_gt_date },
+  { 2368, "timestamp_ge_date", 2, true, false, timestamp_ge_date },
+  { 2369, "timestamp_ne_date", 2, true, false, timestamp_ne_date },
+  { 2370, "timestamp_cmp_date", 2, true, false, timestamp_cmp_date },
+  { 2377, "timestamptz_lt_date", 2, true, false, timestamptz_lt_date },
+  { 2378, "timestamptz_le_date", 2, true, false, timestamptz_le_date },
+  { 2379, "timestamptz_eq_date", 2, true, false, timestamptz_eq_date },
+  { 2380, "timestamptz_gt_date", 2, true, false, timestamptz_gt_date },
+  { 2381, "timestamptz_ge_date", 2, true, false, timestamptz_ge_date },
+  { 2382, "timestamptz_ne_date", 2, true, false, timestamptz_ne_date },
+  { 2383, "timestamptz_cmp_date", 2, true, false, timestamptz_cmp_date },
+  { 2390, "has_tablespace_privilege_name_name", 3, true, false, has_tablespace_privilege_name_name },
+  { 2391, "has_tablespace_privilege_name_id", 3, true, false, has_tablespace_privilege_name_id },
+  { 2392, "has_tablespace_privilege_id_name", 3, true, false, has_tablespace_privilege_id_name },
+  { 2393, "has_tablespace_privilege_id_id", 3, true, false, has_tablespace_privilege_id_id },
+  { 2394, "has_tablespace_privilege_name", 2, true, false, has_tablespace_privilege_name },
+  { 2395, "has_tablespace_privilege_id", 2, true, false, has_tablespace_privilege_id },
+  { 2398, "shell_in", 1, false, false, shell_in },
+  { 2399, "shell_out", 1, true, false, shell_out },
+  { 2400, "array_recv", 3, true, false, array_recv },
+  { 2401, "array_send", 1, true, false, array_send },
+  { 2402, "record_recv", 3, true, false, record_recv },
+  { 2403, "record_send", 1, true, false, record_send },
+  { 2404, "int2recv", 1, true, false, int2recv },
+  { 2405, "int2send", 1, true, false, int2send },
+  { 2406, "int4recv", 1, true, false, int4recv },
+  { 2407, "int4send", 1, true, false, int4send },
+  { 2408, "int8recv", 1, true, false, int8recv },
+  { 2409, "int8send", 1, true, false, int8send },
+  { 2410, "int2vectorrecv", 1, true, false, int2vectorrecv },
+  { 2411, "int2vectorsend", 1, true, false, int2vectorsend },
+  { 2412, "bytearecv", 1, true, false, bytearecv },
+  { 2413, "byteasend", 1, true, false, byteasend },
+  { 2414, "textrecv", 1, true, false, textrecv },
+  { 2415, "textsend", 1, true, false, textsend },
+  { 2416, "unknownrecv", 1, true, false, unknownrecv },
+  { 2417, "unknownsend", 1, true, false, unknownsend },
+  { 2418, "oidrecv", 1, true, false, oidrecv },
+  { 2419, "oidsend", 1, true, false, oidsend },
+  { 2420, "oidvectorrecv", 1, true, false, oidvectorrecv },
+  { 2421, "oidvectorsend", 1, true, false, oidvectorsend },
+  { 2422, "namerecv", 1, true, false, namerecv },
+  { 2423, "namesend", 1, true, false, namesend },
+  { 2424, "float4recv", 1, true, false, float4recv },
+  { 2425, "float4send", 1, true, false, float4send },
+  { 2426, "float8recv", 1, true, false, float8recv },
+  { 2427, "float8send", 1, true, false, float8send },
+  { 2428, "point_recv", 1, true, false, point_recv },
+  { 2429, "point_send", 1, true, false, point_send },
+  { 2430, "bpcharrecv", 3, true, false, bpcharrecv },
+  { 2431, "bpcharsend", 1, true, false, bpcharsend },
+  { 2432, "varcharrecv", 3, true, false, varcharrecv },
+  { 2433, "varcharsend", 1, true, false, varcharsend },
+  { 2434, "charrecv", 1, true, false, charrecv },
+  { 2435, "charsend", 1, true, false, charsend },
+  { 2436, "boolrecv", 1, true, false, boolrecv },
+  { 2437, "boolsend", 1, true, false, boolsend },
+  { 2438, "tidrecv", 1, true, false, tidrecv },
+  { 2439, "tidsend", 1, true, false, tidsend },
+  { 2440, "xidrecv", 1, true, false, xidrecv },
+  { 2441, "xidsend", 1, true, false, xidsend },
+  { 2442, "cidrecv", 1, true, false, cidrecv },
+  { 2443, "cidsend", 1, true, false, cidsend },
+  { 2444, "regprocrecv", 1, true, false, regprocrecv },
+  { 2445, "regprocsend", 1, true, false, regprocsend },
+  { 2446, "regprocedurerecv", 1, true, false, regprocedurerecv },
+  { 2447, "regproceduresend", 1, true, false, regproceduresend },
+  { 2448, "regoperrecv", 1, true, false, regoperrecv },
+  { 2449, "regopersend", 1, true, false, regopersend },
+  { 2450, "regoperatorrecv", 1, true, false, regoperatorrecv },
+  { 2451, "regoperatorsend", 1, true, false, regoperatorsend },
+  { 2452, "regclassrecv", 1, true, false, regclassrecv },
+  { 2453, "regclasssend", 1, true, false, regclasssend },
+  { 2454, "regtyperecv", 1, true, false, regtyperecv },
+  { 2455, "regtypesend", 1, true, false, regtypesend },
+  { 2456, "bit_recv", 3, true, false, bit_recv },
+  { 2457, "bit_send", 1, true, false, bit_send },
+  { 2458, "varbit_recv", 3, true, false, varbit_recv },
+  { 2459, "varbit_send", 1, true, false, varbit_send },
+  { 2460, "numeric_recv", 3, true, false, numeric_recv },
+  { 2461, "numeric_send", 1, true, false, numeric_send },
+  { 2462, "abstimerecv", 1, true, false, abstimerecv },
+  { 2463, "abstimesend", 1, true, false, abstimesend },
+  { 2464, "reltimerecv", 1, true, false, reltimerecv },
+  { 2465, "reltimesend", 1, true, false, reltimesend },
+  { 2466, "tintervalrecv", 1, true, false, tintervalrecv },
+  { 2467, "tintervalsend", 1, true, false, tintervalsend },
+  { 2468, "date_recv", 1, true, false, date_recv },
+  { 2469, "date_send", 1, true, false, date_send },
+  { 2470, "time_recv", 3, true, false, time_recv },
+  { 2471, "time_send", 1, true, false, time_send },
+  { 2472, "timetz_recv", 3, true, false, timetz_recv },
+  { 2473, "timetz_send", 1, true, false, timetz_send },
+  { 2474, "timestamp_recv", 3, true, false, timestamp_recv },
+  { 2475, "timestamp_send", 1, true, false, timestamp_send },
+  { 2476, "timestamptz_recv", 3, true, false, timestamptz_recv },
+  { 2477, "timestamptz_send", 1, true, false, timestamptz_send },
+  { 2478, "interval_recv", 3, true, false, interval_recv },
+  { 2479, "interval_send", 1, true, false, interval_send },
+  { 2480, "lseg_recv", 1, true, false, lseg_recv },
+  { 2481, "lseg_send", 1, true, false, lseg_send },
+  { 2482, "path_recv", 1, true, false, path_recv },
+  { 2483, "path_send", 1, true, false, path_send },
+  { 2484, "box_recv", 1, true, false, box_recv },
+  { 2485, "box_send", 1, true, false, box_send },
+  { 2486, "poly_recv", 1, true, false, poly_recv },
+  { 2487, "poly_send", 1, true, false, poly_send },
+  { 2488, "line_recv", 1, true, false, line_recv },
+  { 2489, "line_send", 1, true, false, line_send },
+  { 2490, "circle_recv", 1, true, false, circle_recv },
+  { 2491, "circle_send", 1, true, false, circle_send },
+  { 2492, "cash_recv", 1, true, false, cash_recv },
+  { 2493, "cash_send", 1, true, false, cash_send },
+  { 2494, "macaddr_recv", 1, true, false, macaddr_recv },
+  { 2495, "macaddr_send", 1, true, false, macaddr_send },
+  { 2496, "inet_recv", 1, true, false, inet_recv },
+  { 2497, "inet_send", 1, true, false, inet_send },
+  { 2498, "cidr_recv", 1, true, false, cidr_recv },
+  { 2499, "cidr_send", 1, true, false, cidr_send },
+  { 2500, "cstring_recv", 1, true, false, cstring_recv },
+  { 2501, "cstring_send", 1, true, false, cstring_send },
+  { 2502, "anyarray_recv", 1, true, false, anyarray_recv },
+  { 2503, "anyarray_send", 1, true, false, anyarray_send },
+  { 2504, "pg_get_ruledef_ext", 2, true, false, pg_get_ruledef_ext },
+  { 2505, "pg_get_viewdef_name_ext", 2, true, false, pg_get_viewdef_name_ext },
+  { 2506, "pg_get_viewdef_ext", 2, true, false, pg_get_viewdef_ext },
+  { 2507, "pg_get_indexdef_ext", 3, true, false, pg_get_indexdef_ext },
+  { 2508, "pg_get_constraintdef_ext", 2, true, false, pg_get_constraintdef_ext },
+  { 2509, "pg_get_expr_ext", 3, true, false, pg_get_expr_ext },
+  { 2510, "pg_prepared_statement", 0, true, true, pg_prepared_statement },
+  { 2511, "pg_cursor", 0, true, true, pg_cursor },
+  { 2512, "float8_var_pop", 1, true, false, float8_var_pop },
+  { 2513, "float8_stddev_pop", 1, true, false, float8_stddev_pop },
+  { 2514, "numeric_var_pop", 1, true, false, numeric_var_pop },
+  { 2515, "booland_statefunc", 2, true, false, booland_statefunc },
+  { 2516, "boolor_statefunc", 2, true, false, boolor_statefunc },
+  { 2517, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2518, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2519, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2520, "timestamp_lt_timestamptz", 2, true, false, timestamp_lt_timestamptz },
+  { 2521, "timestamp_le_timestamptz", 2, true, false, timestamp_le_timestamptz },
+  { 2522, "timestamp_eq_timestamptz", 2, true, false, timestamp_eq_timestamptz },
+  { 2523, "timestamp_gt_timestamptz", 2, true, false, timestamp_gt_timestamptz },
+  { 2524, "timestamp_ge_timestamptz", 2, true, false, timestamp_ge_timestamptz },
+  { 2525, "timestamp_ne_timestamptz", 2, true, false, timestamp_ne_timestamptz },
+  { 2526, "timestamp_cmp_timestamptz", 2, true, false, timestamp_cmp_timestamptz },
+  { 2527, "timestamptz_lt_timestamp", 2, true, false, timestamptz_lt_timestamp },
+  { 2528, "timestamptz_le_timestamp", 2, true, false, timestamptz_le_timestamp },
+  { 2529, "timestamptz_eq_timestamp", 2, true, false, timestamptz_eq_timestamp },
+  { 2530, "timestamptz_gt_timestamp", 2, true, false, timestamptz_gt_timestamp },
+  { 2531, "timestamptz_ge_timestamp", 2, true, false, timestamptz_ge_timestamp },
+  { 2532, "timestamptz_ne_timestamp", 2, true, false, timestamptz_ne_timestamp },
+  { 2533, "timestamptz_cmp_timestamp", 2, true, false, timestamptz_cmp_timestamp },
+  { 2556, "pg_tablespace_databases", 1, true, true, pg_tablespace_databases },
+  { 2557, "int4_bool", 1, true, false, int4_bool },
+  { 2558, "bool_int4", 1, true, false, bool_int4 },
+  { 2559, "lastval", 0, true, false, lastval },
+  { 2560, "pg_postmaster_start_time", 0, true, false, pg_postmaster_start_time },
+  { 2561, "gistvacuumcleanup", 2, true, false, gistvacuumcleanup },
+  { 2562, "box_below", 2, true, false, box_below },
+  { 2563, "box_overbelow", 2, true, false, box_overbelow },
+  { 2564, "box_overabove", 2, true, false, box_overabove },
+  { 2565, "box_above", 2, true, false, box_above },
+  { 2566, "poly_below", 2, true, false, poly_below },
+  { 2567, "poly_overbelow", 2, true, false, poly_overbelow },
+  { 2568, "poly_overabove", 2, true, false, poly_overabove },
+  { 2569, "poly_above", 2, true, false, poly_above },
+  { 2578, "gist_box_consistent", 5, true, false, gist_box_consistent },
+  { 2579, "gist_box_compress", 1, true, false, gist_box_compress },
+  { 2580, "gist_box_decompress", 1, true, false, gist_box_decompress },
+  { 2581, "gist_box_penalty", 3, true, false, gist_box_penalty },
+  { 2582, "gist_box_picksplit", 2, true, false, gist_box_picksplit },
+  { 2583, "gist_box_union", 2, true, false, gist_box_union },
+  { 2584, "gist_box_same", 3, true, false, gist_box_same },
+  { 2585, "gist_poly_consistent", 5, true, false, gist_poly_consistent },
+  { 2586, "gist_poly_compress", 1, true, false, gist_poly_compress },
+  { 2587, "circle_overbelow", 2, true, false, circle_overbelow },
+  { 2588, "circle_overabove", 2, true, false, circle_overabove },
+  { 2591, "gist_circle_consistent", 5, true, false, gist_circle_consistent },
+  { 2592, "gist_circle_compress", 1, true, false, gist_circle_compress },
+  { 2596, "numeric_stddev_pop", 1, true, false, numeric_stddev_pop },
+  { 2597, "domain_in", 3, false, false, domain_in },
+  { 2598, "domain_recv", 3, false, false, domain_recv },
+  { 2599, "pg_timezone_abbrevs", 0, true, true, pg_timezone_abbrevs },
+  { 2614, "xmlexists", 2, true, false, xmlexists },
+  { 2621, "pg_reload_conf", 0, true, false, pg_reload_conf },
+  { 2622, "pg_rotate_logfile", 0, true, false, pg_rotate_logfile },
+  { 2623, "pg_stat_file", 1, true, false, pg_stat_file },
+  { 2624, "pg_read_file", 3, true, false, pg_read_file },
+  { 2625, "pg_ls_dir", 1, true, true, pg_ls_dir },
+  { 2626, "pg_sleep", 1, true, false, pg_sleep },
+  { 2627, "inetnot", 1, true, false, inetnot },
+  { 2628, "inetand", 2, true, false, inetand },
+  { 2629, "inetor", 2, true, false, inetor },
+  { 2630, "inetpl", 2, true, false, inetpl },
+  { 2632, "inetmi_int8", 2, true, false, inetmi_int8 },
+  { 2633, "inetmi", 2, true, false, inetmi },
+  { 2641, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2642, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2643, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2644, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2645, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2646, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2647, "now", 0, true, false, now },
+  { 2648, "statement_timestamp", 0, true, false, statement_timestamp },
+  { 2649, "clock_timestamp", 0, true, false, clock_timestamp },
+  { 2700, "gin_cmp_prefix", 4, true, false, gin_cmp_prefix },
+  { 2705, "pg_has_role_name_name", 3, true, false, pg_has_role_name_name },
+  { 2706, "pg_has_role_name_id", 3, true, false, pg_has_role_name_id },
+  { 2707, "pg_has_role_id_name", 3, true, false, pg_has_role_id_name },
+  { 2708, "pg_has_role_id_id", 3, true, false, pg_has_role_id_id },
+  { 2709, "pg_has_role_name", 2, true, false, pg_has_role_name },
+  { 2710, "pg_has_role_id", 2, true, false, pg_has_role_id },
+  { 2711, "interval_justify_interval", 1, true, false, interval_justify_interval },
+  { 2712, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2713, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2714, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2715, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2716, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2717, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2718, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2719, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2720, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2721, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2722, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2723, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2724, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2725, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2726, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2727, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2728, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2729, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2730, "pg_get_triggerdef_ext", 2, true, false, pg_get_triggerdef_ext },
+  { 2731, "gingetbitmap", 2, true, false, gingetbitmap },
+  { 2732, "gininsert", 6, true, false, gininsert },
+  { 2733, "ginbeginscan", 3, true, false, ginbeginscan },
+  { 2734, "ginrescan", 2, true, false, ginrescan },
+  { 2735, "ginendscan", 1, true, false, ginendscan },
+  { 2736, "ginmarkpos", 1, true, false, ginmarkpos },
+  { 2737, "ginrestrpos", 1, true, false, ginrestrpos },
+  { 2738, "ginbuild", 3, true, false, ginbuild },
+  { 2739, "ginbulkdelete", 4, true, false, ginbulkdelete },
+  { 2740, "ginvacuumcleanup", 2, true, false, ginvacuumcleanup },
+  { 2741, "gincostestimate", 8, true, false, gincostestimate },
+  { 2743, "ginarrayextract", 2, true, false, ginarrayextract },
+  { 2744, "ginarrayconsistent", 6, true, false, ginarrayconsistent },
+  { 2746, "int8_avg_accum", 2, true, false, int8_avg_accum },
+  { 2747, "arrayoverlap", 2, true, false, arrayoverlap },
+  { 2748, "arraycontains", 2, true, false, arraycontains },
+  { 2749, "arraycontained", 2, true, false, arraycontained },
+  { 2758, "pg_stat_get_db_tuples_returned", 1, true, false, pg_stat_get_db_tuples_returned },
+  { 2759, "pg_stat_get_db_tuples_fetched", 1, true, false, pg_stat_get_db_tuples_fetched },
+  { 2760, "pg_stat_get_db_tuples_inserted", 1, true, false, pg_stat_get_db_tuples_inserted },
+  { 2761, "pg_stat_get_db_tuples_updated", 1, true, false, pg_stat_get_db_tuples_updated },
+  { 2762, "pg_stat_get_db_tuples_deleted", 1, true, false, pg_stat_get_db_tuples_deleted },
+  { 2763, "regexp_matches_no_flags", 2, true, true, regexp_matches_no_flags },
+  { 2764, "regexp_matches", 3, true, true, regexp_matches },
+  { 2765, "regexp_split_to_table_no_flags", 2, true, true, regexp_split_to_table_no_flags },
+  { 2766, "regexp_split_to_table", 3, true, true, regexp_split_to_table },
+  { 2767, "regexp_split_to_array_no_flags", 2, true, false, regexp_split_to_array_no_flags },
+  { 2768, "regexp_split_to_array", 3, true, false, regexp_split_to_array },
+  { 2769, "pg_stat_get_bgwriter_timed_checkpoints", 0, true, false, pg_stat_get_bgwriter_timed_checkpoints },
+  { 2770, "pg_stat_get_bgwriter_requested_checkpoints", 0, true, false, pg_stat_get_bgwriter_requested_checkpoints },
+  { 2771, "pg_stat_get_bgwriter_buf_written_checkpoints", 0, true, false, pg_stat_get_bgwriter_buf_written_checkpoints },
+  { 2772, "pg_stat_get_bgwriter_buf_written_clean", 0, true, false, pg_stat_get_bgwriter_buf_written_clean },
+  { 2773, "pg_stat_get_bgwriter_maxwritten_clean", 0, true, false, pg_stat_get_bgwriter_maxwritten_clean },
+  { 2774, "ginqueryarrayextract", 5, true, false, ginqueryarrayextract },
+  { 2775, "pg_stat_get_buf_written_backend", 0, true, false, pg_stat_get_buf_written_backend },
+  { 2777, "anynonarray_in", 1, true, false, anynonarray_in },
+  { 2778, "anynonarray_out", 1, true, false, anynonarray_out },
+  { 2781, "pg_stat_get_last_vacuum_time", 1, true, false, pg_stat_get_last_vacuum_time },
+  { 2782, "pg_stat_get_last_autovacuum_time", 1, true, false, pg_stat_get_last_autovacuum_time },
+  { 2783, "pg_stat_get_last_analyze_time", 1, true, false, pg_stat_get_last_analyze_time },
+  { 2784, "pg_stat_get_last_autoanalyze_time", 1, true, false, pg_stat_get_last_autoanalyze_time },
+  { 2785, "btoptions", 2, true, false, btoptions },
+  { 2786, "hashoptions", 2, true, false, hashoptions },
+  { 2787, "gistoptions", 2, true, false, gistoptions },
+  { 2788, "ginoptions", 2, true, false, ginoptions },
+  { 2790, "tidgt", 2, true, false, tidgt },
+  { 2791, "tidlt", 2, true, false, tidlt },
+  { 2792, "tidge", 2, true, false, tidge },
+  { 2793, "tidle", 2, true, false, tidle },
+  { 2794, "bttidcmp", 2, true, false, bttidcmp },
+  { 2795, "tidlarger", 2, true, false, tidlarger },
+  { 2796, "tidsmaller", 2, true, false, tidsmaller },
+  { 2797, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2798, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2803, "aggregate_dummy", 0, false, false, aggregate_dummy },
+  { 2804, "int8inc_any", 2, true, false, int8inc_any },
+  { 2805, "int8inc_float8_float8", 3, true, false, int8inc_float8_float8 },
+  { 2806, "float8_regr_accum", 3, true, false, float8_regr_accum },
+  { 2807, "float8_regr_sxx", 1, true, false, float8_regr_sxx },
+  { 2808, "float8_regr_syy", 1, true, false, float8_regr_syy },
+  { 2809, "float8_regr_sxy", 1, true, false, float8_regr_sxy },
+  { 2810, "float8_regr_avgx", 1, true, false, float8_regr_avgx },
+  { 2811, "float8_regr_avgy", 1, true, false, float8_regr_avgy },
+  { 2812, "float8_regr_r2", 1, true, false, float8_regr_r2 },
+  { 2813, "float8_regr_slope", 1, true, false, float8_regr_slope },
+  { 2814, "float8_regr_intercept", 1, true, false, float8_regr_intercept },
+  { 2815, "float8_covar_pop", 1, true, false, float8_covar_pop },
+  { 2816, "float8_covar_samp", 1, true, false, float8_covar_samp },
+  { 2817, "float8_corr", 1, true, false, float8_corr },
+  { 2818, "aggregate_dummy", 2, false, false, aggregate_dummy },
+  { 2819, "aggregate_dummy", 2, false, false, aggregate_dummy },
+  { 2820, "aggregate_dummy", 2, false, false, aggregate_dummy },
+  { 2821, "aggregate_dummy", 2, false, false, aggregate_dummy },
+  { 2822, "aggregate_dummy", 2, false, false, aggregate_dummy },
+  { 2823, "aggregate_dummy", 2, false, false, aggregate_dummy },
+  { 2824, "aggregate_dummy", 2, false, false, aggregate_dummy },
+  { 2825, "aggregate_dummy", 2, false, false, aggregate_dummy },
+  { 2826, "aggregate_dummy", 2, false, false, aggregate_dummy },
+  { 2827, "aggregate_dummy", 2, false, false, aggregate_dummy },
+  { 2828, "aggregate_dummy", 2, false, false, aggregate_dummy },
+  { 2829, "aggregate_dummy", 2, false, false, aggregate_dummy },
+  { 2848, "pg_switch_xlog", 0, true, false, pg_switch_xlog },
+  { 2849, "pg_current_xlog_location", 0, true, false, pg_current_xlog_location },
+  { 2850, "pg_xlogfile_name_offset", 1, true, false, pg_xlogfile_name_offset },
+  { 2851, "pg_xlogfile_name", 1, true, false, pg_xlogfile_name },
+  { 2852, "pg_current_xlog_insert_location", 0, true, false, pg_current_xlog_insert_location },
+  { 2853, "pg_stat_get_backend_waiting", 1, true, false, pg_stat_get_backend_waiting },
+  { 2854, "pg_my_temp_schema", 0, true, false, pg_my_temp_schema },
+  { 2855, "pg_is_other_temp_schema", 1, true, false, pg_is_other_temp_schema },
+  { 2856, "pg_timezone_names", 0, true, true, pg_timezone_names },
+  { 2857, "pg_stat_get_backend_xact_start", 1, true, false, pg_stat_get_backend_xact_start },
+  { 2858, "numeric_avg_accum", 2, true, false, numeric_avg_accum },
+  { 2859, "pg_stat_get_buf_alloc", 0, true, false, pg_stat_get_buf_alloc },
+  { 2878, "pg_stat_get_live_tuples", 1, true, false, pg_stat_get_live_tuples },
+  { 2879, "pg_stat_get_dead_tuples", 1, true, false, pg_stat_get_dead_tuples },
+  { 2880, "pg_advisory_lock_int8", 1, true, false, pg_advisory_lock_int8 },
+  { 2881, "pg_advisory_lock_shared_int8", 1, true, false, pg_advisory_lock_shared_int8 },
+  { 2882, "pg_try_advisory_lock_int8", 1, true, false, pg_try_advisory_lock_int8 },
+  { 2883, "pg_try_advisory_lock_shared_int8", 1, true, false, pg_try_advisory_lock_shared_int8 },
+  { 2884, "pg_advisory_unlock_int8", 1, true, false, pg_advisory_unlock_int8 },
+  { 2885, "pg_advisory_unlock_shared_int8", 1, true, false, pg_advisory_unlock_shared_int8 },
+  { 2886, "pg_advisory_lock_int4", 2, true, false, pg_advisory_lock_int4 },
+  { 2887, "pg_advisory_lock_shared_int4", 2, true, false, pg_advisory_lock_shared_int4 },
+  { 2888, "pg_try_advisory_lock_int4", 2, true, false, pg_try_advisory_lock_int4 },
+  { 2889, "pg_try_advisory_lock_shared_int4", 2, true, false, pg_try_advisory_lock_shared_int4 },
+  { 2890, "pg_advisory_unlock_int4", 2, true, false, pg_advisory_unlock_int4 },
+  { 2891, "pg_advisory_unlock_shared_int4", 2, true, false, pg_advisory_unlock_shared_int4 },
+  { 2892, "pg_advisory_unlock_all", 0, true, false, pg_advisory_unlock_all },
+  { 2893, "xml_in", 1, true, false, xml_in },
+  { 2894, "xml_out", 1, true, false, xml_out },
+  { 2895, "xmlcomment", 1, true, false, xmlcomment },
+  { 2896, "texttoxml", 1, true, false, texttoxml },
+  { 2897, "xmlvalidate", 2, true, false, xmlvalidate },
+  { 2898, "xml_recv", 1, true, false, xml_recv },
+  { 2899, "xml_send", 1, true, false, xml_send },
+  { 2900, "xmlconcat2", 2, false, false, xmlconcat2 },
+  { 2901, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 2902, "varbittypmodin", 1, true, false, varbittypmodin },
+  { 2903, "intervaltypmodin", 1, true, false, intervaltypmodin },
+  { 2904, "intervaltypmodout", 1, true, false, intervaltypmodout },
+  { 2905, "timestamptypmodin", 1, true, false, timestamptypmodin },
+  { 2906, "timestamptypmodout", 1, true, false, timestamptypmodout },
+  { 2907, "timestamptztypmodin", 1, true, false, timestamptztypmodin },
+  { 2908, "timestamptztypmodout", 1, true, false, timestamptztypmodout },
+  { 2909, "timetypmodin", 1, true, false, timetypmodin },
+  { 2910, "timetypmodout", 1, true, false, timetypmodout },
+  { 2911, "timetztypmodin", 1, true, false, timetztypmodin },
+  { 2912, "timetztypmodout", 1, true, false, timetztypmodout },
+  { 2913, "bpchartypmodin", 1, true, false, bpchartypmodin },
+  { 2914, "bpchartypmodout", 1, true, false, bpchartypmodout },
+  { 2915, "varchartypmodin", 1, true, false, varchartypmodin },
+  { 2916, "varchartypmodout", 1, true, false, varchartypmodout },
+  { 2917, "numerictypmodin", 1, true, false, numerictypmodin },
+  { 2918, "numerictypmodout", 1, true, false, numerictypmodout },
+  { 2919, "bittypmodin", 1, true, false, bittypmodin },
+  { 2920, "bittypmodout", 1, true, false, bittypmodout },
+  { 2921, "varbittypmodout", 1, true, false, varbittypmodout },
+  { 2922, "xmltotext", 1, true, false, xmltotext },
+  { 2923, "table_to_xml", 4, true, false, table_to_xml },
+  { 2924, "query_to_xml", 4, true, false, query_to_xml },
+  { 2925, "cursor_to_xml", 5, true, false, cursor_to_xml },
+  { 2926, "table_to_xmlschema", 4, true, false, table_to_xmlschema },
+  { 2927, "query_to_xmlschema", 4, true, false, query_to_xmlschema },
+  { 2928, "cursor_to_xmlschema", 4, true, false, cursor_to_xmlschema },
+  { 2929, "table_to_xml_and_xmlschema", 4, true, false, table_to_xml_and_xmlschema },
+  { 2930, "query_to_xml_and_xmlschema", 4, true, false, query_to_xml_and_xmlschema },
+  { 2931, "xpath", 3, true, false, xpath },
+  { 2933, "schema_to_xml", 4, true, false, schema_to_xml },
+  { 2934, "schema_to_xmlschema", 4, true, false, schema_to_xmlschema },
+  { 2935, "schema_to_xml_and_xmlschema", 4, true, false, schema_to_xml_and_xmlschema },
+  { 2936, "database_to_xml", 3, true, false, database_to_xml },
+  { 2937, "database_to_xmlschema", 3, true, false, database_to_xmlschema },
+  { 2938, "database_to_xml_and_xmlschema", 3, true, false, database_to_xml_and_xmlschema },
+  { 2939, "txid_snapshot_in", 1, true, false, txid_snapshot_in },
+  { 2940, "txid_snapshot_out", 1, true, false, txid_snapshot_out },
+  { 2941, "txid_snapshot_recv", 1, true, false, txid_snapshot_recv },
+  { 2942, "txid_snapshot_send", 1, true, false, txid_snapshot_send },
+  { 2943, "txid_current", 0, true, false, txid_current },
+  { 2944, "txid_current_snapshot", 0, true, false, txid_current_snapshot },
+  { 2945, "txid_snapshot_xmin", 1, true, false, txid_snapshot_xmin },
+  { 2946, "txid_snapshot_xmax", 1, true, false, txid_snapshot_xmax },
+  { 2947, "txid_snapshot_xip", 1, true, true, txid_snapshot_xip },
+  { 2948, "txid_visible_in_snapshot", 2, true, false, txid_visible_in_snapshot },
+  { 2952, "uuid_in", 1, true, false, uuid_in },
+  { 2953, "uuid_out", 1, true, false, uuid_out },
+  { 2954, "uuid_lt", 2, true, false, uuid_lt },
+  { 2955, "uuid_le", 2, true, false, uuid_le },
+  { 2956, "uuid_eq", 2, true, false, uuid_eq },
+  { 2957, "uuid_ge", 2, true, false, uuid_ge },
+  { 2958, "uuid_gt", 2, true, false, uuid_gt },
+  { 2959, "uuid_ne", 2, true, false, uuid_ne },
+  { 2960, "uuid_cmp", 2, true, false, uuid_cmp },
+  { 2961, "uuid_recv", 1, true, false, uuid_recv },
+  { 2962, "uuid_send", 1, true, false, uuid_send },
+  { 2963, "uuid_hash", 1, true, false, uuid_hash },
+  { 2971, "booltext", 1, true, false, booltext },
+  { 2978, "pg_stat_get_function_calls", 1, true, false, pg_stat_get_function_calls },
+  { 2979, "pg_stat_get_function_time", 1, true, false, pg_stat_get_function_time },
+  { 2980, "pg_stat_get_function_self_time", 1, true, false, pg_stat_get_function_self_time },
+  { 2981, "record_eq", 2, true, false, record_eq },
+  { 2982, "record_ne", 2, true, false, record_ne },
+  { 2983, "record_lt", 2, true, false, record_lt },
+  { 2984, "record_gt", 2, true, false, record_gt },
+  { 2985, "record_le", 2, true, false, record_le },
+  { 2986, "record_ge", 2, true, false, record_ge },
+  { 2987, "btrecordcmp", 2, true, false, btrecordcmp },
+  { 2997, "pg_table_size", 1, true, false, pg_table_size },
+  { 2998, "pg_indexes_size", 1, true, false, pg_indexes_size },
+  { 2999, "pg_relation_filenode", 1, true, false, pg_relation_filenode },
+  { 3000, "has_foreign_data_wrapper_privilege_name_name", 3, true, false, has_foreign_data_wrapper_privilege_name_name },
+  { 3001, "has_foreign_data_wrapper_privilege_name_id", 3, true, false, has_foreign_data_wrapper_privilege_name_id },
+  { 3002, "has_foreign_data_wrapper_privilege_id_name", 3, true, false, has_foreign_data_wrapper_privilege_id_name },
+  { 3003, "has_foreign_data_wrapper_privilege_id_id", 3, true, false, has_foreign_data_wrapper_privilege_id_id },
+  { 3004, "has_foreign_data_wrapper_privilege_name", 2, true, false, has_foreign_data_wrapper_privilege_name },
+  { 3005, "has_foreign_data_wrapper_privilege_id", 2, true, false, has_foreign_data_wrapper_privilege_id },
+  { 3006, "has_server_privilege_name_name", 3, true, false, has_server_privilege_name_name },
+  { 3007, "has_server_privilege_name_id", 3, true, false, has_server_privilege_name_id },
+  { 3008, "has_server_privilege_id_name", 3, true, false, has_server_privilege_id_name },
+  { 3009, "has_server_privilege_id_id", 3, true, false, has_server_privilege_id_id },
+  { 3010, "has_server_privilege_name", 2, true, false, has_server_privilege_name },
+  { 3011, "has_server_privilege_id", 2, true, false, has_server_privilege_id },
+  { 3012, "has_column_privilege_name_name_name", 4, true, false, has_column_privilege_name_name_name },
+  { 3013, "has_column_privilege_name_name_attnum", 4, true, false, has_column_privilege_name_name_attnum },
+  { 3014, "has_column_privilege_name_id_name", 4, true, false, has_column_privilege_name_id_name },
+  { 3015, "has_column_privilege_name_id_attnum", 4, true, false, has_column_privilege_name_id_attnum },
+  { 3016, "has_column_privilege_id_name_name", 4, true, false, has_column_privilege_id_name_name },
+  { 3017, "has_column_privilege_id_name_attnum", 4, true, false, has_column_privilege_id_name_attnum },
+  { 3018, "has_column_privilege_id_id_name", 4, true, false, has_column_privilege_id_id_name },
+  { 3019, "has_column_privilege_id_id_attnum", 4, true, false, has_column_privilege_id_id_attnum },
+  { 3020, "has_column_privilege_name_name", 3, true, false, has_column_privilege_name_name },
+  { 3021, "has_column_privilege_name_attnum", 3, true, false, has_column_privilege_name_attnum },
+  { 3022, "has_column_privilege_id_name", 3, true, false, has_column_privilege_id_name },
+  { 3023, "has_column_privilege_id_attnum", 3, true, false, has_column_privilege_id_attnum },
+  { 3024, "has_any_column_privilege_name_name", 3, true, false, has_any_column_privilege_name_name },
+  { 3025, "has_any_column_privilege_name_id", 3, true, false, has_any_column_privilege_name_id },
+  { 3026, "has_any_column_privilege_id_name", 3, true, false, has_any_column_privilege_id_name },
+  { 3027, "has_any_column_privilege_id_id", 3, true, false, has_any_column_privilege_id_id },
+  { 3028, "has_any_column_privilege_name", 2, true, false, has_any_column_privilege_name },
+  { 3029, "has_any_column_privilege_id", 2, true, false, has_any_column_privilege_id },
+  { 3030, "bitoverlay", 4, true, false, bitoverlay },
+  { 3031, "bitoverlay_no_len", 3, true, false, bitoverlay_no_len },
+  { 3032, "bitgetbit", 2, true, false, bitgetbit },
+  { 3033, "bitsetbit", 3, true, false, bitsetbit },
+  { 3034, "pg_relation_filepath", 1, true, false, pg_relation_filepath },
+  { 3035, "pg_listening_channels", 0, true, true, pg_listening_channels },
+  { 3036, "pg_notify", 2, false, false, pg_notify },
+  { 3037, "pg_stat_get_xact_numscans", 1, true, false, pg_stat_get_xact_numscans },
+  { 3038, "pg_stat_get_xact_tuples_returned", 1, true, false, pg_stat_get_xact_tuples_returned },
+  { 3039, "pg_stat_get_xact_tuples_fetched", 1, true, false, pg_stat_get_xact_tuples_fetched },
+  { 3040, "pg_stat_get_xact_tuples_inserted", 1, true, false, pg_stat_get_xact_tuples_inserted },
+  { 3041, "pg_stat_get_xact_tuples_updated", 1, true, false, pg_stat_get_xact_tuples_updated },
+  { 3042, "pg_stat_get_xact_tuples_deleted", 1, true, false, pg_stat_get_xact_tuples_deleted },
+  { 3043, "pg_stat_get_xact_tuples_hot_updated", 1, true, false, pg_stat_get_xact_tuples_hot_updated },
+  { 3044, "pg_stat_get_xact_blocks_fetched", 1, true, false, pg_stat_get_xact_blocks_fetched },
+  { 3045, "pg_stat_get_xact_blocks_hit", 1, true, false, pg_stat_get_xact_blocks_hit },
+  { 3046, "pg_stat_get_xact_function_calls", 1, true, false, pg_stat_get_xact_function_calls },
+  { 3047, "pg_stat_get_xact_function_time", 1, true, false, pg_stat_get_xact_function_time },
+  { 3048, "pg_stat_get_xact_function_self_time", 1, true, false, pg_stat_get_xact_function_self_time },
+  { 3049, "xpath_exists", 3, true, false, xpath_exists },
+  { 3051, "xml_is_well_formed", 1, true, false, xml_is_well_formed },
+  { 3052, "xml_is_well_formed_document", 1, true, false, xml_is_well_formed_document },
+  { 3053, "xml_is_well_formed_content", 1, true, false, xml_is_well_formed_content },
+  { 3054, "pg_stat_get_vacuum_count", 1, true, false, pg_stat_get_vacuum_count },
+  { 3055, "pg_stat_get_autovacuum_count", 1, true, false, pg_stat_get_autovacuum_count },
+  { 3056, "pg_stat_get_analyze_count", 1, true, false, pg_stat_get_analyze_count },
+  { 3057, "pg_stat_get_autoanalyze_count", 1, true, false, pg_stat_get_autoanalyze_count },
+  { 3058, "text_concat", 1, false, false, text_concat },
+  { 3059, "text_concat_ws", 2, false, false, text_concat_ws },
+  { 3060, "text_left", 2, true, false, text_left },
+  { 3061, "text_right", 2, true, false, text_right },
+  { 3062, "text_reverse", 1, true, false, text_reverse },
+  { 3100, "window_row_number", 0, false, false, window_row_number },
+  { 3101, "window_rank", 0, false, false, window_rank },
+  { 3102, "window_dense_rank", 0, false, false, window_dense_rank },
+  { 3103, "window_percent_rank", 0, false, false, window_percent_rank },
+  { 3104, "window_cume_dist", 0, false, false, window_cume_dist },
+  { 3105, "window_ntile", 1, true, false, window_ntile },
+  { 3106, "window_lag", 1, true, false, window_lag },
+  { 3107, "window_lag_with_offset", 2, true, false, window_lag_with_offset },
+  { 3108, "window_lag_with_offset_and_default", 3, true, false, window_lag_with_offset_and_default },
+  { 3109, "window_lead", 1, true, false, window_lead },
+  { 3110, "window_lead_with_offset", 2, true, false, window_lead_with_offset },
+  { 3111, "window_lead_with_offset_and_default", 3, true, false, window_lead_with_offset_and_default },
+  { 3112, "window_first_value", 1, true, false, window_first_value },
+  { 3113, "window_last_value", 1, true, false, window_last_value },
+  { 3114, "window_nth_value", 2, true, false, window_nth_value },
+  { 3504, "anyenum_in", 1, true, false, anyenum_in },
+  { 3505, "anyenum_out", 1, true, false, anyenum_out },
+  { 3506, "enum_in", 2, true, false, enum_in },
+  { 3507, "enum_out", 1, true, false, enum_out },
+  { 3508, "enum_eq", 2, true, false, enum_eq },
+  { 3509, "enum_ne", 2, true, false, enum_ne },
+  { 3510, "enum_lt", 2, true, false, enum_lt },
+  { 3511, "enum_gt", 2, true, false, enum_gt },
+  { 3512, "enum_le", 2, true, false, enum_le },
+  { 3513, "enum_ge", 2, true, false, enum_ge },
+  { 3514, "enum_cmp", 2, true, false, enum_cmp },
+  { 3515, "hashenum", 1, true, false, hashenum },
+  { 3524, "enum_smaller", 2, true, false, enum_smaller },
+  { 3525, "enum_larger", 2, true, false, enum_larger },
+  { 3526, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 3527, "aggregate_dummy", 1, false, false, aggregate_dummy },
+  { 3528, "enum_first", 1, false, false, enum_first },
+  { 3529, "enum_last", 1, false, false, enum_last },
+  { 3530, "enum_range_bounds", 2, false, false, enum_range_bounds },
+  { 3531, "enum_range_all", 1, false, false, enum_range_all },
+  { 3532, "enum_recv", 2, true, false, enum_recv },
+  { 3533, "enum_send", 1, true, false, enum_send },
+  { 3535, "string_agg_transfn", 3, false, false, string_agg_transfn },
+  { 3536, "string_agg_finalfn", 1, false, false, string_agg_finalfn },
+  { 3538, "aggregate_dummy", 2, false, false, aggregate_dummy },
+  { 3610, "tsvectorin", 1, true, false, tsvectorin },
+  { 3611, "tsvectorout", 1, true, false, tsvectorout },
+  { 3612, "tsqueryin", 1, true, false, tsqueryin },
+  { 3613, "tsqueryout", 1, true, false, tsqueryout },
+  { 3616, "tsvector_lt", 2, true, false, tsvector_lt },
+  { 3617, "tsvector_le", 2, true, false, tsvector_le },
+  { 3618, "tsvector_eq", 2, true, false, tsvector_eq },
+  { 3619, "tsvector_ne", 2, true, false, tsvector_ne },
+  { 3620, "tsvector_ge", 2, true, false, tsvector_ge },
+  { 3621, "tsvector_gt", 2, true, false, tsvector_gt },
+  { 3622, "tsvector_cmp", 2, true, false, tsvector_cmp },
+  { 3623, "tsvector_strip", 1, true, false, tsvector_strip },
+  { 3624, "tsvector_setweight", 2, true, false, tsvector_setweight },
+  { 3625, "tsvector_concat", 2, true, false, tsvector_concat },
+  { 3634, "ts_match_vq", 2, true, false, ts_match_vq },
+  { 3635, "ts_match_qv", 2, true, false, ts_match_qv },
+  { 3638, "tsvectorsend", 1, true, false, tsvectorsend },
+  { 3639, "tsvectorrecv", 1, true, false, tsvectorrecv },
+  { 3640, "tsquerysend", 1, true, false, tsquerysend },
+  { 3641, "tsqueryrecv", 1, true, false, tsqueryrecv },
+  { 3646, "gtsvectorin", 1, true, false, gtsvectorin },
+  { 3647, "gtsvectorout", 1, true, false, gtsvectorout },
+  { 3648, "gtsvector_compress", 1, true, false, gtsvector_compress },
+  { 3649, "gtsvector_decompress", 1, true, false, gtsvector_decompress },
+  { 3650, "gtsvector_picksplit", 2, true, false, gtsvector_picksplit },
+  { 3651, "gtsvector_union", 2, true, false, gtsvector_union },
+  { 3652, "gtsvector_same", 3, true, false, gtsvector_same },
+  { 3653, "gtsvector_penalty", 3, true, false, gtsvector_penalty },
+  { 3654, "gtsvector_consistent", 5, true, false, gtsvector_consistent },
+  { 3656, "gin_extract_tsvector", 2, true, false, gin_extract_tsvector },
+  { 3657, "gin_extract_tsquery", 5, true, false, gin_extract_tsquery },
+  { 3658, "gin_tsquery_consistent", 6, true, false, gin_tsquery_consistent },
+  { 3662, "tsquery_lt", 2, true, false, tsquery_lt },
+  { 3663, "tsquery_le", 2, true, false, tsquery_le },
+  { 3664, "tsquery_eq", 2, true, false, tsquery_eq },
+  { 3665, "tsquery_ne", 2, true, false, tsquery_ne },
+  { 3666, "tsquery_ge", 2, true, false, tsquery_ge },
+  { 3667, "tsquery_gt", 2, true, false, tsquery_gt },
+  { 3668, "tsquery_cmp", 2, true, false, tsquery_cmp },
+  { 3669, "tsquery_and", 2, true, false, tsquery_and },
+  { 3670, "tsquery_or", 2, true, false, tsquery_or },
+  { 3671, "tsquery_not", 1, true, false, tsquery_not },
+  { 3672, "tsquery_numnode", 1, true, false, tsquery_numnode },
+  { 3673, "tsquerytree", 1, true, false, tsquerytree },
+  { 3684, "tsquery_rewrite", 3, true, false, tsquery_rewrite },
+  { 3685, "tsquery_rewrite_query", 2, true, false, tsquery_rewrite_query },
+  { 3686, "tsmatchsel", 4, true, false, tsmatchsel },
+  { 3687, "tsmatchjoinsel", 5, true, false, tsmatchjoinsel },
+  { 3688, "ts_typanalyze", 1, true, false, ts_typanalyze },
+  { 3689, "ts_stat1", 1, true, true, ts_stat1 },
+  { 3690, "ts_stat2", 2, true, true, ts_stat2 },
+  { 3691, "tsq_mcontains", 2, true, false, tsq_mcontains },
+  { 3692, "tsq_mcontained", 2, true, false, tsq_mcontained },
+  { 3695, "gtsquery_compress", 1, true, false, gtsquery_compress },
+  { 3696, "gtsquery_decompress", 1, true, false, gtsquery_decompress },
+  { 3697, "gtsquery_picksplit", 2, true, false, gtsquery_picksplit },
+  { 3698, "gtsquery_union", 2, true, false, gtsquery_union },
+  { 3699, "gtsquery_same", 3, true, false, gtsquery_same },
+  { 3700, "gtsquery_penalty", 3, true, false, gtsquery_penalty },
+  { 3701, "gtsquery_consistent", 5, true, false, gtsquery_consistent },
+  { 3703, "ts_rank_wttf", 4, true, false, ts_rank_wttf },
+  { 3704, "ts_rank_wtt", 3, true, false, ts_rank_wtt },
+  { 3705, "ts_rank_ttf", 3, true, false, ts_rank_ttf },
+  { 3706, "ts_rank_tt", 2, true, false, ts_rank_tt },
+  { 3707, "ts_rankcd_wttf", 4, true, false, ts_rankcd_wttf },
+  { 3708, "ts_rankcd_wtt", 3, true, false, ts_rankcd_wtt },
+  { 3709, "ts_rankcd_ttf", 3, true, false, ts_rankcd_ttf },
+  { 3710, "ts_rankcd_tt", 2, true, false, ts_rankcd_tt },
+  { 3711, "tsvector_length", 1, true, false, tsvector_length },
+  { 3713, "ts_token_type_byid", 1, true, true, ts_token_type_byid },
+  { 3714, "ts_token_type_byname", 1, true, true, ts_token_type_byname },
+  { 3715, "ts_parse_byid", 2, true, true, ts_parse_byid },
+  { 3716, "ts_parse_byname", 2, true, true, ts_parse_byname },
+  { 3717, "prsd_start", 2, true, false, prsd_start },
+  { 3718, "prsd_nexttoken", 3, true, false, prsd_nexttoken },
+  { 3719, "prsd_end", 1, true, false, prsd_end },
+  { 3720, "prsd_headline", 3, true, false, prsd_headline },
+  { 3721, "prsd_lextype", 1, true, false, prsd_lextype },
+  { 3723, "ts_lexize", 2, true, false, ts_lexize },
+  { 3724, "gin_cmp_tslexeme", 2, true, false, gin_cmp_tslexeme },
+  { 3725, "dsimple_init", 1, true, false, dsimple_init },
+  { 3726, "dsimple_lexize", 4, true, false, dsimple_lexize },
+  { 3728, "dsynonym_init", 1, true, false, dsynonym_init },
+  { 3729, "dsynonym_lexize", 4, true, false, dsynonym_lexize },
+  { 3731, "dispell_init", 1, true, false, dispell_init },
+  { 3732, "dispell_lexize", 4, true, false, dispell_lexize },
+  { 3736, "regconfigin", 1, true, false, regconfigin },
+  { 3737, "regconfigout", 1, true, false, regconfigout },
+  { 3738, "regconfigrecv", 1, true, false, regconfigrecv },
+  { 3739, "regconfigsend", 1, true, false, regconfigsend },
+  { 3740, "thesaurus_init", 1, true, false, thesaurus_init },
+  { 3741, "thesaurus_lexize", 4, true, false, thesaurus_lexize },
+  { 3743, "ts_headline_byid_opt", 4, true, false, ts_headline_byid_opt },
+  { 3744, "ts_headline_byid", 3, true, false, ts_headline_byid },
+  { 3745, "to_tsvector_byid", 2, true, false, to_tsvector_byid },
+  { 3746, "to_tsquery_byid", 2, true, false, to_tsquery_byid },
+  { 3747, "plainto_tsquery_byid", 2, true, false, plainto_tsquery_byid },
+  { 3749, "to_tsvector", 1, true, false, to_tsvector },
+  { 3750, "to_tsquery", 1, true, false, to_tsquery },
+  { 3751, "plainto_tsquery", 1, true, false, plainto_tsquery },
+  { 3752, "tsvector_update_trigger_byid", 0, false, false, tsvector_update_trigger_byid },
+  { 3753, "tsvector_update_trigger_bycolumn", 0, false, false, tsvector_update_trigger_bycolumn },
+  { 3754, "ts_headline_opt", 3, true, false, ts_headline_opt },
+  { 3755, "ts_headline", 2, true, false, ts_headline },
+  { 3756, "pg_ts_parser_is_visible", 1, true, false, pg_ts_parser_is_visible },
+  { 3757, "pg_ts_dict_is_visible", 1, true, false, pg_ts_dict_is_visible },
+  { 3758, "pg_ts_config_is_visible", 1, true, false, pg_ts_config_is_visible },
+  { 3759, "get_current_ts_config", 0, true, false, get_current_ts_config },
+  { 3760, "ts_match_tt", 2, true, false, ts_match_tt },
+  { 3761, "ts_match_tq", 2, true, false, ts_match_tq },
+  { 3768, "pg_ts_template_is_visible", 1, true, false, pg_ts_template_is_visible },
+  { 3771, "regdictionaryin", 1, true, false, regdictionaryin },
+  { 3772, "regdictionaryout", 1, true, false, regdictionaryout },
+  { 3773, "regdictionaryrecv", 1, true, false, regdictionaryrecv },
+  { 3774, "regdictionarysend", 1, true, false, regdictionarysend },
+  { 3775, "pg_stat_reset_shared", 1, false, false, pg_stat_reset_shared },
+  { 3776, "pg_stat_reset_single_table_counters", 1, false, false, pg_stat_reset_single_table_counters },
+  { 3777, "pg_stat_reset_single_function_counters", 1, false, false, pg_stat_reset_single_function_counters },
+  { 3810, "pg_is_in_recovery", 0, true, false, pg_is_in_recovery },
+  { 3820, "pg_last_xlog_receive_location", 0, true, false, pg_last_xlog_receive_location },
+  { 3821, "pg_last_xlog_replay_location", 0, true, false, pg_last_xlog_replay_location },
+  { 3822, "cash_div_cash", 2, true, false, cash_div_cash },
+  { 3823, "cash_numeric", 1, true, false, cash_numeric },
+  { 3824, "numeric_cash", 1, true, false, numeric_cash },
+  /* dummy entry is easier than getting rid of comma after last real one */
+  /* (not that there has ever been anything wrong with *having* a
+     comma after the last field in an array initializer) */
+  { 0, NULL, 0, false, false, NULL }
+};
+
+/* Note fmgr_nbuiltins excludes the dummy entry */
+const int fmgr_nbuiltins = (sizeof(fmgr_builtins) / sizeof(FmgrBuiltin)) - 1;
@@ -97,11 +97,12 @@ bool		enableFsync = true;
 bool		allowSystemTableMods = false;
 int			work_mem = 1024;
 int			maintenance_work_mem = 16384;
+int			max_parallel_maintenance_workers = 2;
 
 /*
  * Primary determinants of sizes of shared-memory structures.  MaxBackends is
- * MaxConnections + autovacuum_max_workers + 1 (it is computed by the GUC
- * assign hooks for those variables):
+ * MaxConnections + autovacuum_max_workers + 1 + max_parallel_workers (it is
+ * computed by the GUC assign hooks for those variables):
  */
 int			NBuffers = 1000;
 int			MaxBackends = 100;
@@ -35,6 +35,7 @@
 #include "miscadmin.h"
 #include "pgstat.h"
 #include "postmaster/autovacuum.h"
+#include "postmaster/parallelworker.h"
 #include "postmaster/postmaster.h"
 #include "replication/walsender.h"
 #include "storage/bufmgr.h"
@@ -280,9 +281,11 @@ CheckMyDatabase(const char *name, bool am_superuser)
 	 * a way to recover from disabling all access to all databases, for
 	 * example "UPDATE pg_database SET datallowconn = false;".
 	 *
-	 * We do not enforce them for autovacuum worker processes either.
+	 * We do not enforce them for autovacuum worker processes either, nor for
+	 * parallel workers, whose leader has already passed them.
 	 */
-	if (IsUnderPostmaster && !IsAutoVacuumWorkerProcess())
+	if (IsUnderPostmaster && !IsAutoVacuumWorkerProcess() &&
+		!IsParallelWorkerProcess())
 	{
 		/*
 		 * Check that the database is currently allowing connections.
@@ -592,8 +595,10 @@ InitPostgres(const char *in_dbname, Oid dboid, const char *username,
 	 *
 	 * In standalone mode and in autovacuum worker processes, we use a fixed
 	 * ID, otherwise we figure it out from the authenticated user name.
+	 * Parallel workers also start out with the fixed ID, and then switch to
+	 * their leader's identity.
 	 */
-	if (bootstrap || IsAutoVacuumWorkerProcess())
+	if (bootstrap || IsAutoVacuumWorkerProcess() || IsParallelWorkerProcess())
 	{
 		InitializeSessionUserIdStandalone();
 		am_superuser = true;
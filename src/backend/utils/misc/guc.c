@@ -52,6 +52,7 @@
 #include "pgstat.h"
 #include "postmaster/autovacuum.h"
 #include "postmaster/bgwriter.h"
+#include "postmaster/parallelworker.h"
 #include "postmaster/postmaster.h"
 #include "postmaster/syslogger.h"
 #include "postmaster/walwriter.h"
@@ -59,6 +60,7 @@
 #include "storage/bufmgr.h"
 #include "storage/standby.h"
 #include "storage/fd.h"
+#include "storage/pg_shmem.h"
 #include "tcop/tcopprot.h"
 #include "tsearch/ts_cache.h"
 #include "utils/builtins.h"
@@ -102,7 +104,8 @@
  * removed, we still could not exceed INT_MAX/4 because some places compute
  * 4*MaxBackends without any overflow check.  This is rechecked in
  * assign_maxconnections, since MaxBackends is computed as MaxConnections
- * plus autovacuum_max_workers plus one (for the autovacuum launcher).
+ * plus autovacuum_max_workers plus one (for the autovacuum launcher) plus
+ * max_parallel_workers.
  */
 #define MAX_BACKENDS	0x7fffff
 
@@ -121,8 +124,6 @@
 
 /* XXX these should appear in other modules' header files */
 extern bool Log_disconnections;
-extern int	CommitDelay;
-extern int	CommitSiblings;
 extern char *default_tablespace;
 extern char *temp_tablespaces;
 extern bool synchronize_seqscans;
@@ -181,6 +182,7 @@ static const char *show_tcp_keepalives_interval(void);
 static const char *show_tcp_keepalives_count(void);
 static bool assign_maxconnections(int newval, bool doit, GucSource source);
 static bool assign_autovacuum_max_workers(int newval, bool doit, GucSource source);
+static bool assign_max_parallel_workers(int newval, bool doit, GucSource source);
 static bool assign_effective_io_concurrency(int newval, bool doit, GucSource source);
 static const char *assign_pgstat_temp_directory(const char *newval, bool doit, GucSource source);
 static const char *assign_application_name(const char *newval, bool doit, GucSource source);
@@ -347,6 +349,23 @@ static const struct config_enum_entry constraint_exclusion_options[] = {
 	{NULL, 0, false}
 };
 
+/*
+ * Although only "on", "off", and "try" are documented, we accept all the
+ * likely variants of "on" and "off".
+ */
+static const struct config_enum_entry huge_pages_options[] = {
+	{"off", HUGE_PAGES_OFF, false},
+	{"on", HUGE_PAGES_ON, false},
+	{"try", HUGE_PAGES_TRY, false},
+	{"true", HUGE_PAGES_ON, true},
+	{"false", HUGE_PAGES_OFF, true},
+	{"yes", HUGE_PAGES_ON, true},
+	{"no", HUGE_PAGES_OFF, true},
+	{"1", HUGE_PAGES_ON, true},
+	{"0", HUGE_PAGES_OFF, true},
+	{NULL, 0, false}
+};
+
 /*
  * Options for enum values stored in other modules
  */
@@ -635,6 +654,14 @@ static struct config_bool ConfigureNamesBool[] =
 		&enable_indexscan,
 		true, NULL, NULL
 	},
+	{
+		{"enable_indexonlyscan", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enables the planner's use of index-only-scan plans."),
+			NULL
+		},
+		&enable_indexonlyscan,
+		true, NULL, NULL
+	},
 	{
 		{"enable_bitmapscan", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Enables the planner's use of bitmap-scan plans."),
@@ -1604,6 +1631,15 @@ static struct config_int ConfigureNamesInt[] =
 		-1, -1, 10000, NULL, NULL
 	},
 
+	{
+		{"autovacuum_vacuum_parallel_workers", PGC_SIGHUP, AUTOVACUUM,
+			gettext_noop("Number of parallel workers to use for index vacuuming, for autovacuum."),
+			gettext_noop("Zero vacuums the indexes one at a time.")
+		},
+		&autovacuum_vac_parallel_workers,
+		0, 0, MAX_BACKENDS, NULL, NULL
+	},
+
 	{
 		{"max_files_per_process", PGC_POSTMASTER, RESOURCES_KERNEL,
 			gettext_noop("Sets the maximum number of simultaneously open files for each server process."),
@@ -1759,6 +1795,16 @@ static struct config_int ConfigureNamesInt[] =
 		30, 0, INT_MAX, NULL, NULL
 	},
 
+	{
+		{"checkpoint_flush_after", PGC_SIGHUP, WAL_CHECKPOINTS,
+			gettext_noop("Number of pages after which previously performed checkpoint writes are flushed to disk."),
+			gettext_noop("Zero disables forced writeback."),
+			GUC_UNIT_BLOCKS
+		},
+		&checkpoint_flush_after,
+		32, 0, WRITEBACK_MAX_PENDING_FLUSHES, NULL, NULL
+	},
+
 	{
 		{"wal_buffers", PGC_POSTMASTER, WAL_SETTINGS,
 			gettext_noop("Sets the number of disk-page buffers in shared memory for WAL."),
@@ -1801,8 +1847,8 @@ static struct config_int ConfigureNamesInt[] =
 
 	{
 		{"commit_delay", PGC_USERSET, WAL_SETTINGS,
-			gettext_noop("Sets the delay in microseconds between transaction commit and "
-						 "flushing WAL to disk."),
+			gettext_noop("Sets the maximum delay in microseconds for more transactions "
+						 "to join a group commit before flushing WAL to disk."),
 			NULL
 		},
 		&CommitDelay,
@@ -1811,7 +1857,7 @@ static struct config_int ConfigureNamesInt[] =
 
 	{
 		{"commit_siblings", PGC_USERSET, WAL_SETTINGS,
-			gettext_noop("Sets the minimum concurrent open transactions before performing "
+			gettext_noop("Sets the minimum average group commit size before performing "
 						 "commit_delay."),
 			NULL
 		},
@@ -1891,6 +1937,44 @@ static struct config_int ConfigureNamesInt[] =
 		assign_effective_io_concurrency, NULL
 	},
 
+	{
+		/* see max_connections */
+		{"max_parallel_workers", PGC_POSTMASTER, RESOURCES_ASYNCHRONOUS,
+			gettext_noop("Sets the maximum number of simultaneously running parallel worker processes."),
+			NULL
+		},
+		&max_parallel_workers,
+		8, 0, MAX_BACKENDS, assign_max_parallel_workers, NULL
+	},
+
+	{
+		{"parallel_shared_memory", PGC_POSTMASTER, RESOURCES_ASYNCHRONOUS,
+			gettext_noop("Sets the amount of shared memory set aside for data shared by parallel workers."),
+			gettext_noop("Parallel hash joins build their hash tables here."),
+			GUC_UNIT_KB
+		},
+		&parallel_shared_memory,
+		8192, 0, MAX_KILOBYTES, NULL, NULL
+	},
+
+	{
+		{"max_parallel_maintenance_workers", PGC_USERSET, RESOURCES_ASYNCHRONOUS,
+			gettext_noop("Sets the maximum number of parallel workers to use for a single maintenance operation."),
+			gettext_noop("This includes sorting the entries of a new B-tree index.")
+		},
+		&max_parallel_maintenance_workers,
+		2, 0, MAX_BACKENDS, NULL, NULL
+	},
+
+	{
+		{"max_parallel_degree", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Sets the maximum number of parallel workers to use for a single scan."),
+			gettext_noop("Zero disables parallel query.")
+		},
+		&max_parallel_degree,
+		0, 0, MAX_BACKENDS, NULL, NULL
+	},
+
 	{
 		{"log_rotation_age", PGC_SIGHUP, LOGGING_WHERE,
 			gettext_noop("Automatic log file rotation will occur after N minutes."),
@@ -2176,6 +2260,24 @@ static struct config_real ConfigureNamesReal[] =
 		&cpu_operator_cost,
 		DEFAULT_CPU_OPERATOR_COST, 0, DBL_MAX, NULL, NULL
 	},
+	{
+		{"parallel_tuple_cost", PGC_USERSET, QUERY_TUNING_COST,
+			gettext_noop("Sets the planner's estimate of the cost of "
+						 "passing each tuple from a parallel worker to the leader."),
+			NULL
+		},
+		&parallel_tuple_cost,
+		DEFAULT_PARALLEL_TUPLE_COST, 0, DBL_MAX, NULL, NULL
+	},
+	{
+		{"parallel_setup_cost", PGC_USERSET, QUERY_TUNING_COST,
+			gettext_noop("Sets the planner's estimate of the cost of "
+						 "starting parallel workers for a query."),
+			NULL
+		},
+		&parallel_setup_cost,
+		DEFAULT_PARALLEL_SETUP_COST, 0, DBL_MAX, NULL, NULL
+	},
 
 	{
 		{"cursor_tuple_fraction", PGC_USERSET, QUERY_TUNING_OTHER,
@@ -2750,6 +2852,16 @@ static struct config_enum ConfigureNamesEnum[] =
 		NULL, NULL
 	},
 
+	{
+		{"huge_pages", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Sets whether huge pages are used for the main shared memory segment."),
+			NULL
+		},
+		&huge_pages,
+		HUGE_PAGES_TRY, huge_pages_options,
+		NULL, NULL
+	},
+
 	{
 		{"default_transaction_isolation", PGC_USERSET, CLIENT_CONN_STATEMENT,
 			gettext_noop("Sets the transaction isolation level of each new transaction."),
@@ -8003,11 +8115,11 @@ show_tcp_keepalives_count(void)
 static bool
 assign_maxconnections(int newval, bool doit, GucSource source)
 {
-	if (newval + autovacuum_max_workers + 1 > MAX_BACKENDS)
+	if (newval + autovacuum_max_workers + 1 + max_parallel_workers > MAX_BACKENDS)
 		return false;
 
 	if (doit)
-		MaxBackends = newval + autovacuum_max_workers + 1;
+		MaxBackends = newval + autovacuum_max_workers + 1 + max_parallel_workers;
 
 	return true;
 }
@@ -8015,11 +8127,23 @@ assign_maxconnections(int newval, bool doit, GucSource source)
 static bool
 assign_autovacuum_max_workers(int newval, bool doit, GucSource source)
 {
-	if (MaxConnections + newval + 1 > MAX_BACKENDS)
+	if (MaxConnections + newval + 1 + max_parallel_workers > MAX_BACKENDS)
+		return false;
+
+	if (doit)
+		MaxBackends = MaxConnections + newval + 1 + max_parallel_workers;
+
+	return true;
+}
+
+static bool
+assign_max_parallel_workers(int newval, bool doit, GucSource source)
+{
+	if (MaxConnections + autovacuum_max_workers + 1 + newval > MAX_BACKENDS)
 		return false;
 
 	if (doit)
-		MaxBackends = MaxConnections + newval + 1;
+		MaxBackends = MaxConnections + autovacuum_max_workers + 1 + newval;
 
 	return true;
 }
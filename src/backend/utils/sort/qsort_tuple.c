@@ -0,0 +1,168 @@
+/*-------------------------------------------------------------------------
+ *
+ * qsort_tuple.c
+ *	  Quicksort of an array of SortTuples, specialized for one comparator.
+ *
+ * This file is #included by tuplesort.c, once for each specialization, with
+ * these symbols defined:
+ *
+ *	QST_SORT		name of the sort function to define
+ *	QST_COMPARATOR	SortKeyComparator to apply to the leading key (datum1)
+ *
+ * The result is a function
+ *
+ *	static void QST_SORT(SortTuple *a, size_t n, int sk_flags)
+ *
+ * that sorts the array on datum1/isnull1 alone, honoring the DESC and
+ * NULLS_FIRST bits of sk_flags, so it is only suitable for single-key sorts.
+ * Compared to qsort_arg(), the comparator is expanded inline and elements
+ * are swapped as whole SortTuples, which matters a lot when the comparison
+ * itself is as cheap as comparing two integers.
+ *
+ * The algorithm is the same as in src/port/qsort_arg.c; see there for
+ * credits and the reasons for our modifications.  Keep the two in sync.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#ifndef QST_MAKE_NAME
+#define QST_MAKE_NAME_(a, b)	a##b
+#define QST_MAKE_NAME(a, b)		QST_MAKE_NAME_(a, b)
+#endif
+
+#define QST_MED3	QST_MAKE_NAME(QST_SORT,_med3)
+#define QST_COMPARE(a, b, sk_flags) \
+	inlineApplySortKey(QST_COMPARATOR, NULL, (sk_flags), \
+					   (a)->datum1, (a)->isnull1, (b)->datum1, (b)->isnull1)
+
+#ifndef QST_SWAP
+#define QST_SWAP(a, b) \
+	do { \
+		SortTuple	qst_t = *(a); \
+		*(a) = *(b); \
+		*(b) = qst_t; \
+	} while (0)
+
+#define QST_VECSWAP(a, b, n) \
+	do { \
+		size_t		qst_i; \
+		for (qst_i = 0; qst_i < (n); qst_i++) \
+			QST_SWAP((a) + qst_i, (b) + qst_i); \
+	} while (0)
+#endif
+
+static SortTuple *
+QST_MED3(SortTuple *a, SortTuple *b, SortTuple *c, int sk_flags)
+{
+	return QST_COMPARE(a, b, sk_flags) < 0 ?
+		(QST_COMPARE(b, c, sk_flags) < 0 ? b :
+		 (QST_COMPARE(a, c, sk_flags) < 0 ? c : a))
+		: (QST_COMPARE(b, c, sk_flags) > 0 ? b :
+		   (QST_COMPARE(a, c, sk_flags) < 0 ? a : c));
+}
+
+static void
+QST_SORT(SortTuple *a, size_t n, int sk_flags)
+{
+	SortTuple  *pa,
+			   *pb,
+			   *pc,
+			   *pd,
+			   *pl,
+			   *pm,
+			   *pn;
+	size_t		d;
+	int			r,
+				presorted;
+
+loop:
+	/* Allow interrupting long sorts, as the comparetup routines do */
+	CHECK_FOR_INTERRUPTS();
+
+	if (n < 7)
+	{
+		for (pm = a + 1; pm < a + n; pm++)
+			for (pl = pm; pl > a && QST_COMPARE(pl - 1, pl, sk_flags) > 0; pl--)
+				QST_SWAP(pl, pl - 1);
+		return;
+	}
+	presorted = 1;
+	for (pm = a + 1; pm < a + n; pm++)
+	{
+		if (QST_COMPARE(pm - 1, pm, sk_flags) > 0)
+		{
+			presorted = 0;
+			break;
+		}
+	}
+	if (presorted)
+		return;
+	pm = a + (n / 2);
+	if (n > 7)
+	{
+		pl = a;
+		pn = a + (n - 1);
+		if (n > 40)
+		{
+			d = n / 8;
+			pl = QST_MED3(pl, pl + d, pl + 2 * d, sk_flags);
+			pm = QST_MED3(pm - d, pm, pm + d, sk_flags);
+			pn = QST_MED3(pn - 2 * d, pn - d, pn, sk_flags);
+		}
+		pm = QST_MED3(pl, pm, pn, sk_flags);
+	}
+	QST_SWAP(a, pm);
+	pa = pb = a + 1;
+	pc = pd = a + (n - 1);
+	for (;;)
+	{
+		while (pb <= pc && (r = QST_COMPARE(pb, a, sk_flags)) <= 0)
+		{
+			if (r == 0)
+			{
+				QST_SWAP(pa, pb);
+				pa++;
+			}
+			pb++;
+		}
+		while (pb <= pc && (r = QST_COMPARE(pc, a, sk_flags)) >= 0)
+		{
+			if (r == 0)
+			{
+				QST_SWAP(pc, pd);
+				pd--;
+			}
+			pc--;
+		}
+		if (pb > pc)
+			break;
+		QST_SWAP(pb, pc);
+		pb++;
+		pc--;
+	}
+	pn = a + n;
+	d = Min(pa - a, pb - pa);
+	QST_VECSWAP(a, pb - d, d);
+	d = Min(pd - pc, pn - pd - 1);
+	QST_VECSWAP(pb, pn - d, d);
+	if ((d = pb - pa) > 1)
+		QST_SORT(a, d, sk_flags);
+	if ((d = pd - pc) > 1)
+	{
+		/* Iterate rather than recurse to save stack space */
+		a = pn - d;
+		n = d;
+		goto loop;
+	}
+}
+
+#undef QST_MED3
+#undef QST_COMPARE
+#undef QST_SORT
+#undef QST_COMPARATOR
@@ -86,6 +86,17 @@
  * we preread from a tape, so as to maintain the locality of access described
  * above.  Nonetheless, with large workMem we can have many tapes.
  *
+ * A btree index sort can also enlist parallel worker processes (see
+ * tuplesort_set_parallel).  Once the input has overflowed workMem, so that
+ * we know the sort is a big one, we start the workers and hand them batches
+ * of the remaining input tuples through shared memory queues.  Each worker
+ * sorts its share as an ordinary sort of its own, with runs on its own
+ * temporary tapes, while we go on sorting any batch that no worker has room
+ * for.  When the input ends, each worker sends back its sorted output
+ * through its worker queue, and the final merge of those streams with our
+ * own result is performed on-the-fly as the caller repeatedly calls
+ * tuplesort_getXXX.
+ *
  *
  * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -99,14 +110,20 @@
 #include "postgres.h"
 
 #include <limits.h>
+#include <math.h>
 
 #include "access/genam.h"
 #include "access/nbtree.h"
+#include "access/transam.h"
 #include "catalog/pg_amop.h"
 #include "catalog/pg_operator.h"
 #include "commands/tablespace.h"
+#include "lib/stringinfo.h"
 #include "miscadmin.h"
 #include "pg_trace.h"
+#include "postmaster/parallelworker.h"
+#include "utils/builtins.h"
+#include "utils/date.h"
 #include "utils/datum.h"
 #include "utils/logtape.h"
 #include "utils/lsyscache.h"
@@ -114,6 +131,7 @@
 #include "utils/pg_rusage.h"
 #include "utils/rel.h"
 #include "utils/syscache.h"
+#include "utils/timestamp.h"
 #include "utils/tuplesort.h"
 
 
@@ -165,6 +183,16 @@ typedef struct
 	int			tupindex;		/* see notes above */
 } SortTuple;
 
+/*
+ * For the most common btree opclasses on pass-by-value types, we bypass the
+ * fmgr and call a SortKeyComparator directly.  It must give the same results
+ * as the opclass's comparison support function.  When such a key is the only
+ * sort key, we also have a copy of the quicksort routine specialized for it,
+ * a SortTupleSorter; see qsort_tuple.c.
+ */
+typedef int (*SortKeyComparator) (Datum a, Datum b);
+typedef void (*SortTupleSorter) (SortTuple *a, size_t n, int sk_flags);
+
 
 /*
  * Possible states of a Tuplesort object.  These denote the states that
@@ -195,6 +223,69 @@ typedef enum
 #define TAPE_BUFFER_OVERHEAD		(BLCKSZ * 3)
 #define MERGE_BUFFER_SIZE			(BLCKSZ * 32)
 
+/*
+ * A source of sorted tuples for the final merge of a parallel sort.  Source
+ * 0 is the leader's own sort result, and source i + 1 is the output stream
+ * of worker i --- or, if that worker never started, a sort of the input
+ * batches we had sent it.
+ */
+typedef struct TuplesortSource
+{
+	bool		active;			/* not exhausted yet? */
+	SortTuple	head;			/* next tuple from this source */
+	bool		head_should_free;		/* must head.tuple be pfree'd? */
+	shm_mq_handle *reader;		/* worker's output queue */
+	struct Tuplesortstate *adopted;		/* sort of the worker's input */
+} TuplesortSource;
+
+/*
+ * Leader-side state of a parallel sort.
+ */
+typedef struct TuplesortParallel
+{
+	int			nworkers_wanted;	/* max number of workers to use */
+	bool		launched;		/* tried to start workers yet? */
+	ParallelContext *pcxt;		/* NULL if we're sorting alone */
+	int			nworkers;		/* number of workers reserved */
+	shm_mq	  **inqueue;		/* input queue of each worker */
+	int			nextworker;		/* worker to offer the next batch first */
+	StringInfoData batch;		/* batch of input tuples being filled */
+	Size		max_batch;		/* max size of a batch */
+	bool		merging;		/* doing the final merge? */
+	int			nsources;		/* number of sources to merge */
+	TuplesortSource *sources;	/* array of length nsources */
+	SortTuple	last;			/* last tuple returned, if enforceUnique */
+	bool		last_should_free;	/* must last.tuple be pfree'd? */
+} TuplesortParallel;
+
+/*
+ * Layout of the argument area of a parallel sort.  The header is followed
+ * by the fixed part of the pg_attribute row of each index column, by a
+ * ParallelSortKey for each sort key, and by one input queue per worker.
+ */
+typedef struct ParallelSortHeader
+{
+	int			workMem;		/* workMem for each worker's sort */
+	int			nKeys;			/* number of index columns */
+	Size		attrs_offset;	/* offset of pg_attribute rows */
+	Size		keys_offset;	/* offset of ParallelSortKeys */
+	Size		queue_offset;	/* offset of the first input queue */
+	Size		queue_size;		/* size of each input queue */
+} ParallelSortHeader;
+
+typedef struct ParallelSortKey
+{
+	RegProcedure procedure;		/* btree comparison support function */
+	int			flags;			/* sk_flags of the scankey */
+	AttrNumber	attno;			/* sk_attno of the scankey */
+} ParallelSortKey;
+
+/*
+ * Each input queue must be big enough to hold a couple of batches with a
+ * useful number of tuples in them; we give up on using workers otherwise.
+ */
+#define PARALLEL_SORT_MIN_QUEUE_SIZE	4096
+
 /*
  * Private state of a Tuplesort operation.
  */
@@ -207,6 +298,7 @@ struct Tuplesortstate
 								 * tuples to return? */
 	bool		boundUsed;		/* true if we made use of a bounded heap */
 	int			bound;			/* if bounded, the maximum number of tuples */
+	TuplesortParallel *parallel;	/* parallel sort state, or NULL */
 	long		availMem;		/* remaining memory available, in bytes */
 	long		allowedMem;		/* total memory allowed, in bytes */
 	int			maxTapes;		/* number of tapes (Knuth's T) */
@@ -260,6 +352,16 @@ struct Tuplesortstate
 	 */
 	void		(*reversedirection) (Tuplesortstate *state);
 
+	/*
+	 * Direct comparator for each sort key, or NULL where we have to go
+	 * through the fmgr (array of length nKeys; set up by the
+	 * tuplesort_begin_xxx routines, except tuplesort_begin_index_hash).  If
+	 * the sort has a single key with a specialized quicksort routine,
+	 * onekeySorter is that routine; it's used in place of qsort_arg.
+	 */
+	SortKeyComparator *keyComparators;
+	SortTupleSorter onekeySorter;
+
 	/*
 	 * This array holds the tuples now in sort memory.	If we are in state
 	 * INITIAL, the tuples are in no particular order; if we are in state
@@ -338,6 +440,7 @@ struct Tuplesortstate
 	/*
 	 * These variables are specific to the MinimalTuple case; they are set by
 	 * tuplesort_begin_heap and used only by the MinimalTuple routines.
+	 * (tupDesc is also set to the index's descriptor in the IndexTuple case.)
 	 */
 	TupleDesc	tupDesc;
 	ScanKey		scanKeys;		/* array of length nKeys */
@@ -427,6 +530,8 @@ struct Tuplesortstate
 
 static Tuplesortstate *tuplesort_begin_common(int workMem, bool randomAccess);
 static void puttuple_common(Tuplesortstate *state, SortTuple *tuple);
+static bool tuplesort_gettuple_local(Tuplesortstate *state, bool forward,
+						 SortTuple *stup, bool *should_free);
 static void inittapes(Tuplesortstate *state);
 static void selectnewtape(Tuplesortstate *state);
 static void mergeruns(Tuplesortstate *state);
@@ -470,6 +575,17 @@ static void readtup_datum(Tuplesortstate *state, SortTuple *stup,
 			  int tapenum, unsigned int len);
 static void reversedirection_datum(Tuplesortstate *state);
 static void free_sort_tuple(Tuplesortstate *state, SortTuple *stup);
+static void setup_key_comparators(Tuplesortstate *state,
+					  FmgrInfo **sortFunctions, bool onekey);
+static void parallel_launch(Tuplesortstate *state);
+static void parallel_addtuple(Tuplesortstate *state, IndexTuple tuple);
+static void parallel_sendbatch(Tuplesortstate *state);
+static void parallel_adopt(Tuplesortstate *state, int srcno);
+static bool parallel_readsource(Tuplesortstate *state, int srcno);
+static void parallel_beginmerge(Tuplesortstate *state);
+static bool parallel_gettuple(Tuplesortstate *state, SortTuple *stup,
+				  bool *should_free);
+static void parallel_end(Tuplesortstate *state);
 
 
 /*
@@ -562,6 +678,7 @@ tuplesort_begin_heap(TupleDesc tupDesc,
 {
 	Tuplesortstate *state = tuplesort_begin_common(workMem, randomAccess);
 	MemoryContext oldcontext;
+	FmgrInfo  **sortFunctions;
 	int			i;
 
 	oldcontext = MemoryContextSwitchTo(state->sortcontext);
@@ -622,6 +739,12 @@ tuplesort_begin_heap(TupleDesc tupDesc,
 			state->scanKeys[i].sk_flags |= SK_BT_NULLS_FIRST;
 	}
 
+	sortFunctions = (FmgrInfo **) palloc(nkeys * sizeof(FmgrInfo *));
+	for (i = 0; i < nkeys; i++)
+		sortFunctions[i] = &state->scanKeys[i].sk_func;
+	setup_key_comparators(state, sortFunctions, nkeys == 1);
+	pfree(sortFunctions);
+
 	MemoryContextSwitchTo(oldcontext);
 
 	return state;
@@ -634,6 +757,8 @@ tuplesort_begin_index_btree(Relation indexRel,
 {
 	Tuplesortstate *state = tuplesort_begin_common(workMem, randomAccess);
 	MemoryContext oldcontext;
+	FmgrInfo  **sortFunctions;
+	int			i;
 
 	oldcontext = MemoryContextSwitchTo(state->sortcontext);
 
@@ -660,9 +785,17 @@ tuplesort_begin_index_btree(Relation indexRel,
 	state->reversedirection = reversedirection_index_btree;
 
 	state->indexRel = indexRel;
+	state->tupDesc = RelationGetDescr(indexRel);
 	state->indexScanKey = _bt_mkscankey_nodata(indexRel);
 	state->enforceUnique = enforceUnique;
 
+	sortFunctions = (FmgrInfo **) palloc(state->nKeys * sizeof(FmgrInfo *));
+	for (i = 0; i < state->nKeys; i++)
+		sortFunctions[i] = &state->indexScanKey[i].sk_func;
+	/* ties are broken on the heap TID, so we can't use onekeySorter */
+	setup_key_comparators(state, sortFunctions, false);
+	pfree(sortFunctions);
+
 	MemoryContextSwitchTo(oldcontext);
 
 	return state;
@@ -695,6 +828,7 @@ tuplesort_begin_index_hash(Relation indexRel,
 	state->reversedirection = reversedirection_index_hash;
 
 	state->indexRel = indexRel;
+	state->tupDesc = RelationGetDescr(indexRel);
 
 	state->hash_mask = hash_mask;
 
@@ -711,6 +845,7 @@ tuplesort_begin_datum(Oid datumType,
 	Tuplesortstate *state = tuplesort_begin_common(workMem, randomAccess);
 	MemoryContext oldcontext;
 	Oid			sortFunction;
+	FmgrInfo   *sortOpFn;
 	bool		reverse;
 	int16		typlen;
 	bool		typbyval;
@@ -746,6 +881,8 @@ tuplesort_begin_datum(Oid datumType,
 		elog(ERROR, "operator %u is not a valid ordering operator",
 			 sortOperator);
 	fmgr_info(sortFunction, &state->sortOpFn);
+	sortOpFn = &state->sortOpFn;
+	setup_key_comparators(state, &sortOpFn, true);
 
 	/* set ordering flags */
 	state->sortFnFlags = reverse ? SK_BT_DESC : 0;
@@ -796,6 +933,44 @@ tuplesort_set_bound(Tuplesortstate *state, int64 bound)
 	state->bound = (int) bound;
 }
 
+/*
+ * tuplesort_set_parallel
+ *
+ *	Allow a btree index sort to use up to nworkers parallel worker processes.
+ *
+ * Must be called before inserting any tuples.  Workers are started only if
+ * the input turns out not to fit in workMem.  They can't see catalog changes
+ * made by our own transaction, so we don't use them unless the comparison
+ * functions and column types of the index were all installed by initdb.
+ *
+ * A parallel sort does not support random access, and the tuples returned by
+ * tuplesort_getindextuple are only valid until the next call.
+ */
+void
+tuplesort_set_parallel(Tuplesortstate *state, int nworkers)
+{
+	int			i;
+
+	/* Assert we're called before loading any tuples */
+	Assert(state->status == TSS_INITIAL);
+	Assert(state->memtupcount == 0);
+
+	if (nworkers <= 0 || state->randomAccess ||
+		state->comparetup != comparetup_index_btree)
+		return;
+
+	for (i = 0; i < state->nKeys; i++)
+	{
+		if (state->indexScanKey[i].sk_func.fn_oid >= FirstNormalObjectId ||
+			state->tupDesc->attrs[i]->atttypid >= FirstNormalObjectId)
+			return;
+	}
+
+	state->parallel = (TuplesortParallel *)
+		MemoryContextAllocZero(state->sortcontext, sizeof(TuplesortParallel));
+	state->parallel->nworkers_wanted = nworkers;
+}
+
 /*
  * tuplesort_end
  *
@@ -820,6 +995,9 @@ tuplesort_end(Tuplesortstate *state)
 		spaceUsed = (state->allowedMem - state->availMem + 1023) / 1024;
 #endif
 
+	if (state->parallel && state->parallel->pcxt)
+		parallel_end(state);
+
 	/*
 	 * Delete temporary "tape" files, if any.
 	 *
@@ -934,6 +1112,14 @@ tuplesort_putindextuple(Tuplesortstate *state, IndexTuple tuple)
 	MemoryContext oldcontext = MemoryContextSwitchTo(state->sortcontext);
 	SortTuple	stup;
 
+	/* Once we have workers, leave as much of the input as we can to them */
+	if (state->parallel && state->parallel->pcxt)
+	{
+		parallel_addtuple(state, tuple);
+		MemoryContextSwitchTo(oldcontext);
+		return;
+	}
+
 	/*
 	 * Copy the given tuple into memory we control, and decrease availMem.
 	 * Then call the common code.
@@ -942,6 +1128,14 @@ tuplesort_putindextuple(Tuplesortstate *state, IndexTuple tuple)
 
 	puttuple_common(state, &stup);
 
+	/*
+	 * If that made us start writing runs, the sort is a big one, so see if
+	 * we can get some workers to help with the rest of it.
+	 */
+	if (state->parallel && !state->parallel->launched &&
+		state->status == TSS_BUILDRUNS)
+		parallel_launch(state);
+
 	MemoryContextSwitchTo(oldcontext);
 }
 
@@ -1117,6 +1311,18 @@ tuplesort_performsort(Tuplesortstate *state)
 			 pg_rusage_show(&state->ru_start));
 #endif
 
+	if (state->parallel && state->parallel->pcxt)
+	{
+		TuplesortParallel *parallel = state->parallel;
+		int			i;
+
+		/* Hand out the last batch, and let the workers know that's all */
+		if (parallel->batch.len > 0)
+			parallel_sendbatch(state);
+		for (i = 0; i < parallel->nworkers; i++)
+			shm_mq_detach(parallel->inqueue[i]);
+	}
+
 	switch (state->status)
 	{
 		case TSS_INITIAL:
@@ -1126,11 +1332,20 @@ tuplesort_performsort(Tuplesortstate *state)
 			 * amount of memory.  Just qsort 'em and we're done.
 			 */
 			if (state->memtupcount > 1)
-				qsort_arg((void *) state->memtuples,
-						  state->memtupcount,
-						  sizeof(SortTuple),
-						  (qsort_arg_comparator) state->comparetup,
-						  (void *) state);
+			{
+				if (state->onekeySorter)
+					(*state->onekeySorter) (state->memtuples,
+											state->memtupcount,
+											state->scanKeys ?
+											state->scanKeys[0].sk_flags :
+											state->sortFnFlags);
+				else
+					qsort_arg((void *) state->memtuples,
+							  state->memtupcount,
+							  sizeof(SortTuple),
+							  (qsort_arg_comparator) state->comparetup,
+							  (void *) state);
+			}
 			state->current = 0;
 			state->eof_reached = false;
 			state->markpos_offset = 0;
@@ -1174,6 +1389,9 @@ tuplesort_performsort(Tuplesortstate *state)
 			break;
 	}
 
+	if (state->parallel && state->parallel->pcxt)
+		parallel_beginmerge(state);
+
 #ifdef TRACE_SORT
 	if (trace_sort)
 	{
@@ -1198,6 +1416,23 @@ tuplesort_performsort(Tuplesortstate *state)
 static bool
 tuplesort_gettuple_common(Tuplesortstate *state, bool forward,
 						  SortTuple *stup, bool *should_free)
+{
+	if (state->parallel && state->parallel->merging)
+	{
+		Assert(forward);
+		return parallel_gettuple(state, stup, should_free);
+	}
+
+	return tuplesort_gettuple_local(state, forward, stup, should_free);
+}
+
+/*
+ * Fetch the next tuple of our own sort result, ignoring any parallel
+ * workers.  Same API as tuplesort_gettuple_common.
+ */
+static bool
+tuplesort_gettuple_local(Tuplesortstate *state, bool forward,
+						 SortTuple *stup, bool *should_free)
 {
 	unsigned int tuplen;
 
@@ -2568,6 +2803,223 @@ ApplySortFunction(FmgrInfo *sortFunction, int sortFlags,
 }
 
 
+/*
+ * Direct comparators for common pass-by-value key types.  Each must match
+ * the btree comparison support function it stands in for; see
+ * lookup_key_comparator.
+ */
+
+static inline int
+cmp_int2(Datum a, Datum b)
+{
+	return (int) DatumGetInt16(a) - (int) DatumGetInt16(b);
+}
+
+static inline int
+cmp_int4(Datum a, Datum b)
+{
+	int32		x = DatumGetInt32(a);
+	int32		y = DatumGetInt32(b);
+
+	if (x > y)
+		return 1;
+	else if (x == y)
+		return 0;
+	else
+		return -1;
+}
+
+static inline int
+cmp_int8(Datum a, Datum b)
+{
+	int64		x = DatumGetInt64(a);
+	int64		y = DatumGetInt64(b);
+
+	if (x > y)
+		return 1;
+	else if (x == y)
+		return 0;
+	else
+		return -1;
+}
+
+static inline int
+cmp_oid(Datum a, Datum b)
+{
+	Oid			x = DatumGetObjectId(a);
+	Oid			y = DatumGetObjectId(b);
+
+	if (x > y)
+		return 1;
+	else if (x == y)
+		return 0;
+	else
+		return -1;
+}
+
+/* NaNs are equal to each other and larger than anything else, as in float.c */
+static inline int
+cmp_float4(Datum a, Datum b)
+{
+	float4		x = DatumGetFloat4(a);
+	float4		y = DatumGetFloat4(b);
+
+	if (isnan(x))
+		return isnan(y) ? 0 : 1;
+	else if (isnan(y))
+		return -1;
+	else if (x > y)
+		return 1;
+	else if (x < y)
+		return -1;
+	else
+		return 0;
+}
+
+static inline int
+cmp_float8(Datum a, Datum b)
+{
+	float8		x = DatumGetFloat8(a);
+	float8		y = DatumGetFloat8(b);
+
+	if (isnan(x))
+		return isnan(y) ? 0 : 1;
+	else if (isnan(y))
+		return -1;
+	else if (x > y)
+		return 1;
+	else if (x < y)
+		return -1;
+	else
+		return 0;
+}
+
+/*
+ * Find a direct comparator that gives the same results as the given
+ * comparison function, if we have one.  We go by the C function rather than
+ * the pg_proc OID, so as to catch all the SQL-level aliases of it.
+ */
+static SortKeyComparator
+lookup_key_comparator(FmgrInfo *sortFunction)
+{
+	PGFunction	fn = sortFunction->fn_addr;
+
+	if (fn == btint4cmp || fn == date_cmp)
+		return cmp_int4;
+	if (fn == btint8cmp)
+		return cmp_int8;
+	if (fn == btfloat8cmp)
+		return cmp_float8;
+	if (fn == timestamp_cmp)
+	{
+#ifdef HAVE_INT64_TIMESTAMP
+		return cmp_int8;
+#else
+		return cmp_float8;
+#endif
+	}
+	if (fn == btint2cmp)
+		return cmp_int2;
+	if (fn == btoidcmp)
+		return cmp_oid;
+	if (fn == btfloat4cmp)
+		return cmp_float4;
+	return NULL;
+}
+
+/*
+ * Like inlineApplySortFunction, but use the direct comparator if we have
+ * one, instead of calling the sort function.
+ */
+static inline int32
+inlineApplySortKey(SortKeyComparator comparator,
+				   FmgrInfo *sortFunction, int sk_flags,
+				   Datum datum1, bool isNull1,
+				   Datum datum2, bool isNull2)
+{
+	int32		compare;
+
+	if (comparator == NULL)
+		return inlineApplySortFunction(sortFunction, sk_flags,
+									   datum1, isNull1,
+									   datum2, isNull2);
+
+	if (isNull1)
+	{
+		if (isNull2)
+			compare = 0;		/* NULL "=" NULL */
+		else if (sk_flags & SK_BT_NULLS_FIRST)
+			compare = -1;		/* NULL "<" NOT_NULL */
+		else
+			compare = 1;		/* NULL ">" NOT_NULL */
+	}
+	else if (isNull2)
+	{
+		if (sk_flags & SK_BT_NULLS_FIRST)
+			compare = 1;		/* NOT_NULL ">" NULL */
+		else
+			compare = -1;		/* NOT_NULL "<" NULL */
+	}
+	else
+	{
+		compare = comparator(datum1, datum2);
+
+		if (sk_flags & SK_BT_DESC)
+			compare = -compare;
+	}
+
+	return compare;
+}
+
+/*
+ * Specialized quicksort routines for single-key sorts
+ */
+
+#define QST_SORT		qsort_tuple_int4
+#define QST_COMPARATOR	cmp_int4
+#include "qsort_tuple.c"
+
+#define QST_SORT		qsort_tuple_int8
+#define QST_COMPARATOR	cmp_int8
+#include "qsort_tuple.c"
+
+#define QST_SORT		qsort_tuple_float8
+#define QST_COMPARATOR	cmp_float8
+#include "qsort_tuple.c"
+
+/*
+ * Set up state->keyComparators from the sort functions of the sort keys,
+ * and state->onekeySorter if onekey is true and we have a specialized
+ * quicksort for the (single) key.  onekey must only be passed as true if the
+ * comparetup routine compares nothing but datum1/isnull1.
+ */
+static void
+setup_key_comparators(Tuplesortstate *state, FmgrInfo **sortFunctions,
+					  bool onekey)
+{
+	SortKeyComparator comparator;
+	int			i;
+
+	state->keyComparators = (SortKeyComparator *)
+		palloc(state->nKeys * sizeof(SortKeyComparator));
+	for (i = 0; i < state->nKeys; i++)
+		state->keyComparators[i] = lookup_key_comparator(sortFunctions[i]);
+
+	state->onekeySorter = NULL;
+	if (!onekey)
+		return;
+	Assert(state->nKeys == 1);
+
+	comparator = state->keyComparators[0];
+	if (comparator == cmp_int4)
+		state->onekeySorter = qsort_tuple_int4;
+	else if (comparator == cmp_int8)
+		state->onekeySorter = qsort_tuple_int8;
+	else if (comparator == cmp_float8)
+		state->onekeySorter = qsort_tuple_float8;
+}
+
+
 /*
  * Routines specialized for HeapTuple (actually MinimalTuple) case
  */
@@ -2586,9 +3038,10 @@ comparetup_heap(const SortTuple *a, const SortTuple *b, Tuplesortstate *state)
 	CHECK_FOR_INTERRUPTS();
 
 	/* Compare the leading sort key */
-	compare = inlineApplySortFunction(&scanKey->sk_func, scanKey->sk_flags,
-									  a->datum1, a->isnull1,
-									  b->datum1, b->isnull1);
+	compare = inlineApplySortKey(state->keyComparators[0],
+								 &scanKey->sk_func, scanKey->sk_flags,
+								 a->datum1, a->isnull1,
+								 b->datum1, b->isnull1);
 	if (compare != 0)
 		return compare;
 
@@ -2610,9 +3063,10 @@ comparetup_heap(const SortTuple *a, const SortTuple *b, Tuplesortstate *state)
 		datum1 = heap_getattr(&ltup, attno, tupDesc, &isnull1);
 		datum2 = heap_getattr(&rtup, attno, tupDesc, &isnull2);
 
-		compare = inlineApplySortFunction(&scanKey->sk_func, scanKey->sk_flags,
-										  datum1, isnull1,
-										  datum2, isnull2);
+		compare = inlineApplySortKey(state->keyComparators[nkey],
+									 &scanKey->sk_func, scanKey->sk_flags,
+									 datum1, isnull1,
+									 datum2, isnull2);
 		if (compare != 0)
 			return compare;
 	}
@@ -2743,9 +3197,10 @@ comparetup_index_btree(const SortTuple *a, const SortTuple *b,
 	CHECK_FOR_INTERRUPTS();
 
 	/* Compare the leading sort key */
-	compare = inlineApplySortFunction(&scanKey->sk_func, scanKey->sk_flags,
-									  a->datum1, a->isnull1,
-									  b->datum1, b->isnull1);
+	compare = inlineApplySortKey(state->keyComparators[0],
+								 &scanKey->sk_func, scanKey->sk_flags,
+								 a->datum1, a->isnull1,
+								 b->datum1, b->isnull1);
 	if (compare != 0)
 		return compare;
 
@@ -2757,7 +3212,7 @@ comparetup_index_btree(const SortTuple *a, const SortTuple *b,
 	tuple1 = (IndexTuple) a->tuple;
 	tuple2 = (IndexTuple) b->tuple;
 	keysz = state->nKeys;
-	tupDes = RelationGetDescr(state->indexRel);
+	tupDes = state->tupDesc;
 	scanKey++;
 	for (nkey = 2; nkey <= keysz; nkey++, scanKey++)
 	{
@@ -2769,9 +3224,10 @@ comparetup_index_btree(const SortTuple *a, const SortTuple *b,
 		datum1 = index_getattr(tuple1, nkey, tupDes, &isnull1);
 		datum2 = index_getattr(tuple2, nkey, tupDes, &isnull2);
 
-		compare = inlineApplySortFunction(&scanKey->sk_func, scanKey->sk_flags,
-										  datum1, isnull1,
-										  datum2, isnull2);
+		compare = inlineApplySortKey(state->keyComparators[nkey - 1],
+									 &scanKey->sk_func, scanKey->sk_flags,
+									 datum1, isnull1,
+									 datum2, isnull2);
 		if (compare != 0)
 			return compare;		/* done when we find unequal attributes */
 
@@ -2902,7 +3358,7 @@ copytup_index(Tuplesortstate *state, SortTuple *stup, void *tup)
 	/* set up first-column key value */
 	stup->datum1 = index_getattr(newtuple,
 								 1,
-								 RelationGetDescr(state->indexRel),
+								 state->tupDesc,
 								 &stup->isnull1);
 }
 
@@ -2944,7 +3400,7 @@ readtup_index(Tuplesortstate *state, SortTuple *stup,
 	/* set up first-column key value */
 	stup->datum1 = index_getattr(tuple,
 								 1,
-								 RelationGetDescr(state->indexRel),
+								 state->tupDesc,
 								 &stup->isnull1);
 }
 
@@ -2978,9 +3434,10 @@ comparetup_datum(const SortTuple *a, const SortTuple *b, Tuplesortstate *state)
 	/* Allow interrupting long sorts */
 	CHECK_FOR_INTERRUPTS();
 
-	return inlineApplySortFunction(&state->sortOpFn, state->sortFnFlags,
-								   a->datum1, a->isnull1,
-								   b->datum1, b->isnull1);
+	return inlineApplySortKey(state->keyComparators[0],
+							  &state->sortOpFn, state->sortFnFlags,
+							  a->datum1, a->isnull1,
+							  b->datum1, b->isnull1);
 }
 
 static void
@@ -3087,3 +3544,508 @@ free_sort_tuple(Tuplesortstate *state, SortTuple *stup)
 	FREEMEM(state, GetMemoryChunkSpace(stup->tuple));
 	pfree(stup->tuple);
 }
+
+
+/*
+ * Routines for parallel sorting
+ *
+ * Only btree index sorts are supported; see tuplesort_set_parallel.
+ */
+
+/*
+ * Try to start workers for the rest of a sort that has just overflowed
+ * workMem.  If we can't get any, we simply carry on alone.
+ */
+static void
+parallel_launch(Tuplesortstate *state)
+{
+	TuplesortParallel *parallel = state->parallel;
+	ParallelContext *pcxt;
+	ParallelSortHeader *header;
+	ParallelSortKey *keys;
+	char	   *args;
+	Size		argsize;
+	Size		size;
+	int			i;
+
+	parallel->launched = true;
+
+	if (!IsUnderPostmaster)
+		return;
+
+	pcxt = CreateParallelContext(PARALLEL_ENTRY_SORT,
+								 parallel->nworkers_wanted);
+	args = ParallelContextArgumentSpace(pcxt, &argsize);
+	if (args == NULL)
+	{
+		DestroyParallelContext(pcxt);
+		return;
+	}
+
+	/* Lay out the argument area, giving up if there's no room for queues */
+	header = (ParallelSortHeader *) args;
+	size = MAXALIGN(sizeof(ParallelSortHeader));
+	header->attrs_offset = size;
+	size += MAXALIGN(state->nKeys * ATTRIBUTE_FIXED_PART_SIZE);
+	header->keys_offset = size;
+	size += MAXALIGN(state->nKeys * sizeof(ParallelSortKey));
+	header->queue_offset = size;
+
+	if (header->queue_offset >= argsize ||
+		(argsize - header->queue_offset) / pcxt->nworkers <
+		PARALLEL_SORT_MIN_QUEUE_SIZE)
+	{
+		DestroyParallelContext(pcxt);
+		return;
+	}
+	header->queue_size = (argsize - header->queue_offset) / pcxt->nworkers;
+	header->queue_size -= header->queue_size % MAXIMUM_ALIGNOF;
+
+	/* Describe the sort; each worker gets the same workMem we have */
+	header->workMem = (int) (state->allowedMem / 1024L);
+	header->nKeys = state->nKeys;
+	for (i = 0; i < state->nKeys; i++)
+		memcpy(args + header->attrs_offset + i * ATTRIBUTE_FIXED_PART_SIZE,
+			   state->tupDesc->attrs[i], ATTRIBUTE_FIXED_PART_SIZE);
+	keys = (ParallelSortKey *) (args + header->keys_offset);
+	for (i = 0; i < state->nKeys; i++)
+	{
+		keys[i].procedure = state->indexScanKey[i].sk_func.fn_oid;
+		keys[i].flags = state->indexScanKey[i].sk_flags;
+		keys[i].attno = state->indexScanKey[i].sk_attno;
+	}
+
+	/* Set up the input queues */
+	parallel->pcxt = pcxt;
+	parallel->nworkers = pcxt->nworkers;
+	parallel->inqueue = (shm_mq **) palloc(pcxt->nworkers * sizeof(shm_mq *));
+	for (i = 0; i < pcxt->nworkers; i++)
+	{
+		parallel->inqueue[i] = shm_mq_create(args + header->queue_offset +
+											 i * header->queue_size,
+											 header->queue_size);
+		shm_mq_set_sender(parallel->inqueue[i], MyProc);
+	}
+
+	/*
+	 * A batch can take up half of a queue, so that a worker can work on one
+	 * batch while the next one is waiting for it.
+	 */
+	parallel->max_batch = header->queue_size / 2;
+	initStringInfo(&parallel->batch);
+
+	LaunchParallelWorkers(pcxt);
+
+	parallel->nsources = pcxt->nworkers + 1;
+	parallel->sources = (TuplesortSource *)
+		palloc0(parallel->nsources * sizeof(TuplesortSource));
+	for (i = 0; i < pcxt->nworkers; i++)
+		parallel->sources[i + 1].reader =
+			shm_mq_attach(ParallelWorkerQueue(pcxt, i));
+
+#ifdef TRACE_SORT
+	if (trace_sort)
+		elog(LOG, "started %d parallel sort workers: %s",
+			 pcxt->nworkers, pg_rusage_show(&state->ru_start));
+#endif
+}
+
+/*
+ * Add an input tuple to the batch being filled, handing out the batch
+ * first if the tuple doesn't fit in it.
+ */
+static void
+parallel_addtuple(Tuplesortstate *state, IndexTuple tuple)
+{
+	TuplesortParallel *parallel = state->parallel;
+	Size		tuplen = IndexTupleSize(tuple);
+
+	if (parallel->batch.len + MAXALIGN(tuplen) > parallel->max_batch)
+	{
+		if (parallel->batch.len > 0)
+			parallel_sendbatch(state);
+
+		/* A tuple too big for any batch is one we sort ourselves */
+		if (MAXALIGN(tuplen) > parallel->max_batch)
+		{
+			SortTuple	stup;
+
+			COPYTUP(state, &stup, (void *) tuple);
+			puttuple_common(state, &stup);
+			return;
+		}
+	}
+
+	/* Keep each tuple MAXALIGN'd, so the workers can use it in place */
+	enlargeStringInfo(&parallel->batch, MAXALIGN(tuplen));
+	memcpy(parallel->batch.data + parallel->batch.len, tuple, tuplen);
+	parallel->batch.len += MAXALIGN(tuplen);
+	parallel->batch.data[parallel->batch.len] = '\0';
+}
+
+/*
+ * Give the batch to the next worker that has room for it.  If they're all
+ * still busy with earlier batches, sort the batch ourselves instead, so
+ * that whoever is fastest ends up doing the most work.
+ */
+static void
+parallel_sendbatch(Tuplesortstate *state)
+{
+	TuplesortParallel *parallel = state->parallel;
+	char	   *pos;
+	char	   *end;
+	int			i;
+
+	for (i = 0; i < parallel->nworkers; i++)
+	{
+		int			w = (parallel->nextworker + i) % parallel->nworkers;
+		shm_mq_result res;
+
+		res = shm_mq_try_send(parallel->inqueue[w], parallel->batch.len,
+							  parallel->batch.data);
+		if (res == SHM_MQ_SUCCESS)
+		{
+			parallel->nextworker = (w + 1) % parallel->nworkers;
+			resetStringInfo(&parallel->batch);
+			return;
+		}
+
+		/* A worker that stopped reading has probably failed */
+		if (res == SHM_MQ_DETACHED)
+			CheckParallelWorkers(parallel->pcxt);
+	}
+
+	pos = parallel->batch.data;
+	end = pos + parallel->batch.len;
+	while (pos < end)
+	{
+		IndexTuple	tuple = (IndexTuple) pos;
+		SortTuple	stup;
+
+		COPYTUP(state, &stup, (void *) tuple);
+		puttuple_common(state, &stup);
+		pos += MAXALIGN(IndexTupleSize(tuple));
+	}
+	resetStringInfo(&parallel->batch);
+}
+
+/*
+ * Take over the input queue of a worker that was never started, and sort
+ * whatever batches we had already sent it ourselves.
+ */
+static void
+parallel_adopt(Tuplesortstate *state, int srcno)
+{
+	TuplesortParallel *parallel = state->parallel;
+	TuplesortSource *src = &parallel->sources[srcno];
+	shm_mq	   *mq = parallel->inqueue[srcno - 1];
+	shm_mq_handle *mqh;
+	Size		nbytes;
+	void	   *data;
+
+	src->adopted = tuplesort_begin_index_btree(state->indexRel, false,
+											   (int) (state->allowedMem / 1024L),
+											   false);
+
+	/* We're the only sender, so everything we sent is there to be read */
+	shm_mq_set_receiver(mq, MyProc);
+	mqh = shm_mq_attach(mq);
+	while (shm_mq_receive(mqh, &nbytes, &data, true) == SHM_MQ_SUCCESS)
+	{
+		char	   *pos = (char *) data;
+		char	   *end = pos + nbytes;
+
+		while (pos < end)
+		{
+			tuplesort_putindextuple(src->adopted, (IndexTuple) pos);
+			pos += MAXALIGN(IndexTupleSize((IndexTuple) pos));
+		}
+	}
+	shm_mq_handle_free(mqh);
+	shm_mq_detach(mq);
+
+	tuplesort_performsort(src->adopted);
+}
+
+/*
+ * Load the next tuple of a merge source into its head.  Returns false if the
+ * source is exhausted.
+ */
+static bool
+parallel_readsource(Tuplesortstate *state, int srcno)
+{
+	TuplesortParallel *parallel = state->parallel;
+	TuplesortSource *src = &parallel->sources[srcno];
+
+	if (srcno == 0)
+		return tuplesort_gettuple_local(state, true, &src->head,
+										&src->head_should_free);
+
+	if (src->adopted)
+	{
+		MemoryContext oldcontext;
+		bool		found;
+
+		oldcontext = MemoryContextSwitchTo(src->adopted->sortcontext);
+		found = tuplesort_gettuple_local(src->adopted, true, &src->head,
+										 &src->head_should_free);
+		MemoryContextSwitchTo(oldcontext);
+		return found;
+	}
+
+	for (;;)
+	{
+		shm_mq_result res;
+		Size		nbytes;
+		void	   *data;
+
+		res = shm_mq_receive(src->reader, &nbytes, &data, true);
+		if (res == SHM_MQ_SUCCESS)
+		{
+			IndexTuple	tuple = (IndexTuple) palloc(nbytes);
+
+			memcpy(tuple, data, nbytes);
+			src->head.tuple = (void *) tuple;
+			src->head.datum1 = index_getattr(tuple, 1, state->tupDesc,
+											 &src->head.isnull1);
+			src->head_should_free = true;
+			return true;
+		}
+
+		if (res == SHM_MQ_DETACHED)
+		{
+			/* A worker that failed must not look like one that finished */
+			CheckParallelWorkers(parallel->pcxt);
+
+			if (shm_mq_get_receiver(parallel->inqueue[srcno - 1]) == NULL)
+			{
+				parallel_adopt(state, srcno);
+				return parallel_readsource(state, srcno);
+			}
+			return false;
+		}
+
+		/* The worker is still sorting, or we've read all it has sent */
+		WaitLatch(&MyProc->procLatch, -1L);
+		ResetLatch(&MyProc->procLatch);
+		CHECK_FOR_INTERRUPTS();
+		CheckParallelWorkers(parallel->pcxt);
+	}
+}
+
+/*
+ * Start the final merge of our own sort result with the workers' output,
+ * once our own sort is done.  This waits for each worker to finish sorting.
+ */
+static void
+parallel_beginmerge(Tuplesortstate *state)
+{
+	TuplesortParallel *parallel = state->parallel;
+	int			i;
+
+	for (i = 0; i < parallel->nsources; i++)
+		parallel->sources[i].active = parallel_readsource(state, i);
+	parallel->merging = true;
+
+#ifdef TRACE_SORT
+	if (trace_sort)
+		elog(LOG, "parallel sort workers done, starting %d-way final merge: %s",
+			 parallel->nsources, pg_rusage_show(&state->ru_start));
+#endif
+}
+
+/*
+ * Fetch the next tuple of the final merge of a parallel sort.
+ *
+ * There are only a handful of sources, so we simply look through all their
+ * heads for the smallest tuple rather than keeping them in a heap.
+ */
+static bool
+parallel_gettuple(Tuplesortstate *state, SortTuple *stup, bool *should_free)
+{
+	TuplesortParallel *parallel = state->parallel;
+	TuplesortSource *src;
+	int			best = -1;
+	int			i;
+
+	for (i = 0; i < parallel->nsources; i++)
+	{
+		if (!parallel->sources[i].active)
+			continue;
+		if (best < 0 ||
+			COMPARETUP(state, &parallel->sources[i].head,
+					   &parallel->sources[best].head) < 0)
+			best = i;
+	}
+	if (best < 0)
+		return false;
+
+	src = &parallel->sources[best];
+	*stup = src->head;
+	*should_free = src->head_should_free;
+	src->active = parallel_readsource(state, best);
+
+	/*
+	 * The workers don't check uniqueness, since they can't produce the error
+	 * message, so two equal tuples from the same worker may never have been
+	 * compared.  Compare each tuple with the one before it instead; any
+	 * duplicates are bound to be adjacent in the output.  We have to hang on
+	 * to the previous tuple for that, so the caller mustn't free it.
+	 */
+	if (state->enforceUnique)
+	{
+		if (parallel->last.tuple != NULL)
+		{
+			(void) COMPARETUP(state, &parallel->last, stup);
+			if (parallel->last_should_free)
+				pfree(parallel->last.tuple);
+		}
+		parallel->last = *stup;
+		parallel->last_should_free = *should_free;
+		*should_free = false;
+	}
+
+	return true;
+}
+
+/*
+ * Shut down the workers of a parallel sort.
+ */
+static void
+parallel_end(Tuplesortstate *state)
+{
+	TuplesortParallel *parallel = state->parallel;
+	bool		finished = parallel->merging;
+	int			i;
+
+	for (i = 1; i < parallel->nsources; i++)
+	{
+		TuplesortSource *src = &parallel->sources[i];
+
+		if (src->active)
+			finished = false;
+		if (src->adopted)
+			tuplesort_end(src->adopted);
+		shm_mq_handle_free(src->reader);
+	}
+
+	/*
+	 * If we read all of the workers' output they're about to exit anyway;
+	 * otherwise they are cancelled.
+	 */
+	if (finished)
+		WaitForParallelWorkersToFinish(parallel->pcxt);
+	DestroyParallelContext(parallel->pcxt);
+	parallel->pcxt = NULL;
+}
+
+/*
+ * ParallelSortMain
+ *		Entry point for a parallel worker of a btree index sort.
+ *
+ * We sort the batches of index tuples the leader hands us until it detaches
+ * from our input queue, and then send back all the tuples in sorted order.
+ * We don't touch the index itself, which our transaction can't see; the
+ * leader tells us all we need to know about it.
+ */
+void
+ParallelSortMain(char *args, Size size)
+{
+	ParallelSortHeader *header = (ParallelSortHeader *) args;
+	ParallelSortKey *keys = (ParallelSortKey *) (args + header->keys_offset);
+	shm_mq	   *inqueue;
+	shm_mq_handle *inqh;
+	shm_mq	   *outqueue = GetParallelWorkerQueue();
+	Tuplesortstate *state;
+	MemoryContext oldcontext;
+	FmgrInfo  **sortFunctions;
+	IndexTuple	tuple;
+	bool		should_free;
+	int			i;
+
+	inqueue = (shm_mq *) (args + header->queue_offset +
+						  ParallelWorkerNumber * header->queue_size);
+	shm_mq_set_receiver(inqueue, MyProc);
+	inqh = shm_mq_attach(inqueue);
+
+	state = tuplesort_begin_common(header->workMem, false);
+	oldcontext = MemoryContextSwitchTo(state->sortcontext);
+
+#ifdef TRACE_SORT
+	if (trace_sort)
+		elog(LOG, "begin parallel index sort: worker = %d, workMem = %d",
+			 ParallelWorkerNumber, header->workMem);
+#endif
+
+	state->nKeys = header->nKeys;
+
+	state->comparetup = comparetup_index_btree;
+	state->copytup = copytup_index;
+	state->writetup = writetup_index;
+	state->readtup = readtup_index;
+	state->reversedirection = reversedirection_index_btree;
+
+	state->tupDesc = CreateTemplateTupleDesc(header->nKeys, false);
+	for (i = 0; i < header->nKeys; i++)
+	{
+		memcpy(state->tupDesc->attrs[i],
+			   args + header->attrs_offset + i * ATTRIBUTE_FIXED_PART_SIZE,
+			   ATTRIBUTE_FIXED_PART_SIZE);
+		state->tupDesc->attrs[i]->attcacheoff = -1;
+	}
+	state->indexScanKey = (ScanKey) palloc(header->nKeys * sizeof(ScanKeyData));
+	for (i = 0; i < header->nKeys; i++)
+		ScanKeyEntryInitialize(&state->indexScanKey[i],
+							   keys[i].flags,
+							   keys[i].attno,
+							   InvalidStrategy,
+							   InvalidOid,
+							   keys[i].procedure,
+							   (Datum) 0);
+	/* the leader checks uniqueness, see parallel_gettuple */
+	state->enforceUnique = false;
+
+	sortFunctions = (FmgrInfo **) palloc(header->nKeys * sizeof(FmgrInfo *));
+	for (i = 0; i < header->nKeys; i++)
+		sortFunctions[i] = &state->indexScanKey[i].sk_func;
+	setup_key_comparators(state, sortFunctions, false);
+	pfree(sortFunctions);
+
+	MemoryContextSwitchTo(oldcontext);
+
+	for (;;)
+	{
+		Size		nbytes;
+		void	   *data;
+		char	   *pos;
+		char	   *end;
+
+		if (shm_mq_receive(inqh, &nbytes, &data, false) != SHM_MQ_SUCCESS)
+			break;
+
+		pos = (char *) data;
+		end = pos + nbytes;
+		while (pos < end)
+		{
+			tuplesort_putindextuple(state, (IndexTuple) pos);
+			pos += MAXALIGN(IndexTupleSize((IndexTuple) pos));
+		}
+	}
+	shm_mq_handle_free(inqh);
+
+	tuplesort_performsort(state);
+
+	while ((tuple = tuplesort_getindextuple(state, true,
+											&should_free)) != NULL)
+	{
+		shm_mq_result res;
+
+		res = shm_mq_send(outqueue, IndexTupleSize(tuple), tuple);
+		if (should_free)
+			pfree(tuple);
+		if (res != SHM_MQ_SUCCESS)
+			break;
+	}
+
+	tuplesort_end(state);
+}
@@ -7,7 +7,7 @@
  * persistent memory.  When a snapshot is no longer in any of these lists
  * (tracked by separate refcounts on each snapshot), its memory can be freed.
  *
- * These arrangements let us reset MyProc->xmin when there are no snapshots
+ * These arrangements let us reset MyPgXact->xmin when there are no snapshots
  * referenced by this transaction.	(One possible improvement would be to be
  * able to advance Xmin when the snapshot with the earliest Xmin is no longer
  * referenced.	That's a bit harder though, it requires more locking, and
@@ -88,7 +88,7 @@ static ActiveSnapshotElt *ActiveSnapshot = NULL;
  * How many snapshots is resowner.c tracking for us?
  *
  * Note: for now, a simple counter is enough.  However, if we ever want to be
- * smarter about advancing our MyProc->xmin we will need to be more
+ * smarter about advancing our MyPgXact->xmin we will need to be more
  * sophisticated about this, perhaps keeping our own list of snapshots.
  */
 static int	RegisteredSnapshots = 0;
@@ -103,6 +103,21 @@ bool		FirstSnapshotSet = false;
  */
 static bool registered_xact_snapshot = false;
 
+/*
+ * Fixed-size part of a snapshot serialized by SerializeSnapshot.  The xip
+ * and subxip arrays follow it.
+ */
+typedef struct SerializedSnapshotData
+{
+	TransactionId xmin;
+	TransactionId xmax;
+	uint32		xcnt;
+	int32		subxcnt;
+	bool		suboverflowed;
+	bool		takenDuringRecovery;
+	CommandId	curcid;
+} SerializedSnapshotData;
+
 
 static Snapshot CopySnapshot(Snapshot snapshot);
 static void FreeSnapshot(Snapshot snapshot);
@@ -440,15 +455,15 @@ UnregisterSnapshotFromOwner(Snapshot snapshot, ResourceOwner owner)
 /*
  * SnapshotResetXmin
  *
- * If there are no more snapshots, we can reset our PGPROC->xmin to InvalidXid.
- * Note we can do this without locking because we assume that storing an Xid
- * is atomic.
+ * If there are no more snapshots, we can reset our MyPgXact->xmin to
+ * InvalidXid.  Note we can do this without locking because we assume that
+ * storing an Xid is atomic.
  */
 static void
 SnapshotResetXmin(void)
 {
 	if (RegisteredSnapshots == 0 && ActiveSnapshot == NULL)
-		MyProc->xmin = InvalidTransactionId;
+		MyPgXact->xmin = InvalidTransactionId;
 }
 
 /*
@@ -525,6 +540,121 @@ AtEarlyCommit_Snapshot(void)
 
 }
 
+/*
+ * EstimateSnapshotSpace
+ *		Returns the size needed to store the given snapshot with
+ *		SerializeSnapshot.
+ */
+Size
+EstimateSnapshotSpace(Snapshot snapshot)
+{
+	Size		size;
+
+	Assert(snapshot != InvalidSnapshot);
+	Assert(snapshot->satisfies == HeapTupleSatisfiesMVCC);
+
+	size = add_size(sizeof(SerializedSnapshotData),
+					mul_size(snapshot->xcnt, sizeof(TransactionId)));
+	if (snapshot->subxcnt > 0 &&
+		(!snapshot->suboverflowed || snapshot->takenDuringRecovery))
+		size = add_size(size,
+						mul_size(snapshot->subxcnt, sizeof(TransactionId)));
+
+	return size;
+}
+
+/*
+ * SerializeSnapshot
+ *		Dump a snapshot into the given memory, which must be at least
+ *		EstimateSnapshotSpace(snapshot) bytes and suitably aligned.
+ *
+ * This is used to hand a snapshot over to a parallel worker process, which
+ * rebuilds it with RestoreSnapshot.
+ */
+void
+SerializeSnapshot(Snapshot snapshot, char *start_address)
+{
+	SerializedSnapshotData *serialized;
+	char	   *p;
+
+	serialized = (SerializedSnapshotData *) start_address;
+	serialized->xmin = snapshot->xmin;
+	serialized->xmax = snapshot->xmax;
+	serialized->xcnt = snapshot->xcnt;
+	serialized->suboverflowed = snapshot->suboverflowed;
+	serialized->takenDuringRecovery = snapshot->takenDuringRecovery;
+	serialized->curcid = snapshot->curcid;
+
+	/* As in CopySnapshot, skip an overflowed subxid array */
+	if (snapshot->subxcnt > 0 &&
+		(!snapshot->suboverflowed || snapshot->takenDuringRecovery))
+		serialized->subxcnt = snapshot->subxcnt;
+	else
+		serialized->subxcnt = 0;
+
+	p = start_address + sizeof(SerializedSnapshotData);
+	if (snapshot->xcnt > 0)
+	{
+		memcpy(p, snapshot->xip, snapshot->xcnt * sizeof(TransactionId));
+		p += snapshot->xcnt * sizeof(TransactionId);
+	}
+	if (serialized->subxcnt > 0)
+		memcpy(p, snapshot->subxip,
+			   serialized->subxcnt * sizeof(TransactionId));
+}
+
+/*
+ * RestoreSnapshot
+ *		Rebuild a snapshot dumped by SerializeSnapshot.
+ *
+ * As with CopySnapshot, the result is palloc'd in TopTransactionContext, has
+ * initial refcounts set to 0 and has the copied flag set.  Note that this
+ * does not do anything to keep the snapshot's xmin from going backwards;
+ * that is the caller's business.
+ */
+Snapshot
+RestoreSnapshot(char *start_address)
+{
+	SerializedSnapshotData *serialized;
+	Snapshot	snapshot;
+	Size		size;
+	char	   *p;
+
+	serialized = (SerializedSnapshotData *) start_address;
+
+	size = sizeof(SnapshotData) +
+		serialized->xcnt * sizeof(TransactionId) +
+		serialized->subxcnt * sizeof(TransactionId);
+
+	snapshot = (Snapshot) MemoryContextAllocZero(TopTransactionContext, size);
+	snapshot->satisfies = HeapTupleSatisfiesMVCC;
+	snapshot->xmin = serialized->xmin;
+	snapshot->xmax = serialized->xmax;
+	snapshot->xcnt = serialized->xcnt;
+	snapshot->subxcnt = serialized->subxcnt;
+	snapshot->suboverflowed = serialized->suboverflowed;
+	snapshot->takenDuringRecovery = serialized->takenDuringRecovery;
+	snapshot->curcid = serialized->curcid;
+	snapshot->copied = true;
+
+	p = start_address + sizeof(SerializedSnapshotData);
+	if (serialized->xcnt > 0)
+	{
+		snapshot->xip = (TransactionId *) (snapshot + 1);
+		memcpy(snapshot->xip, p, serialized->xcnt * sizeof(TransactionId));
+		p += serialized->xcnt * sizeof(TransactionId);
+	}
+	if (serialized->subxcnt > 0)
+	{
+		snapshot->subxip = ((TransactionId *) (snapshot + 1)) +
+			serialized->xcnt;
+		memcpy(snapshot->subxip, p,
+			   serialized->subxcnt * sizeof(TransactionId));
+	}
+
+	return snapshot;
+}
+
 /*
  * AtEOXact_Snapshot
  *		Snapshot manager's cleanup function for end of transaction
@@ -0,0 +1 @@
+../../../src/interfaces/libpq/pqsignal.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../../src/backend/utils/hash/pg_crc.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../../src/bin/pg_dump/dumputils.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../../src/bin/pg_dump/keywords.c
\ No newline at end of file
@@ -0,0 +1,2928 @@
+/* Generated by pyflex from psqlscan.l; do not edit. */
+#define FLEX_SCANNER
+#define YY_FLEX_MAJOR_VERSION 2
+#define YY_FLEX_MINOR_VERSION 5
+#define YY_FLEX_SUBMINOR_VERSION 35
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+typedef size_t yy_size_t;
+#ifndef YY_TYPEDEF_YY_BUFFER_STATE
+#define YY_TYPEDEF_YY_BUFFER_STATE
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+#endif
+#define YY_END_OF_BUFFER_CHAR 0
+#define YY_BUF_SIZE 16384
+#define YY_NULL 0
+#define YY_EXIT_FAILURE 2
+#define INITIAL 0
+#define xb 1
+#define xc 2
+#define xd 3
+#define xh 4
+#define xe 5
+#define xq 6
+#define xdolq 7
+#define xui 8
+#define xus 9
+#define xeu 10
+#define xslashcmd 11
+#define xslasharg 12
+#define xslashquote 13
+#define xslashbackquote 14
+#define xslashdefaultarg 15
+#define xslashquotedarg 16
+#define xslashwholeline 17
+#define xslashend 18
+extern char *yytext;
+extern int yyleng;
+
+/*-------------------------------------------------------------------------
+ *
+ * psqlscan.l
+ *	  lexical scanner for psql
+ *
+ * This code is mainly needed to determine where the end of a SQL statement
+ * is: we are looking for semicolons that are not within quotes, comments,
+ * or parentheses.  The most reliable way to handle this is to borrow the
+ * backend's flex lexer rules, lock, stock, and barrel.  The rules below
+ * are (except for a few) the same as the backend's, but their actions are
+ * just ECHO whereas the backend's actions generally do other things.
+ *
+ * XXX The rules in this file must be kept in sync with the backend lexer!!!
+ *
+ * XXX Avoid creating backtracking cases --- see the backend lexer for info.
+ *
+ * The most difficult aspect of this code is that we need to work in multibyte
+ * encodings that are not ASCII-safe.  A "safe" encoding is one in which each
+ * byte of a multibyte character has the high bit set (it's >= 0x80).  Since
+ * all our lexing rules treat all high-bit-set characters alike, we don't
+ * really need to care whether such a byte is part of a sequence or not.
+ * In an "unsafe" encoding, we still expect the first byte of a multibyte
+ * sequence to be >= 0x80, but later bytes might not be.  If we scan such
+ * a sequence as-is, the lexing rules could easily be fooled into matching
+ * such bytes to ordinary ASCII characters.  Our solution for this is to
+ * substitute 0xFF for each non-first byte within the data presented to flex.
+ * The flex rules will then pass the FF's through unmolested.  The emit()
+ * subroutine is responsible for looking back to the original string and
+ * replacing FF's with the corresponding original bytes.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL: pgsql/src/bin/psql/psqlscan.l,v 1.33 2010/05/05 22:18:56 tgl Exp $
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres_fe.h"
+
+#include "psqlscan.h"
+
+#include <ctype.h>
+
+#include "common.h"
+#include "settings.h"
+#include "variables.h"
+
+
+/*
+ * We use a stack of flex buffers to handle substitution of psql variables.
+ * Each stacked buffer contains the as-yet-unread text from one psql variable.
+ * When we pop the stack all the way, we resume reading from the outer buffer
+ * identified by scanbufhandle.
+ */
+typedef struct StackElem
+{
+	YY_BUFFER_STATE buf;		/* flex input control structure */
+	char	   *bufstring;		/* data actually being scanned by flex */
+	char	   *origstring;		/* copy of original data, if needed */
+	char	   *varname;		/* name of variable providing data, or NULL */
+	struct StackElem *next;
+} StackElem;
+
+/*
+ * All working state of the lexer must be stored in PsqlScanStateData
+ * between calls.  This allows us to have multiple open lexer operations,
+ * which is needed for nested include files.  The lexer itself is not
+ * recursive, but it must be re-entrant.
+ */
+typedef struct PsqlScanStateData
+{
+	StackElem  *buffer_stack;	/* stack of variable expansion buffers */
+	/*
+	 * These variables always refer to the outer buffer, never to any
+	 * stacked variable-expansion buffer.
+	 */
+	YY_BUFFER_STATE scanbufhandle;
+	char	   *scanbuf;		/* start of outer-level input buffer */
+	const char *scanline;		/* current input line at outer level */
+
+	/* safe_encoding, curline, refline are used by emit() to replace FFs */
+	int			encoding;		/* encoding being used now */
+	bool		safe_encoding;	/* is current encoding "safe"? */
+	const char *curline;		/* actual flex input string for cur buf */
+	const char *refline;		/* original data for cur buffer */
+
+	/*
+	 * All this state lives across successive input lines, until explicitly
+	 * reset by psql_scan_reset.
+	 */
+	int			start_state;	/* saved YY_START */
+	int			paren_depth;	/* depth of nesting in parentheses */
+	int			xcdepth;		/* depth of nesting in slash-star comments */
+	char	   *dolqstart;		/* current $foo$ quote start string */
+} PsqlScanStateData;
+
+static PsqlScanState cur_state;	/* current state while active */
+
+static PQExpBuffer output_buf;	/* current output buffer */
+
+/* these variables do not need to be saved across calls */
+static enum slash_option_type option_type;
+static char *option_quote;
+
+
+/* Return values from yylex() */
+#define LEXRES_EOL			0	/* end of input */
+#define LEXRES_SEMI			1	/* command-terminating semicolon found */
+#define LEXRES_BACKSLASH	2	/* backslash command start */
+#define LEXRES_OK			3	/* OK completion of backslash argument */
+
+
+int	yylex(void);
+
+static void push_new_buffer(const char *newstr, const char *varname);
+static void pop_buffer_stack(PsqlScanState state);
+static bool var_is_current_source(PsqlScanState state, const char *varname);
+static YY_BUFFER_STATE prepare_buffer(const char *txt, int len,
+									  char **txtcopy);
+static void emit(const char *txt, int len);
+static bool is_utf16_surrogate_first(uint32 c);
+static void escape_variable(bool as_ident);
+
+#define ECHO emit(yytext, yyleng)
+
+
+#ifndef YY_EXTRA_TYPE
+#define YY_EXTRA_TYPE void *
+#endif
+struct yy_buffer_state
+{
+	char *base;
+	char *end;
+	char *pos;
+	int at_bol;
+	int owns;
+};
+struct yyguts_t
+{
+	YY_EXTRA_TYPE yyextra_r;
+	YY_BUFFER_STATE cur;
+	char *c_buf_p;
+	char hold_char;
+	int at_bol;
+	int yy_start;
+	char *yytext_r;
+	int yyleng_r;
+};
+char *yytext;
+int yyleng;
+static struct yyguts_t yy_guts_static;
+#define yyg (&yy_guts_static)
+#define BEGIN (yyg->yy_start) =
+#define YY_START (yyg->yy_start)
+#define YYSTATE YY_START
+#define YY_CURRENT_BUFFER (yyg->cur)
+#define yyterminate() return YY_NULL
+#define YY_FATAL_ERROR(msg) yy_fatal_error(msg)
+#define yyless(n) do { int yyless_n = (n); *yyg->c_buf_p = yyg->hold_char; yyg->c_buf_p = yytext + yyless_n; yyleng = yyless_n; yyg->hold_char = *yyg->c_buf_p; *yyg->c_buf_p = 0; } while (0)
+#ifndef ECHO
+#define ECHO do { if (fwrite(yytext, yyleng, 1, stdout)) {} } while (0)
+#endif
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+#define YY_BREAK break;
+#define YY_RULE_SETUP if (yyleng > 0) yyg->at_bol = (yytext[yyleng - 1] == '\n'); YY_USER_ACTION
+void *yyalloc(yy_size_t);
+void *yyrealloc(void *, yy_size_t);
+void yyfree(void *);
+YY_BUFFER_STATE yy_create_buffer(FILE *file, int size);
+void yy_delete_buffer(YY_BUFFER_STATE b);
+void yy_switch_to_buffer(YY_BUFFER_STATE b);
+YY_BUFFER_STATE yy_scan_buffer(char *base, yy_size_t size);
+YY_BUFFER_STATE yy_scan_bytes(const char *bytes, int len);
+YY_BUFFER_STATE yy_scan_string(const char *str);
+void yyrestart(FILE *file);
+int yylex(void);
+static void yy_fatal_error(const char *msg);
+static const unsigned char yy_ec[256] = {0,0,0,0,0,0,0,0,0,1,2,0,1,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,4,5,4,6,7,8,9,10,11,12,13,14,15,16,17,18,18,18,18,18,18,18,18,19,19,20,21,7,22,7,4,4,23,24,25,26,27,26,28,28,28,28,28,28,28,29,28,30,28,28,31,28,32,28,28,33,28,28,14,34,14,7,28,35,23,36,25,26,27,37,28,28,28,28,28,28,28,38,28,30,28,39,31,40,41,28,28,42,28,28,0,43,0,4,0,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44};
+#define YY_NCLASSES 45
+static const short yy_nxt[20025] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,21,22,21,33,42,34,31,33,43,26,27,31,31,32,
+23,24,25,35,35,20,28,31,37,30,37,37,38,37,39,37,37,40,36,29,33,30,37,39,37,37,40,36,33,37,
+45,45,45,45,45,45,45,45,45,44,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,
+45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,47,47,47,47,48,47,47,48,48,47,47,47,46,48,47,
+48,47,49,47,47,47,47,48,47,47,47,47,47,47,47,47,47,47,47,47,48,47,47,47,47,47,47,47,48,47,
+51,51,51,51,51,50,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,53,53,53,53,53,53,53,53,53,52,53,53,53,53,53,
+53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+56,56,57,56,56,56,56,56,56,54,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,
+56,56,56,56,55,56,56,56,56,56,56,56,56,56,56,59,59,59,59,59,59,59,59,59,58,59,59,59,59,59,
+59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+60,60,62,60,60,60,61,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,51,51,51,51,51,63,51,51,51,51,51,51,51,51,51,
+51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+59,59,59,59,59,59,59,59,59,64,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,67,67,66,67,67,67,67,67,67,67,67,67,67,67,67,
+67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,65,67,67,67,67,67,67,67,67,67,67,
+71,68,69,68,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,70,71,71,71,71,71,71,71,71,71,71,77,75,76,75,77,74,77,77,77,78,77,77,77,77,77,
+77,77,77,77,77,72,77,77,77,77,77,77,77,77,77,77,77,77,77,79,80,77,77,77,77,77,77,77,73,77,
+83,83,84,83,83,83,83,83,83,81,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
+83,83,83,83,82,83,83,83,83,83,83,83,83,83,83,87,87,85,87,87,87,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,86,87,87,87,87,87,87,87,87,87,
+88,89,92,89,88,90,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+88,88,88,88,91,88,88,88,88,88,88,88,88,88,88,95,95,93,95,95,94,95,95,95,95,95,95,95,95,95,
+95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,
+98,96,97,96,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,101,101,100,101,101,101,101,101,101,101,101,101,101,101,101,
+101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,99,101,101,101,101,101,101,101,101,101,101,
+0,0,0,0,0,105,0,0,0,102,0,0,0,0,0,0,0,0,106,106,103,0,104,106,106,106,106,106,106,106,
+106,106,106,106,0,0,106,106,106,106,106,106,106,0,0,0,22,22,22,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,22,22,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,0,0,108,108,0,0,0,108,108,0,
+107,0,108,0,0,0,0,108,0,0,0,0,0,0,0,0,0,0,0,0,108,0,0,0,0,0,0,0,108,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,109,0,110,110,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,0,0,108,108,0,0,0,111,108,0,
+108,0,108,0,0,0,0,108,0,0,0,0,0,0,0,0,0,0,0,0,108,0,0,0,0,0,0,0,108,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,112,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,114,0,0,113,0,0,0,0,0,0,0,0,114,114,0,0,0,114,114,114,114,114,114,114,
+114,114,114,114,0,0,114,114,114,114,114,114,114,0,114,0,0,0,0,108,0,0,108,108,0,0,0,108,108,0,
+108,0,108,0,0,0,0,108,0,0,0,0,0,0,0,0,0,0,0,0,108,0,0,0,0,0,0,0,108,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,0,0,108,108,0,0,0,108,108,0,
+108,0,108,0,0,0,0,108,0,0,0,0,0,0,0,0,0,0,0,0,108,0,0,0,0,0,0,0,108,0,
+0,0,0,0,0,0,116,0,0,0,0,0,0,0,0,0,0,0,117,117,0,0,0,115,115,115,115,115,115,115,
+115,115,115,115,0,0,115,115,115,115,115,115,115,0,115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,119,0,118,118,0,0,0,0,0,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,114,0,0,121,0,0,0,0,0,0,0,0,114,114,0,0,0,114,114,114,114,114,114,114,
+114,114,114,114,0,0,114,114,114,114,114,114,114,0,114,0,0,0,0,0,0,114,0,0,0,0,0,0,0,0,
+0,0,0,114,114,0,0,0,114,114,114,114,114,114,114,114,114,114,114,0,0,114,114,114,114,114,114,114,0,114,
+0,0,0,0,0,0,114,0,0,122,0,0,0,0,0,0,0,0,114,114,0,0,0,114,114,114,114,114,114,114,
+114,114,114,114,0,0,114,114,114,114,114,114,114,0,114,0,0,0,0,0,0,114,0,0,123,0,0,0,0,0,
+0,0,0,114,114,0,0,0,114,114,114,114,114,114,114,114,114,114,114,0,0,114,114,114,114,114,114,114,0,114,
+0,0,0,0,0,0,114,0,124,0,0,0,0,0,0,0,0,0,114,114,0,0,0,114,114,114,114,114,114,114,
+114,114,114,114,0,0,114,114,114,114,114,114,114,0,114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,125,126,126,0,0,0,0,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,45,45,45,45,45,45,45,45,0,45,45,45,45,45,
+45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,
+0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,129,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,47,47,47,47,47,47,47,47,47,47,47,0,47,47,
+47,47,0,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,
+47,47,47,47,47,47,47,47,47,47,47,47,0,47,47,47,47,0,47,47,47,47,47,47,47,47,47,47,47,47,
+47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,0,0,0,0,0,0,0,0,0,0,0,0,130,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,51,51,51,51,0,51,51,51,51,51,51,51,51,51,
+51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+0,132,133,133,0,0,0,0,0,0,0,0,0,0,0,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,53,53,53,53,53,53,53,53,0,53,53,53,53,53,
+53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+0,135,136,136,0,0,0,0,0,138,0,0,0,0,0,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,139,139,139,139,139,139,139,139,139,139,139,139,139,139,139,
+139,139,139,143,139,139,139,139,139,139,139,139,139,139,139,139,139,140,139,139,139,139,139,139,139,139,141,142,139,139,
+57,57,57,57,57,57,57,57,57,0,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,
+57,57,57,57,0,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,0,57,57,57,57,57,
+57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,0,57,57,57,57,57,57,57,57,57,57,
+0,135,136,136,0,0,0,0,0,138,0,0,0,0,0,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,59,59,59,59,59,59,59,59,59,0,59,59,59,59,59,
+59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+62,62,62,62,62,62,0,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,
+62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,0,0,0,0,0,0,144,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,145,145,145,145,145,145,145,145,145,145,145,0,0,145,145,145,145,145,145,145,0,145,
+62,62,62,62,62,62,0,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,
+62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,0,146,146,146,0,131,0,0,0,0,0,0,0,0,0,
+147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,148,0,0,0,0,0,0,0,0,148,0,0,0,
+0,150,151,151,0,0,0,0,0,138,0,0,0,0,0,152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,149,0,0,0,0,0,0,0,0,149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,153,0,0,0,0,0,0,0,0,154,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,157,0,0,0,156,0,0,0,0,0,0,0,0,155,155,0,0,0,155,155,155,155,155,155,155,
+155,155,155,155,0,0,155,155,155,155,155,155,155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,76,76,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,76,76,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,158,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+166,166,0,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,164,166,166,166,166,166,166,166,166,166,166,166,
+166,166,166,166,166,166,161,163,159,162,160,166,165,166,166,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,97,97,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,97,97,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,167,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,168,168,0,0,0,168,168,168,168,168,168,168,
+168,168,168,168,0,0,168,168,168,168,168,168,168,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,169,169,0,0,0,169,169,169,169,169,169,169,169,169,169,169,0,0,169,169,169,169,169,169,169,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,106,0,0,0,106,106,106,106,106,106,106,
+106,106,106,106,0,0,106,106,106,106,106,106,106,0,0,170,170,0,0,171,170,170,171,171,170,170,170,171,171,170,
+171,170,171,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,171,170,
+0,0,0,0,108,0,0,108,108,0,0,0,108,108,0,108,0,108,0,0,0,0,108,0,0,0,0,0,0,0,
+0,0,0,0,0,108,0,0,0,0,0,0,0,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,110,110,0,0,0,0,0,0,0,120,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,172,0,0,172,172,0,0,0,172,172,0,
+172,0,172,0,0,0,0,172,0,0,0,0,0,0,0,0,0,0,0,0,172,0,0,0,0,0,0,0,172,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,114,0,0,0,0,0,0,0,0,0,0,0,114,114,0,0,0,114,114,114,114,114,114,114,
+114,114,114,114,0,0,114,114,114,114,114,114,114,0,114,0,0,0,0,0,0,116,0,0,0,0,0,0,0,0,
+0,0,0,173,173,0,0,0,173,173,173,173,173,173,173,173,173,173,173,0,0,173,173,173,173,173,173,173,0,173,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,117,117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,119,0,118,118,0,0,0,0,0,0,0,120,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,175,0,174,174,0,0,0,0,0,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,176,0,176,0,0,177,177,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,179,0,0,0,178,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,125,126,126,0,0,0,0,0,0,0,0,0,0,0,
+127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,180,180,180,0,0,0,0,0,182,0,0,0,0,0,181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+183,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,129,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,184,0,0,184,184,0,0,0,184,184,0,184,0,184,0,0,0,0,184,0,0,0,0,0,0,0,
+0,0,0,0,0,184,0,0,0,0,0,0,0,184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,132,133,133,0,0,0,0,0,0,0,0,0,0,0,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,186,186,186,0,0,0,0,0,185,0,0,0,0,0,
+187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,136,136,0,0,0,0,0,0,0,0,0,0,0,
+137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,189,189,189,0,0,0,0,0,191,0,0,0,0,0,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,193,193,0,0,0,193,193,193,193,193,0,0,
+0,0,0,0,0,0,193,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,194,194,0,0,0,194,194,194,194,194,0,0,0,0,0,0,0,0,194,194,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,195,195,0,0,0,195,195,195,195,195,0,0,
+0,0,0,0,0,0,195,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,0,0,0,0,0,0,0,0,
+0,0,0,197,197,0,0,0,197,197,197,197,197,197,197,197,197,197,197,0,0,197,197,197,197,197,197,197,0,197,
+0,146,146,146,0,0,0,0,0,0,0,0,0,0,0,147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,148,0,0,0,0,0,0,0,0,148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+198,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,199,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,200,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,150,151,151,0,0,0,0,0,0,0,0,0,0,0,152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,149,0,0,0,0,0,0,0,0,149,0,0,0,0,201,201,201,0,0,0,0,0,191,0,0,0,0,0,
+202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,0,0,0,0,0,0,0,0,149,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,204,204,0,0,0,204,204,204,204,204,0,0,0,0,0,0,0,0,204,204,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,205,205,0,0,0,205,205,205,205,205,0,0,
+0,0,0,0,0,0,205,205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,155,155,0,0,0,155,155,155,155,155,155,155,155,155,155,155,0,0,155,155,155,155,155,155,155,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,206,0,0,0,206,206,206,206,206,206,206,
+206,206,206,206,0,0,206,206,206,206,206,206,206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,207,207,0,0,0,207,207,207,207,207,207,207,207,207,207,207,0,0,207,207,207,207,207,207,207,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,209,209,0,0,0,209,209,209,209,209,0,0,0,0,0,0,0,0,209,209,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,210,0,0,0,0,0,0,0,0,168,168,0,0,0,168,168,168,168,168,168,168,
+168,168,168,168,0,0,168,168,168,168,168,168,168,0,0,0,0,0,0,0,211,0,0,0,0,0,0,0,0,0,
+0,0,0,169,169,0,0,0,169,169,169,169,169,169,169,169,169,169,169,0,0,169,169,169,169,169,169,169,0,0,
+170,170,0,0,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,
+170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,0,0,171,170,170,171,171,170,170,170,171,171,170,
+171,170,171,170,170,170,170,171,170,170,170,170,170,170,170,170,170,170,170,170,171,170,170,170,170,170,170,170,171,170,
+0,0,0,0,172,0,0,172,172,0,0,0,172,172,0,172,0,172,0,0,0,0,172,0,0,0,0,0,0,0,
+0,0,0,0,0,172,0,0,0,0,0,0,0,172,0,0,0,0,0,0,0,116,0,0,0,0,0,0,0,0,
+0,0,0,173,173,0,0,0,173,173,173,173,173,173,173,173,173,173,173,0,0,173,173,173,173,173,173,173,0,173,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,174,174,0,0,0,0,0,0,0,120,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,177,177,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,177,177,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,180,180,180,0,0,0,0,0,182,0,0,0,0,0,181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+212,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,213,214,126,126,213,213,213,213,213,213,213,213,213,213,213,
+215,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,
+0,0,0,0,184,0,0,184,184,0,0,0,184,184,0,184,0,184,0,0,0,0,184,0,0,0,0,0,0,0,
+0,0,0,0,0,184,0,0,0,0,0,0,0,184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,186,186,186,0,0,0,0,0,185,0,0,0,0,0,187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+217,218,133,133,217,217,217,217,217,217,217,217,217,217,217,219,217,217,217,217,217,217,217,217,217,217,217,217,217,217,
+217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,0,189,189,189,0,0,0,0,0,191,0,0,0,0,0,
+190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+223,221,136,136,223,223,223,223,223,223,223,223,223,223,223,222,223,223,223,223,223,223,223,223,223,223,223,223,223,223,
+223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,224,224,0,0,0,224,224,224,224,224,0,0,0,0,0,0,0,0,224,224,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,225,225,0,0,0,225,225,225,225,225,0,0,
+0,0,0,0,0,0,225,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,226,226,0,0,0,226,226,226,226,226,0,0,0,0,0,0,0,0,226,226,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,227,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,0,0,0,0,0,0,0,0,
+0,0,0,197,197,0,0,0,197,197,197,197,197,197,197,197,197,197,197,0,0,197,197,197,197,197,197,197,0,197,
+230,228,146,146,230,230,230,230,230,230,230,230,230,230,230,229,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,233,0,0,0,0,0,0,0,0,0,0,0,0,0,0,201,201,201,0,0,0,0,0,191,0,0,0,0,0,
+202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,0,0,0,0,0,0,0,0,149,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,234,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,238,236,151,151,238,238,238,238,238,238,238,238,238,238,238,
+237,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,239,239,0,0,0,239,239,239,239,239,0,0,
+0,0,0,0,0,0,239,239,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,240,240,0,0,0,240,240,240,240,240,0,0,0,0,0,0,0,0,240,240,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,241,0,0,0,0,0,0,0,0,206,206,0,0,0,206,206,206,206,206,206,206,
+206,206,206,206,0,0,206,206,206,206,206,206,206,0,0,0,0,0,0,0,242,0,0,0,0,0,0,0,0,0,
+0,0,0,207,207,0,0,0,207,207,207,207,207,207,207,207,207,207,207,0,0,207,207,207,207,207,207,207,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,244,244,0,0,0,244,244,244,244,244,0,0,0,0,0,0,0,0,244,244,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+245,246,248,248,245,245,245,245,245,245,245,245,245,245,245,247,245,245,245,245,245,245,245,245,245,245,245,245,245,245,
+245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,213,214,126,126,213,213,213,213,213,213,213,213,213,213,213,
+215,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,
+213,214,126,126,213,213,213,213,213,213,213,213,213,213,213,215,213,213,213,213,213,213,213,213,213,213,213,213,213,213,
+213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,214,126,126,213,213,213,213,213,213,213,213,213,213,213,
+249,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,
+250,251,253,253,250,250,250,250,250,250,250,250,250,250,250,252,250,250,250,250,250,250,250,250,250,250,250,250,250,250,
+250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,217,218,133,133,217,217,217,217,217,217,217,217,217,217,217,
+219,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,
+217,218,133,133,217,217,217,217,217,217,217,217,217,217,217,219,217,217,217,217,217,217,217,217,217,217,217,217,217,217,
+217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,218,133,133,217,217,217,217,217,217,217,217,217,217,217,
+254,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,
+258,255,256,256,258,258,258,258,258,258,258,258,258,258,258,257,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,223,221,136,136,223,223,223,223,223,223,223,223,223,223,223,
+222,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,
+223,221,136,136,223,223,223,223,223,223,223,223,223,223,223,259,223,223,223,223,223,223,223,223,223,223,223,223,223,223,
+223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,221,136,136,223,223,223,223,223,223,223,223,223,223,223,
+222,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,260,260,0,0,0,260,260,260,260,260,0,0,
+0,0,0,0,0,0,260,260,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,261,261,0,0,0,261,261,261,261,261,0,0,0,0,0,0,0,0,261,261,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,228,146,146,230,230,230,230,230,230,230,230,230,230,230,229,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,230,228,146,146,230,230,230,230,230,230,230,230,230,230,230,
+262,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,
+230,228,146,146,230,230,230,230,230,230,230,230,230,230,230,229,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,230,228,146,146,230,230,230,230,230,230,230,230,230,230,230,
+229,230,230,230,230,230,230,230,230,230,230,230,263,230,230,230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,264,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,265,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+270,267,268,268,270,270,270,270,270,270,270,270,270,270,270,269,270,270,270,270,270,270,270,270,270,270,270,270,270,270,
+270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,238,236,151,151,238,238,238,238,238,238,238,238,238,238,238,
+237,238,238,238,238,238,238,238,238,238,238,238,271,238,238,238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,
+238,236,151,151,238,238,238,238,238,238,238,238,238,238,238,237,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
+238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,238,236,151,151,238,238,238,238,238,238,238,238,238,238,238,
+272,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,
+238,236,151,151,238,238,238,238,238,238,238,238,238,238,238,237,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
+238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,273,273,0,0,0,273,273,273,273,273,0,0,0,0,0,0,0,0,273,273,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,274,274,0,0,0,274,274,274,274,274,0,0,
+0,0,0,0,0,0,274,274,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,245,246,248,248,245,245,245,245,245,245,245,245,245,245,245,
+247,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,
+245,246,248,248,245,245,245,245,245,245,245,245,245,245,245,247,245,245,245,245,245,245,245,245,245,245,245,245,245,245,
+245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,246,248,248,245,245,245,245,245,245,245,245,245,245,245,
+275,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,
+0,180,180,180,0,0,0,0,0,182,0,0,0,0,0,181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,213,214,126,126,213,213,213,213,213,213,213,213,213,213,213,
+249,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,
+250,251,253,253,250,250,250,250,250,250,250,250,250,250,250,252,250,250,250,250,250,250,250,250,250,250,250,250,250,250,
+250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,251,253,253,250,250,250,250,250,250,250,250,250,250,250,
+252,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,
+250,251,253,253,250,250,250,250,250,250,250,250,250,250,250,276,250,250,250,250,250,250,250,250,250,250,250,250,250,250,
+250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,0,186,186,186,0,0,0,0,0,185,0,0,0,0,0,
+187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+217,218,133,133,217,217,217,217,217,217,217,217,217,217,217,254,217,217,217,217,217,217,217,217,217,217,217,217,217,217,
+217,217,217,217,217,217,217,217,217,217,217,217,217,217,217,258,255,256,256,258,258,258,258,258,258,258,258,258,258,258,
+257,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+0,189,189,189,0,0,0,0,0,191,0,0,0,0,0,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,258,255,256,256,258,258,258,258,258,258,258,258,258,258,258,
+277,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+258,255,256,256,258,258,258,258,258,258,258,258,258,258,258,257,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,223,221,136,136,223,223,223,223,223,223,223,223,223,223,223,
+259,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,223,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,278,278,0,0,0,278,278,278,278,278,0,0,
+0,0,0,0,0,0,278,278,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,279,279,0,0,0,279,279,279,279,279,0,0,0,0,0,0,0,0,279,279,0,0,0,0,0,0,0,
+230,228,146,146,230,230,230,230,230,230,230,230,230,230,230,262,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,230,228,146,146,230,230,230,230,230,230,230,230,230,230,230,
+229,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,280,231,230,230,230,230,230,230,230,230,231,230,230,230,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,281,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,282,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+270,267,268,268,270,270,270,270,270,270,270,270,270,270,270,269,270,270,270,270,270,270,270,270,270,270,270,283,270,270,
+270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,270,267,268,268,270,270,270,270,270,270,270,270,270,270,270,
+269,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,
+0,201,201,201,0,0,0,0,0,191,0,0,0,0,0,202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,149,0,0,0,0,0,0,0,0,149,0,0,0,270,267,268,268,270,270,270,270,270,270,270,270,270,270,270,
+284,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,
+270,267,268,268,270,270,270,270,270,270,270,270,270,270,270,269,270,270,270,270,270,270,270,270,270,270,270,270,270,270,
+270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,238,236,151,151,238,238,238,238,238,238,238,238,238,238,238,
+237,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,285,235,238,238,238,238,238,238,238,238,235,238,238,238,
+238,236,151,151,238,238,238,238,238,238,238,238,238,238,238,272,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
+238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,286,286,0,0,0,286,286,286,286,286,0,0,0,0,0,0,0,0,286,286,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,287,287,0,0,0,287,287,287,287,287,0,0,
+0,0,0,0,0,0,287,287,0,0,0,0,0,0,0,245,246,248,248,245,245,245,245,245,245,245,245,245,245,245,
+275,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,
+250,251,253,253,250,250,250,250,250,250,250,250,250,250,250,276,250,250,250,250,250,250,250,250,250,250,250,250,250,250,
+250,250,250,250,250,250,250,250,250,250,250,250,250,250,250,258,255,256,256,258,258,258,258,258,258,258,258,258,258,258,
+277,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,258,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,288,288,0,0,0,288,288,288,288,288,0,0,
+0,0,0,0,0,0,288,288,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,228,146,146,230,230,230,230,230,230,230,230,230,230,230,229,230,230,230,230,230,230,230,230,230,289,230,230,230,230,
+230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,290,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+291,0,0,0,0,0,0,0,0,0,0,0,0,0,0,270,267,268,268,270,270,270,270,270,270,270,270,270,270,270,
+269,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,292,266,270,270,270,270,270,270,270,270,266,270,270,270,
+270,267,268,268,270,270,270,270,270,270,270,270,270,270,270,284,270,270,270,270,270,270,270,270,270,270,270,270,270,270,
+270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,238,236,151,151,238,238,238,238,238,238,238,238,238,238,238,
+237,238,238,238,238,238,238,238,238,238,293,238,238,238,238,238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,294,294,0,0,0,294,294,294,294,294,0,0,
+0,0,0,0,0,0,294,294,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,295,295,0,0,0,295,295,295,295,295,0,0,
+0,0,0,0,0,0,295,295,0,0,0,0,0,0,0,230,228,146,146,230,230,230,230,230,230,230,230,230,230,230,
+229,230,230,230,230,230,230,230,296,230,230,230,230,230,230,230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,297,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,298,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+270,267,268,268,270,270,270,270,270,270,270,270,270,270,270,269,270,270,270,270,270,270,270,270,270,299,270,270,270,270,
+270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,238,236,151,151,238,238,238,238,238,238,238,238,238,238,238,
+237,238,238,238,238,238,238,238,300,238,238,238,238,238,238,238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,301,301,0,0,0,301,301,301,301,301,0,0,
+0,0,0,0,0,0,301,301,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,302,302,0,0,0,302,302,302,302,302,0,0,0,0,0,0,0,0,302,302,0,0,0,0,0,0,0,
+230,228,146,146,230,230,230,230,230,230,230,230,230,230,230,229,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+303,230,231,230,230,230,230,230,230,230,230,231,230,230,230,0,304,304,304,0,0,0,0,0,306,0,0,0,0,0,
+305,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,308,308,308,0,0,0,0,0,307,0,0,0,0,0,309,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,270,267,268,268,270,270,270,270,270,270,270,270,270,270,270,
+269,270,270,270,270,270,270,270,310,270,270,270,270,270,270,270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,
+238,236,151,151,238,238,238,238,238,238,238,238,238,238,238,237,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
+311,238,235,238,238,238,238,238,238,238,238,235,238,238,238,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,312,312,0,0,0,312,312,312,312,312,0,0,0,0,0,0,0,0,312,312,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,313,313,0,0,0,313,313,313,313,313,0,0,
+0,0,0,0,0,0,313,313,0,0,0,0,0,0,0,230,228,146,146,230,230,230,230,230,230,230,230,230,230,230,
+229,230,230,230,230,230,230,230,230,230,230,230,314,230,230,230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,
+0,304,304,304,0,0,0,0,0,306,0,0,0,0,0,305,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+315,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+316,316,316,316,316,316,316,316,316,0,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,
+316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,317,317,317,317,317,317,317,317,317,0,317,317,317,317,317,
+317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,
+0,308,308,308,0,0,0,0,0,307,0,0,0,0,0,309,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+318,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+270,267,268,268,270,270,270,270,270,270,270,270,270,270,270,269,270,270,270,270,270,270,270,270,270,270,270,270,270,270,
+319,270,266,270,270,270,270,270,270,270,270,266,270,270,270,238,236,151,151,238,238,238,238,238,238,238,238,238,238,238,
+237,238,238,238,238,238,238,238,238,238,238,238,320,238,238,238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,321,321,0,0,0,321,321,321,321,321,0,0,
+0,0,0,0,0,0,321,321,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,322,323,323,230,230,230,230,230,325,230,230,230,230,230,324,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,328,326,304,304,328,328,328,328,328,329,328,328,328,328,328,
+327,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,
+0,0,0,0,0,0,0,0,0,330,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,331,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+332,333,308,308,332,332,332,332,332,334,332,332,332,332,332,335,332,332,332,332,332,332,332,332,332,332,332,332,332,332,
+332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,270,267,268,268,270,270,270,270,270,270,270,270,270,270,270,
+269,270,270,270,270,270,270,270,270,270,270,270,336,270,270,270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,
+238,337,338,338,238,238,238,238,238,340,238,238,238,238,238,339,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
+238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,322,323,323,230,230,230,230,230,325,230,230,230,230,230,324,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,0,323,323,323,0,0,0,0,0,306,0,0,0,0,0,
+341,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,148,0,0,0,0,0,0,0,0,148,0,0,0,
+230,228,146,146,230,230,230,230,230,230,230,230,230,230,230,342,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,346,343,344,344,346,346,346,346,346,230,346,346,346,346,346,
+345,346,346,346,346,346,346,346,346,346,346,346,346,346,346,346,346,347,346,346,346,346,346,346,346,346,347,346,346,346,
+328,326,304,304,328,328,328,328,328,329,328,328,328,328,328,327,328,328,328,328,328,328,328,328,328,328,328,328,328,328,
+328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,326,304,304,328,328,328,328,328,329,328,328,328,328,328,
+348,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,
+328,326,304,304,328,328,328,328,328,329,328,328,328,328,328,327,328,328,328,328,328,328,328,328,328,328,328,328,328,328,
+328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,352,349,350,350,352,352,352,352,352,329,352,352,352,352,352,
+351,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+332,333,308,308,332,332,332,332,332,334,332,332,332,332,332,335,332,332,332,332,332,332,332,332,332,332,332,332,332,332,
+332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,333,308,308,332,332,332,332,332,334,332,332,332,332,332,
+335,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,
+353,354,355,355,353,353,353,353,353,334,353,353,353,353,353,356,353,353,353,353,353,353,353,353,353,353,353,353,353,353,
+353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,332,333,308,308,332,332,332,332,332,334,332,332,332,332,332,
+357,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,
+270,358,359,359,270,270,270,270,270,361,270,270,270,270,270,360,270,270,270,270,270,270,270,270,270,270,270,270,270,270,
+270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,238,337,338,338,238,238,238,238,238,340,238,238,238,238,238,
+339,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,
+0,362,362,362,0,0,0,0,0,364,0,0,0,0,0,363,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,149,0,0,0,0,0,0,0,0,149,0,0,0,238,236,151,151,238,238,238,238,238,238,238,238,238,238,238,
+365,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,
+366,367,368,368,366,366,366,366,366,238,366,366,366,366,366,369,366,366,366,366,366,366,366,366,366,366,366,366,366,366,
+366,366,370,366,366,366,366,366,366,366,366,370,366,366,366,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+371,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+374,372,323,323,374,374,374,374,374,375,374,374,374,374,374,373,374,374,374,374,374,374,374,374,374,374,374,374,374,374,
+374,374,376,374,374,374,374,374,374,374,374,376,374,374,374,230,228,146,146,230,230,230,230,230,377,230,230,230,230,230,
+229,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,
+0,146,146,146,0,0,0,0,0,330,0,0,0,0,0,147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,148,0,0,0,0,0,0,0,0,148,0,0,0,230,228,146,146,230,230,230,230,230,377,230,230,230,230,230,
+262,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,
+230,228,146,146,230,230,230,230,230,377,230,230,230,230,230,229,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,230,228,146,146,230,230,230,230,230,377,230,230,230,230,230,
+229,230,230,230,230,230,230,230,230,230,230,230,263,230,230,230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,
+328,326,304,304,328,328,328,328,328,329,328,328,328,328,328,348,328,328,328,328,328,328,328,328,328,328,328,328,328,328,
+328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,326,304,304,328,328,328,328,328,378,328,328,328,328,328,
+327,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,
+0,304,304,304,0,0,0,0,0,379,0,0,0,0,0,305,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,328,326,304,304,328,328,328,328,328,378,328,328,328,328,328,
+348,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,
+328,326,304,304,328,328,328,328,328,378,328,328,328,328,328,327,328,328,328,328,328,328,328,328,328,328,328,328,328,328,
+328,328,328,328,328,328,328,328,328,328,328,328,328,328,328,332,333,308,308,332,332,332,332,332,380,332,332,332,332,332,
+335,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,
+332,333,308,308,332,332,332,332,332,380,332,332,332,332,332,335,332,332,332,332,332,332,332,332,332,332,332,332,332,332,
+332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,0,308,308,308,0,0,0,0,0,381,0,0,0,0,0,
+309,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+332,333,308,308,332,332,332,332,332,380,332,332,332,332,332,357,332,332,332,332,332,332,332,332,332,332,332,332,332,332,
+332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,333,308,308,332,332,332,332,332,334,332,332,332,332,332,
+357,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,
+270,358,359,359,270,270,270,270,270,361,270,270,270,270,270,360,270,270,270,270,270,270,270,270,270,270,270,270,270,270,
+270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,0,362,362,362,0,0,0,0,0,364,0,0,0,0,0,
+363,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,0,0,0,0,0,0,0,0,149,0,0,0,
+270,267,268,268,270,270,270,270,270,270,270,270,270,270,270,382,270,270,270,270,270,270,270,270,270,270,270,270,270,270,
+270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,383,384,385,385,383,383,383,383,383,270,383,383,383,383,383,
+386,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,383,387,383,383,383,383,383,383,383,383,387,383,383,383,
+0,362,362,362,0,0,0,0,0,364,0,0,0,0,0,363,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,149,0,0,0,0,0,0,0,0,149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+388,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+317,317,317,317,317,317,317,317,317,0,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,
+317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,391,389,338,338,391,391,391,391,391,392,391,391,391,391,391,
+390,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,393,391,391,391,391,391,391,391,391,393,391,391,391,
+238,236,151,151,238,238,238,238,238,394,238,238,238,238,238,237,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
+238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,238,236,151,151,238,238,238,238,238,394,238,238,238,238,238,
+237,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,
+0,201,201,201,0,0,0,0,0,395,0,0,0,0,0,202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,149,0,0,0,0,0,0,0,0,149,0,0,0,238,236,151,151,238,238,238,238,238,394,238,238,238,238,238,
+272,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,
+238,236,151,151,238,238,238,238,238,394,238,238,238,238,238,237,238,238,238,238,238,238,238,238,238,238,238,271,238,238,
+238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,374,372,323,323,374,374,374,374,374,375,374,374,374,374,374,
+396,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,376,374,374,374,374,374,374,374,374,376,374,374,374,
+374,372,323,323,374,374,374,374,374,375,374,374,374,374,374,396,374,374,374,374,374,374,374,374,374,374,374,374,374,374,
+374,374,376,374,374,374,374,374,374,374,374,376,374,374,374,374,372,323,323,374,374,374,374,374,375,374,374,374,374,374,
+397,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,376,374,374,374,374,374,374,374,374,376,374,374,374,
+374,372,323,323,374,374,374,374,374,375,374,374,374,374,374,396,374,374,374,374,374,374,374,374,374,374,374,374,374,374,
+374,374,376,374,374,374,374,374,374,374,374,376,374,374,374,401,398,399,399,401,401,401,401,401,375,401,401,401,401,401,
+400,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,402,401,401,401,401,401,401,401,401,402,401,401,401,
+374,372,323,323,374,374,374,374,374,375,374,374,374,374,374,396,374,374,374,374,374,374,374,374,374,374,374,403,374,374,
+374,374,376,374,374,374,374,374,374,374,374,376,374,374,374,230,228,146,146,230,230,230,230,230,230,230,230,230,230,230,
+229,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,231,230,230,230,230,230,230,230,230,231,230,230,230,
+352,349,350,350,352,352,352,352,352,329,352,352,352,352,352,351,352,352,352,352,352,352,352,352,352,352,352,352,352,352,
+352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,316,316,316,316,316,316,316,316,316,0,316,316,316,316,316,
+316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,316,
+353,354,355,355,353,353,353,353,353,334,353,353,353,353,353,356,353,353,353,353,353,353,353,353,353,353,353,353,353,353,
+353,353,353,353,353,353,353,353,353,353,353,353,353,353,353,317,317,317,317,317,317,317,317,317,0,317,317,317,317,317,
+317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,
+406,404,359,359,406,406,406,406,406,407,406,406,406,406,406,405,406,406,406,406,406,406,406,406,406,406,406,406,406,406,
+406,406,408,406,406,406,406,406,406,406,406,408,406,406,406,270,267,268,268,270,270,270,270,270,409,270,270,270,270,270,
+269,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,
+270,267,268,268,270,270,270,270,270,409,270,270,270,270,270,269,270,270,270,270,270,270,270,270,270,270,270,270,270,270,
+270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,0,201,201,201,0,0,0,0,0,395,0,0,0,0,0,
+202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,0,0,0,0,0,0,0,0,149,0,0,0,
+270,267,268,268,270,270,270,270,270,409,270,270,270,270,270,284,270,270,270,270,270,270,270,270,270,270,270,270,270,270,
+270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,270,267,268,268,270,270,270,270,270,409,270,270,270,270,270,
+269,270,270,270,270,270,270,270,270,270,270,270,283,270,270,270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,
+406,404,359,359,406,406,406,406,406,407,406,406,406,406,406,410,406,406,406,406,406,406,406,406,406,406,406,406,406,406,
+406,406,408,406,406,406,406,406,406,406,406,408,406,406,406,391,389,338,338,391,391,391,391,391,392,391,391,391,391,391,
+411,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,393,391,391,391,391,391,391,391,391,393,391,391,391,
+391,389,338,338,391,391,391,391,391,392,391,391,391,391,391,412,391,391,391,391,391,391,391,391,391,391,391,391,391,391,
+391,391,393,391,391,391,391,391,391,391,391,393,391,391,391,391,389,338,338,391,391,391,391,391,392,391,391,391,391,391,
+411,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,393,391,391,391,391,391,391,391,391,393,391,391,391,
+413,414,415,415,413,413,413,413,413,392,413,413,413,413,413,416,413,413,413,413,413,413,413,413,413,413,413,413,413,413,
+413,413,417,413,413,413,413,413,413,413,413,417,413,413,413,391,389,338,338,391,391,391,391,391,392,391,391,391,391,391,
+411,391,391,391,391,391,391,391,391,391,391,391,418,391,391,391,391,393,391,391,391,391,391,391,391,391,393,391,391,391,
+238,236,151,151,238,238,238,238,238,238,238,238,238,238,238,237,238,238,238,238,238,238,238,238,238,238,238,238,238,238,
+238,238,235,238,238,238,238,238,238,238,238,235,238,238,238,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+374,372,323,323,374,374,374,374,374,375,374,374,374,374,374,397,374,374,374,374,374,374,374,374,374,374,374,374,374,374,
+374,374,376,374,374,374,374,374,374,374,374,376,374,374,374,374,372,323,323,374,374,374,374,374,375,374,374,374,374,374,
+397,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,376,374,374,374,374,374,374,374,374,376,374,374,374,
+374,372,323,323,374,374,374,374,374,419,374,374,374,374,374,396,374,374,374,374,374,374,374,374,374,374,374,374,374,374,
+374,374,376,374,374,374,374,374,374,374,374,376,374,374,374,0,323,323,323,0,0,0,0,0,379,0,0,0,0,0,
+341,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,148,0,0,0,0,0,0,0,0,148,0,0,0,
+374,372,323,323,374,374,374,374,374,419,374,374,374,374,374,397,374,374,374,374,374,374,374,374,374,374,374,374,374,374,
+374,374,376,374,374,374,374,374,374,374,374,376,374,374,374,374,372,323,323,374,374,374,374,374,419,374,374,374,374,374,
+396,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,376,374,374,374,374,374,374,374,374,376,374,374,374,
+374,372,323,323,374,374,374,374,374,419,374,374,374,374,374,396,374,374,374,374,374,374,374,374,374,374,374,403,374,374,
+374,374,376,374,374,374,374,374,374,374,374,376,374,374,374,374,372,323,323,374,374,374,374,374,375,374,374,374,374,374,
+396,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,420,376,374,374,374,374,374,374,374,374,376,374,374,374,
+406,404,359,359,406,406,406,406,406,407,406,406,406,406,406,410,406,406,406,406,406,406,406,406,406,406,406,406,406,406,
+406,406,408,406,406,406,406,406,406,406,406,408,406,406,406,406,404,359,359,406,406,406,406,406,407,406,406,406,406,406,
+421,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,408,406,406,406,406,406,406,406,406,408,406,406,406,
+406,404,359,359,406,406,406,406,406,407,406,406,406,406,406,410,406,406,406,406,406,406,406,406,406,406,406,406,406,406,
+406,406,408,406,406,406,406,406,406,406,406,408,406,406,406,422,423,424,424,422,422,422,422,422,407,422,422,422,422,422,
+425,422,422,422,422,422,422,422,422,422,422,422,422,422,422,422,422,426,422,422,422,422,422,422,422,422,426,422,422,422,
+406,404,359,359,406,406,406,406,406,407,406,406,406,406,406,410,406,406,406,406,406,406,406,406,406,406,406,427,406,406,
+406,406,408,406,406,406,406,406,406,406,406,408,406,406,406,270,267,268,268,270,270,270,270,270,270,270,270,270,270,270,
+269,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,266,270,270,270,270,270,270,270,270,266,270,270,270,
+406,404,359,359,406,406,406,406,406,407,406,406,406,406,406,421,406,406,406,406,406,406,406,406,406,406,406,406,406,406,
+406,406,408,406,406,406,406,406,406,406,406,408,406,406,406,391,389,338,338,391,391,391,391,391,392,391,391,391,391,391,
+412,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,393,391,391,391,391,391,391,391,391,393,391,391,391,
+391,389,338,338,391,391,391,391,391,392,391,391,391,391,391,412,391,391,391,391,391,391,391,391,391,391,391,391,391,391,
+391,391,393,391,391,391,391,391,391,391,391,393,391,391,391,391,389,338,338,391,391,391,391,391,428,391,391,391,391,391,
+411,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,393,391,391,391,391,391,391,391,391,393,391,391,391,
+391,389,338,338,391,391,391,391,391,428,391,391,391,391,391,411,391,391,391,391,391,391,391,391,391,391,391,391,391,391,
+391,391,393,391,391,391,391,391,391,391,391,393,391,391,391,0,362,362,362,0,0,0,0,0,429,0,0,0,0,0,
+363,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,0,0,0,0,0,0,0,0,149,0,0,0,
+391,389,338,338,391,391,391,391,391,428,391,391,391,391,391,412,391,391,391,391,391,391,391,391,391,391,391,391,391,391,
+391,391,393,391,391,391,391,391,391,391,391,393,391,391,391,391,389,338,338,391,391,391,391,391,428,391,391,391,391,391,
+411,391,391,391,391,391,391,391,391,391,391,391,418,391,391,391,391,393,391,391,391,391,391,391,391,391,393,391,391,391,
+391,389,338,338,391,391,391,391,391,392,391,391,391,391,391,411,391,391,391,391,391,391,391,391,391,391,391,391,391,391,
+391,430,393,391,391,391,391,391,391,391,391,393,391,391,391,401,398,399,399,401,401,401,401,401,375,401,401,401,401,401,
+400,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,401,402,401,401,401,401,401,401,401,401,402,401,401,401,
+374,372,323,323,374,374,374,374,374,375,374,374,374,374,374,396,374,374,374,374,374,374,374,374,374,431,374,374,374,374,
+374,374,376,374,374,374,374,374,374,374,374,376,374,374,374,406,404,359,359,406,406,406,406,406,407,406,406,406,406,406,
+421,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,408,406,406,406,406,406,406,406,406,408,406,406,406,
+406,404,359,359,406,406,406,406,406,432,406,406,406,406,406,410,406,406,406,406,406,406,406,406,406,406,406,406,406,406,
+406,406,408,406,406,406,406,406,406,406,406,408,406,406,406,406,404,359,359,406,406,406,406,406,432,406,406,406,406,406,
+410,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,408,406,406,406,406,406,406,406,406,408,406,406,406,
+0,362,362,362,0,0,0,0,0,429,0,0,0,0,0,363,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,149,0,0,0,0,0,0,0,0,149,0,0,0,406,404,359,359,406,406,406,406,406,432,406,406,406,406,406,
+421,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,408,406,406,406,406,406,406,406,406,408,406,406,406,
+406,404,359,359,406,406,406,406,406,432,406,406,406,406,406,410,406,406,406,406,406,406,406,406,406,406,406,427,406,406,
+406,406,408,406,406,406,406,406,406,406,406,408,406,406,406,406,404,359,359,406,406,406,406,406,407,406,406,406,406,406,
+410,406,406,406,406,406,406,406,406,406,406,406,406,406,406,406,433,408,406,406,406,406,406,406,406,406,408,406,406,406,
+413,414,415,415,413,413,413,413,413,392,413,413,413,413,413,416,413,413,413,413,413,413,413,413,413,413,413,413,413,413,
+413,413,417,413,413,413,413,413,413,413,413,417,413,413,413,317,317,317,317,317,317,317,317,317,0,317,317,317,317,317,
+317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,317,
+391,389,338,338,391,391,391,391,391,392,391,391,391,391,391,411,391,391,391,391,391,391,391,391,391,434,391,391,391,391,
+391,391,393,391,391,391,391,391,391,391,391,393,391,391,391,374,372,323,323,374,374,374,374,374,375,374,374,374,374,374,
+396,374,374,374,374,374,374,374,435,374,374,374,374,374,374,374,374,376,374,374,374,374,374,374,374,374,376,374,374,374,
+422,423,424,424,422,422,422,422,422,407,422,422,422,422,422,425,422,422,422,422,422,422,422,422,422,422,422,422,422,422,
+422,422,426,422,422,422,422,422,422,422,422,426,422,422,422,406,404,359,359,406,406,406,406,406,407,406,406,406,406,406,
+410,406,406,406,406,406,406,406,406,406,436,406,406,406,406,406,406,408,406,406,406,406,406,406,406,406,408,406,406,406,
+391,389,338,338,391,391,391,391,391,392,391,391,391,391,391,411,391,391,391,391,391,391,391,437,391,391,391,391,391,391,
+391,391,393,391,391,391,391,391,391,391,391,393,391,391,391,374,372,323,323,374,374,374,374,374,375,374,374,374,374,374,
+396,374,374,374,374,374,374,374,374,374,374,374,374,374,374,438,374,376,374,374,374,374,374,374,374,374,376,374,374,374,
+406,404,359,359,406,406,406,406,406,407,406,406,406,406,406,410,406,406,406,406,406,406,406,439,406,406,406,406,406,406,
+406,406,408,406,406,406,406,406,406,406,406,408,406,406,406,391,389,338,338,391,391,391,391,391,392,391,391,391,391,391,
+411,391,391,391,391,391,391,391,391,391,391,391,391,391,391,440,391,393,391,391,391,391,391,391,391,391,393,391,391,391,
+374,372,323,323,374,374,374,374,374,375,374,374,374,374,374,396,374,374,374,374,374,374,374,374,374,374,374,441,374,374,
+374,374,376,374,374,374,374,374,374,374,374,376,374,374,374,406,404,359,359,406,406,406,406,406,407,406,406,406,406,406,
+410,406,406,406,406,406,406,406,406,406,406,406,406,406,406,442,406,408,406,406,406,406,406,406,406,406,408,406,406,406,
+391,389,338,338,391,391,391,391,391,392,391,391,391,391,391,411,391,391,391,391,391,391,391,391,391,391,391,443,391,391,
+391,391,393,391,391,391,391,391,391,391,391,393,391,391,391,374,372,323,323,374,374,374,374,374,375,374,374,374,374,374,
+396,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,374,376,374,374,374,374,374,374,374,374,376,374,374,374,
+406,404,359,359,406,406,406,406,406,407,406,406,406,406,406,410,406,406,406,406,406,406,406,406,406,406,406,444,406,406,
+406,406,408,406,406,406,406,406,406,406,406,408,406,406,406,391,389,338,338,391,391,391,391,391,392,391,391,391,391,391,
+411,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,393,391,391,391,391,391,391,391,391,393,391,391,391,
+406,404,359,359,406,406,406,406,406,407,406,406,406,406,406,410,406,406,406,406,406,406,406,406,406,406,406,406,406,406,
+406,406,408,406,406,406,406,406,406,406,406,408,406,406,406,
+};
+static const short yy_acc[445] = {0,0,12,0,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,1,1,64,64,64,56,57,58,60,73,64,64,65,74,67,73,73,73,73,73,74,45,19,9,12,6,5,5,6,47,51,16,11,22,38,28,28,22,27,42,44,42,48,24,31,32,31,75,75,75,76,81,84,85,77,77,86,79,78,80,87,97,97,97,99,98,99,103,100,102,101,100,105,104,105,106,106,107,109,109,109,0,53,55,0,61,1,65,54,68,2,59,8,73,40,39,66,67,68,71,15,20,18,52,9,9,10,7,4,3,50,16,16,17,22,22,23,26,34,33,33,34,35,41,43,48,48,48,24,24,24,24,33,33,81,0,0,88,89,90,91,92,93,94,96,96,108,0,0,1,1,2,40,68,69,72,70,21,46,9,10,14,9,3,13,16,17,16,22,23,37,22,33,33,36,35,43,48,48,24,24,24,24,33,33,0,0,94,95,62,63,9,9,9,9,16,16,16,16,22,22,22,22,33,33,36,35,48,48,48,48,48,24,24,24,24,24,24,33,33,82,83,94,95,9,9,9,9,9,16,16,16,16,16,22,22,22,22,22,33,33,48,48,48,24,24,24,24,24,24,24,24,33,33,9,16,22,33,29,48,48,24,24,24,24,33,30,33,48,48,24,24,24,33,33,48,48,24,24,24,33,33,48,48,48,48,24,24,24,24,24,33,29,48,48,48,24,24,24,24,30,48,48,48,48,48,48,48,48,49,25,24,24,24,24,24,24,24,24,24,48,48,48,48,48,48,48,48,48,48,48,48,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,48,48,48,48,48,48,48,48,48,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,25,48,48,48,48,48,48,48,48,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,48,48,24,24,24,24,24,24,24,24,24,24,48,24,24,24,48,24,24,48,24,24,48,24,24,24};
+static const short yy_starts[38] = {1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13,14,14,15,15,16,16,17,17,18,18,19,19};
+int yylex(void)
+{
+	char *yy_cp, *yy_bp, *yy_end, *yy_last;
+	int yy_state, yy_rule;
+	if (yyg->cur == NULL)
+		YY_FATAL_ERROR("no input buffer");
+	for (;;)
+	{
+		*yyg->c_buf_p = yyg->hold_char;
+		yy_cp = yy_bp = yyg->c_buf_p;
+		yy_end = yyg->cur->end;
+		if (yy_cp >= yy_end)
+		{
+			yytext = yy_cp;
+			yyleng = 0;
+			switch (YY_START)
+			{
+				case INITIAL:
+				case xb:
+				case xc:
+				case xd:
+				case xh:
+				case xe:
+				case xq:
+				case xdolq:
+				case xui:
+				case xus:
+				case xeu:
+				case xslashcmd:
+				case xslasharg:
+				case xslashquote:
+				case xslashbackquote:
+				case xslashdefaultarg:
+				case xslashquotedarg:
+				case xslashwholeline:
+				case xslashend:
+{
+{
+					StackElem  *stackelem = cur_state->buffer_stack;
+
+					if (stackelem == NULL)
+						return LEXRES_EOL; /* end of input reached */
+
+					/*
+					 * We were expanding a variable, so pop the inclusion
+					 * stack and keep lexing
+					 */
+					pop_buffer_stack(cur_state);
+
+					stackelem = cur_state->buffer_stack;
+					if (stackelem != NULL)
+					{
+						yy_switch_to_buffer(stackelem->buf);
+						cur_state->curline = stackelem->bufstring;
+						cur_state->refline = stackelem->origstring ? stackelem->origstring : stackelem->bufstring;
+					}
+					else
+					{
+						yy_switch_to_buffer(cur_state->scanbufhandle);
+						cur_state->curline = cur_state->scanbuf;
+						cur_state->refline = cur_state->scanline;
+					}
+				}
+}
+				break;
+				default:
+					yyterminate();
+			}
+			continue;
+		}
+		yy_state = yy_starts[YY_START * 2 + (yyg->at_bol ? 1 : 0)];
+		yy_rule = 0;
+		yy_last = yy_cp;
+		while (yy_cp < yy_end)
+		{
+			yy_state = yy_nxt[yy_state * YY_NCLASSES + yy_ec[(unsigned char) *yy_cp]];
+			if (yy_state == 0)
+				break;
+			yy_cp++;
+			if (yy_acc[yy_state])
+			{
+				yy_rule = yy_acc[yy_state];
+				yy_last = yy_cp;
+			}
+		}
+		if (yy_rule == 0)
+			YY_FATAL_ERROR("flex scanner jammed");
+		yy_cp = yy_last;
+		yytext = yy_bp;
+		yyleng = (int) (yy_cp - yy_bp);
+		yyg->hold_char = *yy_cp;
+		*yy_cp = 0;
+		yyg->c_buf_p = yy_cp;
+		switch (yy_rule)
+		{
+case 1:
+YY_RULE_SETUP
+{
+{
+					/*
+					 * Note that the whitespace rule includes both true
+					 * whitespace and single-line ("--" style) comments.
+					 * We suppress whitespace at the start of the query
+					 * buffer.  We also suppress all single-line comments,
+					 * which is pretty dubious but is the historical
+					 * behavior.
+					 */
+					if (!(output_buf->len == 0 || yytext[0] == '-'))
+						ECHO;
+				}
+}
+	YY_BREAK
+case 2:
+YY_RULE_SETUP
+{
+{
+					cur_state->xcdepth = 0;
+					BEGIN(xc);
+					/* Put back any characters past slash-star; see above */
+					yyless(2);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 3:
+YY_RULE_SETUP
+{
+{
+					cur_state->xcdepth++;
+					/* Put back any characters past slash-star; see above */
+					yyless(2);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 4:
+YY_RULE_SETUP
+{
+{
+					if (cur_state->xcdepth <= 0)
+					{
+						BEGIN(INITIAL);
+					}
+					else
+						cur_state->xcdepth--;
+					ECHO;
+				}
+}
+	YY_BREAK
+case 5:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 6:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 7:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 8:
+YY_RULE_SETUP
+{
+{
+					BEGIN(xb);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 9:
+case 10:
+YY_RULE_SETUP
+{
+{
+					yyless(1);
+					BEGIN(INITIAL);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 11:
+case 12:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 13:
+case 14:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 15:
+YY_RULE_SETUP
+{
+{
+					/* Hexadecimal bit type.
+					 * At some point we should simply pass the string
+					 * forward to the parser and label it there.
+					 * In the meantime, place a leading "x" on the string
+					 * to mark it for the input routine as a hex string.
+					 */
+					BEGIN(xh);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 16:
+case 17:
+YY_RULE_SETUP
+{
+{
+					yyless(1);
+					BEGIN(INITIAL);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 18:
+YY_RULE_SETUP
+{
+{
+					yyless(1);				/* eat only 'n' this time */
+					ECHO;
+				}
+}
+	YY_BREAK
+case 19:
+YY_RULE_SETUP
+{
+{
+					if (standard_strings())
+						BEGIN(xq);
+					else
+						BEGIN(xe);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 20:
+YY_RULE_SETUP
+{
+{
+					BEGIN(xe);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 21:
+YY_RULE_SETUP
+{
+{
+					BEGIN(xus);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 22:
+case 23:
+YY_RULE_SETUP
+{
+{
+					yyless(1);
+					BEGIN(INITIAL);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 24:
+YY_RULE_SETUP
+{
+{
+					yyless(1);
+					BEGIN(INITIAL);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 25:
+YY_RULE_SETUP
+{
+{
+					BEGIN(INITIAL);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 26:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 27:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 28:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 29:
+YY_RULE_SETUP
+{
+{
+					uint32 c = strtoul(yytext+2, NULL, 16);
+
+					if (is_utf16_surrogate_first(c))
+						BEGIN(xeu);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 30:
+YY_RULE_SETUP
+{
+{
+					BEGIN(xe);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 31:
+YY_RULE_SETUP
+{
+{ ECHO; }
+}
+	YY_BREAK
+case 32:
+YY_RULE_SETUP
+{
+{ ECHO; }
+}
+	YY_BREAK
+case 33:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 34:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 35:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 36:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 37:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 38:
+YY_RULE_SETUP
+{
+{
+					/* This is only needed for \ just before EOF */
+					ECHO;
+				}
+}
+	YY_BREAK
+case 39:
+YY_RULE_SETUP
+{
+{
+					cur_state->dolqstart = pg_strdup(yytext);
+					BEGIN(xdolq);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 40:
+YY_RULE_SETUP
+{
+{
+					/* throw back all but the initial "$" */
+					yyless(1);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 41:
+YY_RULE_SETUP
+{
+{
+					if (strcmp(yytext, cur_state->dolqstart) == 0)
+					{
+						free(cur_state->dolqstart);
+						cur_state->dolqstart = NULL;
+						BEGIN(INITIAL);
+					}
+					else
+					{
+						/*
+						 * When we fail to match $...$ to dolqstart, transfer
+						 * the $... part to the output, but put back the final
+						 * $ for rescanning.  Consider $delim$...$junk$delim$
+						 */
+						yyless(yyleng-1);
+					}
+					ECHO;
+				}
+}
+	YY_BREAK
+case 42:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 43:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 44:
+YY_RULE_SETUP
+{
+{
+					/* This is only needed for $ inside the quoted text */
+					ECHO;
+				}
+}
+	YY_BREAK
+case 45:
+YY_RULE_SETUP
+{
+{
+					BEGIN(xd);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 46:
+YY_RULE_SETUP
+{
+{
+					BEGIN(xui);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 47:
+YY_RULE_SETUP
+{
+{
+					BEGIN(INITIAL);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 48:
+YY_RULE_SETUP
+{
+{
+					yyless(1);
+					BEGIN(INITIAL);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 49:
+YY_RULE_SETUP
+{
+{
+					BEGIN(INITIAL);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 50:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 51:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 52:
+YY_RULE_SETUP
+{
+{
+					/* throw back all but the initial u/U */
+					yyless(1);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 53:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 54:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 55:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 56:
+YY_RULE_SETUP
+{
+{
+					cur_state->paren_depth++;
+					ECHO;
+				}
+}
+	YY_BREAK
+case 57:
+YY_RULE_SETUP
+{
+{
+					if (cur_state->paren_depth > 0)
+						cur_state->paren_depth--;
+					ECHO;
+				}
+}
+	YY_BREAK
+case 58:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+					if (cur_state->paren_depth == 0)
+					{
+						/* Terminate lexing temporarily */
+						return LEXRES_SEMI;
+					}
+				}
+}
+	YY_BREAK
+case 59:
+YY_RULE_SETUP
+{
+{
+					/* Force a semicolon or colon into the query buffer */
+					emit(yytext + 1, 1);
+				}
+}
+	YY_BREAK
+case 60:
+YY_RULE_SETUP
+{
+{
+					/* Terminate lexing temporarily */
+					return LEXRES_BACKSLASH;
+				}
+}
+	YY_BREAK
+case 61:
+YY_RULE_SETUP
+{
+{
+					/* Possible psql variable substitution */
+					const char *varname = yytext + 1;
+					const char *value;
+
+					value = GetVariable(pset.vars, varname);
+
+					if (value)
+					{
+						/* It is a variable, check for recursion */
+						if (var_is_current_source(cur_state, varname))
+						{
+							/* Recursive expansion --- don't go there */
+							psql_error("skipping recursive expansion of variable \"%s\"\n",
+									   varname);
+							/* Instead copy the string as is */
+							ECHO;
+						}
+						else
+						{
+							/* OK, perform substitution */
+							push_new_buffer(value, varname);
+							/* yy_scan_string already made buffer active */
+						}
+					}
+					else
+					{
+						/*
+						 * if the variable doesn't exist we'll copy the
+						 * string as is
+						 */
+						ECHO;
+					}
+				}
+}
+	YY_BREAK
+case 62:
+YY_RULE_SETUP
+{
+{
+					escape_variable(false);
+				}
+}
+	YY_BREAK
+case 63:
+YY_RULE_SETUP
+{
+{
+					escape_variable(true);
+				}
+}
+	YY_BREAK
+case 64:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 65:
+YY_RULE_SETUP
+{
+{
+					/*
+					 * Check for embedded slash-star or dash-dash; those
+					 * are comment starts, so operator must stop there.
+					 * Note that slash-star or dash-dash at the first
+					 * character will match a prior rule, not this one.
+					 */
+					int		nchars = yyleng;
+					char   *slashstar = strstr(yytext, "/*");
+					char   *dashdash = strstr(yytext, "--");
+
+					if (slashstar && dashdash)
+					{
+						/* if both appear, take the first one */
+						if (slashstar > dashdash)
+							slashstar = dashdash;
+					}
+					else if (!slashstar)
+						slashstar = dashdash;
+					if (slashstar)
+						nchars = slashstar - yytext;
+
+					/*
+					 * For SQL compatibility, '+' and '-' cannot be the
+					 * last char of a multi-char operator unless the operator
+					 * contains chars that are not in SQL operators.
+					 * The idea is to lex '=-' as two operators, but not
+					 * to forbid operator names like '?-' that could not be
+					 * sequences of SQL operators.
+					 */
+					while (nchars > 1 &&
+						   (yytext[nchars-1] == '+' ||
+							yytext[nchars-1] == '-'))
+					{
+						int		ic;
+
+						for (ic = nchars-2; ic >= 0; ic--)
+						{
+							if (strchr("~!@#^&|`?%", yytext[ic]))
+								break;
+						}
+						if (ic >= 0)
+							break; /* found a char that makes it OK */
+						nchars--; /* else remove the +/-, and check again */
+					}
+
+					if (nchars < yyleng)
+					{
+						/* Strip the unwanted chars from the token */
+						yyless(nchars);
+					}
+					ECHO;
+				}
+}
+	YY_BREAK
+case 66:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 67:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 68:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 69:
+YY_RULE_SETUP
+{
+{
+					/* throw back the .., and treat as integer */
+					yyless(yyleng-2);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 70:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 71:
+YY_RULE_SETUP
+{
+{
+					/*
+					 * throw back the [Ee], and treat as {decimal}.  Note
+					 * that it is possible the input is actually {integer},
+					 * but since this case will almost certainly lead to a
+					 * syntax error anyway, we don't bother to distinguish.
+					 */
+					yyless(yyleng-1);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 72:
+YY_RULE_SETUP
+{
+{
+					/* throw back the [Ee][+-], and proceed as above */
+					yyless(yyleng-2);
+					ECHO;
+				}
+}
+	YY_BREAK
+case 73:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 74:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+				}
+}
+	YY_BREAK
+case 75:
+YY_RULE_SETUP
+{
+{
+					yyless(0);
+					return LEXRES_OK;
+				}
+}
+	YY_BREAK
+case 76:
+YY_RULE_SETUP
+{
+{ ECHO; }
+}
+	YY_BREAK
+case 77:
+YY_RULE_SETUP
+{
+{ }
+}
+	YY_BREAK
+case 78:
+YY_RULE_SETUP
+{
+{
+					/*
+					 * backslash is end of command or next command, do not eat
+					 *
+					 * XXX this means we can't conveniently accept options
+					 * that start with a backslash; therefore, option
+					 * processing that encourages use of backslashes is rather
+					 * broken.
+					 */
+					yyless(0);
+					return LEXRES_OK;
+				}
+}
+	YY_BREAK
+case 79:
+YY_RULE_SETUP
+{
+{
+					*option_quote = '\'';
+					BEGIN(xslashquote);
+				}
+}
+	YY_BREAK
+case 80:
+YY_RULE_SETUP
+{
+{
+					if (option_type == OT_VERBATIM)
+					{
+						/* in verbatim mode, backquote is not special */
+						ECHO;
+						BEGIN(xslashdefaultarg);
+					}
+					else
+					{
+						*option_quote = '`';
+						BEGIN(xslashbackquote);
+					}
+				}
+}
+	YY_BREAK
+case 81:
+YY_RULE_SETUP
+{
+{
+					/* Possible psql variable substitution */
+					if (option_type == OT_VERBATIM)
+						ECHO;
+					else
+					{
+						const char *value;
+
+						value = GetVariable(pset.vars, yytext + 1);
+
+						/*
+						 * The variable value is just emitted without any
+						 * further examination.  This is consistent with the
+						 * pre-8.0 code behavior, if not with the way that
+						 * variables are handled outside backslash commands.
+						 * Note that we needn't guard against recursion here.
+						 */
+						if (value)
+							appendPQExpBufferStr(output_buf, value);
+					}
+
+					*option_quote = ':';
+
+					return LEXRES_OK;
+				}
+}
+	YY_BREAK
+case 82:
+YY_RULE_SETUP
+{
+{
+					if (option_type == OT_VERBATIM)
+						ECHO;
+					else
+					{
+						escape_variable(false);
+						return LEXRES_OK;
+					}
+				}
+}
+	YY_BREAK
+case 83:
+YY_RULE_SETUP
+{
+{
+					if (option_type == OT_VERBATIM)
+						ECHO;
+					else
+					{
+						escape_variable(true);
+						return LEXRES_OK;
+					}
+				}
+}
+	YY_BREAK
+case 84:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+					if (option_type == OT_FILEPIPE)
+					{
+						/* treat like whole-string case */
+						BEGIN(xslashwholeline);
+					}
+					else
+					{
+						/* treat like default case */
+						BEGIN(xslashdefaultarg);
+					}
+				}
+}
+	YY_BREAK
+case 85:
+YY_RULE_SETUP
+{
+{
+					*option_quote = '"';
+					ECHO;
+					BEGIN(xslashquotedarg);
+				}
+}
+	YY_BREAK
+case 86:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+					BEGIN(xslashdefaultarg);
+				}
+}
+	YY_BREAK
+case 87:
+YY_RULE_SETUP
+{
+{ return LEXRES_OK; }
+}
+	YY_BREAK
+case 88:
+YY_RULE_SETUP
+{
+{ appendPQExpBufferChar(output_buf, '\''); }
+}
+	YY_BREAK
+case 89:
+YY_RULE_SETUP
+{
+{ appendPQExpBufferChar(output_buf, '\n'); }
+}
+	YY_BREAK
+case 90:
+YY_RULE_SETUP
+{
+{ appendPQExpBufferChar(output_buf, '\t'); }
+}
+	YY_BREAK
+case 91:
+YY_RULE_SETUP
+{
+{ appendPQExpBufferChar(output_buf, '\b'); }
+}
+	YY_BREAK
+case 92:
+YY_RULE_SETUP
+{
+{ appendPQExpBufferChar(output_buf, '\r'); }
+}
+	YY_BREAK
+case 93:
+YY_RULE_SETUP
+{
+{ appendPQExpBufferChar(output_buf, '\f'); }
+}
+	YY_BREAK
+case 94:
+YY_RULE_SETUP
+{
+{
+					/* octal case */
+					appendPQExpBufferChar(output_buf,
+										  (char) strtol(yytext + 1, NULL, 8));
+				}
+}
+	YY_BREAK
+case 95:
+YY_RULE_SETUP
+{
+{
+					/* hex case */
+					appendPQExpBufferChar(output_buf,
+										  (char) strtol(yytext + 2, NULL, 16));
+				}
+}
+	YY_BREAK
+case 96:
+YY_RULE_SETUP
+{
+{ emit(yytext + 1, 1); }
+}
+	YY_BREAK
+case 97:
+YY_RULE_SETUP
+{
+{ ECHO; }
+}
+	YY_BREAK
+case 98:
+YY_RULE_SETUP
+{
+{ return LEXRES_OK; }
+}
+	YY_BREAK
+case 99:
+YY_RULE_SETUP
+{
+{ ECHO; }
+}
+	YY_BREAK
+case 100:
+YY_RULE_SETUP
+{
+{
+					yyless(0);
+					return LEXRES_OK;
+				}
+}
+	YY_BREAK
+case 101:
+YY_RULE_SETUP
+{
+{
+					/*
+					 * unquoted backslash is end of command or next command,
+					 * do not eat
+					 *
+					 * (this was not the behavior pre-8.0, but it seems
+					 * consistent)
+					 */
+					yyless(0);
+					return LEXRES_OK;
+				}
+}
+	YY_BREAK
+case 102:
+YY_RULE_SETUP
+{
+{
+					*option_quote = '"';
+					ECHO;
+					BEGIN(xslashquotedarg);
+				}
+}
+	YY_BREAK
+case 103:
+YY_RULE_SETUP
+{
+{ ECHO; }
+}
+	YY_BREAK
+case 104:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+					BEGIN(xslashdefaultarg);
+				}
+}
+	YY_BREAK
+case 105:
+YY_RULE_SETUP
+{
+{ ECHO; }
+}
+	YY_BREAK
+case 106:
+YY_RULE_SETUP
+{
+{
+					if (output_buf->len > 0)
+						ECHO;
+				}
+}
+	YY_BREAK
+case 107:
+YY_RULE_SETUP
+{
+{ ECHO; }
+}
+	YY_BREAK
+case 108:
+YY_RULE_SETUP
+{
+{ return LEXRES_OK; }
+}
+	YY_BREAK
+case 109:
+YY_RULE_SETUP
+{
+{
+					yyless(0);
+					return LEXRES_OK;
+				}
+}
+	YY_BREAK
+			default:
+				YY_FATAL_ERROR("bad rule");
+		}
+	}
+}
+static void yy_fatal_error(const char *msg)
+{
+	(void) fprintf(stderr, "%s\n", msg);
+	exit(YY_EXIT_FAILURE);
+}
+static void yy_save_state(struct yyguts_t *g)
+{
+	if (g->cur)
+	{
+		*g->c_buf_p = g->hold_char;
+		g->cur->pos = g->c_buf_p;
+		g->cur->at_bol = g->at_bol;
+	}
+}
+void yy_switch_to_buffer(YY_BUFFER_STATE b)
+{
+	yy_save_state(yyg);
+	yyg->cur = b;
+	if (b)
+	{
+		yyg->c_buf_p = b->pos;
+		yyg->hold_char = *b->pos;
+		yyg->at_bol = b->at_bol;
+	}
+}
+static YY_BUFFER_STATE yy_new_buffer(char *base, yy_size_t len, int owns)
+{
+	YY_BUFFER_STATE b = (YY_BUFFER_STATE) yyalloc(sizeof(struct yy_buffer_state));
+	if (!b)
+		YY_FATAL_ERROR("out of dynamic memory");
+	b->base = base;
+	b->end = base + len;
+	b->pos = base;
+	b->at_bol = 1;
+	b->owns = owns;
+	return b;
+}
+YY_BUFFER_STATE yy_scan_buffer(char *base, yy_size_t size)
+{
+	YY_BUFFER_STATE b;
+	if (size < 2 || base[size - 2] != YY_END_OF_BUFFER_CHAR || base[size - 1] != YY_END_OF_BUFFER_CHAR)
+		return NULL;
+	b = yy_new_buffer(base, size - 2, 0);
+	yy_switch_to_buffer(b);
+	return b;
+}
+YY_BUFFER_STATE yy_scan_bytes(const char *bytes, int len)
+{
+	char *buf = (char *) yyalloc(len + 2);
+	YY_BUFFER_STATE b;
+	if (!buf)
+		YY_FATAL_ERROR("out of dynamic memory");
+	memcpy(buf, bytes, len);
+	buf[len] = buf[len + 1] = YY_END_OF_BUFFER_CHAR;
+	b = yy_scan_buffer(buf, len + 2);
+	b->owns = 1;
+	return b;
+}
+YY_BUFFER_STATE yy_scan_string(const char *str)
+{
+	return yy_scan_bytes(str, (int) strlen(str));
+}
+YY_BUFFER_STATE yy_create_buffer(FILE *file, int size)
+{
+	yy_size_t cap = 8192, len = 0, n;
+	char *buf = (char *) yyalloc(cap);
+	(void) size;
+	if (!buf)
+		YY_FATAL_ERROR("out of dynamic memory");
+	while ((n = fread(buf + len, 1, cap - len - 2, file)) > 0)
+	{
+		len += n;
+		if (cap - len - 2 == 0)
+		{
+			cap *= 2;
+			buf = (char *) yyrealloc(buf, cap);
+			if (!buf)
+				YY_FATAL_ERROR("out of dynamic memory");
+		}
+	}
+	buf[len] = buf[len + 1] = YY_END_OF_BUFFER_CHAR;
+	return yy_new_buffer(buf, len, 1);
+}
+void yyrestart(FILE *file)
+{
+	yy_switch_to_buffer(yy_create_buffer(file, YY_BUF_SIZE));
+}
+void yy_delete_buffer(YY_BUFFER_STATE b)
+{
+	if (!b)
+		return;
+	if (b == yyg->cur)
+		yyg->cur = NULL;
+	if (b->owns)
+		yyfree(b->base);
+	yyfree(b);
+}
+void *yyalloc(yy_size_t n)
+{
+	return malloc(n);
+}
+void *yyrealloc(void *p, yy_size_t n)
+{
+	return realloc(p, n);
+}
+void yyfree(void *p)
+{
+	free(p);
+}
+
+
+/*
+ * Create a lexer working state struct.
+ */
+PsqlScanState
+psql_scan_create(void)
+{
+	PsqlScanState state;
+
+	state = (PsqlScanStateData *) pg_malloc_zero(sizeof(PsqlScanStateData));
+
+	psql_scan_reset(state);
+
+	return state;
+}
+
+/*
+ * Destroy a lexer working state struct, releasing all resources.
+ */
+void
+psql_scan_destroy(PsqlScanState state)
+{
+	psql_scan_finish(state);
+
+	psql_scan_reset(state);
+
+	free(state);
+}
+
+/*
+ * Set up to perform lexing of the given input line.
+ *
+ * The text at *line, extending for line_len bytes, will be scanned by
+ * subsequent calls to the psql_scan routines.  psql_scan_finish should
+ * be called when scanning is complete.  Note that the lexer retains
+ * a pointer to the storage at *line --- this string must not be altered
+ * or freed until after psql_scan_finish is called.
+ */
+void
+psql_scan_setup(PsqlScanState state,
+				const char *line, int line_len)
+{
+	/* Mustn't be scanning already */
+	psql_assert(state->scanbufhandle == NULL);
+	psql_assert(state->buffer_stack == NULL);
+
+	/* Do we need to hack the character set encoding? */
+	state->encoding = pset.encoding;
+	state->safe_encoding = pg_valid_server_encoding_id(state->encoding);
+
+	/* needed for prepare_buffer */
+	cur_state = state;
+
+	/* Set up flex input buffer with appropriate translation and padding */
+	state->scanbufhandle = prepare_buffer(line, line_len,
+										  &state->scanbuf);
+	state->scanline = line;
+
+	/* Set lookaside data in case we have to map unsafe encoding */
+	state->curline = state->scanbuf;
+	state->refline = state->scanline;
+}
+
+/*
+ * Do lexical analysis of SQL command text.
+ *
+ * The text previously passed to psql_scan_setup is scanned, and appended
+ * (possibly with transformation) to query_buf.
+ *
+ * The return value indicates the condition that stopped scanning:
+ *
+ * PSCAN_SEMICOLON: found a command-ending semicolon.  (The semicolon is
+ * transferred to query_buf.)  The command accumulated in query_buf should
+ * be executed, then clear query_buf and call again to scan the remainder
+ * of the line.
+ *
+ * PSCAN_BACKSLASH: found a backslash that starts a psql special command.
+ * Any previous data on the line has been transferred to query_buf.
+ * The caller will typically next call psql_scan_slash_command(),
+ * perhaps psql_scan_slash_option(), and psql_scan_slash_command_end().
+ *
+ * PSCAN_INCOMPLETE: the end of the line was reached, but we have an
+ * incomplete SQL command.  *prompt is set to the appropriate prompt type.
+ *
+ * PSCAN_EOL: the end of the line was reached, and there is no lexical
+ * reason to consider the command incomplete.  The caller may or may not
+ * choose to send it.  *prompt is set to the appropriate prompt type if
+ * the caller chooses to collect more input.
+ *
+ * In the PSCAN_INCOMPLETE and PSCAN_EOL cases, psql_scan_finish() should
+ * be called next, then the cycle may be repeated with a fresh input line.
+ *
+ * In all cases, *prompt is set to an appropriate prompt type code for the
+ * next line-input operation.
+ */
+PsqlScanResult
+psql_scan(PsqlScanState state,
+		  PQExpBuffer query_buf,
+		  promptStatus_t *prompt)
+{
+	PsqlScanResult result;
+	int			lexresult;
+
+	/* Must be scanning already */
+	psql_assert(state->scanbufhandle);
+
+	/* Set up static variables that will be used by yylex */
+	cur_state = state;
+	output_buf = query_buf;
+
+	if (state->buffer_stack != NULL)
+		yy_switch_to_buffer(state->buffer_stack->buf);
+	else
+		yy_switch_to_buffer(state->scanbufhandle);
+
+	BEGIN(state->start_state);
+
+	/* And lex. */
+	lexresult = yylex();
+
+	/* Update static vars back to the state struct */
+	state->start_state = YY_START;
+
+	/*
+	 * Check termination state and return appropriate result info.
+	 */
+	switch (lexresult)
+	{
+		case LEXRES_EOL:		/* end of input */
+			switch (state->start_state)
+			{
+				case INITIAL:
+					if (state->paren_depth > 0)
+					{
+						result = PSCAN_INCOMPLETE;
+						*prompt = PROMPT_PAREN;
+					}
+					else if (query_buf->len > 0)
+					{
+						result = PSCAN_EOL;
+						*prompt = PROMPT_CONTINUE;
+					}
+					else
+					{
+						/* never bother to send an empty buffer */
+						result = PSCAN_INCOMPLETE;
+						*prompt = PROMPT_READY;
+					}
+					break;
+				case xb:
+					result = PSCAN_INCOMPLETE;
+					*prompt = PROMPT_SINGLEQUOTE;
+					break;
+				case xc:
+					result = PSCAN_INCOMPLETE;
+					*prompt = PROMPT_COMMENT;
+					break;
+				case xd:
+					result = PSCAN_INCOMPLETE;
+					*prompt = PROMPT_DOUBLEQUOTE;
+					break;
+				case xh:
+					result = PSCAN_INCOMPLETE;
+					*prompt = PROMPT_SINGLEQUOTE;
+					break;
+				case xq:
+					result = PSCAN_INCOMPLETE;
+					*prompt = PROMPT_SINGLEQUOTE;
+					break;
+				case xe:
+					result = PSCAN_INCOMPLETE;
+					*prompt = PROMPT_SINGLEQUOTE;
+					break;
+				case xdolq:
+					result = PSCAN_INCOMPLETE;
+					*prompt = PROMPT_DOLLARQUOTE;
+					break;
+				default:
+					/* can't get here */
+					fprintf(stderr, "invalid YY_START\n");
+					exit(1);
+			}
+			break;
+		case LEXRES_SEMI:		/* semicolon */
+			result = PSCAN_SEMICOLON;
+			*prompt = PROMPT_READY;
+			break;
+		case LEXRES_BACKSLASH:	/* backslash */
+			result = PSCAN_BACKSLASH;
+			*prompt = PROMPT_READY;
+			break;
+		default:
+			/* can't get here */
+			fprintf(stderr, "invalid yylex result\n");
+			exit(1);
+	}
+
+	return result;
+}
+
+/*
+ * Clean up after scanning a string.  This flushes any unread input and
+ * releases resources (but not the PsqlScanState itself).  Note however
+ * that this does not reset the lexer scan state; that can be done by
+ * psql_scan_reset(), which is an orthogonal operation.
+ *
+ * It is legal to call this when not scanning anything (makes it easier
+ * to deal with error recovery).
+ */
+void
+psql_scan_finish(PsqlScanState state)
+{
+	/* Drop any incomplete variable expansions. */
+	while (state->buffer_stack != NULL)
+		pop_buffer_stack(state);
+
+	/* Done with the outer scan buffer, too */
+	if (state->scanbufhandle)
+		yy_delete_buffer(state->scanbufhandle);
+	state->scanbufhandle = NULL;
+	if (state->scanbuf)
+		free(state->scanbuf);
+	state->scanbuf = NULL;
+}
+
+/*
+ * Reset lexer scanning state to start conditions.  This is appropriate
+ * for executing \r psql commands (or any other time that we discard the
+ * prior contents of query_buf).  It is not, however, necessary to do this
+ * when we execute and clear the buffer after getting a PSCAN_SEMICOLON or
+ * PSCAN_EOL scan result, because the scan state must be INITIAL when those
+ * conditions are returned.
+ *
+ * Note that this is unrelated to flushing unread input; that task is
+ * done by psql_scan_finish().
+ */
+void
+psql_scan_reset(PsqlScanState state)
+{
+	state->start_state = INITIAL;
+	state->paren_depth = 0;
+	state->xcdepth = 0;			/* not really necessary */
+	if (state->dolqstart)
+		free(state->dolqstart);
+	state->dolqstart = NULL;
+}
+
+/*
+ * Return true if lexer is currently in an "inside quotes" state.
+ *
+ * This is pretty grotty but is needed to preserve the old behavior
+ * that mainloop.c drops blank lines not inside quotes without even
+ * echoing them.
+ */
+bool
+psql_scan_in_quote(PsqlScanState state)
+{
+	return state->start_state != INITIAL;
+}
+
+/*
+ * Scan the command name of a psql backslash command.  This should be called
+ * after psql_scan() returns PSCAN_BACKSLASH.  It is assumed that the input
+ * has been consumed through the leading backslash.
+ *
+ * The return value is a malloc'd copy of the command name, as parsed off
+ * from the input.
+ */
+char *
+psql_scan_slash_command(PsqlScanState state)
+{
+	PQExpBufferData mybuf;
+	int			lexresult;
+
+	/* Must be scanning already */
+	psql_assert(state->scanbufhandle);
+
+	/* Build a local buffer that we'll return the data of */
+	initPQExpBuffer(&mybuf);
+
+	/* Set up static variables that will be used by yylex */
+	cur_state = state;
+	output_buf = &mybuf;
+
+	if (state->buffer_stack != NULL)
+		yy_switch_to_buffer(state->buffer_stack->buf);
+	else
+		yy_switch_to_buffer(state->scanbufhandle);
+
+	BEGIN(xslashcmd);
+
+	/* And lex. */
+	lexresult = yylex();
+
+	/* There are no possible errors in this lex state... */
+
+	return mybuf.data;
+}
+
+/*
+ * Parse off the next argument for a backslash command, and return it as a
+ * malloc'd string.  If there are no more arguments, returns NULL.
+ *
+ * type tells what processing, if any, to perform on the option string;
+ * for example, if it's a SQL identifier, we want to downcase any unquoted
+ * letters.
+ *
+ * if quote is not NULL, *quote is set to 0 if no quoting was found, else
+ * the quote symbol.
+ *
+ * if semicolon is true, unquoted trailing semicolon(s) that would otherwise
+ * be taken as part of the option string will be stripped.
+ *
+ * NOTE: the only possible syntax errors for backslash options are unmatched
+ * quotes, which are detected when we run out of input.  Therefore, on a
+ * syntax error we just throw away the string and return NULL; there is no
+ * need to worry about flushing remaining input.
+ */
+char *
+psql_scan_slash_option(PsqlScanState state,
+					   enum slash_option_type type,
+					   char *quote,
+					   bool semicolon)
+{
+	PQExpBufferData mybuf;
+	int			lexresult;
+	char		local_quote;
+	bool		badarg;
+
+	/* Must be scanning already */
+	psql_assert(state->scanbufhandle);
+
+	if (quote == NULL)
+		quote = &local_quote;
+	*quote = 0;
+
+	/* Build a local buffer that we'll return the data of */
+	initPQExpBuffer(&mybuf);
+
+	/* Set up static variables that will be used by yylex */
+	cur_state = state;
+	output_buf = &mybuf;
+	option_type = type;
+	option_quote = quote;
+
+	if (state->buffer_stack != NULL)
+		yy_switch_to_buffer(state->buffer_stack->buf);
+	else
+		yy_switch_to_buffer(state->scanbufhandle);
+
+	if (type == OT_WHOLE_LINE)
+		BEGIN(xslashwholeline);
+	else
+		BEGIN(xslasharg);
+
+	/* And lex. */
+	lexresult = yylex();
+
+	/*
+	 * Check the lex result: we should have gotten back either LEXRES_OK
+	 * or LEXRES_EOL (the latter indicating end of string).  If we were inside
+	 * a quoted string, as indicated by YY_START, EOL is an error.
+	 */
+	psql_assert(lexresult == LEXRES_EOL || lexresult == LEXRES_OK);
+	badarg = false;
+	switch (YY_START)
+	{
+		case xslasharg:
+			/* empty arg, or possibly a psql variable substitution */
+			break;
+		case xslashquote:
+			if (lexresult != LEXRES_OK)
+				badarg = true;		/* hit EOL not ending quote */
+			break;
+		case xslashbackquote:
+			if (lexresult != LEXRES_OK)
+				badarg = true;		/* hit EOL not ending quote */
+			else
+			{
+				/* Perform evaluation of backticked command */
+				char	   *cmd = mybuf.data;
+				FILE	   *fd;
+				bool		error = false;
+				PQExpBufferData output;
+				char		buf[512];
+				size_t		result;
+
+				fd = popen(cmd, PG_BINARY_R);
+				if (!fd)
+				{
+					psql_error("%s: %s\n", cmd, strerror(errno));
+					error = true;
+				}
+
+				initPQExpBuffer(&output);
+
+				if (!error)
+				{
+					do
+					{
+						result = fread(buf, 1, sizeof(buf), fd);
+						if (ferror(fd))
+						{
+							psql_error("%s: %s\n", cmd, strerror(errno));
+							error = true;
+							break;
+						}
+						appendBinaryPQExpBuffer(&output, buf, result);
+					} while (!feof(fd));
+				}
+
+				if (fd && pclose(fd) == -1)
+				{
+					psql_error("%s: %s\n", cmd, strerror(errno));
+					error = true;
+				}
+
+				if (PQExpBufferBroken(&output))
+				{
+					psql_error("%s: out of memory\n", cmd);
+					error = true;
+				}
+
+				/* Now done with cmd, transfer result to mybuf */
+				resetPQExpBuffer(&mybuf);
+
+				if (!error)
+				{
+					/* strip any trailing newline */
+					if (output.len > 0 &&
+						output.data[output.len - 1] == '\n')
+						output.len--;
+					appendBinaryPQExpBuffer(&mybuf, output.data, output.len);
+				}
+
+				termPQExpBuffer(&output);
+			}
+			break;
+		case xslashdefaultarg:
+			/* Strip any trailing semi-colons if requested */
+			if (semicolon)
+			{
+				while (mybuf.len > 0 &&
+					   mybuf.data[mybuf.len - 1] == ';')
+				{
+					mybuf.data[--mybuf.len] = '\0';
+				}
+			}
+
+			/*
+			 * If SQL identifier processing was requested, then we strip out
+			 * excess double quotes and downcase unquoted letters.
+			 * Doubled double-quotes become output double-quotes, per spec.
+			 *
+			 * Note that a string like FOO"BAR"BAZ will be converted to
+			 * fooBARbaz; this is somewhat inconsistent with the SQL spec,
+			 * which would have us parse it as several identifiers.  But
+			 * for psql's purposes, we want a string like "foo"."bar" to
+			 * be treated as one option, so there's little choice.
+			 */
+			if (type == OT_SQLID || type == OT_SQLIDHACK)
+			{
+				bool		inquotes = false;
+				char	   *cp = mybuf.data;
+
+				while (*cp)
+				{
+					if (*cp == '"')
+					{
+						if (inquotes && cp[1] == '"')
+						{
+							/* Keep the first quote, remove the second */
+							cp++;
+						}
+						inquotes = !inquotes;
+						/* Collapse out quote at *cp */
+						memmove(cp, cp + 1, strlen(cp));
+						mybuf.len--;
+						/* do not advance cp */
+					}
+					else
+					{
+						if (!inquotes && type == OT_SQLID)
+							*cp = pg_tolower((unsigned char) *cp);
+						cp += PQmblen(cp, pset.encoding);
+					}
+				}
+			}
+			break;
+		case xslashquotedarg:
+			/* must have hit EOL inside double quotes */
+			badarg = true;
+			break;
+		case xslashwholeline:
+			/* always okay */
+			break;
+		default:
+			/* can't get here */
+			fprintf(stderr, "invalid YY_START\n");
+			exit(1);
+	}
+
+	if (badarg)
+	{
+		psql_error("unterminated quoted string\n");
+		termPQExpBuffer(&mybuf);
+		return NULL;
+	}
+
+	/*
+	 * An unquoted empty argument isn't possible unless we are at end of
+	 * command.  Return NULL instead.
+	 */
+	if (mybuf.len == 0 && *quote == 0)
+	{
+		termPQExpBuffer(&mybuf);
+		return NULL;
+	}
+
+	/* Else return the completed string. */
+	return mybuf.data;
+}
+
+/*
+ * Eat up any unused \\ to complete a backslash command.
+ */
+void
+psql_scan_slash_command_end(PsqlScanState state)
+{
+	int			lexresult;
+
+	/* Must be scanning already */
+	psql_assert(state->scanbufhandle);
+
+	/* Set up static variables that will be used by yylex */
+	cur_state = state;
+	output_buf = NULL;
+
+	if (state->buffer_stack != NULL)
+		yy_switch_to_buffer(state->buffer_stack->buf);
+	else
+		yy_switch_to_buffer(state->scanbufhandle);
+
+	BEGIN(xslashend);
+
+	/* And lex. */
+	lexresult = yylex();
+
+	/* There are no possible errors in this lex state... */
+}
+
+
+/*
+ * Push the given string onto the stack of stuff to scan.
+ *
+ * cur_state must point to the active PsqlScanState.
+ *
+ * NOTE SIDE EFFECT: the new buffer is made the active flex input buffer.
+ */
+static void
+push_new_buffer(const char *newstr, const char *varname)
+{
+	StackElem  *stackelem;
+
+	stackelem = (StackElem *) pg_malloc(sizeof(StackElem));
+
+	/*
+	 * In current usage, the passed varname points at the current flex
+	 * input buffer; we must copy it before calling prepare_buffer()
+	 * because that will change the buffer state.
+	 */
+	stackelem->varname = varname ? pg_strdup(varname) : NULL;
+
+	stackelem->buf = prepare_buffer(newstr, strlen(newstr),
+									&stackelem->bufstring);
+	cur_state->curline = stackelem->bufstring;
+	if (cur_state->safe_encoding)
+	{
+		stackelem->origstring = NULL;
+		cur_state->refline = stackelem->bufstring;
+	}
+	else
+	{
+		stackelem->origstring = pg_strdup(newstr);
+		cur_state->refline = stackelem->origstring;
+	}
+	stackelem->next = cur_state->buffer_stack;
+	cur_state->buffer_stack = stackelem;
+}
+
+/*
+ * Pop the topmost buffer stack item (there must be one!)
+ *
+ * NB: after this, the flex input state is unspecified; caller must
+ * switch to an appropriate buffer to continue lexing.
+ */
+static void
+pop_buffer_stack(PsqlScanState state)
+{
+	StackElem  *stackelem = state->buffer_stack;
+
+	state->buffer_stack = stackelem->next;
+	yy_delete_buffer(stackelem->buf);
+	free(stackelem->bufstring);
+	if (stackelem->origstring)
+		free(stackelem->origstring);
+	if (stackelem->varname)
+		free(stackelem->varname);
+	free(stackelem);
+}
+
+/*
+ * Check if specified variable name is the source for any string
+ * currently being scanned
+ */
+static bool
+var_is_current_source(PsqlScanState state, const char *varname)
+{
+	StackElem  *stackelem;
+
+	for (stackelem = state->buffer_stack;
+		 stackelem != NULL;
+		 stackelem = stackelem->next)
+	{
+		if (stackelem->varname && strcmp(stackelem->varname, varname) == 0)
+			return true;
+	}
+	return false;
+}
+
+/*
+ * Set up a flex input buffer to scan the given data.  We always make a
+ * copy of the data.  If working in an unsafe encoding, the copy has
+ * multibyte sequences replaced by FFs to avoid fooling the lexer rules.
+ *
+ * cur_state must point to the active PsqlScanState.
+ *
+ * NOTE SIDE EFFECT: the new buffer is made the active flex input buffer.
+ */
+static YY_BUFFER_STATE
+prepare_buffer(const char *txt, int len, char **txtcopy)
+{
+	char	   *newtxt;
+
+	/* Flex wants two \0 characters after the actual data */
+	newtxt = pg_malloc(len + 2);
+	*txtcopy = newtxt;
+	newtxt[len] = newtxt[len + 1] = YY_END_OF_BUFFER_CHAR;
+
+	if (cur_state->safe_encoding)
+		memcpy(newtxt, txt, len);
+	else
+	{
+		/* Gotta do it the hard way */
+		int		i = 0;
+
+		while (i < len)
+		{
+			int		thislen = PQmblen(txt + i, cur_state->encoding);
+
+			/* first byte should always be okay... */
+			newtxt[i] = txt[i];
+			i++;
+			while (--thislen > 0)
+				newtxt[i++] = (char) 0xFF;
+		}
+	}
+
+	return yy_scan_buffer(newtxt, len + 2);
+}
+
+/*
+ * emit() --- body for ECHO macro
+ *
+ * NB: this must be used for ALL and ONLY the text copied from the flex
+ * input data.  If you pass it something that is not part of the yytext
+ * string, you are making a mistake.  Internally generated text can be
+ * appended directly to output_buf.
+ */
+static void
+emit(const char *txt, int len)
+{
+	if (cur_state->safe_encoding)
+		appendBinaryPQExpBuffer(output_buf, txt, len);
+	else
+	{
+		/* Gotta do it the hard way */
+		const char *reference = cur_state->refline;
+		int		i;
+
+		reference += (txt - cur_state->curline);
+
+		for (i = 0; i < len; i++)
+		{
+			char	ch = txt[i];
+
+			if (ch == (char) 0xFF)
+				ch = reference[i];
+			appendPQExpBufferChar(output_buf, ch);
+		}
+	}
+}
+
+static bool
+is_utf16_surrogate_first(uint32 c)
+{
+	return (c >= 0xD800 && c <= 0xDBFF);
+}
+
+static void
+escape_variable(bool as_ident)
+{
+	char		saved_char;
+	const char *value;
+
+	/* Variable lookup. */
+	saved_char = yytext[yyleng - 1];
+	yytext[yyleng - 1] = '\0';
+	value = GetVariable(pset.vars, yytext + 2);
+
+	/* Escaping. */
+	if (value)
+	{
+		if (!pset.db)
+			psql_error("can't escape without active connection\n");
+		else
+		{
+			char   *escaped_value;
+
+			if (as_ident)
+				escaped_value =
+					PQescapeIdentifier(pset.db, value, strlen(value));
+			else
+				escaped_value =
+					PQescapeLiteral(pset.db, value, strlen(value));
+			if (escaped_value == NULL)
+			{
+				const char *error = PQerrorMessage(pset.db);
+				psql_error("%s", error);
+			}
+			else
+			{
+				appendPQExpBufferStr(output_buf, escaped_value);
+				PQfreemem(escaped_value);
+				return;
+			}
+		}
+	}
+
+	/*
+	 * If we reach this point, some kind of error has occurred.  Emit the
+	 * original text into the output buffer.
+	 */
+	yytext[yyleng - 1] = saved_char;
+	emit(yytext, yyleng);
+}
+
@@ -0,0 +1 @@
+../../../src/bin/psql/print.c
\ No newline at end of file
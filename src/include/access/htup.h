@@ -576,13 +576,15 @@ typedef HeapTupleData *HeapTuple;
 /*
  * We ran out of opcodes, so heapam.c now has a second RmgrId.	These opcodes
  * are associated with RM_HEAP2_ID, but are not logically different from
- * the ones above associated with RM_HEAP_ID.  We apply XLOG_HEAP_OPMASK,
- * although currently XLOG_HEAP_INIT_PAGE is not used for any of these.
+ * the ones above associated with RM_HEAP_ID.  We apply XLOG_HEAP_OPMASK, so
+ * XLOG_HEAP_INIT_PAGE can be used with them too (only MULTI_INSERT does).
  */
 #define XLOG_HEAP2_FREEZE		0x00
 #define XLOG_HEAP2_CLEAN		0x10
 /* 0x20 is free, was XLOG_HEAP2_CLEAN_MOVE */
 #define XLOG_HEAP2_CLEANUP_INFO 0x30
+#define XLOG_HEAP2_MULTI_INSERT 0x40
+#define XLOG_HEAP2_VISIBLE		0x50
 
 /*
  * All what we need to find changed tuple
@@ -636,6 +638,36 @@ typedef struct xl_heap_insert
 
 #define SizeOfHeapInsert	(offsetof(xl_heap_insert, all_visible_cleared) + sizeof(bool))
 
+/*
+ * This is what we need to know about a multi-insert.  The record consists of
+ * xl_heap_multi_insert header, followed by a xl_multi_insert_tuple and tuple
+ * data for each tuple.  'offsets' array is omitted if the whole page is
+ * reinitialized (XLOG_HEAP_INIT_PAGE).
+ */
+typedef struct xl_heap_multi_insert
+{
+	RelFileNode node;
+	BlockNumber blkno;
+	bool		all_visible_cleared;
+	uint16		ntuples;
+	OffsetNumber offsets[1];
+
+	/* TUPLE DATA (xl_multi_insert_tuples) FOLLOW AT END OF STRUCT */
+} xl_heap_multi_insert;
+
+#define SizeOfHeapMultiInsert	offsetof(xl_heap_multi_insert, offsets)
+
+typedef struct xl_multi_insert_tuple
+{
+	uint16		datalen;		/* size of tuple data that follows */
+	uint16		t_infomask2;
+	uint16		t_infomask;
+	uint8		t_hoff;
+	/* TUPLE DATA FOLLOWS AT END OF STRUCT */
+} xl_multi_insert_tuple;
+
+#define SizeOfMultiInsertTuple	(offsetof(xl_multi_insert_tuple, t_hoff) + sizeof(uint8))
+
 /* This is what we need to know about update|hot_update */
 typedef struct xl_heap_update
 {
@@ -703,9 +735,10 @@ typedef struct xl_heap_lock
 	TransactionId locking_xid;	/* might be a MultiXactId not xid */
 	bool		xid_is_mxact;	/* is it? */
 	bool		shared_lock;	/* shared or exclusive row lock? */
+	bool		all_frozen_cleared;		/* VM all-frozen bit cleared? */
 } xl_heap_lock;
 
-#define SizeOfHeapLock	(offsetof(xl_heap_lock, shared_lock) + sizeof(bool))
+#define SizeOfHeapLock	(offsetof(xl_heap_lock, all_frozen_cleared) + sizeof(bool))
 
 /* This is what we need to know about in-place update */
 typedef struct xl_heap_inplace
@@ -727,6 +760,17 @@ typedef struct xl_heap_freeze
 
 #define SizeOfHeapFreeze (offsetof(xl_heap_freeze, cutoff_xid) + sizeof(TransactionId))
 
+/* This is what we need to know about setting a visibility map bit */
+typedef struct xl_heap_visible
+{
+	RelFileNode node;
+	BlockNumber block;
+	TransactionId cutoff_xid;	/* newest xmin on the page, if any */
+	uint8		flags;			/* VISIBILITYMAP_* bits to set */
+} xl_heap_visible;
+
+#define SizeOfHeapVisible (offsetof(xl_heap_visible, flags) + sizeof(uint8))
+
 extern void HeapTupleHeaderAdvanceLatestRemovedXid(HeapTupleHeader tuple,
 									   TransactionId *latestRemovedXid);
 
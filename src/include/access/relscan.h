@@ -16,6 +16,22 @@
 
 #include "access/genam.h"
 #include "access/heapam.h"
+#include "access/itup.h"
+#include "storage/spin.h"
+
+
+/*
+ * Shared state for a parallel heap scan.  This lives in memory that all the
+ * participating processes can see; phs_cblock is the next block to hand
+ * out, and is protected by phs_mutex.
+ */
+typedef struct ParallelHeapScanDescData
+{
+	Oid			phs_relid;		/* OID of relation to scan */
+	BlockNumber phs_nblocks;	/* # blocks in relation at start of scan */
+	slock_t		phs_mutex;		/* mutual exclusion for phs_cblock */
+	BlockNumber phs_cblock;		/* next block to hand out */
+} ParallelHeapScanDescData;
 
 
 typedef struct HeapScanDescData
@@ -29,6 +45,7 @@ typedef struct HeapScanDescData
 	bool		rs_pageatatime; /* verify visibility page-at-a-time? */
 	bool		rs_allow_strat; /* allow or disallow use of access strategy */
 	bool		rs_allow_sync;	/* allow or disallow use of syncscan */
+	ParallelHeapScanDesc rs_parallel;	/* parallel scan state, or NULL */
 
 	/* state set up at initscan time */
 	BlockNumber rs_nblocks;		/* number of blocks to scan */
@@ -70,10 +87,15 @@ typedef struct IndexScanDescData
 	bool		ignore_killed_tuples;	/* do not return killed entries */
 	bool		xactStartedInRecovery;	/* prevents killing/seeing killed
 										 * tuples */
+	bool		xs_want_itup;	/* caller requests index tuples */
+	int			xs_prefetch_pages;	/* max heap pages to prefetch, or 0 */
 
 	/* index access method's private state */
 	void	   *opaque;			/* access-method-specific info */
 
+	/* in an index-only scan, this is valid after a successful amgettuple */
+	IndexTuple	xs_itup;		/* index tuple returned by AM, or NULL */
+
 	/* xs_ctup/xs_cbuf/xs_recheck are valid after a successful index_getnext */
 	HeapTupleData xs_ctup;		/* current heap tuple, if any */
 	Buffer		xs_cbuf;		/* current heap buffer in scan, if any */
@@ -119,6 +119,13 @@ typedef struct VariableCacheData
 	 */
 	TransactionId latestCompletedXid;	/* newest XID that has committed or
 										 * aborted */
+
+	/*
+	 * Number of times a transaction with an XID has left the set of running
+	 * transactions.  A snapshot taken when this had the same value as now is
+	 * still valid; see GetSnapshotData.
+	 */
+	uint64		xactCompletionCount;
 } VariableCacheData;
 
 typedef VariableCacheData *VariableCache;
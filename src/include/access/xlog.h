@@ -198,6 +198,8 @@ extern bool XLogArchiveMode;
 extern char *XLogArchiveCommand;
 extern bool EnableHotStandby;
 extern bool log_checkpoints;
+extern int	CommitDelay;
+extern int	CommitSiblings;
 
 /* WAL levels */
 typedef enum WalLevel
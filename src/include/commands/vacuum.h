@@ -20,6 +20,7 @@
 #include "nodes/parsenodes.h"
 #include "storage/buf.h"
 #include "storage/lock.h"
+#include "storage/spin.h"
 #include "utils/relcache.h"
 
 
@@ -125,6 +126,18 @@ typedef struct VacAttrStats
 } VacAttrStats;
 
 
+/*
+ * Cost-based delay state shared by the participants of a parallel vacuum.
+ * Each attached participant gets an equal share of vacuum_cost_limit, so
+ * that together they consume no more than a single vacuum would.  It lives
+ * in shared memory set up by the leader.
+ */
+typedef struct VacuumSharedCostState
+{
+	slock_t		mutex;			/* protects nactive */
+	int			nactive;		/* # of participants currently attached */
+} VacuumSharedCostState;
+
 /* GUC parameters */
 extern PGDLLIMPORT int default_statistics_target;		/* PGDLLIMPORT for
 														 * PostGIS */
@@ -150,10 +163,14 @@ extern void vacuum_set_xid_limits(int freeze_min_age, int freeze_table_age,
 					  TransactionId *freezeTableLimit);
 extern void vac_update_datfrozenxid(void);
 extern void vacuum_delay_point(void);
+extern void vacuum_shared_cost_init(VacuumSharedCostState *shared);
+extern void vacuum_shared_cost_attach(VacuumSharedCostState *shared);
+extern void vacuum_shared_cost_detach(void);
 
 /* in commands/vacuumlazy.c */
 extern void lazy_vacuum_rel(Relation onerel, VacuumStmt *vacstmt,
 				BufferAccessStrategy bstrategy, bool *scanned_all);
+extern void ParallelVacuumMain(char *args, Size size);
 
 /* in commands/analyze.c */
 extern void analyze_rel(Oid relid, VacuumStmt *vacstmt,
@@ -0,0 +1,22 @@
+/*-------------------------------------------------------------------------
+ *
+ * execFlatExpr.h
+ *	  Flattened evaluation of expression state trees.
+ *
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef EXECFLATEXPR_H
+#define EXECFLATEXPR_H
+
+#include "nodes/execnodes.h"
+
+extern bool ExecCompileExpr(ExprState *state);
+extern void ExecCompilePlanExprs(PlanState *planstate);
+
+#endif   /* EXECFLATEXPR_H */
@@ -0,0 +1,39 @@
+/*-------------------------------------------------------------------------
+ *
+ * execParallel.h
+ *	  support for running part of a plan in parallel worker processes
+ *
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef EXECPARALLEL_H
+#define EXECPARALLEL_H
+
+#include "nodes/execnodes.h"
+#include "postmaster/parallelworker.h"
+
+/*
+ * What the leader needs to know about a parallel plan it has set up.  The
+ * scans' shared states are in the parallel context, or, if there is none,
+ * in local memory.
+ */
+typedef struct ParallelExecutorInfo
+{
+	ParallelContext *pcxt;		/* parallel context, or NULL if no workers */
+	int			nscans;			/* number of parallel-aware scans */
+	ParallelHeapScanDesc pscan[2];	/* their shared states */
+	HashJoinShared hjshared;	/* shared state of a hash join, or NULL */
+} ParallelExecutorInfo;
+
+extern ParallelExecutorInfo *ExecInitParallelPlan(PlanState *planstate,
+					 EState *estate, int nworkers);
+extern void ExecParallelStop(ParallelExecutorInfo *pei);
+extern void ExecParallelCleanup(ParallelExecutorInfo *pei);
+extern void ParallelQueryMain(char *args, Size size);
+
+#endif   /* EXECPARALLEL_H */
@@ -230,6 +230,7 @@ extern TupleTableSlot *ExecScan(ScanState *node, ExecScanAccessMtd accessMtd,
 		 ExecScanRecheckMtd recheckMtd);
 extern void ExecAssignScanProjectionInfo(ScanState *node);
 extern void ExecScanReScan(ScanState *node);
+extern void ExecInitScanBatch(ScanState *node, int eflags);
 
 /*
  * prototypes from functions in execTuples.c
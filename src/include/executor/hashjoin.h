@@ -15,7 +15,10 @@
 #define HASHJOIN_H
 
 #include "fmgr.h"
+#include "lib/bloomfilter.h"
 #include "storage/buffile.h"
+#include "storage/proc.h"
+#include "storage/spin.h"
 
 /* ----------------------------------------------------------------
  *				hash-join hash table structures
@@ -54,12 +57,17 @@
  * inner batch file.  Subsequently, while reading either inner or outer batch
  * files, we might find tuples that no longer belong to the current batch;
  * if so, we just dump them out to the correct batch file.
+ *
+ * In a parallel hash join, the leader and the workers under a Gather node
+ * build a single hash table in working space shared through the parallel
+ * context, and probe it together.  See HashJoinSharedData below.
  * ----------------------------------------------------------------
  */
 
 /* these are in nodes/execnodes.h: */
 /* typedef struct HashJoinTupleData *HashJoinTuple; */
 /* typedef struct HashJoinTableData *HashJoinTable; */
+/* typedef struct HashJoinSharedData *HashJoinShared; */
 
 typedef struct HashJoinTupleData
 {
@@ -102,6 +110,117 @@ typedef struct HashSkewBucket
 #define SKEW_WORK_MEM_PERCENT  2
 #define SKEW_MIN_OUTER_FRACTION  0.01
 
+/*
+ * In a parallel hash join, tuples are stored in chunks carved out of the
+ * shared working space, so that each participant can fill a chunk of its
+ * own without locking.  A tuple bigger than HASH_CHUNK_THRESHOLD gets a
+ * chunk to itself.  Chunks are laid out one after another, each followed by
+ * its maxlen bytes of space, of which the first used bytes hold tuples, so
+ * that the whole table can be walked in address order.
+ */
+typedef struct HashMemoryChunkData
+{
+	Size		maxlen;			/* space for tuples in this chunk */
+	Size		used;			/* space actually filled */
+} HashMemoryChunkData;
+
+typedef struct HashMemoryChunkData *HashMemoryChunk;
+
+#define HASH_CHUNK_SIZE			(32 * 1024L)
+#define HASH_CHUNK_HEADER_SIZE	MAXALIGN(sizeof(HashMemoryChunkData))
+#define HASH_CHUNK_THRESHOLD	(HASH_CHUNK_SIZE / 4)
+#define HASH_CHUNK_DATA(chunk)	((char *) (chunk) + HASH_CHUNK_HEADER_SIZE)
+
+/*
+ * Phases of a parallel hash join.  Each batch is first built, with all
+ * participants inserting into the shared table, and then probed, with all
+ * of them scanning their share of the outer tuples.  A participant can only
+ * join in while batch 0 is in progress.
+ */
+typedef enum HashJoinPhase
+{
+	HJ_PHASE_BUILD,				/* loading the inner tuples of curbatch */
+	HJ_PHASE_PROBE,				/* probing with the outer tuples */
+	HJ_PHASE_DONE				/* no batches left */
+} HashJoinPhase;
+
+#define HJ_NUM_BUCKET_LOCKS		64
+
+/*
+ * Control block of a parallel hash join, at the start of the working space
+ * that the leader reserves for it.  The main shared memory segment is
+ * mapped at the same address in every process, so it holds plain pointers.
+ *
+ * The main hash table's bucket array comes first in the space, followed by
+ * the tuple chunks, which grow upward from chunk_start to space_next.  The
+ * skew hash table, which only lives during batch 0, is allocated downward
+ * from the end of the space, and space_end marks its lowest allocation.
+ *
+ * Each participant writes its batch files under names made of the
+ * leader's PID, fileset, its participant number and the batch number, so
+ * that the others can read them when the batch comes up; see
+ * ExecHashJoinSaveBatchTuple.  Participants finishing a phase wait for the
+ * others; the last to arrive moves the join on to the next phase.
+ *
+ * When a participant runs out of space, it sets growthNeeded, and all the
+ * participants still building wait until one of them has doubled nbatch
+ * and moved the tuples of later batches out to its files.
+ */
+typedef struct HashJoinSharedData
+{
+	slock_t		mutex;			/* protects the fields below, except as noted */
+	HashJoinPhase phase;		/* what we're doing with curbatch */
+	int			curbatch;		/* current batch # */
+	int			phaseno;		/* incremented at every change of phase */
+	bool		transitioning;	/* is someone moving to the next phase? */
+	bool		abandoned;		/* has the leader stopped the join? */
+	int			nparticipants;	/* # participants attached now */
+	int			nattached;		/* # participants ever attached */
+	int			nwaiting;		/* # waiting for the next phase */
+	int			nextfile;		/* participant # of next batch file to read */
+
+	int			nbatch;			/* number of batches */
+	int			nbatch_original;	/* nbatch when we started inner scan */
+	int			nbatch_outstart;	/* nbatch when we started outer scan */
+	bool		growEnabled;	/* flag to shut off nbatch increases */
+	bool		growthNeeded;	/* has someone run out of space? */
+	int			ngrowwaiting;	/* # waiting for nbatch increase */
+	int			growgen;		/* incremented at every nbatch increase */
+	bool		outerjoin;		/* must we keep unmatched outer tuples? */
+	double		totalTuples;	/* # tuples obtained from inner plan */
+
+	char	   *space_start;	/* start of working space */
+	char	   *chunk_start;	/* first tuple chunk */
+	char	   *space_next;		/* end of last tuple chunk */
+	char	   *space_end;		/* lowest skew allocation */
+	char	   *space_top;		/* end of working space */
+	Size		spacePeak;		/* peak space used */
+
+	int			nbuckets;		/* # buckets in the in-memory hash table */
+	int			log2_nbuckets;	/* its log2 */
+	struct HashJoinTupleData **buckets; /* bucket array */
+	slock_t		bucketlocks[HJ_NUM_BUCKET_LOCKS];	/* protect bucket chains */
+
+	slock_t		skewlock;		/* protects skew hash table */
+	bool		skewEnabled;	/* are we using skew optimization? */
+	HashSkewBucket **skewBucket;	/* hashtable of skew buckets */
+	int			skewBucketLen;	/* size of skewBucket array */
+	int			nSkewBuckets;	/* number of active skew buckets */
+	int		   *skewBucketNums; /* array indexes of active skew buckets */
+	Size		spaceUsedSkew;	/* skew hash table's current space usage */
+	Size		spaceAllowedSkew;	/* upper limit for skew hashtable */
+
+	Oid			tablespace;		/* tablespace for batch files */
+	int			leader_pid;		/* leader's PID, for batch file names */
+	int			fileset;		/* leader's fileset #, likewise */
+	int			maxparticipants;	/* size of procs array */
+	PGPROC	   *procs[1];		/* VARIABLE LENGTH ARRAY: attached procs */
+} HashJoinSharedData;
+
+#define HashJoinSharedSize(maxparticipants) \
+	MAXALIGN(offsetof(HashJoinSharedData, procs) + \
+			 (maxparticipants) * sizeof(PGPROC *))
+
 
 typedef struct HashJoinTableData
 {
@@ -155,6 +274,48 @@ typedef struct HashJoinTableData
 
 	MemoryContext hashCxt;		/* context for whole-hash-join storage */
 	MemoryContext batchCxt;		/* context for this-batch-only storage */
+
+	/*
+	 * In a parallel hash join, the shared state, and our own part in it.
+	 * The fields above that describe the table mirror the shared ones, and
+	 * are refreshed whenever we have waited for the other participants; the
+	 * batch file arrays hold only the files that we write.
+	 */
+	HashJoinShared shared;		/* shared state, or NULL if not parallel */
+	struct ParallelContext *pcxt;	/* leader's parallel context */
+	int			participant;	/* our participant #, or -1 if not attached */
+	HashJoinPhase phase;		/* phase of curbatch when we last looked */
+	int			phaseno;		/* shared phaseno when we last looked */
+	HashMemoryChunk chunk;		/* chunk we are filling, or NULL */
+	BufFile    *readFile;		/* another participant's file we're reading */
 } HashJoinTableData;
 
+/*
+ * For inner and semi joins whose outer input is a plain scan, the Hash node
+ * also builds a Bloom filter over the hash values of all inner tuples, and
+ * the outer scan node tests each tuple that passes its quals against it.
+ * An outer tuple that can't have a match is thus dropped before it is
+ * projected and handed up to the join.  keys are the outer hash keys,
+ * rewritten to refer to the scan tuple rather than the scan's output.
+ *
+ * The filter is only usable while the hash table it was built with exists;
+ * bloom is NULL at other times.  If the filter turns out not to reject a
+ * useful fraction of the outer tuples, the scan stops consulting it.
+ */
+typedef struct HashJoinFilterData
+{
+	BloomFilter bloom;			/* filter, or NULL if not built */
+	HashJoinTable hashtable;	/* table supplying the outer hash functions */
+	List	   *keys;			/* list of ExprState nodes */
+	double		nprobes;		/* # outer tuples tested */
+	double		nrejected;		/* # of those rejected */
+	double		ntotalrejected;	/* # rejected in all scans, for EXPLAIN */
+	bool		disabled;		/* stopped testing? */
+} HashJoinFilterData;
+
+/* judge the filter's selectivity after this many probes */
+#define HASHJOIN_FILTER_SAMPLE		1000
+/* and keep it only if it rejects at least this fraction of the tuples */
+#define HASHJOIN_FILTER_MIN_REJECT	0.1
+
 #endif   /* HASHJOIN_H */
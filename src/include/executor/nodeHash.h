@@ -22,7 +22,8 @@ extern Node *MultiExecHash(HashState *node);
 extern void ExecEndHash(HashState *node);
 extern void ExecReScanHash(HashState *node);
 
-extern HashJoinTable ExecHashTableCreate(Hash *node, List *hashOperators);
+extern HashJoinTable ExecHashTableCreate(Hash *node, List *hashOperators,
+					HashJoinShared shared);
 extern void ExecHashTableDestroy(HashJoinTable hashtable);
 extern void ExecHashTableInsert(HashJoinTable hashtable,
 					TupleTableSlot *slot,
@@ -45,5 +46,13 @@ extern void ExecChooseHashTableSize(double ntuples, int tupwidth, bool useskew,
 						int *numbatches,
 						int *num_skew_mcvs);
 extern int	ExecHashGetSkewBucket(HashJoinTable hashtable, uint32 hashvalue);
+extern void ExecHashTableInitializeShared(Hash *node, List *hashOperators,
+							  bool outerjoin, char *space, Size size,
+							  int maxparticipants);
+extern bool ExecHashTableAttach(HashJoinTable hashtable);
+extern void ExecHashTableArrive(HashJoinTable hashtable);
+extern bool ExecHashTableDetach(HashJoinTable hashtable);
+extern void ExecHashTableAbandonShared(HashJoinShared shared);
+extern int	ExecHashTableNextSharedFile(HashJoinTable hashtable);
 
 #endif   /* NODEHASH_H */
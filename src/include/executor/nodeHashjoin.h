@@ -21,8 +21,18 @@ extern HashJoinState *ExecInitHashJoin(HashJoin *node, EState *estate, int eflag
 extern TupleTableSlot *ExecHashJoin(HashJoinState *node);
 extern void ExecEndHashJoin(HashJoinState *node);
 extern void ExecReScanHashJoin(HashJoinState *node);
+extern bool ExecHashJoinFilterRejects(HashJoinFilter filter,
+						  ExprContext *econtext);
 
 extern void ExecHashJoinSaveTuple(MinimalTuple tuple, uint32 hashvalue,
 					  BufFile **fileptr);
+extern void ExecHashJoinSaveBatchTuple(HashJoinTable hashtable,
+						   MinimalTuple tuple, uint32 hashvalue,
+						   int batchno, bool inner);
+extern BufFile *ExecHashJoinOpenSharedBatch(HashJoinTable hashtable,
+							int participant, int batchno, bool inner);
+extern void ExecHashJoinInitializeShared(HashJoinState *hjstate,
+							 char *space, Size size, int maxparticipants,
+							 struct ParallelContext *pcxt);
 
 #endif   /* NODEHASHJOIN_H */
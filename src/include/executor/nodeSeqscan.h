@@ -22,5 +22,7 @@ extern void ExecEndSeqScan(SeqScanState *node);
 extern void ExecSeqMarkPos(SeqScanState *node);
 extern void ExecSeqRestrPos(SeqScanState *node);
 extern void ExecReScanSeqScan(SeqScanState *node);
+extern void ExecSeqScanInitializeParallel(SeqScanState *node,
+							  ParallelHeapScanDesc parallel_scan);
 
 #endif   /* NODESEQSCAN_H */
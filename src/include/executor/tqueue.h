@@ -0,0 +1,30 @@
+/*-------------------------------------------------------------------------
+ *
+ * tqueue.h
+ *	  Use shm_mq to send & receive tuples between parallel backends
+ *
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#ifndef TQUEUE_H
+#define TQUEUE_H
+
+#include "storage/shm_mq.h"
+#include "tcop/dest.h"
+
+
+extern DestReceiver *CreateTupleQueueDestReceiver(void);
+
+extern void SetTupleQueueDestReceiverParams(DestReceiver *self,
+								shm_mq *queue);
+
+extern HeapTuple TupleQueueReceiveTuple(shm_mq_handle *mqh, bool nowait,
+					   bool *done);
+
+#endif   /* TQUEUE_H */
@@ -0,0 +1,23 @@
+/*-------------------------------------------------------------------------
+ *
+ * bloomfilter.h
+ *	  Declarations for a simple Bloom filter over 32-bit hash values.
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef BLOOMFILTER_H
+#define BLOOMFILTER_H
+
+typedef struct BloomFilterData *BloomFilter;
+
+extern BloomFilter bloom_create(double total_elems, long max_bytes);
+extern void bloom_free(BloomFilter filter);
+extern void bloom_add_hash(BloomFilter filter, uint32 hashvalue);
+extern bool bloom_lacks_hash(BloomFilter filter, uint32 hashvalue);
+
+#endif   /* BLOOMFILTER_H */
@@ -528,6 +528,8 @@ struct ExprState
 	NodeTag		type;
 	Expr	   *expr;			/* associated Expr node */
 	ExprStateEvalFunc evalfunc; /* routine to run to execute node */
+	struct ExprProgram *program;	/* compiled form, if any; see
+									 * execFlatExpr.c */
 };
 
 /* ----------------
@@ -1114,6 +1116,8 @@ typedef struct BitmapOrState
  *		currentRelation    relation being scanned (NULL if none)
  *		currentScanDesc    current scan descriptor for scan (NULL if none)
  *		ScanTupleSlot	   pointer to slot in tuple table holding scan tuple
+ *		JoinFilter		   Bloom filter from a hash join above, or NULL
+ *		Batch			   batch mode state (see execScan.c), or NULL
  * ----------------
  */
 typedef struct ScanState
@@ -1122,6 +1126,8 @@ typedef struct ScanState
 	Relation	ss_currentRelation;
 	HeapScanDesc ss_currentScanDesc;
 	TupleTableSlot *ss_ScanTupleSlot;
+	struct HashJoinFilterData *ss_JoinFilter;
+	struct ScanBatchData *ss_Batch;
 } ScanState;
 
 /*
@@ -1164,6 +1170,8 @@ typedef struct
  *		RuntimeContext	   expr context for evaling runtime Skeys
  *		RelationDesc	   index relation descriptor
  *		ScanDesc		   index scan descriptor
+ *		IndexOnly		   true if returning values from index tuples
+ *		VMBuffer		   visibility map buffer, for an index-only scan
  * ----------------
  */
 typedef struct IndexScanState
@@ -1178,6 +1186,8 @@ typedef struct IndexScanState
 	ExprContext *iss_RuntimeContext;
 	Relation	iss_RelationDesc;
 	IndexScanDesc iss_ScanDesc;
+	bool		iss_IndexOnly;
+	Buffer		iss_VMBuffer;
 } IndexScanState;
 
 /* ----------------
@@ -1457,12 +1467,18 @@ typedef struct MergeJoinState
  *		hj_NeedNewOuter			true if need new outer tuple on next call
  *		hj_MatchedOuter			true if found a join match for current outer
  *		hj_OuterNotEmpty		true if outer relation known not empty
+ *		hj_Shared				shared state of a parallel hash join, or NULL
+ *		hj_ParallelContext		leader's parallel context, or NULL
+ *		hj_Filter				Bloom filter pushed down to the outer scan,
+ *								or NULL if none (see executor/hashjoin.h)
  * ----------------
  */
 
 /* these structs are defined in executor/hashjoin.h: */
 typedef struct HashJoinTupleData *HashJoinTuple;
 typedef struct HashJoinTableData *HashJoinTable;
+typedef struct HashJoinSharedData *HashJoinShared;
+typedef struct HashJoinFilterData *HashJoinFilter;
 
 typedef struct HashJoinState
 {
@@ -1483,6 +1499,9 @@ typedef struct HashJoinState
 	bool		hj_NeedNewOuter;
 	bool		hj_MatchedOuter;
 	bool		hj_OuterNotEmpty;
+	HashJoinShared hj_Shared;
+	struct ParallelContext *hj_ParallelContext;
+	HashJoinFilter hj_Filter;
 } HashJoinState;
 
 
@@ -1571,6 +1590,16 @@ typedef struct AggState
 	List	   *hash_needed;	/* list of columns needed in hash table */
 	bool		table_filled;	/* hash table filled yet? */
 	TupleHashIterator hashiter; /* for iterating through hash table */
+	/* these fields are used when AGG_HASHED spills groups to disk: */
+	long		hash_mem;		/* approx. space used by hash table entries */
+	bool		hash_full;		/* hash table accepts no more groups? */
+	bool		hash_spilled;	/* has anything been spilled in this scan? */
+	int			hash_used_bits; /* hash bits used to route current input */
+	int			hash_nbits;		/* log2 of number of batches being written */
+	struct BufFile *hash_input; /* batch being read, or NULL for subplan */
+	struct BufFile **hash_spill;	/* batches being written, or NULL */
+	List	   *hash_batches;	/* batches waiting to be processed */
+	TupleTableSlot *hash_spillslot;		/* slot for reading batch files */
 } AggState;
 
 /* ----------------
@@ -1665,6 +1694,7 @@ typedef struct HashState
 	HashJoinTable hashtable;	/* hash table for the hashjoin */
 	List	   *hashkeys;		/* list of ExprState nodes */
 	/* hashkeys is same as parent's hj_InnerHashKeys */
+	HashJoinFilter filter;		/* Bloom filter to fill, or NULL */
 } HashState;
 
 /* ----------------
@@ -1746,4 +1776,29 @@ typedef struct LimitState
 	TupleTableSlot *subSlot;	/* tuple last obtained from subplan */
 } LimitState;
 
+/* ----------------
+ *	 GatherState information
+ *
+ *		Gather nodes launch parallel workers to run copies of their
+ *		parallel-aware subplan, and merge the workers' output with that of
+ *		the local copy.  Workers are launched at the first fetch.
+ *
+ * pei describes the subplan's shared state and the workers' parallel
+ * context, which is NULL if we got no workers.  reader[i] reads from the
+ * queue of one worker that is still sending tuples; nreaders counts those.
+ * ----------------
+ */
+typedef struct GatherState
+{
+	PlanState	ps;				/* its first field is NodeTag */
+	bool		initialized;	/* workers launched yet? */
+	struct ParallelExecutorInfo *pei;	/* shared state and workers */
+	int			nreaders;		/* number of live tuple queue readers */
+	struct shm_mq_handle **reader;	/* their handles */
+	struct shm_mq **reader_mq;	/* and the queues they read */
+	int			nextreader;		/* next reader to poll */
+	bool		need_to_scan_locally;	/* local copy not yet exhausted? */
+	TupleTableSlot *funnel_slot;	/* slot for tuples read from workers */
+} GatherState;
+
 #endif   /* EXECNODES_H */
@@ -2277,6 +2277,7 @@ typedef struct VacuumStmt
 	int			freeze_table_age;		/* age at which to scan whole table */
 	RangeVar   *relation;		/* single table to process, or NULL */
 	List	   *va_cols;		/* list of column names, or NIL for all */
+	int			parallel_workers;	/* # of workers for index vacuuming */
 } VacuumStmt;
 
 /* ----------------------
@@ -111,6 +111,12 @@ typedef struct Plan
 	List	   *initPlan;		/* Init Plan nodes (un-correlated expr
 								 * subselects) */
 
+	/*
+	 * Is this node to be run cooperatively by several processes?  Only
+	 * meaningful below a Gather node; see nodeGather.c.
+	 */
+	bool		parallel_aware;
+
 	/*
 	 * Information for management of parameter-change-driven rescanning
 	 *
@@ -273,6 +279,7 @@ typedef struct IndexScan
 	List	   *indexqual;		/* list of index quals (OpExprs) */
 	List	   *indexqualorig;	/* the same in original form */
 	ScanDirection indexorderdir;	/* forward or backward or don't care */
+	bool		indexonly;		/* attempt to skip heap fetches? */
 } IndexScan;
 
 /* ----------------
@@ -663,6 +670,20 @@ typedef struct Limit
 	Node	   *limitCount;		/* COUNT parameter, or NULL if none */
 } Limit;
 
+/* ----------------
+ *		gather node
+ *
+ * The subplan is run by up to num_workers parallel worker processes as well
+ * as by the backend itself, and their output is returned in no particular
+ * order.  Currently the subplan is always a parallel-aware SeqScan.
+ * ----------------
+ */
+typedef struct Gather
+{
+	Plan		plan;
+	int			num_workers;	/* number of workers to request */
+} Gather;
+
 
 /*
  * RowMarkType -
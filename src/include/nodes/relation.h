@@ -400,6 +400,7 @@ typedef struct RelOptInfo
 	List	   *joininfo;		/* RestrictInfo structures for join clauses
 								 * involving this rel */
 	bool		has_eclass_joins;		/* T means joininfo is incomplete */
+	bool		consider_parallel;		/* can workers scan this base rel? */
 
 	/* cached info about inner indexscan paths for relation: */
 	Relids		index_outer_relids;		/* other relids in indexable join
@@ -473,6 +474,7 @@ typedef struct IndexOptInfo
 	bool		amsearchnulls;	/* can AM search for NULL/NOT NULL entries? */
 	bool		amhasgettuple;	/* does AM have amgettuple interface? */
 	bool		amhasgetbitmap; /* does AM have amgetbitmap interface? */
+	bool		canreturn;		/* can AM return the indexed values? */
 } IndexOptInfo;
 
 
@@ -666,6 +668,7 @@ typedef struct IndexPath
 	List	   *indexquals;
 	bool		isjoininner;
 	ScanDirection indexscandir;
+	bool		indexonly;
 	Cost		indextotalcost;
 	Selectivity indexselectivity;
 	double		rows;			/* estimated number of result tuples */
@@ -810,6 +813,18 @@ typedef struct UniquePath
 	double		rows;			/* estimated number of result tuples */
 } UniquePath;
 
+/*
+ * GatherPath runs copies of its parallel-aware subpath in several processes
+ * and collects their output.  num_workers is the number of workers planned
+ * for; the leader takes part in the scan as well.
+ */
+typedef struct GatherPath
+{
+	Path		path;
+	Path	   *subpath;
+	int			num_workers;
+} GatherPath;
+
 /*
  * All join-type paths share these fields.
  */
@@ -63,6 +63,7 @@ extern WindowFuncLists *find_window_functions(Node *clause, Index maxWinRef);
 extern double expression_returns_set_rows(Node *clause);
 
 extern bool contain_subplans(Node *clause);
+extern bool has_parallel_hazard(Node *clause);
 
 extern bool contain_mutable_functions(Node *clause);
 extern bool contain_volatile_functions(Node *clause);
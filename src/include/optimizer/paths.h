@@ -73,6 +73,7 @@ extern List *expand_indexqual_conditions(IndexOptInfo *index,
 							List *clausegroups);
 extern void check_partial_indexes(PlannerInfo *root, RelOptInfo *rel);
 extern List *flatten_clausegroups_list(List *clausegroups);
+extern bool check_index_only(RelOptInfo *rel, IndexOptInfo *index);
 
 /*
  * orindxpath.c
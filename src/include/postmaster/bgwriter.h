@@ -1,7 +1,7 @@
 /*-------------------------------------------------------------------------
  *
  * bgwriter.h
- *	  Exports from postmaster/bgwriter.c.
+ *	  Exports from postmaster/bgwriter.c and postmaster/checkpointer.c.
  *
  * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
  *
@@ -22,7 +22,15 @@ extern int	CheckPointTimeout;
 extern int	CheckPointWarning;
 extern double CheckPointCompletionTarget;
 
+/*
+ * Fraction of a checkpoint's schedule set aside for fsyncing the files
+ * dirtied by the write phase.  BufferSync() paces its writes to use up the
+ * rest, and mdsync() spreads its fsyncs over this last part.
+ */
+#define CHECKPOINT_SYNC_SHARE	0.1
+
 extern void BackgroundWriterMain(void);
+extern void CheckpointerMain(void);
 
 extern void RequestCheckpoint(int flags);
 extern void CheckpointWriteDelay(int flags, double progress);
@@ -31,7 +39,9 @@ extern bool ForwardFsyncRequest(RelFileNodeBackend rnode, ForkNumber forknum,
 					BlockNumber segno);
 extern void AbsorbFsyncRequests(void);
 
-extern Size BgWriterShmemSize(void);
-extern void BgWriterShmemInit(void);
+extern Size CheckpointerShmemSize(void);
+extern void CheckpointerShmemInit(void);
+
+extern bool FirstCallSinceLastCheckpoint(void);
 
 #endif   /* _BGWRITER_H */
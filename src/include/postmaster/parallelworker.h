@@ -0,0 +1,94 @@
+/*-------------------------------------------------------------------------
+ *
+ * parallelworker.h
+ *	  header file for parallel worker processes
+ *
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef PARALLELWORKER_H
+#define PARALLELWORKER_H
+
+#include "storage/proc.h"
+#include "storage/shm_mq.h"
+
+/*
+ * What a parallel worker should do once it has connected to its leader's
+ * database.  Each value has an entry in the dispatch table in
+ * parallelworker.c.
+ */
+typedef enum ParallelWorkerEntry
+{
+	PARALLEL_ENTRY_QUERY,		/* run part of a query; see execParallel.c */
+	PARALLEL_ENTRY_COPY,		/* parse COPY FROM input; see copy.c */
+	PARALLEL_ENTRY_SORT,		/* sort index tuples; see tuplesort.c */
+	PARALLEL_ENTRY_VACUUM		/* vacuum indexes; see vacuumlazy.c */
+} ParallelWorkerEntry;
+
+/*
+ * Leader-side state for a group of parallel workers.  nworkers is the
+ * number of workers actually reserved, which may be less than requested,
+ * or even zero; the caller must be prepared to do all the work itself.
+ */
+typedef struct ParallelContext
+{
+	ParallelWorkerEntry entry;
+	int			nworkers;		/* number of workers reserved */
+	int		   *worker_slot;	/* shared slot number of each worker */
+	int			context_slot;	/* shared context slot, or -1 if none */
+	bool		launched;		/* LaunchParallelWorkers done? */
+	SubTransactionId subid;		/* creating subtransaction */
+	struct ParallelContext *next;	/* list of contexts in this xact */
+} ParallelContext;
+
+/* GUC variables */
+extern int	max_parallel_workers;
+extern int	parallel_shared_memory;
+
+/* worker number within its context; -1 if not a parallel worker */
+extern int	ParallelWorkerNumber;
+
+/* Status inquiry functions */
+extern bool IsParallelWorkerProcess(void);
+
+/* Leader-side functions */
+extern ParallelContext *CreateParallelContext(ParallelWorkerEntry entry,
+					  int nworkers);
+extern char *ParallelContextArgumentSpace(ParallelContext *pcxt, Size *size);
+extern char *ParallelContextSharedSpace(ParallelContext *pcxt, Size request,
+						   Size minimum, Size *size);
+extern shm_mq *ParallelWorkerQueue(ParallelContext *pcxt, int worker);
+extern void LaunchParallelWorkers(ParallelContext *pcxt);
+extern void CheckParallelWorkers(ParallelContext *pcxt);
+extern void WaitForParallelWorkersToFinish(ParallelContext *pcxt);
+extern void DestroyParallelContext(ParallelContext *pcxt);
+
+/* Worker-side functions */
+extern char *GetParallelWorkerArgumentSpace(Size *size);
+extern shm_mq *GetParallelWorkerQueue(void);
+extern PGPROC *GetParallelLeaderProc(void);
+
+/* Transaction end cleanup, called from xact.c */
+extern void AtEOXact_Parallel(bool isCommit);
+extern void AtEOSubXact_Parallel(bool isCommit, SubTransactionId mySubId);
+
+/* Functions to start parallel workers, called from postmaster */
+extern int	ParallelWorkerPendingSlot(void);
+extern int	StartParallelWorker(int slot);
+extern void ParallelWorkerForkFailed(int slot);
+
+#ifdef EXEC_BACKEND
+extern void ParallelWorkerMain(int argc, char *argv[]);
+extern void ParallelWorkerIAm(int slot);
+#endif
+
+/* shared memory stuff */
+extern Size ParallelWorkerShmemSize(void);
+extern void ParallelWorkerShmemInit(void);
+
+#endif   /* PARALLELWORKER_H */
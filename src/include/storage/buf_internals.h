@@ -109,7 +109,7 @@ typedef struct buftag
  * Note: buf_hdr_lock must be held to examine or change the tag, flags,
  * usage_count, refcount, or wait_backend_pid fields.  buf_id field never
  * changes after initialization, so does not need locking.	freeNext is
- * protected by the BufFreelistLock not buf_hdr_lock.  The LWLocks can take
+ * protected by the freelist's buffer_strategy_lock not buf_hdr_lock.  The LWLocks can take
  * care of themselves.	The buf_hdr_lock is *not* used to control access to
  * the data in the buffer!
  *
@@ -167,8 +167,24 @@ typedef struct sbufdesc
 #define UnlockBufHdr(bufHdr)	SpinLockRelease(&(bufHdr)->buf_hdr_lock)
 
 
+/*
+ * Entry of the array BufferSync() sorts to write a checkpoint's buffers in
+ * file order.  The tag fields are copied out of the buffer header when the
+ * buffer is marked BM_CHECKPOINT_NEEDED; buf_id identifies the buffer.
+ */
+typedef struct CkptSortItem
+{
+	Oid			tsId;
+	Oid			dbId;
+	Oid			relNode;
+	ForkNumber	forkNum;
+	BlockNumber blockNum;
+	int			buf_id;
+} CkptSortItem;
+
 /* in buf_init.c */
 extern PGDLLIMPORT BufferDesc *BufferDescriptors;
+extern CkptSortItem *CkptBufferIds;
 
 /* in localbuf.c */
 extern BufferDesc *LocalBufferDescriptors;
@@ -179,8 +195,7 @@ extern BufferDesc *LocalBufferDescriptors;
  */
 
 /* freelist.c */
-extern volatile BufferDesc *StrategyGetBuffer(BufferAccessStrategy strategy,
-				  bool *lock_held);
+extern volatile BufferDesc *StrategyGetBuffer(BufferAccessStrategy strategy);
 extern void StrategyFreeBuffer(volatile BufferDesc *buf);
 extern bool StrategyRejectBuffer(BufferAccessStrategy strategy,
 					 volatile BufferDesc *buf);
@@ -194,6 +209,7 @@ extern Size BufTableShmemSize(int size);
 extern void InitBufTable(int size);
 extern uint32 BufTableHashCode(BufferTag *tagPtr);
 extern int	BufTableLookup(BufferTag *tagPtr, uint32 hashcode);
+extern int	BufTableProbe(uint32 hashcode);
 extern int	BufTableInsert(BufferTag *tagPtr, uint32 hashcode, int buf_id);
 extern void BufTableDelete(BufferTag *tagPtr, uint32 hashcode);
 
@@ -35,9 +35,12 @@ typedef struct BufFile BufFile;
  */
 
 extern BufFile *BufFileCreateTemp(bool interXact);
+extern BufFile *BufFileCreateShared(Oid tblspcOid, const char *name);
+extern BufFile *BufFileOpenShared(Oid tblspcOid, const char *name);
 extern void BufFileClose(BufFile *file);
 extern size_t BufFileRead(BufFile *file, void *ptr, size_t size);
 extern size_t BufFileWrite(BufFile *file, void *ptr, size_t size);
+extern int	BufFileFlush(BufFile *file);
 extern int	BufFileSeek(BufFile *file, int fileno, off_t offset, int whence);
 extern void BufFileTell(BufFile *file, int *fileno, off_t *offset);
 extern int	BufFileSeekBlock(BufFile *file, long blknum);
@@ -48,8 +48,12 @@ extern PGDLLIMPORT int NBuffers;
 extern bool zero_damaged_pages;
 extern int	bgwriter_lru_maxpages;
 extern double bgwriter_lru_multiplier;
+extern int	checkpoint_flush_after;
 extern int	target_prefetch_pages;
 
+/* upper limit for checkpoint_flush_after */
+#define WRITEBACK_MAX_PENDING_FLUSHES	256
+
 /* in buf_init.c */
 extern PGDLLIMPORT char *BufferBlocks;
 extern PGDLLIMPORT int32 *PrivateRefCount;
@@ -61,8 +61,11 @@ extern int	max_files_per_process;
 /* Operations on virtual Files --- equivalent to Unix kernel file ops */
 extern File PathNameOpenFile(FileName fileName, int fileFlags, int fileMode);
 extern File OpenTemporaryFile(bool interXact);
+extern File OpenNamedTemporaryFile(Oid tblspcOid, const char *name,
+					   bool create);
 extern void FileClose(File file);
 extern int	FilePrefetch(File file, off_t offset, int amount);
+extern void FileWriteback(File file, off_t offset, off_t amount);
 extern int	FileRead(File file, char *buffer, int amount);
 extern int	FileWrite(File file, char *buffer, int amount);
 extern int	FileSync(File file);
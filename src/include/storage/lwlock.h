@@ -42,14 +42,13 @@
  */
 typedef enum LWLockId
 {
-	BufFreelistLock,
 	ShmemIndexLock,
 	OidGenLock,
 	XidGenLock,
 	ProcArrayLock,
 	SInvalReadLock,
 	SInvalWriteLock,
-	WALInsertLock,
+	WALBufMappingLock,
 	WALWriteLock,
 	ControlFileLock,
 	CheckpointLock,
@@ -59,7 +58,7 @@ typedef enum LWLockId
 	MultiXactOffsetControlLock,
 	MultiXactMemberControlLock,
 	RelCacheInitLock,
-	BgWriterCommLock,
+	CheckpointerCommLock,
 	TwoPhaseStateLock,
 	TablespaceCreateLock,
 	BtreeVacuumLock,
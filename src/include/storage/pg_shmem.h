@@ -38,6 +38,17 @@ typedef struct PGShmemHeader	/* standard header for all Postgres shmem */
 #endif
 } PGShmemHeader;
 
+/* Possible values for huge_pages */
+typedef enum
+{
+	HUGE_PAGES_OFF,
+	HUGE_PAGES_ON,
+	HUGE_PAGES_TRY
+} HugePagesType;
+
+/* GUC variable */
+extern int	huge_pages;			/* HugePagesType, but int for GUC enum */
+
 
 #ifdef EXEC_BACKEND
 #ifndef WIN32
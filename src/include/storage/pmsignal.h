@@ -29,6 +29,7 @@ typedef enum
 	PMSIGNAL_START_AUTOVAC_LAUNCHER,	/* start an autovacuum launcher */
 	PMSIGNAL_START_AUTOVAC_WORKER,		/* start an autovacuum worker */
 	PMSIGNAL_START_WALRECEIVER, /* start a walreceiver */
+	PMSIGNAL_START_PARALLEL_WORKER,		/* start parallel workers */
 
 	NUM_PMSIGNALS				/* Must be last value of enum! */
 } PMSignalReason;
@@ -14,6 +14,8 @@
 #ifndef _PROC_H_
 #define _PROC_H_
 
+#include "access/xlogdefs.h"
+#include "storage/latch.h"
 #include "storage/lock.h"
 #include "storage/pg_sema.h"
 #include "utils/timestamp.h"
@@ -28,17 +30,24 @@
  * If none of the caches have overflowed, we can assume that an XID that's not
  * listed anywhere in the PGPROC array is not a running transaction.  Else we
  * have to look at pg_subtrans.
+ *
+ * The number of cached XIDs and the overflow flag live in PGXACT; only the
+ * XIDs themselves are kept here.
  */
 #define PGPROC_MAX_CACHED_SUBXIDS 64	/* XXX guessed-at value */
 
 struct XidCache
 {
-	bool		overflowed;
-	int			nxids;
 	TransactionId xids[PGPROC_MAX_CACHED_SUBXIDS];
 };
 
-/* Flags for PGPROC->vacuumFlags */
+/*
+ * Number of relation locks a backend can hold in its PGPROC without going
+ * through the shared lock table.  Three bits per slot must fit in a uint64.
+ */
+#define		FP_LOCK_SLOTS_PER_BACKEND 16
+
+/* Flags for PGXACT->vacuumFlags */
 #define		PROC_IS_AUTOVACUUM	0x01	/* is it an autovac worker? */
 #define		PROC_IN_VACUUM		0x02	/* currently running lazy vacuum */
 #define		PROC_IN_ANALYZE		0x04	/* currently running analyze */
@@ -62,6 +71,9 @@ struct XidCache
  * distinguished from a real one at need by the fact that it has pid == 0.
  * The semaphore and lock-activity fields in a prepared-xact PGPROC are unused,
  * but its myProcLocks[] lists are valid.
+ *
+ * The fields that GetSnapshotData() and friends look at for every entry in
+ * the ProcArray are kept in a separate PGXACT struct; see below.
  */
 struct PGPROC
 {
@@ -71,30 +83,20 @@ struct PGPROC
 	PGSemaphoreData sem;		/* ONE semaphore to sleep on */
 	int			waitStatus;		/* STATUS_WAITING, STATUS_OK or STATUS_ERROR */
 
+	Latch		procLatch;		/* generic latch for process */
+
 	LocalTransactionId lxid;	/* local id of top-level transaction currently
 								 * being executed by this proc, if running;
 								 * else InvalidLocalTransactionId */
-
-	TransactionId xid;			/* id of top-level transaction currently being
-								 * executed by this proc, if running and XID
-								 * is assigned; else InvalidTransactionId */
-
-	TransactionId xmin;			/* minimal running XID as it was when we were
-								 * starting our xact, excluding LAZY VACUUM:
-								 * vacuum must not remove tuples deleted by
-								 * xid >= xmin ! */
-
 	int			pid;			/* Backend's process ID; 0 if prepared xact */
+	int			pgprocno;		/* index of this PGPROC and its PGXACT in
+								 * ProcGlobal's arrays; never changes */
 
 	/* These fields are zero while a backend is still starting up: */
 	BackendId	backendId;		/* This backend's backend ID (if assigned) */
 	Oid			databaseId;		/* OID of database this backend is using */
 	Oid			roleId;			/* OID of role using this backend */
 
-	bool		inCommit;		/* true if within commit critical section */
-
-	uint8		vacuumFlags;	/* vacuum-related flags, see above */
-
 	/*
 	 * While in hot standby mode, shows that a conflict signal has been sent
 	 * for the current transaction. Set/cleared while holding ProcArrayLock,
@@ -107,6 +109,12 @@ struct PGPROC
 	bool		lwExclusive;	/* true if waiting for exclusive access */
 	struct PGPROC *lwWaitLink;	/* next waiter for same LW lock */
 
+	/* Info about group WAL flush the process is waiting for, if any. */
+	bool		flushWaiting;	/* true if waiting for a flush leader */
+	bool		flushLeader;	/* true if handed the flush leadership */
+	XLogRecPtr	flushRqst;		/* WAL position we want flushed */
+	struct PGPROC *flushWaitLink;	/* next waiter in flush queue */
+
 	/* Info about lock the process is currently waiting for, if any. */
 	/* waitLock and waitProcLock are NULL if not currently waiting. */
 	LOCK	   *waitLock;		/* Lock object we're sleeping on ... */
@@ -123,6 +131,16 @@ struct PGPROC
 	SHM_QUEUE	myProcLocks[NUM_LOCK_PARTITIONS];
 
 	struct XidCache subxids;	/* cache for subtransaction XIDs */
+
+	/*
+	 * Weak relation locks taken without touching the shared lock table.
+	 * fpLockBits holds FAST_PATH_BITS_PER_SLOT bits for each slot of
+	 * fpRelId[]; see lock.c.  backendLock protects both, and must be held
+	 * by anyone else wanting to look at or transfer them.
+	 */
+	LWLockId	backendLock;	/* protects the fields below */
+	uint64		fpLockBits;		/* lock modes held for each fast-path slot */
+	Oid			fpRelId[FP_LOCK_SLOTS_PER_BACKEND];		/* slots for rel oids */
 };
 
 /* NOTE: "typedef struct PGPROC PGPROC" appears in storage/lock.h. */
@@ -130,16 +148,50 @@ struct PGPROC
 
 extern PGDLLIMPORT PGPROC *MyProc;
 
+/*
+ * Each PGPROC has a PGXACT holding the fields that other backends read for
+ * every entry in the ProcArray when computing a snapshot or a global xmin.
+ * The PGXACTs are kept together in their own array, ProcGlobal->allPgXact,
+ * so that GetSnapshotData() touches as few cache lines as possible even
+ * when there are a great many backends, most of them idle.
+ */
+typedef struct PGXACT
+{
+	TransactionId xid;			/* id of top-level transaction currently being
+								 * executed by this proc, if running and XID
+								 * is assigned; else InvalidTransactionId */
+
+	TransactionId xmin;			/* minimal running XID as it was when we were
+								 * starting our xact, excluding LAZY VACUUM:
+								 * vacuum must not remove tuples deleted by
+								 * xid >= xmin ! */
+
+	uint8		vacuumFlags;	/* vacuum-related flags, see above */
+	bool		overflowed;		/* has the subxid cache overflowed? */
+	bool		inCommit;		/* true if within commit critical section */
+	uint8		nxids;			/* number of XIDs cached in subxids */
+} PGXACT;
+
+extern PGDLLIMPORT PGXACT *MyPgXact;
+
 
 /*
  * There is one ProcGlobal struct for the whole database cluster.
  */
 typedef struct PROC_HDR
 {
+	/* Array of PGPROC structures, including dummies for prepared xacts */
+	PGPROC	   *allProcs;
+	/* Array of PGXACT structures, in the same order */
+	PGXACT	   *allPgXact;
+	/* Number of real PGPROCs, ie not including prepared-xact dummies */
+	uint32		allProcCount;
 	/* Head of list of free PGPROC structures */
 	PGPROC	   *freeProcs;
 	/* Head of list of autovacuum's free PGPROC structures */
 	PGPROC	   *autovacFreeProcs;
+	/* Head of list of parallel workers' free PGPROC structures */
+	PGPROC	   *parallelFreeProcs;
 	/* Current shared estimate of appropriate spins_per_delay value */
 	int			spins_per_delay;
 	/* The proc of the Startup process, since not in ProcArray */
@@ -149,15 +201,19 @@ typedef struct PROC_HDR
 	int			startupBufferPinWaitBufId;
 } PROC_HDR;
 
+extern PROC_HDR *ProcGlobal;
+
+extern PGPROC *PreparedXactProcs;
+
 /*
  * We set aside some extra PGPROC structures for auxiliary processes,
  * ie things that aren't full-fledged backends but need shmem access.
  *
- * Background writer and WAL writer run during normal operation. Startup
- * process and WAL receiver also consume 2 slots, but WAL writer is
- * launched only after startup has exited, so we only need 3 slots.
+ * Background writer, checkpointer and WAL writer run during normal
+ * operation.  Startup process and WAL receiver also consume 2 slots, but WAL
+ * writer is launched only after startup has exited, so we only need 4 slots.
  */
-#define NUM_AUXILIARY_PROCS		3
+#define NUM_AUXILIARY_PROCS		4
 
 
 /* configurable options */
@@ -43,6 +43,7 @@ extern void ExpireOldKnownAssignedTransactionIds(TransactionId xid);
 extern RunningTransactions GetRunningTransactionData(void);
 
 extern Snapshot GetSnapshotData(Snapshot snapshot);
+extern bool ProcArrayInstallParallelXmin(TransactionId xmin, PGPROC *leader);
 
 extern bool TransactionIdIsInProgress(TransactionId xid);
 extern bool TransactionIdIsActive(TransactionId xid);
@@ -61,7 +62,6 @@ extern VirtualTransactionId *GetCurrentVirtualXIDs(TransactionId limitXmin,
 extern VirtualTransactionId *GetConflictingVirtualXIDs(TransactionId limitXmin, Oid dbOid);
 extern pid_t CancelVirtualTransaction(VirtualTransactionId vxid, ProcSignalReason sigmode);
 
-extern int	CountActiveBackends(void);
 extern int	CountDBBackends(Oid databaseid);
 extern void CancelDBBackends(Oid databaseid, ProcSignalReason sigmode, bool conflictPending);
 extern int	CountUserBackends(Oid roleid);
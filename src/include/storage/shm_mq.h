@@ -0,0 +1,56 @@
+/*-------------------------------------------------------------------------
+ *
+ * shm_mq.h
+ *	  single-reader, single-writer shared memory message queue
+ *
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * $PostgreSQL$
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef SHM_MQ_H
+#define SHM_MQ_H
+
+#include "storage/proc.h"
+
+/* The queue itself, in shared memory. */
+struct shm_mq;
+typedef struct shm_mq shm_mq;
+
+/* Backend-private state used to read from a queue. */
+struct shm_mq_handle;
+typedef struct shm_mq_handle shm_mq_handle;
+
+/* Possible results of a send or receive operation. */
+typedef enum
+{
+	SHM_MQ_SUCCESS,				/* Sent or received a message. */
+	SHM_MQ_WOULD_BLOCK,			/* Not completed; retry later. */
+	SHM_MQ_DETACHED				/* Other process has detached queue. */
+} shm_mq_result;
+
+/* Setup functions. */
+extern shm_mq *shm_mq_create(void *address, Size size);
+extern void shm_mq_set_receiver(shm_mq *mq, PGPROC *proc);
+extern void shm_mq_set_sender(shm_mq *mq, PGPROC *proc);
+extern PGPROC *shm_mq_get_receiver(shm_mq *mq);
+
+/* Break connection. */
+extern void shm_mq_detach(shm_mq *mq);
+
+/* Send or receive messages. */
+extern shm_mq_result shm_mq_send(shm_mq *mq, Size nbytes, const void *data);
+extern shm_mq_result shm_mq_try_send(shm_mq *mq, Size nbytes,
+				const void *data);
+extern shm_mq_handle *shm_mq_attach(shm_mq *mq);
+extern void shm_mq_handle_free(shm_mq_handle *mqh);
+extern shm_mq_result shm_mq_receive(shm_mq_handle *mqh, Size *nbytesp,
+			   void **datap, bool nowait);
+
+/* Smallest possible queue. */
+extern PGDLLIMPORT const Size shm_mq_minimum_size;
+
+#endif   /* SHM_MQ_H */
@@ -93,7 +93,8 @@ typedef enum
 	DestTuplestore,				/* results sent to Tuplestore */
 	DestIntoRel,				/* results sent to relation (SELECT INTO) */
 	DestCopyOut,				/* results sent to COPY TO code */
-	DestSQLFunction				/* results sent to SQL-language func mgr */
+	DestSQLFunction,			/* results sent to SQL-language func mgr */
+	DestTupleQueue				/* results sent to tuple queue */
 } CommandDest;
 
 /* ----------------
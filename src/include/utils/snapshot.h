@@ -62,6 +62,12 @@ typedef struct SnapshotData
 	uint32		active_count;	/* refcount on ActiveSnapshot stack */
 	uint32		regd_count;		/* refcount on RegisteredSnapshotList */
 	bool		copied;			/* false if it's a static snapshot */
+
+	/*
+	 * Value of ShmemVariableCache->xactCompletionCount when the snapshot was
+	 * built, or 0 if it must not be reused.  See GetSnapshotData.
+	 */
+	uint64		snapXactCompletionCount;
 } SnapshotData;
 
 /*
@@ -66,6 +66,7 @@ extern Tuplesortstate *tuplesort_begin_datum(Oid datumType,
 					  int workMem, bool randomAccess);
 
 extern void tuplesort_set_bound(Tuplesortstate *state, int64 bound);
+extern void tuplesort_set_parallel(Tuplesortstate *state, int nworkers);
 
 extern void tuplesort_puttupleslot(Tuplesortstate *state,
 					   TupleTableSlot *slot);
@@ -101,6 +102,9 @@ extern void tuplesort_rescan(Tuplesortstate *state);
 extern void tuplesort_markpos(Tuplesortstate *state);
 extern void tuplesort_restorepos(Tuplesortstate *state);
 
+/* Entry point for a worker of a parallel sort */
+extern void ParallelSortMain(char *args, Size size);
+
 /* Setup for ApplySortFunction */
 extern void SelectSortFunction(Oid sortOperator, bool nulls_first,
 				   Oid *sortFunction,
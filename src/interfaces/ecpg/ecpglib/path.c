@@ -0,0 +1 @@
+../../../../src/port/path.c
\ No newline at end of file
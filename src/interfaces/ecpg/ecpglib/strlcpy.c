@@ -0,0 +1 @@
+../../../../src/port/strlcpy.c
\ No newline at end of file
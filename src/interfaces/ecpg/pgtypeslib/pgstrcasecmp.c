@@ -0,0 +1 @@
+../../../../src/port/pgstrcasecmp.c
\ No newline at end of file
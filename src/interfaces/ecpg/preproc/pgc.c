@@ -0,0 +1,3630 @@
+/* Generated by pyflex from pgc.l; do not edit. */
+#define FLEX_SCANNER
+#define YY_FLEX_MAJOR_VERSION 2
+#define YY_FLEX_MINOR_VERSION 5
+#define YY_FLEX_SUBMINOR_VERSION 35
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+typedef size_t yy_size_t;
+#ifndef YY_TYPEDEF_YY_BUFFER_STATE
+#define YY_TYPEDEF_YY_BUFFER_STATE
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+#endif
+#define YY_END_OF_BUFFER_CHAR 0
+#define YY_BUF_SIZE 16384
+#define YY_NULL 0
+#define YY_EXIT_FAILURE 2
+#define INITIAL 0
+#define C 1
+#define SQL 2
+#define incl 3
+#define def 4
+#define def_ident 5
+#define undef 6
+#define xb 7
+#define xc 8
+#define xd 9
+#define xdc 10
+#define xh 11
+#define xe 12
+#define xn 13
+#define xq 14
+#define xqc 15
+#define xdolq 16
+#define xcond 17
+#define xskip 18
+#define xui 19
+#define xus 20
+extern char *yytext;
+extern int yyleng;
+
+/*-------------------------------------------------------------------------
+ *
+ * pgc.l
+ *	  lexical scanner for ecpg
+ *
+ * This is a modified version of src/backend/parser/scan.l
+ *
+ *
+ * Portions Copyright (c) 1996-2010, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  $PostgreSQL: pgsql/src/interfaces/ecpg/preproc/pgc.l,v 1.173 2010/03/21 10:49:51 meskes Exp $
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres_fe.h"
+
+#include <ctype.h>
+#include <sys/types.h>
+#include <limits.h>
+
+#include "extern.h"
+
+extern YYSTYPE yylval;
+
+static int		xcdepth = 0;	/* depth of nesting in slash-star comments */
+static char	   *dolqstart;      /* current $foo$ quote start string */
+static YY_BUFFER_STATE scanbufhandle;
+static char *scanbuf;
+
+/*
+ * literalbuf is used to accumulate literal values when multiple rules
+ * are needed to parse a single literal.  Call startlit to reset buffer
+ * to empty, addlit to add text.  Note that the buffer is permanently
+ * malloc'd to the largest size needed so far in the current run.
+ */
+static char    *literalbuf = NULL;		/* expandable buffer */
+static int		literallen;				/* actual current length */
+static int		literalalloc;			/* current allocated buffer size */
+
+/* Used for detecting global state together with braces_open */
+static int		parenths_open;
+
+/* Used to tell parse_include() whether the command was #include or #include_next */
+static bool		include_next;
+
+#define startlit()	(literalbuf[0] = '\0', literallen = 0)
+static void addlit(char *ytext, int yleng);
+static void addlitchar (unsigned char);
+static void parse_include (void);
+static bool ecpg_isspace(char ch);
+static bool isdefine(void);
+static bool isinformixdefine(void);
+
+char *token_start;
+int state_before;
+
+struct _yy_buffer 
+{ 
+	YY_BUFFER_STATE		buffer;
+	long				lineno;
+	char		  		*filename;
+	struct _yy_buffer 	*next;
+} *yy_buffer = NULL;
+
+static char *old;
+
+#define MAX_NESTED_IF 128
+static short preproc_tos;
+static short ifcond;
+static struct _if_value 
+{
+	short condition;
+	short else_branch;
+} stacked_if_value[MAX_NESTED_IF];
+
+
+#ifndef YY_EXTRA_TYPE
+#define YY_EXTRA_TYPE void *
+#endif
+struct yy_buffer_state
+{
+	char *base;
+	char *end;
+	char *pos;
+	int at_bol;
+	int owns;
+};
+struct yyguts_t
+{
+	YY_EXTRA_TYPE yyextra_r;
+	YY_BUFFER_STATE cur;
+	char *c_buf_p;
+	char hold_char;
+	int at_bol;
+	int yy_start;
+	char *yytext_r;
+	int yyleng_r;
+};
+char *yytext;
+int yyleng;
+static struct yyguts_t yy_guts_static;
+#define yyg (&yy_guts_static)
+#define BEGIN (yyg->yy_start) =
+#define YY_START (yyg->yy_start)
+#define YYSTATE YY_START
+#define YY_CURRENT_BUFFER (yyg->cur)
+#define yyterminate() return YY_NULL
+#define YY_FATAL_ERROR(msg) yy_fatal_error(msg)
+#define yyless(n) do { int yyless_n = (n); *yyg->c_buf_p = yyg->hold_char; yyg->c_buf_p = yytext + yyless_n; yyleng = yyless_n; yyg->hold_char = *yyg->c_buf_p; *yyg->c_buf_p = 0; } while (0)
+#ifndef ECHO
+#define ECHO do { if (fwrite(yytext, yyleng, 1, stdout)) {} } while (0)
+#endif
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+#define YY_BREAK break;
+#define YY_RULE_SETUP if (yyleng > 0) yyg->at_bol = (yytext[yyleng - 1] == '\n'); YY_USER_ACTION
+void *yyalloc(yy_size_t);
+void *yyrealloc(void *, yy_size_t);
+void yyfree(void *);
+YY_BUFFER_STATE yy_create_buffer(FILE *file, int size);
+void yy_delete_buffer(YY_BUFFER_STATE b);
+void yy_switch_to_buffer(YY_BUFFER_STATE b);
+YY_BUFFER_STATE yy_scan_buffer(char *base, yy_size_t size);
+YY_BUFFER_STATE yy_scan_bytes(const char *bytes, int len);
+YY_BUFFER_STATE yy_scan_string(const char *str);
+void yyrestart(FILE *file);
+int yylex(void);
+static void yy_fatal_error(const char *msg);
+static const unsigned char yy_ec[256] = {0,0,0,0,0,0,0,0,0,1,2,0,1,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,20,20,20,20,20,20,21,21,22,23,24,25,26,27,27,28,29,30,31,32,33,34,34,35,34,34,36,37,38,39,40,41,42,43,44,45,34,34,46,34,34,47,48,49,50,51,27,28,29,30,31,32,33,34,34,52,34,34,36,37,38,39,40,41,42,43,44,45,34,34,53,34,34,54,55,56,27,0,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57};
+#define YY_NCLASSES 58
+static const short yy_nxt[44254] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,22,
+23,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,53,37,38,37,
+49,48,54,24,32,47,55,35,36,31,33,30,34,52,26,50,51,51,28,29,45,43,44,53,27,27,27,27,25,27,
+27,27,27,27,27,27,27,27,27,27,27,27,27,41,53,42,53,27,27,27,39,46,40,27,73,57,58,57,74,61,
+75,70,71,74,76,72,72,71,71,72,59,60,62,56,56,56,65,72,71,71,71,74,66,64,66,66,67,66,66,66,
+66,66,68,66,66,66,66,66,66,63,69,72,73,72,71,66,66,69,73,74,73,66,79,79,80,79,79,77,79,79,
+79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,81,78,79,81,79,79,79,79,79,79,79,79,79,79,79,
+79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,83,84,84,84,83,83,83,83,83,83,
+83,83,83,83,83,83,83,83,83,83,83,83,83,82,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
+83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,87,87,86,87,87,87,87,87,87,87,87,87,
+87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,85,85,85,85,85,85,85,85,85,85,85,85,85,85,
+85,85,85,85,85,87,87,87,87,85,85,85,87,87,87,85,88,88,90,88,88,88,88,88,88,88,88,88,88,88,
+88,88,88,88,88,88,88,88,88,88,88,88,88,88,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
+89,89,89,88,88,88,88,89,89,89,88,88,88,89,92,92,92,92,92,92,92,92,92,92,91,92,92,92,92,92,
+92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+92,92,92,92,92,92,92,92,92,92,92,92,94,94,94,94,95,94,95,94,95,95,94,94,94,93,95,94,95,94,
+96,94,94,94,94,94,95,95,95,95,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+94,94,95,94,94,94,94,95,94,94,98,98,98,98,98,97,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,100,100,100,100,100,101,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,
+100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,99,100,100,100,
+100,100,100,100,100,100,103,103,103,103,103,103,103,103,103,103,102,103,103,103,103,103,103,103,103,103,103,103,103,103,
+103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,
+103,103,103,103,106,106,107,106,106,106,106,106,106,106,105,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,
+106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,104,106,106,106,106,106,106,106,
+106,106,109,109,109,109,109,109,109,109,109,109,108,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+109,109,109,109,109,109,109,109,109,109,110,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+109,109,109,109,109,109,109,109,112,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,111,109,109,109,109,109,109,109,109,109,113,113,114,113,
+113,113,113,115,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,117,117,116,117,117,117,
+117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,118,118,118,118,118,118,118,118,
+118,118,118,118,118,118,118,118,118,118,118,117,117,117,117,118,118,118,117,117,117,118,121,122,123,122,121,121,121,120,
+121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,119,121,121,121,121,121,
+121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,98,98,98,98,98,124,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,109,109,109,109,109,109,109,109,109,109,125,109,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,129,126,0,0,127,0,0,0,0,0,0,0,0,0,128,0,0,
+0,0,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,
+131,131,0,0,0,0,0,0,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,130,0,0,0,
+0,131,131,130,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,0,0,132,0,0,0,0,133,0,0,0,
+0,0,0,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,0,0,
+0,0,0,0,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,0,131,131,131,
+0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,136,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,138,0,0,0,0,0,0,0,0,0,0,137,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,139,0,0,0,0,0,0,0,0,141,140,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,143,143,143,0,0,142,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,143,143,143,0,0,142,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,146,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,147,0,0,0,0,0,0,
+0,0,0,0,0,148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,151,0,150,150,150,0,0,0,0,0,0,0,0,0,0,153,0,0,0,0,0,0,0,
+0,0,0,0,0,0,152,0,0,0,0,0,0,152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,151,0,150,150,150,0,0,0,0,0,0,0,0,0,0,153,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,154,
+0,0,0,0,0,155,155,155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,156,158,158,158,158,158,158,158,158,158,158,158,158,
+158,158,158,158,157,158,158,158,158,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,0,159,159,159,
+0,0,0,0,0,0,0,0,0,0,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,58,58,58,0,0,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,58,58,58,0,0,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,164,0,164,0,164,164,0,0,0,164,164,0,163,0,164,0,0,0,0,0,164,164,164,164,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,0,0,0,0,164,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,166,0,165,165,165,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+164,0,164,0,164,164,0,0,0,167,164,0,164,0,164,0,0,0,0,0,164,164,164,164,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,0,0,0,0,164,0,0,0,0,0,0,0,0,
+0,169,0,168,0,0,0,0,0,0,0,0,0,169,169,169,0,0,0,0,0,0,169,169,169,169,169,169,169,169,
+169,169,169,169,169,169,169,169,169,169,169,0,0,0,0,169,169,169,0,0,0,169,0,0,0,0,0,0,0,169,
+0,0,170,0,0,0,0,0,0,0,0,169,169,169,0,0,0,0,0,0,169,169,169,169,169,169,169,169,169,169,
+169,169,169,169,169,169,169,169,169,0,0,0,0,169,169,169,0,0,0,169,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,171,0,0,172,0,0,173,173,173,173,173,173,173,173,173,173,173,173,
+173,173,173,173,173,173,173,0,0,0,0,173,173,173,0,0,0,173,0,0,0,0,0,0,0,169,0,0,0,0,
+0,0,0,0,0,0,0,169,169,169,0,0,0,0,0,0,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+169,169,169,169,169,0,0,0,0,169,169,169,0,0,0,169,0,0,0,0,0,0,0,169,0,0,174,0,0,0,
+0,0,0,0,0,169,169,169,0,0,0,0,0,0,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+169,169,169,0,0,0,0,169,169,169,0,0,0,169,0,0,0,0,0,0,0,169,0,0,175,0,0,0,0,0,
+0,0,0,169,169,169,0,0,0,0,0,0,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+169,0,0,0,0,169,169,169,0,0,0,169,0,0,0,0,0,0,0,169,0,0,176,0,0,0,0,0,0,0,
+0,169,169,169,0,0,0,0,0,0,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,0,
+0,0,0,169,169,169,0,0,0,169,0,0,0,0,0,0,0,178,0,0,0,0,0,0,0,0,0,0,0,179,
+179,179,0,0,0,0,0,0,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,0,0,0,
+0,177,177,177,0,0,0,177,0,0,0,0,164,0,164,0,164,164,0,0,0,164,164,0,164,0,164,0,0,0,
+0,0,164,164,164,164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,0,
+0,0,0,164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,164,0,164,0,164,164,0,0,0,164,164,0,164,0,164,0,0,0,0,0,164,164,164,164,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,0,0,0,0,164,0,0,
+158,158,158,158,180,158,180,158,180,180,158,158,158,180,180,158,180,158,180,158,158,158,158,158,180,180,180,180,158,158,
+158,158,158,158,158,181,158,158,158,158,158,158,158,158,158,158,158,158,158,158,180,158,182,158,158,180,158,158,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,183,183,183,183,
+183,0,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,184,184,184,184,184,184,
+184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,0,184,184,184,184,184,184,184,184,184,
+184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,185,185,185,185,185,0,185,185,
+185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,186,0,185,0,185,185,185,185,185,185,185,185,185,185,185,
+185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,0,185,185,185,185,
+185,185,185,185,185,185,185,185,185,185,185,185,185,186,0,185,0,185,185,185,185,185,185,185,185,185,185,185,185,185,
+185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,187,187,187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,0,0,0,0,0,0,0,0,0,0,0,188,
+188,188,0,0,0,0,0,0,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,0,0,0,
+0,188,188,188,0,0,0,188,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,191,191,191,0,0,0,190,0,0,0,0,0,0,0,0,0,0,0,190,190,190,0,189,0,0,0,0,
+190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,0,0,0,0,190,190,190,0,0,0,190,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,
+193,193,0,0,0,0,0,0,0,0,0,0,0,0,194,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,92,92,92,
+92,92,92,92,92,92,0,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,0,0,0,0,0,0,
+0,0,0,0,0,0,0,195,0,0,0,0,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,94,94,94,94,94,94,94,94,
+94,94,94,94,94,0,94,94,94,94,0,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+94,94,94,0,94,94,94,94,0,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,0,0,0,0,0,0,0,0,0,0,0,0,
+0,197,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,198,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,98,98,98,98,0,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,0,0,0,0,0,199,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+200,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,201,202,202,0,0,0,0,0,0,0,0,0,0,0,0,203,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,103,103,103,103,103,103,103,103,103,103,0,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,
+103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,
+103,103,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,206,206,205,205,205,205,205,205,205,
+205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,205,204,205,205,205,205,
+0,210,208,208,0,0,0,0,0,0,209,0,0,0,0,0,207,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,107,107,
+107,107,107,107,107,107,107,107,0,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,0,107,107,107,107,107,107,107,107,107,107,107,107,107,
+107,107,107,107,107,107,0,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+107,107,107,107,107,107,107,107,107,107,107,107,107,107,0,107,107,107,107,107,107,107,107,107,0,213,212,212,0,0,
+0,0,0,0,209,0,0,0,0,0,211,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,109,109,109,109,109,109,109,109,
+109,109,0,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,0,215,216,216,0,0,0,0,0,0,
+209,0,0,0,0,0,214,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,109,109,109,109,109,109,109,109,109,109,217,109,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,0,215,216,216,0,0,0,0,0,0,0,0,0,0,
+0,0,214,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,114,114,114,114,114,114,0,114,114,114,114,114,114,114,114,
+114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,
+114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,0,114,114,114,114,114,114,114,114,114,114,
+114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,
+114,114,114,114,114,114,114,114,114,114,0,0,0,0,0,0,0,219,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,218,218,218,218,218,218,218,218,218,218,218,218,218,218,218,218,218,218,218,0,0,0,
+0,218,218,218,0,0,0,218,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,221,221,221,0,0,0,220,0,0,0,0,0,0,0,0,0,0,0,220,220,220,0,222,0,0,
+0,0,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,0,0,0,0,220,220,220,0,0,
+0,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,223,0,0,0,0,0,0,223,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,126,0,0,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,225,225,225,0,198,0,0,
+0,0,0,0,0,0,0,0,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,227,0,0,0,0,0,0,0,0,0,0,0,0,0,230,229,229,0,0,0,0,0,0,
+209,0,0,0,0,0,228,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,231,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,0,233,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,234,0,0,0,0,235,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,236,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,237,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,
+131,131,0,0,0,0,0,0,131,131,131,131,238,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,
+0,131,131,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,
+0,0,0,0,0,0,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,0,131,
+131,131,0,0,0,131,0,0,0,0,239,0,239,0,239,239,0,0,0,239,239,0,239,0,239,0,0,0,0,0,
+239,239,239,239,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,239,0,0,0,
+0,239,0,0,240,240,241,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,
+240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,
+240,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,242,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,156,158,158,158,158,158,158,158,158,
+158,158,158,158,158,158,158,158,157,158,158,158,158,158,0,143,143,143,0,0,142,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,151,0,150,150,150,0,0,0,0,0,0,0,0,
+0,0,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,243,243,0,0,0,0,0,0,0,0,0,0,
+153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,244,244,0,0,0,0,0,0,244,244,244,244,244,244,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,245,0,245,0,0,246,246,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,155,155,155,0,0,0,0,0,0,0,0,0,0,153,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,249,249,254,250,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,251,251,251,251,251,252,251,251,251,248,247,251,251,251,
+251,251,251,251,251,249,253,249,249,249,251,251,249,249,249,249,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,257,0,0,0,256,255,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,
+251,249,253,249,249,249,251,251,249,249,249,249,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,
+0,258,258,258,0,0,0,0,0,0,0,0,0,0,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,259,
+259,259,0,0,0,0,0,0,0,0,0,0,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,260,0,260,0,0,246,246,246,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,
+158,158,158,158,158,158,158,158,158,158,158,181,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,158,182,158,
+158,158,158,158,261,261,0,0,262,261,262,261,262,262,261,261,261,262,262,261,262,261,262,261,261,261,261,261,262,262,
+262,262,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,262,261,261,261,261,262,
+261,261,0,0,0,0,164,0,164,0,164,164,0,0,0,164,164,0,164,0,164,0,0,0,0,0,164,164,164,164,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,0,0,0,0,164,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,165,165,165,0,0,0,0,0,0,0,0,
+0,0,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+263,0,263,0,263,263,0,0,0,263,263,0,263,0,263,0,0,0,0,0,263,263,263,263,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,263,0,0,0,0,263,0,0,0,0,0,0,0,265,
+0,0,0,0,264,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,169,
+0,0,0,0,0,0,0,0,0,0,0,169,169,169,0,0,0,0,0,0,169,169,169,169,169,169,169,169,169,169,
+169,169,169,169,169,169,169,169,169,0,0,0,0,169,169,169,0,0,0,169,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,266,0,0,0,0,0,0,0,0,
+267,268,0,266,266,266,0,0,0,0,0,0,266,266,266,266,266,266,266,266,266,266,266,266,266,266,266,266,266,266,
+266,269,0,0,0,266,266,266,0,0,0,266,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,178,0,0,0,0,0,0,0,0,0,0,0,270,270,270,0,0,
+0,0,0,0,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,0,0,0,0,270,270,270,
+0,0,0,270,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,179,179,179,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+249,249,254,250,271,249,271,249,271,271,249,249,249,271,271,249,271,249,271,249,249,249,249,249,271,271,271,271,251,251,
+251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,249,253,249,271,249,251,251,249,271,249,249,249,249,
+254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,251,251,251,251,
+251,252,251,251,251,248,251,251,251,251,251,251,251,251,251,249,253,249,249,249,251,251,249,249,249,249,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,257,
+0,0,0,256,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,183,183,183,183,183,272,
+183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,
+183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,184,184,184,184,184,184,184,184,
+184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,273,184,184,184,184,184,184,184,184,184,184,184,
+184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,184,185,185,185,185,185,0,185,185,185,185,
+185,185,185,185,185,185,185,185,185,185,185,185,185,186,0,185,0,185,185,185,185,185,185,185,185,185,185,185,185,185,
+185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,185,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,187,187,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,0,0,0,0,0,0,0,0,
+0,0,0,188,188,188,0,0,0,0,0,0,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,188,
+188,0,0,0,0,188,188,188,0,0,0,188,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,191,191,191,0,0,0,190,0,0,0,0,0,0,0,0,0,0,0,190,
+190,190,0,189,0,0,0,0,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,190,0,0,0,
+0,190,190,190,0,0,0,190,0,191,191,191,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,189,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,192,193,193,0,0,0,0,0,0,0,0,0,0,0,0,194,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,274,274,274,0,0,0,0,0,0,276,0,0,0,0,0,275,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,277,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,195,0,0,0,0,196,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+278,0,278,0,278,278,0,0,0,278,278,0,278,0,278,0,0,0,0,0,278,278,278,278,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,278,0,0,0,0,278,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,201,202,202,0,0,0,0,0,0,0,0,
+0,0,0,0,203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,279,279,279,0,0,0,0,0,0,281,0,0,0,
+0,0,280,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+282,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,283,283,283,0,0,0,0,0,0,283,283,283,283,283,283,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,284,284,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,285,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,286,286,286,0,0,0,0,0,0,288,0,0,0,0,0,287,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,210,208,208,0,0,0,0,0,0,0,0,0,0,0,0,207,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,289,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,290,290,290,
+0,0,0,0,0,0,288,0,0,0,0,0,291,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,213,212,212,0,0,
+0,0,0,0,0,0,0,0,0,0,211,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,292,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,215,216,216,0,0,0,0,0,0,
+0,0,0,0,0,0,214,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,294,294,294,0,0,0,0,0,0,288,0,
+0,0,0,0,293,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,219,0,0,0,0,0,0,0,0,
+0,0,0,295,295,295,0,0,0,0,0,0,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,
+295,0,0,0,0,295,295,295,0,0,0,295,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,221,221,221,0,0,0,220,0,0,0,0,0,0,0,0,0,0,0,220,
+220,220,0,222,0,0,0,0,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,0,0,0,
+0,220,220,220,0,0,0,220,0,221,221,221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,296,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,234,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,225,225,225,0,0,0,0,0,0,0,0,0,0,0,0,226,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,227,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,297,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,298,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,299,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,300,300,300,0,0,0,0,
+0,0,288,0,0,0,0,0,301,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,231,0,0,0,0,0,0,0,0,0,0,0,0,0,230,229,229,0,0,0,0,0,0,
+0,0,0,0,0,0,228,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,231,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,302,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,303,0,0,0,0,0,0,0,304,
+0,0,0,0,0,0,0,0,303,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,305,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,307,0,0,0,0,0,0,306,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,309,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,310,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,0,0,0,0,
+0,0,131,131,311,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,0,131,131,131,0,0,
+0,131,0,0,0,0,239,0,239,0,239,239,0,0,0,239,239,0,239,0,239,0,0,0,0,0,239,239,239,239,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,239,0,0,0,0,239,0,0,
+240,240,241,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,
+240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,240,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,243,243,243,0,0,0,0,0,0,0,0,0,0,153,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,244,244,244,0,0,0,0,0,0,244,244,244,244,244,244,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,246,246,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,246,246,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,249,249,254,250,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,251,251,312,251,251,251,251,251,251,251,251,251,251,251,251,251,
+251,251,251,249,253,249,249,249,251,251,249,249,249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,251,251,251,251,251,251,251,251,251,251,251,251,313,251,251,251,251,251,
+251,249,253,249,249,249,251,251,249,249,249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+253,249,249,249,249,249,249,249,249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,253,249,
+249,249,249,249,249,249,249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,249,253,249,249,249,
+251,251,249,249,249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,251,251,251,314,251,251,251,251,251,251,315,251,251,251,251,251,251,251,251,249,253,249,249,249,251,251,
+249,249,249,249,249,316,318,317,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,253,249,249,249,249,249,249,249,
+249,249,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+319,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,320,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,249,249,254,250,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,321,249,249,
+249,249,249,249,322,249,249,249,249,249,249,249,249,249,253,249,249,249,249,249,249,249,249,249,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,160,0,323,323,323,0,0,0,0,0,0,0,0,0,0,161,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,325,0,324,324,324,0,0,0,0,0,0,0,0,0,0,161,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,246,246,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,261,261,0,0,261,261,261,261,261,261,261,261,
+261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,0,0,262,261,262,261,262,262,261,261,261,262,
+262,261,262,261,262,261,261,261,261,261,262,262,262,262,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,261,
+261,261,261,261,261,261,262,261,261,261,261,262,261,261,0,0,0,0,263,0,263,0,263,263,0,0,0,263,263,0,
+263,0,263,0,0,0,0,0,263,263,263,263,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,263,0,0,0,0,263,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,266,0,0,0,0,0,0,0,0,267,268,0,266,266,266,
+0,0,0,0,0,0,266,266,266,266,266,266,266,266,266,266,266,266,266,266,266,266,266,266,266,269,0,0,0,266,
+266,266,0,0,0,266,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,326,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,0,0,0,0,327,327,327,0,0,
+0,327,0,328,328,328,0,0,0,332,330,0,0,330,330,330,330,0,329,330,330,332,332,332,0,0,0,0,330,0,
+332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,330,0,331,0,332,332,332,0,0,0,332,
+0,0,0,0,0,0,0,178,0,0,0,0,0,0,0,0,0,0,0,270,270,270,0,0,0,0,0,0,270,270,
+270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,0,0,0,0,270,270,270,0,0,0,270,249,249,
+254,250,271,249,271,249,271,271,249,249,249,271,271,249,271,249,271,249,249,249,249,249,271,271,271,271,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,253,249,271,249,249,249,249,271,249,249,0,334,334,334,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,333,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,336,336,336,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,335,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,274,274,274,0,0,0,0,
+0,0,276,0,0,0,0,0,275,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,337,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,338,339,193,193,338,338,338,338,338,338,338,338,338,338,
+338,338,340,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,
+338,338,338,338,338,338,338,338,338,338,338,338,338,338,0,0,0,0,278,0,278,0,278,278,0,0,0,278,278,0,
+278,0,278,0,0,0,0,0,278,278,278,278,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,278,0,0,0,0,278,0,0,0,279,279,279,0,0,0,0,0,0,281,0,0,0,0,0,280,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,341,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,344,342,202,202,344,344,344,344,344,344,344,344,344,344,344,344,343,344,344,344,344,344,344,344,
+344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,
+344,344,344,344,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,345,345,345,0,0,0,0,
+0,0,345,345,345,345,345,345,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,346,346,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+348,349,208,208,348,348,348,348,348,348,348,348,348,348,348,348,347,348,348,348,348,348,348,348,348,348,348,348,348,348,
+348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,0,286,
+286,286,0,0,0,0,0,0,288,0,0,0,0,0,287,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,350,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,352,353,212,212,352,352,352,352,
+352,352,352,352,352,352,352,352,351,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,
+352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,0,290,290,290,0,0,0,0,0,0,
+288,0,0,0,0,0,291,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,354,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,356,357,216,216,356,356,356,356,356,356,356,356,356,356,
+356,356,355,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,
+356,356,356,356,356,356,356,356,356,356,356,356,356,356,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+358,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,294,294,294,0,0,0,0,0,0,288,0,0,0,0,0,293,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,219,0,0,0,0,0,0,0,0,0,0,0,295,
+295,295,0,0,0,0,0,0,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,295,0,0,0,
+0,295,295,295,0,0,0,295,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,359,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,362,360,225,225,362,362,362,362,362,362,362,362,362,362,362,362,361,362,362,362,362,362,362,362,
+362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,363,362,362,362,362,362,362,362,362,
+362,362,362,362,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,364,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,366,367,229,229,366,366,366,366,366,366,366,366,366,366,366,366,365,366,366,366,366,366,366,366,366,366,366,366,
+366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,368,366,366,366,366,366,366,366,366,366,366,366,366,
+0,300,300,300,0,0,0,0,0,0,288,0,0,0,0,0,301,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,231,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,369,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,370,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,371,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,372,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,373,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,373,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,374,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,375,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,376,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,377,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,378,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,378,0,0,0,0,0,0,379,379,379,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,
+0,0,0,0,0,0,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,380,131,131,131,0,0,0,0,131,
+131,131,0,0,0,131,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,251,251,251,251,251,251,251,251,381,251,251,251,251,251,251,251,251,251,251,249,253,249,249,249,251,251,
+249,249,249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,251,251,251,251,251,251,251,251,251,251,251,382,251,251,251,251,251,251,251,249,253,249,249,249,251,251,249,249,
+249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+251,251,251,251,383,251,251,251,251,251,251,251,251,251,251,251,251,251,251,249,253,249,249,249,251,251,249,249,249,249,
+249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,251,251,
+251,384,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,249,253,249,249,249,251,251,249,249,249,249,249,249,
+254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,253,249,249,249,249,249,249,249,249,249,249,249,254,250,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,253,249,249,249,249,249,249,249,249,249,249,249,254,250,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,253,249,249,249,249,249,249,249,249,249,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,385,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,386,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,249,249,254,250,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,387,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,253,249,249,249,249,249,249,249,249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,388,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,253,249,249,249,249,249,249,249,249,249,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,389,0,323,323,323,0,0,0,0,0,0,0,0,0,0,161,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,325,
+0,390,390,390,0,0,0,0,0,0,0,0,0,0,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,391,
+391,391,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,327,0,0,0,0,327,
+327,327,0,0,0,327,0,0,0,0,0,0,0,392,0,0,0,0,0,0,0,0,267,268,0,392,392,392,0,0,
+0,0,0,0,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,392,269,0,0,0,392,392,392,
+0,0,0,392,0,328,328,328,0,0,0,332,330,0,0,330,330,330,330,0,329,330,330,332,332,332,0,0,0,0,
+330,0,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,330,0,331,0,332,332,332,0,0,
+0,332,0,328,328,328,0,0,0,332,330,0,0,330,330,330,330,0,393,330,330,332,332,332,0,0,0,0,330,0,
+332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,330,0,331,0,332,332,332,0,0,0,332,
+0,328,328,328,0,0,0,332,330,0,0,330,330,330,330,0,329,330,330,332,332,332,0,0,0,0,330,0,332,332,
+332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,330,0,331,0,332,332,332,0,0,0,332,0,328,
+328,328,0,0,0,332,330,0,0,330,330,330,330,0,394,395,330,332,332,332,0,0,0,0,330,0,332,332,332,332,
+332,332,332,332,332,332,332,332,332,332,332,332,332,332,332,396,0,331,0,332,332,332,0,0,0,332,0,328,328,328,
+0,0,0,332,330,0,0,330,330,330,330,0,329,330,330,332,332,332,0,0,0,0,330,0,332,332,332,332,332,332,
+332,332,332,332,332,332,332,332,332,332,332,332,332,330,0,331,0,332,332,332,0,0,0,332,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,334,334,334,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,336,336,336,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,335,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,399,397,274,274,399,399,399,399,399,399,400,399,399,399,
+399,399,398,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,
+399,399,399,399,399,399,399,399,399,399,399,399,399,399,338,339,193,193,338,338,338,338,338,338,338,338,338,338,338,338,
+340,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,
+338,338,338,338,338,338,338,338,338,338,338,338,338,339,193,193,338,338,338,338,338,338,338,338,338,338,338,338,340,338,
+338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,
+338,338,338,338,338,338,338,338,338,338,338,339,193,193,338,338,338,338,338,338,338,338,338,338,338,338,401,338,338,338,
+338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,
+338,338,338,338,338,338,338,338,402,403,279,279,402,402,402,402,402,402,404,402,402,402,402,402,405,402,402,402,402,402,
+402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,
+402,402,402,402,402,402,344,342,202,202,344,344,344,344,344,344,344,344,344,344,344,344,343,344,344,344,344,344,344,344,
+344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,
+344,344,344,344,344,342,202,202,344,344,344,344,344,344,344,344,344,344,344,344,406,344,344,344,344,344,344,344,344,344,
+344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,
+344,344,344,342,202,202,344,344,344,344,344,344,344,344,344,344,344,344,343,344,344,344,344,344,344,344,344,344,344,344,
+344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,348,349,208,208,
+348,348,348,348,348,348,348,348,348,348,348,348,407,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,
+348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,349,208,208,348,348,
+348,348,348,348,348,348,348,348,348,348,347,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,
+348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,349,208,208,348,348,348,348,
+348,348,348,348,348,348,348,348,347,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,
+348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,410,408,286,286,410,410,410,410,410,410,
+411,410,410,410,410,410,409,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,
+410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,352,353,212,212,352,352,352,352,352,352,352,352,
+352,352,352,352,412,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,
+352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,353,212,212,352,352,352,352,352,352,352,352,352,352,
+352,352,351,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,
+352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,353,212,212,352,352,352,352,352,352,352,352,352,352,352,352,
+351,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,
+352,352,352,352,352,352,352,352,352,352,352,352,415,413,290,290,415,415,415,415,415,415,416,415,415,415,415,415,414,415,
+415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,
+415,415,415,415,415,415,415,415,415,415,356,357,216,216,356,356,356,356,356,356,356,356,356,356,356,356,417,356,356,356,
+356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,
+356,356,356,356,356,356,356,356,356,357,216,216,356,356,356,356,356,356,356,356,356,356,356,356,355,356,356,356,356,356,
+356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,
+356,356,356,356,356,356,356,357,216,216,356,356,356,356,356,356,356,356,356,356,356,356,355,356,356,356,356,356,356,356,
+356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,
+356,356,356,356,419,420,294,294,419,419,419,419,419,419,421,419,419,419,419,419,418,419,419,419,419,419,419,419,419,419,
+419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,
+419,419,0,422,422,422,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,423,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+362,360,225,225,362,362,362,362,362,362,362,362,362,362,362,362,361,362,362,362,362,362,362,362,362,362,362,362,362,362,
+362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,363,362,362,362,362,362,362,362,362,362,362,362,362,362,360,
+225,225,362,362,362,362,362,362,362,362,362,362,362,362,424,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,
+362,362,362,362,362,362,362,362,362,362,362,362,362,363,362,362,362,362,362,362,362,362,362,362,362,362,362,360,225,225,
+362,362,362,362,362,362,362,362,362,362,362,362,361,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,
+362,362,362,362,362,362,362,362,362,362,362,363,362,362,362,362,362,362,362,362,362,362,362,362,362,360,225,225,362,362,
+362,362,362,362,362,362,362,362,362,362,361,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,425,362,362,362,
+362,362,362,362,362,362,362,362,362,363,362,362,362,362,362,362,362,362,362,362,362,362,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,426,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,366,367,229,229,366,366,366,366,366,366,
+366,366,366,366,366,366,427,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,
+366,366,366,366,366,368,366,366,366,366,366,366,366,366,366,366,366,366,366,367,229,229,366,366,366,366,366,366,366,366,
+366,366,366,366,365,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,
+366,366,366,368,366,366,366,366,366,366,366,366,366,366,366,366,366,367,229,229,366,366,366,366,366,366,366,366,366,366,
+366,366,365,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,
+366,368,366,366,366,366,366,366,366,366,366,366,366,366,366,367,229,229,366,366,366,366,366,366,366,366,366,366,366,366,
+365,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,428,366,366,366,366,366,366,366,366,366,366,366,366,368,
+366,366,366,366,366,366,366,366,366,366,366,366,431,429,300,300,431,431,431,431,431,431,432,431,431,431,431,431,430,431,
+431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,433,431,431,
+431,431,431,431,431,431,431,431,431,431,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,434,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,435,435,435,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,436,436,436,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,437,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,438,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,439,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,440,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,441,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,442,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,443,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,379,379,379,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,444,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,0,0,
+0,0,0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,131,131,131,131,131,131,131,131,131,
+131,445,131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,249,249,254,250,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,251,251,251,251,251,251,251,251,251,251,251,251,251,251,
+251,251,251,446,251,249,253,249,249,249,251,251,249,249,249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,251,251,251,251,251,251,251,251,251,251,251,251,251,251,447,251,
+251,251,251,249,253,249,249,249,251,251,249,249,249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,251,251,251,251,251,448,251,251,251,251,251,251,251,251,251,251,251,251,
+251,249,253,249,249,249,251,251,249,249,249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,251,251,251,251,449,251,251,251,251,251,251,251,251,251,251,251,251,251,251,249,
+253,249,249,249,251,251,249,249,249,249,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,450,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,451,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,452,249,249,249,249,249,249,249,249,249,249,249,249,249,249,253,249,249,249,249,249,
+249,249,249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,453,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,253,249,249,249,249,249,249,249,
+249,249,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,454,454,454,0,0,0,0,0,0,
+0,0,0,0,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,325,0,454,454,454,0,0,0,0,0,0,0,0,
+0,0,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,455,0,456,456,456,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,392,0,0,0,0,0,0,0,0,267,268,0,392,392,392,0,0,0,0,0,0,392,392,392,392,392,392,
+392,392,392,392,392,392,392,392,392,392,392,392,392,269,0,0,0,392,392,392,0,0,0,392,460,458,328,328,460,460,
+460,457,461,460,460,461,461,461,461,460,459,461,461,457,457,457,460,460,460,460,461,460,457,457,457,457,457,457,457,457,
+457,457,457,457,457,457,457,457,457,457,457,461,460,462,460,457,457,457,460,460,460,457,0,328,328,328,0,0,0,332,
+330,0,0,330,330,330,330,0,393,330,330,332,332,332,0,0,0,0,463,0,332,332,332,332,332,332,332,332,332,332,
+332,332,332,332,332,332,332,332,332,330,0,331,0,332,332,332,0,0,0,332,0,328,328,328,0,0,0,332,330,0,
+0,330,330,330,330,0,329,330,330,332,332,332,0,0,0,0,330,0,464,464,464,464,464,464,464,464,464,464,464,464,
+464,464,464,464,464,464,464,330,0,331,0,464,464,464,0,0,0,464,0,328,328,328,0,0,0,332,330,0,0,330,
+330,330,330,0,329,330,330,332,332,332,0,0,0,0,330,0,332,332,332,332,332,332,332,332,332,332,332,332,332,332,
+332,332,332,332,332,330,0,331,0,332,332,332,0,0,0,332,399,397,274,274,399,399,399,399,399,399,400,399,399,399,
+399,399,398,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,
+399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,397,274,274,399,399,399,399,399,399,400,399,399,399,399,399,
+465,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,
+399,399,399,399,399,399,399,399,399,399,399,399,399,397,274,274,399,399,399,399,399,399,400,399,399,399,399,399,398,399,
+399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,
+399,399,399,399,399,399,399,399,399,399,399,397,274,274,399,399,399,399,399,399,400,399,399,399,399,399,398,399,399,399,
+399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,
+399,399,399,399,399,399,399,399,338,339,193,193,338,338,338,338,338,338,338,338,338,338,338,338,401,338,338,338,338,338,
+338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,338,
+338,338,338,338,338,338,402,403,279,279,402,402,402,402,402,402,404,402,402,402,402,402,405,402,402,402,402,402,402,402,
+402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,
+402,402,402,402,402,403,279,279,402,402,402,402,402,402,404,402,402,402,402,402,405,402,402,402,402,402,402,402,402,402,
+402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,
+402,402,402,403,279,279,402,402,402,402,402,402,404,402,402,402,402,402,405,402,402,402,402,402,402,402,402,402,402,402,
+402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,
+402,403,279,279,402,402,402,402,402,402,404,402,402,402,402,402,466,402,402,402,402,402,402,402,402,402,402,402,402,402,
+402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,344,342,
+202,202,344,344,344,344,344,344,344,344,344,344,344,344,406,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,
+344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,344,348,349,208,208,
+348,348,348,348,348,348,348,348,348,348,348,348,407,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,
+348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,348,410,408,286,286,410,410,
+410,410,410,410,411,410,410,410,410,410,409,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,
+410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,408,286,286,410,410,410,410,
+410,410,411,410,410,410,410,410,467,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,
+410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,408,286,286,410,410,410,410,410,410,
+411,410,410,410,410,410,409,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,
+410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,408,286,286,410,410,410,410,410,410,411,410,
+410,410,410,410,409,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,
+410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,352,353,212,212,352,352,352,352,352,352,352,352,352,352,
+352,352,412,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,352,
+352,352,352,352,352,352,352,352,352,352,352,352,352,352,415,413,290,290,415,415,415,415,415,415,416,415,415,415,415,415,
+414,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,
+415,415,415,415,415,415,415,415,415,415,415,415,415,413,290,290,415,415,415,415,415,415,416,415,415,415,415,415,468,415,
+415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,
+415,415,415,415,415,415,415,415,415,415,415,413,290,290,415,415,415,415,415,415,416,415,415,415,415,415,414,415,415,415,
+415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,
+415,415,415,415,415,415,415,415,415,413,290,290,415,415,415,415,415,415,416,415,415,415,415,415,414,415,415,415,415,415,
+415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,
+415,415,415,415,415,415,356,357,216,216,356,356,356,356,356,356,356,356,356,356,356,356,417,356,356,356,356,356,356,356,
+356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,356,
+356,356,356,356,419,420,294,294,419,419,419,419,419,419,421,419,419,419,419,419,469,419,419,419,419,419,419,419,419,419,
+419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,
+419,419,419,420,294,294,419,419,419,419,419,419,421,419,419,419,419,419,418,419,419,419,419,419,419,419,419,419,419,419,
+419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,
+419,420,294,294,419,419,419,419,419,419,421,419,419,419,419,419,418,419,419,419,419,419,419,419,419,419,419,419,419,419,
+419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,420,
+294,294,419,419,419,419,419,419,421,419,419,419,419,419,418,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,
+419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,0,422,422,422,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,423,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,470,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,362,360,225,225,362,362,362,362,
+362,362,362,362,362,362,362,362,424,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,
+362,362,362,362,362,362,362,363,362,362,362,362,362,362,362,362,362,362,362,362,362,360,225,225,362,362,362,362,362,362,
+362,362,362,362,362,362,361,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,
+362,362,362,471,362,363,362,362,362,362,362,362,362,362,362,362,362,362,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,472,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,366,367,229,229,366,366,366,366,366,366,366,366,366,366,
+366,366,427,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,
+366,368,366,366,366,366,366,366,366,366,366,366,366,366,366,367,229,229,366,366,366,366,366,366,366,366,366,366,366,366,
+365,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,473,366,368,
+366,366,366,366,366,366,366,366,366,366,366,366,431,429,300,300,431,431,431,431,431,431,432,431,431,431,431,431,430,431,
+431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,433,431,431,
+431,431,431,431,431,431,431,431,431,431,431,429,300,300,431,431,431,431,431,431,432,431,431,431,431,431,474,431,431,431,
+431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,433,431,431,431,431,
+431,431,431,431,431,431,431,431,431,429,300,300,431,431,431,431,431,431,432,431,431,431,431,431,430,431,431,431,431,431,
+431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,433,431,431,431,431,431,431,
+431,431,431,431,431,431,431,429,300,300,431,431,431,431,431,431,432,431,431,431,431,431,430,431,431,431,431,431,431,431,
+431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,433,431,431,431,431,431,431,431,431,
+431,431,431,431,431,429,300,300,431,431,431,431,431,431,432,431,431,431,431,431,430,431,431,431,431,431,431,431,431,431,
+431,431,431,431,431,431,475,431,431,431,431,431,431,431,431,431,431,431,431,433,431,431,431,431,431,431,431,431,431,431,
+431,431,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+476,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,435,435,435,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,436,
+436,436,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,437,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,477,477,477,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,478,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,479,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,480,480,480,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,481,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,482,482,482,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,483,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,484,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,
+131,131,0,0,0,0,0,0,131,131,131,131,131,131,131,131,485,131,131,131,131,131,131,131,131,131,131,0,0,0,
+0,131,131,131,0,0,0,131,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,251,251,251,486,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,249,253,249,249,249,
+251,251,249,249,249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,487,251,251,249,253,249,249,249,251,251,
+249,249,249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,249,253,249,249,249,251,251,249,249,
+249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+251,251,251,251,251,488,251,251,251,251,251,251,251,251,251,251,251,251,251,249,253,249,249,249,251,251,249,249,249,249,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,489,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,490,0,0,0,0,0,0,0,0,0,0,0,0,0,249,249,254,250,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,253,249,249,249,249,249,249,249,249,249,249,249,254,250,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,491,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,253,249,249,249,249,249,249,249,249,249,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,454,454,454,0,0,0,0,0,0,0,0,0,0,161,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,492,492,492,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,455,0,493,493,493,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,460,458,328,328,460,460,460,457,461,460,460,461,461,461,
+461,460,494,461,461,457,457,457,460,460,460,460,461,460,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,
+457,457,457,461,460,462,460,457,457,457,460,460,460,457,460,458,328,328,460,460,460,457,461,460,460,461,461,461,461,460,
+494,461,461,457,457,457,460,460,460,460,461,460,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,
+457,461,460,462,460,457,457,457,460,460,460,457,460,458,328,328,460,460,460,457,461,460,460,461,461,461,461,460,459,461,
+461,457,457,457,460,460,460,460,461,460,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,461,
+460,462,460,457,457,457,460,460,460,457,460,458,328,328,460,460,460,457,461,460,460,461,461,461,461,460,494,461,461,457,
+457,457,460,460,460,460,461,460,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,461,460,462,
+460,457,457,457,460,460,460,457,460,458,328,328,460,460,460,457,461,460,460,461,461,461,461,460,494,461,461,457,457,457,
+460,460,460,460,461,460,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,461,460,462,460,457,
+457,457,460,460,460,457,460,458,328,328,460,460,460,457,461,460,460,461,461,461,461,460,495,496,461,457,457,457,460,460,
+460,460,461,460,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,497,460,462,460,457,457,457,
+460,460,460,457,0,328,328,328,0,0,0,332,330,0,0,330,330,330,330,0,329,330,330,332,332,332,0,0,0,0,
+330,0,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,464,330,0,331,0,464,464,464,0,0,
+0,464,0,328,328,328,0,0,0,498,330,0,0,330,330,330,330,0,394,395,330,498,498,498,0,0,0,0,330,0,
+498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,498,396,0,331,0,498,498,498,0,0,0,498,
+399,397,274,274,399,399,399,399,399,399,400,399,399,399,399,399,465,399,399,399,399,399,399,399,399,399,399,399,399,399,
+399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,399,402,403,
+279,279,402,402,402,402,402,402,404,402,402,402,402,402,466,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,
+402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,402,410,408,286,286,
+410,410,410,410,410,410,411,410,410,410,410,410,467,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,
+410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,410,415,413,290,290,415,415,
+415,415,415,415,416,415,415,415,415,415,468,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,
+415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,415,419,420,294,294,419,419,419,419,
+419,419,421,419,419,419,419,419,469,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,
+419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,419,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,499,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,362,360,225,225,362,362,362,362,362,362,362,362,
+362,362,362,362,361,362,362,362,362,362,362,362,362,362,362,362,362,362,500,362,362,362,362,362,362,362,362,362,362,362,
+362,362,362,363,362,362,362,362,362,362,362,362,362,362,362,362,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,501,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,366,367,229,229,366,366,366,366,366,366,366,366,366,366,366,366,
+365,366,366,366,366,366,366,366,366,366,366,366,366,366,502,366,366,366,366,366,366,366,366,366,366,366,366,366,366,368,
+366,366,366,366,366,366,366,366,366,366,366,366,431,429,300,300,431,431,431,431,431,431,432,431,431,431,431,431,474,431,
+431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,433,431,431,
+431,431,431,431,431,431,431,431,431,431,431,429,300,300,431,431,431,431,431,431,432,431,431,431,431,431,430,431,431,431,
+431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,503,431,433,431,431,431,431,
+431,431,431,431,431,431,431,431,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,504,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,477,477,477,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,478,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,505,505,505,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,480,480,480,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+506,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,482,482,482,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,507,507,507,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,508,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,509,509,509,0,0,0,131,0,0,
+0,0,0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,511,512,131,131,510,131,131,131,131,
+131,131,131,131,131,513,131,0,0,0,0,131,510,131,0,0,0,131,249,249,254,250,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,251,251,251,251,514,251,251,251,251,251,251,251,251,251,
+251,251,251,251,251,249,253,249,249,249,251,251,249,249,249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,
+251,251,251,249,253,249,249,249,251,251,249,249,249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,
+251,249,253,249,249,249,251,251,249,249,249,249,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,515,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,253,249,
+249,249,249,249,249,249,249,249,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,253,249,249,249,
+249,249,249,249,249,249,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,516,516,516,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,455,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,460,458,328,328,460,460,460,457,461,460,460,461,461,461,461,460,459,461,461,457,457,457,460,460,460,460,461,460,
+457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,461,460,462,460,457,457,457,460,460,460,457,
+460,458,328,328,460,460,460,457,461,460,460,461,461,461,461,460,459,461,461,457,457,457,460,460,460,460,517,460,457,457,
+457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,457,461,460,462,460,457,457,457,460,460,460,457,460,458,
+328,328,460,460,460,457,461,460,460,461,461,461,461,460,494,461,461,457,457,457,460,460,460,460,461,460,518,518,518,518,
+518,518,518,518,518,518,518,518,518,518,518,518,518,518,518,461,460,462,460,518,518,518,460,460,460,518,460,458,328,328,
+460,460,460,457,461,460,460,461,461,461,461,460,494,461,461,457,457,457,460,460,460,460,461,460,457,457,457,457,457,457,
+457,457,457,457,457,457,457,457,457,457,457,457,457,461,460,462,460,457,457,457,460,460,460,457,0,328,328,328,0,0,
+0,498,330,0,0,330,330,330,330,0,394,395,330,498,498,498,0,0,0,0,330,0,498,498,498,498,498,498,498,498,
+498,498,498,498,498,498,498,498,498,498,498,396,0,331,0,498,498,498,0,0,0,498,0,519,519,519,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,520,0,0,521,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,521,0,0,0,0,0,362,360,225,225,362,362,362,362,362,362,
+362,362,362,362,362,362,361,362,362,362,362,362,362,362,362,362,362,362,522,362,362,362,362,362,362,362,362,362,362,362,
+362,362,362,362,362,363,362,362,362,362,362,362,362,362,362,362,362,362,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,523,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,366,367,229,229,366,366,366,366,366,366,366,366,366,366,
+366,366,365,366,366,366,366,366,366,366,366,366,366,366,524,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,
+366,368,366,366,366,366,366,366,366,366,366,366,366,366,431,429,300,300,431,431,431,431,431,431,432,431,431,431,431,431,
+430,431,431,431,431,431,431,431,431,431,431,431,431,431,525,431,431,431,431,431,431,431,431,431,431,431,431,431,431,433,
+431,431,431,431,431,431,431,431,431,431,431,431,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,526,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,505,505,505,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,527,527,527,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,507,507,507,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,509,509,509,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,529,520,0,0,528,0,0,0,0,0,0,0,0,0,530,0,0,0,0,0,0,528,0,0,0,
+0,0,0,509,509,509,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,529,520,0,0,528,0,0,0,0,0,0,0,0,0,530,0,0,0,0,0,0,528,0,0,0,0,0,
+0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,
+131,131,131,532,131,131,131,131,531,131,131,131,131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,0,0,
+0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,131,
+533,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,0,0,0,0,
+0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,131,131,131,
+131,131,534,131,535,131,131,131,131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,0,0,0,0,0,0,
+0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,131,131,131,131,131,
+131,131,536,131,131,131,131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,249,538,540,539,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,251,251,251,251,251,251,251,251,251,251,
+251,251,251,251,251,251,251,251,251,249,253,249,249,537,251,251,249,249,249,249,0,541,541,541,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,542,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,543,543,543,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,460,458,328,328,460,460,460,457,461,460,460,461,461,461,
+461,460,494,461,461,457,457,457,460,460,460,460,461,460,518,518,518,518,518,518,518,518,518,518,518,518,518,518,518,518,
+518,518,518,461,460,462,460,518,518,518,460,460,460,518,460,458,328,328,460,460,460,544,461,460,460,461,461,461,461,460,
+495,496,461,544,544,544,460,460,460,460,461,460,544,544,544,544,544,544,544,544,544,544,544,544,544,544,544,544,544,544,
+544,497,460,462,460,544,544,544,460,460,460,544,0,519,519,519,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,520,0,0,521,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,521,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,545,0,546,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,547,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,362,360,225,225,362,362,362,362,362,362,362,362,362,362,362,362,361,362,362,362,362,362,362,362,
+362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,548,362,362,362,362,363,362,362,362,362,362,362,362,362,
+362,362,362,362,0,549,549,549,0,0,0,0,0,0,551,0,0,0,0,0,550,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,366,367,229,229,366,366,366,366,366,366,366,366,366,366,366,366,365,366,366,366,366,366,366,366,366,366,366,366,
+366,366,366,366,366,366,366,366,366,366,366,366,552,366,366,366,366,368,366,366,366,366,366,366,366,366,366,366,366,366,
+431,429,300,300,431,431,431,431,431,431,432,431,431,431,431,431,430,431,431,431,431,431,431,431,431,431,431,431,553,431,
+431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,433,431,431,431,431,431,431,431,431,431,431,431,431,0,556,
+556,556,0,0,0,0,0,0,555,0,0,0,0,0,554,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,527,527,527,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,547,0,0,
+0,0,557,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,558,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,559,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,0,0,0,0,
+0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,560,131,131,131,131,131,131,131,131,131,131,131,
+131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,0,0,
+0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,562,131,131,131,131,131,131,561,131,131,131,131,131,
+131,131,131,0,0,0,0,131,131,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,
+0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,131,131,563,131,131,131,131,131,131,131,131,131,131,131,131,
+131,0,0,0,0,131,131,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,
+0,131,131,131,0,0,0,0,0,0,131,131,131,131,131,131,131,565,131,131,131,131,131,131,131,564,131,131,131,0,
+0,0,0,131,565,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,
+131,131,0,0,0,0,0,0,131,131,131,566,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,
+0,131,131,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,
+0,0,0,0,0,0,131,131,131,567,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,0,131,
+131,131,0,0,0,131,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,568,249,249,249,249,249,249,249,249,249,253,249,249,249,249,249,
+249,249,249,249,249,538,540,539,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,253,249,249,249,249,249,249,249,
+249,249,249,538,540,539,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,253,249,249,249,249,249,249,249,249,249,
+0,541,541,541,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,541,
+541,541,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,569,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,460,458,328,328,460,460,460,544,
+461,460,460,461,461,461,461,460,495,496,461,544,544,544,460,460,460,460,461,460,544,544,544,544,544,544,544,544,544,544,
+544,544,544,544,544,544,544,544,544,497,460,462,460,544,544,544,460,460,460,544,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,570,0,0,0,0,
+0,0,0,571,0,0,0,0,0,0,0,0,570,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,572,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,574,0,0,0,0,0,0,573,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,362,360,225,225,362,362,362,362,362,362,362,362,362,362,362,362,
+361,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,575,362,362,362,362,362,362,362,362,362,362,362,362,363,
+362,362,362,362,362,362,362,362,362,362,362,362,0,549,549,549,0,0,0,0,0,0,551,0,0,0,0,0,550,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,576,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,577,577,577,577,577,577,577,577,577,577,0,577,577,577,577,577,577,577,577,577,577,577,
+577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,
+577,577,577,577,577,577,366,367,229,229,366,366,366,366,366,366,366,366,366,366,366,366,365,366,366,366,366,366,366,366,
+366,366,366,366,366,366,366,366,578,366,366,366,366,366,366,366,366,366,366,366,366,368,366,366,366,366,366,366,366,366,
+366,366,366,366,431,429,300,300,431,431,431,431,431,431,432,431,431,431,431,431,430,431,431,431,431,431,431,431,431,431,
+431,431,431,431,431,431,431,431,431,431,431,431,431,431,579,431,431,431,431,433,431,431,431,431,431,431,431,431,431,431,
+431,431,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,580,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+581,581,581,581,581,581,581,581,581,581,0,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,
+581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,0,556,
+556,556,0,0,0,0,0,0,555,0,0,0,0,0,554,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,582,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,583,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,584,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,0,0,
+0,0,0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,131,131,131,131,131,585,131,131,131,
+131,131,131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,
+0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,586,131,131,131,131,131,131,131,131,131,131,
+131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,0,0,
+0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,131,587,131,131,131,131,131,131,131,131,131,131,131,
+131,131,131,0,0,0,0,131,131,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,
+0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,131,131,131,131,588,131,131,131,131,131,131,131,131,131,131,
+131,0,0,0,0,131,588,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,
+0,131,131,131,0,0,0,0,0,0,131,131,131,131,589,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,
+0,0,0,131,131,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,
+131,131,0,0,0,0,0,0,131,131,131,131,131,590,131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,
+0,131,131,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,
+0,0,0,0,0,0,131,131,131,131,131,131,131,591,131,131,131,131,131,131,131,131,131,131,131,0,0,0,0,131,
+591,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,0,0,
+0,0,0,0,131,131,131,131,592,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,0,131,131,131,
+0,0,0,131,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,593,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,253,249,249,249,249,249,249,249,
+249,249,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,594,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,595,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+596,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,597,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,597,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,598,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,599,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,362,600,601,601,362,362,362,362,362,362,
+603,362,362,362,362,362,602,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,
+362,362,362,362,362,363,362,362,362,362,362,362,362,362,362,362,362,362,606,604,549,549,606,606,606,606,606,606,607,606,
+606,606,606,606,605,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,
+606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,0,0,0,0,0,0,0,0,0,0,608,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,366,610,611,611,366,366,366,366,366,366,612,366,366,366,366,366,
+609,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,368,
+366,366,366,366,366,366,366,366,366,366,366,366,431,429,300,300,431,431,431,431,431,431,432,431,431,431,431,431,430,431,
+431,431,431,431,431,431,431,431,431,431,431,431,431,431,613,431,431,431,431,431,431,431,431,431,431,431,431,433,431,431,
+431,431,431,431,431,431,431,431,431,431,615,616,556,556,615,615,615,615,615,615,617,615,615,615,615,615,614,615,615,615,
+615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,
+615,615,615,615,615,615,615,615,0,0,0,0,0,0,0,0,0,0,618,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,619,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,620,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,620,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,621,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,
+131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,622,131,0,0,0,0,131,131,131,0,0,0,131,0,0,
+0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,131,
+623,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,0,0,0,0,
+0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,131,131,624,
+131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,0,0,0,0,0,0,
+0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,131,131,131,131,131,
+131,131,625,131,131,131,131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,0,626,626,626,0,0,0,131,
+0,0,0,0,0,0,0,0,0,0,0,131,131,131,0,627,0,0,0,0,131,131,131,131,131,131,131,131,131,131,
+131,131,131,131,131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,0,628,628,628,0,0,0,131,0,0,
+0,0,0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,131,131,131,131,131,131,131,131,131,
+131,131,131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,
+0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,131,131,629,131,131,131,131,131,131,131,131,
+131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,0,0,
+0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,131,131,630,131,131,131,131,131,131,131,131,131,131,
+131,131,131,0,0,0,0,131,131,131,0,0,0,131,249,249,254,250,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+631,249,253,249,249,249,249,631,249,249,249,249,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,632,0,
+0,0,0,0,0,632,0,0,0,0,0,628,628,628,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,626,626,626,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,627,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,633,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,634,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,635,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+362,600,601,601,362,362,362,362,362,362,603,362,362,362,362,362,602,362,362,362,362,362,362,362,362,362,362,362,362,362,
+362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,363,362,362,362,362,362,362,362,362,362,362,362,362,0,601,
+601,601,0,0,0,0,0,0,551,0,0,0,0,0,636,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,227,0,0,0,0,0,0,0,0,0,0,0,0,362,360,225,225,
+362,362,362,362,362,362,362,362,362,362,362,362,637,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,
+362,362,362,362,362,362,362,362,362,362,362,363,362,362,362,362,362,362,362,362,362,362,362,362,641,638,639,639,641,641,
+641,641,641,641,362,641,641,641,641,641,640,641,641,641,641,641,641,641,641,641,641,641,641,641,641,641,641,641,641,641,
+641,641,641,641,641,641,641,641,641,642,641,641,641,641,641,641,641,641,641,641,641,641,606,604,549,549,606,606,606,606,
+606,606,607,606,606,606,606,606,605,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,
+606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,604,549,549,606,606,606,606,606,606,
+607,606,606,606,606,606,643,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,
+606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,604,549,549,606,606,606,606,606,606,607,606,
+606,606,606,606,605,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,
+606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,647,644,645,645,647,647,647,647,647,647,607,647,647,647,
+647,647,646,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,
+647,647,647,647,647,647,647,647,647,647,647,647,647,647,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,366,367,229,229,366,366,366,366,366,366,366,366,366,366,366,366,648,366,
+366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,368,366,366,
+366,366,366,366,366,366,366,366,366,366,366,610,611,611,366,366,366,366,366,366,612,366,366,366,366,366,609,366,366,366,
+366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,368,366,366,366,366,
+366,366,366,366,366,366,366,366,0,651,651,651,0,0,0,0,0,0,650,0,0,0,0,0,649,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,231,0,0,0,0,0,0,
+0,0,0,0,0,0,653,654,656,656,653,653,653,653,653,653,366,653,653,653,653,653,652,653,653,653,653,653,653,653,
+653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,653,655,653,653,653,653,653,653,653,653,
+653,653,653,653,431,659,651,651,431,431,431,431,431,431,658,431,431,431,431,431,657,431,431,431,431,431,431,431,431,431,
+431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,433,431,431,431,431,431,431,431,431,431,431,
+431,431,615,616,556,556,615,615,615,615,615,615,617,615,615,615,615,615,660,615,615,615,615,615,615,615,615,615,615,615,
+615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,
+615,616,556,556,615,615,615,615,615,615,617,615,615,615,615,615,614,615,615,615,615,615,615,615,615,615,615,615,615,615,
+615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,616,
+556,556,615,615,615,615,615,615,617,615,615,615,615,615,614,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,
+615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,662,663,664,664,
+662,662,662,662,662,662,617,662,662,662,662,662,661,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,
+662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,665,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,666,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,667,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,0,0,0,0,0,0,
+0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,668,131,131,131,131,131,131,131,131,131,131,131,131,
+131,131,131,0,0,0,0,131,131,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,
+0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,131,131,669,131,131,131,131,131,131,131,131,131,131,131,131,
+131,0,0,0,0,131,131,131,0,0,0,131,0,670,670,670,0,0,0,131,0,0,0,0,0,0,0,0,0,0,
+0,131,131,131,0,0,0,0,0,0,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,
+0,0,0,131,131,131,0,0,0,131,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,
+131,131,0,0,0,0,0,0,131,131,131,131,671,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,
+0,131,131,131,0,0,0,131,0,626,626,626,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,627,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,628,628,628,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,672,672,672,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,0,673,0,0,0,0,
+131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,
+0,674,674,674,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,
+131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,249,249,
+254,250,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,675,249,249,249,253,249,249,249,249,249,249,249,249,249,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,676,0,0,0,0,0,0,0,0,0,0,0,0,0,0,672,672,672,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,673,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,677,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,670,670,670,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,678,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,681,679,601,601,681,681,681,681,681,681,682,681,681,681,
+681,681,680,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,
+681,683,681,681,681,681,681,681,681,681,681,681,681,681,362,360,225,225,362,362,362,362,362,362,684,362,362,362,362,362,
+361,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,363,
+362,362,362,362,362,362,362,362,362,362,362,362,0,225,225,225,0,0,0,0,0,0,608,0,0,0,0,0,226,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,227,0,0,
+0,0,0,0,0,0,0,0,0,0,362,360,225,225,362,362,362,362,362,362,684,362,362,362,362,362,424,362,362,362,
+362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,363,362,362,362,362,
+362,362,362,362,362,362,362,362,362,360,225,225,362,362,362,362,362,362,684,362,362,362,362,362,361,362,362,362,362,362,
+362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,363,362,362,362,362,362,362,
+362,362,362,362,362,362,362,360,225,225,362,362,362,362,362,362,684,362,362,362,362,362,361,362,362,362,362,362,362,362,
+362,362,362,362,362,362,362,362,425,362,362,362,362,362,362,362,362,362,362,362,362,363,362,362,362,362,362,362,362,362,
+362,362,362,362,606,604,549,549,606,606,606,606,606,606,607,606,606,606,606,606,643,606,606,606,606,606,606,606,606,606,
+606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,
+606,606,606,604,549,549,606,606,606,606,606,606,685,606,606,606,606,606,605,606,606,606,606,606,606,606,606,606,606,606,
+606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,
+0,549,549,549,0,0,0,0,0,0,686,0,0,0,0,0,550,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,606,604,
+549,549,606,606,606,606,606,606,685,606,606,606,606,606,643,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,
+606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,604,549,549,
+606,606,606,606,606,606,685,606,606,606,606,606,605,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,
+606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,606,688,689,611,611,688,688,
+688,688,688,688,690,688,688,688,688,688,687,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,
+688,688,688,688,688,688,688,688,688,691,688,688,688,688,688,688,688,688,688,688,688,688,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,692,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,581,581,581,581,581,581,581,581,581,581,
+0,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,
+581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,0,651,651,651,0,0,0,0,0,0,650,0,
+0,0,0,0,649,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,231,0,0,0,0,0,0,0,0,0,0,0,0,366,367,229,229,366,366,366,366,366,366,693,366,366,366,
+366,366,427,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,
+366,368,366,366,366,366,366,366,366,366,366,366,366,366,366,367,229,229,366,366,366,366,366,366,693,366,366,366,366,366,
+365,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,368,
+366,366,366,366,366,366,366,366,366,366,366,366,366,367,229,229,366,366,366,366,366,366,693,366,366,366,366,366,365,366,
+366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,368,366,366,
+366,366,366,366,366,366,366,366,366,366,366,367,229,229,366,366,366,366,366,366,693,366,366,366,366,366,365,366,366,366,
+366,366,366,366,366,366,366,366,366,366,366,366,428,366,366,366,366,366,366,366,366,366,366,366,366,368,366,366,366,366,
+366,366,366,366,366,366,366,366,0,300,300,300,0,0,0,0,0,0,694,0,0,0,0,0,301,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,231,0,0,0,0,0,0,
+0,0,0,0,0,0,431,429,300,300,431,431,431,431,431,431,432,431,431,431,431,431,695,431,431,431,431,431,431,431,
+431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,433,431,431,431,431,431,431,431,431,
+431,431,431,431,696,697,698,698,696,696,696,696,696,696,432,696,696,696,696,696,699,696,696,696,696,696,696,696,696,696,
+696,696,696,696,696,696,696,696,696,696,696,696,696,696,696,696,696,696,696,700,696,696,696,696,696,696,696,696,696,696,
+696,696,431,659,651,651,431,431,431,431,431,431,658,431,431,431,431,431,657,431,431,431,431,431,431,431,431,431,431,431,
+431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,433,431,431,431,431,431,431,431,431,431,431,431,431,
+615,616,556,556,615,615,615,615,615,615,617,615,615,615,615,615,660,615,615,615,615,615,615,615,615,615,615,615,615,615,
+615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,616,
+556,556,615,615,615,615,615,615,701,615,615,615,615,615,660,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,
+615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,616,556,556,
+615,615,615,615,615,615,701,615,615,615,615,615,614,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,
+615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,616,556,556,615,615,
+615,615,615,615,701,615,615,615,615,615,614,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,
+615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,615,0,556,556,556,0,0,0,0,
+0,0,702,0,0,0,0,0,554,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,703,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,704,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,674,674,674,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,0,0,0,0,0,0,0,0,
+0,0,0,131,131,131,0,0,0,0,0,0,131,131,131,131,705,131,131,131,131,131,131,131,131,131,131,131,131,131,
+131,0,0,0,0,131,131,131,0,0,0,131,0,706,706,706,0,0,0,131,0,0,0,0,0,0,0,0,0,0,
+0,131,131,131,0,0,0,0,0,0,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,
+0,0,0,131,131,131,0,0,0,131,0,670,670,670,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,707,707,707,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,
+0,0,0,0,0,0,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,0,131,
+131,131,0,0,0,131,0,672,672,672,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,673,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,674,674,674,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+249,708,710,709,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,253,249,249,249,249,249,249,249,249,249,0,711,
+711,711,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,706,706,706,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,681,679,601,601,681,681,
+681,681,681,681,682,681,681,681,681,681,712,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,
+681,681,681,681,681,681,681,681,681,683,681,681,681,681,681,681,681,681,681,681,681,681,681,679,601,601,681,681,681,681,
+681,681,682,681,681,681,681,681,712,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,
+681,681,681,681,681,681,681,683,681,681,681,681,681,681,681,681,681,681,681,681,681,679,601,601,681,681,681,681,681,681,
+682,681,681,681,681,681,713,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,
+681,681,681,681,681,683,681,681,681,681,681,681,681,681,681,681,681,681,681,679,601,601,681,681,681,681,681,681,682,681,
+681,681,681,681,712,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,
+681,681,681,683,681,681,681,681,681,681,681,681,681,681,681,681,717,714,715,715,717,717,717,717,717,717,682,717,717,717,
+717,717,716,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,
+717,718,717,717,717,717,717,717,717,717,717,717,717,717,681,679,601,601,681,681,681,681,681,681,682,681,681,681,681,681,
+712,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,719,681,681,681,681,681,681,681,681,681,681,681,681,683,
+681,681,681,681,681,681,681,681,681,681,681,681,362,360,225,225,362,362,362,362,362,362,362,362,362,362,362,362,361,362,
+362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,362,363,362,362,
+362,362,362,362,362,362,362,362,362,362,647,644,645,645,647,647,647,647,647,647,607,647,647,647,647,647,646,647,647,647,
+647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,647,
+647,647,647,647,647,647,647,647,577,577,577,577,577,577,577,577,577,577,0,577,577,577,577,577,577,577,577,577,577,577,
+577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,577,
+577,577,577,577,577,577,688,689,611,611,688,688,688,688,688,688,690,688,688,688,688,688,720,688,688,688,688,688,688,688,
+688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,691,688,688,688,688,688,688,688,688,
+688,688,688,688,688,689,611,611,688,688,688,688,688,688,690,688,688,688,688,688,721,688,688,688,688,688,688,688,688,688,
+688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,691,688,688,688,688,688,688,688,688,688,688,
+688,688,688,689,611,611,688,688,688,688,688,688,690,688,688,688,688,688,721,688,688,688,688,688,688,688,688,688,688,688,
+688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,691,688,688,688,688,688,688,688,688,688,688,688,688,
+724,723,726,726,724,724,724,724,724,724,690,724,724,724,724,724,722,724,724,724,724,724,724,724,724,724,724,724,724,724,
+724,724,724,724,724,724,724,724,724,724,724,724,724,724,724,725,724,724,724,724,724,724,724,724,724,724,724,724,688,689,
+611,611,688,688,688,688,688,688,690,688,688,688,688,688,721,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,
+727,688,688,688,688,688,688,688,688,688,688,688,688,691,688,688,688,688,688,688,688,688,688,688,688,688,729,730,651,651,
+729,729,729,729,729,729,731,729,729,729,729,729,728,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,
+729,729,729,729,729,729,729,729,729,729,729,732,729,729,729,729,729,729,729,729,729,729,729,729,366,367,229,229,366,366,
+366,366,366,366,366,366,366,366,366,366,365,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,366,
+366,366,366,366,366,366,366,366,366,368,366,366,366,366,366,366,366,366,366,366,366,366,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,729,730,651,651,729,729,729,729,729,729,
+731,729,729,729,729,729,733,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,
+729,729,729,729,729,732,729,729,729,729,729,729,729,729,729,729,729,729,431,429,300,300,431,431,431,431,431,431,734,431,
+431,431,431,431,430,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,
+431,431,431,433,431,431,431,431,431,431,431,431,431,431,431,431,431,429,300,300,431,431,431,431,431,431,734,431,431,431,
+431,431,430,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,
+431,433,431,431,431,431,431,431,431,431,431,431,431,431,0,300,300,300,0,0,0,0,0,0,694,0,0,0,0,0,
+301,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,231,
+0,0,0,0,0,0,0,0,0,0,0,0,431,429,300,300,431,431,431,431,431,431,734,431,431,431,431,431,474,431,
+431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,433,431,431,
+431,431,431,431,431,431,431,431,431,431,431,429,300,300,431,431,431,431,431,431,734,431,431,431,431,431,430,431,431,431,
+431,431,431,431,431,431,431,431,431,431,431,431,475,431,431,431,431,431,431,431,431,431,431,431,431,433,431,431,431,431,
+431,431,431,431,431,431,431,431,662,663,664,664,662,662,662,662,662,662,617,662,662,662,662,662,661,662,662,662,662,662,
+662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,662,
+662,662,662,662,662,662,581,581,581,581,581,581,581,581,581,581,0,581,581,581,581,581,581,581,581,581,581,581,581,581,
+581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,
+581,581,581,581,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,735,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,707,707,707,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,736,736,736,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,131,131,131,0,0,0,0,0,0,131,131,
+131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,0,131,131,131,0,0,0,131,0,706,
+706,706,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,707,707,707,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,249,708,710,709,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,253,249,249,249,249,249,249,249,249,249,249,708,710,709,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+249,249,249,249,249,249,249,249,249,249,253,249,249,249,249,249,249,249,249,249,0,711,711,711,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,711,711,711,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,681,679,601,601,681,681,681,681,681,681,682,681,681,681,
+681,681,713,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,
+681,683,681,681,681,681,681,681,681,681,681,681,681,681,681,679,601,601,681,681,681,681,681,681,682,681,681,681,681,681,
+713,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,683,
+681,681,681,681,681,681,681,681,681,681,681,681,681,679,601,601,681,681,681,681,681,681,737,681,681,681,681,681,712,681,
+681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,683,681,681,
+681,681,681,681,681,681,681,681,681,681,0,601,601,601,0,0,0,0,0,0,686,0,0,0,0,0,636,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,227,0,0,0,0,
+0,0,0,0,0,0,0,0,681,679,601,601,681,681,681,681,681,681,737,681,681,681,681,681,713,681,681,681,681,681,
+681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,683,681,681,681,681,681,681,
+681,681,681,681,681,681,681,679,601,601,681,681,681,681,681,681,737,681,681,681,681,681,712,681,681,681,681,681,681,681,
+681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,683,681,681,681,681,681,681,681,681,
+681,681,681,681,681,679,601,601,681,681,681,681,681,681,737,681,681,681,681,681,712,681,681,681,681,681,681,681,681,681,
+681,681,681,681,681,681,719,681,681,681,681,681,681,681,681,681,681,681,681,683,681,681,681,681,681,681,681,681,681,681,
+681,681,681,679,601,601,681,681,681,681,681,681,682,681,681,681,681,681,712,681,681,681,681,681,681,681,681,681,681,681,
+681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,738,681,683,681,681,681,681,681,681,681,681,681,681,681,681,
+688,689,611,611,688,688,688,688,688,688,690,688,688,688,688,688,720,688,688,688,688,688,688,688,688,688,688,688,688,688,
+688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,691,688,688,688,688,688,688,688,688,688,688,688,688,688,689,
+611,611,688,688,688,688,688,688,690,688,688,688,688,688,720,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,
+688,688,688,688,688,688,688,688,688,688,688,688,688,691,688,688,688,688,688,688,688,688,688,688,688,688,688,689,611,611,
+688,688,688,688,688,688,739,688,688,688,688,688,720,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,
+688,688,688,688,688,688,688,688,688,688,688,691,688,688,688,688,688,688,688,688,688,688,688,688,688,689,611,611,688,688,
+688,688,688,688,739,688,688,688,688,688,721,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,
+688,688,688,688,688,688,688,688,688,691,688,688,688,688,688,688,688,688,688,688,688,688,688,689,611,611,688,688,688,688,
+688,688,739,688,688,688,688,688,721,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,
+688,688,688,688,688,688,688,691,688,688,688,688,688,688,688,688,688,688,688,688,688,689,611,611,688,688,688,688,688,688,
+739,688,688,688,688,688,721,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,727,688,688,688,688,688,688,688,
+688,688,688,688,688,691,688,688,688,688,688,688,688,688,688,688,688,688,0,651,651,651,0,0,0,0,0,0,740,0,
+0,0,0,0,649,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,231,0,0,0,0,0,0,0,0,0,0,0,0,688,689,611,611,688,688,688,688,688,688,690,688,688,688,
+688,688,721,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,741,
+688,691,688,688,688,688,688,688,688,688,688,688,688,688,729,730,651,651,729,729,729,729,729,729,731,729,729,729,729,729,
+742,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,732,
+729,729,729,729,729,729,729,729,729,729,729,729,729,730,651,651,729,729,729,729,729,729,731,729,729,729,729,729,728,729,
+729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,732,729,729,
+729,729,729,729,729,729,729,729,729,729,729,730,651,651,729,729,729,729,729,729,731,729,729,729,729,729,728,729,729,729,
+729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,732,729,729,729,729,
+729,729,729,729,729,729,729,729,744,745,747,747,744,744,744,744,744,744,731,744,744,744,744,744,743,744,744,744,744,744,
+744,744,744,744,744,744,744,744,744,744,744,744,744,744,744,744,744,744,744,744,744,744,744,746,744,744,744,744,744,744,
+744,744,744,744,744,744,729,730,651,651,729,729,729,729,729,729,731,729,729,729,729,729,728,729,729,729,729,729,729,729,
+729,729,729,729,729,729,729,729,748,729,729,729,729,729,729,729,729,729,729,729,729,732,729,729,729,729,729,729,729,729,
+729,729,729,729,729,730,651,651,729,729,729,729,729,729,731,729,729,729,729,729,742,729,729,729,729,729,729,729,729,729,
+729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,732,729,729,729,729,729,729,729,729,729,729,
+729,729,431,429,300,300,431,431,431,431,431,431,432,431,431,431,431,431,430,431,431,431,431,431,431,431,431,431,431,431,
+431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,431,433,431,431,431,431,431,431,431,431,431,431,431,431,
+0,736,736,736,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,736,
+736,736,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,717,714,715,715,
+717,717,717,717,717,717,682,717,717,717,717,717,716,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,717,
+717,717,717,717,717,717,717,717,717,717,717,718,717,717,717,717,717,717,717,717,717,717,717,717,681,679,601,601,681,681,
+681,681,681,681,682,681,681,681,681,681,712,681,681,681,681,681,681,681,681,681,681,681,681,681,749,681,681,681,681,681,
+681,681,681,681,681,681,681,681,681,683,681,681,681,681,681,681,681,681,681,681,681,681,724,723,726,726,724,724,724,724,
+724,724,690,724,724,724,724,724,722,724,724,724,724,724,724,724,724,724,724,724,724,724,724,724,724,724,724,724,724,724,
+724,724,724,724,724,724,724,725,724,724,724,724,724,724,724,724,724,724,724,724,581,581,581,581,581,581,581,581,581,581,
+0,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,
+581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,581,688,689,611,611,688,688,688,688,688,688,690,688,
+688,688,688,688,721,688,688,688,688,688,688,688,688,688,688,688,688,688,750,688,688,688,688,688,688,688,688,688,688,688,
+688,688,688,691,688,688,688,688,688,688,688,688,688,688,688,688,729,730,651,651,729,729,729,729,729,729,731,729,729,729,
+729,729,742,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,
+729,732,729,729,729,729,729,729,729,729,729,729,729,729,729,730,651,651,729,729,729,729,729,729,751,729,729,729,729,729,
+742,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,732,
+729,729,729,729,729,729,729,729,729,729,729,729,729,730,651,651,729,729,729,729,729,729,751,729,729,729,729,729,728,729,
+729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,732,729,729,
+729,729,729,729,729,729,729,729,729,729,729,730,651,651,729,729,729,729,729,729,751,729,729,729,729,729,728,729,729,729,
+729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,732,729,729,729,729,
+729,729,729,729,729,729,729,729,729,730,651,651,729,729,729,729,729,729,751,729,729,729,729,729,728,729,729,729,729,729,
+729,729,729,729,729,729,729,729,729,729,748,729,729,729,729,729,729,729,729,729,729,729,729,732,729,729,729,729,729,729,
+729,729,729,729,729,729,0,651,651,651,0,0,0,0,0,0,740,0,0,0,0,0,649,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,231,0,0,0,0,0,0,0,0,
+0,0,0,0,729,730,651,651,729,729,729,729,729,729,731,729,729,729,729,729,728,729,729,729,729,729,729,729,729,729,
+729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,752,729,732,729,729,729,729,729,729,729,729,729,729,
+729,729,681,679,601,601,681,681,681,681,681,681,682,681,681,681,681,681,712,681,681,681,681,681,681,681,681,681,681,681,
+753,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,683,681,681,681,681,681,681,681,681,681,681,681,681,
+688,689,611,611,688,688,688,688,688,688,690,688,688,688,688,688,721,688,688,688,688,688,688,688,688,688,688,688,754,688,
+688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,691,688,688,688,688,688,688,688,688,688,688,688,688,744,745,
+747,747,744,744,744,744,744,744,731,744,744,744,744,744,743,744,744,744,744,744,744,744,744,744,744,744,744,744,744,744,
+744,744,744,744,744,744,744,744,744,744,744,744,744,746,744,744,744,744,744,744,744,744,744,744,744,744,729,730,651,651,
+729,729,729,729,729,729,731,729,729,729,729,729,728,729,729,729,729,729,729,729,729,729,729,729,729,729,755,729,729,729,
+729,729,729,729,729,729,729,729,729,729,729,732,729,729,729,729,729,729,729,729,729,729,729,729,681,679,601,601,681,681,
+681,681,681,681,682,681,681,681,681,681,712,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,
+681,681,681,681,756,681,681,681,681,683,681,681,681,681,681,681,681,681,681,681,681,681,688,689,611,611,688,688,688,688,
+688,688,690,688,688,688,688,688,721,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,
+688,688,757,688,688,688,688,691,688,688,688,688,688,688,688,688,688,688,688,688,729,730,651,651,729,729,729,729,729,729,
+731,729,729,729,729,729,728,729,729,729,729,729,729,729,729,729,729,729,758,729,729,729,729,729,729,729,729,729,729,729,
+729,729,729,729,729,732,729,729,729,729,729,729,729,729,729,729,729,729,681,679,601,601,681,681,681,681,681,681,682,681,
+681,681,681,681,712,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,759,681,681,681,681,681,681,681,681,681,
+681,681,681,683,681,681,681,681,681,681,681,681,681,681,681,681,688,689,611,611,688,688,688,688,688,688,690,688,688,688,
+688,688,721,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,760,688,688,688,688,688,688,688,688,688,688,688,
+688,691,688,688,688,688,688,688,688,688,688,688,688,688,729,730,651,651,729,729,729,729,729,729,731,729,729,729,729,729,
+728,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,761,729,729,729,729,732,
+729,729,729,729,729,729,729,729,729,729,729,729,681,679,601,601,681,681,681,681,681,681,682,681,681,681,681,681,712,681,
+681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,681,683,681,681,
+681,681,681,681,681,681,681,681,681,681,688,689,611,611,688,688,688,688,688,688,690,688,688,688,688,688,721,688,688,688,
+688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,688,691,688,688,688,688,
+688,688,688,688,688,688,688,688,729,730,651,651,729,729,729,729,729,729,731,729,729,729,729,729,728,729,729,729,729,729,
+729,729,729,729,729,729,729,729,729,729,762,729,729,729,729,729,729,729,729,729,729,729,729,732,729,729,729,729,729,729,
+729,729,729,729,729,729,729,730,651,651,729,729,729,729,729,729,731,729,729,729,729,729,728,729,729,729,729,729,729,729,
+729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,729,732,729,729,729,729,729,729,729,729,
+729,729,729,729,
+};
+static const short yy_acc[763] = {0,0,0,0,0,0,0,0,12,0,0,0,11,0,0,0,0,0,0,0,0,0,140,140,71,77,83,77,78,79,80,81,82,84,85,86,87,88,88,89,90,91,92,93,110,110,110,110,52,110,61,61,110,110,110,19,61,1,1,58,58,45,58,68,68,58,68,68,68,68,57,58,58,69,59,59,20,139,139,139,139,139,134,135,135,132,133,133,116,116,116,9,12,6,5,5,6,47,51,53,53,48,16,11,38,25,33,33,27,32,23,32,23,42,42,44,131,131,131,129,129,129,88,88,49,29,0,0,0,0,77,77,2,0,106,105,107,103,99,100,94,104,0,0,101,95,96,97,98,102,61,63,73,0,109,63,0,0,0,61,63,65,0,1,59,63,55,2,0,68,8,54,56,67,21,18,15,39,40,60,59,0,0,0,0,0,138,0,132,115,0,0,9,9,10,7,4,3,50,53,53,16,16,17,34,34,35,26,25,30,25,28,27,27,24,23,23,31,43,41,0,0,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,2,0,72,108,63,73,0,64,0,0,0,76,0,0,0,76,0,0,0,61,63,66,1,1,2,22,46,67,0,0,0,39,59,137,136,9,10,14,9,3,16,17,13,16,36,35,25,25,26,37,27,27,28,23,24,23,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,76,76,0,0,0,0,61,63,0,0,67,0,0,0,67,0,137,137,136,136,9,9,9,9,16,16,16,16,36,35,25,25,25,25,27,27,27,27,23,23,23,23,0,0,0,0,0,0,0,0,0,0,0,0,124,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,63,63,0,67,0,0,0,0,9,9,9,9,9,16,16,13,16,16,25,25,25,25,25,27,27,27,27,27,23,23,23,23,23,0,0,0,0,0,0,0,0,0,0,37,0,0,124,0,126,0,0,120,0,114,0,0,77,0,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,67,0,67,9,16,25,27,23,0,0,0,0,0,0,0,0,128,122,120,0,114,112,0,70,0,0,0,0,0,0,62,0,0,0,0,0,67,0,0,0,0,0,0,122,118,112,70,70,77,77,77,77,74,74,62,0,67,0,0,0,0,0,0,0,0,118,0,0,0,77,77,77,77,77,77,0,74,74,74,74,0,62,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,77,77,77,77,77,77,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,77,77,77,77,77,77,77,0,0,123,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,29,0,0,0,77,77,77,77,0,125,123,77,77,0,0,0,0,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,113,77,77,119,77,0,127,113,75,75,121,0,0,0,0,0,0,49,49,49,0,0,0,0,0,0,29,29,0,0,0,0,0,0,29,29,0,111,77,121,111,75,75,75,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,29,117,117,49,0,29,29,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0};
+static const short yy_starts[42] = {1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13,14,14,15,15,16,16,17,17,18,18,19,19,20,20,21,21};
+int yylex(void)
+{
+	char *yy_cp, *yy_bp, *yy_end, *yy_last;
+	int yy_state, yy_rule;
+		/* code to execute during start of each call of yylex() */
+		token_start = NULL;
+	if (yyg->cur == NULL)
+		YY_FATAL_ERROR("no input buffer");
+	for (;;)
+	{
+		*yyg->c_buf_p = yyg->hold_char;
+		yy_cp = yy_bp = yyg->c_buf_p;
+		yy_end = yyg->cur->end;
+		if (yy_cp >= yy_end)
+		{
+			yytext = yy_cp;
+			yyleng = 0;
+			switch (YY_START)
+			{
+				case xc:
+{
+{ mmerror(PARSE_ERROR, ET_FATAL, "unterminated /* comment"); }
+}
+				break;
+				case xb:
+{
+{ mmerror(PARSE_ERROR, ET_FATAL, "unterminated bit string literal"); }
+}
+				break;
+				case xh:
+{
+{ mmerror(PARSE_ERROR, ET_FATAL, "unterminated hexadecimal string literal"); }
+}
+				break;
+				case xq:
+				case xqc:
+				case xe:
+				case xn:
+				case xus:
+{
+{ mmerror(PARSE_ERROR, ET_FATAL, "unterminated quoted string"); }
+}
+				break;
+				case xdolq:
+{
+{ base_yyerror("unterminated dollar-quoted string"); }
+}
+				break;
+				case xd:
+				case xdc:
+				case xui:
+{
+{ mmerror(PARSE_ERROR, ET_FATAL, "unterminated quoted identifier"); }
+}
+				break;
+				case INITIAL:
+				case C:
+				case SQL:
+				case incl:
+				case def:
+				case def_ident:
+				case undef:
+				case xcond:
+				case xskip:
+{
+{
+			  		if (yy_buffer == NULL)
+					{
+				  		if ( preproc_tos > 0 ) 
+						{
+					  		preproc_tos = 0;
+							mmerror(PARSE_ERROR, ET_FATAL, "missing \"EXEC SQL ENDIF;\"");
+				  		}
+						yyterminate();
+					}
+			  		else
+			  		{
+						struct _yy_buffer *yb = yy_buffer;
+						int i;
+						struct _defines *ptr;
+
+						for (ptr = defines; ptr; ptr = ptr->next)
+							if (ptr->used == yy_buffer)
+							{
+								ptr->used = NULL;
+								break;
+							}
+								
+						if (yyin != NULL)
+							fclose(yyin);
+
+						yy_delete_buffer( YY_CURRENT_BUFFER );
+						yy_switch_to_buffer(yy_buffer->buffer);
+
+						yylineno = yy_buffer->lineno;
+
+						/* We have to output the filename only if we change files here */
+						i = strcmp(input_filename, yy_buffer->filename);
+
+						free(input_filename);
+						input_filename = yy_buffer->filename;
+
+						yy_buffer = yy_buffer->next;
+						free(yb);
+
+						if (i != 0)
+							output_line_number();
+						
+			  		}
+				}
+}
+				break;
+				default:
+					yyterminate();
+			}
+			continue;
+		}
+		yy_state = yy_starts[YY_START * 2 + (yyg->at_bol ? 1 : 0)];
+		yy_rule = 0;
+		yy_last = yy_cp;
+		while (yy_cp < yy_end)
+		{
+			yy_state = yy_nxt[yy_state * YY_NCLASSES + yy_ec[(unsigned char) *yy_cp]];
+			if (yy_state == 0)
+				break;
+			yy_cp++;
+			if (yy_acc[yy_state])
+			{
+				yy_rule = yy_acc[yy_state];
+				yy_last = yy_cp;
+			}
+		}
+		if (yy_rule == 0)
+			YY_FATAL_ERROR("flex scanner jammed");
+		yy_cp = yy_last;
+		yytext = yy_bp;
+		yyleng = (int) (yy_cp - yy_bp);
+		yyg->hold_char = *yy_cp;
+		*yy_cp = 0;
+		yyg->c_buf_p = yy_cp;
+		switch (yy_rule)
+		{
+case 1:
+YY_RULE_SETUP
+{
+{ /* ignore */ }
+}
+	YY_BREAK
+case 2:
+YY_RULE_SETUP
+{
+{
+					token_start = yytext;
+					state_before = YYSTATE;
+					xcdepth = 0;
+					BEGIN(xc);
+					/* Put back any characters past slash-star; see above */
+					yyless(2);
+					fputs("/*", yyout);
+				}
+}
+	YY_BREAK
+case 3:
+YY_RULE_SETUP
+{
+{
+					xcdepth++;
+			 		/* Put back any characters past slash-star; see above */
+			 		yyless(2);
+					fputs("/*", yyout);
+				}
+}
+	YY_BREAK
+case 4:
+YY_RULE_SETUP
+{
+{
+					ECHO;
+					if (xcdepth <= 0)
+					{
+						BEGIN(state_before);
+						token_start = NULL;
+					}
+					else
+						xcdepth--;
+				}
+}
+	YY_BREAK
+case 5:
+YY_RULE_SETUP
+{
+{ ECHO; }
+}
+	YY_BREAK
+case 6:
+YY_RULE_SETUP
+{
+{ ECHO; }
+}
+	YY_BREAK
+case 7:
+YY_RULE_SETUP
+{
+{ ECHO; }
+}
+	YY_BREAK
+case 8:
+YY_RULE_SETUP
+{
+{
+					token_start = yytext;
+					BEGIN(xb);
+					startlit();
+					addlitchar('b');
+				}
+}
+	YY_BREAK
+case 9:
+case 10:
+YY_RULE_SETUP
+{
+{
+					yyless(1);
+					BEGIN(SQL);
+					if (literalbuf[strspn(literalbuf, "01") + 1] != '\0')
+						mmerror(PARSE_ERROR, ET_ERROR, "invalid bit string literal");
+					yylval.str = mm_strdup(literalbuf);
+					return BCONST;
+				}
+}
+	YY_BREAK
+case 11:
+case 12:
+YY_RULE_SETUP
+{
+{ addlit(yytext, yyleng); }
+}
+	YY_BREAK
+case 13:
+case 14:
+YY_RULE_SETUP
+{
+{ /* ignore */ }
+}
+	YY_BREAK
+case 15:
+YY_RULE_SETUP
+{
+{
+					token_start = yytext;
+					BEGIN(xh);
+					startlit();
+					addlitchar('x');
+				}
+}
+	YY_BREAK
+case 16:
+case 17:
+YY_RULE_SETUP
+{
+{
+				yyless(1);
+				BEGIN(SQL);
+				yylval.str = mm_strdup(literalbuf);
+				return XCONST;
+			}
+}
+	YY_BREAK
+case 18:
+YY_RULE_SETUP
+{
+{
+				/* National character.
+				 * Transfer it as-is to the backend.
+				 */
+				token_start = yytext;
+				state_before = YYSTATE;
+				BEGIN(xn);
+				startlit();
+			}
+}
+	YY_BREAK
+case 19:
+YY_RULE_SETUP
+{
+{
+				token_start = yytext;
+				state_before = YYSTATE;
+				BEGIN(xqc);
+				startlit();
+			}
+}
+	YY_BREAK
+case 20:
+YY_RULE_SETUP
+{
+{
+				token_start = yytext;
+				state_before = YYSTATE;
+				BEGIN(xq);
+				startlit();
+			}
+}
+	YY_BREAK
+case 21:
+YY_RULE_SETUP
+{
+{
+				token_start = yytext;
+				state_before = YYSTATE;
+				BEGIN(xe);
+				startlit();
+			}
+}
+	YY_BREAK
+case 22:
+YY_RULE_SETUP
+{
+{
+				token_start = yytext;
+				state_before = YYSTATE;
+				BEGIN(xus);
+				startlit();
+				addlit(yytext, yyleng);
+			}
+}
+	YY_BREAK
+case 23:
+case 24:
+YY_RULE_SETUP
+{
+{
+				yyless(1);
+				BEGIN(state_before);
+				yylval.str = mm_strdup(literalbuf);
+				return SCONST;
+			}
+}
+	YY_BREAK
+case 25:
+case 26:
+YY_RULE_SETUP
+{
+{
+				yyless(1);
+				BEGIN(state_before);
+				yylval.str = mm_strdup(literalbuf);
+				return ECONST;
+			}
+}
+	YY_BREAK
+case 27:
+case 28:
+YY_RULE_SETUP
+{
+{
+				yyless(1);
+				BEGIN(state_before);
+				yylval.str = mm_strdup(literalbuf);
+				return NCONST;
+			}
+}
+	YY_BREAK
+case 29:
+YY_RULE_SETUP
+{
+{
+				addlit(yytext, yyleng);
+				BEGIN(state_before);
+				yylval.str = mm_strdup(literalbuf);
+				return UCONST;
+			}
+}
+	YY_BREAK
+case 30:
+YY_RULE_SETUP
+{
+{ addlitchar('\''); }
+}
+	YY_BREAK
+case 31:
+YY_RULE_SETUP
+{
+{
+				addlitchar('\\');
+				addlitchar('\'');
+			}
+}
+	YY_BREAK
+case 32:
+YY_RULE_SETUP
+{
+{ addlit(yytext, yyleng); }
+}
+	YY_BREAK
+case 33:
+YY_RULE_SETUP
+{
+{ addlit(yytext, yyleng); }
+}
+	YY_BREAK
+case 34:
+YY_RULE_SETUP
+{
+{ addlit(yytext, yyleng); }
+}
+	YY_BREAK
+case 35:
+YY_RULE_SETUP
+{
+{ addlit(yytext, yyleng); }
+}
+	YY_BREAK
+case 36:
+YY_RULE_SETUP
+{
+{ addlit(yytext, yyleng); }
+}
+	YY_BREAK
+case 37:
+YY_RULE_SETUP
+{
+{ /* ignore */ }
+}
+	YY_BREAK
+case 38:
+YY_RULE_SETUP
+{
+{
+			   /* This is only needed for \ just before EOF */
+			   addlitchar(yytext[0]);
+			}
+}
+	YY_BREAK
+case 39:
+YY_RULE_SETUP
+{
+{
+				/* throw back all but the initial "$" */
+				yyless(1);
+				/* and treat it as {other} */
+				return yytext[0];	
+			}
+}
+	YY_BREAK
+case 40:
+YY_RULE_SETUP
+{
+{
+				token_start = yytext;
+				dolqstart = mm_strdup(yytext);
+				BEGIN(xdolq);
+				startlit();
+				addlit(yytext, yyleng);
+			}
+}
+	YY_BREAK
+case 41:
+YY_RULE_SETUP
+{
+{
+				if (strcmp(yytext, dolqstart) == 0)
+				{
+					addlit(yytext, yyleng);
+					free(dolqstart);
+					BEGIN(SQL);
+					yylval.str = mm_strdup(literalbuf);
+					return DOLCONST;
+				}
+				else
+				{
+			        /*
+			         * When we fail to match $...$ to dolqstart, transfer
+			         * the $... part to the output, but put back the final
+			         * $ for rescanning.  Consider $delim$...$junk$delim$
+			         */
+			        addlit(yytext, yyleng-1);
+			        yyless(yyleng-1);
+				}
+			}
+}
+	YY_BREAK
+case 42:
+YY_RULE_SETUP
+{
+{ addlit(yytext, yyleng); }
+}
+	YY_BREAK
+case 43:
+YY_RULE_SETUP
+{
+{ addlit(yytext, yyleng); }
+}
+	YY_BREAK
+case 44:
+YY_RULE_SETUP
+{
+{
+				/* single quote or dollar sign */
+				addlitchar(yytext[0]);
+			}
+}
+	YY_BREAK
+case 45:
+YY_RULE_SETUP
+{
+{
+						state_before = YYSTATE;
+						BEGIN(xd);
+						startlit();
+					}
+}
+	YY_BREAK
+case 46:
+YY_RULE_SETUP
+{
+{
+						state_before = YYSTATE;
+						BEGIN(xui);
+						startlit();
+						addlit(yytext, yyleng);
+					}
+}
+	YY_BREAK
+case 47:
+YY_RULE_SETUP
+{
+{
+						BEGIN(state_before);
+						if (literallen == 0)
+							mmerror(PARSE_ERROR, ET_ERROR, "zero-length delimited identifier");
+						/* The backend will truncate the identifier here. We do not as it does not change the result. */
+						yylval.str = mm_strdup(literalbuf);
+						return CSTRING;
+					}
+}
+	YY_BREAK
+case 48:
+YY_RULE_SETUP
+{
+{
+						BEGIN(state_before);
+						yylval.str = mm_strdup(literalbuf);
+						return CSTRING;
+					}
+}
+	YY_BREAK
+case 49:
+YY_RULE_SETUP
+{
+{
+						BEGIN(state_before);
+						if (literallen == 2) /* "U&" */
+							mmerror(PARSE_ERROR, ET_ERROR, "zero-length delimited identifier");
+						/* The backend will truncate the identifier here. We do not as it does not change the result. */
+						addlit(yytext, yyleng);
+						yylval.str = mm_strdup(literalbuf);
+						return UIDENT;
+					}
+}
+	YY_BREAK
+case 50:
+YY_RULE_SETUP
+{
+{ addlitchar('"'); }
+}
+	YY_BREAK
+case 51:
+YY_RULE_SETUP
+{
+{ addlit(yytext, yyleng); }
+}
+	YY_BREAK
+case 52:
+YY_RULE_SETUP
+{
+{
+						state_before = YYSTATE;
+						BEGIN(xdc);
+						startlit();
+					}
+}
+	YY_BREAK
+case 53:
+YY_RULE_SETUP
+{
+{ addlit(yytext, yyleng); }
+}
+	YY_BREAK
+case 54:
+YY_RULE_SETUP
+{
+{ return TYPECAST; }
+}
+	YY_BREAK
+case 55:
+YY_RULE_SETUP
+{
+{ return DOT_DOT; }
+}
+	YY_BREAK
+case 56:
+YY_RULE_SETUP
+{
+{ return COLON_EQUALS; }
+}
+	YY_BREAK
+case 57:
+YY_RULE_SETUP
+{
+{
+			  /* are we simulating Informix? */
+				if (INFORMIX_MODE)
+				{
+					unput(':');
+				}
+				else
+					return yytext[0];
+				}
+}
+	YY_BREAK
+case 58:
+YY_RULE_SETUP
+{
+{ /*
+					   * We may find a ';' inside a structure
+					   * definition in a TYPE or VAR statement.
+					   * This is not an EOL marker.
+					   */
+					  if (yytext[0] == ';' && struct_level == 0)
+						 BEGIN(C);
+					  return yytext[0];
+					}
+}
+	YY_BREAK
+case 59:
+YY_RULE_SETUP
+{
+{
+						/*
+						 * Check for embedded slash-star or dash-dash; those
+						 * are comment starts, so operator must stop there.
+						 * Note that slash-star or dash-dash at the first
+						 * character will match a prior rule, not this one.
+						 */
+						int		nchars = yyleng;
+						char   *slashstar = strstr(yytext, "/*");
+						char   *dashdash = strstr(yytext, "--");
+
+						if (slashstar && dashdash)
+						{
+							/* if both appear, take the first one */
+							if (slashstar > dashdash)
+								slashstar = dashdash;
+						}
+						else if (!slashstar)
+							slashstar = dashdash;
+						if (slashstar)
+							nchars = slashstar - yytext;
+
+						/*
+						 * For SQL compatibility, '+' and '-' cannot be the
+						 * last char of a multi-char operator unless the operator
+						 * contains chars that are not in SQL operators.
+						 * The idea is to lex '=-' as two operators, but not
+						 * to forbid operator names like '?-' that could not be
+						 * sequences of SQL operators.
+						 */
+						while (nchars > 1 &&
+							   (yytext[nchars-1] == '+' ||
+								yytext[nchars-1] == '-'))
+						{
+							int		ic;
+
+							for (ic = nchars-2; ic >= 0; ic--)
+							{
+								if (strchr("~!@#^&|`?%", yytext[ic]))
+									break;
+							}
+							if (ic >= 0)
+								break; /* found a char that makes it OK */
+							nchars--; /* else remove the +/-, and check again */
+						}
+
+						if (nchars < yyleng)
+						{
+							/* Strip the unwanted chars from the token */
+							yyless(nchars);
+							/*
+							 * If what we have left is only one char, and it's
+							 * one of the characters matching "self", then
+							 * return it as a character token the same way
+							 * that the "self" rule would have.
+							 */
+							if (nchars == 1 &&
+								strchr(",()[].;:+-*/%^<>=", yytext[0]))
+								return yytext[0];
+						}
+
+						/* Convert "!=" operator to "<>" for compatibility */
+						if (strcmp(yytext, "!=") == 0)
+							yylval.str = mm_strdup("<>");
+						else
+							yylval.str = mm_strdup(yytext);
+						return Op;
+					}
+}
+	YY_BREAK
+case 60:
+YY_RULE_SETUP
+{
+{
+						yylval.ival = atol(yytext+1);
+						return PARAM;
+					}
+}
+	YY_BREAK
+case 61:
+YY_RULE_SETUP
+{
+{
+						long val;
+						char* endptr;
+
+						errno = 0;
+						val = strtol((char *)yytext, &endptr,10);
+						if (*endptr != '\0' || errno == ERANGE
+#ifdef HAVE_LONG_INT_64
+							/* if long > 32 bits, check for overflow of int4 */
+							|| val != (long) ((int32) val)
+#endif
+							)
+						{
+							errno = 0;
+							yylval.str = mm_strdup(yytext);
+							return FCONST;
+						}
+						yylval.ival = val;
+						return ICONST;
+					}
+}
+	YY_BREAK
+case 62:
+YY_RULE_SETUP
+{
+{
+						yylval.str = mm_strdup(yytext);
+						return IP;
+				}
+}
+	YY_BREAK
+case 63:
+YY_RULE_SETUP
+{
+{
+						yylval.str = mm_strdup(yytext);
+						return FCONST;
+			}
+}
+	YY_BREAK
+case 64:
+YY_RULE_SETUP
+{
+{
+						yylval.str = mm_strdup(yytext);
+						return FCONST;
+			}
+}
+	YY_BREAK
+case 65:
+YY_RULE_SETUP
+{
+{
+						yyless(yyleng-1);
+						yylval.str = mm_strdup(yytext);
+						return FCONST;
+					}
+}
+	YY_BREAK
+case 66:
+YY_RULE_SETUP
+{
+{
+						yyless(yyleng-2);
+						yylval.str = mm_strdup(yytext);
+						return FCONST;
+					}
+}
+	YY_BREAK
+case 67:
+YY_RULE_SETUP
+{
+{
+						yylval.str = mm_strdup(yytext+1);
+						return(CVARIABLE);
+					}
+}
+	YY_BREAK
+case 68:
+YY_RULE_SETUP
+{
+{
+						const ScanKeyword    *keyword;
+						
+						if (!isdefine())
+						{
+							/* Is it an SQL/ECPG keyword? */
+							keyword = ScanECPGKeywordLookup(yytext);
+							if (keyword != NULL)
+								return keyword->value;
+
+							/* Is it a C keyword? */
+							keyword = ScanCKeywordLookup(yytext);
+							if (keyword != NULL)
+								return keyword->value;
+
+							/*
+							 * None of the above.  Return it as an identifier.
+							 *
+							 * The backend will attempt to truncate and case-fold
+							 * the identifier, but I see no good reason for ecpg
+							 * to do so; that's just another way that ecpg could get
+							 * out of step with the backend.
+							 */
+							yylval.str = mm_strdup(yytext);
+							return IDENT;
+						}
+					}
+}
+	YY_BREAK
+case 69:
+YY_RULE_SETUP
+{
+{ return yytext[0]; }
+}
+	YY_BREAK
+case 70:
+YY_RULE_SETUP
+{
+{ BEGIN(SQL); return SQL_START; }
+}
+	YY_BREAK
+case 71:
+YY_RULE_SETUP
+{
+{ 
+						/* are we simulating Informix? */
+						if (INFORMIX_MODE)
+						{
+							BEGIN(SQL);
+							return SQL_START;
+						}
+						else
+							return S_ANYTHING;
+					 }
+}
+	YY_BREAK
+case 72:
+YY_RULE_SETUP
+{
+{ ECHO; }
+}
+	YY_BREAK
+case 73:
+YY_RULE_SETUP
+{
+{
+						char* endptr;
+
+						errno = 0;
+						yylval.ival = strtoul((char *)yytext,&endptr,16);
+						if (*endptr != '\0' || errno == ERANGE)
+						{
+							errno = 0;
+							yylval.str = mm_strdup(yytext);
+							return SCONST;
+						}
+						return ICONST;
+					}
+}
+	YY_BREAK
+case 74:
+YY_RULE_SETUP
+{
+{
+						if (system_includes)
+						{
+							include_next = false;
+							BEGIN(incl);
+						}
+						else
+					 	{
+							yylval.str = mm_strdup(yytext);
+							return(CPP_LINE);
+					  	}
+					}
+}
+	YY_BREAK
+case 75:
+YY_RULE_SETUP
+{
+{
+						if (system_includes)
+						{
+							include_next = true;
+							BEGIN(incl);
+						}
+						else
+					 	{
+							yylval.str = mm_strdup(yytext);
+							return(CPP_LINE);
+					  	}
+					}
+}
+	YY_BREAK
+case 76:
+YY_RULE_SETUP
+{
+{
+						yylval.str = mm_strdup(yytext);
+						return(CPP_LINE);
+					}
+}
+	YY_BREAK
+case 77:
+YY_RULE_SETUP
+{
+{
+						const ScanKeyword		*keyword;
+
+						/*
+						 * Try to detect a function name:
+						 * look for identifiers at the global scope
+						 * keep the last identifier before the first '(' and '{' */
+						if (braces_open == 0 && parenths_open == 0)
+						{
+							if (current_function)
+								free(current_function);
+							current_function = mm_strdup(yytext);
+						}
+						/* Informix uses SQL defines only in SQL space */
+						/* however, some defines have to be taken care of for compatibility */
+						if ((!INFORMIX_MODE || !isinformixdefine()) && !isdefine())
+						{
+							keyword = ScanCKeywordLookup(yytext);
+							if (keyword != NULL)
+								return keyword->value;
+							else
+							{
+								yylval.str = mm_strdup(yytext);
+								return IDENT;
+							}
+						}
+					}
+}
+	YY_BREAK
+case 78:
+YY_RULE_SETUP
+{
+{ return(':'); }
+}
+	YY_BREAK
+case 79:
+YY_RULE_SETUP
+{
+{ return(';'); }
+}
+	YY_BREAK
+case 80:
+YY_RULE_SETUP
+{
+{ return(','); }
+}
+	YY_BREAK
+case 81:
+YY_RULE_SETUP
+{
+{ return('*'); }
+}
+	YY_BREAK
+case 82:
+YY_RULE_SETUP
+{
+{ return('%'); }
+}
+	YY_BREAK
+case 83:
+YY_RULE_SETUP
+{
+{ return('/'); }
+}
+	YY_BREAK
+case 84:
+YY_RULE_SETUP
+{
+{ return('+'); }
+}
+	YY_BREAK
+case 85:
+YY_RULE_SETUP
+{
+{ return('-'); }
+}
+	YY_BREAK
+case 86:
+YY_RULE_SETUP
+{
+{ parenths_open++; return('('); }
+}
+	YY_BREAK
+case 87:
+YY_RULE_SETUP
+{
+{ parenths_open--; return(')'); }
+}
+	YY_BREAK
+case 88:
+YY_RULE_SETUP
+{
+{ ECHO; }
+}
+	YY_BREAK
+case 89:
+YY_RULE_SETUP
+{
+{ return('{'); }
+}
+	YY_BREAK
+case 90:
+YY_RULE_SETUP
+{
+{ return('}'); }
+}
+	YY_BREAK
+case 91:
+YY_RULE_SETUP
+{
+{ return('['); }
+}
+	YY_BREAK
+case 92:
+YY_RULE_SETUP
+{
+{ return(']'); }
+}
+	YY_BREAK
+case 93:
+YY_RULE_SETUP
+{
+{ return('='); }
+}
+	YY_BREAK
+case 94:
+YY_RULE_SETUP
+{
+{ return(S_MEMBER); }
+}
+	YY_BREAK
+case 95:
+YY_RULE_SETUP
+{
+{ return(S_RSHIFT); }
+}
+	YY_BREAK
+case 96:
+YY_RULE_SETUP
+{
+{ return(S_LSHIFT); }
+}
+	YY_BREAK
+case 97:
+YY_RULE_SETUP
+{
+{ return(S_OR); }
+}
+	YY_BREAK
+case 98:
+YY_RULE_SETUP
+{
+{ return(S_AND); }
+}
+	YY_BREAK
+case 99:
+YY_RULE_SETUP
+{
+{ return(S_INC); }
+}
+	YY_BREAK
+case 100:
+YY_RULE_SETUP
+{
+{ return(S_DEC); }
+}
+	YY_BREAK
+case 101:
+YY_RULE_SETUP
+{
+{ return(S_EQUAL); }
+}
+	YY_BREAK
+case 102:
+YY_RULE_SETUP
+{
+{ return(S_NEQUAL); }
+}
+	YY_BREAK
+case 103:
+YY_RULE_SETUP
+{
+{ return(S_ADD); }
+}
+	YY_BREAK
+case 104:
+YY_RULE_SETUP
+{
+{ return(S_SUB); }
+}
+	YY_BREAK
+case 105:
+YY_RULE_SETUP
+{
+{ return(S_MUL); }
+}
+	YY_BREAK
+case 106:
+YY_RULE_SETUP
+{
+{ return(S_DIV); }
+}
+	YY_BREAK
+case 107:
+YY_RULE_SETUP
+{
+{ return(S_MOD); }
+}
+	YY_BREAK
+case 108:
+YY_RULE_SETUP
+{
+{ return(S_MEMPOINT); }
+}
+	YY_BREAK
+case 109:
+YY_RULE_SETUP
+{
+{ return(S_DOTPOINT); }
+}
+	YY_BREAK
+case 110:
+YY_RULE_SETUP
+{
+{ return S_ANYTHING; }
+}
+	YY_BREAK
+case 111:
+YY_RULE_SETUP
+{
+{ BEGIN(def_ident); }
+}
+	YY_BREAK
+case 112:
+YY_RULE_SETUP
+{
+{
+						/* are we simulating Informix? */
+						if (INFORMIX_MODE)
+						{
+							BEGIN(def_ident);
+						}
+						else
+						{
+							yyless(1);
+							return (S_ANYTHING);
+						}
+					}
+}
+	YY_BREAK
+case 113:
+YY_RULE_SETUP
+{
+{ BEGIN(undef); }
+}
+	YY_BREAK
+case 114:
+YY_RULE_SETUP
+{
+{
+						/* are we simulating Informix? */
+						if (INFORMIX_MODE)
+						{
+							BEGIN(undef);
+						}
+						else
+						{
+							yyless(1);
+							return (S_ANYTHING);
+						}
+					}
+}
+	YY_BREAK
+case 115:
+YY_RULE_SETUP
+{
+{
+					struct _defines *ptr, *ptr2 = NULL;
+					int i;
+
+					/*
+					 *	Skip the ";" and trailing whitespace. Note that yytext
+					 *	contains at least one non-space character plus the ";"
+					 */
+					for (i = strlen(yytext)-2;
+						 i > 0 && ecpg_isspace(yytext[i]);
+						 i-- )
+						;
+					yytext[i+1] = '\0';
+
+
+					for (ptr = defines; ptr != NULL; ptr2 = ptr, ptr = ptr->next)
+					{
+						if (strcmp(yytext, ptr->old) == 0)
+						{
+							if (ptr2 == NULL)
+								defines = ptr->next;
+							else
+								ptr2->next = ptr->next;
+							free(ptr->new);
+							free(ptr->old);
+							free(ptr);
+							break;
+						}
+					}
+
+					BEGIN(C);
+				}
+}
+	YY_BREAK
+case 116:
+YY_RULE_SETUP
+{
+{
+		                	mmerror(PARSE_ERROR, ET_FATAL, "missing identifier in EXEC SQL UNDEF command");
+			                yyterminate();
+				}
+}
+	YY_BREAK
+case 117:
+YY_RULE_SETUP
+{
+{ BEGIN(incl); }
+}
+	YY_BREAK
+case 118:
+YY_RULE_SETUP
+{
+{ 
+					  /* are we simulating Informix? */
+					  if (INFORMIX_MODE)
+					  {
+						  BEGIN(incl);
+					  }
+					  else
+					  {
+						  yyless(1);
+						  return (S_ANYTHING);
+					  }
+					}
+}
+	YY_BREAK
+case 119:
+YY_RULE_SETUP
+{
+{ ifcond = TRUE; BEGIN(xcond); }
+}
+	YY_BREAK
+case 120:
+YY_RULE_SETUP
+{
+{ 
+					  /* are we simulating Informix? */
+					  if (INFORMIX_MODE)
+					  {
+						  ifcond = TRUE;
+						  BEGIN(xcond);
+					  }
+					  else
+					  {
+						  yyless(1);
+						  return (S_ANYTHING);
+					  }
+					}
+}
+	YY_BREAK
+case 121:
+YY_RULE_SETUP
+{
+{ ifcond = FALSE; BEGIN(xcond); }
+}
+	YY_BREAK
+case 122:
+YY_RULE_SETUP
+{
+{ 
+					  /* are we simulating Informix? */
+					  if (INFORMIX_MODE)
+					  {
+						  ifcond = FALSE;
+						  BEGIN(xcond);
+					  }
+					  else
+					  {
+						  yyless(1);
+						  return (S_ANYTHING);
+					  }
+					}
+}
+	YY_BREAK
+case 123:
+YY_RULE_SETUP
+{
+{	/* pop stack */
+						if ( preproc_tos == 0 ) {
+							mmerror(PARSE_ERROR, ET_FATAL, "missing matching \"EXEC SQL IFDEF\" / \"EXEC SQL IFNDEF\"");
+						}
+						else if ( stacked_if_value[preproc_tos].else_branch )
+							mmerror(PARSE_ERROR, ET_FATAL, "missing \"EXEC SQL ENDIF;\"");
+						else
+							preproc_tos--;
+
+						ifcond = TRUE; BEGIN(xcond);
+					}
+}
+	YY_BREAK
+case 124:
+YY_RULE_SETUP
+{
+{ 
+					/* are we simulating Informix? */
+					if (INFORMIX_MODE)
+					{
+						if (preproc_tos == 0)
+							mmerror(PARSE_ERROR, ET_FATAL, "missing matching \"EXEC SQL IFDEF\" / \"EXEC SQL IFNDEF\"");
+						else if (stacked_if_value[preproc_tos].else_branch)
+							mmerror(PARSE_ERROR, ET_FATAL, "missing \"EXEC SQL ENDIF;\"");
+						else
+							preproc_tos--;
+
+						ifcond = TRUE;
+						BEGIN(xcond);
+					}
+					else
+					{
+						yyless(1);
+						return (S_ANYTHING);
+					}
+				}
+}
+	YY_BREAK
+case 125:
+YY_RULE_SETUP
+{
+{	/* only exec sql endif pops the stack, so take care of duplicated 'else' */
+					if (stacked_if_value[preproc_tos].else_branch)
+						mmerror(PARSE_ERROR, ET_FATAL, "more than one EXEC SQL ELSE");
+					else
+					{
+						stacked_if_value[preproc_tos].else_branch = TRUE;
+						stacked_if_value[preproc_tos].condition =
+							(stacked_if_value[preproc_tos-1].condition &&
+							 !stacked_if_value[preproc_tos].condition);
+
+						if (stacked_if_value[preproc_tos].condition)
+							BEGIN(C);
+						else
+							BEGIN(xskip);
+					}
+				}
+}
+	YY_BREAK
+case 126:
+YY_RULE_SETUP
+{
+{
+					/* are we simulating Informix? */
+					if (INFORMIX_MODE)
+					{
+						if (stacked_if_value[preproc_tos].else_branch)
+							mmerror(PARSE_ERROR, ET_FATAL, "more than one EXEC SQL ELSE");
+						else
+						{
+							stacked_if_value[preproc_tos].else_branch = TRUE;
+							stacked_if_value[preproc_tos].condition =
+							(stacked_if_value[preproc_tos-1].condition &&
+							 !stacked_if_value[preproc_tos].condition);
+
+							if (stacked_if_value[preproc_tos].condition)
+								BEGIN(C);
+							else
+								BEGIN(xskip);
+						}
+					}
+					else
+					{
+						yyless(1);
+						return (S_ANYTHING);
+					}
+				}
+}
+	YY_BREAK
+case 127:
+YY_RULE_SETUP
+{
+{
+					if (preproc_tos == 0)
+						mmerror(PARSE_ERROR, ET_FATAL, "unmatched EXEC SQL ENDIF");
+					else
+						preproc_tos--;
+
+					if (stacked_if_value[preproc_tos].condition)
+					   BEGIN(C);
+					else
+					   BEGIN(xskip);
+				}
+}
+	YY_BREAK
+case 128:
+YY_RULE_SETUP
+{
+{
+					/* are we simulating Informix? */
+					if (INFORMIX_MODE)
+					{
+						if (preproc_tos == 0)
+							mmerror(PARSE_ERROR, ET_FATAL, "unmatched EXEC SQL ENDIF");
+						else
+							preproc_tos--;
+
+						if (stacked_if_value[preproc_tos].condition)
+							BEGIN(C);
+						else
+							BEGIN(xskip);
+					}
+					else
+					{
+						yyless(1);
+						return (S_ANYTHING);
+					}
+				}
+}
+	YY_BREAK
+case 129:
+YY_RULE_SETUP
+{
+{ /* ignore */ }
+}
+	YY_BREAK
+case 130:
+YY_RULE_SETUP
+{
+{
+					if (preproc_tos >= MAX_NESTED_IF-1)
+						mmerror(PARSE_ERROR, ET_FATAL, "too many nested EXEC SQL IFDEF conditions");
+					else 
+					{
+						struct _defines *defptr;
+						unsigned int i;
+
+						/*
+						 *	Skip the ";" and trailing whitespace. Note that yytext
+						 *	contains at least one non-space character plus the ";"
+						 */
+						for (i = strlen(yytext)-2;
+							 i > 0 && ecpg_isspace(yytext[i]);
+							 i-- )
+							;
+						yytext[i+1] = '\0';
+
+						for (defptr = defines;
+							 defptr != NULL && strcmp(yytext, defptr->old) != 0;
+							 defptr = defptr->next);
+
+						preproc_tos++;
+						stacked_if_value[preproc_tos].else_branch = FALSE;
+						stacked_if_value[preproc_tos].condition =
+						(defptr ? ifcond : !ifcond) && stacked_if_value[preproc_tos-1].condition;
+					}
+
+					if (stacked_if_value[preproc_tos].condition)
+						BEGIN(C);
+					else
+						BEGIN(xskip);
+				}
+}
+	YY_BREAK
+case 131:
+YY_RULE_SETUP
+{
+{
+				mmerror(PARSE_ERROR, ET_FATAL, "missing identifier in EXEC SQL IFDEF command");
+				yyterminate();
+			}
+}
+	YY_BREAK
+case 132:
+YY_RULE_SETUP
+{
+{
+				old = mm_strdup(yytext);
+				BEGIN(def);
+				startlit();
+			}
+}
+	YY_BREAK
+case 133:
+YY_RULE_SETUP
+{
+{
+				mmerror(PARSE_ERROR, ET_FATAL, "missing identifier in EXEC SQL DEFINE command");
+				yyterminate();
+			}
+}
+	YY_BREAK
+case 134:
+YY_RULE_SETUP
+{
+{
+						struct _defines *ptr, *this;
+
+						for (ptr = defines; ptr != NULL; ptr = ptr->next)
+						{
+							 if (strcmp(old, ptr->old) == 0)
+							 {
+								free(ptr->new);
+								ptr->new = mm_strdup(literalbuf);
+							 }
+						}
+						if (ptr == NULL)
+						{
+							this = (struct _defines *) mm_alloc(sizeof(struct _defines));
+
+							/* initial definition */
+							this->old = old;
+							this->new = mm_strdup(literalbuf);
+							this->next = defines;
+							this->used = NULL;
+							defines = this;
+						}
+
+						BEGIN(C);
+					}
+}
+	YY_BREAK
+case 135:
+YY_RULE_SETUP
+{
+{ addlit(yytext, yyleng); }
+}
+	YY_BREAK
+case 136:
+YY_RULE_SETUP
+{
+{	parse_include(); }
+}
+	YY_BREAK
+case 137:
+YY_RULE_SETUP
+{
+{	parse_include(); }
+}
+	YY_BREAK
+case 138:
+YY_RULE_SETUP
+{
+{ parse_include(); }
+}
+	YY_BREAK
+case 139:
+YY_RULE_SETUP
+{
+{
+					mmerror(PARSE_ERROR, ET_FATAL, "syntax error in EXEC SQL INCLUDE command");
+					yyterminate();
+				}
+}
+	YY_BREAK
+case 140:
+YY_RULE_SETUP
+{
+{ mmerror(PARSE_ERROR, ET_FATAL, "internal error: unreachable state; please report this to <pgsql-bugs@postgresql.org>"); }
+}
+	YY_BREAK
+			default:
+				YY_FATAL_ERROR("bad rule");
+		}
+	}
+}
+static void yy_fatal_error(const char *msg)
+{
+	(void) fprintf(stderr, "%s\n", msg);
+	exit(YY_EXIT_FAILURE);
+}
+static void yy_save_state(struct yyguts_t *g)
+{
+	if (g->cur)
+	{
+		*g->c_buf_p = g->hold_char;
+		g->cur->pos = g->c_buf_p;
+		g->cur->at_bol = g->at_bol;
+	}
+}
+void yy_switch_to_buffer(YY_BUFFER_STATE b)
+{
+	yy_save_state(yyg);
+	yyg->cur = b;
+	if (b)
+	{
+		yyg->c_buf_p = b->pos;
+		yyg->hold_char = *b->pos;
+		yyg->at_bol = b->at_bol;
+	}
+}
+static YY_BUFFER_STATE yy_new_buffer(char *base, yy_size_t len, int owns)
+{
+	YY_BUFFER_STATE b = (YY_BUFFER_STATE) yyalloc(sizeof(struct yy_buffer_state));
+	if (!b)
+		YY_FATAL_ERROR("out of dynamic memory");
+	b->base = base;
+	b->end = base + len;
+	b->pos = base;
+	b->at_bol = 1;
+	b->owns = owns;
+	return b;
+}
+YY_BUFFER_STATE yy_scan_buffer(char *base, yy_size_t size)
+{
+	YY_BUFFER_STATE b;
+	if (size < 2 || base[size - 2] != YY_END_OF_BUFFER_CHAR || base[size - 1] != YY_END_OF_BUFFER_CHAR)
+		return NULL;
+	b = yy_new_buffer(base, size - 2, 0);
+	yy_switch_to_buffer(b);
+	return b;
+}
+YY_BUFFER_STATE yy_scan_bytes(const char *bytes, int len)
+{
+	char *buf = (char *) yyalloc(len + 2);
+	YY_BUFFER_STATE b;
+	if (!buf)
+		YY_FATAL_ERROR("out of dynamic memory");
+	memcpy(buf, bytes, len);
+	buf[len] = buf[len + 1] = YY_END_OF_BUFFER_CHAR;
+	b = yy_scan_buffer(buf, len + 2);
+	b->owns = 1;
+	return b;
+}
+YY_BUFFER_STATE yy_scan_string(const char *str)
+{
+	return yy_scan_bytes(str, (int) strlen(str));
+}
+YY_BUFFER_STATE yy_create_buffer(FILE *file, int size)
+{
+	yy_size_t cap = 8192, len = 0, n;
+	char *buf = (char *) yyalloc(cap);
+	(void) size;
+	if (!buf)
+		YY_FATAL_ERROR("out of dynamic memory");
+	while ((n = fread(buf + len, 1, cap - len - 2, file)) > 0)
+	{
+		len += n;
+		if (cap - len - 2 == 0)
+		{
+			cap *= 2;
+			buf = (char *) yyrealloc(buf, cap);
+			if (!buf)
+				YY_FATAL_ERROR("out of dynamic memory");
+		}
+	}
+	buf[len] = buf[len + 1] = YY_END_OF_BUFFER_CHAR;
+	return yy_new_buffer(buf, len, 1);
+}
+void yyrestart(FILE *file)
+{
+	yy_switch_to_buffer(yy_create_buffer(file, YY_BUF_SIZE));
+}
+void yy_delete_buffer(YY_BUFFER_STATE b)
+{
+	if (!b)
+		return;
+	if (b == yyg->cur)
+		yyg->cur = NULL;
+	if (b->owns)
+		yyfree(b->base);
+	yyfree(b);
+}
+void *yyalloc(yy_size_t n)
+{
+	return malloc(n);
+}
+void *yyrealloc(void *p, yy_size_t n)
+{
+	return realloc(p, n);
+}
+void yyfree(void *p)
+{
+	free(p);
+}
+
+void
+lex_init(void)
+{
+	braces_open = 0;
+	parenths_open = 0;
+	current_function = NULL;
+
+	preproc_tos = 0;
+	yylineno = 1;
+	ifcond = TRUE;
+	stacked_if_value[preproc_tos].condition = ifcond;
+	stacked_if_value[preproc_tos].else_branch = FALSE;
+
+	/* initialize literal buffer to a reasonable but expansible size */
+	if (literalbuf == NULL)
+	{
+		literalalloc = 1024;
+		literalbuf = (char *) malloc(literalalloc);
+	}
+	startlit();
+
+	BEGIN(C);
+}
+
+static void
+addlit(char *ytext, int yleng)
+{
+	/* enlarge buffer if needed */
+	if ((literallen+yleng) >= literalalloc)
+	{
+		do 
+			literalalloc *= 2;
+		while ((literallen+yleng) >= literalalloc);
+		literalbuf = (char *) realloc(literalbuf, literalalloc);
+	}
+	/* append new data, add trailing null */
+	memcpy(literalbuf+literallen, ytext, yleng);
+	literallen += yleng;
+	literalbuf[literallen] = '\0';
+}
+
+static void
+addlitchar(unsigned char ychar)
+{
+	/* enlarge buffer if needed */
+        if ((literallen+1) >= literalalloc)
+        {
+                literalalloc *= 2;
+                literalbuf = (char *) realloc(literalbuf, literalalloc);
+        }
+	/* append new data, add trailing null */
+	literalbuf[literallen] = ychar;
+	literallen += 1;
+	literalbuf[literallen] = '\0';
+}
+
+static void
+parse_include(void)
+{
+	/* got the include file name */
+	struct _yy_buffer *yb;
+  	struct _include_path *ip;
+  	char inc_file[MAXPGPATH];
+  	unsigned int i;
+
+  	yb = mm_alloc(sizeof(struct _yy_buffer));
+
+  	yb->buffer =	YY_CURRENT_BUFFER;
+  	yb->lineno = yylineno;
+  	yb->filename = input_filename;
+  	yb->next = yy_buffer;
+
+  	yy_buffer = yb;
+
+  	/*
+	 * skip the ";" if there is one and trailing whitespace. Note that
+	 * yytext contains at least one non-space character plus the ";" 
+	 */
+  	for (i = strlen(yytext)-2;
+		 i > 0 && ecpg_isspace(yytext[i]);
+		 i--)
+		;
+
+	if (yytext[i] == ';')
+		i--;
+
+	yytext[i+1] = '\0';
+	
+	yyin = NULL;
+
+	/* If file name is enclosed in '"' remove these and look only in '.' */
+	/* Informix does look into all include paths though, except filename starts with '/' */
+	if (yytext[0] == '"' && yytext[i] == '"' &&
+	    ((compat != ECPG_COMPAT_INFORMIX && compat != ECPG_COMPAT_INFORMIX_SE) || yytext[1] == '/'))
+	{
+		yytext[i] = '\0';
+		memmove(yytext, yytext+1, strlen(yytext));
+	
+		strncpy(inc_file, yytext, sizeof(inc_file));
+		yyin = fopen(inc_file, "r");
+		if (!yyin)
+		{
+			if (strcmp(inc_file + strlen(inc_file) - 2, ".h"))
+			{
+				strcat(inc_file, ".h");
+				yyin = fopen(inc_file, "r");
+			}
+		}
+		
+	}
+	else
+	{
+		if ((yytext[0] == '"' && yytext[i] == '"') || (yytext[0] == '<' && yytext[i] == '>'))
+		{
+			yytext[i] = '\0';
+			memmove(yytext, yytext+1, strlen(yytext));
+		}
+		
+	  	for (ip = include_paths; yyin == NULL && ip != NULL; ip = ip->next)
+	  	{
+			if (strlen(ip->path) + strlen(yytext) + 3 > MAXPGPATH)
+			{
+				fprintf(stderr, _("Error: include path \"%s/%s\" is too long on line %d, skipping\n"), ip->path, yytext, yylineno);
+				continue;
+			}
+			snprintf (inc_file, sizeof(inc_file), "%s/%s", ip->path, yytext);
+			yyin = fopen(inc_file, "r");
+			if (!yyin)
+			{
+				if (strcmp(inc_file + strlen(inc_file) - 2, ".h"))
+				{
+					strcat(inc_file, ".h");
+					yyin = fopen( inc_file, "r" );
+				}
+			}
+			/* if the command was "include_next" we have to disregard the first hit */
+			if (yyin && include_next)
+			{
+				yyin = NULL;
+				include_next = false;
+			}
+		}
+	}
+	if (!yyin)
+		mmerror(NO_INCLUDE_FILE, ET_FATAL, "could not open include file \"%s\" on line %d", yytext, yylineno);
+
+	input_filename = mm_strdup(inc_file);
+	yy_switch_to_buffer(yy_create_buffer(yyin,YY_BUF_SIZE ));
+	yylineno = 1;
+	output_line_number();
+
+  	BEGIN(C);
+}
+
+/*
+ * ecpg_isspace() --- return TRUE if flex scanner considers char whitespace
+ */
+static bool
+ecpg_isspace(char ch)
+{
+	if (ch == ' ' ||
+		ch == '\t' ||
+		ch == '\n' ||
+		ch == '\r' ||
+		ch == '\f')
+		return true;
+	return false;
+}
+
+static bool isdefine(void)
+{
+	struct _defines *ptr;
+
+	/* is it a define? */
+	for (ptr = defines; ptr; ptr = ptr->next)
+	{
+		if (strcmp(yytext, ptr->old) == 0 && ptr->used == NULL)
+		{
+			struct _yy_buffer *yb;
+
+			yb = mm_alloc(sizeof(struct _yy_buffer));
+
+			yb->buffer =  YY_CURRENT_BUFFER;
+			yb->lineno = yylineno;
+			yb->filename = mm_strdup(input_filename);
+			yb->next = yy_buffer;
+
+			ptr->used = yy_buffer = yb;
+
+			yy_scan_string(ptr->new);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool isinformixdefine(void)
+{
+	const char *new = NULL;
+
+	if (strcmp(yytext, "dec_t") == 0)
+		new = "decimal";
+	else if (strcmp(yytext, "intrvl_t") == 0)
+	        new = "interval";
+	else if (strcmp(yytext, "dtime_t") == 0)
+                new = "timestamp";
+
+	if (new)
+	{
+		struct _yy_buffer *yb;
+
+		yb = mm_alloc(sizeof(struct _yy_buffer));
+
+		yb->buffer =  YY_CURRENT_BUFFER;
+		yb->lineno = yylineno;
+		yb->filename = mm_strdup(input_filename);
+		yb->next = yy_buffer;
+		yy_buffer = yb;
+
+		yy_scan_string(new);
+		return true;
+	}
+
+	return false;
+}
+
+/*
+ * Called before any actual parsing is done
+ */
+void
+scanner_init(const char *str)
+{
+	Size	slen = strlen(str);
+
+	/*
+	 * Might be left over after ereport()
+	 */
+	if (YY_CURRENT_BUFFER)
+		yy_delete_buffer(YY_CURRENT_BUFFER);
+
+	/*
+	 * Make a scan buffer with special termination needed by flex.
+	 */
+	scanbuf = mm_alloc(slen + 2);
+	memcpy(scanbuf, str, slen);
+	scanbuf[slen] = scanbuf[slen + 1] = YY_END_OF_BUFFER_CHAR;
+	scanbufhandle = yy_scan_buffer(scanbuf, slen + 2);
+
+	/* initialize literal buffer to a reasonable but expansible size */
+	literalalloc = 128;
+	literalbuf = (char *) mm_alloc(literalalloc);
+	startlit();
+
+	BEGIN(INITIAL);
+}
+
+
+/*
+ * Called after parsing is done to clean up after scanner_init()
+ */
+void
+scanner_finish(void)
+{
+	yy_delete_buffer(scanbufhandle);
+	free(scanbuf);
+}
+
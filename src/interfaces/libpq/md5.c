@@ -0,0 +1 @@
+../../../src/backend/libpq/md5.c
\ No newline at end of file
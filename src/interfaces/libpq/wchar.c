@@ -0,0 +1 @@
+../../../src/backend/utils/mb/wchar.c
\ No newline at end of file
@@ -367,3 +367,13 @@ select string_agg(distinct f1, ',' order by f1) from varchar_tbl;  -- ok
 select string_agg(distinct f1::text, ',' order by f1) from varchar_tbl;  -- not ok
 select string_agg(distinct f1, ',' order by f1::text) from varchar_tbl;  -- not ok
 select string_agg(distinct f1::text, ',' order by f1::text) from varchar_tbl;  -- ok
+
+-- hashed aggregation that doesn't fit in work_mem has to spill to disk
+set work_mem = '64kB';
+set enable_sort = false;
+select count(*), sum(c), sum(s), min(c), max(c)
+  from (select g % 5000 as k, count(*) as c, sum(g) as s
+          from generate_series(1, 20000) g group by g % 5000) ss;
+select count(*) from (select distinct g::text from generate_series(1, 20000) g) ss;
+reset enable_sort;
+reset work_mem;
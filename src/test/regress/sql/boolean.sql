@@ -201,6 +201,18 @@ SELECT '' AS "Not True", f1
    FROM BOOLTBL2
    WHERE f1 IS NOT TRUE;
 
+--
+-- Three-valued logic in quals and targetlists
+--
+SELECT a, b, a AND b AS "and", a OR b AS "or", NOT a AS "not",
+       a IS NULL AS "isnull", (a OR b) IS NOT NULL AS "notnull"
+   FROM (VALUES (true, true), (true, false), (true, null),
+                (false, false), (false, null), (null, null)) v(a, b);
+
+SELECT x, x + 1 AS y
+   FROM (VALUES (1), (null), (3)) v(x)
+   WHERE x IS NULL OR x > 2;
+
 --
 -- Clean up
 -- Many tables are retained by the regression test, but these do not seem
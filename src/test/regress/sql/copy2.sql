@@ -164,6 +164,81 @@ c\.d
 
 COPY testeoc TO stdout CSV;
 
+-- test batched insertion; index entries, AFTER ROW triggers and error
+-- reports must still come out per row
+CREATE TEMP TABLE testbatch (a int, b text);
+CREATE UNIQUE INDEX testbatch_a ON testbatch (a);
+
+CREATE FUNCTION fn_testbatch_after() RETURNS TRIGGER AS '
+  BEGIN
+    RAISE NOTICE ''inserted %'', NEW.a;
+    RETURN NULL;
+  END;
+' LANGUAGE plpgsql;
+
+CREATE TRIGGER trg_testbatch_after AFTER INSERT ON testbatch
+    FOR EACH ROW EXECUTE PROCEDURE fn_testbatch_after();
+
+COPY testbatch FROM stdin;
+1	one
+2	two
+3	three
+2	again
+4	four
+\.
+
+COPY testbatch FROM stdin;
+1	one
+2	two
+3	three
+\.
+
+SELECT * FROM testbatch ORDER BY a;
+
+DROP TABLE testbatch;
+DROP FUNCTION fn_testbatch_after();
+
+-- test parallel parsing; the result must not depend on whether any
+-- workers could be started
+CREATE TABLE testparallel (a int, b text, c text DEFAULT 'dflt');
+
+COPY testparallel (a, b) FROM stdin (FORMAT csv, FORCE_NOT_NULL (b), PARALLEL 2);
+1,one
+2,"two, quoted"
+3,
+4,"four ""quoted"""
+5,five
+\.
+
+SELECT * FROM testparallel ORDER BY a;
+
+COPY testparallel TO stdout (PARALLEL 2);
+COPY testparallel FROM stdin (FORMAT 'binary', PARALLEL 2);
+COPY testparallel FROM stdin (PARALLEL -1);
+
+DROP TABLE testparallel;
+
+-- special characters beyond the first few bytes of long lines and fields
+CREATE TEMP TABLE testscan (a text, b text);
+
+COPY testscan FROM stdin;
+abcdefghijklmnopqrstuvwxyz\tabcdefghij\\klmnopqrstuvwxyz	0123456789012345678901234567890123456789
+abcdefghijklmnopqrstuvwxyz0123456789	\N
+\.
+
+COPY testscan FROM stdin CSV;
+"abcdefghijklmnopqrstuvwxyz ""quoted"" abcdefghijklmnopqrstuvwxyz",abcdefghijklmnopqrstuvwxyz
+"abcdefghijklmnopqrstuvwxyz
+abcdefghijklmnopqrstuvwxyz",
+\.
+
+SELECT length(a) AS alen, length(b) AS blen, b IS NULL AS bnull,
+       position(E'\t' in a) AS tab, position(E'\\' in a) AS bs,
+       position('"' in a) AS quote, position(E'\n' in a) AS nl
+  FROM testscan ORDER BY alen;
+
+DROP TABLE testscan;
+
 DROP TABLE x, y;
 DROP FUNCTION fn_x_before();
 DROP FUNCTION fn_x_after();
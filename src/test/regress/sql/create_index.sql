@@ -426,3 +426,71 @@ RESET enable_indexscan;
 RESET enable_bitmapscan;
  
 DROP TABLE onek_with_null;
+
+--
+-- Index builds big enough to use parallel sort workers
+--
+SET maintenance_work_mem = '1MB';
+SET max_parallel_maintenance_workers = 2;
+
+CREATE TABLE parallel_sort_tbl (a int4, b text);
+INSERT INTO parallel_sort_tbl
+  SELECT (i * 7919) % 200000, i::text FROM generate_series(1, 200000) i;
+
+CREATE UNIQUE INDEX parallel_sort_idx ON parallel_sort_tbl (a, b);
+
+SET enable_seqscan = OFF;
+SET enable_bitmapscan = OFF;
+SELECT count(*) FROM parallel_sort_tbl WHERE a < 1000;
+SELECT a, b FROM parallel_sort_tbl WHERE a BETWEEN 99998 AND 100001 ORDER BY a;
+RESET enable_seqscan;
+RESET enable_bitmapscan;
+
+-- duplicates must still be found
+INSERT INTO parallel_sort_tbl VALUES (12345, 'dup');
+CREATE UNIQUE INDEX parallel_sort_idx2 ON parallel_sort_tbl (a);
+
+RESET maintenance_work_mem;
+RESET max_parallel_maintenance_workers;
+DROP TABLE parallel_sort_tbl;
+
+--
+-- Index-only scans
+--
+CREATE TABLE ios_tbl (a int4, b int4, c text);
+INSERT INTO ios_tbl SELECT i, i % 10, 'row ' || i FROM generate_series(1, 1000) i;
+CREATE INDEX ios_tbl_a_b ON ios_tbl (a, b);
+VACUUM ios_tbl;
+
+SET enable_seqscan = OFF;
+SET enable_bitmapscan = OFF;
+EXPLAIN (COSTS OFF)
+SELECT a, b FROM ios_tbl WHERE a < 5 ORDER BY a;
+SELECT a, b FROM ios_tbl WHERE a < 5 ORDER BY a;
+EXPLAIN (COSTS OFF)
+SELECT count(*) FROM ios_tbl WHERE a > 990 AND b > 5;
+SELECT count(*) FROM ios_tbl WHERE a > 990 AND b > 5;
+-- c is not in the index, so the heap must be visited
+EXPLAIN (COSTS OFF)
+SELECT a, c FROM ios_tbl WHERE a < 3 ORDER BY a;
+
+-- changes since the VACUUM must be seen
+UPDATE ios_tbl SET b = -b WHERE a = 3;
+DELETE FROM ios_tbl WHERE a = 4;
+SELECT a, b FROM ios_tbl WHERE a < 5 ORDER BY a;
+
+SET enable_indexonlyscan = OFF;
+EXPLAIN (COSTS OFF)
+SELECT a, b FROM ios_tbl WHERE a < 5 ORDER BY a;
+RESET enable_indexonlyscan;
+
+-- expression columns can't be returned, but the plain ones still can
+DROP INDEX ios_tbl_a_b;
+CREATE INDEX ios_tbl_a_lower_c ON ios_tbl (a, lower(c));
+EXPLAIN (COSTS OFF)
+SELECT a FROM ios_tbl WHERE a < 3 ORDER BY a;
+SELECT a FROM ios_tbl WHERE a < 3 ORDER BY a;
+RESET enable_seqscan;
+RESET enable_bitmapscan;
+
+DROP TABLE ios_tbl;
@@ -644,3 +644,23 @@ SELECT * FROM b LEFT JOIN a ON (b.a_id = a.id) WHERE (a.id IS NULL OR a.id > 0);
 SELECT b.* FROM b LEFT JOIN a ON (b.a_id = a.id) WHERE (a.id IS NULL OR a.id > 0);
 
 rollback;
+
+--
+-- test hash joins whose outer scan applies a Bloom filter of the inner keys
+--
+set enable_nestloop = off;
+set enable_mergejoin = off;
+
+explain (costs off)
+select count(*), sum(a.unique1) from tenk1 a join tenk2 b on a.unique1 = b.unique1
+  where b.thousand = 5;
+select count(*), sum(a.unique1) from tenk1 a join tenk2 b on a.unique1 = b.unique1
+  where b.thousand = 5;
+explain (costs off)
+select count(*) from tenk1 a
+  where exists (select 1 from tenk2 b where b.unique1 = a.unique2 + 1 and b.ten = 0);
+select count(*) from tenk1 a
+  where exists (select 1 from tenk2 b where b.unique1 = a.unique2 + 1 and b.ten = 0);
+
+reset enable_nestloop;
+reset enable_mergejoin;
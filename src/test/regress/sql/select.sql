@@ -207,3 +207,33 @@ drop function sillysrf(int);
 -- (see bug #5084)
 select * from (values (2),(null),(1)) v(k) where k = k order by k;
 select * from (values (2),(null),(1)) v(k) where k = k;
+
+-- Single-key sorts on int4, int8 and float8 use specialized comparators
+select array_agg(f order by f desc nulls first)
+  from (values (1.5::float8), ('NaN'), (null), (-2), ('-Infinity'), (1.5)) v(f);
+select array_agg(i order by i)
+  from (values (3::int8), (null), ('-9223372036854775808'), ('9223372036854775807'), (0)) v(i);
+select array_agg(i order by i desc)
+  from (select (i * 37) % 11 from generate_series(1, 11) i) s(i);
+select (select array_agg(x) from
+          (select (i * 7919) % 1000 as x from generate_series(1, 1000) i
+           order by 1) s) =
+       (select array_agg(i) from generate_series(0, 999) i) as sorted;
+
+-- Simple comparisons with constants are evaluated over batches of tuples
+create temp table batchtest as
+  select i, i::int2 as s, i::int8 * 1000000000 as b, (i / 4.0)::float8 as f,
+         (i / 4.0)::float4 as r, date '2000-01-01' + i as d
+  from generate_series(1, 1000) i;
+insert into batchtest values (null, null, null, 'NaN', 'NaN', null);
+select count(*) from batchtest where i > 100 and s <= 200::int2 and 5 < i;
+select count(*) from batchtest where b <> 5000000000 and f >= 249.5::float8;
+select count(*) from batchtest where r > 249.5::float4;
+select count(*) from batchtest where f < 'NaN'::float8;
+select i, d from batchtest where d = '2000-01-11' and i % 2 = 0;
+begin;
+declare c no scroll cursor for select i from batchtest where i > 990;
+fetch 2 from c;
+update batchtest set s = -1 where current of c;
+select i, s from batchtest where s < 0;
+rollback;
@@ -0,0 +1,56 @@
+--
+-- PARALLEL
+--
+
+-- encourage use of parallel plans
+set parallel_setup_cost=0;
+set parallel_tuple_cost=0;
+set max_parallel_degree=4;
+
+explain (costs off)
+  select count(*) from tenk1;
+select count(*) from tenk1;
+
+explain (costs off)
+  select sum(unique1) from tenk1 where ten = 3;
+select sum(unique1) from tenk1 where ten = 3;
+
+-- parallel hash joins, whose participants build a shared hash table
+explain (costs off)
+  select count(*) from tenk1 a join tenk1 b on a.unique1 = b.unique2;
+select count(*) from tenk1 a join tenk1 b on a.unique1 = b.unique2;
+
+explain (costs off)
+  select count(*), count(b.unique1) from tenk1 a
+    left join tenk1 b on a.unique1 = b.unique2 and b.ten = 0;
+select count(*), count(b.unique1) from tenk1 a
+  left join tenk1 b on a.unique1 = b.unique2 and b.ten = 0;
+
+select count(*) from tenk1 a
+  where not exists (select 1 from tenk1 b where b.unique1 = a.unique2 + 1);
+
+-- with little memory, the table is split into batches, and the number of
+-- batches grows when the inner side turns out to be bigger than expected
+set work_mem = 64;
+select count(*), sum(a.unique2), sum(length(b.stringu1 || b.string4))
+  from tenk1 a join tenk1 b on a.unique1 = b.unique2 where b.unique1 % 2 = 0;
+
+-- ... and skew buckets are made for the common values of a.hundred
+explain (costs off)
+  select count(*), sum(b.unique1) from tenk1 a
+    join tenk1 b on a.hundred = b.unique1;
+select count(*), sum(b.unique1) from tenk1 a
+  join tenk1 b on a.hundred = b.unique1;
+reset work_mem;
+
+-- workers aren't used once the transaction has written something, but
+-- the results must be the same
+begin;
+create temp table parallel_t (a int);
+insert into parallel_t values (1);
+select sum(unique1) from tenk1 where ten = 3;
+rollback;
+
+reset max_parallel_degree;
+reset parallel_tuple_cost;
+reset parallel_setup_cost;
@@ -55,3 +55,18 @@ VACUUM FULL vactst;
 
 DROP TABLE vaccluster;
 DROP TABLE vactst;
+
+-- parallel index vacuuming
+CREATE TABLE vacparallel (a int, b text);
+CREATE INDEX vacparallel_a ON vacparallel (a);
+CREATE INDEX vacparallel_b ON vacparallel (b);
+CREATE INDEX vacparallel_ab ON vacparallel (a, b);
+INSERT INTO vacparallel SELECT i, 'row ' || i FROM generate_series(1, 10000) i;
+DELETE FROM vacparallel WHERE a % 3 = 0;
+VACUUM (PARALLEL 2) vacparallel;
+VACUUM (PARALLEL 2, ANALYZE) vacparallel;
+SELECT count(*) FROM vacparallel WHERE a > 9000;
+VACUUM (PARALLEL 2, FULL) vacparallel;
+VACUUM (PARALLEL) vacparallel;
+VACUUM (WORKERS 2) vacparallel;
+DROP TABLE vacparallel;